@@ -47,6 +47,10 @@ function LootBeacon.CommandRegistry:initialize()
         "LootBeacon.Config:setHighlightDuration(%line)",
         "Set highlight duration in seconds")
 
+    self:registerCommand("loot_beacon_set_highlight_frame_budget_ms",
+        "LootBeacon.Config:setHighlightFrameBudget(%line)",
+        "Set the per-frame time budget in milliseconds for spawning and removing highlights")
+
     self:registerCommand("loot_beacon_set_show_message",
         "LootBeacon.Config:setShowMessage(%line)",
         "Set show message flag (0=off, 1=on)")
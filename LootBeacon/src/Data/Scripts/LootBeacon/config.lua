@@ -12,6 +12,7 @@ LootBeacon.Config = {
     animalCorpseParticleEffectPath = "loot_beacon.pillar_blue",
     customEntityParticleEffectPath = "loot_beacon.pillar_orange",
     highlightDuration = 5.0,
+    highlightFrameBudgetMs = 2.0,
     showMessage = true,
     keyBinding = "f4",
     illegalHighlightKeyBinding = "none",
@@ -102,6 +103,7 @@ function LootBeacon.Config:logConfigSummary()
     LootBeacon.Logger:info("- Custom entity classes: %s", self.customEntityClasses)
     LootBeacon.Logger:info("- Custom entity particle effect: %s", self.customEntityParticleEffectPath)
     LootBeacon.Logger:info("- Highlight duration: %gs", self.highlightDuration)
+    LootBeacon.Logger:info("- Highlight frame budget: %gms", self.highlightFrameBudgetMs)
     LootBeacon.Logger:info("- Show messages: %s", self.showMessage and "Yes" or "No")
     LootBeacon.Logger:info("- Highlight items: %s", self.highlightItems and "Yes" or "No")
     LootBeacon.Logger:info("- Highlight corpses: %s", self.highlightCorpses and "Yes" or "No")
@@ -261,6 +263,17 @@ function LootBeacon.Config:setHighlightDuration(line)
     end
 end
 
+function LootBeacon.Config:setHighlightFrameBudget(line)
+    local value = self:parseNumberFromLine(line)
+    if value and value > 0 then
+        self.highlightFrameBudgetMs = value
+        LootBeacon.Logger:info("Highlight frame budget set to: %g ms", value)
+        self.configLoaded = true
+    else
+        LootBeacon.Logger:warning("Invalid highlight frame budget, using default: %g", self.highlightFrameBudgetMs)
+    end
+end
+
 function LootBeacon.Config:setShowMessage(line)
     local value = self:parseNumberFromLine(line)
     if value == 0 or value == 1 then
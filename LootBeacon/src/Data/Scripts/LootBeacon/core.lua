@@ -49,7 +49,8 @@ function LootBeacon.Core:shutdown()
     LootBeacon.Logger:info("Shutting down %s", self.MOD_NAME)
 
     -- Clean up highlights if active
-    LootBeacon.Highlighter:removeAllHighlights()
+    LootBeacon.Highlighter:removeAllHighlights(true)
+    LootBeacon.EntityDetector:resetIndex()
 
     -- Unregister events
     LootBeacon.EventHandler:unregisterEvents()
@@ -14,7 +14,15 @@ LootBeacon.EntityDetector = {
         animals = {}, -- All animal corpses
         custom = {},  -- All custom entity classes
         metadata = {} -- Metadata for all entities (indexed by entity.id)
-    }
+    },
+
+    -- Parsed custom entity classes (see getCustomClassSet)
+    customClassSet = {},
+    customClassSource = nil,
+
+    -- Persistent classification index, diffed by each scan (see detectEntities)
+    index = {}, -- entity.id -> {entity=entity, category=category, metadata=metadata}
+    indexKey = nil
 }
 
 function LootBeacon.EntityDetector:initialize()
@@ -22,6 +30,9 @@ function LootBeacon.EntityDetector:initialize()
     return self
 end
 
+-- Scans the detection sphere against the persistent index: entities seen by an earlier scan
+-- keep their classification, only new ones are classified, and ones no longer in range are
+-- dropped. The results lists are rebuilt from the index.
 function LootBeacon.EntityDetector:detectEntities()
     -- Reset previous results
     self:resetResults()
@@ -38,11 +49,52 @@ function LootBeacon.EntityDetector:detectEntities()
     local allEntities = System.GetEntitiesInSphere(playerPos, radius)
     LootBeacon.Logger:debug("Found %d total entities within %gm radius", #allEntities, radius)
 
-    -- Process and filter entities
+    local scan = self:newScanContext()
+    if not scan.playerId then
+        LootBeacon.Logger:warning("Player reference is invalid")
+    end
+
+    -- Diff against the index
+    local previous = self:getIndex()
+    local current = {}
+    local added, unchanged = 0, 0
     for _, entity in pairs(allEntities) do
-        self:processEntity(entity)
+        local id = entity and entity.id
+        local entry = id and previous[id]
+        if entry and entry.entity == entity and self:isEntryCurrent(entry, scan) then
+            unchanged = unchanged + 1
+        else
+            local category, metadata = self:processEntity(entity, scan)
+            entry = nil
+            if id and category then
+                entry = { entity = entity, category = category, metadata = metadata }
+                added = added + 1
+            end
+        end
+        if entry then
+            current[id] = entry
+        end
     end
 
+    local removed = 0
+    for id in pairs(previous) do
+        if not current[id] then
+            removed = removed + 1
+        end
+    end
+    self.index = current
+
+    -- Rebuild the results from the index
+    for id, entry in pairs(current) do
+        local list = self.results[entry.category]
+        if list then
+            table.insert(list, entry.entity)
+            self.results.metadata[id] = entry.metadata
+        end
+    end
+
+    LootBeacon.Logger:debug("Scan diff: %d new, %d unchanged, %d gone", added, unchanged, removed)
+
     -- Log counts
     LootBeacon.Logger:info("Detected: %d items, %d corpses, %d animals, %d custom entities",
         #self.results.items,
@@ -53,6 +105,52 @@ function LootBeacon.EntityDetector:detectEntities()
     return self.results
 end
 
+-- Returns the index, emptied when a setting that changes the classification has changed
+-- since it was built (keyed on detectionRadius like the scan itself)
+function LootBeacon.EntityDetector:getIndex()
+    local key = string.format("%g|%s|%s",
+        LootBeacon.Config.detectionRadius,
+        LootBeacon.Config.customEntityClasses or "",
+        tostring(LootBeacon.Config.treatUnconsciousAsDead))
+    if self.indexKey ~= key then
+        self.index = {}
+        self.indexKey = key
+    end
+    return self.index
+end
+
+function LootBeacon.EntityDetector:resetIndex()
+    self.index = {}
+    self.indexKey = nil
+end
+
+-- Cheap re-checks for an indexed entity: the states that can change without the entity
+-- leaving the sphere (an item picked up and hidden, an item taken into use or changing
+-- owner, an unconscious body waking up)
+function LootBeacon.EntityDetector:isEntryCurrent(entry, scan)
+    local entity = entry.entity
+    if entity:IsHidden() == true then
+        return false
+    end
+    if entry.category == "items" then
+        -- Same predicates as getItemPickabilityInfo, minus the lookups that cannot change
+        local item = entity.item
+        local playerId = scan.playerId
+        if not item or not playerId or item:IsUsed() == true or item:CanPickUp(playerId) == false then
+            return false
+        end
+        if entry.metadata then
+            entry.metadata.requires_stealing = item:CanSteal(playerId) and true or false
+        end
+        return true
+    end
+    if scan.treatUnconsciousAsDead and (entry.category == "corpses" or entry.category == "animals") then
+        local actor = entity.actor
+        return actor ~= nil and (actor:IsDead() or actor:IsUnconscious())
+    end
+    return true
+end
+
 function LootBeacon.EntityDetector:resetResults()
     self.results = {
         items = {},
@@ -63,22 +161,64 @@ function LootBeacon.EntityDetector:resetResults()
     }
 end
 
-function LootBeacon.EntityDetector:processEntity(entity)
+-- Returns the configured custom entity classes as a lookup set, parsed once per distinct
+-- config string (the comma-separated list used to be re-split for every entity scanned)
+function LootBeacon.EntityDetector:getCustomClassSet()
+    local classes = LootBeacon.Config.customEntityClasses or ""
+    if self.customClassSource ~= classes then
+        local set = {}
+        for class in string.gmatch(classes, "([^,]+)") do
+            -- Trim whitespace
+            class = string.match(class, "^%s*(.-)%s*$")
+            if class and class ~= "" then
+                set[class] = true
+            end
+        end
+        self.customClassSet = set
+        self.customClassSource = classes
+    end
+    return self.customClassSet
+end
+
+-- Per-scan context: everything processEntity needs that does not change between entities,
+-- resolved once per scan instead of once per entity
+function LootBeacon.EntityDetector:newScanContext()
+    return {
+        debug = LootBeacon.Logger:isDebugEnabled(),
+        customClasses = self:getCustomClassSet(),
+        playerId = player and player.id,
+        treatUnconsciousAsDead = LootBeacon.Config.treatUnconsciousAsDead
+    }
+end
+
+-- Classifies one entity. Returns the results list it belongs to ("items", "corpses",
+-- "animals", "custom"), "other" for an entity that can never qualify (safe to index), or
+-- nil when it does not qualify now but might later (hidden, alive, not pickable yet),
+-- plus its metadata
+function LootBeacon.EntityDetector:processEntity(entity, scan)
+    scan = scan or self:newScanContext()
+    local debug = scan.debug
+
     -- Debug separator start
-    LootBeacon.Logger:debug("==============1===============")
-    LootBeacon.Logger:debug("Entity: %s", tostring(entity))
-    LootBeacon.Logger:debug("Entity Name: %s", self:getEntityName(entity))
-    LootBeacon.Logger:debug("Entity Class: %s", tostring(entity.class))
+    if debug then
+        LootBeacon.Logger:debug("==============1===============")
+        LootBeacon.Logger:debug("Entity: %s", tostring(entity))
+        LootBeacon.Logger:debug("Entity Name: %s", self:getEntityName(entity))
+        LootBeacon.Logger:debug("Entity Class: %s", tostring(entity.class))
+    end
 
     -- Skip invalid or hidden entities
     if not entity or entity:IsHidden() == true then
-        LootBeacon.Logger:debug("Entity is hidden, skipping")
-        return
+        if debug then
+            LootBeacon.Logger:debug("Entity is hidden, skipping")
+        end
+        return nil, nil
     end
 
     -- Initialize metadata for this entity
+    local metadata = nil
     if entity.id then
-        self.results.metadata[entity.id] = {
+        metadata = {
             requires_stealing = false,
             illegal_corpse = false,
             is_pickable = false,
@@ -86,125 +226,166 @@ function LootBeacon.EntityDetector:processEntity(entity)
         }
     end
 
+    local class = entity.class
+    local category = nil
+
     -- First check if it's a custom entity class
-    if self:isCustomEntityClass(entity.class) then
-        LootBeacon.Logger:debug("Found custom entity class: %s", entity.class)
-        table.insert(self.results.custom, entity)
-        if entity.id then
-            self.results.metadata[entity.id].is_custom = true
+    if class and scan.customClasses[class] then
+        if debug then
+            LootBeacon.Logger:debug("Found custom entity class: %s", class)
+        end
+        category = "custom"
+        if metadata then
+            metadata.is_custom = true
         end
 
         -- Check if entity is an actor (NPC or Animal)
     elseif entity["actor"] then
-        if entity.actor:IsDead() or (LootBeacon.Config.treatUnconsciousAsDead and entity.actor:IsUnconscious()) then
+        local actor = entity.actor
+        if actor:IsDead() or (scan.treatUnconsciousAsDead and actor:IsUnconscious()) then
             -- Check if corpse is illegal to loot
-            local isIllegalCorpse = false
             if entity["soul"] and not entity.soul:IsLegalToLoot() then
-                isIllegalCorpse = true
-                if entity.id then
-                    self.results.metadata[entity.id].illegal_corpse = true
+                if metadata then
+                    metadata.illegal_corpse = true
+                end
+                if debug then
+                    LootBeacon.Logger:debug("Corpse is illegal to loot")
                 end
-                LootBeacon.Logger:debug("Corpse is illegal to loot")
             end
 
             -- First check if it's a human
             if entity["human"] then
-                LootBeacon.Logger:debug("Entity is a dead human")
-                table.insert(self.results.corpses, entity)
+                if debug then
+                    LootBeacon.Logger:debug("Entity is a dead human")
+                end
+                category = "corpses"
             else
-                LootBeacon.Logger:debug("Entity is a dead animal")
-                table.insert(self.results.animals, entity)
+                if debug then
+                    LootBeacon.Logger:debug("Entity is a dead animal")
+                end
+                category = "animals"
             end
-        else
+        elseif debug then
             LootBeacon.Logger:debug("Actor is alive, skipping")
         end
 
         -- Check for pickable items
-    elseif entity.class == self.ENTITY_CLASS_PICKABLE then
-        LootBeacon.Logger:debug("Found pickable item")
+    elseif class == self.ENTITY_CLASS_PICKABLE then
+        if debug then
+            LootBeacon.Logger:debug("Found pickable item")
+        end
 
         -- Get basic item pickability status
-        local isPickable, requiresStealing = self:getItemPickabilityInfo(entity)
+        local isPickable, requiresStealing = self:getItemPickabilityInfo(entity, scan)
 
         if isPickable then
-            LootBeacon.Logger:debug("Item is pickable, adding to items list")
-            table.insert(self.results.items, entity)
+            if debug then
+                LootBeacon.Logger:debug("Item is pickable, adding to items list")
+            end
+            category = "items"
 
-            if entity.id then
-                self.results.metadata[entity.id].is_pickable = true
+            if metadata then
+                metadata.is_pickable = true
 
                 if requiresStealing then
-                    self.results.metadata[entity.id].requires_stealing = true
-                    LootBeacon.Logger:debug("Item requires stealing")
+                    metadata.requires_stealing = true
+                    if debug then
+                        LootBeacon.Logger:debug("Item requires stealing")
+                    end
                 end
             end
-        else
+        elseif debug then
             LootBeacon.Logger:debug("Item not pickable, skipping")
         end
     else
         -- If we got here, it's an entity that doesn't match any category
-        LootBeacon.Logger:debug("IS OTHER ENTITY")
+        category = "other"
+        if debug then
+            LootBeacon.Logger:debug("IS OTHER ENTITY")
+        end
     end
 
     -- Debug separator end - only one place
-    LootBeacon.Logger:debug("==============1===============")
+    if debug then
+        LootBeacon.Logger:debug("==============1===============")
+    end
+
+    return category, metadata
 end
 
-function LootBeacon.EntityDetector:getItemPickabilityInfo(pickableItem)
+-- Checks run cheapest first and stop at the first rejection: the engine calls that only
+-- matter for an accepted item (CanSteal) or only feed a log line (GetItemName) are skipped
+-- for everything that is filtered out. The result is the same as checking them in any order.
+function LootBeacon.EntityDetector:getItemPickabilityInfo(pickableItem, scan)
     if not pickableItem or not pickableItem.item then
         LootBeacon.Logger:warning("Invalid pickable item passed to getItemPickabilityInfo")
         return false, false
     end
 
+    scan = scan or self:newScanContext()
+    local debug = scan.debug
+    local playerId = scan.playerId
+    local item = pickableItem.item
+
+    -- Without a valid player nothing can be picked up (detectEntities warns once per scan)
+    if not playerId then
+        return false, false
+    end
+
     -- Get item ID safely
-    local itemId = pickableItem.item:GetId()
+    local itemId = item:GetId()
     if not itemId then
-        LootBeacon.Logger:debug("Item has no ID, skipping")
+        if debug then
+            LootBeacon.Logger:debug("Item has no ID, skipping")
+        end
         return false, false
     end
 
     -- Get item entity
     local itemEntity = ItemManager.GetItem(itemId)
     if not itemEntity then
-        LootBeacon.Logger:debug("Failed to get item entity for ID: %s", tostring(itemId))
+        if debug then
+            LootBeacon.Logger:debug("Failed to get item entity for ID: %s", tostring(itemId))
+        end
         return false, false
     end
 
-    -- Get item name for logs
-    local itemName = ItemManager.GetItemName(itemEntity.class) or "unknown"
-    local itemUIName = pickableItem.item:GetUIName() or ""
-
-    LootBeacon.Logger:debug("Checking item: %s, UI name: %s", itemName, itemUIName)
+    -- Item name is only needed for the log lines
+    local itemName = debug and (ItemManager.GetItemName(itemEntity.class) or "unknown") or nil
+    local itemUIName = item:GetUIName() or ""
 
-    -- Check if the player can pick up the item
-    if not player or not player.id then
-        LootBeacon.Logger:warning("Player reference is invalid")
-        return false, false
+    if debug then
+        LootBeacon.Logger:debug("Checking item: %s, UI name: %s", itemName, itemUIName)
     end
 
-    -- Check if item can be picked up
-    if pickableItem.item:CanPickUp(player.id) == false then
-        LootBeacon.Logger:debug("Item %s is not pickupable by player, skipping", itemName)
+    -- Skip items with empty UI names (NPC only items)
+    if itemUIName == "" then
+        if debug then
+            LootBeacon.Logger:debug("Item %s is NPC only, skipping", itemName)
+        end
         return false, false
     end
 
-    -- Check if item requires stealing
-    local requiresStealing = false
-    if pickableItem.item:CanSteal(player.id) then
-        requiresStealing = true
-        LootBeacon.Logger:debug("Item %s requires stealing", itemName)
+    -- Skip items that are being used
+    if item:IsUsed() == true then
+        if debug then
+            LootBeacon.Logger:debug("Item %s is being used, skipping", itemName)
+        end
+        return false, false
     end
 
-    -- Skip items with empty UI names (NPC only items)
-    if itemUIName == "" then
-        LootBeacon.Logger:debug("Item %s is NPC only, skipping", itemName)
+    -- Check if item can be picked up
+    if item:CanPickUp(playerId) == false then
+        if debug then
+            LootBeacon.Logger:debug("Item %s is not pickupable by player, skipping", itemName)
+        end
         return false, false
     end
 
-    -- Skip items that are being used
-    if pickableItem.item:IsUsed() == true then
-        LootBeacon.Logger:debug("Item %s is being used, skipping", itemName)
-        return false, false
+    -- Check if item requires stealing
+    local requiresStealing = item:CanSteal(playerId) and true or false
+    if requiresStealing and debug then
+        LootBeacon.Logger:debug("Item %s requires stealing", itemName)
     end
 
     return true, requiresStealing
@@ -240,20 +421,10 @@ function LootBeacon.EntityDetector:getEntityName(entity)
 end
 
 function LootBeacon.EntityDetector:isCustomEntityClass(className)
-    if not className or not LootBeacon.Config.customEntityClasses or LootBeacon.Config.customEntityClasses == "" then
+    if not className then
         return false
     end
-
-    -- Split the comma-separated string into a table
-    for class in string.gmatch(LootBeacon.Config.customEntityClasses, "([^,]+)") do
-        -- Trim whitespace
-        class = string.match(class, "^%s*(.-)%s*$")
-        if class and class ~= "" and className == class then
-            return true
-        end
-    end
-
-    return false
+    return self:getCustomClassSet()[className] == true
 end
 
 return LootBeacon.EntityDetector
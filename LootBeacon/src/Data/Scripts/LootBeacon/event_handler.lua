@@ -50,9 +50,9 @@ function LootBeacon.EventHandler:onGamePause()
     LootBeacon.Logger:debug("Game pause event received")
 
     -- Remove highlights when game is paused for safety
-    if LootBeacon.Highlighter.isActive then
+    if LootBeacon.Highlighter:hasHighlights() then
         LootBeacon.Logger:debug("Game paused - removing active highlights for safety")
-        LootBeacon.Highlighter:removeAllHighlights()
+        LootBeacon.Highlighter:removeAllHighlights(true)
     end
 end
 
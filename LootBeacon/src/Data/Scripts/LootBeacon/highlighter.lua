@@ -7,9 +7,34 @@ LootBeacon.Highlighter = {
     -- State tracking
     isActive = false,
     timerID = nil,
-    highlightedEntities = {} -- Format: {{entity=entity, slot=slot}, ...}
+    releaseTimerID = nil,
+    highlightedEntities = {}, -- Format: {[entity.id]={entity=entity, slot=slot, effectPath=path, hidden=bool}, ...}
+
+    -- Time-sliced work: particles are spawned (nearest first) and freed a slice at a time,
+    -- each slice bounded by Config.highlightFrameBudgetMs, the rest continued by a timer
+    spawnQueue = {}, -- Format: {{entity=entity, effectPath=path, distSq=d}, ...}
+    spawnNext = 1,
+    spawnTimerID = nil,
+    freeQueue = {}, -- Format: {{entity=entity, slot=slot}, ...}
+    freeNext = 1,
+    freeTimerID = nil,
+
+    -- Delay before the next slice (the timer fires on a following frame)
+    SLICE_DELAY_MS = 1,
+
+    -- How long timed-out highlights stay loaded (hidden) so a re-activation only applies
+    -- the difference; after that every slot is freed
+    RETAIN_HIDDEN_MS = 30000
 }
 
+-- Milliseconds from a monotonic clock, for the per-slice budget
+local function nowMs()
+    if System.GetCurrAsyncTime then
+        return System.GetCurrAsyncTime() * 1000
+    end
+    return os.clock() * 1000
+end
+
 function LootBeacon.Highlighter:initialize()
     LootBeacon.Logger:debug("Initializing Highlighter")
     return self
@@ -18,10 +43,9 @@ end
 function LootBeacon.Highlighter:activateHighlights()
     LootBeacon.Logger:info("Activating highlights")
 
-    -- Cancel existing highlight if active
-    if self.isActive then
-        self:removeAllHighlights()
-    end
+    -- Cancel the pending timeout; highlights already applied are diffed, not rebuilt
+    self:cancelTimers()
+    self:cancelSpawning()
 
     -- Set state to active
     self.isActive = true
@@ -37,7 +61,7 @@ function LootBeacon.Highlighter:activateHighlights()
 
     -- Set timer to automatically remove highlights
     self.timerID = Script.SetTimer(LootBeacon.Config.highlightDuration * 1000, function()
-        LootBeacon.Highlighter:removeAllHighlights()
+        LootBeacon.Highlighter:hideAllHighlights()
     end)
 
     return counts
@@ -46,10 +70,9 @@ end
 function LootBeacon.Highlighter:activateIllegalHighlights()
     LootBeacon.Logger:info("Activating illegal item highlights")
 
-    -- Cancel existing highlight if active
-    if self.isActive then
-        self:removeAllHighlights()
-    end
+    -- Cancel the pending timeout; highlights already applied are diffed, not rebuilt
+    self:cancelTimers()
+    self:cancelSpawning()
 
     -- Set state to active
     self.isActive = true
@@ -65,7 +88,7 @@ function LootBeacon.Highlighter:activateIllegalHighlights()
 
     -- Set timer to automatically remove highlights
     self.timerID = Script.SetTimer(LootBeacon.Config.highlightDuration * 1000, function()
-        LootBeacon.Highlighter:removeAllHighlights()
+        LootBeacon.Highlighter:hideAllHighlights()
     end)
 
     return counts
@@ -84,6 +107,9 @@ function LootBeacon.Highlighter:applyHighlightEffects(entities, illegalOnly)
         total = 0
     }
 
+    -- entity.id -> {entity=entity, effectPath=path} for everything that should be lit
+    local wanted = {}
+
     -- Apply effects to pickable items
     if LootBeacon.Config.highlightItems then
         for _, entity in ipairs(entities.items) do
@@ -103,7 +129,7 @@ function LootBeacon.Highlighter:applyHighlightEffects(entities, illegalOnly)
                 end
             end
 
-            if shouldHighlight and self:applyEffectToEntity(entity, LootBeacon.Config.itemParticleEffectPath) then
+            if shouldHighlight and self:queueEffect(wanted, entity, LootBeacon.Config.itemParticleEffectPath) then
                 if metadata.requires_stealing then
                     counts.illegal_items = counts.illegal_items + 1
                 end
@@ -132,7 +158,7 @@ function LootBeacon.Highlighter:applyHighlightEffects(entities, illegalOnly)
                 end
             end
 
-            if shouldHighlight and self:applyEffectToEntity(entity, LootBeacon.Config.humanCorpseParticleEffectPath) then
+            if shouldHighlight and self:queueEffect(wanted, entity, LootBeacon.Config.humanCorpseParticleEffectPath) then
                 if metadata.illegal_corpse then
                     counts.illegal_corpses = counts.illegal_corpses + 1
                 end
@@ -161,7 +187,7 @@ function LootBeacon.Highlighter:applyHighlightEffects(entities, illegalOnly)
                 end
             end
 
-            if shouldHighlight and self:applyEffectToEntity(entity, LootBeacon.Config.animalCorpseParticleEffectPath) then
+            if shouldHighlight and self:queueEffect(wanted, entity, LootBeacon.Config.animalCorpseParticleEffectPath) then
                 if metadata.illegal_corpse then
                     counts.illegal_animals = counts.illegal_animals + 1 -- Track illegal animals separately
                 end
@@ -182,17 +208,168 @@ function LootBeacon.Highlighter:applyHighlightEffects(entities, illegalOnly)
                 shouldHighlight = false
             end
 
-            if shouldHighlight and self:applyEffectToEntity(entity, LootBeacon.Config.customEntityParticleEffectPath) then
+            if shouldHighlight and self:queueEffect(wanted, entity, LootBeacon.Config.customEntityParticleEffectPath) then
                 counts.custom = counts.custom + 1
                 counts.total = counts.total + 1
             end
         end
     end
 
-    LootBeacon.Logger:info("Applied highlights to %d entities", counts.total)
+    LootBeacon.Logger:info("Queued highlights for %d entities", counts.total)
+    self:syncHighlights(wanted)
     return counts
 end
 
+-- Marks an entity to be lit with effectPath; syncHighlights applies the set. Returns true
+-- when accepted, so the counts shown to the player are known before the spawning ends
+function LootBeacon.Highlighter:queueEffect(wanted, entity, effectPath)
+    if not entity or not entity.id or not effectPath then
+        LootBeacon.Logger:warning("Invalid entity or effect path")
+        return false
+    end
+
+    wanted[entity.id] = { entity = entity, effectPath = effectPath }
+    return true
+end
+
+-- Diffs the wanted set against the slots already loaded: matching ones are kept (shown
+-- again if a timeout hid them), the rest are freed, and only new entities get spawned
+function LootBeacon.Highlighter:syncHighlights(wanted)
+    local kept, freed = 0, 0
+    for id, data in pairs(self.highlightedEntities) do
+        local want = wanted[id]
+        if want and want.entity == data.entity and want.effectPath == data.effectPath
+            and (not data.hidden or self:setSlotVisible(data, true)) then
+            data.hidden = false
+            wanted[id] = nil
+            kept = kept + 1
+        else
+            self.highlightedEntities[id] = nil
+            table.insert(self.freeQueue, data)
+            freed = freed + 1
+        end
+    end
+
+    for _, want in pairs(wanted) do
+        table.insert(self.spawnQueue, want)
+    end
+
+    LootBeacon.Logger:debug("Highlight diff: %d kept, %d freed, %d to spawn", kept, freed, #self.spawnQueue)
+
+    if freed > 0 then
+        self:pumpFreeQueue(false)
+    end
+    self:startSpawning()
+end
+
+-- Shows or hides a loaded particle slot; false if the engine call failed
+function LootBeacon.Highlighter:setSlotVisible(data, visible)
+    local entity = data.entity
+    local slot = data.slot
+    local success = pcall(function() entity:DrawSlot(slot, visible and 1 or 0) end)
+    return success
+end
+
+-- Orders the queue nearest first and runs the first slice right away, so the beacons
+-- closest to the player appear on the activation frame
+function LootBeacon.Highlighter:startSpawning()
+    local queue = self.spawnQueue
+    local origin = player and player:GetWorldPos()
+    if origin then
+        for _, job in ipairs(queue) do
+            local ok, pos = pcall(function() return job.entity:GetWorldPos() end)
+            if ok and pos then
+                local dx, dy, dz = pos.x - origin.x, pos.y - origin.y, pos.z - origin.z
+                job.distSq = dx * dx + dy * dy + dz * dz
+            else
+                job.distSq = math.huge
+            end
+        end
+        table.sort(queue, function(a, b) return a.distSq < b.distSq end)
+    end
+
+    self.spawnNext = 1
+    self:pumpSpawnQueue()
+end
+
+-- Spawns queued particles until the frame budget is spent (always at least one), then
+-- schedules the remainder for a following frame
+function LootBeacon.Highlighter:pumpSpawnQueue()
+    self.spawnTimerID = nil
+
+    local queue = self.spawnQueue
+    local deadline = nowMs() + LootBeacon.Config.highlightFrameBudgetMs
+    local i = self.spawnNext
+    while i <= #queue do
+        local job = queue[i]
+        i = i + 1
+        self:applyEffectToEntity(job.entity, job.effectPath)
+        if nowMs() >= deadline then
+            break
+        end
+    end
+    self.spawnNext = i
+
+    if i <= #queue then
+        LootBeacon.Logger:debug("Spawned %d/%d highlights, continuing next frame", i - 1, #queue)
+        self.spawnTimerID = Script.SetTimer(self.SLICE_DELAY_MS, function()
+            LootBeacon.Highlighter:pumpSpawnQueue()
+        end)
+    else
+        LootBeacon.Logger:debug("Spawned all %d highlights", #queue)
+        self.spawnQueue = {}
+        self.spawnNext = 1
+    end
+end
+
+-- Drops the highlights not spawned yet (spawned ones are already in highlightedEntities)
+function LootBeacon.Highlighter:cancelSpawning()
+    if self.spawnTimerID then
+        Script.KillTimer(self.spawnTimerID)
+        self.spawnTimerID = nil
+    end
+    self.spawnQueue = {}
+    self.spawnNext = 1
+end
+
+-- Frees queued particle slots until the frame budget is spent (always at least one), then
+-- schedules the remainder. With drainAll the whole queue is freed now (pause, shutdown)
+function LootBeacon.Highlighter:pumpFreeQueue(drainAll)
+    if self.freeTimerID then
+        Script.KillTimer(self.freeTimerID)
+        self.freeTimerID = nil
+    end
+
+    local queue = self.freeQueue
+    local deadline = nowMs() + LootBeacon.Config.highlightFrameBudgetMs
+    local i = self.freeNext
+    while i <= #queue do
+        local data = queue[i]
+        i = i + 1
+
+        -- Safe free slot call
+        local entity = data.entity
+        local slot = data.slot
+        if entity and slot then
+            pcall(function() entity:FreeSlot(slot) end)
+        end
+
+        if not drainAll and nowMs() >= deadline then
+            break
+        end
+    end
+    self.freeNext = i
+
+    if i <= #queue then
+        self.freeTimerID = Script.SetTimer(self.SLICE_DELAY_MS, function()
+            LootBeacon.Highlighter:pumpFreeQueue(false)
+        end)
+    else
+        self.freeQueue = {}
+        self.freeNext = 1
+    end
+end
+
 function LootBeacon.Highlighter:applyEffectToEntity(entity, effectPath)
     if not entity or not effectPath then
         LootBeacon.Logger:warning("Invalid entity or effect path")
@@ -207,7 +384,7 @@ function LootBeacon.Highlighter:applyEffectToEntity(entity, effectPath)
 
     if success and result and result >= 0 then
         slot = result
-        table.insert(self.highlightedEntities, { entity = entity, slot = slot })
+        self.highlightedEntities[entity.id] = { entity = entity, slot = slot, effectPath = effectPath, hidden = false }
 
         -- Adjust orientation with randomized angles for visual variety
         -- self:adjustParticleOrientation(entity, slot)
@@ -277,33 +454,82 @@ function LootBeacon.Highlighter:adjustParticleOrientation(entity, slot)
     LootBeacon.Logger:debug("==============2===============")
 end
 
-function LootBeacon.Highlighter:removeAllHighlights()
-    if not self.isActive then
-        return
-    end
-
-    LootBeacon.Logger:info("Removing highlights from %d entities", #self.highlightedEntities)
-
-    -- Kill existing timer if active
+function LootBeacon.Highlighter:cancelTimers()
     if self.timerID then
         Script.KillTimer(self.timerID)
         self.timerID = nil
     end
+    if self.releaseTimerID then
+        Script.KillTimer(self.releaseTimerID)
+        self.releaseTimerID = nil
+    end
+end
 
-    -- Free all particle effect slots
-    for _, data in ipairs(self.highlightedEntities) do
-        local entity = data.entity
-        local slot = data.slot
+-- True while any particle slot is loaded, waiting to be spawned or still waiting to be freed
+function LootBeacon.Highlighter:hasHighlights()
+    return next(self.highlightedEntities) ~= nil
+        or self.spawnNext <= #self.spawnQueue
+        or self.freeNext <= #self.freeQueue
+end
 
-        -- Safe free slot call
-        if entity and slot then
-            pcall(function() entity:FreeSlot(slot) end)
+-- Highlight timeout: hides the slots instead of freeing them, so pressing the key again
+-- nearby only spawns what is new. They are freed after RETAIN_HIDDEN_MS
+function LootBeacon.Highlighter:hideAllHighlights()
+    self.timerID = nil
+    self:cancelSpawning()
+    self.isActive = false
+
+    local freed = 0
+    for id, data in pairs(self.highlightedEntities) do
+        if not data.hidden then
+            if self:setSlotVisible(data, false) then
+                data.hidden = true
+            else
+                self.highlightedEntities[id] = nil
+                table.insert(self.freeQueue, data)
+                freed = freed + 1
+            end
         end
     end
+    if freed > 0 then
+        self:pumpFreeQueue(false)
+    end
+
+    if self.releaseTimerID then
+        Script.KillTimer(self.releaseTimerID)
+    end
+    self.releaseTimerID = Script.SetTimer(self.RETAIN_HIDDEN_MS, function()
+        LootBeacon.Highlighter.releaseTimerID = nil
+        LootBeacon.Highlighter:removeAllHighlights()
+    end)
+end
+
+-- Removes every highlight, shown or hidden. Slots are freed over frames under the same
+-- budget as spawning unless immediate is set (pause and shutdown free them all before returning)
+function LootBeacon.Highlighter:removeAllHighlights(immediate)
+    self:cancelTimers()
+
+    -- Anything not spawned yet never needs freeing
+    self:cancelSpawning()
+
+    -- Hand the loaded slots to the free queue
+    local count = 0
+    for _, data in pairs(self.highlightedEntities) do
+        table.insert(self.freeQueue, data)
+        count = count + 1
+    end
+    if count > 0 then
+        LootBeacon.Logger:info("Removing highlights from %d entities", count)
+    end
 
     -- Reset state
     self.highlightedEntities = {}
     self.isActive = false
+
+    -- A previous removal may still be freeing slots over frames
+    if self.freeNext <= #self.freeQueue then
+        self:pumpFreeQueue(immediate == true)
+    end
 end
 
 return LootBeacon.Highlighter
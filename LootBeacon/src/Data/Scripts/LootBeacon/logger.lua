@@ -19,6 +19,12 @@ function LootBeacon.Logger:initialize(modName)
     return self
 end
 
+-- Whether debug lines are emitted. Hot loops check this once and skip their debug calls
+-- entirely, since the arguments (names, tostring) are built before log() can drop them.
+function LootBeacon.Logger:isDebugEnabled()
+    return LootBeacon.Config.logLevel <= self.LOG_LEVEL_DEBUG
+end
+
 function LootBeacon.Logger:debug(message, ...)
     self:log(self.LOG_LEVEL_DEBUG, message, ...)
 end
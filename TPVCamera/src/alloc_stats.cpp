@@ -0,0 +1,179 @@
+/**
+ * @file alloc_stats.cpp
+ * @brief Heap accounting counters and the module's operator new / delete replacement (see alloc_stats.hpp).
+ */
+
+#include "alloc_stats.hpp"
+#include "frame_arena.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <malloc.h>
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace TPVCamera::AllocStats
+{
+
+    namespace
+    {
+        constexpr std::array<const char *, k_tag_count> k_tag_names = {
+            "hooks / game threads", "init", "anchors + caches", "presets",
+            "overlay",              "workers", "logging",        "render frame",
+        };
+    } // namespace
+
+    const char *tag_name(AllocTag tag) noexcept
+    {
+        const std::size_t i = static_cast<std::size_t>(tag);
+        return i < k_tag_count ? k_tag_names[i] : "?";
+    }
+
+#if TPVCAMERA_ALLOC_STATS
+    namespace
+    {
+        // One line per tag, so threads of different subsystems never contend on a counter.
+        struct alignas(64) TagCounters
+        {
+            std::atomic<std::uint64_t> allocs{0};
+            std::atomic<std::uint64_t> frees{0};
+            std::atomic<std::uint64_t> bytes_allocated{0};
+            std::atomic<std::uint64_t> bytes_freed{0};
+        };
+
+        std::array<TagCounters, k_tag_count> s_counters{};
+
+        thread_local AllocTag t_tag = AllocTag::Hooks;
+    } // namespace
+
+    AllocTag set_thread_tag(AllocTag tag) noexcept
+    {
+        const AllocTag previous = t_tag;
+        t_tag = tag;
+        return previous;
+    }
+
+    void note_alloc(void *p) noexcept
+    {
+        if (p == nullptr)
+        {
+            return;
+        }
+        TagCounters &c = s_counters[static_cast<std::size_t>(t_tag)];
+        c.allocs.fetch_add(1, std::memory_order_relaxed);
+        c.bytes_allocated.fetch_add(_msize(p), std::memory_order_relaxed);
+    }
+
+    void note_free(void *p) noexcept
+    {
+        if (p == nullptr)
+        {
+            return;
+        }
+        TagCounters &c = s_counters[static_cast<std::size_t>(t_tag)];
+        c.frees.fetch_add(1, std::memory_order_relaxed);
+        c.bytes_freed.fetch_add(_msize(p), std::memory_order_relaxed);
+    }
+
+    Stats stats() noexcept
+    {
+        Stats s;
+        for (std::size_t i = 0; i < k_tag_count; ++i)
+        {
+            const TagCounters &c = s_counters[i];
+            TagStats &t = s.tag[i];
+            t.allocs = c.allocs.load(std::memory_order_relaxed);
+            t.frees = c.frees.load(std::memory_order_relaxed);
+            t.bytes_allocated = c.bytes_allocated.load(std::memory_order_relaxed);
+            t.bytes_freed = c.bytes_freed.load(std::memory_order_relaxed);
+            s.live_bytes += static_cast<std::int64_t>(t.bytes_allocated - t.bytes_freed);
+            s.live_blocks += static_cast<std::int64_t>(t.allocs - t.frees);
+        }
+        return s;
+    }
+
+    void dump_to_log()
+    {
+        DMK::Logger &logger = DMK::Logger::get_instance();
+        const Stats s = stats();
+        logger.info("Heap: {:.1f} KB live in {} block(s) (module operator new since launch)",
+                    static_cast<double>(s.live_bytes) / 1024.0, s.live_blocks);
+        for (std::size_t i = 0; i < k_tag_count; ++i)
+        {
+            const TagStats &t = s.tag[i];
+            logger.info("Heap:   {:<22} {:>9} alloc(s) {:>10.1f} KB, {:>9} free(s) {:>10.1f} KB", k_tag_names[i],
+                        t.allocs, static_cast<double>(t.bytes_allocated) / 1024.0, t.frees,
+                        static_cast<double>(t.bytes_freed) / 1024.0);
+        }
+    }
+#endif
+
+} // namespace TPVCamera::AllocStats
+
+#if TPVCAMERA_ALLOC_STATS || TPVCAMERA_FRAME_ALLOC_CHECK
+// Module-wide replacement of the throwing and nothrow scalar / array forms (the MSVC library routes the rest through
+// these); the over-aligned forms are left to the library and are not counted. Every block is malloc'd, so delete
+// frees with free and reads the block size back with _msize.
+void *operator new(std::size_t size)
+{
+#if TPVCAMERA_FRAME_ALLOC_CHECK
+    TPVCamera::FrameArena::note_heap_allocation();
+#endif
+    if (void *p = std::malloc(size != 0 ? size : 1))
+    {
+#if TPVCAMERA_ALLOC_STATS
+        TPVCamera::AllocStats::note_alloc(p);
+#endif
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+#if TPVCAMERA_FRAME_ALLOC_CHECK
+    TPVCamera::FrameArena::note_heap_allocation();
+#endif
+    void *p = std::malloc(size != 0 ? size : 1);
+#if TPVCAMERA_ALLOC_STATS
+    TPVCamera::AllocStats::note_alloc(p);
+#endif
+    return p;
+}
+
+void *operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept
+{
+    return ::operator new(size, tag);
+}
+
+void operator delete(void *p) noexcept
+{
+#if TPVCAMERA_ALLOC_STATS
+    TPVCamera::AllocStats::note_free(p);
+#endif
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    ::operator delete(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    ::operator delete(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept
+{
+    ::operator delete(p);
+}
+#endif
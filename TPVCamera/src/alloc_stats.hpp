@@ -0,0 +1,118 @@
+/**
+ * @file alloc_stats.hpp
+ * @brief Optional heap accounting of the module's own allocations, by subsystem, for the overlay and the log.
+ *
+ * @details TPVCAMERA_ALLOC_STATS (CMake option, OFF by default) replaces the module's global operator new / delete
+ *          with a shim over malloc / free that counts every allocation and free, and the bytes of each (_msize),
+ *          against the calling thread's AllocTag. Threads are tagged where the mod starts them (the overlay, the
+ *          preset loader and writer, the collision and raster helpers, the trace drain) and around the work of a
+ *          subsystem that runs on a borrowed thread (init, anchor resolution and its cache). The render thread is
+ *          tagged RenderFrame while a detour frame is open (FrameArena::FrameScope), so the counters the frame
+ *          budget cares about are separate from everything else it does. An untagged thread is a game or
+ *          DetourModKit thread running a hook or the logger: Hooks.
+ *
+ *          Scope of the figures: only this module's operator new. ImGui allocates through malloc (IM_ALLOC) and is
+ *          not seen; a log line counts against the thread that formatted it; the over-aligned new forms are left
+ *          to the library. A free is counted against the FREEING thread's tag, so a tag's allocated minus freed
+ *          is not its own live size; the live total (all tags) is exact.
+ *
+ *          Off, Scope and set_thread_tag() compile to nothing and no operator is replaced. On, an allocation costs
+ *          a thread-local read, an _msize call and two relaxed adds on its tag's own cache line.
+ *
+ *          Threading: the counters are relaxed atomics written from any thread; stats() and dump_to_log() may run
+ *          on any thread (the overlay, the health dump).
+ */
+#ifndef TPVCAMERA_ALLOC_STATS_HPP
+#define TPVCAMERA_ALLOC_STATS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef TPVCAMERA_ALLOC_STATS
+#define TPVCAMERA_ALLOC_STATS 0
+#endif
+
+namespace TPVCamera::AllocStats
+{
+
+    /// Who an allocation is counted against (see the file comment for how each is assigned).
+    enum class AllocTag : std::uint8_t
+    {
+        Hooks,       // untagged threads: game threads in a detour, DetourModKit's own threads
+        Init,        // TPVCamera::init and the world-load warm-up
+        Anchors,     // anchor resolution, the anchor cache, the shared resolve table
+        Presets,     // preset loader and background writer
+        Overlay,     // overlay thread (its own C++ allocations; ImGui's are malloc)
+        Workers,     // raster helpers, async collision worker, INI watcher
+        Logging,     // trace drain and benchmark report writers
+        RenderFrame, // render thread inside a detour frame
+        Count
+    };
+
+    inline constexpr std::size_t k_tag_count = static_cast<std::size_t>(AllocTag::Count);
+
+    /**
+     * @struct TagStats
+     * @brief Session totals of one tag.
+     */
+    struct TagStats
+    {
+        std::uint64_t allocs = 0;
+        std::uint64_t frees = 0;
+        std::uint64_t bytes_allocated = 0;
+        std::uint64_t bytes_freed = 0;
+    };
+
+    /**
+     * @struct Stats
+     * @brief Snapshot for the overlay and the log dump.
+     */
+    struct Stats
+    {
+        TagStats tag[k_tag_count] = {};
+        std::int64_t live_bytes = 0;  // allocated minus freed, all tags
+        std::int64_t live_blocks = 0; // allocations minus frees, all tags
+    };
+
+    [[nodiscard]] const char *tag_name(AllocTag tag) noexcept;
+
+#if TPVCAMERA_ALLOC_STATS
+    /** @brief Makes @p tag the calling thread's tag; returns the previous one. */
+    AllocTag set_thread_tag(AllocTag tag) noexcept;
+
+    /** @brief Counts one allocation of @p p (from malloc) against the calling thread's tag. Called by the shim. */
+    void note_alloc(void *p) noexcept;
+
+    /** @brief Counts the free of @p p (still allocated) against the calling thread's tag. Called by the shim. */
+    void note_free(void *p) noexcept;
+
+    [[nodiscard]] Stats stats() noexcept;
+
+    /** @brief Logs stats() at Info: the live total, then one line per tag. Any thread. */
+    void dump_to_log();
+#else
+    inline AllocTag set_thread_tag(AllocTag) noexcept
+    {
+        return AllocTag::Hooks;
+    }
+#endif
+
+    /**
+     * @class Scope
+     * @brief Tags the calling thread for the enclosing scope and restores the previous tag on exit.
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(AllocTag tag) noexcept : m_previous(set_thread_tag(tag)) {}
+        ~Scope() noexcept { set_thread_tag(m_previous); }
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        AllocTag m_previous;
+    };
+
+} // namespace TPVCamera::AllocStats
+
+#endif // TPVCAMERA_ALLOC_STATS_HPP
@@ -0,0 +1,229 @@
+/**
+ * @file anchor_cache.cpp
+ * @brief Build-keyed record of anchor sites and healed offsets, persisted next to the INI (see anchor_cache.hpp).
+ */
+
+#include "anchor_cache.hpp"
+#include "constants.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <windows.h>
+
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <system_error>
+
+namespace TPVCamera
+{
+
+    namespace
+    {
+        constexpr std::size_t k_anchor_count = static_cast<std::size_t>(AnchorId::Count);
+        constexpr std::uint32_t k_cache_magic = 0x41565054;  // "TPVA"
+        constexpr std::uint32_t k_cache_version = 1;
+
+        /**
+         * @brief The whole file, written and read as one POD block.
+         * @details A layout change must bump k_cache_version; a file of any other size or version is ignored.
+         */
+        struct CacheRecord
+        {
+            std::uint32_t magic = k_cache_magic;
+            std::uint32_t version = k_cache_version;
+            // Build key: a game patch changes at least the timestamp; the table hash catches a mod-side edit.
+            std::uint32_t time_date_stamp = 0;
+            std::uint32_t checksum = 0;
+            std::uint32_t size_of_image = 0;
+            std::uint32_t table_hash = 0;
+            std::uint32_t anchor_count = static_cast<std::uint32_t>(k_anchor_count);
+            std::uint32_t offset_count = static_cast<std::uint32_t>(k_runtime_offset_count);
+            std::array<std::uint8_t, k_anchor_count> has_site{};
+            std::array<CachedAnchorSite, k_anchor_count> sites{};
+            HealedOffsets offsets{};
+        };
+
+        std::mutex s_mutex;
+        CacheRecord s_record; // guarded by s_mutex
+        bool s_open = false;  // guarded by s_mutex; nothing is saved before open_anchor_cache
+        bool s_dirty = false; // guarded by s_mutex
+
+        [[nodiscard]] std::string cache_path()
+        {
+            return DMK::Filesystem::get_runtime_directory_utf8() + "\\" + Constants::get_anchor_cache_filename();
+        }
+
+        /// Build key from the in-memory PE header (the loader maps it readable at the image base).
+        [[nodiscard]] bool read_build_key(std::uintptr_t module_base, CacheRecord &out) noexcept
+        {
+            const auto *dos = reinterpret_cast<const IMAGE_DOS_HEADER *>(module_base);
+            if (dos->e_magic != IMAGE_DOS_SIGNATURE)
+            {
+                return false;
+            }
+            const auto *nt = reinterpret_cast<const IMAGE_NT_HEADERS64 *>(module_base + dos->e_lfanew);
+            if (nt->Signature != IMAGE_NT_SIGNATURE)
+            {
+                return false;
+            }
+            out.time_date_stamp = nt->FileHeader.TimeDateStamp;
+            out.checksum = nt->OptionalHeader.CheckSum;
+            out.size_of_image = nt->OptionalHeader.SizeOfImage;
+            return true;
+        }
+
+        /// Writes s_record through a sibling temp file and a rename, like PresetStore::save. Caller holds s_mutex.
+        void write_record_locked()
+        {
+            DMK::Logger &logger = DMK::Logger::get_instance();
+            const std::string path = cache_path();
+            const std::string temp_path = path + ".tmp";
+            {
+                std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+                if (!out)
+                {
+                    logger.debug("Anchor cache: cannot open {}", temp_path);
+                    return;
+                }
+                out.write(reinterpret_cast<const char *>(&s_record), sizeof(s_record));
+                out.flush();
+                if (!out)
+                {
+                    logger.debug("Anchor cache: write error on {}", temp_path);
+                    return;
+                }
+            }
+            std::error_code ec;
+            std::filesystem::rename(temp_path, path, ec);
+            if (ec)
+            {
+                logger.debug("Anchor cache: cannot replace {} ({})", path, ec.message());
+                std::filesystem::remove(temp_path, ec);
+                return;
+            }
+            s_dirty = false;
+            logger.debug("Anchor cache saved to {}", path);
+        }
+
+    } // namespace
+
+    void open_anchor_cache(std::uintptr_t module_base, std::uint32_t table_hash)
+    {
+        DMK::Logger &logger = DMK::Logger::get_instance();
+        std::lock_guard lock(s_mutex);
+
+        CacheRecord fresh;
+        fresh.table_hash = table_hash;
+        if (!read_build_key(module_base, fresh))
+        {
+            logger.warning("Anchor cache: unreadable PE header; startup cache disabled");
+            return;
+        }
+        s_record = fresh;
+        s_open = true;
+        s_dirty = false;
+
+        const std::string path = cache_path();
+        std::ifstream in(path, std::ios::binary);
+        if (!in)
+        {
+            logger.debug("Anchor cache: none at {}", path);
+            return;
+        }
+        CacheRecord loaded;
+        in.read(reinterpret_cast<char *>(&loaded), sizeof(loaded));
+        const bool complete = in.gcount() == static_cast<std::streamsize>(sizeof(loaded)) && in.peek() == EOF;
+        if (!complete || loaded.magic != k_cache_magic || loaded.version != k_cache_version ||
+            loaded.anchor_count != fresh.anchor_count || loaded.offset_count != fresh.offset_count)
+        {
+            logger.debug("Anchor cache: {} is from another mod version; ignoring it", path);
+            return;
+        }
+        if (loaded.time_date_stamp != fresh.time_date_stamp || loaded.checksum != fresh.checksum ||
+            loaded.size_of_image != fresh.size_of_image || loaded.table_hash != fresh.table_hash)
+        {
+            logger.info("Anchor cache: game or signature set changed since the last launch; rescanning");
+            return;
+        }
+        s_record = loaded;
+        logger.debug("Anchor cache: loaded {}", path);
+    }
+
+    std::optional<CachedAnchorSite> cached_anchor_site(AnchorId id)
+    {
+        const std::size_t index = static_cast<std::size_t>(id);
+        std::lock_guard lock(s_mutex);
+        if (!s_open || index >= k_anchor_count || s_record.has_site[index] == 0)
+        {
+            return std::nullopt;
+        }
+        return s_record.sites[index];
+    }
+
+    void store_anchor_site(AnchorId id, const std::optional<CachedAnchorSite> &site)
+    {
+        const std::size_t index = static_cast<std::size_t>(id);
+        std::lock_guard lock(s_mutex);
+        if (!s_open || index >= k_anchor_count)
+        {
+            return;
+        }
+        const std::uint8_t has = site ? 1 : 0;
+        const CachedAnchorSite value = site.value_or(CachedAnchorSite{});
+        if (s_record.has_site[index] != has || std::memcmp(&s_record.sites[index], &value, sizeof(value)) != 0)
+        {
+            s_record.has_site[index] = has;
+            s_record.sites[index] = value;
+            s_dirty = true;
+        }
+    }
+
+    std::optional<HealedOffsets> cached_healed_offsets()
+    {
+        std::lock_guard lock(s_mutex);
+        if (!s_open || s_record.offsets.groups == 0)
+        {
+            return std::nullopt;
+        }
+        return s_record.offsets;
+    }
+
+    void store_healed_offsets(const HealedOffsets &offsets) noexcept
+    {
+        try
+        {
+            std::lock_guard lock(s_mutex);
+            if (!s_open)
+            {
+                return;
+            }
+            s_record.offsets = offsets;
+            s_dirty = true;
+        }
+        catch (...)
+        {
+            // Best effort: a lost record only costs the next launch its heal shortcut.
+        }
+    }
+
+    void save_anchor_cache() noexcept
+    {
+        try
+        {
+            std::lock_guard lock(s_mutex);
+            if (s_open && s_dirty)
+            {
+                write_record_locked();
+            }
+        }
+        catch (...)
+        {
+            // Best effort, as above.
+        }
+    }
+
+} // namespace TPVCamera
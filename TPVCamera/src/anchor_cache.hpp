@@ -0,0 +1,67 @@
+/**
+ * @file anchor_cache.hpp
+ * @brief Per-game-build cache file of resolved anchor sites and healed offsets, for a scan-free startup.
+ *
+ * @details The first launch against a WHGame.dll build runs the full AOB cascade and the RTTI self-heals, then
+ *          records the outcome in <mod>_anchors.cache next to the INI: for every anchor the winning candidate and
+ *          its match / resolved RVAs, and the HealedOffsets of every heal group that latched. The file is keyed on
+ *          the module's PE TimeDateStamp, CheckSum and SizeOfImage plus a hash of the mod's own candidate tables,
+ *          so a game patch or a mod update that touches a signature discards it. A cache for the running build is
+ *          never trusted blindly: resolve_all_anchors re-checks each cached site with a byte-compare against its
+ *          candidate pattern and re-scans only the anchors that fail.
+ *
+ *          Plain file IO under one internal mutex. Written from the init thread (anchors) and, on the rare session
+ *          that heals something new, from the shutdown path: the render thread only updates the in-memory record
+ *          (store_healed_offsets), never the file. Either write is a few hundred bytes.
+ */
+#ifndef TPVCAMERA_ANCHOR_CACHE_HPP
+#define TPVCAMERA_ANCHOR_CACHE_HPP
+
+#include "aob_resolver.hpp"
+#include "offset_heal.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace TPVCamera
+{
+
+    /**
+     * @struct CachedAnchorSite
+     * @brief Where one anchor resolved: the cascade candidate that won and its image-relative addresses.
+     */
+    struct CachedAnchorSite
+    {
+        std::uint32_t candidate = 0; // index into the anchor's cascade
+        std::uint32_t match_rva = 0; // where the candidate's pattern matched
+        std::uint32_t value_rva = 0; // the resolved address (function entry or data slot)
+    };
+
+    /**
+     * @brief Loads the cache file if it was written for this exact module image and candidate-table hash.
+     * @details Reads the PE header at @p module_base for the build key. A missing, foreign or corrupt file just
+     *          starts an empty record. Call once at init, before resolve_all_anchors.
+     * @param module_base WHGame.dll base address.
+     * @param table_hash Hash of every anchor candidate (see resolve_all_anchors); any edit invalidates the file.
+     */
+    void open_anchor_cache(std::uintptr_t module_base, std::uint32_t table_hash);
+
+    /** @brief The cached site of @p id, if the loaded record has one. */
+    [[nodiscard]] std::optional<CachedAnchorSite> cached_anchor_site(AnchorId id);
+
+    /** @brief Records (or with nullopt, forgets) the site of @p id; persisted by the next save_anchor_cache(). */
+    void store_anchor_site(AnchorId id, const std::optional<CachedAnchorSite> &site);
+
+    /** @brief The cached HealedOffsets, if the loaded record has any latched group. */
+    [[nodiscard]] std::optional<HealedOffsets> cached_healed_offsets();
+
+    /** @brief Replaces the recorded offsets; persisted by the next save_anchor_cache() (no file IO here). */
+    void store_healed_offsets(const HealedOffsets &offsets) noexcept;
+
+    /** @brief Writes the record if anything changed since it was loaded or last saved. */
+    void save_anchor_cache() noexcept;
+
+} // namespace TPVCamera
+
+#endif // TPVCAMERA_ANCHOR_CACHE_HPP
@@ -3,20 +3,39 @@
  * @brief Declarative anchor table, one-pass resolution, and the resolved-address store.
  *
  * The cascade candidate tables in aob_resolver.hpp are wrapped one-to-one as RipGlobal entries in a
- * DetourModKit anchor registry. resolve_all_anchors() resolves the whole table in a single parallel
- * pass at startup and records each address; anchor_address() hands the resolved address (or 0 on a
- * cascade miss) to the call sites.
+ * DetourModKit anchor registry. resolve_all_anchors() resolves the core anchors and those of every enabled
+ * feature in a single parallel pass at startup and records each address; anchor_address() hands the resolved
+ * address (or 0 on a cascade miss) to the call sites. The anchors of a feature the INI leaves off are resolved by
+ * resolve_anchor_feature() once a reload enables it. A site cached by an earlier launch of the same game build
+ * (see anchor_cache.hpp) is re-checked by a byte-compare and, when it still matches, taken without scanning;
+ * everything else is found by one MultiScan pass over the code sections, with the DMK cascade as the fallback for
+ * what that pass cannot place. When TPVToggle (or an earlier load of this mod) already published a unique match
+ * for a candidate in the process's shared table (shared_resolve.hpp), that match is byte-checked and taken before
+ * the scan, and every site this mod settles on is published there in turn.
  */
 
 #include "aob_resolver.hpp"
+#include "alloc_stats.hpp"
+#include "anchor_cache.hpp"
+#include "multi_scan.hpp"
+#include "shared_resolve.hpp"
 
 #include <DetourModKit.hpp>
 
+#include <windows.h>
+
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <optional>
 #include <span>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 namespace TPVCamera
 {
@@ -58,47 +77,541 @@ namespace TPVCamera
             rip_global("GetObjectsInBox", Aob::k_getObjectsInBoxCandidates),
         }};
 
-        // Resolved absolute addresses, indexed by AnchorId; 0 means unresolved. Zero-initialized (constant
-        // init, no static-init-order hazard). Written once by resolve_all_anchors() on the init thread before
-        // any consumer reads, then read-only, so no synchronization is required.
-        std::array<std::uintptr_t, k_anchor_count> s_resolved_addresses{};
+        constexpr std::size_t k_feature_count = static_cast<std::size_t>(AnchorFeature::Count);
+
+        // The feature each anchor is resolved for, indexed by AnchorId. PlayerOnActionDispatch stays Core: its
+        // consumer (orbit move-detection) is engaged by presets and hotkeys at runtime, not by an INI switch.
+        constexpr std::array<AnchorFeature, k_anchor_count> k_anchor_features = {{
+            AnchorFeature::Core,               // Context
+            AnchorFeature::Core,               // Genv
+            AnchorFeature::Core,               // Frustum
+            AnchorFeature::Core,               // HeadVisibility
+            AnchorFeature::Core,               // InputDispatch
+            AnchorFeature::Core,               // ActionDispatch
+            AnchorFeature::Core,               // RayWorldIntersection
+            AnchorFeature::InteractFromCamera, // InteractionRayBuild
+            AnchorFeature::InteractFromCamera, // InteractorLookRay
+            AnchorFeature::InteractFromCamera, // InteractionOnScreen
+            AnchorFeature::Core,               // OverlayHide
+            AnchorFeature::Core,               // OverlayShow
+            AnchorFeature::Core,               // MenuOpen
+            AnchorFeature::Core,               // MenuClose
+            AnchorFeature::RenderOctree,       // GetObjectsInBox
+        }};
+
+        constexpr std::array<std::string_view, k_feature_count> k_feature_names = {"core", "render octree",
+                                                                                  "interact from camera"};
+
+        // Resolved absolute addresses, indexed by AnchorId; 0 means unresolved. Zero-initialized (constant init,
+        // no static-init-order hazard). The core set is written on the init thread before any consumer reads; an
+        // optional feature's set may be written later by the reload thread, so each slot is published with
+        // release and read with acquire (a plain load on x64).
+        std::array<std::atomic<std::uintptr_t>, k_anchor_count> s_resolved_addresses{};
+
+        // Serializes the resolves (the init pass and a reload's feature pass) and guards what they share.
+        std::mutex s_resolve_mutex;
+        std::uintptr_t s_module_base = 0;                    // guarded by s_resolve_mutex; 0 until the init pass
+        std::size_t s_module_size = 0;                       // guarded by s_resolve_mutex
+        bool s_cache_opened = false;                         // guarded by s_resolve_mutex
+        std::array<bool, k_feature_count> s_feature_done{};  // guarded by s_resolve_mutex; resolve attempted
+
+        [[nodiscard]] std::uintptr_t resolved(std::size_t index) noexcept
+        {
+            return s_resolved_addresses[index].load(std::memory_order_acquire);
+        }
+
+        void set_resolved(std::size_t index, std::uintptr_t value) noexcept
+        {
+            s_resolved_addresses[index].store(value, std::memory_order_release);
+        }
+
+        /// FNV-1a over every label and candidate, so any signature edit (or reorder) invalidates the anchor cache.
+        [[nodiscard]] std::uint32_t candidate_table_hash() noexcept
+        {
+            std::uint32_t h = 0x811C9DC5u;
+            const auto mix_bytes = [&h](const void *data, std::size_t size)
+            {
+                const auto *bytes = static_cast<const std::uint8_t *>(data);
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    h = (h ^ bytes[i]) * 0x01000193u;
+                }
+            };
+            const auto mix_text = [&mix_bytes](std::string_view text)
+            {
+                mix_bytes(text.data(), text.size());
+                mix_bytes("", 1); // terminator, so "ab"+"c" differs from "a"+"bc"
+            };
+            for (const Anchor &anchor : k_anchor_table)
+            {
+                mix_text(anchor.label);
+                for (const AddrCandidate &c : anchor.site)
+                {
+                    mix_text(c.pattern);
+                    const std::int64_t shape[] = {static_cast<std::int64_t>(c.mode),
+                                                  static_cast<std::int64_t>(c.disp_offset),
+                                                  static_cast<std::int64_t>(c.instr_end_offset)};
+                    mix_bytes(shape, sizeof(shape));
+                }
+            }
+            return h;
+        }
+
+        /**
+         * @brief The image's executable sections, the only place a code-pattern candidate can match.
+         * @details Read from the in-memory section table. Committed and readable for the life of the process, so
+         *          the byte-compares below read them directly with no fault guard.
+         */
+        struct CodeRanges
+        {
+            std::array<std::pair<std::uintptr_t, std::uintptr_t>, 8> range{};
+            std::size_t count = 0;
+
+            [[nodiscard]] std::span<const std::pair<std::uintptr_t, std::uintptr_t>> spans() const noexcept
+            {
+                return {range.data(), count};
+            }
+
+            [[nodiscard]] bool contains(std::uintptr_t lo, std::size_t size) const noexcept
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    if (lo >= range[i].first && lo < range[i].second && size <= range[i].second - lo)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+        };
+
+        [[nodiscard]] CodeRanges code_ranges(std::uintptr_t module_base) noexcept
+        {
+            CodeRanges out;
+            const auto *dos = reinterpret_cast<const IMAGE_DOS_HEADER *>(module_base);
+            const auto *nt = reinterpret_cast<const IMAGE_NT_HEADERS64 *>(module_base + dos->e_lfanew);
+            const IMAGE_SECTION_HEADER *section = IMAGE_FIRST_SECTION(nt);
+            for (WORD i = 0; i < nt->FileHeader.NumberOfSections && out.count < out.range.size(); ++i, ++section)
+            {
+                if ((section->Characteristics & IMAGE_SCN_MEM_EXECUTE) != 0)
+                {
+                    const std::uintptr_t lo = module_base + section->VirtualAddress;
+                    out.range[out.count++] = {lo, lo + section->Misc.VirtualSize};
+                }
+            }
+            return out;
+        }
+
+        /// The address a candidate resolves to from a match, or 0 for a mode the cache does not model.
+        [[nodiscard]] std::uintptr_t resolve_from_match(const AddrCandidate &c, std::uintptr_t match) noexcept
+        {
+            switch (c.mode)
+            {
+            case ResolveMode::Direct:
+                return match + static_cast<std::ptrdiff_t>(c.disp_offset);
+            case ResolveMode::RipRelative:
+            {
+                std::int32_t rel = 0;
+                std::memcpy(&rel, reinterpret_cast<const void *>(match + static_cast<std::ptrdiff_t>(c.disp_offset)),
+                            sizeof(rel));
+                return match + static_cast<std::ptrdiff_t>(c.instr_end_offset) + rel;
+            }
+            default:
+                return 0;
+            }
+        }
+
+        /**
+         * @brief Re-checks a cached site against the live image: the pattern still matches at the cached RVA and
+         *        still resolves to the cached address.
+         */
+        [[nodiscard]] std::uintptr_t validate_site(std::span<const AddrCandidate> cascade, const CachedAnchorSite &site,
+                                                   std::uintptr_t module_base, const CodeRanges &code) noexcept
+        {
+            if (site.candidate >= cascade.size())
+            {
+                return 0;
+            }
+            const AddrCandidate &c = cascade[site.candidate];
+            std::array<MultiScan::PatternByte, MultiScan::k_max_pattern> pattern{};
+            const std::size_t n = MultiScan::parse_pattern(c.pattern, pattern);
+            const std::uintptr_t match = module_base + site.match_rva;
+            if (n == 0 || !code.contains(match, n) || !MultiScan::matches_at(pattern.data(), n, match))
+            {
+                return 0;
+            }
+            const std::uintptr_t value = resolve_from_match(c, match);
+            return (value != 0 && value == module_base + site.value_rva) ? value : 0;
+        }
+
+        /**
+         * @brief Finds which candidate produced an address the DMK fallback resolved, and where it matched.
+         * @details A Direct match sits at a fixed distance from its result, so it is one compare per candidate. A
+         *          RIP-relative match has to be searched for (its result is a data slot), which is one MultiScan
+         *          pass for that pattern -- paid only on the rare launch where the unified scan missed an anchor.
+         */
+        [[nodiscard]] std::optional<CachedAnchorSite> locate_site(std::span<const AddrCandidate> cascade,
+                                                                  std::uintptr_t value, std::uintptr_t module_base,
+                                                                  const CodeRanges &code)
+        {
+            const auto site_of = [&](std::size_t index, std::uintptr_t match) -> CachedAnchorSite
+            {
+                return {static_cast<std::uint32_t>(index), static_cast<std::uint32_t>(match - module_base),
+                        static_cast<std::uint32_t>(value - module_base)};
+            };
+            for (std::size_t ci = 0; ci < cascade.size(); ++ci)
+            {
+                const AddrCandidate &c = cascade[ci];
+                if (c.mode == ResolveMode::Direct)
+                {
+                    std::array<MultiScan::PatternByte, MultiScan::k_max_pattern> pattern{};
+                    const std::size_t n = MultiScan::parse_pattern(c.pattern, pattern);
+                    const std::uintptr_t match = value - static_cast<std::ptrdiff_t>(c.disp_offset);
+                    if (n != 0 && code.contains(match, n) && MultiScan::matches_at(pattern.data(), n, match))
+                    {
+                        return site_of(ci, match);
+                    }
+                }
+                else if (c.mode == ResolveMode::RipRelative)
+                {
+                    const std::string_view text[] = {c.pattern};
+                    MultiScan::Hits hits[1];
+                    MultiScan::scan(text, code.spans(), hits);
+                    if (hits[0].count == 1 && resolve_from_match(c, hits[0].first) == value)
+                    {
+                        return site_of(ci, hits[0].first);
+                    }
+                }
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Resolves an anchor from a unique match published in the shared table.
+         * @details Same rule as the unified scan: the first candidate, in cascade order, whose published match still
+         *          byte-matches inside the code sections and resolves inside the image wins.
+         */
+        [[nodiscard]] std::optional<CachedAnchorSite> shared_site(std::span<const AddrCandidate> cascade,
+                                                                  std::uintptr_t module_base, std::size_t module_size,
+                                                                  const CodeRanges &code) noexcept
+        {
+            for (std::size_t ci = 0; ci < cascade.size(); ++ci)
+            {
+                const AddrCandidate &c = cascade[ci];
+                const auto match = SharedResolve::find_pattern(c.pattern, true);
+                if (!match)
+                {
+                    continue;
+                }
+                std::array<MultiScan::PatternByte, MultiScan::k_max_pattern> pattern{};
+                const std::size_t n = MultiScan::parse_pattern(c.pattern, pattern);
+                if (n == 0 || !code.contains(*match, n) || !MultiScan::matches_at(pattern.data(), n, *match))
+                {
+                    continue;
+                }
+                const std::uintptr_t value = resolve_from_match(c, *match);
+                if (value < module_base || value - module_base >= module_size)
+                {
+                    continue;
+                }
+                return CachedAnchorSite{static_cast<std::uint32_t>(ci),
+                                        static_cast<std::uint32_t>(*match - module_base),
+                                        static_cast<std::uint32_t>(value - module_base)};
+            }
+            return std::nullopt;
+        }
+
+        /// Publishes the recorded site of each resolved anchor in @p ids to the shared table, for the other TPV mod.
+        void publish_shared_sites(std::span<const std::size_t> ids, std::uintptr_t module_base) noexcept
+        {
+            for (const std::size_t i : ids)
+            {
+                const auto site = cached_anchor_site(static_cast<AnchorId>(i));
+                const std::span<const AddrCandidate> cascade = k_anchor_table[i].site;
+                if (site && resolved(i) != 0 && site->candidate < cascade.size())
+                {
+                    SharedResolve::publish_pattern(cascade[site->candidate].pattern, module_base + site->match_rva,
+                                                   true);
+                }
+            }
+        }
+
+        /**
+         * @brief Resolves the @p pending anchors through one MultiScan pass over the code sections.
+         * @details Applies the DMK cascade rule per anchor: the first candidate, in order, that matched exactly
+         *          once wins (an ambiguous candidate is skipped, as with require_unique), and its result must land
+         *          inside the image. Resolved anchors are stored and recorded in the anchor cache; the rest stay in
+         *          @p pending for the DMK fallback.
+         * @return Number of anchors resolved here.
+         */
+        std::size_t resolve_unified(std::vector<std::size_t> &pending, std::uintptr_t module_base,
+                                    std::size_t module_size, const CodeRanges &code)
+        {
+            DMK::Logger &logger = DMK::Logger::get_instance();
+
+            // Flatten every pending candidate into one pattern list; first_pattern[j] is where anchor pending[j]'s
+            // cascade starts in it.
+            std::vector<std::string_view> patterns;
+            std::vector<std::size_t> first_pattern;
+            first_pattern.reserve(pending.size());
+            for (const std::size_t i : pending)
+            {
+                first_pattern.push_back(patterns.size());
+                for (const AddrCandidate &c : k_anchor_table[i].site)
+                {
+                    patterns.push_back(c.pattern);
+                }
+            }
+            std::vector<MultiScan::Hits> hits(patterns.size());
+            MultiScan::scan(patterns, code.spans(), hits);
+
+            std::size_t resolved_count = 0;
+            std::vector<std::size_t> unresolved;
+            for (std::size_t j = 0; j < pending.size(); ++j)
+            {
+                const std::size_t i = pending[j];
+                const std::span<const AddrCandidate> cascade = k_anchor_table[i].site;
+                std::uintptr_t value = 0;
+                for (std::size_t ci = 0; ci < cascade.size() && value == 0; ++ci)
+                {
+                    const MultiScan::Hits &h = hits[first_pattern[j] + ci];
+                    if (h.count != 1)
+                    {
+                        continue; // a miss or ambiguous: fall through to the next candidate
+                    }
+                    const std::uintptr_t v = resolve_from_match(cascade[ci], h.first);
+                    if (v < module_base || v - module_base >= module_size)
+                    {
+                        continue;
+                    }
+                    value = v;
+                    store_anchor_site(static_cast<AnchorId>(i),
+                                      CachedAnchorSite{static_cast<std::uint32_t>(ci),
+                                                       static_cast<std::uint32_t>(h.first - module_base),
+                                                       static_cast<std::uint32_t>(v - module_base)});
+                }
+                if (value == 0)
+                {
+                    unresolved.push_back(i);
+                    continue;
+                }
+                set_resolved(i, value);
+                ++resolved_count;
+                logger.debug("Anchor {} -> {}", k_anchor_table[i].label, DMK::Format::format_address(value));
+            }
+            pending = std::move(unresolved);
+            return resolved_count;
+        }
+
+        /**
+         * @brief Resolves the anchors @p ids (the body of resolve_all_anchors / resolve_anchor_feature).
+         * @details Cache, then shared table, then one unified scan, then the DMK cascade; logs one summary line
+         *          tagged @p scope. Caller holds s_resolve_mutex and has opened the anchor cache.
+         */
+        void resolve_anchor_set(std::span<const std::size_t> ids, std::uintptr_t module_base,
+                                std::size_t module_size, std::string_view scope)
+        {
+            const AllocStats::Scope alloc_tag(AllocStats::AllocTag::Anchors);
+            DMK::Logger &logger = DMK::Logger::get_instance();
+
+            // Confine resolution to the WHGame.dll image. The DMK default host_module_range() is the host EXE,
+            // not WHGame.dll, so the range is passed explicitly.
+            const DMK::Memory::ModuleRange range{module_base, module_base + module_size};
+            const CodeRanges code = code_ranges(module_base);
+
+            // Anchors whose cached site for this exact build still byte-matches skip the scan; the rest (all of them
+            // on a first launch or after a patch) go through the full cascade below.
+            std::vector<std::size_t> pending;
+            pending.reserve(ids.size());
+            std::size_t cached_count = 0;
+            std::size_t shared_count = 0;
+            for (const std::size_t i : ids)
+            {
+                const auto site = cached_anchor_site(static_cast<AnchorId>(i));
+                const std::uintptr_t value =
+                    site ? validate_site(k_anchor_table[i].site, *site, module_base, code) : std::uintptr_t{0};
+                if (value != 0)
+                {
+                    set_resolved(i, value);
+                    ++cached_count;
+                    logger.debug("Anchor {} -> {} (cached)", k_anchor_table[i].label,
+                                 DMK::Format::format_address(value));
+                    continue;
+                }
+                if (const auto shared = shared_site(k_anchor_table[i].site, module_base, module_size, code))
+                {
+                    set_resolved(i, module_base + shared->value_rva);
+                    store_anchor_site(static_cast<AnchorId>(i), shared);
+                    ++shared_count;
+                    logger.debug("Anchor {} -> {} (shared)", k_anchor_table[i].label,
+                                 DMK::Format::format_address(resolved(i)));
+                    continue;
+                }
+                pending.push_back(i);
+            }
+
+            if (pending.empty())
+            {
+                if (shared_count > 0)
+                {
+                    save_anchor_cache();
+                }
+                publish_shared_sites(ids, module_base);
+                logger.info("Anchor resolution ({}): {}/{} resolved from the startup cache ({} shared)", scope,
+                            cached_count + shared_count, ids.size(), shared_count);
+                return;
+            }
+
+            // Every remaining candidate in one pass over the code sections, however many anchors are left.
+            const std::size_t unified_count = resolve_unified(pending, module_base, module_size, code);
+
+            // Whatever the unified scan could not place goes through the DMK cascade as before, so its status report
+            // and any resolution rule the unified scan does not model still apply.
+            std::vector<Anchor> fallback;
+            fallback.reserve(pending.size());
+            for (const std::size_t i : pending)
+            {
+                fallback.push_back(k_anchor_table[i]);
+            }
+            std::vector<DMK::Anchors::ResolvedAnchor> report(fallback.size());
+            const std::size_t resolved_count =
+                fallback.empty() ? 0
+                                 : DMK::Anchors::resolve_all_parallel(std::span<const Anchor>(fallback),
+                                                                      std::span<DMK::Anchors::ResolvedAnchor>(report),
+                                                                      range);
+
+            // resolve_all_parallel writes report[j] for fallback[j], so pending[j] is the AnchorId.
+            for (std::size_t j = 0; j < resolved_count; ++j)
+            {
+                const std::size_t i = pending[j];
+                const DMK::Anchors::ResolvedAnchor &entry = report[j];
+                if (entry.status == DMK::Anchors::AnchorStatus::Resolved)
+                {
+                    set_resolved(i, static_cast<std::uintptr_t>(entry.value));
+                    // Per-anchor address is for RE / external tooling, not routine status, so keep it at Debug; the
+                    // one-line quality summary below is the default-level health check, and a failure still warns.
+                    logger.debug("Anchor {} -> {}", entry.label, DMK::Format::format_address(resolved(i)));
+                    store_anchor_site(static_cast<AnchorId>(i),
+                                      locate_site(k_anchor_table[i].site, resolved(i), module_base, code));
+                }
+                else
+                {
+                    set_resolved(i, 0);
+                    store_anchor_site(static_cast<AnchorId>(i), std::nullopt);
+                    logger.warning("Anchor {} unresolved ({})", entry.label,
+                                   DMK::Anchors::anchor_status_to_string(entry.status));
+                }
+            }
+            save_anchor_cache();
+            publish_shared_sites(ids, module_base);
+
+            const DMK::Anchors::AnchorQuality quality = DMK::Anchors::assess_quality(
+                std::span<const DMK::Anchors::ResolvedAnchor>(report.data(), resolved_count));
+            logger.info("Anchor resolution ({}): {}/{} resolved ({} cached, {} shared, {} by the unified scan), {} "
+                        "failed, {} unsupported",
+                        scope, cached_count + shared_count + unified_count + quality.resolved, ids.size(),
+                        cached_count, shared_count, unified_count, quality.failed, quality.unsupported);
+        }
+
+        /// AnchorId indices of every anchor whose feature's bit is set in @p feature_mask.
+        [[nodiscard]] std::vector<std::size_t> anchors_of(std::uint32_t feature_mask)
+        {
+            std::vector<std::size_t> ids;
+            for (std::size_t i = 0; i < k_anchor_count; ++i)
+            {
+                if ((feature_mask & anchor_feature_bit(k_anchor_features[i])) != 0)
+                {
+                    ids.push_back(i);
+                }
+            }
+            return ids;
+        }
 
     } // namespace
 
-    void resolve_all_anchors(std::uintptr_t module_base, std::size_t module_size)
+    AnchorFeature anchor_feature(AnchorId id) noexcept
     {
-        DMK::Logger &logger = DMK::Logger::get_instance();
+        const std::size_t index = static_cast<std::size_t>(id);
+        return index < k_anchor_count ? k_anchor_features[index] : AnchorFeature::Core;
+    }
 
-        // Confine resolution to the WHGame.dll image. The DMK default host_module_range() is the host EXE,
-        // not WHGame.dll, so the range is passed explicitly.
-        const DMK::Memory::ModuleRange range{module_base, module_base + module_size};
+    void resolve_all_anchors(std::uintptr_t module_base, std::size_t module_size, std::uint32_t feature_mask)
+    {
+        const std::lock_guard lock(s_resolve_mutex);
+        s_module_base = module_base;
+        s_module_size = module_size;
+        feature_mask |= anchor_feature_bit(AnchorFeature::Core);
 
-        std::array<DMK::Anchors::ResolvedAnchor, k_anchor_count> report{};
-        const std::size_t resolved_count = DMK::Anchors::resolve_all_parallel(k_anchor_table, report, range);
+        open_anchor_cache(module_base, candidate_table_hash());
+        SharedResolve::open(module_base);
+        s_cache_opened = true;
+        const std::vector<std::size_t> ids = anchors_of(feature_mask);
+        resolve_anchor_set(ids, module_base, module_size, "startup");
+        for (std::size_t f = 0; f < k_feature_count; ++f)
+        {
+            s_feature_done[f] = (feature_mask & anchor_feature_bit(static_cast<AnchorFeature>(f))) != 0;
+        }
+        if (ids.size() < k_anchor_count)
+        {
+            DMK::Logger::get_instance().info("Anchor resolution: {} anchor(s) of disabled features deferred",
+                                             k_anchor_count - ids.size());
+        }
+    }
 
-        // resolve_all_parallel writes report[i] for k_anchor_table[i], so the report index is the AnchorId.
-        for (std::size_t i = 0; i < resolved_count; ++i)
+    bool resolve_anchor_feature(AnchorFeature feature)
+    {
+        const std::size_t f = static_cast<std::size_t>(feature);
+        if (f >= k_feature_count)
         {
-            const DMK::Anchors::ResolvedAnchor &entry = report[i];
-            if (entry.status == DMK::Anchors::AnchorStatus::Resolved)
+            return false;
+        }
+        const std::lock_guard lock(s_resolve_mutex);
+        if (s_module_base == 0)
+        {
+            return false;
+        }
+        const std::vector<std::size_t> ids = anchors_of(anchor_feature_bit(feature));
+        if (!s_feature_done[f])
+        {
+            s_feature_done[f] = true;
+            // A dev handoff skips the init resolve, so the cache is first opened here; the feature's sites are
+            // then cached as on a normal launch.
+            if (!s_cache_opened)
             {
-                s_resolved_addresses[i] = static_cast<std::uintptr_t>(entry.value);
-                // Per-anchor address is for RE / external tooling, not routine status, so keep it at Debug; the
-                // one-line quality summary below is the default-level health check, and a failure still warns.
-                logger.debug("Anchor {} -> {}", entry.label, DMK::Format::format_address(s_resolved_addresses[i]));
+                open_anchor_cache(s_module_base, candidate_table_hash());
+                SharedResolve::open(s_module_base);
+                s_cache_opened = true;
             }
-            else
+            resolve_anchor_set(ids, s_module_base, s_module_size, k_feature_names[f]);
+        }
+        return std::all_of(ids.begin(), ids.end(), [](std::size_t i) { return resolved(i) != 0; });
+    }
+
+    std::uint32_t anchor_table_hash() noexcept
+    {
+        return candidate_table_hash();
+    }
+
+    void adopt_anchor_addresses(const std::uintptr_t *addresses, std::size_t count, std::uintptr_t module_base,
+                                std::size_t module_size)
+    {
+        if (addresses == nullptr || count != k_anchor_count)
+        {
+            return;
+        }
+        const std::lock_guard lock(s_resolve_mutex);
+        s_module_base = module_base;
+        s_module_size = module_size;
+        s_feature_done.fill(false);
+        s_feature_done[static_cast<std::size_t>(AnchorFeature::Core)] = true;
+        for (std::size_t i = 0; i < k_anchor_count; ++i)
+        {
+            set_resolved(i, addresses[i]);
+            if (addresses[i] != 0)
             {
-                s_resolved_addresses[i] = 0;
-                logger.warning("Anchor {} unresolved ({})", entry.label,
-                               DMK::Anchors::anchor_status_to_string(entry.status));
+                s_feature_done[static_cast<std::size_t>(k_anchor_features[i])] = true;
             }
         }
-
-        const DMK::Anchors::AnchorQuality quality =
-            DMK::Anchors::assess_quality(std::span<const DMK::Anchors::ResolvedAnchor>(report.data(), resolved_count));
-        logger.info("Anchor resolution: {}/{} resolved, {} failed, {} unsupported", quality.resolved, quality.total,
-                    quality.failed, quality.unsupported);
     }
 
     std::uintptr_t anchor_address(AnchorId id) noexcept
@@ -108,7 +621,7 @@ namespace TPVCamera
         {
             return 0;
         }
-        return s_resolved_addresses[index];
+        return resolved(index);
     }
 
 } // namespace TPVCamera
@@ -16,8 +16,10 @@
  * shadow the correct in-module match, disabling the feature or hooking an
  * unrelated site. The cascade tables are wrapped one-to-one as RipGlobal entries
  * in a declarative DMK::Anchors registry (AnchorId below); resolve_all_anchors()
- * resolves the whole table in one parallel pass at startup and anchor_address()
- * returns each resolved address (or 0 on a cascade miss) to the call sites.
+ * resolves the core anchors and those of every enabled feature (AnchorFeature) in
+ * one parallel pass at startup, resolve_anchor_feature() the rest on demand, and
+ * anchor_address() returns each resolved address (or 0 on a cascade miss) to the
+ * call sites.
  *
  * Candidate ordering is most-specific first (P1), so a tight anchor wins before
  * a looser fallback. Each cascade carries at least one candidate anchored PAST
@@ -384,7 +386,30 @@ namespace TPVCamera
     };
 
     /**
-     * @brief Resolves every game-image anchor in one parallel pass and records the results.
+     * @brief The subsystem an anchor serves, so a subsystem the INI leaves off never pays for its scan.
+     * @details Core anchors resolve at startup whatever the INI says. The others resolve with them only when their
+     *          feature is enabled at startup; otherwise on the first resolve_anchor_feature() for it, which the INI
+     *          reload issues (on the reload thread) when a setting switches the feature on.
+     */
+    enum class AnchorFeature : std::uint8_t
+    {
+        Core,               // camera, view / menu / overlay gates, physics ray, OnAction
+        RenderOctree,       // GetObjectsInBox: UseRenderOcclusion, and UseCoverageCollision's visible-brush raster
+        InteractFromCamera, // the interaction ray-build / look-ray / on-screen gate detours
+        Count,
+    };
+
+    /** @brief Bit of @p feature in the mask resolve_all_anchors() takes (Core is always resolved). */
+    [[nodiscard]] constexpr std::uint32_t anchor_feature_bit(AnchorFeature feature) noexcept
+    {
+        return 1u << static_cast<std::uint32_t>(feature);
+    }
+
+    /** @brief The feature @p id is resolved for (AnchorFeature::Core for an out-of-range id). */
+    [[nodiscard]] AnchorFeature anchor_feature(AnchorId id) noexcept;
+
+    /**
+     * @brief Resolves the core anchors, plus those of the features in @p feature_mask, in one pass and records them.
      * @details Builds the declarative DMK::Anchors table over the cascade candidate arrays above (each a
      *          RipGlobal anchor whose candidates already select Direct vs RIP-relative resolution) and
      *          resolves it with Anchors::resolve_all_parallel, confined to the WHGame.dll image
@@ -392,16 +417,47 @@ namespace TPVCamera
      *          host_module_range() is the host EXE, not WHGame.dll. Each resolved address is stored for
      *          anchor_address(); a per-anchor status line plus an assess_quality() summary are logged. A
      *          best-effort anchor that misses records 0 and its consumer degrades; the mandatory anchors
-     *          (Context, Frustum) are reported so the caller can fail init when anchor_address() is 0.
+     *          (Context, Frustum) are reported so the caller can fail init when anchor_address() is 0. Before
+     *          scanning, the anchor cache for this game build is opened (see anchor_cache.hpp): every anchor
+     *          whose cached site still byte-matches its candidate is taken as-is. The rest are found by ONE
+     *          MultiScan pass over the image's code sections covering every remaining candidate (see
+     *          multi_scan.hpp), with the same first-unique-candidate-wins rule; only an anchor that pass cannot
+     *          place goes through resolve_all_parallel. The new sites are then written back to the cache. The
+     *          anchors of a feature outside @p feature_mask are left at 0 (and their cached sites untouched) until
+     *          resolve_anchor_feature() asks for them.
+     * @param feature_mask anchor_feature_bit() of every optional feature the live settings enable.
      * @note Setup/control-plane only: allocates and spawns a transient worker pool. Call once at init.
      */
-    void resolve_all_anchors(std::uintptr_t module_base, std::size_t module_size);
+    void resolve_all_anchors(std::uintptr_t module_base, std::size_t module_size, std::uint32_t feature_mask);
+
+    /**
+     * @brief Resolves the anchors of @p feature if no earlier call (or resolve_all_anchors) already has.
+     * @details Same cache / shared table / unified scan / DMK cascade as resolve_all_anchors, over that feature's
+     *          anchors only; a repeated call is a mutex and a flag. Any thread, but it scans the image on a first
+     *          call, so the INI reload calls it from its own thread, never the render thread.
+     * @return True when every anchor of @p feature resolved; false on a miss or before resolve_all_anchors ran.
+     */
+    bool resolve_anchor_feature(AnchorFeature feature);
 
     /**
      * @brief Returns the resolved absolute address for an anchor, or 0 if it did not resolve.
-     * @note Valid only after resolve_all_anchors() has run; returns 0 before then or on a cascade miss.
+     * @note Valid only after resolve_all_anchors() has run; returns 0 before then, on a cascade miss, or while the
+     *       anchor's feature has not been resolved. Any thread.
      */
     [[nodiscard]] std::uintptr_t anchor_address(AnchorId id) noexcept;
+
+    /** @brief Hash of every anchor label and candidate (the anchor cache key); any signature edit changes it. */
+    [[nodiscard]] std::uint32_t anchor_table_hash() noexcept;
+
+    /**
+     * @brief Installs addresses resolved earlier in this process for this same image, in place of
+     *        resolve_all_anchors (the dev hot reload's state handoff, see dev/state_handoff.hpp).
+     * @param addresses One address per AnchorId, in enumerator order; the call is ignored unless the count matches.
+     *        A feature the outgoing DLL never resolved (every address 0) is left for resolve_anchor_feature().
+     * @note Init only, like resolve_all_anchors.
+     */
+    void adopt_anchor_addresses(const std::uintptr_t *addresses, std::size_t count, std::uintptr_t module_base,
+                                std::size_t module_size);
 } // namespace TPVCamera
 
 #endif // TPVCAMERA_AOB_RESOLVER_HPP
@@ -0,0 +1,473 @@
+/**
+ * @file benchmark.cpp
+ * @brief Scripted orbit / zoom sweep, per-frame stage sampling and the CSV / JSON report (see benchmark.hpp).
+ */
+
+#include "benchmark.hpp"
+#include "alloc_stats.hpp"
+#include "frame_profiler.hpp"
+#include "global_state.hpp"
+#include "health.hpp"
+#include "overlay/overlay.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <windows.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace TPVCamera::Benchmark
+{
+
+    namespace
+    {
+        constexpr float k_pass_seconds = k_settle_seconds + static_cast<float>(k_stops) * k_stop_seconds;
+        constexpr float k_total_seconds = static_cast<float>(k_passes) * k_pass_seconds;
+        // Sample storage is reserved when the run starts and never grows on the render thread: about two
+        // minutes of sampled frames at 500 fps, past which frames are dropped (and counted).
+        constexpr std::size_t k_max_samples = 1u << 16;
+        // Report metric 0 is the frame time; metric 1 + s is profiler stage s.
+        constexpr std::size_t k_metrics = 1 + Profiler::k_stage_count;
+
+        struct Sample
+        {
+            std::uint8_t pass;
+            float value[k_metrics]; // frame ms, then stage us (-1 = stage not entered)
+        };
+
+        struct PassInfo
+        {
+            float distance = 0.0f;
+            float pitch = 0.0f;
+            std::uint64_t health[Health::k_site_count] = {}; // Health passes during the pass
+        };
+
+        struct Run
+        {
+            std::vector<Sample> samples;
+            std::array<PassInfo, k_passes> passes{};
+            int passes_started = 0;
+            std::uint64_t dropped = 0;
+            float seconds = 0.0f;
+            bool aborted = false;
+            std::string stamp; // local start time, for the file names
+        };
+
+        std::atomic<bool> s_toggle{false};
+        std::atomic<bool> s_running{false};
+        std::atomic<int> s_pass{0};
+        std::atomic<float> s_seconds{0.0f};
+
+        // Render-thread run state.
+        std::unique_ptr<Run> s_run;
+        float s_time = 0.0f;
+        int s_current_pass = -1;
+        bool s_sampling = false; // the frame in progress lies in a sampled window
+        float s_pending[Profiler::k_stage_count] = {};
+        double s_frame_start_wall = 0.0;
+        Health::Stats s_pass_health_start{};
+        bool s_saved_orbit_active = false;
+        float s_saved_orbit_yaw = 0.0f;
+        float s_saved_orbit_pitch = 0.0f;
+        float s_saved_zoom = 0.0f;
+
+        HANDLE s_writer = nullptr; // the last run's report writer
+
+        const char *metric_name(std::size_t m) noexcept
+        {
+            return (m == 0) ? "Frame time" : Profiler::stage_name(static_cast<Profiler::Stage>(m - 1));
+        }
+
+        const char *metric_unit(std::size_t m) noexcept
+        {
+            return (m == 0) ? "ms" : "us";
+        }
+
+        void clear_pending() noexcept
+        {
+            std::fill(std::begin(s_pending), std::end(s_pending), -1.0f);
+        }
+
+        struct Summary
+        {
+            std::size_t count = 0;
+            float p50 = 0.0f;
+            float p95 = 0.0f;
+            float p99 = 0.0f;
+            float max = 0.0f;
+            float mean = 0.0f;
+        };
+
+        /// Nearest-rank percentiles of @p v (sorted in place), like the profiler's overlay readout.
+        Summary summarize(std::vector<float> &v)
+        {
+            Summary s;
+            s.count = v.size();
+            if (v.empty())
+            {
+                return s;
+            }
+            std::sort(v.begin(), v.end());
+            const auto rank = [&v](float q)
+            { return v[std::min(v.size() - 1, static_cast<std::size_t>(q * static_cast<float>(v.size())))]; };
+            double sum = 0.0;
+            for (const float x : v)
+            {
+                sum += x;
+            }
+            s.p50 = rank(0.50f);
+            s.p95 = rank(0.95f);
+            s.p99 = rank(0.99f);
+            s.max = v.back();
+            s.mean = static_cast<float>(sum / static_cast<double>(v.size()));
+            return s;
+        }
+
+        /// Values of metric @p m in pass @p pass (-1 = the whole run), skipping frames the stage did not run in.
+        std::vector<float> collect(const Run &run, std::size_t m, int pass)
+        {
+            std::vector<float> v;
+            v.reserve(run.samples.size());
+            for (const Sample &s : run.samples)
+            {
+                if ((pass < 0 || s.pass == pass) && s.value[m] >= 0.0f)
+                {
+                    v.push_back(s.value[m]);
+                }
+            }
+            return v;
+        }
+
+        void write_report(Run &run)
+        {
+            DMK::Logger &logger = DMK::Logger::get_instance();
+            const std::string base =
+                DMK::Filesystem::get_runtime_directory_utf8() + "\\TPVCamera_benchmark_" + run.stamp;
+
+            std::string csv = "pass,distance_m,pitch_deg,metric,unit,count,p50,p95,p99,max,mean\n";
+            std::string json = "{\n";
+            std::format_to(std::back_inserter(json),
+                           "  \"version\": 1,\n  \"started\": \"{}\",\n  \"aborted\": {},\n  \"seconds\": {:.2f},\n"
+                           "  \"frames\": {},\n  \"dropped_frames\": {},\n  \"passes\": [\n",
+                           run.stamp, run.aborted ? "true" : "false", run.seconds, run.samples.size(), run.dropped);
+
+            for (int pass = -1; pass < run.passes_started; ++pass)
+            {
+                const PassInfo *info = (pass >= 0) ? &run.passes[static_cast<std::size_t>(pass)] : nullptr;
+                const std::string label = (pass >= 0) ? std::to_string(pass + 1) : std::string("all");
+                const std::string dist = info ? std::format("{:.2f}", info->distance) : std::string();
+                const std::string pitch = info ? std::format("{:.1f}", info->pitch) : std::string();
+
+                std::format_to(std::back_inserter(json), "    {{\n      \"pass\": \"{}\",\n", label);
+                if (info != nullptr)
+                {
+                    std::format_to(std::back_inserter(json), "      \"distance_m\": {},\n      \"pitch_deg\": {},\n",
+                                   dist, pitch);
+                }
+                json += "      \"metrics\": [\n";
+                bool first = true;
+                for (std::size_t m = 0; m < k_metrics; ++m)
+                {
+                    std::vector<float> values = collect(run, m, pass);
+                    if (values.empty())
+                    {
+                        continue; // a stage that never ran (or the profiler is compiled out)
+                    }
+                    const Summary s = summarize(values);
+                    std::format_to(std::back_inserter(csv),
+                                   "{},{},{},\"{}\",{},{},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f}\n", label, dist, pitch,
+                                   metric_name(m), metric_unit(m), s.count, s.p50, s.p95, s.p99, s.max, s.mean);
+                    std::format_to(std::back_inserter(json),
+                                   "{}        {{\"name\": \"{}\", \"unit\": \"{}\", \"count\": {}, \"p50\": {:.3f}, "
+                                   "\"p95\": {:.3f}, \"p99\": {:.3f}, \"max\": {:.3f}, \"mean\": {:.3f}}}",
+                                   first ? "" : ",\n", metric_name(m), metric_unit(m), s.count, s.p50, s.p95, s.p99,
+                                   s.max, s.mean);
+                    first = false;
+                }
+                json += "\n      ],\n      \"health\": {";
+                for (std::size_t h = 0; h < Health::k_site_count; ++h)
+                {
+                    std::uint64_t n = 0;
+                    if (info != nullptr)
+                    {
+                        n = info->health[h];
+                    }
+                    else
+                    {
+                        for (int p = 0; p < run.passes_started; ++p)
+                        {
+                            n += run.passes[static_cast<std::size_t>(p)].health[h];
+                        }
+                    }
+                    const char *site = Health::site_name(static_cast<Health::Site>(h));
+                    std::format_to(std::back_inserter(csv), "{},{},{},\"Health: {}\",events,{},,,,,\n", label, dist,
+                                   pitch, site, n);
+                    std::format_to(std::back_inserter(json), "{}\"{}\": {}", h == 0 ? "" : ", ", site, n);
+                }
+                json += (pass + 1 < run.passes_started) ? "}\n    },\n" : "}\n    }\n";
+            }
+            json += "  ]\n}\n";
+
+            bool ok = true;
+            for (const auto &[ext, text] : {std::pair<const char *, const std::string *>{".csv", &csv},
+                                            std::pair<const char *, const std::string *>{".json", &json}})
+            {
+                std::ofstream out(base + ext, std::ios::binary | std::ios::trunc);
+                out.write(text->data(), static_cast<std::streamsize>(text->size()));
+                ok = ok && static_cast<bool>(out);
+            }
+            if (ok)
+            {
+                logger.info("Benchmark: {} frames over {} pass(es){} written to {}.csv / .json", run.samples.size(),
+                            run.passes_started, run.aborted ? " (aborted)" : "", base);
+            }
+            else
+            {
+                logger.warning("Benchmark: could not write the report to {}.csv / .json", base);
+            }
+        }
+
+        // Also the inline fallback of finish(), which runs inside the noexcept on_frame(): nothing may escape.
+        DWORD WINAPI report_thread(LPVOID param)
+        {
+            AllocStats::set_thread_tag(AllocStats::AllocTag::Logging);
+            const std::unique_ptr<Run> run(static_cast<Run *>(param));
+            try
+            {
+                write_report(*run);
+            }
+            catch (const std::exception &e)
+            {
+                DMK::Logger::get_instance().warning("Benchmark: could not build the report: {}", e.what());
+            }
+            return 0;
+        }
+
+        bool writer_busy() noexcept
+        {
+            return s_writer != nullptr && WaitForSingleObject(s_writer, 0) == WAIT_TIMEOUT;
+        }
+
+        void begin()
+        {
+            DMK::Logger &logger = DMK::Logger::get_instance();
+            if (writer_busy())
+            {
+                logger.warning("Benchmark: the previous report is still being written; not starting");
+                return;
+            }
+            auto run = std::make_unique<Run>();
+            run->samples.reserve(k_max_samples);
+            SYSTEMTIME now{};
+            GetLocalTime(&now);
+            char stamp[32];
+            std::snprintf(stamp, sizeof(stamp), "%04u%02u%02u_%02u%02u%02u", now.wYear, now.wMonth, now.wDay,
+                          now.wHour, now.wMinute, now.wSecond);
+            run->stamp = stamp;
+            s_run = std::move(run);
+
+            CameraState &cam = camera_state();
+            s_saved_orbit_active = cam.orbit_active.load(std::memory_order_relaxed);
+            s_saved_orbit_yaw = cam.orbit_yaw.load(std::memory_order_relaxed);
+            s_saved_orbit_pitch = cam.orbit_pitch.load(std::memory_order_relaxed);
+            s_saved_zoom = cam.zoom_offset.load(std::memory_order_relaxed);
+            cam.orbit_active.store(true, std::memory_order_relaxed);
+            Profiler::set_forced(true);
+
+            s_time = 0.0f;
+            s_current_pass = -1;
+            s_sampling = false;
+            clear_pending();
+            s_running.store(true, std::memory_order_relaxed);
+            logger.info("Benchmark: started ({} passes, about {:.0f} s); keep the mouse still", k_passes,
+                        k_total_seconds);
+        }
+
+        /// Folds the Health counters since the pass opened into its record.
+        void close_pass() noexcept
+        {
+            if (s_current_pass < 0)
+            {
+                return;
+            }
+            const Health::Stats now = Health::stats();
+            PassInfo &info = s_run->passes[static_cast<std::size_t>(s_current_pass)];
+            for (std::size_t h = 0; h < Health::k_site_count; ++h)
+            {
+                info.health[h] = now.total[h] - s_pass_health_start.total[h];
+            }
+        }
+
+        void open_pass(int pass, const Limits &limits) noexcept
+        {
+            close_pass();
+            const int d = pass / k_pitches;
+            const int p = pass % k_pitches;
+            const float distances[k_distances] = {
+                limits.distance_min,
+                std::clamp(limits.follow_distance, limits.distance_min, limits.distance_max),
+                limits.distance_max,
+            };
+            const float pitches[k_pitches] = {limits.pitch_min * k_pitch_fraction, 0.0f,
+                                              limits.pitch_max * k_pitch_fraction};
+            PassInfo &info = s_run->passes[static_cast<std::size_t>(pass)];
+            info.distance = distances[d];
+            info.pitch = pitches[p];
+            s_run->passes_started = pass + 1;
+            s_pass_health_start = Health::stats();
+            s_current_pass = pass;
+            s_pass.store(pass, std::memory_order_relaxed);
+            Overlay::notify_changed();
+        }
+
+        void finish(bool aborted)
+        {
+            close_pass();
+            CameraState &cam = camera_state();
+            cam.orbit_active.store(s_saved_orbit_active, std::memory_order_relaxed);
+            cam.orbit_yaw.store(s_saved_orbit_yaw, std::memory_order_relaxed);
+            cam.orbit_pitch.store(s_saved_orbit_pitch, std::memory_order_relaxed);
+            cam.zoom_offset.store(s_saved_zoom, std::memory_order_relaxed);
+            Profiler::set_forced(false);
+            s_running.store(false, std::memory_order_relaxed);
+            Overlay::notify_changed();
+
+            s_run->aborted = aborted;
+            s_run->seconds = s_time;
+            if (s_writer != nullptr)
+            {
+                CloseHandle(s_writer);
+            }
+            Run *run = s_run.release();
+            s_writer = CreateThread(nullptr, 0, report_thread, run, 0, nullptr);
+            if (s_writer == nullptr)
+            {
+                report_thread(run); // no thread: write it here, at the cost of one long frame
+            }
+        }
+    } // namespace
+
+    void toggle() noexcept
+    {
+        s_toggle.store(true, std::memory_order_relaxed);
+    }
+
+    void on_frame(const FrameClock::Tick &tick, const Limits &limits) noexcept
+    {
+        if (s_toggle.load(std::memory_order_relaxed) && s_toggle.exchange(false, std::memory_order_relaxed))
+        {
+            try
+            {
+                if (s_run)
+                {
+                    finish(true);
+                    return;
+                }
+                begin();
+            }
+            catch (const std::bad_alloc &)
+            {
+                s_run.reset();
+                s_running.store(false, std::memory_order_relaxed);
+                Profiler::set_forced(false);
+                DMK::Logger::get_instance().warning("Benchmark: out of memory for the sample buffer; not started");
+                return;
+            }
+        }
+        if (!s_run)
+        {
+            return;
+        }
+
+        // The profiler closed the previous detour call's frame after it ran; a game-view frame may span two
+        // calls, so the calls are summed until the next frame opens.
+        for (std::size_t i = 0; i < Profiler::k_stage_count; ++i)
+        {
+            const float us = Profiler::last_frame_us(static_cast<Profiler::Stage>(i));
+            if (us >= 0.0f)
+            {
+                s_pending[i] = std::max(s_pending[i], 0.0f) + us;
+            }
+        }
+        if (tick.new_frame)
+        {
+            const double wall = FrameClock::stamp().wall_seconds;
+            if (s_sampling)
+            {
+                if (s_run->samples.size() < s_run->samples.capacity())
+                {
+                    Sample &s = s_run->samples.emplace_back();
+                    s.pass = static_cast<std::uint8_t>(s_current_pass);
+                    s.value[0] = static_cast<float>((wall - s_frame_start_wall) * 1000.0);
+                    std::copy(std::begin(s_pending), std::end(s_pending), s.value + 1);
+                }
+                else
+                {
+                    ++s_run->dropped;
+                }
+            }
+            s_frame_start_wall = wall;
+            clear_pending();
+        }
+
+        s_time += tick.delta;
+        s_seconds.store(s_time, std::memory_order_relaxed);
+        if (s_time >= k_total_seconds)
+        {
+            finish(false);
+            return;
+        }
+        const int pass = std::min(static_cast<int>(s_time / k_pass_seconds), k_passes - 1);
+        if (pass != s_current_pass)
+        {
+            open_pass(pass, limits);
+        }
+        const float local = s_time - static_cast<float>(pass) * k_pass_seconds - k_settle_seconds;
+        int stop = 0;
+        s_sampling = false;
+        if (local >= 0.0f)
+        {
+            stop = std::min(static_cast<int>(local / k_stop_seconds), k_stops - 1);
+            s_sampling = (local - static_cast<float>(stop) * k_stop_seconds) >= k_ease_seconds;
+        }
+
+        const PassInfo &info = s_run->passes[static_cast<std::size_t>(pass)];
+        CameraState &cam = camera_state();
+        cam.orbit_active.store(true, std::memory_order_relaxed);
+        cam.orbit_yaw.store(static_cast<float>(stop) * (360.0f / static_cast<float>(k_stops)),
+                            std::memory_order_relaxed);
+        cam.orbit_pitch.store(info.pitch, std::memory_order_relaxed);
+        cam.zoom_offset.store(info.distance - limits.follow_distance, std::memory_order_relaxed);
+    }
+
+    Progress progress() noexcept
+    {
+        Progress p;
+        p.running = s_running.load(std::memory_order_relaxed);
+        p.pass = s_pass.load(std::memory_order_relaxed);
+        p.seconds = s_seconds.load(std::memory_order_relaxed);
+        p.total_seconds = k_total_seconds;
+        return p;
+    }
+
+    void shutdown() noexcept
+    {
+        if (s_writer != nullptr)
+        {
+            WaitForSingleObject(s_writer, 5000);
+            CloseHandle(s_writer);
+            s_writer = nullptr;
+        }
+    }
+
+} // namespace TPVCamera::Benchmark
@@ -0,0 +1,84 @@
+/**
+ * @file benchmark.hpp
+ * @brief Scripted in-game camera benchmark: a fixed free-look orbit / zoom sweep, timed per detour stage, written
+ *        to a CSV and a JSON report next to the log.
+ *
+ * @details [Settings] BenchmarkKey starts a run (and aborts one in progress). The run takes over the free-look orbit
+ *          and zoom for a fixed script so two builds or two INI setups can be compared on the same spot:
+ *            - 9 passes: 3 follow distances (the active preset's Follow Distance Min, Follow Distance and Follow
+ *              Distance Max) x 3 pitches (k_pitch_fraction of its Orbit Pitch Min, level, k_pitch_fraction of its
+ *              Orbit Pitch Max).
+ *            - Each pass settles for k_settle_seconds at yaw 0, then holds k_stops yaw stops spread over a full
+ *              turn for k_stop_seconds each. The first k_ease_seconds of a stop (the orbit easing to it) and the
+ *              settle are not sampled.
+ *          Every sampled frame records the frame time and each profiler stage's cost (the profiler is forced on
+ *          for the run); each pass also records how many times each Health site fired. The report gives per-pass
+ *          and whole-run p50 / p95 / p99 / max / mean. Stages need the profiler compiled in
+ *          (TPVCAMERA_ENABLE_PROFILER); without it the report carries the frame time and Health only.
+ *
+ *          The script advances only on third-person frames, so switching to first person pauses it. The orbit
+ *          state and zoom are restored when the run ends. The report is sorted and written on a one-shot thread so
+ *          the last frame of the run does not hitch.
+ *
+ *          Threading: toggle() and progress() are safe from any thread; on_frame() runs on the render thread only.
+ */
+#ifndef TPVCAMERA_BENCHMARK_HPP
+#define TPVCAMERA_BENCHMARK_HPP
+
+#include "frame_clock.hpp"
+
+namespace TPVCamera::Benchmark
+{
+
+    inline constexpr int k_distances = 3;
+    inline constexpr int k_pitches = 3;
+    inline constexpr int k_passes = k_distances * k_pitches;
+    inline constexpr int k_stops = 8; // yaw stops per pass, 45 degrees apart
+    inline constexpr float k_settle_seconds = 1.5f;
+    inline constexpr float k_stop_seconds = 1.0f;
+    inline constexpr float k_ease_seconds = 0.35f;
+    inline constexpr float k_pitch_fraction = 0.6f;
+
+    /**
+     * @struct Limits
+     * @brief This frame's zoom and pitch window, from which the script's distances and pitches are derived.
+     */
+    struct Limits
+    {
+        float follow_distance = 0.0f; // the preset's base distance (zoom offset 0)
+        float distance_min = 0.0f;
+        float distance_max = 0.0f;
+        float pitch_min = 0.0f;
+        float pitch_max = 0.0f;
+    };
+
+    /** @brief Starts a run, or aborts the one in progress (which still writes its partial report). Any thread. */
+    void toggle() noexcept;
+
+    /**
+     * @brief Advances a running script by one detour call and writes its orbit / zoom into the camera state.
+     * @details Called on third-person frames before the camera offset reads the orbit and zoom. A no-op (one
+     *          relaxed load) while no run is pending or active. Render thread only.
+     */
+    void on_frame(const FrameClock::Tick &tick, const Limits &limits) noexcept;
+
+    /**
+     * @struct Progress
+     * @brief Run state for the overlay.
+     */
+    struct Progress
+    {
+        bool running = false;
+        int pass = 0; // 0-based, < k_passes
+        float seconds = 0.0f;
+        float total_seconds = 0.0f;
+    };
+
+    [[nodiscard]] Progress progress() noexcept;
+
+    /** @brief Waits for a report still being written. Called once from shutdown. */
+    void shutdown() noexcept;
+
+} // namespace TPVCamera::Benchmark
+
+#endif // TPVCAMERA_BENCHMARK_HPP
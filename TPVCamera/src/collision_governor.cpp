@@ -0,0 +1,152 @@
+/**
+ * @file collision_governor.cpp
+ * @brief Tier stepping for the camera-collision frame-budget governor (see collision_governor.hpp).
+ */
+
+#include "collision_governor.hpp"
+#include "frame_profiler.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+namespace TPVCamera::CollisionGovernor
+{
+
+    namespace
+    {
+        // Low-pass strength of the per-recompute cost average.
+        constexpr float k_ema_alpha = 0.2f;
+        // Consecutive over-budget averages before stepping down (a single sample over k_spike_factor x the budget
+        // steps at once).
+        constexpr std::uint32_t k_over_samples = 3;
+        constexpr float k_spike_factor = 2.0f;
+        // Stepping up needs the average under k_headroom x the budget for k_restore_samples recomputes (times the
+        // current backoff), i.e. clear evidence the better tier fits.
+        constexpr float k_headroom = 0.6f;
+        constexpr std::uint32_t k_restore_samples = 60;
+        // A step down within this many recomputes of a restore counts as the restore not fitting (backoff x2); a
+        // tier held this long without a step down halves the backoff again.
+        constexpr std::uint32_t k_failed_restore_samples = 120;
+        constexpr std::uint32_t k_stable_samples = 600;
+
+        constexpr std::uint8_t k_lowest = static_cast<std::uint8_t>(Tier::Count) - 1;
+
+        constexpr const char *k_tier_names[] = {
+            "Full", "Coarse occlusion requery", "Short coverage walk", "Physics coverage", "Centre ray only",
+        };
+        static_assert(sizeof(k_tier_names) / sizeof(k_tier_names[0]) == static_cast<std::size_t>(Tier::Count));
+
+        // Published for the overlay.
+        std::atomic<std::uint8_t> s_tier{0};
+        std::atomic<float> s_average_us{0.0f};
+
+        // Render-thread-only stepping state.
+        float s_ema_us = 0.0f; // 0 = no sample at this tier yet (the next one seeds it)
+        std::uint32_t s_over = 0;
+        std::uint32_t s_under = 0;
+        std::uint32_t s_backoff = 1;
+        std::uint32_t s_since_restore = k_failed_restore_samples;
+        std::uint32_t s_since_step_down = 0;
+
+        /// Moves to @p tier and restarts the average so the new tier is judged on its own samples.
+        void step_to(std::uint8_t tier) noexcept
+        {
+            s_tier.store(tier, std::memory_order_relaxed);
+            s_ema_us = 0.0f;
+            s_over = 0;
+            s_under = 0;
+            DMK::Logger::get_instance().debug("CollisionGovernor: tier -> {} (restore backoff x{})",
+                                              k_tier_names[tier], s_backoff);
+        }
+    } // namespace
+
+    const char *tier_name(Tier tier) noexcept
+    {
+        const auto i = static_cast<std::size_t>(tier);
+        return (i < static_cast<std::size_t>(Tier::Count)) ? k_tier_names[i] : "?";
+    }
+
+    Tier begin(int budget_us, std::int64_t &out_start) noexcept
+    {
+        if (budget_us <= 0)
+        {
+            out_start = 0;
+            if (s_tier.load(std::memory_order_relaxed) != 0 || s_ema_us != 0.0f)
+            {
+                // Governor switched off: back to full quality with a clean history.
+                s_tier.store(0, std::memory_order_relaxed);
+                s_average_us.store(0.0f, std::memory_order_relaxed);
+                s_ema_us = 0.0f;
+                s_over = 0;
+                s_under = 0;
+                s_backoff = 1;
+                s_since_restore = k_failed_restore_samples;
+                s_since_step_down = 0;
+            }
+            return Tier::Full;
+        }
+        out_start = Profiler::now_ticks();
+        return static_cast<Tier>(s_tier.load(std::memory_order_relaxed));
+    }
+
+    void end(int budget_us, std::int64_t start) noexcept
+    {
+        if (start == 0 || budget_us <= 0)
+        {
+            return;
+        }
+        const float us = Profiler::ticks_to_us(Profiler::now_ticks() - start);
+        const float budget = static_cast<float>(budget_us);
+        s_ema_us = (s_ema_us <= 0.0f) ? us : s_ema_us + (us - s_ema_us) * k_ema_alpha;
+        s_average_us.store(s_ema_us, std::memory_order_relaxed);
+        s_since_restore = std::min(s_since_restore + 1, k_failed_restore_samples);
+        s_since_step_down = std::min(s_since_step_down + 1, k_stable_samples);
+
+        const std::uint8_t tier = s_tier.load(std::memory_order_relaxed);
+        if (s_ema_us > budget || us > budget * k_spike_factor)
+        {
+            s_under = 0;
+            ++s_over;
+            if (tier < k_lowest && (s_over >= k_over_samples || us > budget * k_spike_factor))
+            {
+                if (s_since_restore < k_failed_restore_samples)
+                {
+                    s_backoff = std::min(s_backoff * 2, k_max_restore_backoff);
+                }
+                s_since_step_down = 0;
+                step_to(static_cast<std::uint8_t>(tier + 1));
+            }
+            return;
+        }
+
+        s_over = 0;
+        if (s_since_step_down >= k_stable_samples && s_backoff > 1)
+        {
+            s_backoff /= 2;
+            s_since_step_down = 0;
+        }
+        if (s_ema_us < budget * k_headroom)
+        {
+            if (tier > 0 && ++s_under >= k_restore_samples * s_backoff)
+            {
+                s_since_restore = 0;
+                step_to(static_cast<std::uint8_t>(tier - 1));
+            }
+            return;
+        }
+        s_under = 0;
+    }
+
+    Tier tier() noexcept
+    {
+        return static_cast<Tier>(s_tier.load(std::memory_order_relaxed));
+    }
+
+    float average_us() noexcept
+    {
+        return s_average_us.load(std::memory_order_relaxed);
+    }
+
+} // namespace TPVCamera::CollisionGovernor
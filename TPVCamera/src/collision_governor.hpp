@@ -0,0 +1,84 @@
+/**
+ * @file collision_governor.hpp
+ * @brief Frame-budget governor that trades camera-collision quality for render-thread time.
+ *
+ * @details The collision stage (solve_camera_collision, camera_hook.cpp) is the dominant cost of the detour, and
+ *          its cost is set by the scene: an open field is a few rays, a market street walks the coverage gate
+ *          through a dozen props, rasters their meshes and queries the render octree. With [Collision]
+ *          CollisionBudgetUs set, the governor times every frame the stage actually recomputes (the static-world
+ *          throttle's reuse frames cost one ray and are not sampled) and steps down one Tier while the stage runs
+ *          over budget, then back up one tier at a time once the cost has sat well under the budget for a while.
+ *          Each tier keeps every cheaper tier's savings:
+ *          - CoarseOcclusion: render_occlusion_limit reuses its cached roof over a wider camera travel before it
+ *            re-runs the octree query.
+ *          - ShortWalk: the coverage walk sees past at most k_short_walk_steps props; the next hit collides without
+ *            a coverage measurement (collide is the safe verdict).
+ *          - PhysicsCoverage: a coverage cache miss is measured with the physics-ray fraction instead of the mesh
+ *            raster / octree query, and is not cached, so full quality re-measures it properly.
+ *          - CentreRay: a single pivot -> camera ray, minus the skin; no walk, sphere, render occlusion or probe.
+ *
+ *          Stepping back up after a tier was left is slower each time it immediately has to step down again (up to
+ *          k_max_restore_backoff), so a scene that sits right at the budget settles instead of oscillating.
+ *          Budget 0 (the default) keeps Full and costs one load per frame.
+ *
+ *          Threading: begin() / end() run on the render thread only; tier() and average_us() read relaxed atomics
+ *          for the overlay.
+ */
+#ifndef TPVCAMERA_COLLISION_GOVERNOR_HPP
+#define TPVCAMERA_COLLISION_GOVERNOR_HPP
+
+#include <cstdint>
+
+namespace TPVCamera::CollisionGovernor
+{
+
+    /**
+     * @enum Tier
+     * @brief Collision quality levels, best first. Each tier includes the savings of every tier before it.
+     */
+    enum class Tier : std::uint8_t
+    {
+        Full,
+        CoarseOcclusion,
+        ShortWalk,
+        PhysicsCoverage,
+        CentreRay,
+        Count
+    };
+
+    /// Props the coverage walk may see past from Tier::ShortWalk down (Full allows COVERAGE_SKIP_MAX).
+    inline constexpr int k_short_walk_steps = 2;
+
+    /// render_occlusion_limit requery-distance multiplier from Tier::CoarseOcclusion down.
+    inline constexpr float k_coarse_requery_scale = 4.0f;
+
+    /// Cap on the doubling of the restore delay after a restore that immediately had to step down again.
+    inline constexpr std::uint32_t k_max_restore_backoff = 16;
+
+    /** @brief Display name of @p tier for the overlay. */
+    [[nodiscard]] const char *tier_name(Tier tier) noexcept;
+
+    /**
+     * @brief Tier to run this frame's collision recompute at, and the start of its timing sample.
+     * @details A @p budget_us <= 0 resets the governor to Tier::Full. Render thread only.
+     * @param budget_us [Collision] CollisionBudgetUs.
+     * @param out_start Receives the sample start tick for end() (0 while the governor is off).
+     */
+    [[nodiscard]] Tier begin(int budget_us, std::int64_t &out_start) noexcept;
+
+    /**
+     * @brief Closes the sample opened by begin() and steps the tier for the next recompute. Render thread only.
+     * @param budget_us The budget passed to the matching begin().
+     * @param start The tick begin() returned; 0 (governor off) records nothing.
+     */
+    void end(int budget_us, std::int64_t start) noexcept;
+
+    /** @brief The tier the last recompute ran at. Safe from any thread. */
+    [[nodiscard]] Tier tier() noexcept;
+
+    /** @brief Smoothed cost of a recompute, in microseconds (0 while the governor is off). Safe from any thread. */
+    [[nodiscard]] float average_us() noexcept;
+
+} // namespace TPVCamera::CollisionGovernor
+
+#endif // TPVCAMERA_COLLISION_GOVERNOR_HPP
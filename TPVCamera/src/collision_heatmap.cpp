@@ -0,0 +1,246 @@
+/**
+ * @file collision_heatmap.cpp
+ * @brief Sparse cell table, minimap window and CSV export of the collision-cost heatmap (see collision_heatmap.hpp).
+ */
+
+#include "collision_heatmap.hpp"
+#include "frame_clock.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <windows.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <vector>
+
+namespace TPVCamera::CollisionHeatmap
+{
+
+    namespace
+    {
+        static_assert((k_capacity & (k_capacity - 1)) == 0, "the cell table is probed with a power-of-two mask");
+
+        std::mutex s_mutex;
+        std::array<Cell, k_capacity> s_cells{}; // guarded by s_mutex
+        std::size_t s_used = 0;                 // guarded by s_mutex
+
+        std::atomic<std::uint64_t> s_dropped{0};
+        std::atomic<std::uint64_t> s_contended{0};
+        // Last recorded pivot cell, for the overlay's window; s_have_pivot once anything was recorded.
+        std::atomic<int> s_pivot_ix{0};
+        std::atomic<int> s_pivot_iy{0};
+        std::atomic<bool> s_have_pivot{false};
+        std::uint64_t s_last_name_frame = 0; // render thread only
+
+        int cell_of(float metres) noexcept
+        {
+            return static_cast<int>(std::floor(std::clamp(metres / k_cell_metres, -1.0e8f, 1.0e8f)));
+        }
+
+        std::size_t home_slot(int ix, int iy) noexcept
+        {
+            const std::uint32_t h =
+                (static_cast<std::uint32_t>(ix) * 73856093u) ^ (static_cast<std::uint32_t>(iy) * 19349663u);
+            return static_cast<std::size_t>(h) & (k_capacity - 1);
+        }
+
+        /// The slot of (ix, iy), or the empty slot it would take (nullptr when absent and the table is full).
+        /// Caller holds s_mutex.
+        Cell *find_slot(int ix, int iy) noexcept
+        {
+            std::size_t i = home_slot(ix, iy);
+            for (std::size_t probe = 0; probe < k_capacity; ++probe)
+            {
+                Cell &c = s_cells[i];
+                if (c.frames == 0 || (c.ix == ix && c.iy == iy))
+                {
+                    return &c;
+                }
+                i = (i + 1) & (k_capacity - 1);
+            }
+            return nullptr;
+        }
+    } // namespace
+
+    bool record(const Vector3 &pivot, const Vector3 &arm, float cost_us, std::uint64_t collider) noexcept
+    {
+        const int ix = cell_of(pivot.x);
+        const int iy = cell_of(pivot.y);
+        s_pivot_ix.store(ix, std::memory_order_relaxed);
+        s_pivot_iy.store(iy, std::memory_order_relaxed);
+        s_have_pivot.store(true, std::memory_order_relaxed);
+
+        const std::unique_lock lock(s_mutex, std::try_to_lock);
+        if (!lock.owns_lock())
+        {
+            s_contended.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        Cell *c = find_slot(ix, iy);
+        if (c == nullptr || (c->frames == 0 && s_used >= k_capacity * 3 / 4))
+        {
+            s_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (c->frames == 0)
+        {
+            *c = Cell{};
+            c->ix = ix;
+            c->iy = iy;
+            ++s_used;
+        }
+        ++c->frames;
+        c->total_us += cost_us;
+        if (cost_us <= c->max_us && c->frames > 1)
+        {
+            return false;
+        }
+        c->max_us = cost_us;
+        c->max_pivot[0] = pivot.x;
+        c->max_pivot[1] = pivot.y;
+        c->max_pivot[2] = pivot.z;
+        c->max_arm[0] = arm.x;
+        c->max_arm[1] = arm.y;
+        c->max_arm[2] = arm.z;
+        if (c->collider != collider)
+        {
+            c->collider = collider;
+            c->name[0] = '\0';
+        }
+        if (collider == 0 || c->name[0] != '\0')
+        {
+            return false;
+        }
+        const std::uint64_t frame = FrameClock::stamp().frame;
+        if (frame - s_last_name_frame < k_name_interval_frames)
+        {
+            return false;
+        }
+        s_last_name_frame = frame;
+        return true;
+    }
+
+    void set_name(const Vector3 &pivot, const char *name) noexcept
+    {
+        if (name == nullptr || name[0] == '\0')
+        {
+            return;
+        }
+        const std::unique_lock lock(s_mutex, std::try_to_lock);
+        if (!lock.owns_lock())
+        {
+            return;
+        }
+        Cell *c = find_slot(cell_of(pivot.x), cell_of(pivot.y));
+        if (c != nullptr && c->frames != 0)
+        {
+            std::snprintf(c->name, sizeof(c->name), "%s", name);
+        }
+    }
+
+    bool cells_around(int radius, Cell *out) noexcept
+    {
+        if (!s_have_pivot.load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+        const int cx = s_pivot_ix.load(std::memory_order_relaxed);
+        const int cy = s_pivot_iy.load(std::memory_order_relaxed);
+        const int side = 2 * radius + 1;
+        const std::lock_guard lock(s_mutex);
+        for (int row = 0; row < side; ++row)
+        {
+            for (int col = 0; col < side; ++col)
+            {
+                // Row 0 is the north edge (+Y), column 0 the west edge (-X).
+                const int ix = cx - radius + col;
+                const int iy = cy + radius - row;
+                const Cell *c = find_slot(ix, iy);
+                Cell &dst = out[row * side + col];
+                dst = (c != nullptr && c->frames != 0) ? *c : Cell{};
+                dst.ix = ix;
+                dst.iy = iy;
+            }
+        }
+        return true;
+    }
+
+    Stats stats() noexcept
+    {
+        Stats s;
+        {
+            const std::lock_guard lock(s_mutex);
+            s.cells = s_used;
+        }
+        s.dropped = s_dropped.load(std::memory_order_relaxed);
+        s.contended = s_contended.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    void reset() noexcept
+    {
+        const std::lock_guard lock(s_mutex);
+        s_cells.fill(Cell{});
+        s_used = 0;
+        s_dropped.store(0, std::memory_order_relaxed);
+        s_contended.store(0, std::memory_order_relaxed);
+    }
+
+    std::string export_csv()
+    {
+        std::vector<Cell> cells;
+        {
+            const std::lock_guard lock(s_mutex);
+            cells.reserve(s_used);
+            for (const Cell &c : s_cells)
+            {
+                if (c.frames != 0)
+                {
+                    cells.push_back(c);
+                }
+            }
+        }
+        // Worst cells first: the hotspots are what an export is for.
+        std::sort(cells.begin(), cells.end(), [](const Cell &a, const Cell &b) { return a.max_us > b.max_us; });
+
+        std::string csv = "cell_x_m,cell_y_m,frames,mean_us,max_us,total_ms,max_pivot_x,max_pivot_y,max_pivot_z,"
+                          "max_arm_x,max_arm_y,max_arm_z,collider,name\n";
+        for (const Cell &c : cells)
+        {
+            std::format_to(std::back_inserter(csv),
+                           "{:.1f},{:.1f},{},{:.2f},{:.2f},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},"
+                           "{:#x},\"{}\"\n",
+                           static_cast<float>(c.ix) * k_cell_metres, static_cast<float>(c.iy) * k_cell_metres,
+                           c.frames, c.total_us / static_cast<float>(c.frames), c.max_us, c.total_us / 1000.0f,
+                           c.max_pivot[0], c.max_pivot[1], c.max_pivot[2], c.max_arm[0], c.max_arm[1], c.max_arm[2],
+                           c.collider, c.name);
+        }
+
+        SYSTEMTIME now{};
+        GetLocalTime(&now);
+        char stamp[32];
+        std::snprintf(stamp, sizeof(stamp), "%04u%02u%02u_%02u%02u%02u", now.wYear, now.wMonth, now.wDay, now.wHour,
+                      now.wMinute, now.wSecond);
+        const std::string path =
+            DMK::Filesystem::get_runtime_directory_utf8() + "\\TPVCamera_heatmap_" + stamp + ".csv";
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(csv.data(), static_cast<std::streamsize>(csv.size()));
+        DMK::Logger &logger = DMK::Logger::get_instance();
+        if (!out)
+        {
+            logger.warning("Collision heatmap: could not write {}", path);
+            return {};
+        }
+        logger.info("Collision heatmap: {} cell(s) written to {}", cells.size(), path);
+        return path;
+    }
+
+} // namespace TPVCamera::CollisionHeatmap
@@ -0,0 +1,93 @@
+/**
+ * @file collision_heatmap.hpp
+ * @brief World-space map of where the camera-collision stage is expensive, for the overlay and for export.
+ *
+ * @details With [Advanced] CollisionHeatmap on, each collision-stage run adds its cost (QPC, microseconds) to the
+ *          k_cell_metres x k_cell_metres cell under the pivot (world X / Y; height is not split). A cell keeps its
+ *          frame count, total and worst cost, and for its worst frame the pivot, the arm and the collider the fan
+ *          blocked on, named through render_hit_info. The overlay's Performance section draws the cells around the
+ *          player as a north-up minimap; Export writes every cell to TPVCamera_heatmap_<date>_<time>.csv next to
+ *          the log, where the worst frame's pivot and arm reproduce a hotspot (a market tent, a scaffold) as a
+ *          benchmark spot.
+ *
+ *          Storage is a fixed open-addressed table of k_capacity cells (sparse: only cells the player stood in),
+ *          kept for the session; once it is full new cells are counted as dropped. Reset empties it.
+ *
+ *          Threading: record() and set_name() run on the render thread and only try the lock, so an overlay read in
+ *          progress skips that frame's sample instead of stalling the frame. cells_around(), export_csv(), stats()
+ *          and reset() are for the overlay thread.
+ */
+#ifndef TPVCAMERA_COLLISION_HEATMAP_HPP
+#define TPVCAMERA_COLLISION_HEATMAP_HPP
+
+#include "math_utils.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace TPVCamera::CollisionHeatmap
+{
+
+    inline constexpr float k_cell_metres = 2.0f;
+    inline constexpr std::size_t k_capacity = 8192;
+    inline constexpr std::size_t k_name_len = 64;
+    /// Fewest game-view frames between two collider-name lookups (each is a render-octree query).
+    inline constexpr std::uint64_t k_name_interval_frames = 30;
+
+    /**
+     * @struct Cell
+     * @brief One world cell's accumulated collision cost.
+     */
+    struct Cell
+    {
+        int ix = 0; // cell index: floor(x / k_cell_metres)
+        int iy = 0;
+        std::uint32_t frames = 0; // 0 = empty slot
+        float total_us = 0.0f;
+        float max_us = 0.0f;
+        float max_pivot[3] = {}; // the worst frame's arm start and arm (pivot -> desired camera), world
+        float max_arm[3] = {};
+        std::uint64_t collider = 0; // the worst frame's fan collider (0 = none)
+        char name[k_name_len] = {}; // its render brush name, once resolved
+    };
+
+    /**
+     * @brief Adds one collision-stage run of @p cost_us at @p pivot. Render thread only.
+     * @return True when the run became its cell's worst with a collider that has no name yet and a lookup is due;
+     *         the caller then resolves the name (render_hit_info) and passes it to set_name().
+     */
+    bool record(const Vector3 &pivot, const Vector3 &arm, float cost_us, std::uint64_t collider) noexcept;
+
+    /** @brief Names the worst collider of the cell under @p pivot. Render thread only. */
+    void set_name(const Vector3 &pivot, const char *name) noexcept;
+
+    /**
+     * @brief Copies the cells within @p radius cells of the last recorded pivot into @p out (row-major, side
+     *        2 * radius + 1, empty cells have frames == 0). Overlay thread.
+     * @return False when nothing has been recorded yet.
+     */
+    bool cells_around(int radius, Cell *out) noexcept;
+
+    /**
+     * @struct Stats
+     * @brief Table occupancy for the overlay.
+     */
+    struct Stats
+    {
+        std::size_t cells = 0;
+        std::uint64_t dropped = 0;   // runs whose new cell did not fit
+        std::uint64_t contended = 0; // runs skipped because the overlay held the table
+    };
+
+    [[nodiscard]] Stats stats() noexcept;
+
+    /** @brief Empties the map. Overlay thread. */
+    void reset() noexcept;
+
+    /** @brief Writes every cell to a CSV next to the log. Overlay thread. @return The path, or empty on failure. */
+    std::string export_csv();
+
+} // namespace TPVCamera::CollisionHeatmap
+
+#endif // TPVCAMERA_COLLISION_HEATMAP_HPP
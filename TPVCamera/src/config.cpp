@@ -15,6 +15,9 @@
 
 #include <DetourModKit.hpp>
 
+#include <array>
+#include <cstddef>
+
 namespace TPVCamera
 {
 
@@ -51,6 +54,42 @@ namespace TPVCamera
 
         // Advanced: RTTI self-heal search radius (see offset_heal.cpp). Not for normal users.
         DMK::Config::register_atomic<int>("Advanced", "SelfHealWindow", "Self Heal Window", s.self_heal_window, 0x100);
+        // Advanced: per-stage frustum-detour timing for the overlay Performance section (see frame_profiler.hpp).
+        DMK::Config::register_atomic<bool>("Advanced", "EnableProfiler", "Enable Profiler", s.enable_profiler, false);
+        // Advanced: collider coverage cache capacity (see coverage_cache.hpp).
+        DMK::Config::register_atomic<int>("Advanced", "CoverageCacheSize", "Coverage Cache Size", s.coverage_cache_size,
+                                          64);
+        // Advanced: engine-side game-state walk cadence (see game_state.cpp).
+        DMK::Config::register_atomic<int>("Advanced", "GameStatePollMs", "Game State Poll Ms", s.game_state_poll_ms,
+                                          50);
+        // Advanced: hardware D3D11 device for the overlay instead of WARP (see dx_overlay.cpp).
+        DMK::Config::register_atomic<bool>("Advanced", "OverlayHardwareDevice", "Overlay Hardware Device",
+                                           s.overlay_hardware_device, false);
+        // Advanced: overlay thread scheduling and WARP threading (see dx_overlay.cpp).
+        DMK::Config::register_atomic<bool>("Advanced", "OverlayWarpSingleThreaded", "Overlay WARP Single Threaded",
+                                           s.overlay_warp_single_threaded, true);
+        DMK::Config::register_atomic<int>("Advanced", "OverlayThreadPriority", "Overlay Thread Priority",
+                                          s.overlay_thread_priority, -1);
+        DMK::Config::register_atomic<int>("Advanced", "OverlayAffinityMask", "Overlay Affinity Mask",
+                                          s.overlay_affinity_mask, 0);
+        DMK::Config::register_atomic<bool>("Advanced", "OverlayEfficiencyCores", "Overlay Efficiency Cores",
+                                           s.overlay_efficiency_cores, false);
+        // Advanced: closed-panel time before the overlay's device and ImGui are released (see dx_overlay.cpp).
+        DMK::Config::register_atomic<int>("Advanced", "OverlayIdleReleaseSeconds", "Overlay Idle Release Seconds",
+                                          s.overlay_idle_release_seconds, 60);
+        // Advanced: one outer SEH region for the collision stage instead of per-call guards (see seh_region.hpp).
+        DMK::Config::register_atomic<bool>("Advanced", "CollisionSehRegion", "Collision SEH Region",
+                                           s.collision_seh_region, false);
+        // Advanced: per-frame collision telemetry ring file (see telemetry.hpp).
+        DMK::Config::register_atomic<bool>("Advanced", "RecordTelemetry", "Record Telemetry", s.record_telemetry,
+                                           false);
+        DMK::Config::register_atomic<int>("Advanced", "TelemetryFrames", "Telemetry Frames", s.telemetry_frames,
+                                          36000);
+        // Advanced: world-space collision cost heatmap (see collision_heatmap.hpp).
+        DMK::Config::register_atomic<bool>("Advanced", "CollisionHeatmap", "Collision Heatmap", s.collision_heatmap,
+                                           false);
+        // Advanced: helper threads for the coverage raster of large meshes (see raster_jobs.hpp).
+        DMK::Config::register_atomic<int>("Advanced", "RasterWorkers", "Raster Workers", s.raster_workers, 2);
 
         // Camera framing. The follow distance, offsets, eye height, aim focus, follow yaw/pitch, the orbit
         // tuning, and the per-preset collision values are all OWNED BY PRESETS (in the shipped presets JSON,
@@ -88,6 +127,17 @@ namespace TPVCamera
                                             0.3f);
         DMK::Config::register_atomic<bool>("Collision", "UseRenderOcclusion", "Use Render Occlusion",
                                            s.use_render_occlusion, true);
+        DMK::Config::register_atomic<bool>("Collision", "AsyncCollision", "Async Collision", s.async_collision, false);
+        DMK::Config::register_atomic<bool>("Collision", "PipelinedCollision", "Pipelined Collision",
+                                           s.pipelined_collision, false);
+        DMK::Config::register_atomic<bool>("Collision", "NonBlockingSweep", "Non Blocking Sweep",
+                                           s.non_blocking_sweep, true);
+        DMK::Config::register_atomic<bool>("Collision", "UseCollisionLod", "Use Collision LOD", s.use_collision_lod,
+                                           true);
+        DMK::Config::register_atomic<int>("Collision", "CollisionBudgetUs", "Collision Budget Us",
+                                          s.collision_budget_us, 0);
+        DMK::Config::register_atomic<bool>("Collision", "TemporalRayCoverage", "Temporal Ray Coverage",
+                                           s.temporal_ray_coverage, false);
 
         // State-driven camera policy. The three *State values are comma-separated GameState token lists
         // (Menu, Overlay, Combat, Mount, Dialogue, Minigame; Dice is an alias for Minigame), parsed into
@@ -109,6 +159,18 @@ namespace TPVCamera
             "Menu,Overlay,Cart,Combat,Mount,Minigame");
         DMK::Config::register_atomic<float>("StateBehavior", "StateSwitchHoldSeconds", "State Switch Hold Seconds",
                                             s.state_switch_hold_seconds, 0.2f);
+        DMK::Config::register_string(
+            "StateBehavior", "StateHoldOverrides", "State Hold Overrides",
+            [&overrides = s.state_hold_override](const std::string &value)
+            {
+                std::array<float, 32> seconds;
+                parse_state_hold_overrides(value, seconds);
+                for (std::size_t i = 0; i < seconds.size(); ++i)
+                {
+                    overrides[i].seconds.store(seconds[i], std::memory_order_relaxed);
+                }
+            },
+            "");
         // SuppressTPVState is the always-on HARD gate (read in should_apply_view): in any listed state the
         // TPV offset is suppressed and cannot be toggled back on. Separate from the edge-triggered Forced*
         // masks above and NOT gated by EnableStateBehavior. All states are honored (Menu/Overlay instant,
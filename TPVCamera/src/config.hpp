@@ -124,6 +124,33 @@ namespace TPVCamera
         // dropped instead of clamping the camera, while a view-burying canopy still clamps. No-ops if the octree
         // is unresolved. Queries the render octree per frame, so disable it too if camera collision costs FPS.
         std::atomic<bool> use_render_occlusion{true};
+        // Async collision: cast the unskipped pivot->camera fan on a mod-owned worker thread and consume it one
+        // frame later (when the arm has not moved), taking those rays off the render thread. Trades one frame of
+        // collision latency for frame time; the coverage walk's later steps stay synchronous. Live-editable.
+        std::atomic<bool> async_collision{false};
+        // Pipelined collision: with the coverage gate off, solve the whole physics part of the collision (the
+        // unskipped fan and the swept sphere) for this frame's arm on the collision worker and apply it on the next
+        // frame when the arm has not moved, so a held camera casts nothing on the render thread. A moved arm solves
+        // synchronously as before. Supersedes AsyncCollision while the gate is off. Live-editable.
+        std::atomic<bool> pipelined_collision{false};
+        // Non-blocking sphere sweep: PWI waits on the physical world's mutex, so a busy physics thread (ragdolls,
+        // horse physics) can stall the render thread inside the camera detour. When a synchronous sweep runs long,
+        // sweeps move onto the collision worker for a while and the camera reuses the latest completed one (the
+        // fan still gates it). Only engages under contention. Live-editable.
+        std::atomic<bool> non_blocking_sweep{true};
+        // Collision LOD: thin the collision probes (fan rays, physics coverage samples) while the camera is zoomed
+        // far out or the orbit swings fast, where the lost precision cannot be seen; a close or still camera keeps
+        // full density. See select_collision_lod (camera_hook.cpp). Live-editable.
+        std::atomic<bool> use_collision_lod{true};
+        // Collision frame budget, in microseconds of render-thread time per collision recompute. While the stage
+        // runs over it the collision governor (collision_governor.hpp) steps quality down a tier at a time -- a
+        // coarser render-occlusion requery, a shorter coverage walk, physics-ray coverage, the centre ray alone --
+        // and restores it once the cost has headroom again. 0 = off (always full quality). Live-editable.
+        std::atomic<int> collision_budget_us{0};
+        // Temporal ray coverage: the physics-ray coverage fallback casts a few rays of a denser body grid per
+        // frame and keeps a running estimate per collider (character_occluded_fraction_temporal) instead of the
+        // full 12-ray grid on every measure. Live-editable.
+        std::atomic<bool> temporal_ray_coverage{false};
 
         // State-driven camera policy (see game_state.hpp). Each mask is a GameState bit set parsed
         // from a comma-separated INI token list, read on the per-frame detour and the input thread.
@@ -138,6 +165,13 @@ namespace TPVCamera
         std::atomic<uint32_t> forced_tpv_mask{0};
         std::atomic<uint32_t> orbit_exclude_mask{0};
         std::atomic<float> state_switch_hold_seconds{0.2f};
+        // Per-state overrides of state_switch_hold_seconds, one per GameState mask bit ([StateBehavior]
+        // StateHoldOverrides, e.g. "Combat=0.5,Dialogue=0.1"). Negative = use state_switch_hold_seconds.
+        struct StateHoldOverride
+        {
+            std::atomic<float> seconds{-1.0f};
+        };
+        StateHoldOverride state_hold_override[32];
 
         // Continuous HARD suppression gate (INDEPENDENT of enable_state_behavior): while the game is in
         // any listed state the TPV offset is suppressed and CANNOT be toggled back on, unlike the
@@ -154,6 +188,13 @@ namespace TPVCamera
         // tuned in the overlay. preset_blend_speed is the exponential ease rate (higher = snappier;
         // <= 0 snaps instantly).
         std::atomic<float> preset_blend_speed{8.0f};
+        // Bumped (release) by the resolver after any preset-owned field above changed. A reader that caches
+        // preset-owned values re-reads them only when this moved; a converged / idle preset leaves it (and the
+        // fields) untouched, so steady-state frames write no shared settings memory.
+        std::atomic<uint32_t> preset_version{0};
+        // Bumped (release) after each INI load or hot reload applied the registered settings, for readers that
+        // cache the INI-owned values (the frustum detour's RenderSettings) the way preset_version serves presets.
+        std::atomic<uint32_t> settings_version{0};
 
         // Always-live "Camera" INI settings (NOT preset-owned; apply_to_live never writes them).
         // Re-origin the player use/interaction cone onto the render camera + crosshair (third person)
@@ -187,6 +228,54 @@ namespace TPVCamera
         // the heal runs (not a hot path); clamped to the DMK maximum. Larger tolerates a bigger insertion at
         // a slightly higher risk of a wrong heal onto a same-typed neighbour. Not for normal users to touch.
         std::atomic<int> self_heal_window{0x100};
+        // Advanced. Per-stage timing of the frustum-builder detour (see frame_profiler.hpp), shown in the overlay's
+        // Performance section. Off by default: while off each timed scope costs one relaxed load. Builds configured
+        // with TPVCAMERA_ENABLE_PROFILER=OFF compile the scopes out and ignore this flag.
+        std::atomic<bool> enable_profiler{false};
+        // Advanced. Slot count of the collider coverage cache (see coverage_cache.hpp), rounded up to a power of
+        // two and clamped to 16..4096. Each slot is a few dozen bytes; a change clears the cache on the next
+        // measurement. The overlay's Performance section shows its hit / miss / eviction counts for sizing.
+        std::atomic<int> coverage_cache_size{64};
+        // Advanced. Cadence (ms, clamped 0..1000) of the engine-side game-state walks -- active camera, minigame
+        // manager, stance (see poll_game_state). Menu / overlay / aiming are read every frame regardless, and a
+        // menu / overlay edge forces a walk. 0 walks every frame (the old behaviour).
+        std::atomic<int> game_state_poll_ms{50};
+        // Advanced. Render the overlay on a private hardware D3D11 device (no swap chain, never shared with the
+        // game) instead of WARP, with the readback pipelined through a staging ring (see dx_overlay.cpp). Read once
+        // when the overlay thread starts; falls back to WARP if the hardware device cannot be created.
+        std::atomic<bool> overlay_hardware_device{false};
+        // Advanced. Create the WARP device with PREVENT_INTERNAL_THREADING_OPTIMIZATIONS, so the overlay rasterizes
+        // on its own thread instead of a WARP worker pool sized to the machine. Read when the device is created.
+        std::atomic<bool> overlay_warp_single_threaded{true};
+        // Advanced. Win32 priority of the overlay thread, clamped -2 (lowest) .. 0 (normal). Read once at start.
+        std::atomic<int> overlay_thread_priority{-1};
+        // Advanced. Hard affinity mask of the overlay thread (bit n = logical core n, cores 0..31); 0 = any core.
+        // Intersected with the process mask. Read once at start.
+        std::atomic<int> overlay_affinity_mask{0};
+        // Advanced. On a hybrid CPU, prefer the efficiency cores for the overlay thread (a CPU-set preference,
+        // not a hard affinity). Ignored when OverlayAffinityMask is set. Read once at start.
+        std::atomic<bool> overlay_efficiency_cores{false};
+        // Advanced. Seconds the overlay panel must stay closed before its device, render targets, DIB and ImGui
+        // context are released (see dx_overlay.cpp); the next open rebuilds them. 0 keeps them for the session once
+        // the panel has been opened. Live-editable.
+        std::atomic<int> overlay_idle_release_seconds{60};
+        // Advanced. Run each lock-free camera-collision helper under one SEH frame with inline engine calls and
+        // reads instead of a guard per call (see seh_region.hpp); a fault returns that helper's failure value and
+        // falls back to the per-call guards for a while. Live-editable.
+        std::atomic<bool> collision_seh_region{false};
+        // Advanced. Record one fixed-size record per collision frame into a memory-mapped ring file next to the
+        // log (see telemetry.hpp), for replaying a session offline. Live-editable: each start begins a new file.
+        std::atomic<bool> record_telemetry{false};
+        // Advanced. Frames the telemetry ring file holds (128 bytes each, clamped 600..1048576); read when a
+        // recording starts. The default is ten minutes at 60 fps.
+        std::atomic<int> telemetry_frames{36000};
+        // Advanced. Time the collision stage per frame into a world-space grid of 2 m cells around the player (see
+        // collision_heatmap.hpp), drawn in the overlay's Performance section and exportable to CSV. Live-editable.
+        std::atomic<bool> collision_heatmap{false};
+        // Advanced. Helper threads (clamped 0..4) that share the coverage raster of a very large mesh -- a compound
+        // building, a big canopy -- with the render thread (see raster_jobs.hpp). They sleep between such meshes;
+        // smaller meshes are always rasterized inline. Read once at startup; 0 keeps the whole raster inline.
+        std::atomic<int> raster_workers{2};
     };
 
     /** @brief Returns the process-wide live (atomic) settings. */
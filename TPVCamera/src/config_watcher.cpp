@@ -0,0 +1,392 @@
+/**
+ * @file config_watcher.cpp
+ * @brief ReadDirectoryChangesW watcher thread and key-diffed INI reload (see config_watcher.hpp).
+ */
+
+#include "config_watcher.hpp"
+#include "alloc_stats.hpp"
+#include "config.hpp"
+#include "constants.hpp"
+#include "thread_join.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <windows.h>
+
+#include <algorithm>
+#include <cctype>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace TPVCamera::ConfigWatcher
+{
+
+    namespace
+    {
+        // "section.key" (lower-cased: INI names are case-insensitive) -> trimmed value text.
+        using IniValues = std::map<std::string, std::string>;
+
+        // Changed keys named in the reload log line before the rest are summarized as a count.
+        constexpr std::size_t k_logged_keys = 8;
+
+        std::string s_ini_path;
+        std::wstring s_ini_wpath; // full path, for the polling fallback's attribute reads
+        std::wstring s_ini_name;  // file name only, as ReadDirectoryChangesW reports it
+        IniValues s_applied;     // watcher thread only after start()
+        AppliedCallback s_on_applied = nullptr;
+
+        HANDLE s_dir = INVALID_HANDLE_VALUE;
+        HANDLE s_io_event = nullptr;   // manual-reset, owned by the pending ReadDirectoryChangesW
+        HANDLE s_stop_event = nullptr; // manual-reset
+        HANDLE s_thread = nullptr;
+
+        [[nodiscard]] std::wstring widen(const std::string &utf8)
+        {
+            const int n = MultiByteToWideChar(CP_UTF8, 0, utf8.data(), static_cast<int>(utf8.size()), nullptr, 0);
+            std::wstring out(static_cast<std::size_t>(n > 0 ? n : 0), L'\0');
+            if (n > 0)
+            {
+                MultiByteToWideChar(CP_UTF8, 0, utf8.data(), static_cast<int>(utf8.size()), out.data(), n);
+            }
+            return out;
+        }
+
+        [[nodiscard]] std::string_view trim(std::string_view s) noexcept
+        {
+            const auto space = [](char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; };
+            while (!s.empty() && space(s.front()))
+            {
+                s.remove_prefix(1);
+            }
+            while (!s.empty() && space(s.back()))
+            {
+                s.remove_suffix(1);
+            }
+            return s;
+        }
+
+        [[nodiscard]] std::string lower(std::string_view s)
+        {
+            std::string out(s);
+            std::transform(out.begin(), out.end(), out.begin(),
+                           [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+            return out;
+        }
+
+        /// Reads the INI's settings. False if the file cannot be opened (mid-save: the next notification retries).
+        [[nodiscard]] bool read_ini(const std::string &path, IniValues &out)
+        {
+            std::ifstream in(path);
+            if (!in)
+            {
+                return false;
+            }
+            out.clear();
+            std::string section;
+            std::string line;
+            while (std::getline(in, line))
+            {
+                const std::string_view text = trim(line);
+                if (text.empty() || text.front() == ';' || text.front() == '#')
+                {
+                    continue;
+                }
+                if (text.front() == '[')
+                {
+                    const std::size_t close = text.find(']');
+                    section = lower(trim(text.substr(1, close == std::string_view::npos ? text.npos : close - 1)));
+                    continue;
+                }
+                const std::size_t eq = text.find('=');
+                if (eq == std::string_view::npos)
+                {
+                    continue;
+                }
+                out[section + "." + lower(trim(text.substr(0, eq)))] = std::string(trim(text.substr(eq + 1)));
+            }
+            return true;
+        }
+
+        /// Keys whose value differs between @p before and @p after, including added and removed keys.
+        [[nodiscard]] std::vector<std::string> changed_keys(const IniValues &before, const IniValues &after)
+        {
+            std::vector<std::string> changed;
+            for (const auto &[key, value] : after)
+            {
+                const auto it = before.find(key);
+                if (it == before.end() || it->second != value)
+                {
+                    changed.push_back(key);
+                }
+            }
+            for (const auto &[key, value] : before)
+            {
+                if (after.find(key) == after.end())
+                {
+                    changed.push_back(key);
+                }
+            }
+            return changed;
+        }
+
+        void apply_if_changed()
+        {
+            DMK::Logger &logger = DMK::Logger::get_instance();
+            IniValues now;
+            if (!read_ini(s_ini_path, now))
+            {
+                logger.debug("INI reload: {} not readable yet", s_ini_path);
+                return;
+            }
+            const std::vector<std::string> changed = changed_keys(s_applied, now);
+            if (changed.empty())
+            {
+                logger.debug("INI reload: file saved, no setting changed");
+                return;
+            }
+            DMK::Config::load(Constants::get_config_filename());
+            if (s_on_applied != nullptr)
+            {
+                s_on_applied();
+            }
+            settings().settings_version.fetch_add(1, std::memory_order_release);
+            s_applied = std::move(now);
+
+            std::string names;
+            for (std::size_t i = 0; i < changed.size() && i < k_logged_keys; ++i)
+            {
+                names += (i == 0) ? "" : ", ";
+                names += changed[i];
+            }
+            if (changed.size() > k_logged_keys)
+            {
+                names += ", +" + std::to_string(changed.size() - k_logged_keys) + " more";
+            }
+            logger.info("INI reload: {} setting(s) changed ({}); live settings applied", changed.size(), names);
+        }
+
+        /// The INI's last-write time (FILETIME ticks), or 0 while it cannot be read.
+        [[nodiscard]] ULONGLONG ini_write_time() noexcept
+        {
+            WIN32_FILE_ATTRIBUTE_DATA data{};
+            if (!GetFileAttributesExW(s_ini_wpath.c_str(), GetFileExInfoStandard, &data))
+            {
+                return 0;
+            }
+            return (ULONGLONG{data.ftLastWriteTime.dwHighDateTime} << 32) | data.ftLastWriteTime.dwLowDateTime;
+        }
+
+        /// Fallback once change notifications fail on the watcher thread: checks the INI's write time every
+        /// k_poll_ms, as DMK's auto-reload did, and sends a change through the same key diff. Returns on stop().
+        void poll_loop()
+        {
+            DMK::Logger &logger = DMK::Logger::get_instance();
+            ULONGLONG seen = ini_write_time();
+            while (WaitForSingleObject(s_stop_event, k_poll_ms) == WAIT_TIMEOUT)
+            {
+                const ULONGLONG now = ini_write_time();
+                if (now == seen || now == 0)
+                {
+                    continue;
+                }
+                seen = now;
+                try
+                {
+                    apply_if_changed();
+                }
+                catch (const std::exception &e)
+                {
+                    logger.warning("INI reload failed: {}", e.what());
+                }
+            }
+        }
+
+        /// Whether the notification batch names the INI. An empty batch (the buffer overflowed) counts as yes.
+        [[nodiscard]] bool mentions_ini(const unsigned char *buffer, DWORD bytes) noexcept
+        {
+            if (bytes == 0)
+            {
+                return true;
+            }
+            DWORD offset = 0;
+            for (;;)
+            {
+                const auto *info = reinterpret_cast<const FILE_NOTIFY_INFORMATION *>(buffer + offset);
+                const int len = static_cast<int>(info->FileNameLength / sizeof(WCHAR));
+                if (CompareStringOrdinal(info->FileName, len, s_ini_name.c_str(), static_cast<int>(s_ini_name.size()),
+                                         TRUE) == CSTR_EQUAL)
+                {
+                    return true;
+                }
+                if (info->NextEntryOffset == 0)
+                {
+                    return false;
+                }
+                offset += info->NextEntryOffset;
+            }
+        }
+
+        DWORD WINAPI watch_thread(LPVOID)
+        {
+            AllocStats::set_thread_tag(AllocStats::AllocTag::Workers);
+            DMK::Logger &logger = DMK::Logger::get_instance();
+            alignas(DWORD) unsigned char buffer[16 * 1024];
+            OVERLAPPED ov{};
+            ov.hEvent = s_io_event;
+            bool armed = false;         // a ReadDirectoryChangesW is outstanding
+            bool poll = false;          // notifications failed: fall back to polling once the read is cancelled
+            ULONGLONG apply_at = 0;     // GetTickCount64 deadline of the coalesced reload; 0 = none pending
+            constexpr DWORD k_filter = FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE |
+                                       FILE_NOTIFY_CHANGE_FILE_NAME;
+            for (;;)
+            {
+                if (!armed)
+                {
+                    if (!ReadDirectoryChangesW(s_dir, buffer, sizeof(buffer), FALSE, k_filter, nullptr, &ov, nullptr))
+                    {
+                        logger.warning("INI watcher: ReadDirectoryChangesW failed (error {}); polling every {} ms",
+                                       GetLastError(), k_poll_ms);
+                        poll = true;
+                        break;
+                    }
+                    armed = true;
+                }
+                DWORD timeout = INFINITE;
+                if (apply_at != 0)
+                {
+                    const ULONGLONG now = GetTickCount64();
+                    timeout = (now >= apply_at) ? 0 : static_cast<DWORD>(apply_at - now);
+                }
+                const HANDLE waits[2] = {s_stop_event, s_io_event};
+                const DWORD r = WaitForMultipleObjects(2, waits, FALSE, timeout);
+                if (r == WAIT_OBJECT_0)
+                {
+                    break;
+                }
+                if (r == WAIT_TIMEOUT)
+                {
+                    apply_at = 0;
+                    try
+                    {
+                        apply_if_changed();
+                    }
+                    catch (const std::exception &e)
+                    {
+                        logger.warning("INI reload failed: {}", e.what());
+                    }
+                    continue;
+                }
+                if (r != WAIT_OBJECT_0 + 1)
+                {
+                    logger.warning("INI watcher: wait failed (error {}); polling every {} ms", GetLastError(),
+                                   k_poll_ms);
+                    poll = true;
+                    break;
+                }
+                armed = false;
+                DWORD bytes = 0;
+                if (!GetOverlappedResult(s_dir, &ov, &bytes, FALSE))
+                {
+                    continue;
+                }
+                // Every notification naming the INI restarts the quiet window, so one save burst is one reload;
+                // writes to other files in the directory (the log) neither trigger nor postpone it.
+                if (mentions_ini(buffer, bytes))
+                {
+                    apply_at = GetTickCount64() + k_coalesce_ms;
+                }
+            }
+            if (armed)
+            {
+                DWORD bytes = 0;
+                CancelIoEx(s_dir, &ov);
+                GetOverlappedResult(s_dir, &ov, &bytes, TRUE);
+            }
+            if (poll)
+            {
+                poll_loop();
+            }
+            return 0;
+        }
+
+        void close_handles() noexcept
+        {
+            if (s_dir != INVALID_HANDLE_VALUE)
+            {
+                CloseHandle(s_dir);
+                s_dir = INVALID_HANDLE_VALUE;
+            }
+            if (s_io_event != nullptr)
+            {
+                CloseHandle(s_io_event);
+                s_io_event = nullptr;
+            }
+            if (s_stop_event != nullptr)
+            {
+                CloseHandle(s_stop_event);
+                s_stop_event = nullptr;
+            }
+        }
+    } // namespace
+
+    bool start(const std::string &ini_path, AppliedCallback on_applied)
+    {
+        if (s_thread != nullptr)
+        {
+            return true;
+        }
+        s_on_applied = on_applied;
+        const std::size_t slash = ini_path.find_last_of("\\/");
+        if (slash == std::string::npos)
+        {
+            return false;
+        }
+        s_ini_path = ini_path;
+        s_ini_wpath = widen(ini_path);
+        s_ini_name = widen(ini_path.substr(slash + 1));
+        if (!read_ini(s_ini_path, s_applied))
+        {
+            s_applied.clear(); // no INI yet: the first one written is all changes
+        }
+
+        s_dir = CreateFileW(widen(ini_path.substr(0, slash)).c_str(), FILE_LIST_DIRECTORY,
+                            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                            FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+        s_io_event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        s_stop_event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        if (s_dir == INVALID_HANDLE_VALUE || s_io_event == nullptr || s_stop_event == nullptr)
+        {
+            close_handles();
+            return false;
+        }
+        s_thread = CreateThread(nullptr, 0, watch_thread, nullptr, 0, nullptr);
+        if (s_thread == nullptr)
+        {
+            close_handles();
+            return false;
+        }
+        return true;
+    }
+
+    void stop() noexcept
+    {
+        if (s_thread == nullptr)
+        {
+            return;
+        }
+        SetEvent(s_stop_event);
+        // A reload in progress is one INI parse; on a timeout leave the thread its handles and keep the module
+        // pinned under it, as for the collision worker.
+        if (!join_or_pin(s_thread, 2000, "Config watcher"))
+        {
+            return;
+        }
+        s_thread = nullptr;
+        close_handles();
+    }
+
+} // namespace TPVCamera::ConfigWatcher
@@ -0,0 +1,56 @@
+/**
+ * @file config_watcher.hpp
+ * @brief Change-notification INI hot reload (replaces DMK's 250 ms auto-reload poll).
+ *
+ * @details DMK::Config::enable_auto_reload stats the INI four times a second for the whole session. The watcher
+ *          instead parks one thread on an overlapped ReadDirectoryChangesW of the INI's directory, so nothing runs
+ *          until a file there is written. A burst of notifications for the INI (an editor's save is typically a
+ *          truncate + write + attribute touch, or a temp file renamed over it) is coalesced until the directory has
+ *          been quiet for k_coalesce_ms, then the INI alone is read and compared key by key with the last applied
+ *          copy. Only a change to a setting's value re-runs DMK::Config::load -- a comment or whitespace edit does
+ *          not -- and the reload logs which keys changed. Other files in the directory (the preset store, which
+ *          the mod rewrites itself, the log, the anchor cache) are ignored.
+ *
+ *          DMK::Config::load applies every registered setting from the file, so an unchanged setting's setter
+ *          stores the value it already holds; the key diff is what keeps comment / formatting edits and repeated
+ *          saves of an unchanged file from republishing at all.
+ *
+ *          start() only opens the directory; a filesystem that accepts the handle but not the watch (some network
+ *          shares), or a watch that fails later, fails on the watcher thread. That thread then falls back to
+ *          checking the INI's write time every k_poll_ms, like the DMK poll, with the same key diff.
+ *
+ *          Threading: start() / stop() from the init / shutdown thread; the reload runs on the watcher thread,
+ *          as DMK's auto-reload did on its own.
+ */
+#ifndef TPVCAMERA_CONFIG_WATCHER_HPP
+#define TPVCAMERA_CONFIG_WATCHER_HPP
+
+#include <string>
+
+namespace TPVCamera::ConfigWatcher
+{
+
+    /// Quiet time after the last INI notification before the file is re-read.
+    inline constexpr unsigned long k_coalesce_ms = 100;
+
+    /// INI write-time check interval once change notifications have failed on the watcher thread.
+    inline constexpr unsigned long k_poll_ms = 250;
+
+    /// Called on the watcher thread after a reload applied the new values, before settings_version moves.
+    using AppliedCallback = void (*)();
+
+    /**
+     * @brief Starts watching @p ini_path (a full path) and reloading it on change.
+     * @details Takes the file's current contents as the applied baseline (init has just loaded it).
+     * @param on_applied Optional; runs after each reload that changed a setting, before settings_version is
+     *        bumped, so what it sets up is in place when the render thread sees the new settings.
+     * @return False if the directory cannot be watched; the caller then falls back to DMK's polling reload.
+     */
+    [[nodiscard]] bool start(const std::string &ini_path, AppliedCallback on_applied = nullptr);
+
+    /** @brief Stops and joins the watcher thread. Safe if it never started. */
+    void stop() noexcept;
+
+} // namespace TPVCamera::ConfigWatcher
+
+#endif // TPVCAMERA_CONFIG_WATCHER_HPP
@@ -31,6 +31,9 @@ namespace Constants
     // File extensions
     constexpr const char *INI_FILE_EXTENSION = ".ini";
     constexpr const char *PRESETS_FILE_SUFFIX = "_presets.json";
+    constexpr const char *PRESETS_BINARY_FILE_SUFFIX = "_presets.bin";
+    constexpr const char *ANCHOR_CACHE_FILE_SUFFIX = "_anchors.cache";
+    constexpr const char *OCCLUDER_DB_FILE_SUFFIX = "_occluders.db";
 
     /** @brief Gets the INI config filename (e.g., "KCD2_TPVCamera.ini"). */
     [[nodiscard]] inline std::string get_config_filename()
@@ -44,6 +47,24 @@ namespace Constants
         return std::string(MOD_NAME) + PRESETS_FILE_SUFFIX;
     }
 
+    /** @brief Gets the binary preset store filename (e.g., "KCD2_TPVCamera_presets.bin"). */
+    [[nodiscard]] inline std::string get_presets_binary_filename()
+    {
+        return std::string(MOD_NAME) + PRESETS_BINARY_FILE_SUFFIX;
+    }
+
+    /** @brief Gets the per-game-build anchor cache filename (e.g., "KCD2_TPVCamera_anchors.cache"). */
+    [[nodiscard]] inline std::string get_anchor_cache_filename()
+    {
+        return std::string(MOD_NAME) + ANCHOR_CACHE_FILE_SUFFIX;
+    }
+
+    /** @brief Gets the brush mesh database filename (e.g., "KCD2_TPVCamera_occluders.db"). */
+    [[nodiscard]] inline std::string get_occluder_db_filename()
+    {
+        return std::string(MOD_NAME) + OCCLUDER_DB_FILE_SUFFIX;
+    }
+
     /** @brief Log file name passed to DMK::Bootstrap (string-view-safe literal). */
     constexpr const char *LOG_FILE_NAME = "KCD2_TPVCamera.log";
     /** @brief Per-PID instance-mutex prefix so duplicate ASI loads bail cleanly. */
@@ -232,6 +253,14 @@ namespace Constants
     constexpr int PHYS_FOREIGN_ID_STATIC = 1;
     // Max thin props the camera-collision coverage walk steps through (skip + re-cast) before giving up.
     constexpr int COVERAGE_SKIP_MAX = 8;
+    // Collision LOD (select_collision_lod, camera_hook.cpp): the smoothed angular speed of the pivot->camera arm
+    // (rad/s) above which the collision probes drop to CollisionLod::Medium / Coarse, and the follow distance (m)
+    // beyond which they drop to Medium. A level is only left again once its input falls below
+    // COLLISION_LOD_HYSTERESIS x the threshold, so a speed or zoom sitting on a threshold does not flap.
+    constexpr float COLLISION_LOD_MEDIUM_SPEED = 1.5f; // ~85 deg/s: a brisk orbit
+    constexpr float COLLISION_LOD_COARSE_SPEED = 4.0f; // ~230 deg/s: a whip / flick
+    constexpr float COLLISION_LOD_MEDIUM_DISTANCE = 4.0f;
+    constexpr float COLLISION_LOD_HYSTERESIS = 0.85f;
     // When the physics hit carries no render-node link (a merged / proxy collider, e.g. a shed roof or a
     // columbarium), the visible brush at the hit is found by GetObjectsInBox. A brush's BBOX containing the hit
     // is NOT enough (a nearby laundry line / designer brush bbox can contain a point on a building's roof), so a
@@ -428,6 +457,18 @@ namespace Constants
     // from the last query; in between, the clamp is recomputed cheaply from the cached roof world-Z. Cuts
     // the per-frame cost to ~zero while standing still and avoids re-decoding the position cache each frame.
     constexpr float RENDER_OCCLUSION_REQUERY_DIST = 0.40f;
+    // Render-node region cache: the octree is queried once for a box padded by RENDER_REGION_PAD (meters) around
+    // the requested one, and later sightline / hit-point queries that fall INSIDE that region are answered from a
+    // local BVH over the returned node AABBs instead of GetObjectsInBox. The region is dropped after
+    // RENDER_REGION_MAX_AGE_MS so brushes streamed in or out are picked up without the camera having to move.
+    constexpr float RENDER_REGION_PAD = 4.0f;
+    constexpr unsigned long long RENDER_REGION_MAX_AGE_MS = 2000;
+    // Predictive region prefetch (prefetch_render_region): the arm is extrapolated this many frames ahead, a region
+    // in use (queried within RENDER_PREFETCH_IN_USE_MS) is rebuilt once the predicted arm would leave it or once it
+    // is within RENDER_PREFETCH_AGE_LEAD_MS of ageing out, so the rebuild lands ahead of the query that needs it.
+    constexpr float RENDER_PREFETCH_FRAMES = 2.0f;
+    constexpr unsigned long long RENDER_PREFETCH_IN_USE_MS = 500;
+    constexpr unsigned long long RENDER_PREFETCH_AGE_LEAD_MS = 250;
 
     // --- Camera-space interaction (door/usable look-at ray redirect) ---
     // The player interactor (wh::entitymodule::C_PlayerInteractor) selects the "press to use" target by
@@ -618,7 +659,8 @@ namespace Constants
     constexpr ptrdiff_t CCAMERA_CULL_EDGE_4_OFFSET = 0x70;
 
     // Hide-head flag mirrored on the player entity (relative to the entity passed to the
-    // head-visibility setter); read to re-assert the head while the offset is active.
+    // head-visibility setter). The hook no longer polls it -- the setter detour is authoritative --
+    // but the layout is kept for diagnostics.
     constexpr ptrdiff_t OFFSET_ENTITY_HIDE_HEAD_FLAG = 0xA38;
 
     // --- Input Event Offsets ---
@@ -0,0 +1,183 @@
+/**
+ * @file coverage_cache.cpp
+ * @brief Storage, hashing and LRU eviction for the collider coverage cache (see coverage_cache.hpp).
+ */
+
+#include "coverage_cache.hpp"
+#include "config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+namespace TPVCamera::CoverageCache
+{
+
+    namespace
+    {
+        constexpr std::uint32_t k_min_capacity = 16;
+        constexpr std::uint32_t k_max_capacity = 4096;
+        constexpr float k_cell_rad = 5.0f * std::numbers::pi_v<float> / 180.0f;
+
+        // Struct-of-arrays table. s_collider == 0 marks an empty slot (collider 0 is never cached).
+        std::vector<std::uintptr_t> s_collider;
+        std::vector<std::uint32_t> s_cell;
+        std::vector<std::uint32_t> s_stamp; // last-use tick; the smallest in a window is the LRU victim
+        std::vector<Record> s_payload;
+        std::uint32_t s_mask = 0; // capacity - 1 (power of two); 0 = not allocated
+        std::uint32_t s_tick = 0;
+        std::uint32_t s_occupied = 0;
+        int s_configured = -1; // CoverageCacheSize the table was sized for
+
+        std::atomic<std::uint64_t> s_hits{0};
+        std::atomic<std::uint64_t> s_misses{0};
+        std::atomic<std::uint64_t> s_evictions{0};
+        std::atomic<std::uint32_t> s_capacity_pub{0};
+        std::atomic<std::uint32_t> s_occupied_pub{0};
+
+        std::uint32_t home_slot(std::uintptr_t collider, std::uint32_t cell) noexcept
+        {
+            // Physics entities are 16-byte aligned; fold the pointer and the cell, then a Fibonacci mix.
+            std::uint64_t h = (static_cast<std::uint64_t>(collider) >> 4) ^ (static_cast<std::uint64_t>(cell) << 40);
+            h *= 0x9E3779B97F4A7C15ull;
+            return static_cast<std::uint32_t>(h >> 32) & s_mask;
+        }
+
+        std::uint32_t next_tick() noexcept
+        {
+            if (++s_tick == 0)
+            {
+                // Wrapped (after ~4e9 lookups): restart the ages so the LRU order stays monotonic.
+                std::fill(s_stamp.begin(), s_stamp.end(), 0u);
+                s_tick = 1;
+            }
+            return s_tick;
+        }
+    } // namespace
+
+    std::uint32_t view_cell(const Vector3 &hit_point, const Vector3 &camera) noexcept
+    {
+        const Vector3 d = camera - hit_point;
+        const float yaw = std::atan2(d.y, d.x) + std::numbers::pi_v<float>; // 0..2pi
+        const float pitch =
+            std::atan2(d.z, std::sqrt(d.x * d.x + d.y * d.y)) + 0.5f * std::numbers::pi_v<float>; // 0..pi
+        const auto yaw_i = static_cast<std::uint32_t>(yaw / k_cell_rad);
+        const auto pitch_i = static_cast<std::uint32_t>(pitch / k_cell_rad);
+        return (yaw_i << 8) | (pitch_i & 0xFFu);
+    }
+
+    void sync_capacity() noexcept
+    {
+        const int configured = settings().coverage_cache_size.load(std::memory_order_relaxed);
+        if (configured == s_configured && s_mask != 0)
+        {
+            return;
+        }
+        s_configured = configured;
+        std::uint32_t cap = k_min_capacity;
+        while (cap < static_cast<std::uint32_t>(std::clamp<int>(configured, 1, k_max_capacity)))
+        {
+            cap <<= 1;
+        }
+        try
+        {
+            s_collider.assign(cap, 0);
+            s_cell.assign(cap, 0);
+            s_stamp.assign(cap, 0);
+            s_payload.assign(cap, Record{});
+        }
+        catch (...)
+        {
+            s_mask = 0;
+            s_capacity_pub.store(0, std::memory_order_relaxed);
+            return;
+        }
+        s_mask = cap - 1;
+        s_tick = 0;
+        s_occupied = 0;
+        s_hits.store(0, std::memory_order_relaxed);
+        s_misses.store(0, std::memory_order_relaxed);
+        s_evictions.store(0, std::memory_order_relaxed);
+        s_capacity_pub.store(cap, std::memory_order_relaxed);
+        s_occupied_pub.store(0, std::memory_order_relaxed);
+    }
+
+    Record *find(std::uintptr_t collider, std::uint32_t cell) noexcept
+    {
+        if (collider == 0 || s_mask == 0)
+        {
+            return nullptr;
+        }
+        std::uint32_t i = home_slot(collider, cell);
+        for (std::uint32_t n = 0; n < k_probe_window; ++n, i = (i + 1) & s_mask)
+        {
+            if (s_collider[i] == 0)
+            {
+                return nullptr; // slots are never emptied, so the key cannot lie past an empty one
+            }
+            if (s_collider[i] == collider && s_cell[i] == cell)
+            {
+                s_stamp[i] = next_tick();
+                return &s_payload[i];
+            }
+        }
+        return nullptr;
+    }
+
+    Record *insert(std::uintptr_t collider, std::uint32_t cell) noexcept
+    {
+        if (collider == 0 || s_mask == 0)
+        {
+            return nullptr;
+        }
+        std::uint32_t i = home_slot(collider, cell);
+        std::uint32_t victim = i;
+        for (std::uint32_t n = 0; n < k_probe_window; ++n, i = (i + 1) & s_mask)
+        {
+            if (s_collider[i] == collider && s_cell[i] == cell)
+            {
+                s_stamp[i] = next_tick();
+                return &s_payload[i];
+            }
+            if (s_collider[i] == 0)
+            {
+                victim = i;
+                ++s_occupied;
+                s_occupied_pub.store(s_occupied, std::memory_order_relaxed);
+                break;
+            }
+            if (s_stamp[i] < s_stamp[victim])
+            {
+                victim = i;
+            }
+            if (n + 1 == k_probe_window)
+            {
+                s_evictions.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        s_collider[victim] = collider;
+        s_cell[victim] = cell;
+        s_stamp[victim] = next_tick();
+        s_payload[victim] = Record{};
+        return &s_payload[victim];
+    }
+
+    void count_lookup(bool hit) noexcept
+    {
+        (hit ? s_hits : s_misses).fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Stats stats() noexcept
+    {
+        Stats out{};
+        out.hits = s_hits.load(std::memory_order_relaxed);
+        out.misses = s_misses.load(std::memory_order_relaxed);
+        out.evictions = s_evictions.load(std::memory_order_relaxed);
+        out.capacity = s_capacity_pub.load(std::memory_order_relaxed);
+        out.occupied = s_occupied_pub.load(std::memory_order_relaxed);
+        return out;
+    }
+
+} // namespace TPVCamera::CoverageCache
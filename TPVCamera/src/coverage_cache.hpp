@@ -0,0 +1,105 @@
+/**
+ * @file coverage_cache.hpp
+ * @brief Fixed-capacity hashed LRU cache of measured collider coverage for the camera's coverage walk.
+ *
+ * @details measure_collider_coverage (camera_hook.cpp) caches, per collider, how much of the character the hit
+ *          collider hides -- re-measuring costs a render-mesh raster, or worse the octree query the ray fallback
+ *          needs (GetObjectsInBox, ~110 us). Dense scenes (market stalls, scaffolding, forests) cycle through far
+ *          more colliders than a handful of slots while the camera orbits, so the cache is an open-addressing table
+ *          sized by [Advanced] CoverageCacheSize.
+ *
+ *          Two kinds of record share the table, both keyed by (collider, cell):
+ *          - cell == k_collider_cell: the collider-wide record -- the resolved render node (so an angle re-measure
+ *            skips the octree), the low-passed head fill, and an UNMEASURABLE (< 0) verdict, which is solid from
+ *            every angle and reused freely.
+ *          - cell == view_cell(hit, camera): a measured coverage (0..1) from one quantized camera direction around
+ *            the hit point. Coverage is angle-dependent (a pole with a wide head covers the body only from some
+ *            angles), so it is reused only from the same direction cell.
+ *
+ *          Layout is struct-of-arrays: a probe walks only the packed key / stamp arrays; the payload is touched
+ *          once the key matches. A probe visits at most k_probe_window slots from the hash; an insert into a full
+ *          window evicts the least recently used slot in it (records are only ever overwritten, never removed, so
+ *          a lookup may stop at the first empty slot). Render-thread only, except stats(), whose counters are
+ *          relaxed atomics the overlay reads.
+ */
+#ifndef TPVCAMERA_COVERAGE_CACHE_HPP
+#define TPVCAMERA_COVERAGE_CACHE_HPP
+
+#include "math_utils.hpp"
+
+#include <cstdint>
+
+namespace TPVCamera::CoverageCache
+{
+
+    /// Cell id of the collider-wide record (never produced by view_cell).
+    inline constexpr std::uint32_t k_collider_cell = 0xFFFFFFFFu;
+
+    /// Slots probed from the hash before an insert evicts the least recently used one.
+    inline constexpr std::uint32_t k_probe_window = 8;
+
+    /**
+     * @struct Record
+     * @brief Payload of one cache slot.
+     */
+    struct Record
+    {
+        /// Coverage 0..1, or < 0 for an unmeasurable solid (collider-wide record only).
+        float m_cov = -1.0f;
+        /// HEAD-band fill (low-passed on the collider-wide record); -1 = n/a.
+        float m_head = -1.0f;
+        /// Hit point the record was measured at (a far-moved hit is new geometry: re-measure).
+        Vector3 m_hit{};
+        /// Octree-resolved render node of the collider (collider-wide record only); nullptr = none.
+        void *m_node = nullptr;
+    };
+
+    /**
+     * @brief Quantized direction from @p hit_point to @p camera (yaw x pitch cells of about 5 degrees).
+     * @details About 0.26 m of camera travel at a 3 m arm, the camera-move tolerance the fixed cache used.
+     */
+    [[nodiscard]] std::uint32_t view_cell(const Vector3 &hit_point, const Vector3 &camera) noexcept;
+
+    /**
+     * @brief Sizes (and on a change, clears) the table for [Advanced] CoverageCacheSize.
+     * @details The only place the table is reallocated, so it must run where no Record pointer is held: the camera
+     *          detour calls it at the start of the collision stage, before any find() / insert().
+     */
+    void sync_capacity() noexcept;
+
+    /**
+     * @brief Looks up (@p collider, @p cell) and marks it most recently used.
+     * @return The record, or nullptr on a miss (or before sync_capacity() allocated the table). Valid until the next
+     *         insert() or sync_capacity().
+     */
+    [[nodiscard]] Record *find(std::uintptr_t collider, std::uint32_t cell) noexcept;
+
+    /**
+     * @brief Returns the slot for (@p collider, @p cell): the existing one, else an empty one, else the least
+     *        recently used slot of the probe window (evicted and reset to a default Record).
+     * @return nullptr only when the table is not allocated.
+     */
+    [[nodiscard]] Record *insert(std::uintptr_t collider, std::uint32_t cell) noexcept;
+
+    /** @brief Counts one measure_collider_coverage lookup as served from the cache or not. */
+    void count_lookup(bool hit) noexcept;
+
+    /**
+     * @struct Stats
+     * @brief Counters since the last resize (a capacity change clears the table and the counters).
+     */
+    struct Stats
+    {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t evictions = 0;
+        std::uint32_t capacity = 0;
+        std::uint32_t occupied = 0;
+    };
+
+    /** @brief Snapshot of the counters. Safe from any thread. */
+    [[nodiscard]] Stats stats() noexcept;
+
+} // namespace TPVCamera::CoverageCache
+
+#endif // TPVCAMERA_COVERAGE_CACHE_HPP
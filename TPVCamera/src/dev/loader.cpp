@@ -12,11 +12,17 @@
  *
  *          The staging hand-off is what lets a rebuild land while the game holds
  *          the previous logic DLL open: the build never writes the loaded file,
- *          only staging/. The loader links nothing but Win32 and logs through
+ *          only staging/. Across a reload the loader also keeps the state block
+ *          (state_handoff.hpp): the outgoing logic's SaveState() fills it before
+ *          Shutdown(), and the incoming logic's InitWithState() adopts it, so the
+ *          swap skips the anchor resolve and resumes the live camera state.
+ *          The loader links nothing but Win32 and logs through
  *          OutputDebugStringA, so it stays a thin stub (no DetourModKit, no
  *          file I/O, no C++ exceptions on the hot path).
  */
 
+#include "state_handoff.hpp"
+
 #include <Windows.h>
 
 #include <atomic>
@@ -45,6 +51,14 @@ namespace
 
     InitFn s_fn_init = nullptr;
     ShutdownFn s_fn_shutdown = nullptr;
+    // Optional state-handoff exports (absent in an older logic build: plain Init / Shutdown).
+    TPVCamera::Handoff::SaveStateFn s_fn_save_state = nullptr;
+    TPVCamera::Handoff::InitWithStateFn s_fn_init_with_state = nullptr;
+
+    // Loader-owned handoff block, allocated on the first reload and kept for the process; s_handoff_size > 0
+    // while it holds a saved state the next load has not consumed yet.
+    void *s_handoff = nullptr;
+    std::uint32_t s_handoff_size = 0;
 
     void log_msg(const char *msg) noexcept
     {
@@ -124,6 +138,10 @@ namespace
 
         s_fn_init = reinterpret_cast<InitFn>(GetProcAddress(s_logic_dll, "Init"));
         s_fn_shutdown = reinterpret_cast<ShutdownFn>(GetProcAddress(s_logic_dll, "Shutdown"));
+        s_fn_save_state =
+            reinterpret_cast<TPVCamera::Handoff::SaveStateFn>(GetProcAddress(s_logic_dll, "SaveState"));
+        s_fn_init_with_state =
+            reinterpret_cast<TPVCamera::Handoff::InitWithStateFn>(GetProcAddress(s_logic_dll, "InitWithState"));
         if (!s_fn_init || !s_fn_shutdown)
         {
             log_msg("Logic DLL missing Init/Shutdown exports");
@@ -131,18 +149,28 @@ namespace
             s_logic_dll = nullptr;
             s_fn_init = nullptr;
             s_fn_shutdown = nullptr;
+            s_fn_save_state = nullptr;
+            s_fn_init_with_state = nullptr;
             return false;
         }
 
-        if (!s_fn_init())
+        // The saved state is consumed by this load either way: a second attempt starts clean.
+        const bool with_state = s_fn_init_with_state && s_handoff_size > 0;
+        const bool initialized = with_state ? s_fn_init_with_state(s_handoff, s_handoff_size) : s_fn_init();
+        s_handoff_size = 0;
+        if (!initialized)
         {
             log_msg("Logic DLL Init() returned false");
             FreeLibrary(s_logic_dll);
             s_logic_dll = nullptr;
             s_fn_init = nullptr;
             s_fn_shutdown = nullptr;
+            s_fn_save_state = nullptr;
+            s_fn_init_with_state = nullptr;
             return false;
         }
+        if (with_state)
+            log_msg("Logic DLL adopted the handed-off state");
 
         log_msg("Logic DLL loaded and initialized");
         return true;
@@ -167,6 +195,17 @@ namespace
         if (!s_logic_dll)
             return;
 
+        // Capture the live state while the logic is still running, then shut it down. The block is plain
+        // committed memory owned here, so it outlives the FreeLibrary below.
+        if (s_fn_save_state)
+        {
+            if (!s_handoff)
+                s_handoff = VirtualAlloc(nullptr, TPVCamera::Handoff::k_block_capacity, MEM_COMMIT | MEM_RESERVE,
+                                         PAGE_READWRITE);
+            if (s_handoff)
+                s_handoff_size = s_fn_save_state(s_handoff, TPVCamera::Handoff::k_block_capacity);
+        }
+
         request_logic_shutdown();
 
         // Shutdown() removed every hook, so no new detour entry can occur. A game
@@ -180,6 +219,8 @@ namespace
         s_logic_dll = nullptr;
         s_fn_init = nullptr;
         s_fn_shutdown = nullptr;
+        s_fn_save_state = nullptr;
+        s_fn_init_with_state = nullptr;
         log_msg("Logic DLL unloaded");
     }
 
@@ -7,13 +7,15 @@
  *          Init() after LoadLibrary and Shutdown() before FreeLibrary. Because
  *          there is no DMK::Bootstrap in this path, Init() configures the logger
  *          itself and Shutdown() runs DMK_Shutdown() so each reload starts from a
- *          clean DetourModKit state.
+ *          clean DetourModKit state. SaveState() / InitWithState() carry the live
+ *          state across a reload (see state_handoff.hpp).
  */
 
 #ifdef TPVCAMERA_DEV_BUILD
 
 #include "tpv_camera.hpp"
 #include "constants.hpp"
+#include "dev/state_handoff.hpp"
 
 #include <DetourModKit.hpp>
 
@@ -48,6 +50,28 @@ extern "C" __declspec(dllexport) bool Init() noexcept
     }
 }
 
+extern "C" __declspec(dllexport) bool InitWithState(const void *block, std::uint32_t size) noexcept
+{
+    // Staging only copies PODs out of the loader's block (no logging: the logger is configured by Init()); the
+    // normal init then adopts each staged section whose inputs are unchanged.
+    TPVCamera::Handoff::stage_state(block, size);
+    return Init();
+}
+
+extern "C" __declspec(dllexport) std::uint32_t SaveState(void *block, std::uint32_t capacity) noexcept
+{
+    // Called by the loader before Shutdown(), while the mod is still live. Same boundary rule as Init().
+    try
+    {
+        return TPVCamera::Handoff::save_state(block, capacity);
+    }
+    catch (...)
+    {
+        OutputDebugStringA("[KCD2_TPVCamera][DEV] SaveState() threw an exception; no state handed off\n");
+        return 0;
+    }
+}
+
 extern "C" __declspec(dllexport) void Shutdown() noexcept
 {
     // The loader calls this through a C function pointer (void(__cdecl *)()), so an exception must
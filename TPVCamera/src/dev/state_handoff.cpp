@@ -0,0 +1,343 @@
+/**
+ * @file dev/state_handoff.cpp
+ * @brief Logic-DLL side of the dev hot-reload state handoff: section payloads, save and adoption.
+ *
+ * @details Deliberately NOT handed off: the coverage cache, the render-occlusion region and the collision
+ *          throttle / governor / LOD history. They are derived from the collision code a reload is usually there
+ *          to change, so the incoming build re-measures them (each refills within a few frames). The resolved
+ *          C_Player chain is re-walked on the first frame for the same reason it is cached per session only.
+ *          Hooks are always reinstalled: their detours live in the outgoing DLL's image.
+ */
+
+#ifdef TPVCAMERA_DEV_BUILD
+
+#include "dev/state_handoff.hpp"
+#include "aob_resolver.hpp"
+#include "global_state.hpp"
+#include "offset_heal.hpp"
+#include "presets/preset_store.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <cstring>
+#include <optional>
+#include <utility>
+
+namespace TPVCamera::Handoff
+{
+
+    namespace
+    {
+        constexpr char k_magic[4] = {'T', 'P', 'V', 'H'};
+        constexpr std::size_t k_anchor_count = static_cast<std::size_t>(AnchorId::Count);
+
+        // ---- Section payloads. Bump a payload's version whenever its layout changes. ----
+
+        constexpr std::uint32_t k_anchors_version = 1;
+        struct AnchorsPayload
+        {
+            std::uint64_t module_base;
+            std::uint64_t module_size;
+            std::uint32_t table_hash; // anchor_table_hash() of the build that resolved them
+            std::uint32_t count;      // AnchorId::Count of that build
+            std::uint64_t address[k_anchor_count];
+        };
+
+        constexpr std::uint32_t k_offsets_version = 1;
+        struct OffsetsPayload
+        {
+            std::uint64_t module_base;
+            std::uint32_t groups;
+            std::uint32_t count; // k_runtime_offset_count of that build
+            std::int64_t value[k_runtime_offset_count];
+        };
+
+        constexpr std::uint32_t k_camera_version = 1;
+        struct CameraPayload
+        {
+            float orbit_yaw;
+            float orbit_pitch;
+            float zoom_offset;
+            float view_blend;
+            float collision_distance;
+            std::uint8_t applying;
+            std::uint8_t orbit_active;
+            std::uint8_t collision_valid;
+            std::uint8_t reserved;
+        };
+
+        constexpr std::uint32_t k_preset_editor_version = 1;
+        struct PresetEditorPayload
+        {
+            std::int32_t editing_index;
+            std::uint8_t pinned;
+            std::uint8_t reserved[3];
+        };
+
+        // Staged by stage_state() on the loader thread before init(), consumed once by the adopt_* calls.
+        std::optional<AnchorsPayload> s_anchors;
+        std::optional<OffsetsPayload> s_offsets;
+        std::optional<CameraPayload> s_camera;
+        std::optional<PresetEditorPayload> s_preset_editor;
+
+        [[nodiscard]] constexpr std::uint32_t align8(std::uint32_t n) noexcept
+        {
+            return (n + 7u) & ~7u;
+        }
+
+        /// Appends sections to the loader's block, refusing (and remembering) any that would overflow it.
+        class BlockWriter
+        {
+        public:
+            BlockWriter(void *block, std::uint32_t capacity) noexcept
+                : m_base(static_cast<unsigned char *>(block)), m_capacity(capacity)
+            {
+            }
+
+            template <typename T>
+            void add(Tag tag, std::uint32_t version, const T &payload) noexcept
+            {
+                const std::uint32_t need = static_cast<std::uint32_t>(sizeof(SectionHeader) + align8(sizeof(T)));
+                if (m_used + need > m_capacity)
+                {
+                    m_overflow = true;
+                    return;
+                }
+                const SectionHeader section{static_cast<std::uint32_t>(tag), version, sizeof(T), 0};
+                std::memcpy(m_base + m_used, &section, sizeof(section));
+                std::memcpy(m_base + m_used + sizeof(section), &payload, sizeof(T));
+                m_used += need;
+                ++m_sections;
+            }
+
+            /// Writes the block header; returns the bytes used, or 0 if nothing fit.
+            [[nodiscard]] std::uint32_t finish() noexcept
+            {
+                if (m_sections == 0)
+                {
+                    return 0;
+                }
+                BlockHeader header{};
+                std::memcpy(header.magic, k_magic, sizeof(k_magic));
+                header.abi_version = k_abi_version;
+                header.used = m_used;
+                header.n_sections = m_sections;
+                std::memcpy(m_base, &header, sizeof(header));
+                return m_used;
+            }
+
+            [[nodiscard]] bool overflow() const noexcept { return m_overflow; }
+
+        private:
+            unsigned char *m_base;
+            std::uint32_t m_capacity;
+            std::uint32_t m_used = align8(sizeof(BlockHeader));
+            std::uint32_t m_sections = 0;
+            bool m_overflow = false;
+        };
+
+        template <typename T>
+        void stage(std::optional<T> &out, std::uint32_t version, std::uint32_t expected_version,
+                   const SectionHeader &section, const unsigned char *payload) noexcept
+        {
+            if (version == expected_version && section.size == sizeof(T))
+            {
+                T value;
+                std::memcpy(&value, payload, sizeof(T));
+                out = value;
+            }
+        }
+    } // namespace
+
+    std::uint32_t save_state(void *block, std::uint32_t capacity) noexcept
+    {
+        if (block == nullptr || capacity < sizeof(BlockHeader))
+        {
+            return 0;
+        }
+        BlockWriter writer(block, capacity);
+        const ModuleInfo &mod = module_info();
+
+        if (mod.base != 0)
+        {
+            AnchorsPayload anchors{};
+            anchors.module_base = mod.base;
+            anchors.module_size = mod.size;
+            anchors.table_hash = anchor_table_hash();
+            anchors.count = static_cast<std::uint32_t>(k_anchor_count);
+            for (std::size_t i = 0; i < k_anchor_count; ++i)
+            {
+                anchors.address[i] = anchor_address(static_cast<AnchorId>(i));
+            }
+            writer.add(Tag::Anchors, k_anchors_version, anchors);
+
+            const HealedOffsets healed = healed_offsets_snapshot();
+            if (healed.groups != 0)
+            {
+                OffsetsPayload offsets{};
+                offsets.module_base = mod.base;
+                offsets.groups = healed.groups;
+                offsets.count = static_cast<std::uint32_t>(k_runtime_offset_count);
+                std::memcpy(offsets.value, healed.value, sizeof(offsets.value));
+                writer.add(Tag::Offsets, k_offsets_version, offsets);
+            }
+        }
+
+        // The render thread may still be writing the render-only members; a torn float in a dev handoff is at
+        // worst one eased frame.
+        const CameraState &cam = camera_state();
+        CameraPayload camera{};
+        camera.orbit_yaw = cam.orbit_yaw.load(std::memory_order_relaxed);
+        camera.orbit_pitch = cam.orbit_pitch.load(std::memory_order_relaxed);
+        camera.zoom_offset = cam.zoom_offset.load(std::memory_order_relaxed);
+        camera.view_blend = cam.view_blend;
+        camera.collision_distance = cam.collision_distance;
+        camera.applying = cam.applying.load(std::memory_order_relaxed) ? 1 : 0;
+        camera.orbit_active = cam.orbit_active.load(std::memory_order_relaxed) ? 1 : 0;
+        camera.collision_valid = cam.collision_valid ? 1 : 0;
+        writer.add(Tag::Camera, k_camera_version, camera);
+
+        // SaveState runs before Shutdown stops the overlay thread, which owns the store; the two fields are plain
+        // ints / bools read once, so the race is benign for a dev reload.
+        const Presets::PresetStore &store = Presets::PresetStore::instance();
+        PresetEditorPayload editor{};
+        editor.editing_index = store.editing_index();
+        editor.pinned = store.editing_pinned() ? 1 : 0;
+        writer.add(Tag::PresetEditor, k_preset_editor_version, editor);
+
+        const std::uint32_t used = writer.finish();
+        DMK::Logger::get_instance().info("[DEV] State handoff: saved {} bytes{}", used,
+                                         writer.overflow() ? " (block full: some sections dropped)" : "");
+        return used;
+    }
+
+    void stage_state(const void *block, std::uint32_t size) noexcept
+    {
+        if (block == nullptr || size < sizeof(BlockHeader))
+        {
+            return;
+        }
+        const auto *base = static_cast<const unsigned char *>(block);
+        BlockHeader header;
+        std::memcpy(&header, base, sizeof(header));
+        if (std::memcmp(header.magic, k_magic, sizeof(k_magic)) != 0 || header.abi_version != k_abi_version ||
+            header.used > size)
+        {
+            return;
+        }
+        std::uint32_t offset = align8(sizeof(BlockHeader));
+        for (std::uint32_t n = 0; n < header.n_sections; ++n)
+        {
+            if (offset + sizeof(SectionHeader) > header.used)
+            {
+                return;
+            }
+            SectionHeader section;
+            std::memcpy(&section, base + offset, sizeof(section));
+            const unsigned char *payload = base + offset + sizeof(SectionHeader);
+            if (offset + sizeof(SectionHeader) + section.size > header.used)
+            {
+                return;
+            }
+            switch (static_cast<Tag>(section.tag))
+            {
+            case Tag::Anchors:
+                stage(s_anchors, section.version, k_anchors_version, section, payload);
+                break;
+            case Tag::Offsets:
+                stage(s_offsets, section.version, k_offsets_version, section, payload);
+                break;
+            case Tag::Camera:
+                stage(s_camera, section.version, k_camera_version, section, payload);
+                break;
+            case Tag::PresetEditor:
+                stage(s_preset_editor, section.version, k_preset_editor_version, section, payload);
+                break;
+            default:
+                break; // a section from a newer build: skipped
+            }
+            offset += static_cast<std::uint32_t>(sizeof(SectionHeader) + align8(section.size));
+        }
+    }
+
+    bool adopt_anchors(std::uintptr_t module_base, std::size_t module_size)
+    {
+        const std::optional<AnchorsPayload> staged = std::exchange(s_anchors, std::nullopt);
+        if (!staged || staged->module_base != module_base || staged->module_size != module_size ||
+            staged->table_hash != anchor_table_hash() || staged->count != k_anchor_count)
+        {
+            return false;
+        }
+        std::uintptr_t addresses[k_anchor_count];
+        for (std::size_t i = 0; i < k_anchor_count; ++i)
+        {
+            addresses[i] = static_cast<std::uintptr_t>(staged->address[i]);
+        }
+        adopt_anchor_addresses(addresses, k_anchor_count, module_base, module_size);
+        DMK::Logger::get_instance().info("[DEV] State handoff: adopted {} anchor addresses (resolve skipped)",
+                                         k_anchor_count);
+        return true;
+    }
+
+    bool adopt_offsets(std::uintptr_t module_base)
+    {
+        const std::optional<OffsetsPayload> staged = std::exchange(s_offsets, std::nullopt);
+        if (!staged || staged->module_base != module_base || staged->count != k_runtime_offset_count)
+        {
+            return false;
+        }
+        HealedOffsets healed;
+        healed.groups = staged->groups;
+        std::memcpy(healed.value, staged->value, sizeof(healed.value));
+        seed_healed_offsets(healed);
+        DMK::Logger::get_instance().info("[DEV] State handoff: adopted healed offsets (groups {:#x})", healed.groups);
+        return true;
+    }
+
+    bool adopt_camera()
+    {
+        const std::optional<CameraPayload> staged = std::exchange(s_camera, std::nullopt);
+        if (!staged)
+        {
+            return false;
+        }
+        // Runs in init before the camera hook's first frame, so the render-only members are still ours to write.
+        CameraState &cam = camera_state();
+        cam.orbit_yaw.store(staged->orbit_yaw, std::memory_order_relaxed);
+        cam.orbit_pitch.store(staged->orbit_pitch, std::memory_order_relaxed);
+        cam.zoom_offset.store(staged->zoom_offset, std::memory_order_relaxed);
+        cam.view_blend = staged->view_blend;
+        cam.collision_distance = staged->collision_distance;
+        cam.collision_valid = staged->collision_valid != 0;
+        cam.orbit_active.store(staged->orbit_active != 0, std::memory_order_relaxed);
+        cam.applying.store(staged->applying != 0, std::memory_order_relaxed);
+        DMK::Logger::get_instance().info("[DEV] State handoff: adopted camera state (view {}, orbit {})",
+                                         staged->applying != 0 ? "on" : "off",
+                                         staged->orbit_active != 0 ? "on" : "off");
+        return true;
+    }
+
+    bool adopt_preset_editor()
+    {
+        const std::optional<PresetEditorPayload> staged = std::exchange(s_preset_editor, std::nullopt);
+        if (!staged)
+        {
+            return false;
+        }
+        // The editing preset itself round-trips through the store file (flushed by the outgoing Shutdown); only the
+        // live-preview pin is session state, and it is restored only onto the same preset.
+        Presets::PresetStore &store = Presets::PresetStore::instance();
+        if (store.editing_index() != staged->editing_index)
+        {
+            return false;
+        }
+        if (staged->pinned != 0)
+        {
+            store.set_editing_pinned(true);
+        }
+        return true;
+    }
+
+} // namespace TPVCamera::Handoff
+
+#endif // TPVCAMERA_DEV_BUILD
@@ -0,0 +1,96 @@
+/**
+ * @file dev/state_handoff.hpp
+ * @brief Versioned state handoff between the outgoing and the incoming logic DLL of a dev hot reload.
+ *
+ * @details Only used by the TPVCAMERA_DEV_BUILD loader / logic pair. A plain reload re-runs the whole init: the
+ *          anchor resolve (cache file open plus a byte-compare of every cached site, or a full scan), the offset
+ *          heals, and the camera starts over in first person with the orbit released. With the handoff, the
+ *          loader owns one block of k_block_capacity bytes for the life of the process:
+ *            1. before it runs the outgoing logic's Shutdown(), it calls the optional SaveState export, which
+ *               writes the live state into the block;
+ *            2. it loads the rebuilt logic and calls its optional InitWithState export (instead of Init) with the
+ *               block, which stages each section it understands and runs the normal init, taking the staged
+ *               value wherever its inputs are unchanged.
+ *          A logic DLL without the exports (or a failed SaveState) simply gets the plain Init().
+ *
+ *          Block layout (native PODs: both DLLs are the same build of the same compiler):
+ *            BlockHeader   magic "TPVH", k_abi_version, bytes used, section count
+ *            per section   SectionHeader (tag, payload version, payload size) + payload, 8-byte aligned
+ *          The framing (this header) is the ABI the loader and every logic build share; bump k_abi_version on any
+ *          framing change. Each payload carries its own version (state_handoff.cpp), so a rebuild that changed
+ *          one payload's layout drops just that section and re-derives it the normal way.
+ *
+ *          The loader only moves the block; it links nothing but Win32, so this header includes nothing else.
+ */
+#ifndef TPVCAMERA_DEV_STATE_HANDOFF_HPP
+#define TPVCAMERA_DEV_STATE_HANDOFF_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace TPVCamera::Handoff
+{
+
+    inline constexpr std::uint32_t k_abi_version = 1;
+
+    /// Size of the loader-owned block (the sections use a few hundred bytes).
+    inline constexpr std::uint32_t k_block_capacity = 64 * 1024;
+
+    struct BlockHeader
+    {
+        char magic[4];             // "TPVH"
+        std::uint32_t abi_version; // k_abi_version
+        std::uint32_t used;        // bytes from the block start, header included
+        std::uint32_t n_sections;
+    };
+
+    struct SectionHeader
+    {
+        std::uint32_t tag;     // Tag
+        std::uint32_t version; // payload layout version, per tag
+        std::uint32_t size;    // payload bytes following this header
+        std::uint32_t reserved;
+    };
+
+    enum class Tag : std::uint32_t
+    {
+        Anchors = 1,      // resolved anchor addresses, keyed on the image and the candidate-table hash
+        Offsets = 2,      // healed RuntimeOffsets, keyed on the image
+        Camera = 3,       // view on/off, orbit, zoom and the collision carry-over
+        PresetEditor = 4, // the overlay's editing preset and its live-preview pin
+    };
+
+    /// Logic DLL export "SaveState": writes the handoff into @p block; returns the bytes used (0 = nothing saved).
+    using SaveStateFn = std::uint32_t(__cdecl *)(void *block, std::uint32_t capacity);
+
+    /// Logic DLL export "InitWithState": Init() that first stages the handoff in @p block.
+    using InitWithStateFn = bool(__cdecl *)(const void *block, std::uint32_t size);
+
+#ifdef TPVCAMERA_DEV_BUILD
+    // Logic-DLL side (state_handoff.cpp).
+
+    /** @brief Serializes the live state into @p block (called by SaveState, before Shutdown). */
+    [[nodiscard]] std::uint32_t save_state(void *block, std::uint32_t capacity) noexcept;
+
+    /** @brief Validates @p block and stages every section this build understands (called before init()). */
+    void stage_state(const void *block, std::uint32_t size) noexcept;
+
+    /**
+     * @brief Installs the staged anchor addresses if they were resolved for this exact image and candidate table.
+     * @return True if adopted (resolve_all_anchors can be skipped).
+     */
+    [[nodiscard]] bool adopt_anchors(std::uintptr_t module_base, std::size_t module_size);
+
+    /** @brief Seeds the staged healed offsets if they came from this image. True if adopted. */
+    [[nodiscard]] bool adopt_offsets(std::uintptr_t module_base);
+
+    /** @brief Restores the staged camera state. True if adopted (the start-of-session auto-enables are skipped). */
+    [[nodiscard]] bool adopt_camera();
+
+    /** @brief Restores the staged preset-editor selection into the loaded store. True if adopted. */
+    [[nodiscard]] bool adopt_preset_editor();
+#endif
+
+} // namespace TPVCamera::Handoff
+
+#endif // TPVCAMERA_DEV_STATE_HANDOFF_HPP
@@ -0,0 +1,128 @@
+/**
+ * @file frame_arena.cpp
+ * @brief Per-frame scratch arena and the optional render-thread heap check (see frame_arena.hpp).
+ */
+
+#include "frame_arena.hpp"
+#include "alloc_stats.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <windows.h>
+
+#include <atomic>
+
+namespace TPVCamera::FrameArena
+{
+
+    namespace
+    {
+        alignas(64) std::byte s_block[k_capacity];
+        std::size_t s_cursor = 0;
+        bool s_open = false;
+
+        // Overlay-readable counters (written on the render thread only).
+        std::atomic<std::size_t> s_high_water{0};
+        std::atomic<std::uint32_t> s_overflows{0};
+        std::atomic<std::uint64_t> s_heap_allocs{0};
+        std::atomic<std::uint32_t> s_heap_frames{0};
+
+        // Set on the render thread while a frame is open; the operator new replacement (alloc_stats.cpp) counts
+        // under it.
+        thread_local bool t_counting = false;
+        thread_local std::uint32_t t_frame_allocs = 0;
+        // The render thread's allocation tag outside the frame, restored by end_frame().
+        thread_local AllocStats::AllocTag t_outer_tag = AllocStats::AllocTag::Hooks;
+    } // namespace
+
+#if TPVCAMERA_FRAME_ALLOC_CHECK
+    void note_heap_allocation() noexcept
+    {
+        if (t_counting)
+        {
+            ++t_frame_allocs;
+        }
+    }
+#endif
+
+    void *allocate(std::size_t bytes, std::size_t align) noexcept
+    {
+        if (!s_open)
+        {
+            s_overflows.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        const std::size_t start = (s_cursor + align - 1) & ~(align - 1);
+        if (start > k_capacity || bytes > k_capacity - start)
+        {
+            s_overflows.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        s_cursor = start + bytes;
+        if (s_cursor > s_high_water.load(std::memory_order_relaxed))
+        {
+            s_high_water.store(s_cursor, std::memory_order_relaxed);
+        }
+        return s_block + start;
+    }
+
+    Mark mark() noexcept
+    {
+        return s_cursor;
+    }
+
+    void rewind(Mark m) noexcept
+    {
+        if (m < s_cursor)
+        {
+            s_cursor = m;
+        }
+    }
+
+    void begin_frame() noexcept
+    {
+        s_cursor = 0;
+        s_open = true;
+        t_frame_allocs = 0;
+        t_counting = TPVCAMERA_FRAME_ALLOC_CHECK != 0;
+        t_outer_tag = AllocStats::set_thread_tag(AllocStats::AllocTag::RenderFrame);
+    }
+
+    void end_frame() noexcept
+    {
+        t_counting = false;
+        AllocStats::set_thread_tag(t_outer_tag);
+        s_open = false;
+        s_cursor = 0;
+        if (t_frame_allocs == 0)
+        {
+            return;
+        }
+        // Only a check build counts, so everything below is its report.
+        s_heap_allocs.fetch_add(t_frame_allocs, std::memory_order_relaxed);
+        const std::uint32_t frames = s_heap_frames.fetch_add(1, std::memory_order_relaxed);
+        if (frames % k_alloc_report_every == 0)
+        {
+            DMK::Logger::get_instance().warning(
+                "FrameArena: {} heap allocation(s) on the render thread in one frame ({} such frame(s) so far)",
+                t_frame_allocs, frames + 1);
+            if (IsDebuggerPresent())
+            {
+                __debugbreak();
+            }
+        }
+        t_frame_allocs = 0;
+    }
+
+    Stats stats() noexcept
+    {
+        Stats s;
+        s.capacity = k_capacity;
+        s.high_water = s_high_water.load(std::memory_order_relaxed);
+        s.overflows = s_overflows.load(std::memory_order_relaxed);
+        s.heap_allocs = s_heap_allocs.load(std::memory_order_relaxed);
+        s.heap_frames = s_heap_frames.load(std::memory_order_relaxed);
+        return s;
+    }
+
+} // namespace TPVCamera::FrameArena
@@ -0,0 +1,132 @@
+/**
+ * @file frame_arena.hpp
+ * @brief Per-frame linear scratch arena for the render-thread collision / occlusion paths.
+ *
+ * @details The frustum detour's temporaries that are too large for the game's render-thread stack -- the octree
+ *          node lists (RENDER_OCCLUSION_MAX_NODES pointers, 8 KB each) filled by GetObjectsInBox and the region BVH
+ *          -- are carved from one fixed block instead. detour_frustum_build_impl opens a FrameScope past the CView
+ *          gate; take() bumps a cursor within it and the scope resets the cursor when the frame ends, so nothing is
+ *          freed piecemeal and nothing touches the heap. A Rewind scope (or mark() / rewind() inside an SEH frame,
+ *          which cannot hold unwinding objects) returns a callee's scratch early, so a walk that measures several
+ *          hits in one frame reuses the same bytes.
+ *
+ *          take() outside an open frame, or past k_capacity, returns an empty span: the callers treat that as "no
+ *          candidates" (the same degrade as an octree fault), and the overflow is counted for the overlay.
+ *
+ *          TPVCAMERA_FRAME_ALLOC_CHECK (CMake option, OFF by default) additionally replaces the module's global
+ *          operator new and counts every heap allocation made on the render thread while a frame is open. A frame
+ *          that allocated logs a warning (the first, then one in k_alloc_report_every) and breaks into an attached
+ *          debugger. A log line at a level that is enabled formats a string, so it counts too. The replacement
+ *          itself lives in alloc_stats.cpp, shared with TPVCAMERA_ALLOC_STATS; an open frame also switches the
+ *          render thread's allocation tag to RenderFrame.
+ *
+ *          Render thread only; stats() may be read from the overlay thread.
+ */
+#ifndef TPVCAMERA_FRAME_ARENA_HPP
+#define TPVCAMERA_FRAME_ARENA_HPP
+
+#include "constants.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#ifndef TPVCAMERA_FRAME_ALLOC_CHECK
+#define TPVCAMERA_FRAME_ALLOC_CHECK 0
+#endif
+
+namespace TPVCamera::FrameArena
+{
+
+    /// Arena size: room for several live node lists (a walk nests at most two) plus the smaller buffers.
+    inline constexpr std::size_t k_capacity = 64 * 1024;
+    static_assert(k_capacity >= 4 * Constants::RENDER_OCCLUSION_MAX_NODES * sizeof(void *),
+                  "the arena must hold several RENDER_OCCLUSION_MAX_NODES node lists");
+
+    /// Frames with heap allocations between two warnings after the first (TPVCAMERA_FRAME_ALLOC_CHECK only).
+    inline constexpr std::uint32_t k_alloc_report_every = 600;
+
+    /// Cursor position, for rewind().
+    using Mark = std::size_t;
+
+    /**
+     * @brief @p bytes of scratch aligned to @p align (a power of two), valid until the frame ends or a rewind
+     *        below it. nullptr outside an open frame or when the arena is exhausted.
+     */
+    [[nodiscard]] void *allocate(std::size_t bytes, std::size_t align) noexcept;
+
+    /** @brief Uninitialized scratch for @p count values of @p T; empty when allocate() fails. */
+    template <typename T>
+    [[nodiscard]] std::span<T> take(std::size_t count) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                      "the arena never runs constructors or destructors");
+        void *p = allocate(count * sizeof(T), alignof(T));
+        return p != nullptr ? std::span<T>(static_cast<T *>(p), count) : std::span<T>();
+    }
+
+    [[nodiscard]] Mark mark() noexcept;
+
+    /** @brief Releases everything taken since @p m. */
+    void rewind(Mark m) noexcept;
+
+    /** @brief Opens the frame (the detour, past the CView gate). Render thread only. */
+    void begin_frame() noexcept;
+
+    /** @brief Resets the arena and, with TPVCAMERA_FRAME_ALLOC_CHECK, checks the frame's heap count. */
+    void end_frame() noexcept;
+
+#if TPVCAMERA_FRAME_ALLOC_CHECK
+    /** @brief Counts one heap allocation if the calling thread has a frame open. Called by operator new. */
+    void note_heap_allocation() noexcept;
+#endif
+
+    /**
+     * @struct Stats
+     * @brief Session counters for the overlay's Performance section.
+     */
+    struct Stats
+    {
+        std::size_t capacity = 0;
+        std::size_t high_water = 0;     // largest cursor position reached in any frame, bytes
+        std::uint32_t overflows = 0;    // take() calls that got an empty span
+        std::uint64_t heap_allocs = 0;  // render-thread heap allocations inside frames (check builds only)
+        std::uint32_t heap_frames = 0;  // frames with at least one of them
+    };
+
+    [[nodiscard]] Stats stats() noexcept;
+
+    /**
+     * @class FrameScope
+     * @brief begin_frame() / end_frame() for the enclosing scope, so every exit path of the detour resets.
+     */
+    class FrameScope
+    {
+    public:
+        FrameScope() noexcept { begin_frame(); }
+        ~FrameScope() noexcept { end_frame(); }
+        FrameScope(const FrameScope &) = delete;
+        FrameScope &operator=(const FrameScope &) = delete;
+    };
+
+    /**
+     * @class Rewind
+     * @brief Returns the scratch taken in the enclosing scope on exit. Not for functions with a __try block
+     *        (MSVC C2712); use mark() / rewind() around the guarded call there.
+     */
+    class Rewind
+    {
+    public:
+        Rewind() noexcept : m_mark(mark()) {}
+        ~Rewind() noexcept { rewind(m_mark); }
+        Rewind(const Rewind &) = delete;
+        Rewind &operator=(const Rewind &) = delete;
+
+    private:
+        Mark m_mark;
+    };
+
+} // namespace TPVCamera::FrameArena
+
+#endif // TPVCAMERA_FRAME_ARENA_HPP
@@ -0,0 +1,136 @@
+/**
+ * @file frame_clock.cpp
+ * @brief QPC frame clock with hitch / outlier shaping and a smoothed frame time (see frame_clock.hpp).
+ */
+
+#include "frame_clock.hpp"
+
+#include <windows.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace TPVCamera::FrameClock
+{
+
+    namespace
+    {
+        /// Weight of a new frame in the smoothed frame time (about a 10-frame average).
+        constexpr float k_smoothing = 0.1f;
+
+        // Published by tick() on the render thread, read by stamp() / stats() on any thread.
+        std::atomic<std::uint64_t> s_frame{0};
+        std::atomic<std::int64_t> s_last_ticks{0};
+        std::atomic<float> s_smoothed{0.0f};
+        std::atomic<std::uint64_t> s_hitches{0};
+        std::atomic<std::uint64_t> s_outliers{0};
+
+        // Set by the first tick(); read by stamp() only once s_frame is non-zero.
+        std::atomic<std::int64_t> s_start_ticks{0};
+
+        std::int64_t qpc_now() noexcept
+        {
+            LARGE_INTEGER t{};
+            QueryPerformanceCounter(&t);
+            return t.QuadPart;
+        }
+
+        double qpc_period() noexcept
+        {
+            static const double k_period = []
+            {
+                LARGE_INTEGER freq{};
+                QueryPerformanceFrequency(&freq);
+                return freq.QuadPart > 0 ? 1.0 / static_cast<double>(freq.QuadPart) : 0.0;
+            }();
+            return k_period;
+        }
+    } // namespace
+
+    Tick tick() noexcept
+    {
+        const std::int64_t now = qpc_now();
+        const std::int64_t last = s_last_ticks.exchange(now, std::memory_order_relaxed);
+        Tick t;
+        t.frame = s_frame.load(std::memory_order_relaxed);
+        if (last == 0)
+        {
+            // First call: nothing to measure against yet; it opens frame 1.
+            s_start_ticks.store(now, std::memory_order_relaxed);
+            t.new_frame = true;
+            t.frame = 1;
+            s_frame.store(t.frame, std::memory_order_relaxed);
+            return t;
+        }
+
+        t.raw = static_cast<float>(static_cast<double>(now - last) * qpc_period());
+        if (t.raw < k_same_frame_seconds)
+        {
+            t.delta = std::max(t.raw, 0.0f);
+            return t;
+        }
+
+        t.new_frame = true;
+        t.frame += 1;
+        s_frame.store(t.frame, std::memory_order_relaxed);
+
+        float smoothed = s_smoothed.load(std::memory_order_relaxed);
+        float delta = t.raw;
+        if (delta > k_hitch_seconds)
+        {
+            // Not a frame: hand the integrators a normal one and keep it out of the average.
+            t.hitch = true;
+            s_hitches.fetch_add(1, std::memory_order_relaxed);
+            t.delta = std::clamp(smoothed, 0.0f, k_max_delta_seconds);
+            return t;
+        }
+        if (smoothed > 0.0f && delta > smoothed * k_outlier_ratio)
+        {
+            t.outlier = true;
+            s_outliers.fetch_add(1, std::memory_order_relaxed);
+            delta = smoothed * k_outlier_ratio;
+        }
+        t.delta = std::clamp(delta, 0.0f, k_max_delta_seconds);
+
+        smoothed = smoothed > 0.0f ? smoothed + (t.delta - smoothed) * k_smoothing : t.delta;
+        s_smoothed.store(smoothed, std::memory_order_relaxed);
+        return t;
+    }
+
+    Stamp stamp() noexcept
+    {
+        Stamp s;
+        s.frame = s_frame.load(std::memory_order_relaxed);
+        if (s.frame == 0)
+        {
+            return s;
+        }
+        const std::int64_t elapsed =
+            s_last_ticks.load(std::memory_order_relaxed) - s_start_ticks.load(std::memory_order_relaxed);
+        s.wall_seconds = elapsed > 0 ? static_cast<double>(elapsed) * qpc_period() : 0.0;
+        s.smoothed = s_smoothed.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    Stats stats() noexcept
+    {
+        Stats s;
+        s.now = stamp();
+        s.hitches = s_hitches.load(std::memory_order_relaxed);
+        s.outliers = s_outliers.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    std::int64_t now() noexcept
+    {
+        return qpc_now();
+    }
+
+    bool frame_passed(std::int64_t since, std::int64_t until) noexcept
+    {
+        const float smoothed = s_smoothed.load(std::memory_order_relaxed);
+        const double bound = smoothed > 0.0f ? static_cast<double>(smoothed * k_outlier_ratio) : k_hitch_seconds;
+        return static_cast<double>(until - since) * qpc_period() > bound;
+    }
+
+} // namespace TPVCamera::FrameClock
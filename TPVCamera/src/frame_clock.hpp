@@ -0,0 +1,99 @@
+/**
+ * @file frame_clock.hpp
+ * @brief The game-view frame clock: one QPC read per frustum-detour call, hitch / outlier handling, a smoothed
+ *        frame time, and the frame index and wall time the other subsystems stamp their records with.
+ *
+ * @details The render thread calls tick() once per game-view detour call and integrates with the delta it returns.
+ *          The raw QPC interval is shaped before the integrators see it:
+ *            - Same frame: the frustum builder runs once or twice per frame for the game view (projection setup
+ *              plus the final rebuild). A second call within k_same_frame_seconds of the first is the same frame:
+ *              its near-zero delta is returned as is (so nothing double-advances) and the frame index stays.
+ *            - Hitch: an interval over k_hitch_seconds is a pause, an alt-tab, a load or a breakpoint, not a frame.
+ *              It is replaced by the smoothed frame time, so the camera resumes where it was instead of snapping a
+ *              whole clamp's worth of easing in one frame.
+ *            - Outlier: an interval more than k_outlier_ratio times the smoothed frame time (a streaming stall) is
+ *              clamped to that bound; a sustained drop in frame rate pulls the smoothed time up within a few frames.
+ *            - Every delta is finally clamped to [0, k_max_delta_seconds], the integrators' stable step.
+ *          The smoothed frame time is an exponential average of the shaped deltas of new frames only.
+ *
+ *          Threading: tick() runs on the render thread only. stamp() and stats() read relaxed atomics and are safe
+ *          from any thread (the overlay, the input thread, the raster helpers); a reader racing tick() may see the
+ *          index of one frame with the wall time of the next, which nothing here depends on.
+ */
+#ifndef TPVCAMERA_FRAME_CLOCK_HPP
+#define TPVCAMERA_FRAME_CLOCK_HPP
+
+#include <cstdint>
+
+namespace TPVCamera::FrameClock
+{
+
+    /// Calls closer than this (seconds) are the same game-view frame.
+    inline constexpr float k_same_frame_seconds = 0.0005f;
+
+    /// Intervals longer than this (seconds) are a pause or hitch and are replaced by the smoothed frame time.
+    inline constexpr float k_hitch_seconds = 0.25f;
+
+    /// Intervals above this multiple of the smoothed frame time are clamped to it.
+    inline constexpr float k_outlier_ratio = 4.0f;
+
+    /// Largest delta handed to the integrators (seconds).
+    inline constexpr float k_max_delta_seconds = 0.1f;
+
+    /**
+     * @struct Tick
+     * @brief What tick() measured for this detour call.
+     */
+    struct Tick
+    {
+        float delta = 0.0f;       // shaped seconds since the previous call, for the integrators
+        float raw = 0.0f;         // unshaped QPC seconds since the previous call
+        std::uint64_t frame = 0;  // game-view frame index (0 before the first frame)
+        bool new_frame = false;   // false for the second call within the same frame
+        bool hitch = false;       // raw was over k_hitch_seconds and was replaced
+        bool outlier = false;     // raw was over k_outlier_ratio x the smoothed frame time and was clamped
+    };
+
+    /** @brief Reads the QPC and advances the clock. Render thread only, once per game-view detour call. */
+    [[nodiscard]] Tick tick() noexcept;
+
+    /**
+     * @struct Stamp
+     * @brief The clock as of the last tick(), for stamping records on any thread.
+     */
+    struct Stamp
+    {
+        std::uint64_t frame = 0;   // game-view frame index
+        double wall_seconds = 0.0; // QPC seconds from the first tick() to the last
+        float smoothed = 0.0f;     // smoothed frame time, seconds (0 until the second frame)
+    };
+
+    /** @brief The clock as of the last tick(). Any thread. */
+    [[nodiscard]] Stamp stamp() noexcept;
+
+    /**
+     * @struct Stats
+     * @brief Session counters for the overlay's Performance section.
+     */
+    struct Stats
+    {
+        Stamp now;
+        std::uint64_t hitches = 0;  // intervals replaced by the smoothed frame time
+        std::uint64_t outliers = 0; // intervals clamped to k_outlier_ratio x the smoothed frame time
+    };
+
+    [[nodiscard]] Stats stats() noexcept;
+
+    /** @brief The raw QPC reading, for ages measured with frame_passed(). Any thread. */
+    [[nodiscard]] std::int64_t now() noexcept;
+
+    /**
+     * @brief True when a whole frame separates the QPC readings @p since and @p until.
+     * @details A frame is bounded like an outlier: k_outlier_ratio x the smoothed frame time, or k_hitch_seconds
+     *          before there is one. Any thread.
+     */
+    [[nodiscard]] bool frame_passed(std::int64_t since, std::int64_t until) noexcept;
+
+} // namespace TPVCamera::FrameClock
+
+#endif // TPVCAMERA_FRAME_CLOCK_HPP
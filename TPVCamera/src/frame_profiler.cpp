@@ -0,0 +1,201 @@
+/**
+ * @file frame_profiler.cpp
+ * @brief Storage and statistics for the frustum-detour stage profiler (see frame_profiler.hpp).
+ */
+
+#include "frame_profiler.hpp"
+#include "config.hpp"
+
+#include <windows.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+namespace TPVCamera::Profiler
+{
+
+    namespace
+    {
+        /**
+         * @brief Rolling window of per-frame costs for one stage.
+         * @details Single writer (render thread), single reader (overlay thread). m_head counts samples ever
+         *          pushed; the ring index is m_head % k_window. Samples are microseconds so the reader needs no
+         *          QPC frequency.
+         */
+        struct StageRing
+        {
+            std::array<std::atomic<float>, k_window> m_us{};
+            std::array<std::atomic<std::uint16_t>, k_window> m_calls{};
+            std::atomic<std::uint32_t> m_head{0};
+        };
+
+        std::array<StageRing, k_stage_count> s_rings{};
+
+        // Render-thread-only accumulators for the frame in progress (folded into s_rings by end_frame).
+        std::array<std::int64_t, k_stage_count> s_frame_ticks{};
+        std::array<std::uint16_t, k_stage_count> s_frame_calls{};
+        // The frame end_frame() last closed, per stage (-1 = not entered); render thread only.
+        std::array<float, k_stage_count> s_last_us = []
+        {
+            std::array<float, k_stage_count> a{};
+            a.fill(-1.0f);
+            return a;
+        }();
+
+        // Set by the camera benchmark for the length of its run.
+        std::atomic<bool> s_forced{false};
+
+        // Set by reset() on the overlay thread, consumed by end_frame() on the render thread, so the ring heads
+        // are only ever written by their single writer.
+        std::atomic<bool> s_reset_pending{false};
+
+        // Indexed by Stage; keep in enum order.
+        constexpr std::array<const char *, k_stage_count> k_stage_names = {
+            "Frustum detour (total)",
+            "poll_game_state",
+            "debounce_game_state",
+            "Presets::resolve_and_apply",
+            "offset_game_view_camera",
+            "publish_player_world_bounds",
+            "ray_fan_sweep",
+            "Coverage measurement",
+            "sphere_world_sweep",
+            "render_occlusion_limit",
+            "Lateral probe",
+        };
+
+        /// Microseconds per QPC tick, captured once (the QPC frequency is fixed at boot).
+        double us_per_tick() noexcept
+        {
+            static const double k_us_per_tick = []
+            {
+                LARGE_INTEGER freq{};
+                QueryPerformanceFrequency(&freq);
+                return (freq.QuadPart > 0) ? 1.0e6 / static_cast<double>(freq.QuadPart) : 0.0;
+            }();
+            return k_us_per_tick;
+        }
+    } // namespace
+
+    const char *stage_name(Stage stage) noexcept
+    {
+        const auto i = static_cast<std::size_t>(stage);
+        return (i < k_stage_count) ? k_stage_names[i] : "?";
+    }
+
+    bool enabled() noexcept
+    {
+        return s_forced.load(std::memory_order_relaxed) || settings().enable_profiler.load(std::memory_order_relaxed);
+    }
+
+    void set_forced(bool forced) noexcept
+    {
+        s_forced.store(forced, std::memory_order_relaxed);
+    }
+
+    std::int64_t now_ticks() noexcept
+    {
+        LARGE_INTEGER t{};
+        QueryPerformanceCounter(&t);
+        return t.QuadPart;
+    }
+
+    float ticks_to_us(std::int64_t ticks) noexcept
+    {
+        return static_cast<float>(static_cast<double>(ticks) * us_per_tick());
+    }
+
+    void record(Stage stage, std::int64_t ticks) noexcept
+    {
+        const auto i = static_cast<std::size_t>(stage);
+        if (i >= k_stage_count || ticks < 0)
+        {
+            return;
+        }
+        s_frame_ticks[i] += ticks;
+        if (s_frame_calls[i] < 0xFFFF)
+        {
+            ++s_frame_calls[i];
+        }
+    }
+
+    void end_frame() noexcept
+    {
+        if (s_reset_pending.exchange(false, std::memory_order_acq_rel))
+        {
+            for (StageRing &ring : s_rings)
+            {
+                ring.m_head.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        const double scale = us_per_tick();
+        for (std::size_t i = 0; i < k_stage_count; ++i)
+        {
+            if (s_frame_calls[i] == 0)
+            {
+                s_last_us[i] = -1.0f;
+                continue; // stage not entered this frame (throttled / gated off): no sample
+            }
+            StageRing &ring = s_rings[i];
+            const std::uint32_t head = ring.m_head.load(std::memory_order_relaxed);
+            const std::size_t slot = head % k_window;
+            s_last_us[i] = static_cast<float>(static_cast<double>(s_frame_ticks[i]) * scale);
+            ring.m_us[slot].store(s_last_us[i], std::memory_order_relaxed);
+            ring.m_calls[slot].store(s_frame_calls[i], std::memory_order_relaxed);
+            // Release: the slot payload is visible before a reader that sees the advanced head reads it.
+            ring.m_head.store(head + 1, std::memory_order_release);
+            s_frame_ticks[i] = 0;
+            s_frame_calls[i] = 0;
+        }
+    }
+
+    float last_frame_us(Stage stage) noexcept
+    {
+        const auto i = static_cast<std::size_t>(stage);
+        return (i < k_stage_count) ? s_last_us[i] : -1.0f;
+    }
+
+    void reset() noexcept
+    {
+        s_reset_pending.store(true, std::memory_order_release);
+    }
+
+    StageStats stats(Stage stage) noexcept
+    {
+        StageStats out{};
+        const auto i = static_cast<std::size_t>(stage);
+        if (i >= k_stage_count)
+        {
+            return out;
+        }
+        const StageRing &ring = s_rings[i];
+        const std::uint32_t head = ring.m_head.load(std::memory_order_acquire);
+        const std::size_t n = std::min<std::size_t>(head, k_window);
+        if (n == 0)
+        {
+            return out;
+        }
+
+        std::array<float, k_window> sorted{};
+        std::uint32_t calls = 0;
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            sorted[k] = ring.m_us[k].load(std::memory_order_relaxed);
+            calls += ring.m_calls[k].load(std::memory_order_relaxed);
+        }
+        std::sort(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(n));
+
+        // Nearest-rank percentiles over the window.
+        const auto rank = [n](float q)
+        { return std::min(n - 1, static_cast<std::size_t>(q * static_cast<float>(n))); };
+        out.p50_us = sorted[rank(0.50f)];
+        out.p99_us = sorted[rank(0.99f)];
+        out.max_us = sorted[n - 1];
+        out.calls_per_frame = static_cast<float>(calls) / static_cast<float>(n);
+        out.samples = static_cast<std::uint32_t>(n);
+        return out;
+    }
+
+} // namespace TPVCamera::Profiler
@@ -0,0 +1,182 @@
+/**
+ * @file frame_profiler.hpp
+ * @brief Low-overhead per-stage timing of the frustum-builder detour, surfaced in the overlay.
+ *
+ * @details The detour does all of its work on the render thread inside the game's frame, so any cost it adds is
+ *          frame time. This module brackets each stage of detour_frustum_build_impl / offset_game_view_camera with a
+ *          QueryPerformanceCounter scope and keeps a rolling window of per-FRAME costs per stage (a stage entered
+ *          several times in one frame -- the coverage walk's fan -- is summed into that frame's sample), from which
+ *          the overlay shows p50 / p99 / max.
+ *
+ *          Two gates keep it out of the way:
+ *          - Compile time: TPVCAMERA_ENABLE_PROFILER (CMake option, ON by default). When 0, TPVCAMERA_PROFILE_SCOPE
+ *            expands to nothing, so no scope object or counter read exists in the build at all.
+ *          - Run time: [Advanced] EnableProfiler (INI, OFF by default). While off each scope is a single relaxed
+ *            bool load; no QPC read, no ring write.
+ *
+ *          Threading: the scopes and end_frame() run on the render thread only; the overlay thread reads the ring
+ *          through stats(). Ring slots are relaxed atomics, so a reader racing a write sees at worst one sample
+ *          from the newer frame -- harmless for a percentile readout.
+ */
+#ifndef TPVCAMERA_FRAME_PROFILER_HPP
+#define TPVCAMERA_FRAME_PROFILER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef TPVCAMERA_ENABLE_PROFILER
+#define TPVCAMERA_ENABLE_PROFILER 1
+#endif
+
+namespace TPVCamera::Profiler
+{
+
+    /**
+     * @enum Stage
+     * @brief The timed stages of the frustum-builder detour. FrustumBuild is the whole game-view frame (the frame
+     *        scope); the rest are nested inside it.
+     */
+    enum class Stage : std::uint8_t
+    {
+        FrustumBuild,
+        PollGameState,
+        Debounce,
+        ResolvePreset,
+        OffsetCamera,
+        PlayerBounds,
+        RayFan,
+        Coverage,
+        SphereSweep,
+        RenderOcclusion,
+        LateralProbe,
+        Count
+    };
+
+    inline constexpr std::size_t k_stage_count = static_cast<std::size_t>(Stage::Count);
+
+    /// Frames kept per stage for the rolling percentiles (~2 s at 120 fps).
+    inline constexpr std::size_t k_window = 256;
+
+    /** @brief Display name of @p stage for the overlay table. */
+    [[nodiscard]] const char *stage_name(Stage stage) noexcept;
+
+    /** @brief Whether sampling is on this frame (the [Advanced] EnableProfiler atomic, or set_forced). */
+    [[nodiscard]] bool enabled() noexcept;
+
+    /** @brief Keeps sampling on regardless of the INI while @p forced (the camera benchmark). Any thread. */
+    void set_forced(bool forced) noexcept;
+
+    /** @brief Current QueryPerformanceCounter value. */
+    [[nodiscard]] std::int64_t now_ticks() noexcept;
+
+    /** @brief Converts a now_ticks() difference to microseconds. */
+    [[nodiscard]] float ticks_to_us(std::int64_t ticks) noexcept;
+
+    /**
+     * @brief Adds @p ticks to @p stage's accumulator for the current frame. Render thread only.
+     * @details The accumulator is folded into the ring by end_frame(), so repeated calls in one frame sum.
+     */
+    void record(Stage stage, std::int64_t ticks) noexcept;
+
+    /**
+     * @brief Publishes this frame's per-stage accumulators into the rolling windows and clears them.
+     * @details Only stages actually entered this frame push a sample, so a stage the static-world throttle skipped
+     *          does not drag its percentiles toward zero. Render thread only.
+     */
+    void end_frame() noexcept;
+
+    /**
+     * @brief @p stage's cost in the frame the last end_frame() closed, in microseconds; -1 if it did not run.
+     * @details Render thread only (the camera benchmark collects every frame of its run through this, where the
+     *          rolling window would keep only the last k_window).
+     */
+    [[nodiscard]] float last_frame_us(Stage stage) noexcept;
+
+    /** @brief Drops every recorded sample (overlay "Reset" button). Safe from any thread. */
+    void reset() noexcept;
+
+    /**
+     * @struct StageStats
+     * @brief Rolling statistics of one stage over the last k_window frames it ran in, in microseconds.
+     */
+    struct StageStats
+    {
+        float p50_us = 0.0f;
+        float p99_us = 0.0f;
+        float max_us = 0.0f;
+        float calls_per_frame = 0.0f; // mean entries per sampled frame (the coverage walk re-enters the fan)
+        std::uint32_t samples = 0;    // frames currently in the window (0..k_window)
+    };
+
+    /** @brief Snapshot of @p stage's rolling statistics. Called from the overlay thread. */
+    [[nodiscard]] StageStats stats(Stage stage) noexcept;
+
+    /**
+     * @class ScopedTimer
+     * @brief Times the enclosing scope into @p stage when the profiler is enabled.
+     * @details Not usable inside a function that carries a __try block (MSVC C2712: no unwinding objects in an
+     *          SEH frame); time such a call at its call site instead.
+     */
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(Stage stage) noexcept : m_stage(stage), m_start(enabled() ? now_ticks() : 0) {}
+        ~ScopedTimer() noexcept
+        {
+            if (m_start != 0)
+            {
+                record(m_stage, now_ticks() - m_start);
+            }
+        }
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    private:
+        Stage m_stage;
+        std::int64_t m_start;
+    };
+
+    /**
+     * @class FrameScope
+     * @brief Times the whole game-view frame as Stage::FrustumBuild and closes the frame on exit.
+     * @details end_frame() runs on every exit path (including the early disengage return), so the nested stages of
+     *          the frame are published together with it.
+     */
+    class FrameScope
+    {
+    public:
+        FrameScope() noexcept : m_timer(Stage::FrustumBuild) {}
+        ~FrameScope() noexcept = default;
+        FrameScope(const FrameScope &) = delete;
+        FrameScope &operator=(const FrameScope &) = delete;
+
+    private:
+        // Closes the frame AFTER m_timer has recorded the total (members destruct in reverse declaration order).
+        struct Closer
+        {
+            ~Closer() noexcept { end_frame(); }
+        } m_closer;
+        ScopedTimer m_timer;
+    };
+
+} // namespace TPVCamera::Profiler
+
+#define TPVCAMERA_PROFILE_CONCAT_INNER(a, b) a##b
+#define TPVCAMERA_PROFILE_CONCAT(a, b) TPVCAMERA_PROFILE_CONCAT_INNER(a, b)
+
+#if TPVCAMERA_ENABLE_PROFILER
+/// Times the rest of the enclosing scope into Profiler::Stage::@p stage.
+#define TPVCAMERA_PROFILE_SCOPE(stage)                                                                                 \
+    const ::TPVCamera::Profiler::ScopedTimer TPVCAMERA_PROFILE_CONCAT(tpv_profile_scope_, __LINE__)                 \
+    {                                                                                                                  \
+        ::TPVCamera::Profiler::Stage::stage                                                                            \
+    }
+/// Opens the per-frame profiling scope (Stage::FrustumBuild + end_frame on exit).
+#define TPVCAMERA_PROFILE_FRAME()                                                                                      \
+    const ::TPVCamera::Profiler::FrameScope TPVCAMERA_PROFILE_CONCAT(tpv_profile_frame_, __LINE__) {}
+#else
+#define TPVCAMERA_PROFILE_SCOPE(stage) static_cast<void>(0)
+#define TPVCAMERA_PROFILE_FRAME() static_cast<void>(0)
+#endif
+
+#endif // TPVCAMERA_FRAME_PROFILER_HPP
@@ -6,18 +6,31 @@
  * stores a pointer to the currently active camera, and that object's RTTI type name identifies the
  * mode. The classification is cached on the active-camera vtable so the steady state costs a single
  * pointer compare. Mount is a per-actor flag; menu and overlay come from the UI hooks.
+ *
+ * Only menu / overlay have a hooked edge (the UI hooks flip a flag on open / close), so only they are read every
+ * call. The engine-side bits -- active camera, minigame, stance -- change a few times a minute, so their chain walks
+ * run at the [Advanced] GameStatePollMs cadence and the last result is reused between walks; a UI edge or a change
+ * of player forces an immediate re-walk, since both usually coincide with an engine-side transition. Missile aim is
+ * the exception: it is a player-driven edge the forced-FPV policy must follow without lag, and it is two reads off
+ * the already-resolved player, so it stays per call.
  */
 
 #include "game_state.hpp"
+#include "config.hpp"
 #include "constants.hpp"
 #include "global_state.hpp"
 #include "offset_heal.hpp"
+#include "rtti_cache.hpp"
 #include "hooks/ui_menu_hooks.hpp"
 
 #include <DetourModKit.hpp>
 
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <cctype>
+#include <charconv>
+#include <chrono>
 #include <string>
 
 namespace TPVCamera
@@ -30,7 +43,8 @@ namespace TPVCamera
          * @brief Classifies an active-camera vtable into the combat / dialogue state bits.
          * @details Caches the last vtable and its classification so the steady state (the active camera
          *          unchanged frame to frame) costs one pointer compare with no RTTI walk; a camera switch
-         *          re-walks once. Render-thread only, so the cache is a plain static. Minigames are NOT read
+         *          costs two RttiCache probes (a descriptor walk only the first time that camera class is seen).
+         *          Render-thread only, so the cache is a plain static. Minigames are NOT read
          *          from the camera (only dice swaps the active camera to C_CameraMinigame; lockpicking, reading
          *          and the rest stay first-person), so they are detected separately in poll_active_minigame.
          * @param vtable Runtime vtable pointer of the active camera object.
@@ -46,11 +60,11 @@ namespace TPVCamera
             }
 
             uint32_t bits = 0;
-            if (DMK::Rtti::vtable_is_type(vtable, Constants::C_CAMERA_COMBAT_RTTI_NAME))
+            if (RttiCache::is_type(vtable, Constants::C_CAMERA_COMBAT_RTTI_NAME))
             {
                 bits = state_bit(GameState::Combat);
             }
-            else if (DMK::Rtti::vtable_is_type(vtable, Constants::C_CAMERA_DIALOG_RTTI_NAME))
+            else if (RttiCache::is_type(vtable, Constants::C_CAMERA_DIALOG_RTTI_NAME))
             {
                 bits = state_bit(GameState::Dialogue);
             }
@@ -104,7 +118,9 @@ namespace TPVCamera
         /**
          * @brief Classifies an active-minigame vtable into its child GameState bit (0 when unrecognized).
          * @details Mirrors classify_camera_vtable: caches the last vtable so the steady state inside a minigame
-         *          is one pointer compare with no RTTI walk. Render-thread only, so the cache is a plain static.
+         *          is one pointer compare with no RTTI walk, and switching between minigames is a row of RttiCache
+         *          probes rather than a descriptor walk per k_minigames entry. Render-thread only, so the last-vtable
+         *          cache is a plain static.
          * @param vtable Runtime vtable pointer of the active wh::playermodule::C_Minigame subclass.
          */
         [[nodiscard]] uint32_t classify_minigame_vtable(uintptr_t vtable) noexcept
@@ -119,7 +135,7 @@ namespace TPVCamera
             uint32_t bit = 0;
             for (const MinigameInfo &def : k_minigames)
             {
-                if (DMK::Rtti::vtable_is_type(vtable, def.rtti_name))
+                if (RttiCache::is_type(vtable, def.rtti_name))
                 {
                     bit = state_bit(def.bit);
                     break;
@@ -237,7 +253,7 @@ namespace TPVCamera
             static uintptr_t s_controller_vtable = 0;
             if (s_controller_vtable == 0)
             {
-                if (!DMK::Rtti::vtable_is_type(*vtable, Constants::C_MISSILE_CONTROLLER_RTTI_NAME))
+                if (!RttiCache::is_type(*vtable, Constants::C_MISSILE_CONTROLLER_RTTI_NAME))
                 {
                     return false;
                 }
@@ -287,7 +303,7 @@ namespace TPVCamera
             static uintptr_t s_actor_model_vtable = 0;
             if (s_actor_model_vtable == 0)
             {
-                if (!DMK::Rtti::vtable_is_type(*vtable, Constants::C_ACTOR_MODEL_RTTI_NAME))
+                if (!RttiCache::is_type(*vtable, Constants::C_ACTOR_MODEL_RTTI_NAME))
                 {
                     return 0u;
                 }
@@ -431,102 +447,168 @@ namespace TPVCamera
         return mask;
     }
 
+    void parse_state_hold_overrides(std::string_view csv, std::span<float, 32> out)
+    {
+        DMK::Logger &logger = DMK::Logger::get_instance();
+        std::fill(out.begin(), out.end(), -1.0f);
+
+        size_t start = 0;
+        while (start <= csv.size())
+        {
+            const size_t comma = csv.find(',', start);
+            const size_t end = (comma == std::string_view::npos) ? csv.size() : comma;
+            const std::string_view entry = trim_view(csv.substr(start, end - start));
+            if (!entry.empty())
+            {
+                const size_t eq = entry.find('=');
+                const std::string_view token = trim_view(entry.substr(0, eq));
+                const std::string_view number =
+                    (eq == std::string_view::npos) ? std::string_view{} : trim_view(entry.substr(eq + 1));
+                float seconds = 0.0f;
+                const auto [ptr, ec] = std::from_chars(number.data(), number.data() + number.size(), seconds);
+                const uint32_t bits = token_to_bit(token);
+                if (bits == 0 || number.empty() || ec != std::errc{} || ptr != number.data() + number.size())
+                {
+                    logger.warning("GameState: ignoring malformed hold override '{}' (expected State=Seconds)",
+                                   std::string(entry));
+                }
+                else
+                {
+                    for (uint32_t rest = bits; rest != 0; rest &= rest - 1)
+                    {
+                        out[static_cast<size_t>(std::countr_zero(rest))] = std::max(seconds, 0.0f);
+                    }
+                }
+            }
+            if (comma == std::string_view::npos)
+            {
+                break;
+            }
+            start = comma + 1;
+        }
+    }
+
     uint32_t poll_game_state(uintptr_t c_player) noexcept
     {
-        uint32_t mask = 0;
+        uint32_t ui_mask = 0;
 
         if (is_game_menu_open())
         {
-            mask |= state_bit(GameState::Menu);
+            ui_mask |= state_bit(GameState::Menu);
         }
         if (overlay_state().active.load(std::memory_order_relaxed))
         {
-            mask |= state_bit(GameState::Overlay);
+            ui_mask |= state_bit(GameState::Overlay);
         }
 
-        mask |= poll_active_camera_state();
-        // Minigames (the umbrella Minigame bit plus the specific child) come from the C_MinigameManager, not
-        // the camera, so a first-person minigame such as lockpicking is detected. c_player confirms ownership;
-        // it also works via the first-entry fallback before the player resolves.
-        mask |= poll_active_minigame(c_player);
+        // Engine-side bits from the last chain walk (see the file comment). Render-thread only, so plain statics.
+        static uint32_t s_engine_mask = 0;
+        static uint32_t s_last_ui_mask = 0;
+        static uintptr_t s_last_player = 0;
+        static bool s_walked = false;
+        static std::chrono::steady_clock::time_point s_next_walk{};
 
-        if (c_player != 0)
+        const auto now = std::chrono::steady_clock::now();
+        const bool edge = !s_walked || ui_mask != s_last_ui_mask || c_player != s_last_player;
+        if (edge || now >= s_next_walk)
         {
-            // Aiming a missile weapon: the embedded missile-weapon controller's aim flag.
-            if (poll_missile_aiming(c_player))
-            {
-                mask |= state_bit(GameState::Aiming);
-            }
-            // Every body-posture state comes from the player's current STANCE enum (wh::entitymodule::
-            // E_StanceCategory at C_ActorModel+0x80, read once): undefined=0, standing=1, lying=2, sitting=3,
-            // kneel=4, horse(mount)=5, crouch=6, cart=7. Standing /
-            // undefined carry no bit (DEFAULT preset). The active camera stays first-person for these, so the
-            // camera-state selector cannot see them; the stance can. The stance is immune to the +0x174
-            // control-override REFCOUNT false-trigger (a pickup keeps stance == 1); 1-frame transients during a
-            // stance switch are filtered by the GameState debounce.
-            switch (poll_stance(c_player))
-            {
-            case Constants::C_ACTOR_MODEL_STANCE_LYING:
-                mask |= state_bit(GameState::Lying);
-                break;
-            case Constants::C_ACTOR_MODEL_STANCE_SITTING:
-                mask |= state_bit(GameState::Sitting);
-                break;
-            case Constants::C_ACTOR_MODEL_STANCE_KNEEL:
-                mask |= state_bit(GameState::Kneel);
-                break;
-            case Constants::C_ACTOR_MODEL_STANCE_MOUNT:
-                mask |= state_bit(GameState::Mount);
-                break;
-            case Constants::C_ACTOR_MODEL_STANCE_CROUCH:
-                mask |= state_bit(GameState::Crouch);
-                break;
-            case Constants::C_ACTOR_MODEL_STANCE_CART:
-                mask |= state_bit(GameState::Cart);
-                break;
-            default:
-                break; // standing / undefined: no stance bit
+            uint32_t mask = poll_active_camera_state();
+            // Minigames (the umbrella Minigame bit plus the specific child) come from the C_MinigameManager, not
+            // the camera, so a first-person minigame such as lockpicking is detected. c_player confirms ownership;
+            // it also works via the first-entry fallback before the player resolves.
+            mask |= poll_active_minigame(c_player);
+
+            if (c_player != 0)
+            {
+                // Every body-posture state comes from the player's current STANCE enum (wh::entitymodule::
+                // E_StanceCategory at C_ActorModel+0x80, read once): undefined=0, standing=1, lying=2, sitting=3,
+                // kneel=4, horse(mount)=5, crouch=6, cart=7. Standing /
+                // undefined carry no bit (DEFAULT preset). The active camera stays first-person for these, so the
+                // camera-state selector cannot see them; the stance can. The stance is immune to the +0x174
+                // control-override REFCOUNT false-trigger (a pickup keeps stance == 1); 1-frame transients during a
+                // stance switch are filtered by the GameState debounce.
+                switch (poll_stance(c_player))
+                {
+                case Constants::C_ACTOR_MODEL_STANCE_LYING:
+                    mask |= state_bit(GameState::Lying);
+                    break;
+                case Constants::C_ACTOR_MODEL_STANCE_SITTING:
+                    mask |= state_bit(GameState::Sitting);
+                    break;
+                case Constants::C_ACTOR_MODEL_STANCE_KNEEL:
+                    mask |= state_bit(GameState::Kneel);
+                    break;
+                case Constants::C_ACTOR_MODEL_STANCE_MOUNT:
+                    mask |= state_bit(GameState::Mount);
+                    break;
+                case Constants::C_ACTOR_MODEL_STANCE_CROUCH:
+                    mask |= state_bit(GameState::Crouch);
+                    break;
+                case Constants::C_ACTOR_MODEL_STANCE_CART:
+                    mask |= state_bit(GameState::Cart);
+                    break;
+                default:
+                    break; // standing / undefined: no stance bit
+                }
             }
+
+            // Clamped so a typo cannot freeze the engine-side bits; 0 walks every call.
+            const int poll_ms = std::clamp(settings().game_state_poll_ms.load(std::memory_order_relaxed), 0, 1000);
+            s_engine_mask = mask;
+            s_last_ui_mask = ui_mask;
+            s_last_player = c_player;
+            s_walked = true;
+            s_next_walk = now + std::chrono::milliseconds(poll_ms);
         }
 
+        uint32_t mask = ui_mask | s_engine_mask;
+        // Aiming a missile weapon: the embedded missile-weapon controller's aim flag. Per call (see the file comment).
+        if (c_player != 0 && poll_missile_aiming(c_player))
+        {
+            mask |= state_bit(GameState::Aiming);
+        }
         return mask;
     }
 
     uint32_t debounce_game_state(uint32_t raw_mask, float delta_seconds, float hold_seconds) noexcept
     {
+        static_assert(k_game_state_bit_count <= 32, "the debounce lanes are the bits of a uint32_t");
         static uint32_t s_stable_mask = 0;
-        static std::array<float, k_game_state_bit_count> s_bit_timer{};
+        static uint32_t s_timing_mask = 0; // bits whose dwell timer is running (non-zero)
+        static std::array<float, 32> s_bit_timer{};
+
+        // Only a bit that differs from the stable value accumulates dwell; in a steady frame that set is empty.
+        const uint32_t differing = (raw_mask & ((1u << k_game_state_bit_count) - 1u)) ^ s_stable_mask;
 
-        if (hold_seconds <= 0.0f)
+        // A bit that went back to the stable value before its hold elapsed drops its dwell, so a transient
+        // blip never flips the stable mask.
+        for (uint32_t stale = s_timing_mask & ~differing; stale != 0; stale &= stale - 1)
         {
-            // Debounce disabled (hot-reloadable): pass through and clear the per-bit dwell so a later
-            // re-enable does not flip a bit early off a stale, partially-accumulated timer.
-            s_stable_mask = raw_mask;
-            s_bit_timer.fill(0.0f);
-            return raw_mask;
+            s_bit_timer[static_cast<size_t>(std::countr_zero(stale))] = 0.0f;
         }
 
-        for (uint32_t i = 0; i < k_game_state_bit_count; ++i)
+        const LiveSettings &cfg = settings();
+        uint32_t flips = 0;
+        for (uint32_t rest = differing; rest != 0; rest &= rest - 1)
         {
-            const uint32_t bit = 1u << i;
-            const bool raw_on = (raw_mask & bit) != 0;
-            const bool stable_on = (s_stable_mask & bit) != 0;
-            if (raw_on == stable_on)
-            {
-                // Bit already matches the stable value: reset its dwell timer so a transient blip that
-                // clears before the hold elapses never flips the stable mask.
+            const auto i = static_cast<size_t>(std::countr_zero(rest));
+            const float override_seconds = cfg.state_hold_override[i].seconds.load(std::memory_order_relaxed);
+            const float hold = override_seconds >= 0.0f ? override_seconds : hold_seconds;
+            // A hold <= 0 (hot-reloadable) passes the bit straight through, clearing any partial dwell so a
+            // later re-enable does not flip it early off a stale timer.
+            const float dwell = (hold > 0.0f) ? s_bit_timer[i] + delta_seconds : 0.0f;
+            if (dwell >= hold)
+            {
+                flips |= 1u << i;
                 s_bit_timer[i] = 0.0f;
             }
             else
             {
-                s_bit_timer[i] += delta_seconds;
-                if (s_bit_timer[i] >= hold_seconds)
-                {
-                    s_stable_mask ^= bit;
-                    s_bit_timer[i] = 0.0f;
-                }
+                s_bit_timer[i] = dwell;
             }
         }
+        s_timing_mask = differing & ~flips;
+        s_stable_mask ^= flips;
         return s_stable_mask;
     }
 
@@ -15,6 +15,7 @@
 
 #include <array>
 #include <cstdint>
+#include <span>
 #include <string_view>
 
 namespace TPVCamera
@@ -155,6 +156,16 @@ namespace TPVCamera
      */
     [[nodiscard]] uint32_t parse_state_mask(std::string_view csv);
 
+    /**
+     * @brief Parses a comma-separated "Token=Seconds" list into per-bit debounce hold overrides.
+     * @details Each token is a parse_state_mask token; its seconds (clamped to >= 0) apply to every bit it names.
+     *          Bits not listed get -1 (use StateSwitchHoldSeconds). A malformed entry is logged at WARNING level
+     *          and skipped.
+     * @param csv Override list (e.g. "Combat=0.5,Dialogue=0.1").
+     * @param out One entry per GameState mask bit.
+     */
+    void parse_state_hold_overrides(std::string_view csv, std::span<float, 32> out);
+
     /**
      * @brief Reads the current game-state bit mask from the live engine signals.
      * @details Menu and overlay come from the UI hooks; combat and dialogue from the active wh::game
@@ -163,10 +174,13 @@ namespace TPVCamera
      *          per-minigame child from the C_MinigameManager (so first-person minigames such as lockpicking
      *          are detected, not just the dice camera); mount and crouch/stealth from the player's
      *          C_ActorModel STANCE enum (mounted = 5, crouch = 6). Every
-     *          engine read is SEH-guarded, so a failed read omits that bit rather than faulting. Intended
+     *          engine read is SEH-guarded, so a failed read omits that bit rather than faulting. Menu, overlay
+     *          and aiming are read every call; the camera, minigame and stance walks run at most every
+     *          [Advanced] GameStatePollMs (and at once on a menu / overlay edge or a player change), the last
+     *          result being reused in between. Intended
      *          to be called once per frame
      *          from the camera detour (the render thread); the camera classification cache is a plain
-     *          static and is therefore not safe to call concurrently.
+     *          static (as is the walk cadence state) and is therefore not safe to call concurrently.
      * @param c_player Live C_Player address used for the mount read, or 0 to skip the mount bit.
      * @return The raw (un-debounced) GameState bit mask.
      */
@@ -174,12 +188,15 @@ namespace TPVCamera
 
     /**
      * @brief Applies per-bit hysteresis to a raw state mask so brief flicker does not pop the camera.
-     * @details A bit must differ from the stable value for at least @p hold_seconds before it flips,
-     *          so a momentary combat or dialogue transition cannot toggle a forced view on and off.
-     *          Holds file-scope state and so must be called from a single thread (the render thread).
+     * @details A bit must differ from the stable value for at least its hold time before it flips, so a
+     *          momentary combat or dialogue transition cannot toggle a forced view on and off. The hold is
+     *          @p hold_seconds unless [StateBehavior] StateHoldOverrides sets one for that bit. Bit-parallel: only
+     *          the bits in raw XOR stable (and those that just stopped differing) are visited, so a steady frame
+     *          is a compare. Holds file-scope state and so must be called from a single thread (the render
+     *          thread).
      * @param raw_mask Raw mask from poll_game_state().
      * @param delta_seconds Seconds elapsed since the previous call.
-     * @param hold_seconds Dwell time a bit must hold its new value before it flips; <= 0 disables it.
+     * @param hold_seconds Default dwell time a bit must hold its new value before it flips; <= 0 flips at once.
      * @return The debounced (stable) mask.
      */
     [[nodiscard]] uint32_t debounce_game_state(uint32_t raw_mask, float delta_seconds, float hold_seconds) noexcept;
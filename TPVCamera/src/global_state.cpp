@@ -5,6 +5,8 @@
 
 #include "global_state.hpp"
 
+#include <cstddef>
+
 // Stable unmangled symbol for the resolved game context pointer (see header).
 extern "C"
 {
@@ -31,93 +33,113 @@ namespace TPVCamera
         return state;
     }
 
+    namespace
+    {
+        // Lazy player-bounds state (render thread only, like the bounds themselves).
+        PlayerBoundsSource s_bounds_source = nullptr;
+        uintptr_t s_bounds_player = 0;
+        bool s_bounds_armed = false; // set by arm_player_world_bounds until the first read of the frame
+    } // namespace
+
+    void arm_player_world_bounds(PlayerBoundsSource source, uintptr_t c_player) noexcept
+    {
+        s_bounds_source = source;
+        s_bounds_player = c_player;
+        s_bounds_armed = true;
+        player_screen_bounds().valid = false; // never serve the previous frame's box
+    }
+
+    const PlayerScreenBounds &player_world_bounds() noexcept
+    {
+        PlayerScreenBounds &pb = player_screen_bounds();
+        if (s_bounds_armed)
+        {
+            s_bounds_armed = false;
+            if (s_bounds_source != nullptr)
+            {
+                s_bounds_source(pb, s_bounds_player);
+            }
+        }
+        return pb;
+    }
+
+    // CameraState layout check: each per-writer block must start on a fresh cache line and end before the next one
+    // begins, so a member added to the wrong place (or a dropped alignas) fails the build instead of silently
+    // reintroducing input-thread / render-thread false sharing.
+    namespace
+    {
+        constexpr std::size_t line_of(std::size_t offset) noexcept
+        {
+            return offset / k_cache_line;
+        }
+    } // namespace
+#pragma warning(push)
+#pragma warning(disable : 4324)
+    static_assert(alignof(CameraState) >= k_cache_line);
+    static_assert(offsetof(CameraState, applying) % k_cache_line == 0);
+    static_assert(offsetof(CameraState, orbit_active) % k_cache_line == 0);
+    static_assert(offsetof(CameraState, view_blend) % k_cache_line == 0);
+    static_assert(offsetof(CameraState, zoom_offset) % k_cache_line == 0);
+    static_assert(line_of(offsetof(CameraState, applying)) < line_of(offsetof(CameraState, orbit_active)));
+    static_assert(line_of(offsetof(CameraState, orbit_pad_pitch) + sizeof(float) - 1) <
+                  line_of(offsetof(CameraState, view_blend)));
+    static_assert(line_of(offsetof(CameraState, basis_quat_valid)) < line_of(offsetof(CameraState, zoom_offset)));
+    static_assert(line_of(offsetof(CameraState, eye_sync_effective) + sizeof(float) - 1) ==
+                  line_of(offsetof(CameraState, zoom_offset)));
+#pragma warning(pop)
+
     CameraState &camera_state() noexcept
     {
         static CameraState state;
         return state;
     }
 
+    void InteractionAimPose::publish(const Sample &sample) noexcept
+    {
+        for (PoseChannel<Sample> &channel : m_channels)
+            channel.publish(sample);
+        m_published_valid = sample.valid;
+    }
+
     void InteractionAimPose::store(float px, float py, float pz, float dx, float dy, float dz) noexcept
     {
-        const std::uint32_t seq = m_seq.load(std::memory_order_relaxed);
-        m_seq.store(seq + 1, std::memory_order_relaxed); // odd: write in progress
-        // Release fence: the odd-marker store cannot be reordered after the payload stores below it, so the
-        // "write in progress" sequence is established before any field changes. A reader that catches a
-        // half-written payload then sees an odd (or, after the even publish, a changed) sequence on its
-        // re-read and retries.
-        std::atomic_thread_fence(std::memory_order_release);
-        m_pos_x.store(px, std::memory_order_relaxed);
-        m_pos_y.store(py, std::memory_order_relaxed);
-        m_pos_z.store(pz, std::memory_order_relaxed);
-        m_dir_x.store(dx, std::memory_order_relaxed);
-        m_dir_y.store(dy, std::memory_order_relaxed);
-        m_dir_z.store(dz, std::memory_order_relaxed);
-        m_valid.store(true, std::memory_order_relaxed);
-        // Release fence: orders the payload stores before the even-marker publish; it pairs with the
-        // reader's acquire fence so a reader that sees the even sequence sees the whole payload.
-        std::atomic_thread_fence(std::memory_order_release);
-        m_seq.store(seq + 2, std::memory_order_relaxed); // even: published
-    }
-
-    bool InteractionAimPose::load(float &px, float &py, float &pz, float &dx, float &dy, float &dz) const noexcept
-    {
-        // Bounded seqlock read: a hook callback must not spin unboundedly, so cap the retries and fail
-        // closed if the producer is mid-publish across the cap. The producer is a single thread making
-        // forward progress, so in practice the first attempt succeeds.
-        for (int attempt = 0; attempt < 4; ++attempt)
-        {
-            const std::uint32_t before = m_seq.load(std::memory_order_acquire);
-            if (before & 1u)
-                continue; // write in progress
-            const bool valid = m_valid.load(std::memory_order_relaxed);
-            const float lpx = m_pos_x.load(std::memory_order_relaxed);
-            const float lpy = m_pos_y.load(std::memory_order_relaxed);
-            const float lpz = m_pos_z.load(std::memory_order_relaxed);
-            const float ldx = m_dir_x.load(std::memory_order_relaxed);
-            const float ldy = m_dir_y.load(std::memory_order_relaxed);
-            const float ldz = m_dir_z.load(std::memory_order_relaxed);
-            // Acquire fence pairs with the producer's release fences; the relaxed re-read then detects a
-            // publish that overlapped the payload reads.
-            std::atomic_thread_fence(std::memory_order_acquire);
-            if (m_seq.load(std::memory_order_relaxed) != before)
-                continue; // torn across the read; retry
-            if (!valid)
-                return false;
-            px = lpx;
-            py = lpy;
-            pz = lpz;
-            dx = ldx;
-            dy = ldy;
-            dz = ldz;
-            return true;
-        }
-        return false;
+        publish(Sample{{{px, py, pz}, {dx, dy, dz}}, true});
+    }
+
+    bool InteractionAimPose::load(AimPoseReader reader, float &px, float &py, float &pz, float &dx, float &dy,
+                                  float &dz) noexcept
+    {
+        const Sample &sample = m_channels[static_cast<std::size_t>(reader)].latest();
+        if (!sample.valid)
+            return false;
+        px = sample.ray.origin[0];
+        py = sample.ray.origin[1];
+        pz = sample.ray.origin[2];
+        dx = sample.ray.dir[0];
+        dy = sample.ray.dir[1];
+        dz = sample.ray.dir[2];
+        return true;
+    }
+
+    bool InteractionAimPose::load_reticle(ReticleRay &out) noexcept
+    {
+        const Sample &sample = m_channels[static_cast<std::size_t>(AimPoseReader::ReticleGate)].latest();
+        if (!sample.valid)
+            return false;
+        out = sample.ray;
+        return true;
     }
 
     void InteractionAimPose::invalidate() noexcept
     {
-        const std::uint32_t seq = m_seq.load(std::memory_order_relaxed);
-        m_seq.store(seq + 1, std::memory_order_relaxed); // odd
-        std::atomic_thread_fence(std::memory_order_release);
-        m_valid.store(false, std::memory_order_relaxed);
-        std::atomic_thread_fence(std::memory_order_release);
-        m_seq.store(seq + 2, std::memory_order_relaxed); // even
+        // Called every first-person frame; once the readers hold an invalid record there is nothing to publish.
+        if (m_published_valid)
+            publish(Sample{{{0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}, false});
     }
 
-    bool InteractionAimPose::is_valid() const noexcept
+    bool InteractionAimPose::is_valid(AimPoseReader reader) noexcept
     {
-        for (int attempt = 0; attempt < 4; ++attempt)
-        {
-            const std::uint32_t before = m_seq.load(std::memory_order_acquire);
-            if (before & 1u)
-                continue;
-            const bool valid = m_valid.load(std::memory_order_relaxed);
-            std::atomic_thread_fence(std::memory_order_acquire);
-            if (m_seq.load(std::memory_order_relaxed) != before)
-                continue;
-            return valid;
-        }
-        return false;
+        return m_channels[static_cast<std::size_t>(reader)].latest().valid;
     }
 
     InteractionAimPose &interaction_aim_pose() noexcept
@@ -138,4 +160,10 @@ namespace TPVCamera
         return ready;
     }
 
+    std::atomic<uint32_t> &world_load_generation() noexcept
+    {
+        static std::atomic<uint32_t> generation{0};
+        return generation;
+    }
+
 } // namespace TPVCamera
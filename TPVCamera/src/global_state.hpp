@@ -11,9 +11,12 @@
 #ifndef TPVCAMERA_GLOBAL_STATE_HPP
 #define TPVCAMERA_GLOBAL_STATE_HPP
 
+#include "pose_channel.hpp"
+
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <new>
 
 // Resolved base address of the game's global context. Kept as a stable unmangled symbol (rather than
 // namespaced state) so it can be located from external tooling such as Cheat Engine or x64dbg during
@@ -29,6 +32,24 @@ extern "C"
 
 namespace TPVCamera
 {
+    /// Alignment that keeps two objects off one cache line (64 on x64), for the per-writer blocks below.
+    inline constexpr std::size_t k_cache_line = std::hardware_destructive_interference_size;
+
+    /// Fixed-point scale of the pending mouse free-look deltas (CameraState::orbit_mouse_*_fx): units per degree.
+    inline constexpr double k_orbit_delta_units_per_degree = 16777216.0; // 2^24
+
+    /** @brief Converts a free-look delta in degrees to the fixed-point accumulator unit. */
+    [[nodiscard]] inline std::int64_t orbit_delta_to_fixed(float degrees) noexcept
+    {
+        return static_cast<std::int64_t>(static_cast<double>(degrees) * k_orbit_delta_units_per_degree);
+    }
+
+    /** @brief Converts a drained fixed-point free-look delta back to degrees. */
+    [[nodiscard]] inline float orbit_delta_from_fixed(std::int64_t units) noexcept
+    {
+        return static_cast<float>(static_cast<double>(units) / k_orbit_delta_units_per_degree);
+    }
+
     /** @brief Base address and image size of the resolved game module. */
     struct ModuleInfo
     {
@@ -43,7 +64,7 @@ namespace TPVCamera
     };
 
     /**
-     * @brief Live player world AABB, published once per engaged frame for the camera-collision coverage
+     * @brief Live player world AABB, evaluated at most once per engaged frame for the camera-collision coverage
      *        samplers so coverage measures the REAL posed player extent (crouch / lying / mount and the
      *        actual on-screen position) instead of a fixed synthetic body box around the pivot.
      * @details Sourced from CEntity::GetWorldBounds (constants.hpp CENTITY_VTABLE_GETWORLDBOUNDS_OFFSET).
@@ -61,6 +82,8 @@ namespace TPVCamera
         bool valid{false};
     };
 
+#pragma warning(push)
+#pragma warning(disable : 4324) // structure padded due to alignment specifier: the per-writer padding is the point
     /**
      * @brief State for the third-person camera built on the frustum-builder offset.
      * @details The camera renders a third-person view by rewriting the game view camera's matrix
@@ -69,21 +92,50 @@ namespace TPVCamera
      */
     struct CameraState
     {
+        // The members are grouped by WRITER into blocks that each start on their own cache line (alignas
+        // k_cache_line), so the input dispatch thread's per-event orbit writes, the render thread's per-frame
+        // smoother state and the overlay-facing read-outs never false-share a line. A new member goes in the
+        // block of the thread that writes it; global_state.cpp static_asserts the block boundaries.
+
+        // ---- Control: toggled by the hotkey thread, read by the render thread every frame ----
         // Runtime on/off of the offset, flipped by the view hotkeys. Starts off (first-person)
         // so the game looks normal on load until the player toggles the third-person view.
-        std::atomic<bool> applying{false};
+        alignas(k_cache_line) std::atomic<bool> applying{false};
 
-        // Zoom offset from the configured base distance, driven by the zoom hold keys
-        // (polled per frame in the detour). Keeping zoom as a delta from the INI
-        // FollowDistance (rather than an absolute value) is what lets an INI edit apply
-        // live: the base is re-read every frame and the rendered distance follows
-        // immediately, while the player's accumulated zoom is preserved on top.
-        std::atomic<float> zoom_offset{0.0f};
+        // ---- Input dispatch thread: free-look capture (written per input event) ----
+        // Free-look orbit. While orbit_active (the orbit key is toggled on), the input
+        // dispatcher hook captures mouse-look deltas and blocks the look events so the player
+        // aim stays put; the render hook circles the camera around the player by orbit_yaw /
+        // orbit_pitch (degrees). On release the angles ease back to the configured initial
+        // yaw/pitch. orbit_active is written by the input poll thread and read by the render
+        // thread. The angles are advanced only by the render hook; the engage / re-seed paths
+        // reset them from other threads, so they stay atomic.
+        alignas(k_cache_line) std::atomic<bool> orbit_active{false};
+        std::atomic<float> orbit_yaw{0.0f};
+        std::atomic<float> orbit_pitch{0.0f};
+
+        // Pending mouse free-look deltas, already scaled by the orbit sensitivity, in fixed point
+        // (orbit_delta_to_fixed). The input hook posts each look event with ONE plain fetch_add -- no float
+        // read-modify-write racing the render thread -- and the render hook drains both with an exchange once
+        // per frame, folding the exact integer sum into orbit_yaw/orbit_pitch (the pitch is clamped after the
+        // sum). At 2^24 units per degree an event's rounding is far below a pixel of mouse travel.
+        std::atomic<std::int64_t> orbit_mouse_yaw_fx{0};
+        std::atomic<std::int64_t> orbit_mouse_pitch_fx{0};
 
+        // Gamepad right-stick look DEFLECTION (-1..1), latched by the input hook while orbiting. The mouse
+        // posts relative deltas into orbit_mouse_*_fx per event; the analog stick instead
+        // reports a HELD position, so it is latched here and integrated by rate (with delta_time) in the
+        // render hook -- holding the stick keeps orbiting, frame-rate independent. Cleared to 0 when not
+        // orbiting so re-engaging with the stick centred does not jump. Written on the input thread, read
+        // (and cleared) on the render thread; relaxed atomics (a one-frame-stale deflection is harmless).
+        std::atomic<float> orbit_pad_yaw{0.0f};
+        std::atomic<float> orbit_pad_pitch{0.0f};
+
+        // ---- Render thread only: per-frame smoother / carry-over state (plain members) ----
         // First-person <-> third-person view-switch blend (render thread only): 0 = first person,
         // 1 = third person. Eased toward the target view each frame (smoothstepped at use) so toggling
         // and UI suppression slide instead of snapping. NOT reset on suppression -- it eases back to 0.
-        float view_blend{0.0f};
+        alignas(k_cache_line) float view_blend{0.0f};
 
         // Camera-collision carry-over, touched only by the frustum-builder detour (the game's
         // render thread), so it needs no synchronization. The allowed follow distance after the
@@ -124,25 +176,6 @@ namespace TPVCamera
         // heading -- the camera never pops. Render-thread only.
         float orbit_yaw_at_capture_deg{0.0f};
 
-        // Free-look orbit. While orbit_active (the orbit key is toggled on), the input
-        // dispatcher hook captures mouse-look deltas into orbit_yaw/orbit_pitch (degrees)
-        // and blocks the look events so the player aim stays put; the render hook circles
-        // the camera around the player by those angles. On release the angles ease back to
-        // the configured initial yaw/pitch. orbit_active is written by the input poll thread
-        // and read by the render thread, the angles by both, so all are atomic.
-        std::atomic<bool> orbit_active{false};
-        std::atomic<float> orbit_yaw{0.0f};
-        std::atomic<float> orbit_pitch{0.0f};
-
-        // Gamepad right-stick look DEFLECTION (-1..1), latched by the input hook while orbiting. The mouse
-        // posts relative deltas straight into orbit_yaw/orbit_pitch per event; the analog stick instead
-        // reports a HELD position, so it is latched here and integrated by rate (with delta_time) in the
-        // render hook -- holding the stick keeps orbiting, frame-rate independent. Cleared to 0 when not
-        // orbiting so re-engaging with the stick centred does not jump. Written on the input thread, read
-        // (and cleared) on the render thread; relaxed atomics (a one-frame-stale deflection is harmless).
-        std::atomic<float> orbit_pad_yaw{0.0f};
-        std::atomic<float> orbit_pad_pitch{0.0f};
-
         // Orbit angle low-pass (render thread only). The rendered orbit yaw/pitch (degrees) ease toward
         // the raw accumulated orbit_yaw/orbit_pitch target each frame, so free-look is not as jittery as
         // the raw per-frame mouse deltas: the engine smooths native look DOWNSTREAM of the input dispatch
@@ -174,17 +207,10 @@ namespace TPVCamera
         // eased effective eye height: it re-anchors to the REAL first-person eye when a low pose (kneel /
         // pray, and other poses EyeHeight does not model) drops it OUT of range of the configured height,
         // where a fixed height floats the camera too high. eye_sync_valid is cleared on suppression so the
-        // next engaged frame snaps to the current pose instead of easing across the gap. real_eye_height is
-        // the live FP-eye height above the body root, published each engaged frame for the overlay read-out
-        // (and is the sync source); atomic because the overlay thread reads it.
+        // next engaged frame snaps to the current pose instead of easing across the gap. The sync source,
+        // real_eye_height, is published in the overlay block below.
         float eye_sync_applied{0.0f};
         bool eye_sync_valid{false};
-        std::atomic<float> real_eye_height{0.0f};
-        // Published live for the overlay status line: eye_sync_engaged = the dynamic sync is actively
-        // re-anchoring to the real eye (a low pose is out of range) vs. idle (the configured Eye Height is in
-        // effect); eye_sync_effective = the eye height actually applied this frame. Overlay thread reads.
-        std::atomic<bool> eye_sync_engaged{false};
-        std::atomic<float> eye_sync_effective{0.0f};
 
         // Per-preset FOV override ease (render thread only). fov_ease_applied is the eased rendered FOV
         // (radians) written into the render CCamera; fov_ease_stage1 is the 2-stage critically-damped
@@ -206,6 +232,44 @@ namespace TPVCamera
         float basis_quat_z{0.0f};
         float basis_quat_w{1.0f};
         bool basis_quat_valid{false};
+
+        // ---- Render thread -> overlay thread: published read-outs (and the overlay's zoom reset) ----
+        // Zoom offset from the configured base distance, driven by the zoom hold keys
+        // (polled per frame in the detour). Keeping zoom as a delta from the INI
+        // FollowDistance (rather than an absolute value) is what lets an INI edit apply
+        // live: the base is re-read every frame and the rendered distance follows
+        // immediately, while the player's accumulated zoom is preserved on top.
+        alignas(k_cache_line) std::atomic<float> zoom_offset{0.0f};
+
+        // Live FP-eye height above the body root, published each engaged frame for the overlay read-out (and
+        // the dynamic eye-sync source); atomic because the overlay thread reads it.
+        std::atomic<float> real_eye_height{0.0f};
+        // Published live for the overlay status line: eye_sync_engaged = the dynamic sync is actively
+        // re-anchoring to the real eye (a low pose is out of range) vs. idle (the configured Eye Height is in
+        // effect); eye_sync_effective = the eye height actually applied this frame. Overlay thread reads.
+        std::atomic<bool> eye_sync_engaged{false};
+        std::atomic<float> eye_sync_effective{0.0f};
+    };
+#pragma warning(pop)
+
+    /** @brief The consumers of InteractionAimPose; each one samples its own channel (see PoseChannel). */
+    enum class AimPoseReader : std::uint8_t
+    {
+        LookRay,     ///< the ray-query builder detour (look-ray redirect)
+        ReticleGate, ///< the on-screen reticle projection detour
+        Count
+    };
+
+    /**
+     * @brief The crosshair ray in the form the on-screen reticle gate tests candidates against.
+     * @details Sampled whole per candidate, so the per-candidate test is one subtraction, a dot and a cross
+     *          product: with v = p - origin (small, so nothing large cancels), t = dot(v, dir) is the point's
+     *          distance along the ray and |cross(v, dir)|^2 its squared distance off it.
+     */
+    struct ReticleRay
+    {
+        float origin[3];
+        float dir[3]; // unit crosshair direction
     };
 
     /**
@@ -218,56 +282,58 @@ namespace TPVCamera
      *          cone onto the screen centre. A published pose is valid ONLY while the offset is engaged (in
      *          first person the camera IS the eye, so the hook leaves the game untouched).
      *
-     *          The pose is published as a tear-free seqlock snapshot. The producer and consumer run at
-     *          different points of the frame (and possibly on different threads), so reading the seven
-     *          fields independently could mix a position from frame N with a direction from frame N+1 --
-     *          an incoherent pose, not merely a stale one, which would aim the interaction ray at nothing.
-     *          The seqlock makes every read observe one coherent frame or fail closed (no pose). A
-     *          one-frame-stale but coherent pose is harmless for use-target selection.
+     *          The producer and consumers run at different points of the frame (and possibly on different
+     *          threads), so reading the fields independently could mix a position from frame N with a
+     *          direction from frame N+1 -- an incoherent pose, not merely a stale one, which would aim the
+     *          interaction ray at nothing. Each reader therefore samples whole records from its own
+     *          PoseChannel (the producer publishes every record to all of them): always one coherent frame,
+     *          never a retry, and never a wait on the render thread. A one-frame-stale but coherent pose is
+     *          harmless for use-target selection.
      */
     class InteractionAimPose
     {
     public:
         /**
          * @brief Publishes a coherent pose snapshot (camera position + crosshair direction) as valid.
-         * @details Seqlock writer: marks the sequence odd, writes the payload behind a release fence,
-         *          then marks it even to publish. Single-producer (the frustum-builder detour is the only
-         *          writer). Callback-safe: no allocation, no lock.
+         * @details Single-producer (the frustum-builder detour is the only writer). Callback-safe: no
+         *          allocation, no lock, no wait.
          */
         void store(float px, float py, float pz, float dx, float dy, float dz) noexcept;
 
         /**
-         * @brief Reads a coherent pose snapshot.
+         * @brief Reads the latest pose snapshot published to @p reader.
          * @param px,py,pz Filled with the rendered camera position (the new cone origin).
          * @param dx,dy,dz Filled with the crosshair direction (the new scoring axis).
-         * @return true and fills the out params when a valid tear-free pose was read; false when no pose
-         *         is published or the read could not be confirmed tear-free (the out params are untouched).
-         * @note Callback-safe: a bounded retry caps the seqlock spin and fails closed.
+         * @return true and fills the out params when a valid pose is published; false when none is (the out
+         *         params are untouched).
+         * @note Callback-safe and wait-free. Call each reader from one thread only.
          */
-        [[nodiscard]] bool load(float &px, float &py, float &pz, float &dx, float &dy, float &dz) const noexcept;
+        [[nodiscard]] bool load(AimPoseReader reader, float &px, float &py, float &pz, float &dx, float &dy,
+                                float &dz) noexcept;
+
+        /**
+         * @brief Reads the latest pose as a ReticleRay (AimPoseReader::ReticleGate's channel).
+         * @return true and fills @p out when a valid pose is published; false otherwise.
+         */
+        [[nodiscard]] bool load_reticle(ReticleRay &out) noexcept;
 
         /// Marks the published pose invalid (first person / offset suppressed).
         void invalidate() noexcept;
 
-        /// Returns whether a valid pose is currently published (tear-free seqlock read of the flag).
-        [[nodiscard]] bool is_valid() const noexcept;
+        /// Returns whether a valid pose is currently published to @p reader.
+        [[nodiscard]] bool is_valid(AimPoseReader reader) noexcept;
 
     private:
-        // Seqlock sequence: even = stable, odd = write in progress. The producer brackets its payload
-        // writes between the odd and even transitions; a reader retries while it observes an odd or
-        // changed sequence, so a partially written pose is never returned.
-        std::atomic<std::uint32_t> m_seq{0};
-        // Pose payload. The seqlock sequence provides coherence (no mixed frame) and the release/acquire
-        // fences provide the publish ordering; the fields are relaxed atomics (not plain) so a producer
-        // store racing a consumer load is well-defined rather than a data race, which keeps the seqlock
-        // correct on any memory model, not just x86 TSO.
-        std::atomic<float> m_pos_x{0.0f};
-        std::atomic<float> m_pos_y{0.0f};
-        std::atomic<float> m_pos_z{0.0f};
-        std::atomic<float> m_dir_x{0.0f};
-        std::atomic<float> m_dir_y{1.0f};
-        std::atomic<float> m_dir_z{0.0f};
-        std::atomic<bool> m_valid{false};
+        struct Sample
+        {
+            ReticleRay ray;
+            bool valid;
+        };
+
+        void publish(const Sample &sample) noexcept;
+
+        PoseChannel<Sample> m_channels[static_cast<std::size_t>(AimPoseReader::Count)];
+        bool m_published_valid = false; // producer-only: skips re-publishing an already invalid pose
     };
 
     /** @brief Returns the process-wide resolved game module info. */
@@ -277,6 +343,21 @@ namespace TPVCamera
 
     /** @brief Returns the live player world AABB published for the camera-collision coverage samplers. */
     [[nodiscard]] PlayerScreenBounds &player_screen_bounds() noexcept;
+
+    /// Fills @p bounds for @p c_player (the engine read lives in camera_hook.cpp); see arm_player_world_bounds().
+    using PlayerBoundsSource = void (*)(PlayerScreenBounds &bounds, uintptr_t c_player);
+
+    /**
+     * @brief Arms this frame's player bounds for @p c_player without reading them.
+     * @details Called by the frustum detour ahead of the coverage walk. The bounds are then computed by
+     *          @p source on the first player_world_bounds() call of the frame and reused by every later one, so
+     *          a frame whose walk never measures coverage never calls into the engine, and a walk that measures
+     *          several occluders reads them once. Render thread only.
+     */
+    void arm_player_world_bounds(PlayerBoundsSource source, uintptr_t c_player) noexcept;
+
+    /** @brief This frame's player bounds for the coverage samplers, evaluated on first use after arming. */
+    [[nodiscard]] const PlayerScreenBounds &player_world_bounds() noexcept;
     /** @brief Returns the third-person camera state. */
     [[nodiscard]] CameraState &camera_state() noexcept;
 
@@ -299,6 +380,14 @@ namespace TPVCamera
      */
     [[nodiscard]] std::atomic<bool> &game_world_ready() noexcept;
 
+    /**
+     * @brief World-load generation, bumped whenever the live CActionGame or C_Player pointer changes.
+     * @details The self-heal retry gate (offset_heal.cpp) re-runs a still-unresolved landmark's full scan once
+     *          per generation, so a level or save load gets a fresh attempt without a per-frame retry cadence.
+     *          Written by the camera detour (render thread).
+     */
+    [[nodiscard]] std::atomic<uint32_t> &world_load_generation() noexcept;
+
 } // namespace TPVCamera
 
 #endif // TPVCAMERA_GLOBAL_STATE_HPP
@@ -0,0 +1,161 @@
+/**
+ * @file health.cpp
+ * @brief Fault / fallback counters, their per-second rates and the per-frame slow-path histogram (see health.hpp).
+ */
+
+#include "health.hpp"
+#include "alloc_stats.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <windows.h>
+
+#include <atomic>
+#include <bit>
+#include <iterator>
+
+namespace TPVCamera::Health
+{
+
+    namespace
+    {
+        constexpr const char *k_site_names[] = {
+            "Ray fault",
+            "Sweep fault",
+            "Sweep unavailable",
+            "Sweep contention",
+            "Coverage fault",
+            "Raster job fault",
+            "Collision region fault",
+            "Physics coverage fallback",
+            "Self-heal miss",
+        };
+        static_assert(std::size(k_site_names) == k_site_count, "one name per Health::Site");
+
+        constexpr const char *k_bucket_names[k_histogram_buckets] = {"0", "1", "2-3", "4-7", "8+"};
+
+        // Written by note() on any thread; each counter on its own line so the raster helpers do not share one.
+        struct alignas(64) Counter
+        {
+            std::atomic<std::uint64_t> value{0};
+        };
+        Counter s_totals[k_site_count];
+        Counter s_frame_notes;
+
+        // Published by end_frame() on the render thread, read by stats() on the overlay / input thread.
+        std::atomic<float> s_rates[k_site_count] = {};
+        std::atomic<std::uint64_t> s_histogram[k_histogram_buckets] = {};
+
+        // Render-thread-only rate window.
+        std::uint64_t s_window_base[k_site_count] = {};
+        std::int64_t s_window_start = 0;
+
+        std::int64_t qpc_now() noexcept
+        {
+            LARGE_INTEGER t{};
+            QueryPerformanceCounter(&t);
+            return t.QuadPart;
+        }
+
+        std::int64_t qpc_frequency() noexcept
+        {
+            static const std::int64_t k_frequency = []
+            {
+                LARGE_INTEGER freq{};
+                QueryPerformanceFrequency(&freq);
+                return freq.QuadPart;
+            }();
+            return k_frequency;
+        }
+
+        std::size_t bucket_of(std::uint64_t notes) noexcept
+        {
+            // 0 -> 0, 1 -> 1, 2-3 -> 2, 4-7 -> 3, 8+ -> 4: the bit width, capped.
+            const auto width = static_cast<std::size_t>(std::bit_width(notes));
+            return width < k_histogram_buckets ? width : k_histogram_buckets - 1;
+        }
+    } // namespace
+
+    void note(Site site) noexcept
+    {
+        const auto i = static_cast<std::size_t>(site);
+        if (i >= k_site_count)
+        {
+            return;
+        }
+        s_totals[i].value.fetch_add(1, std::memory_order_relaxed);
+        s_frame_notes.value.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void end_frame() noexcept
+    {
+        // A note() on a helper thread racing the exchange lands in this frame or the next; either is fine here.
+        const std::uint64_t notes = s_frame_notes.value.exchange(0, std::memory_order_relaxed);
+        s_histogram[bucket_of(notes)].fetch_add(1, std::memory_order_relaxed);
+
+        const std::int64_t now = qpc_now();
+        const std::int64_t freq = qpc_frequency();
+        if (s_window_start == 0)
+        {
+            s_window_start = now;
+            return;
+        }
+        const std::int64_t elapsed = now - s_window_start;
+        if (freq <= 0 || elapsed < freq)
+        {
+            return;
+        }
+        const double seconds = static_cast<double>(elapsed) / static_cast<double>(freq);
+        for (std::size_t i = 0; i < k_site_count; ++i)
+        {
+            const std::uint64_t total = s_totals[i].value.load(std::memory_order_relaxed);
+            s_rates[i].store(static_cast<float>(static_cast<double>(total - s_window_base[i]) / seconds),
+                             std::memory_order_relaxed);
+            s_window_base[i] = total;
+        }
+        s_window_start = now;
+    }
+
+    Stats stats() noexcept
+    {
+        Stats s;
+        for (std::size_t i = 0; i < k_site_count; ++i)
+        {
+            s.total[i] = s_totals[i].value.load(std::memory_order_relaxed);
+            s.per_second[i] = s_rates[i].load(std::memory_order_relaxed);
+        }
+        for (std::size_t i = 0; i < k_histogram_buckets; ++i)
+        {
+            s.histogram[i] = s_histogram[i].load(std::memory_order_relaxed);
+        }
+        return s;
+    }
+
+    const char *site_name(Site site) noexcept
+    {
+        const auto i = static_cast<std::size_t>(site);
+        return (i < k_site_count) ? k_site_names[i] : "?";
+    }
+
+    const char *bucket_name(std::size_t i) noexcept
+    {
+        return (i < k_histogram_buckets) ? k_bucket_names[i] : "?";
+    }
+
+    void dump_to_log()
+    {
+        const Stats s = stats();
+        DMK::Logger &logger = DMK::Logger::get_instance();
+        logger.info("Health: fault and fallback counters since launch (total, per second over the last window)");
+        for (std::size_t i = 0; i < k_site_count; ++i)
+        {
+            logger.info("Health:   {:<26} {:>10} {:>8.1f}/s", k_site_names[i], s.total[i], s.per_second[i]);
+        }
+        logger.info("Health: game-view frames by slow paths taken: 0: {}, 1: {}, 2-3: {}, 4-7: {}, 8+: {}",
+                    s.histogram[0], s.histogram[1], s.histogram[2], s.histogram[3], s.histogram[4]);
+#if TPVCAMERA_ALLOC_STATS
+        AllocStats::dump_to_log();
+#endif
+    }
+
+} // namespace TPVCamera::Health
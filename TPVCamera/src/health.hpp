@@ -0,0 +1,87 @@
+/**
+ * @file health.hpp
+ * @brief Session counters for the SEH fault sites and the degraded (fallback) paths, shown as a health readout.
+ *
+ * @details Each site that swallows a fault, or that gives up on the preferred path and takes a slower or coarser
+ *          one, calls note() with its Site. note() is one relaxed fetch_add, so it is fine inside an __except body
+ *          and on the raster helper threads. The render thread calls end_frame() once per game-view frame, which:
+ *            - folds the frame's note() count into a per-frame histogram (0, 1, 2-3, 4-7, 8+ slow paths);
+ *            - about once a second, turns the counters' growth since the last refresh into per-second rates.
+ *          The overlay's Performance section reads stats(), and [Settings] DumpHealthKey writes the same figures to
+ *          the log (dump_to_log()), so a user report can carry them. The counters never reset within a session.
+ */
+#ifndef TPVCAMERA_HEALTH_HPP
+#define TPVCAMERA_HEALTH_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace TPVCamera::Health
+{
+
+    /// A counted fault or fallback site.
+    enum class Site : std::uint8_t
+    {
+        RayFault,          // an engine ray call faulted under its own guard (a miss)
+        SweepFault,        // the sphere sweep faulted under its own guard (the thin-ray fan is used)
+        SweepUnavailable,  // the sphere sweep could not resolve the world or its vtable slot (the fan is used)
+        SweepContention,   // the sphere sweep stalled on the world mutex, or reused a stale result while deferred
+        CoverageFault,     // a render-mesh coverage raster faulted (the node is skipped)
+        RasterJobFault,    // a chunk of a parallel raster job faulted (the measure is dropped)
+        RegionFault,       // the outer collision SEH region faulted (the frame held last frame's distance)
+        PhysicsCoverage,   // coverage used the physics-ray estimate (render mesh unusable, or governor physics-only)
+        HealMiss,          // a self-heal landmark did not resolve (the nominal offset was kept)
+        Count
+    };
+
+    inline constexpr std::size_t k_site_count = static_cast<std::size_t>(Site::Count);
+
+    /// Buckets of the per-frame slow-path histogram: 0, 1, 2-3, 4-7, 8 or more.
+    inline constexpr std::size_t k_histogram_buckets = 5;
+
+    /** @brief Counts one pass through @p site. Any thread; safe inside an __except body. */
+    void note(Site site) noexcept;
+
+    /** @brief Closes the frame's histogram sample and refreshes the rates when due. Render thread only. */
+    void end_frame() noexcept;
+
+    /**
+     * @class FrameScope
+     * @brief end_frame() when the enclosing scope exits, so every return of the detour closes the sample.
+     */
+    class FrameScope
+    {
+    public:
+        FrameScope() noexcept = default;
+        ~FrameScope() noexcept { end_frame(); }
+        FrameScope(const FrameScope &) = delete;
+        FrameScope &operator=(const FrameScope &) = delete;
+    };
+
+    /**
+     * @struct Stats
+     * @brief Session snapshot for the overlay and the log dump.
+     */
+    struct Stats
+    {
+        std::uint64_t total[k_site_count] = {};           // passes per site since the game started
+        float per_second[k_site_count] = {};              // over the last refresh window (about one second)
+        std::uint64_t histogram[k_histogram_buckets] = {}; // game-view frames by their slow-path count
+    };
+
+    [[nodiscard]] Stats stats() noexcept;
+
+    [[nodiscard]] const char *site_name(Site site) noexcept;
+
+    /// Label of histogram bucket @p i ("0", "1", "2-3", "4-7", "8+").
+    [[nodiscard]] const char *bucket_name(std::size_t i) noexcept;
+
+    /**
+     * @brief Logs stats() at Info, one line per site plus the histogram, then AllocStats::dump_to_log() in a
+     *        TPVCAMERA_ALLOC_STATS build. Any thread.
+     */
+    void dump_to_log();
+
+} // namespace TPVCamera::Health
+
+#endif // TPVCAMERA_HEALTH_HPP
@@ -25,17 +25,32 @@
 
 #include "camera_hook.hpp"
 #include "aob_resolver.hpp"
+#include "benchmark.hpp"
+#include "collision_governor.hpp"
+#include "collision_heatmap.hpp"
 #include "constants.hpp"
 #include "config.hpp"
+#include "coverage_cache.hpp"
+#include "frame_arena.hpp"
+#include "frame_clock.hpp"
+#include "frame_profiler.hpp"
 #include "global_state.hpp"
 #include "game_state.hpp"
 #include "game_structures.hpp"
+#include "health.hpp"
+#include "hot_block.hpp"
 #include "offset_heal.hpp"
 #include "math_utils.hpp"
 #include "physics_raycast.hpp"
 #include "render_occlusion.hpp"
+#include "rtti_cache.hpp"
+#include "seh_region.hpp"
+#include "simd_math.hpp"
+#include "telemetry.hpp"
+#include "trace_ring.hpp"
 #include "hooks/ui_menu_hooks.hpp"
 #include "hooks/player_onaction_hook.hpp"
+#include "overlay/overlay.hpp"
 #include "presets/preset_runtime.hpp"
 
 #include <DetourModKit.hpp>
@@ -43,13 +58,16 @@
 #include <windows.h>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <cmath>
 #include <cstdint>
+#include <new>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 
 namespace TPVCamera
 {
@@ -59,11 +77,212 @@ namespace TPVCamera
     // here, before the cull planes are computed, moves the rendered view AND its culling together.
     using FrustumBuildFunc = uintptr_t(__fastcall *)(uintptr_t camera);
 
+    /**
+     * @struct RenderSettings
+     * @brief Plain copy of every LiveSettings value the frustum detour and the collision stages read.
+     * @details The detour reads its settings through render_settings() as a const struct instead of one relaxed
+     *          atomic load per use, so the collision stages can keep them in registers across their loops. The copy
+     *          is refreshed only when LiveSettings::preset_version (a preset blend wrote the preset-owned fields) or
+     *          LiveSettings::settings_version (an INI reload wrote the rest) moved; a converged
+     *          preset and an untouched INI leave it as is. Render thread only.
+     */
+    struct RenderSettings
+    {
+        uint32_t preset_version = ~0u;
+        uint32_t settings_version = ~0u;
+        // Preset-owned framing and orbit feel.
+        float follow_distance = 0.0f;
+        float follow_distance_min = 0.0f;
+        float follow_distance_max = 0.0f;
+        float zoom_step = 0.0f;
+        float offset_up = 0.0f;
+        float eye_height = 0.0f;
+        bool dynamic_eye_sync = false;
+        float offset_right = 0.0f;
+        float aim_focus_distance = 0.0f;
+        float follow_yaw = 0.0f;
+        float follow_pitch = 0.0f;
+        float fov = 0.0f;
+        float gamepad_orbit_speed_x = 0.0f;
+        float gamepad_orbit_speed_y = 0.0f;
+        float orbit_pitch_min = 0.0f;
+        float orbit_pitch_max = 0.0f;
+        float orbit_return_speed = 0.0f;
+        float orbit_smoothing = 0.0f;
+        bool orbit_level_aim = false;
+        bool orbit_body_turn = false;
+        bool orbit_continuous_align = false;
+        bool enable_collision = false;
+        float collision_skin = 0.0f;
+        float collision_return_speed = 0.0f;
+        // INI collision settings.
+        bool use_coverage_collision = false;
+        bool use_sphere_collision = false;
+        float collision_radius = 0.0f;
+        float collision_coverage_threshold = 0.0f;
+        float head_visible_skip = 0.0f;
+        float camera_probe_size = 0.0f;
+        bool use_render_occlusion = false;
+        bool async_collision = false;
+        bool pipelined_collision = false;
+        bool non_blocking_sweep = false;
+        bool use_collision_lod = false;
+        int collision_budget_us = 0;
+        bool collision_seh_region = false;
+        bool collision_heatmap = false;
+        // INI state policy and camera settings.
+        bool freeze_orbit_on_cursor = false;
+        bool enable_state_behavior = false;
+        uint32_t forced_fpv_mask = 0;
+        uint32_t forced_tpv_mask = 0;
+        uint32_t orbit_exclude_mask = 0;
+        float state_switch_hold_seconds = 0.0f;
+        float preset_blend_speed = 0.0f;
+        float view_transition_duration = 0.0f;
+        bool stable_aim_basis = false;
+        float aim_basis_smoothing = 0.0f;
+    };
+
+    static_assert(sizeof(RenderSettings) <= k_hot_render_settings_bytes && alignof(RenderSettings) <= k_cache_line,
+                  "RenderSettings must fit its lines in the detour hot block");
+    static_assert(std::is_trivially_destructible_v<RenderSettings>, "the hot-block copy is never destroyed");
+
+    /// The copy lives in the detour hot block (hot_block.hpp); initialize_camera constructs it.
+    [[nodiscard]] static RenderSettings &render_settings_copy() noexcept
+    {
+        return *std::launder(reinterpret_cast<RenderSettings *>(detour_hot_block().render_settings));
+    }
+
+    /** @brief Copies the RenderSettings fields out of @p cfg. */
+    static void capture_render_settings(const LiveSettings &cfg, RenderSettings &out) noexcept
+    {
+        out.follow_distance = cfg.follow_distance.load(std::memory_order_relaxed);
+        out.follow_distance_min = cfg.follow_distance_min.load(std::memory_order_relaxed);
+        out.follow_distance_max = cfg.follow_distance_max.load(std::memory_order_relaxed);
+        out.zoom_step = cfg.zoom_step.load(std::memory_order_relaxed);
+        out.offset_up = cfg.offset_up.load(std::memory_order_relaxed);
+        out.eye_height = cfg.eye_height.load(std::memory_order_relaxed);
+        out.dynamic_eye_sync = cfg.dynamic_eye_sync.load(std::memory_order_relaxed);
+        out.offset_right = cfg.offset_right.load(std::memory_order_relaxed);
+        out.aim_focus_distance = cfg.aim_focus_distance.load(std::memory_order_relaxed);
+        out.follow_yaw = cfg.follow_yaw.load(std::memory_order_relaxed);
+        out.follow_pitch = cfg.follow_pitch.load(std::memory_order_relaxed);
+        out.fov = cfg.fov.load(std::memory_order_relaxed);
+        out.gamepad_orbit_speed_x = cfg.gamepad_orbit_speed_x.load(std::memory_order_relaxed);
+        out.gamepad_orbit_speed_y = cfg.gamepad_orbit_speed_y.load(std::memory_order_relaxed);
+        out.orbit_pitch_min = cfg.orbit_pitch_min.load(std::memory_order_relaxed);
+        out.orbit_pitch_max = cfg.orbit_pitch_max.load(std::memory_order_relaxed);
+        out.orbit_return_speed = cfg.orbit_return_speed.load(std::memory_order_relaxed);
+        out.orbit_smoothing = cfg.orbit_smoothing.load(std::memory_order_relaxed);
+        out.orbit_level_aim = cfg.orbit_level_aim.load(std::memory_order_relaxed);
+        out.orbit_body_turn = cfg.orbit_body_turn.load(std::memory_order_relaxed);
+        out.orbit_continuous_align = cfg.orbit_continuous_align.load(std::memory_order_relaxed);
+        out.enable_collision = cfg.enable_collision.load(std::memory_order_relaxed);
+        out.collision_skin = cfg.collision_skin.load(std::memory_order_relaxed);
+        out.collision_return_speed = cfg.collision_return_speed.load(std::memory_order_relaxed);
+        out.use_coverage_collision = cfg.use_coverage_collision.load(std::memory_order_relaxed);
+        out.use_sphere_collision = cfg.use_sphere_collision.load(std::memory_order_relaxed);
+        out.collision_radius = cfg.collision_radius.load(std::memory_order_relaxed);
+        out.collision_coverage_threshold = cfg.collision_coverage_threshold.load(std::memory_order_relaxed);
+        out.head_visible_skip = cfg.head_visible_skip.load(std::memory_order_relaxed);
+        out.camera_probe_size = cfg.camera_probe_size.load(std::memory_order_relaxed);
+        out.use_render_occlusion = cfg.use_render_occlusion.load(std::memory_order_relaxed);
+        out.async_collision = cfg.async_collision.load(std::memory_order_relaxed);
+        out.pipelined_collision = cfg.pipelined_collision.load(std::memory_order_relaxed);
+        out.non_blocking_sweep = cfg.non_blocking_sweep.load(std::memory_order_relaxed);
+        out.use_collision_lod = cfg.use_collision_lod.load(std::memory_order_relaxed);
+        out.collision_budget_us = cfg.collision_budget_us.load(std::memory_order_relaxed);
+        out.collision_seh_region = cfg.collision_seh_region.load(std::memory_order_relaxed);
+        out.collision_heatmap = cfg.collision_heatmap.load(std::memory_order_relaxed);
+        out.freeze_orbit_on_cursor = cfg.freeze_orbit_on_cursor.load(std::memory_order_relaxed);
+        out.enable_state_behavior = cfg.enable_state_behavior.load(std::memory_order_relaxed);
+        out.forced_fpv_mask = cfg.forced_fpv_mask.load(std::memory_order_relaxed);
+        out.forced_tpv_mask = cfg.forced_tpv_mask.load(std::memory_order_relaxed);
+        out.orbit_exclude_mask = cfg.orbit_exclude_mask.load(std::memory_order_relaxed);
+        out.state_switch_hold_seconds = cfg.state_switch_hold_seconds.load(std::memory_order_relaxed);
+        out.preset_blend_speed = cfg.preset_blend_speed.load(std::memory_order_relaxed);
+        out.view_transition_duration = cfg.view_transition_duration.load(std::memory_order_relaxed);
+        out.stable_aim_basis = cfg.stable_aim_basis.load(std::memory_order_relaxed);
+        out.aim_basis_smoothing = cfg.aim_basis_smoothing.load(std::memory_order_relaxed);
+    }
+
+    /** @brief True when a setting that queries the render octree (GetObjectsInBox) is on. */
+    [[nodiscard]] static bool wants_render_octree(const RenderSettings &cfg) noexcept
+    {
+        return cfg.use_render_occlusion || cfg.use_coverage_collision;
+    }
+
+    /**
+     * @brief Sets up the render-octree query once an INI reload has resolved its anchor. Render thread only.
+     * @details With UseRenderOcclusion and UseCoverageCollision both off at startup the GetObjectsInBox anchor is
+     *          not resolved (AnchorFeature::RenderOctree); the reload that enables one resolves it on its own thread
+     *          before bumping settings_version, so the in-world settings refresh that follows adopts it here. An
+     *          anchor still at 0 (a real cascade miss, already warned about) is a load and a return.
+     */
+    static void adopt_render_octree()
+    {
+        if (detour_hot_block().get_objects_in_box != nullptr || anchor_address(AnchorId::GetObjectsInBox) == 0)
+        {
+            return;
+        }
+        (void)initialize_render_occlusion(detour_hot_block().genv);
+    }
+
+    /**
+     * @brief This frame's settings, re-captured when either version moved.
+     * @details Two acquire loads when nothing changed. The detour calls it on entry and again after the preset
+     *          resolver ran, so the matrix offset sees the framing the resolver just eased toward.
+     */
+    [[nodiscard]] static const RenderSettings &render_settings() noexcept
+    {
+        const LiveSettings &cfg = settings();
+        RenderSettings &copy = render_settings_copy();
+        const uint32_t preset_version = cfg.preset_version.load(std::memory_order_acquire);
+        const uint32_t settings_version = cfg.settings_version.load(std::memory_order_acquire);
+        if (preset_version != copy.preset_version || settings_version != copy.settings_version)
+        {
+            const bool reloaded = settings_version != copy.settings_version;
+            copy.preset_version = preset_version;
+            copy.settings_version = settings_version;
+            capture_render_settings(cfg, copy);
+            if (reloaded && wants_render_octree(copy) && game_world_ready().load(std::memory_order_relaxed))
+            {
+                adopt_render_octree();
+            }
+        }
+        return copy;
+    }
+
+    /**
+     * @struct FrameAlphas
+     * @brief This frame's exponential-ease factors, 1 - exp(-rate * dt), one slot per distinct camera ease rate.
+     * @details Filled once per game-view frame by compute_frame_alphas, at the top of offset_game_view_camera,
+     *          from the render-settings snapshot and the frame delta; every eased quantity of the camera
+     *          (collision pull-in and return, basis and orbit smoothing, the orbit return, the level blends, the
+     *          FOV and the eye-height sync) reads its factor from here. The frame's easing cost is therefore a
+     *          fixed nine exp() calls however many of the eases run. A rate of 0 (an "instant" setting) yields 1.
+     *          Render thread only.
+     */
+    struct FrameAlphas
+    {
+        float collision_pull_in = 1.0f;
+        float collision_return = 1.0f;
+        float basis_smooth = 1.0f;
+        float fov = 1.0f;
+        float eye_sync = 1.0f;
+        float orbit_smooth = 1.0f;
+        float orbit_return = 1.0f;
+        float orbit_level = 1.0f;
+        float orbit_aim_level = 1.0f;
+    };
+
+    static FrameAlphas s_alphas;
+
     // Eases the camera collision distance toward @p target: a fast pull-IN (so a wall is never clipped) and the
     // slower configured return-OUT, which stops the camera pumping when an edge-grazing ray hit alternates
     // near/far frame to frame. Snaps to the target on the first valid frame. Shared by the per-frame easing and
     // the static-world throttle bypass so the two cannot drift.
-    static void ease_collision_toward(CameraState &cam, float target, float delta_time, float return_speed)
+    static void ease_collision_toward(CameraState &cam, float target)
     {
         if (!cam.collision_valid)
         {
@@ -71,12 +290,121 @@ namespace TPVCamera
             cam.collision_valid = true;
             return;
         }
-        constexpr float k_pull_in_speed = 25.0f; // near-instant but still smooth
-        const float speed = (target < cam.collision_distance) ? k_pull_in_speed : return_speed;
-        const float blend = (speed > 0.0f) ? (1.0f - std::exp(-speed * delta_time)) : 1.0f;
+        const float blend =
+            (target < cam.collision_distance) ? s_alphas.collision_pull_in : s_alphas.collision_return;
         cam.collision_distance += (target - cam.collision_distance) * blend;
     }
 
+    // The UNSKIPPED pivot->camera fan (the plain nearest-solid probe and the coverage walk's first step). With
+    // AsyncCollision on, the fan for this arm was queued on the collision worker last frame: its result is used
+    // when the arm it was cast for is still within k_async_arm_tol of this frame's (a one-frame-old world hit;
+    // the pull-in ease and the collision hold absorb that latency), otherwise -- the first frame, a snap, a fast
+    // swing -- it is cast here synchronously so a stale hit never clamps the camera. Either way this frame's arm
+    // is then queued for the next. Off = always synchronous.
+    static std::optional<RayHit> unskipped_fan(const Vector3 &pivot, const Vector3 &to_camera, float radius,
+                                               bool async_collision, CollisionLod lod)
+    {
+        TPVCAMERA_PROFILE_SCOPE(RayFan);
+        if (!async_collision)
+        {
+            return ray_fan_sweep(pivot, to_camera, radius, Constants::RWI_OBJTYPES_CAMERA,
+                                 Constants::RWI_FLAGS_STOP_AT_SOLID, nullptr, 0, lod);
+        }
+        constexpr float k_async_arm_tol2 = 0.06f * 0.06f; // matches the static-world collision throttle
+        std::optional<RayHit> out;
+        bool have = false;
+        if (const std::optional<AsyncFanResult> prev = take_fan_async(); prev.has_value())
+        {
+            have = (prev->m_origin - pivot).magnitude_squared() <= k_async_arm_tol2 &&
+                   (prev->m_sweep - to_camera).magnitude_squared() <= k_async_arm_tol2 &&
+                   std::fabs(prev->m_radius - radius) <= 1e-4f;
+            if (have)
+            {
+                out = prev->m_hit;
+            }
+        }
+        if (!have)
+        {
+            out = ray_fan_sweep(pivot, to_camera, radius, Constants::RWI_OBJTYPES_CAMERA,
+                                Constants::RWI_FLAGS_STOP_AT_SOLID, nullptr, 0, lod);
+        }
+        submit_fan_async(pivot, to_camera, radius, Constants::RWI_OBJTYPES_CAMERA, Constants::RWI_FLAGS_STOP_AT_SOLID,
+                         lod);
+        return out;
+    }
+
+    // The swept sphere, kept off the physical world's mutex. PWI's vtable slot waits on that mutex, so while the
+    // physics thread holds it (ragdolls after a fight, horse physics) a synchronous sweep stalls this detour. The
+    // engine's lock is not reversed in this fork, so there is nothing to try-lock; instead each synchronous sweep is
+    // timed, and one that runs past k_sweep_stall_ms switches sweeps onto the collision worker (which does the
+    // waiting) for at least k_sweep_defer_s, reusing the latest completed one. The worker times each sweep too: a
+    // slow one extends the window, and once the window has run out the first clean one (the re-probe) returns the
+    // path to synchronous sweeps, so the render thread never makes the probing call itself. The reuse is bounded to
+    // an arm within k_sweep_reuse_tol of this frame's (the async fan's tolerance), and the fan-agreement gate still
+    // decides whether the sphere is used at all. Off (NonBlockingSweep = false) = always synchronous.
+    static std::optional<RayHit> paced_sphere_sweep(const Vector3 &origin, float radius, const Vector3 &sweep,
+                                                    const uintptr_t *skip_ents, int n_skip, bool non_blocking)
+    {
+        constexpr double k_sweep_stall_ms = 1.0;  // a clean sphere sweep runs in tens of microseconds
+        constexpr auto k_sweep_defer_s = std::chrono::seconds(1);
+        constexpr float k_sweep_reuse_tol2 = 0.06f * 0.06f; // matches the async fan (unskipped_fan)
+        static std::chrono::steady_clock::time_point s_defer_until{};
+        static bool s_deferring = false;
+        static std::optional<AsyncSweepResult> s_last_sweep;
+        static bool s_sweep_queued = false;
+
+        const auto now = std::chrono::steady_clock::now();
+        if (!non_blocking || !s_deferring)
+        {
+            s_deferring = false;
+            s_last_sweep.reset();
+            s_sweep_queued = false;
+            const std::optional<RayHit> hit =
+                sphere_world_sweep(origin, radius, sweep, Constants::RWI_OBJTYPES_CAMERA, skip_ents, n_skip);
+            const auto elapsed =
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - now).count();
+            if (non_blocking && elapsed > k_sweep_stall_ms)
+            {
+                Health::note(Health::Site::SweepContention);
+                s_deferring = true;
+                s_defer_until = now + k_sweep_defer_s;
+            }
+            return hit;
+        }
+
+        if (std::optional<AsyncSweepResult> done = take_sweep_async(); done.has_value())
+        {
+            s_sweep_queued = false;
+            if (done->m_elapsed_ms > k_sweep_stall_ms)
+            {
+                Health::note(Health::Site::SweepContention);
+                s_defer_until = now + k_sweep_defer_s; // still contended: keep the sweeps on the worker
+            }
+            else if (now >= s_defer_until)
+            {
+                s_deferring = false; // the re-probe ran clean: synchronous again from the next frame
+            }
+            s_last_sweep = std::move(done);
+        }
+        else if (s_sweep_queued)
+        {
+            Health::note(Health::Site::SweepContention); // last frame's sweep is still waiting on the mutex
+        }
+        if (s_deferring)
+        {
+            submit_sweep_async(origin, radius, sweep, Constants::RWI_OBJTYPES_CAMERA);
+            s_sweep_queued = true;
+        }
+
+        if (s_last_sweep.has_value() && (s_last_sweep->m_origin - origin).magnitude_squared() <= k_sweep_reuse_tol2 &&
+            (s_last_sweep->m_sweep - sweep).magnitude_squared() <= k_sweep_reuse_tol2 &&
+            std::fabs(s_last_sweep->m_radius - radius) <= 1e-4f)
+        {
+            return s_last_sweep->m_hit;
+        }
+        return std::nullopt; // nothing recent enough for this arm: the fan alone decides this frame
+    }
+
     // Fraction (0..1) of the character that the hit collider hides, with a per-collider cache. Pipeline: a cheap
     // footprint pre-check (a building-scale collider always occludes, so collide without rasterizing its often-
     // compound mesh), else the visible-mesh raster (render_coverage_of_brush / render_coverage_at), else a
@@ -87,103 +415,114 @@ namespace TPVCamera
     // angle, so its COLLIDE verdict is reused FREELY -- this also keeps the expensive octree path off the hot
     // path as the camera slides along a wall. A MEASURED coverage (cov >= 0, whether it covers or not) is
     // CAMERA-ANGLE dependent: a collider with a localized feature -- a POLE WITH A WIDE HEAD -- covers the body
-    // only from angles where the head aligns with the player on screen, so it is reused only while BOTH the hit
-    // point AND the camera are near where it was measured, and re-measured once the camera moves enough to change
-    // the projection. (A free per-collider reuse of a measured COLLIDE was the bug behind a clamp STICKING after
-    // the head swept off the body: looking at the head latched cov=1 for the whole pole, so moving back below it
-    // kept colliding on the thin pole.) Single render-thread caller, so the static cache is race-free.
+    // only from angles where the head aligns with the player on screen, so it is reused only while the hit point
+    // is near where it was measured AND the camera is in the same view-direction cell around it, and re-measured
+    // once the camera moves into another cell. (A free per-collider reuse of a measured COLLIDE was the bug behind
+    // a clamp STICKING after the head swept off the body: looking at the head latched cov=1 for the whole pole, so
+    // moving back below it kept colliding on the thin pole.) The records live in the hashed LRU of
+    // coverage_cache.hpp: one collider-wide record (node, head fill, solid verdict) plus one per measured view
+    // cell. Single render-thread caller, so the cache is race-free.
+    //
+    // physics_only (collision governor tier PhysicsCoverage and below): a cache miss is measured with the
+    // physics-ray fraction alone -- no mesh raster, no octree query -- and the result is NOT cached, since it is a
+    // coarser answer than the raster and full quality must re-measure the collider properly. Cache hits still apply.
+    // Likewise a physics-ray fallback taken at a thinned collision LOD is not kept for its view cell, so the same
+    // view re-measures it at full density once the camera slows down.
     static float measure_collider_coverage(uintptr_t collider, const Vector3 &hit_point, const Vector3 &pivot,
-                                           const Vector3 &desired_cam, const Vector3 &to_camera, float *out_head_cov)
+                                           const Vector3 &desired_cam, const Vector3 &to_camera, float *out_head_cov,
+                                           bool physics_only, CollisionLod lod)
     {
-        constexpr int k_cov_cache = 8;
-        constexpr float k_cov_reuse_dist2 = 0.5f * 0.5f;     // re-measure once the hit point moves this far
-        constexpr float k_cov_cam_reuse_dist2 = 0.3f * 0.3f; // ... or the camera moves this far (angle changed)
+        TPVCAMERA_PROFILE_SCOPE(Coverage);
+        constexpr float k_cov_reuse_dist2 = 0.5f * 0.5f; // re-measure once the hit point moves this far
         // Low-pass strength for the per-collider HEAD fill (head-visible gate). The raw head coverage flickers
         // 0..1 as the camera orbits past a near occluder's edge (a window), which flipped the gate and bounced
         // the clamp between the near occluder and the wall behind it (janky). Smoothing across re-measures
         // debounces that flicker while still tracking a genuine, sustained head-visibility change.
         constexpr float k_head_smooth = 0.34f;
-        static uintptr_t s_cov_col[k_cov_cache] = {};
-        static float s_cov_val[k_cov_cache] = {};
-        static float s_cov_hx[k_cov_cache] = {};
-        static float s_cov_hy[k_cov_cache] = {};
-        static float s_cov_hz[k_cov_cache] = {};
-        static float s_cov_cx[k_cov_cache] = {}; // camera position at measurement (coverage is angle-dependent)
-        static float s_cov_cy[k_cov_cache] = {};
-        static float s_cov_cz[k_cov_cache] = {};
-        // Octree-resolved render node for this collider (the dominant occluder brush). Cached so an angle
-        // re-measure re-rasters it directly via render_coverage_of_brush (cheap) instead of re-querying the
-        // octree (GetObjectsInBox ~110 us, ~75x a single ray and the dominant per-frame collision cost). The
-        // node is stable for a collider, so this is exact, not an approximation; nullptr = none resolved.
-        static void *s_cov_node[k_cov_cache] = {};
-        // HEAD-band fill of this collider (for the head-visible gate); -1 = n/a.
-        static float s_cov_head[k_cov_cache] = {};
 
         if (out_head_cov != nullptr)
         {
             *out_head_cov = -1.0f;
         }
-        int slot = -1, free_slot = -1;
-        for (int k = 0; k < k_cov_cache; ++k)
+        const std::uint32_t cell = CoverageCache::view_cell(hit_point, desired_cam);
+        // Collider-wide record. Its node is the octree-resolved render node for this collider (the dominant
+        // occluder brush), cached so an angle re-measure re-rasters it directly via render_coverage_of_brush
+        // (cheap) instead of re-querying the octree (GetObjectsInBox ~110 us, ~75x a single ray and the dominant
+        // per-frame collision cost). The node is stable for a collider, so this is exact, not an approximation.
+        CoverageCache::Record *whole = CoverageCache::find(collider, CoverageCache::k_collider_cell);
+        if (whole != nullptr && whole->m_cov < 0.0f)
         {
-            if (collider != 0 && s_cov_col[k] == collider)
-            {
-                slot = k;
-                break;
-            }
-            if (s_cov_col[k] == 0)
+            // unmeasurable solid (building / HLOD / pure-physics): solid from every angle, reuse freely
+            CoverageCache::count_lookup(true);
+            if (out_head_cov != nullptr)
             {
-                free_slot = k;
+                *out_head_cov = whole->m_head; // -1 -> head-visible gate does not apply (block)
             }
+            return whole->m_cov;
         }
-        if (slot >= 0)
+        if (whole != nullptr)
         {
-            const float cached = s_cov_val[slot];
-            if (cached < 0.0f)
+            // Measured coverage (covers OR skip) is camera-angle dependent: reuse only from the same view cell and
+            // while the hit point is near where it was measured, else re-measure (so a clamp does not stick after
+            // a pole's head sweeps off the body, nor a skip after it sweeps on).
+            const CoverageCache::Record *view = CoverageCache::find(collider, cell);
+            if (view != nullptr && (hit_point - view->m_hit).magnitude_squared() < k_cov_reuse_dist2)
             {
-                // unmeasurable solid (building / HLOD / pure-physics): solid from every angle, reuse freely
+                CoverageCache::count_lookup(true);
                 if (out_head_cov != nullptr)
                 {
-                    *out_head_cov = s_cov_head[slot]; // -1 -> head-visible gate does not apply (block)
+                    *out_head_cov = view->m_head;
                 }
-                return cached;
-            }
-            // Measured coverage (covers OR skip) is camera-angle dependent: reuse only while the hit point AND
-            // the camera are near where it was measured, else re-measure (so a clamp does not stick after a
-            // pole's head sweeps off the body, nor a skip after it sweeps on).
-            const float dx = hit_point.x - s_cov_hx[slot], dy = hit_point.y - s_cov_hy[slot],
-                        dz = hit_point.z - s_cov_hz[slot];
-            const float cdx = desired_cam.x - s_cov_cx[slot], cdy = desired_cam.y - s_cov_cy[slot],
-                        cdz = desired_cam.z - s_cov_cz[slot];
-            if (dx * dx + dy * dy + dz * dz < k_cov_reuse_dist2 &&
-                cdx * cdx + cdy * cdy + cdz * cdz < k_cov_cam_reuse_dist2)
+                return view->m_cov;
+            }
+        }
+        CoverageCache::count_lookup(false);
+
+        // Physics-ray fraction, per frame at full grid density or amortised across frames per collider
+        // (TemporalRayCoverage). A temporal estimate is already smoothed and keeps refining, so it skips the head
+        // low-pass below and is not kept for the view cell.
+        const bool temporal = settings().temporal_ray_coverage.load(std::memory_order_relaxed);
+        const auto physics_fraction = [&](float *head_out)
+        {
+            return temporal ? character_occluded_fraction_temporal(collider, desired_cam, pivot,
+                                                                   Constants::RWI_OBJTYPES_CAMERA,
+                                                                   Constants::RWI_FLAGS_STOP_AT_SOLID, head_out)
+                            : character_occluded_fraction(desired_cam, pivot, Constants::RWI_OBJTYPES_CAMERA,
+                                                          Constants::RWI_FLAGS_STOP_AT_SOLID, head_out, lod);
+        };
+
+        if (physics_only)
+        {
+            float head = -1.0f;
+            float cov = -1.0f;
+            if (collider_horizontal_footprint(collider) <= Constants::COLLIDER_WALL_FOOTPRINT_MIN)
             {
-                if (out_head_cov != nullptr)
-                {
-                    *out_head_cov = s_cov_head[slot];
-                }
-                return cached;
+                Health::note(Health::Site::PhysicsCoverage); // the governor's tier skipped the render mesh
+                cov = physics_fraction(&head);
             }
+            if (out_head_cov != nullptr)
+            {
+                *out_head_cov = head;
+            }
+            return cov;
         }
 
         float cov = -1.0f;
         float head = -1.0f; // HEAD-band fill from whichever path measures cov; -1 = unmeasurable (gate won't apply)
         void *resolved_node = nullptr;
+        bool thinned_measure = false; // physics fallback cast at a thinned LOD: not cached for the view cell
+        bool temporal_measure = false; // physics fallback from the temporal estimate: already smoothed
         // Fast re-measure: if the hit is still near the cached hit (only the camera ANGLE changed -- the
         // pole-head-sweep case) and this collider already resolved a render node, RE-RASTER that node directly.
         // No octree query. The octree (render_coverage_at) only runs below when the hit moved to new geometry,
         // the node was never resolved, or the cached node is now invalid (render_coverage_of_brush returns < 0).
-        if (slot >= 0 && s_cov_node[slot] != nullptr)
+        if (whole != nullptr && whole->m_node != nullptr &&
+            (hit_point - whole->m_hit).magnitude_squared() < k_cov_reuse_dist2)
         {
-            const float ndx = hit_point.x - s_cov_hx[slot], ndy = hit_point.y - s_cov_hy[slot],
-                        ndz = hit_point.z - s_cov_hz[slot];
-            if (ndx * ndx + ndy * ndy + ndz * ndz < k_cov_reuse_dist2)
+            cov = render_coverage_of_brush(whole->m_node, pivot, desired_cam, &head);
+            if (cov >= 0.0f)
             {
-                cov = render_coverage_of_brush(s_cov_node[slot], pivot, desired_cam, &head);
-                if (cov >= 0.0f)
-                {
-                    resolved_node = s_cov_node[slot];
-                }
+                resolved_node = whole->m_node;
             }
         }
         if (cov < 0.0f)
@@ -214,42 +553,50 @@ namespace TPVCamera
                     // A COMPOUND structure the render mesh cannot raster (rmesh null), neither a tiny post nor a
                     // building: an OPEN wooden frame (body visible THROUGH the beams) vs a SOLID compound (a shed).
                     // The PHYSICS ray occlusion tells them apart: open -> low -> skip; solid -> high -> collide.
-                    cov = character_occluded_fraction(desired_cam, pivot, Constants::RWI_OBJTYPES_CAMERA,
-                                                      Constants::RWI_FLAGS_STOP_AT_SOLID, &head);
+                    Health::note(Health::Site::PhysicsCoverage);
+                    cov = physics_fraction(&head);
+                    temporal_measure = temporal;
+                    thinned_measure = temporal || (lod != CollisionLod::Fine);
                 }
             }
         }
 
-        // Same-collider re-measure? (slot still matches before any free/evict reassignment below.) Only then is
-        // the previous head fill for the SAME collider, so only then may we low-pass into it.
-        const bool same_collider_remeasure = (slot >= 0);
-        if (collider != 0)
+        // Same-collider re-measure? Only then is the previous head fill for the SAME collider, so only then may we
+        // low-pass into it. (The measure paths above do not touch the cache, so `whole` is still valid here.)
+        const bool same_collider_remeasure = (whole != nullptr);
+        if (whole == nullptr)
+        {
+            whole = CoverageCache::insert(collider, CoverageCache::k_collider_cell);
+        }
+        if (whole != nullptr)
         {
-            if (slot < 0)
-            {
-                slot = (free_slot >= 0) ? free_slot : static_cast<int>(collider % k_cov_cache);
-            }
-            s_cov_col[slot] = collider;
-            s_cov_val[slot] = cov;
-            s_cov_hx[slot] = hit_point.x;
-            s_cov_hy[slot] = hit_point.y;
-            s_cov_hz[slot] = hit_point.z;
-            s_cov_cx[slot] = desired_cam.x;
-            s_cov_cy[slot] = desired_cam.y;
-            s_cov_cz[slot] = desired_cam.z;
-            s_cov_node[slot] = resolved_node;
             // Debounce the head fill: low-pass into the cached value on a same-collider re-measure; set it
-            // directly on a first measure / slot reuse, or when unmeasurable (-1, no smoothing). The gate then
-            // reads the smoothed value, so a flickering head edge no longer bounces the clamp.
-            if (head < 0.0f || !same_collider_remeasure || s_cov_head[slot] < 0.0f)
+            // directly on a first measure, when unmeasurable (-1, no smoothing), or from the temporal estimate
+            // (smoothed already). The gate then reads the smoothed value, so a flickering head edge no longer
+            // bounces the clamp.
+            if (head < 0.0f || !same_collider_remeasure || whole->m_head < 0.0f || temporal_measure)
             {
-                s_cov_head[slot] = head;
+                whole->m_head = head;
             }
             else
             {
-                s_cov_head[slot] += (head - s_cov_head[slot]) * k_head_smooth;
+                whole->m_head += (head - whole->m_head) * k_head_smooth;
+            }
+            head = whole->m_head;
+            whole->m_cov = cov;
+            whole->m_hit = hit_point;
+            whole->m_node = resolved_node;
+            // A measured coverage is also kept for this view cell (written last: the insert may reuse any slot of
+            // its probe window, though never the collider-wide record just touched, which is the newest).
+            if (cov >= 0.0f && !thinned_measure)
+            {
+                if (CoverageCache::Record *view = CoverageCache::insert(collider, cell); view != nullptr)
+                {
+                    view->m_cov = cov;
+                    view->m_head = head;
+                    view->m_hit = hit_point;
+                }
             }
-            head = s_cov_head[slot];
         }
         if (out_head_cov != nullptr)
         {
@@ -267,42 +614,49 @@ namespace TPVCamera
     // capture mouse-look deltas and freeze the player by not dispatching while orbiting.
     using InputDispatchFunc = void(__fastcall *)(uintptr_t controller, uintptr_t input_event, char flag);
 
-    static FrustumBuildFunc s_frustum_build_original = nullptr;
-    static SetHeadVisibilityFunc s_set_head_visibility_original = nullptr;
-    static InputDispatchFunc s_input_dispatch_original = nullptr;
-
-    // Resolved SSystemGlobalEnvironment (g_env) base, set once at init (AOB, with the static RVA as
-    // fallback). Reused by the player/animchar walks; p_physical_world is g_env + PHYSICAL_WORLD_OFFSET.
-    static uintptr_t s_genv_runtime = 0;
-
-    // CView vtable address, cached lazily on the first frustum-builder camera whose embedding object
-    // passes the CView RTTI check. The steady-state game-view gate is then a single qword compare;
-    // using the RTTI type name (not a hardcoded address) keeps the gate working across game patches.
-    static uintptr_t s_cview_vtable_runtime = 0;
-
-    // Latched from the head-visibility setter so the per-frame re-assert can drive the head
-    // without waiting for the game to call the setter again (toggling the offset does not
-    // make the game call it, so without the re-assert the head would stay hidden after an
-    // FPV/TPV switch). The setter only ever runs for the player (it toggles the
-    // FirstPersonView rig), so the entity is the player. s_head_was_active tracks the offset's
-    // active state across frames so the head is restored to the game's intended value
-    // exactly once when the offset turns off.
-    static std::atomic<uintptr_t> s_head_entity{0};
-    static std::atomic<uint8_t> s_head_flags{0};
-    static std::atomic<bool> s_game_intended_hide_head{false};
-    static std::atomic<bool> s_head_was_active{false};
-
-    // The offset's effective active state (effective_tpv && should_apply_view), published by the
-    // frustum detour each frame. The head-visibility detour and the free-look input gate read it so
-    // they mirror the live offset state without recomputing the whole forced-view policy themselves.
-    static std::atomic<bool> s_offset_active{false};
-
-    // Published by the frustum detour each game-view frame: true while the game is showing the OS cursor
-    // (a UI is up). The free-look input gate reads it to FREEZE the orbit -- hold its angles and ignore
-    // mouse-look -- while any cursor UI is open (menu, inventory, loot/trade, dialogue), so the camera
-    // does not turn from cursor motion and resumes from the same angle when the cursor hides. The orbit
-    // hook captures raw mouse UPSTREAM of the engine's own input freeze, so it needs this explicit gate.
-    static std::atomic<bool> s_cursor_shown{false};
+    // The detours' per-frame state lives in the detour hot block (hot_block.hpp) so an engaged frame touches one
+    // page and a few lines of it:
+    //  - the trampolines (stored untyped; the accessors below restore the types);
+    //  - genv: the resolved SSystemGlobalEnvironment (g_env) base, set once at init (AOB, with the static RVA as
+    //    fallback) and reused by the player/animchar walks;
+    //  - cview_vtable: the CView vtable, cached lazily on the first frustum-builder camera whose embedding object
+    //    passes the CView RTTI check (the RTTI type name, not a hardcoded address, keeps the gate working across
+    //    game patches);
+    //  - game_view_camera: the camera of that CView, latched once identified, so every other camera the builder
+    //    is handed (shadow cascades, reflections, portals) is rejected by a compare and a clock read
+    //    (is_game_view_camera);
+    //  - head_entity / head_flags / game_intended_hide_head: latched from the head-visibility setter so a view
+    //    edge can drive the head without waiting for the game to call the setter again (toggling the offset does
+    //    not make the game call it, so without the edge re-assert the head would stay hidden after an FPV/TPV
+    //    switch). The setter only ever runs for the player (it toggles the FirstPersonView rig), so the entity is
+    //    the player. head_was_active is the view state the head last mirrored: the detour keeps the head in that
+    //    state on every engine write, so the frame loop only calls the setter when the offset's active state flips;
+    //  - offset_active: the offset's effective active state (effective_tpv && should_apply_view), published by the
+    //    frustum detour each frame. The head-visibility detour and the free-look input gate read it so they mirror
+    //    the live offset state without recomputing the whole forced-view policy themselves;
+    //  - cursor_shown: published by the frustum detour each game-view frame, true while the game is showing the OS
+    //    cursor (a UI is up). The free-look input gate reads it to FREEZE the orbit -- hold its angles and ignore
+    //    mouse-look -- while any cursor UI is open (menu, inventory, loot/trade, dialogue), so the camera does not
+    //    turn from cursor motion and resumes from the same angle when the cursor hides. The orbit hook captures
+    //    raw mouse UPSTREAM of the engine's own input freeze, so it needs this explicit gate;
+    //  - orbit_capture_gate: published alongside offset_active: the offset is rendering, no UI cursor is up, and
+    //    SuppressTPVState allows the view. The input hook tests it (with the exact orbit_active toggle) before
+    //    anything else, so each dispatched event costs two relaxed loads while free-look is off instead of
+    //    re-evaluating the suppression policy per event.
+    [[nodiscard]] static FrustumBuildFunc frustum_build_original() noexcept
+    {
+        return reinterpret_cast<FrustumBuildFunc>(detour_hot_block().frustum_build_original);
+    }
+
+    [[nodiscard]] static SetHeadVisibilityFunc set_head_visibility_original() noexcept
+    {
+        return reinterpret_cast<SetHeadVisibilityFunc>(detour_hot_block().set_head_visibility_original);
+    }
+
+    [[nodiscard]] static InputDispatchFunc input_dispatch_original() noexcept
+    {
+        return reinterpret_cast<InputDispatchFunc>(detour_hot_block().input_dispatch_original);
+    }
 
     // Camera-relative movement (toggle orbit). The character's horizontal speed is derived from its body
     // world position each frame (device-agnostic: no hardcoded movement keys). Crossing the START speed
@@ -380,37 +734,71 @@ namespace TPVCamera
     }
 
     /**
-     * @brief Wall-clock seconds since the previous call, clamped.
-     * @details The frustum builder runs once or twice per frame for the game view (projection
-     *          setup plus the final rebuild). A second call within the same frame sees a near-zero
-     *          delta, so the integrators do not double-advance; the lower clamp is therefore 0.
+     * @brief Session-scoped cache of the resolved player chain (render thread only).
+     * @details Filled by walk_c_player_chain once the player resolves in-world; resolve_c_player then
+     *          validates it each frame with ONE guarded read, the C_Player's vtable compared against the one
+     *          captured at fill, instead of re-walking g_env -> p_game -> CCryAction -> CActionGame. The
+     *          compare catches a destroyed player: the engine's destructor chain rewrites the object's vptr
+     *          to its base classes before the memory is released. TPVCamera has no level-load or
+     *          entity-destroy hook, so the cache is also dropped while a game menu is open (saves and levels
+     *          load behind it) and re-walked every k_player_cache_revalidate_hits cache hits, which bounds
+     *          how long a replaced-but-still-live player could be served after a load without a menu.
      */
-    [[nodiscard]] static float frame_delta()
+    struct PlayerChainCache
     {
-        static std::chrono::steady_clock::time_point s_last_time = std::chrono::steady_clock::now();
-        const auto now = std::chrono::steady_clock::now();
-        const float delta_time = std::chrono::duration<float>(now - s_last_time).count();
-        s_last_time = now;
-        return std::clamp(delta_time, 0.0f, 0.1f);
+        uintptr_t c_player{0};
+        uintptr_t vtable{0}; // C_Player main vtable at fill time
+        uintptr_t entity{0}; // C_Player -> CEntity link read at fill time (0 if it did not read clean)
+        uint32_t hits_since_walk{0};
+    };
+    static PlayerChainCache s_player_cache;
+
+    // resolve_c_player runs a few times per game-view frame, so this re-walks roughly every second or two at
+    // 60 fps: the worst case a silently replaced player is served.
+    constexpr uint32_t k_player_cache_revalidate_hits = 240;
+
+    /**
+     * @brief One-time in-world warm-up, on the frame game_world_ready first flips. Render thread only.
+     * @details Resolves the 3DEngine render-octree query so the camera can also collide with render-only roofs
+     *          (tent / awning canopy cloth) that carry no ray-collidable physics. Nothing consults it at the main
+     *          menu, so it is left off the boot path; the render thread owns its state, so setting it up here needs
+     *          no publication. Best-effort: a miss no-ops the roof render clamp. With the settings that query it
+     *          off, its anchor was never resolved and it waits for the reload that enables them
+     *          (adopt_render_octree).
+     */
+    static void warm_world_subsystems()
+    {
+        const LiveSettings &cfg = settings();
+        if (!cfg.use_render_occlusion.load(std::memory_order_relaxed) &&
+            !cfg.use_coverage_collision.load(std::memory_order_relaxed))
+        {
+            DMK::Logger::get_instance().info(
+                "Startup (world load): render occlusion deferred (UseRenderOcclusion and UseCoverageCollision off)");
+            return;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        const bool render_occlusion = initialize_render_occlusion(detour_hot_block().genv);
+        const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+        DMK::Logger::get_instance().info("Startup (world load): render occlusion {} in {:.2f} ms",
+                                         render_occlusion ? "ready" : "unavailable", elapsed.count());
     }
 
     /**
-     * @brief Resolves the live C_Player via g_env each frame (validated by its vtable); 0 on failure.
+     * @brief Resolves the live C_Player via g_env by a full chain walk (validated by its vtable); 0 on failure.
      * @details Walks g_env -> p_game -> CCryAction (cached, resolved once via a virtual GetIGameFramework
-     *          call) -> p_action_game -> C_Player, then confirms C_Player by its main vtable. Resolving
-     *          FRESH every frame -- rather than trusting a mirrored pointer that goes null/stale across
-     *          view transitions and reloads -- is what keeps the move-detection and body-turn locked onto
-     *          the CURRENT player. Always called from within an SEH frame (the frustum detour / the
-     *          body-turn wrapper), so a fault during the walk is contained.
+     *          call) -> p_action_game -> C_Player, then confirms C_Player by its main vtable. This is the fill
+     *          and revalidation path of resolve_c_player; it is also where the chain offsets self-heal and
+     *          where the world-load generation is bumped on a new CActionGame / C_Player. Always called from
+     *          within an SEH frame (the frustum detour / the body-turn wrapper), so a fault is contained.
      */
-    static uintptr_t resolve_c_player()
+    static uintptr_t walk_c_player_chain()
     {
-        const ModuleInfo &mod = module_info();
-        if (mod.base == 0)
+        const DetourHotBlock &hot = detour_hot_block();
+        if (hot.module_lo == 0)
         {
             return 0;
         }
-        const uintptr_t g_env_addr = s_genv_runtime;
+        const uintptr_t g_env_addr = hot.genv;
         const auto p_game = DMK::Memory::seh_read<uintptr_t>(g_env_addr + Constants::GENV_PGAME_OFFSET);
         if (!p_game || !DMK::Memory::plausible_userspace_ptr(*p_game))
         {
@@ -450,6 +838,14 @@ namespace TPVCamera
         {
             return 0;
         }
+        // A new CActionGame is a new game session: open a fresh world-load generation so any self-heal still
+        // waiting gets one full attempt against it.
+        static uintptr_t s_last_action_game{0};
+        if (*p_action_game != s_last_action_game)
+        {
+            s_last_action_game = *p_action_game;
+            world_load_generation().fetch_add(1, std::memory_order_relaxed);
+        }
 
         // Read the local actor through the self-healed CActionGame offset, then confirm it is a real C_Player
         // by its vtable. C_Player is found THROUGH this offset, so the offset cannot be healed from a resolved
@@ -466,7 +862,7 @@ namespace TPVCamera
                 return false;
             }
             const auto vt = DMK::Memory::seh_read<uintptr_t>(*candidate);
-            return vt.has_value() && DMK::Rtti::vtable_is_type(*vt, Constants::C_PLAYER_RTTI_NAME);
+            return vt.has_value() && RttiCache::is_type(*vt, Constants::C_PLAYER_RTTI_NAME);
         };
         bool player_valid = is_c_player(player);
         if (!player_valid && player && DMK::Memory::plausible_userspace_ptr(*player))
@@ -474,27 +870,14 @@ namespace TPVCamera
             // The cached slot holds a populated object that is NOT a C_Player: the signature of a CActionGame
             // layout drift. Recover the offset by scanning CActionGame for the C_Player slot, then re-read and
             // re-validate. A successful recovery updates the cache, so the read above succeeds on later frames
-            // and this branch stops being entered (the natural stop). The scan is RATE-LIMITED to a fixed frame
-            // interval rather than capped by a fixed number of attempts: the heal contract forbids scanning
-            // every frame (it is syscall-heavy), but a hard attempt cap could be exhausted by a slow save/level
-            // load, where the real player may not be seated until many seconds after this slot first reads
-            // populated-but-wrong, permanently disabling recovery before the player even exists. An interval
-            // never gives up, so it keeps retrying until the player appears; on a truly unrecoverable drift it
-            // settles into a cheap periodic scan, not a per-frame one. The first entered frame scans immediately
-            // (counter starts at 0), so an undrifted-with-real-drift build recovers on the first opportunity.
-            constexpr int k_local_actor_retry_interval_frames = 30; // about 0.5s at 60 FPS between scans
-            static int s_frames_until_retry = 0;
-            if (s_frames_until_retry > 0)
-            {
-                --s_frames_until_retry;
-            }
-            else
-            {
-                s_frames_until_retry = k_local_actor_retry_interval_frames;
-                const std::ptrdiff_t healed = heal_local_actor_offset(*p_action_game);
-                player = DMK::Memory::seh_read<uintptr_t>(*p_action_game + healed);
-                player_valid = is_c_player(player);
-            }
+            // and this branch stops being entered (the natural stop). There is no frame cadence and no attempt
+            // cap: the heal's retry gate probes the window through the RTTI type cache each frame (guarded reads,
+            // no syscalls) and pays for the full scan only when a C_Player shows up there or a new world loads,
+            // so a slow save/level load that seats the player many seconds later is recovered the frame it
+            // happens, while a truly unrecoverable drift settles into the cheap probe.
+            const std::ptrdiff_t healed = heal_local_actor_offset(*p_action_game);
+            player = DMK::Memory::seh_read<uintptr_t>(*p_action_game + healed);
+            player_valid = is_c_player(player);
         }
         if (!player_valid)
         {
@@ -507,12 +890,13 @@ namespace TPVCamera
 
         // Log the resolved C_Player and cached CCryAction only when the player pointer CHANGES (once on first
         // resolve, and again after a reload / new player) so the address is available for external tooling
-        // without flooding the log.
+        // without flooding the log. A new player is also a world-load edge for the self-heal retry gate.
         {
             static uintptr_t s_logged_player{0};
             if (*player != s_logged_player)
             {
                 s_logged_player = *player;
+                world_load_generation().fetch_add(1, std::memory_order_relaxed);
                 DMK::Logger::get_instance().debug("C_Player resolved={} (CCryAction={})",
                                                   DMK::Format::format_address(*player),
                                                   DMK::Format::format_address(s_cry_action));
@@ -520,44 +904,95 @@ namespace TPVCamera
         }
 
         // The player resolves once the game is in-world (window at its final resolution); let the overlay
-        // wait on this so it never sizes itself to the transient loading window.
-        game_world_ready().store(true, std::memory_order_relaxed);
+        // wait on this so it never sizes itself to the transient loading window. The first flip also brings up
+        // what the main menu never needs.
+        if (!game_world_ready().exchange(true, std::memory_order_relaxed))
+        {
+            warm_world_subsystems();
+        }
 
         return *player;
     }
 
+    /**
+     * @brief Resolves the live C_Player (validated by its vtable); 0 on failure.
+     * @details Steady state is the session cache (PlayerChainCache): one guarded vtable read of the cached
+     *          C_Player. A mismatch, an open game menu or the periodic revalidation drops the cache and falls
+     *          back to the full walk_c_player_chain, which refills it. Resolving against the CURRENT player
+     *          rather than a mirrored pointer that goes stale across reloads is what keeps the move-detection
+     *          and body-turn locked onto it. Render thread only; always called within an SEH frame.
+     */
+    static uintptr_t resolve_c_player()
+    {
+        PlayerChainCache &cache = s_player_cache;
+        if (cache.c_player != 0)
+        {
+            if (++cache.hits_since_walk < k_player_cache_revalidate_hits && !is_game_menu_open())
+            {
+                const auto vt = DMK::Memory::seh_read<uintptr_t>(cache.c_player);
+                if (vt && *vt == cache.vtable)
+                {
+                    return cache.c_player;
+                }
+            }
+            cache = PlayerChainCache{};
+        }
+
+        const uintptr_t c_player = walk_c_player_chain();
+        if (c_player == 0 || is_game_menu_open())
+        {
+            return c_player;
+        }
+        const auto vt = DMK::Memory::seh_read<uintptr_t>(c_player);
+        if (!vt)
+        {
+            return c_player;
+        }
+        const auto ent = DMK::Memory::seh_read<uintptr_t>(
+            c_player + static_cast<uintptr_t>(runtime_offsets().c_player_entity.load(std::memory_order_relaxed)));
+        cache.c_player = c_player;
+        cache.vtable = *vt;
+        cache.entity = (ent && DMK::Memory::plausible_userspace_ptr(*ent)) ? *ent : 0;
+        return c_player;
+    }
+
     /**
      * @brief Publishes the live player world AABB into the shared per-frame cache the camera-collision
      *        coverage samplers read, so coverage measures the REAL posed player instead of a fixed
      *        synthetic box (see PlayerScreenBounds, global_state.hpp).
      * @details Resolves the player CEntity from @p c_player and calls CEntity::GetWorldBounds (fork vtable
-     *          slot 34). Render-thread only (called from the frustum detour just before the coverage walk).
+     *          slot 34). Render-thread only: it is the PlayerBoundsSource the frustum detour arms before the
+     *          coverage walk, run by the first coverage sampler that asks (see arm_player_world_bounds).
      *          The engine call is SEH-guarded and the result sanity-screened (finite, human-scale extents);
-     *          on any failure the cache is marked invalid so the samplers fall back to the synthetic box.
+     *          on any failure @p pb is marked invalid so the samplers fall back to the synthetic box.
      */
-    static void publish_player_world_bounds(uintptr_t c_player)
+    static void publish_player_world_bounds_impl(PlayerScreenBounds &pb, uintptr_t c_player)
     {
-        PlayerScreenBounds &pb = player_screen_bounds();
         pb.valid = false;
         if (c_player == 0)
         {
             return;
         }
-        const auto ent = DMK::Memory::seh_read<uintptr_t>(
-            c_player + static_cast<uintptr_t>(runtime_offsets().c_player_entity.load(std::memory_order_relaxed)));
-        if (!ent || !DMK::Memory::plausible_userspace_ptr(*ent))
+        // The entity link was read when the session cache was filled; re-read it only when the caller's
+        // player is not the cached one (or the fill could not read it).
+        uintptr_t entity = (s_player_cache.c_player == c_player) ? s_player_cache.entity : 0;
+        if (entity == 0)
         {
-            return;
+            const auto ent = DMK::Memory::seh_read<uintptr_t>(
+                c_player + static_cast<uintptr_t>(runtime_offsets().c_player_entity.load(std::memory_order_relaxed)));
+            if (!ent || !DMK::Memory::plausible_userspace_ptr(*ent))
+            {
+                return;
+            }
+            entity = *ent;
         }
-        const uintptr_t entity = *ent;
-        const ModuleInfo &mod = module_info();
         float aabb[6] = {};
         bool ok = false;
         __try
         {
             void **vt = *reinterpret_cast<void ***>(entity);
             const auto vtaddr = reinterpret_cast<uintptr_t>(vt);
-            if (mod.base != 0 && vtaddr >= mod.base && vtaddr < mod.base + mod.size)
+            if (in_game_module(vtaddr))
             {
                 // void(this /*rcx*/, AABB* out /*rdx; 6 floats min.xyz,max.xyz*/)
                 using GetWorldBoundsFn = void(__fastcall *)(uintptr_t, float *);
@@ -598,83 +1033,35 @@ namespace TPVCamera
         pb.valid = true;
     }
 
+    /** @brief The timed PlayerBoundsSource (the impl carries its own __try frame, so the scope lives here). */
+    static void publish_player_world_bounds(PlayerScreenBounds &pb, uintptr_t c_player)
+    {
+        TPVCAMERA_PROFILE_SCOPE(PlayerBounds);
+        publish_player_world_bounds_impl(pb, c_player);
+    }
+
     /**
      * @brief Resolves the player look controller and drives the real aim while orbiting: eases the PITCH
-     *        toward level and/or sets the YAW (heading). Separated from the SEH wrapper so this frame
-     *        holds no unwinding objects.
-     * @details Walks the player look chain (g_env -> p_game -> CCryAction -> p_action_game -> C_Player ->
-     *          look controller; see constants.hpp) and validates C_Player by its vtable. The look
+     *        toward level and/or sets the YAW (heading).
+     * @details Reads the look controller off @p c_player (see constants.hpp for the controller offsets). The look
      *          quaternion the cameras read is RE-DERIVED from the controller's scalar pitch+yaw every
      *          frame, so writing those scalars (not the derived quat, which is overwritten) is what
      *          actually moves the eye, the character head AND the movement heading. The mod redirects the
      *          look input while orbiting, so the writes stick; on any failure it returns without writing
-     *          and the camera-side level blend still levels the view. CCryAction is process-lifetime and
-     *          resolved once via a virtual GetIGameFramework call, then cached; the rest is a guarded walk.
+     *          and the camera-side level blend still levels the view.
+     * @param c_player The session-cached, vtable-validated C_Player (resolve_c_player).
      * @param pitch_ease Per-frame fraction to move the look pitch toward level, in [0, 1] (0 = leave it).
      * @param set_yaw When true, the look yaw is set to yaw_value to align the heading to the camera.
      * @param yaw_value Target look yaw in radians (engine convention: forward = (-sin yaw, cos yaw)).
      */
-    static void apply_orbit_aim_control_impl(float pitch_ease, bool set_yaw, float yaw_value)
+    static void apply_orbit_aim_control_impl(uintptr_t c_player, float pitch_ease, bool set_yaw, float yaw_value)
     {
-        const ModuleInfo &mod = module_info();
-        if (mod.base == 0)
-        {
-            return;
-        }
-        const uintptr_t g_env_addr = s_genv_runtime;
-        const auto p_game = DMK::Memory::seh_read<uintptr_t>(g_env_addr + Constants::GENV_PGAME_OFFSET);
-        if (!p_game || !DMK::Memory::plausible_userspace_ptr(*p_game))
-        {
-            return;
-        }
-
-        // CCryAction is process-lifetime; resolve it once via p_game->IGame::GetIGameFramework() (a
-        // trivial member getter) and cache, so the per-frame path is a pure guarded pointer walk.
-        static uintptr_t s_cry_action = 0;
-        if (!DMK::Memory::plausible_userspace_ptr(s_cry_action))
-        {
-            const auto vtable = DMK::Memory::seh_read<uintptr_t>(*p_game);
-            if (!vtable || !DMK::Memory::plausible_userspace_ptr(*vtable))
-            {
-                return;
-            }
-            const auto fn = DMK::Memory::seh_read<uintptr_t>(*vtable + Constants::IGAME_GET_FRAMEWORK_VTABLE_OFFSET);
-            if (!fn || !DMK::Memory::plausible_userspace_ptr(*fn))
-            {
-                return;
-            }
-            using GetFrameworkFn = uintptr_t(__fastcall *)(uintptr_t);
-            s_cry_action = reinterpret_cast<GetFrameworkFn>(*fn)(*p_game);
-            if (!DMK::Memory::plausible_userspace_ptr(s_cry_action))
-            {
-                s_cry_action = 0;
-                return;
-            }
-        }
-
-        // Heal the chain-root CCryAction -> CActionGame offset once (one-shot internally), as the resolver does.
-        heal_framework_offset(s_cry_action);
-
-        const auto p_action_game = DMK::Memory::seh_read<uintptr_t>(
-            s_cry_action + runtime_offsets().ccryaction_actiongame.load(std::memory_order_relaxed));
-        if (!p_action_game || !DMK::Memory::plausible_userspace_ptr(*p_action_game))
-        {
-            return;
-        }
-        const auto c_player = DMK::Memory::seh_read<uintptr_t>(
-            *p_action_game + runtime_offsets().cactiongame_local_actor.load(std::memory_order_relaxed));
-        if (!c_player || !DMK::Memory::plausible_userspace_ptr(*c_player))
-        {
-            return;
-        }
-        // Confirm this is really C_Player (its main vtable) before trusting the controller offset.
-        const auto vt = DMK::Memory::seh_read<uintptr_t>(*c_player);
-        if (!vt || !DMK::Rtti::vtable_is_type(*vt, Constants::C_PLAYER_RTTI_NAME))
+        if (pitch_ease <= 0.0f && !set_yaw)
         {
             return;
         }
         const auto controller = DMK::Memory::seh_read<uintptr_t>(
-            *c_player + runtime_offsets().c_player_look_controller.load(std::memory_order_relaxed));
+            c_player + runtime_offsets().c_player_look_controller.load(std::memory_order_relaxed));
         if (!controller || !DMK::Memory::plausible_userspace_ptr(*controller))
         {
             return;
@@ -711,14 +1098,102 @@ namespace TPVCamera
     }
 
     /**
-     * @brief SEH wrapper for the player-aim control: a stale pointer or layout drift in the look chain
-     *        must never crash the game. On a fault the aim is simply left unchanged for the frame.
+     * @brief Forces the player BODY to face a world yaw, making movement+facing camera-relative.
+     * @details The look controller (apply_orbit_aim_control_impl) is aim-only: writing its yaw steers the
+     *          movement frame but does not turn the body. The body heading is owned by the engine's
+     *          animated-character layer. This replicates CAnimatedCharacter::ForceOverrideRotation
+     *          (main vtable slot 95): set the override-active byte and store a yaw-only world quat
+     *          (XYZW, rotation about +Z); the animated-character update copies it into the entity
+     *          rotation for the frame, replacing the animation-derived facing, then clears the active
+     *          byte. It is consume-once, so this is called every frame while the heading is held.
+     *
+     *          Resolution starts from the same C_Player as apply_orbit_aim_control_impl -> C_AnimatedHuman ->
+     *          CAnimatedCharacter,
+     *          validated by the animchar vtable before any write. The quat is written before the active
+     *          byte so the game never observes active==1 with a torn/stale quat.
+     *          See constants.hpp (ANIMCHAR_*, C_PLAYER_ANIMATED_HUMAN_OFFSET) for the offsets.
      */
-    static void apply_orbit_aim_control(float pitch_ease, bool set_yaw, float yaw_value)
+    static void apply_orbit_body_turn_impl(uintptr_t c_player, float target_yaw)
+    {
+        // C_Player -> C_AnimatedHuman (+0x268) -> CAnimatedCharacter (+0x20). Validate the animchar vtable
+        // before touching its override fields; a mismatch means the layout drifted, so skip this frame.
+        const RuntimeOffsets &offsets = runtime_offsets();
+        const auto animated_human = DMK::Memory::seh_read<uintptr_t>(
+            c_player + offsets.c_player_animated_human.load(std::memory_order_relaxed));
+        if (!animated_human || !DMK::Memory::plausible_userspace_ptr(*animated_human))
+        {
+            return;
+        }
+        const auto anim_char = DMK::Memory::seh_read<uintptr_t>(
+            *animated_human + offsets.animated_human_animchar.load(std::memory_order_relaxed));
+        if (!anim_char || !DMK::Memory::plausible_userspace_ptr(*anim_char))
+        {
+            return;
+        }
+        const auto avt = DMK::Memory::seh_read<uintptr_t>(*anim_char);
+        if (!avt || !RttiCache::is_type(*avt, Constants::ANIMATED_CHARACTER_RTTI_NAME))
+        {
+            return;
+        }
+
+        // Yaw-only world quat (XYZW): rotation about +Z by target_yaw == {0, 0, sin(y/2), cos(y/2)}.
+        const float half = target_yaw * 0.5f;
+        const uintptr_t quat_addr = *anim_char + Constants::ANIMCHAR_OVERRIDE_ROT_QUAT_OFFSET;
+        *reinterpret_cast<float *>(quat_addr + Constants::QUAT_X_OFFSET) = 0.0f;
+        *reinterpret_cast<float *>(quat_addr + Constants::QUAT_Y_OFFSET) = 0.0f;
+        *reinterpret_cast<float *>(quat_addr + Constants::QUAT_Z_OFFSET) = std::sin(half);
+        *reinterpret_cast<float *>(quat_addr + Constants::QUAT_W_OFFSET) = std::cos(half);
+        // Set the active byte LAST so the animated-character update (a separate consumer) never reads
+        // active==1 with a half-written quat. The release fence orders the quat stores before the active
+        // store explicitly rather than relying on the target's store-store ordering; on x86 it lowers to a
+        // compiler barrier with no runtime cost.
+        std::atomic_thread_fence(std::memory_order_release);
+        *reinterpret_cast<volatile unsigned char *>(*anim_char + Constants::ANIMCHAR_OVERRIDE_ROT_ACTIVE_OFFSET) = 1;
+    }
+
+    /**
+     * @struct OrbitAimWrites
+     * @brief Every write the orbit makes into the player's aim and body in one frame, committed together.
+     */
+    struct OrbitAimWrites
+    {
+        float pitch_ease = 0.0f; ///< Look pitch ease toward level, in [0, 1] (0 = leave it).
+        bool set_yaw = false;    ///< Set the look yaw to @ref yaw.
+        bool body_turn = false;  ///< Force the body to face @ref yaw (consume-once override).
+        float yaw = 0.0f;        ///< Heading for the look yaw and the body turn, radians.
+    };
+
+    /**
+     * @brief Commits one frame's orbit aim writes: the C_Player is resolved once, then the look controller and
+     *        the body override are written. Separated from the SEH wrapper so this frame holds no unwinding
+     *        objects.
+     */
+    static void apply_orbit_aim_writes_impl(const OrbitAimWrites &w)
+    {
+        // The C_Player comes from the session cache (resolve_c_player), already confirmed by its main vtable,
+        // so the offsets both writers read are read off a validated object.
+        const uintptr_t c_player = resolve_c_player();
+        if (detour_hot_block().module_lo == 0 || c_player == 0)
+        {
+            return;
+        }
+        apply_orbit_aim_control_impl(c_player, w.pitch_ease, w.set_yaw, w.yaw);
+        if (w.body_turn)
+        {
+            apply_orbit_body_turn_impl(c_player, w.yaw);
+        }
+    }
+
+    /**
+     * @brief SEH wrapper for the orbit aim writes: a stale pointer or layout drift in the look or animated-
+     *        character chain must never crash the game. On a fault the writes not yet made are dropped for the
+     *        frame, and the aim and body are left as they are.
+     */
+    static void apply_orbit_aim_writes(const OrbitAimWrites &w)
     {
         __try
         {
-            apply_orbit_aim_control_impl(pitch_ease, set_yaw, yaw_value);
+            apply_orbit_aim_writes_impl(w);
         }
         __except (EXCEPTION_EXECUTE_HANDLER)
         {
@@ -726,79 +1201,922 @@ namespace TPVCamera
     }
 
     /**
-     * @brief Forces the player BODY to face a world yaw, making movement+facing camera-relative.
-     * @details The look controller (apply_orbit_aim_control) is aim-only: writing its yaw steers the
-     *          movement frame but does not turn the body. The body heading is owned by the engine's
-     *          animated-character layer. This replicates CAnimatedCharacter::ForceOverrideRotation
-     *          (main vtable slot 95): set the override-active byte and store a yaw-only world quat
-     *          (XYZW, rotation about +Z); the animated-character update copies it into the entity
-     *          rotation for the frame, replacing the animation-derived facing, then clears the active
-     *          byte. It is consume-once, so this is called every frame while the heading is held.
-     *
-     *          Resolution mirrors apply_orbit_aim_control_impl: g_env -> p_game -> CCryAction (cached) ->
-     *          p_action_game -> C_Player (validated vtable) -> C_AnimatedHuman -> CAnimatedCharacter,
-     *          validated by the animchar vtable before any write. The quat is written before the active
-     *          byte so the game never observes active==1 with a torn/stale quat.
-     *          See constants.hpp (ANIMCHAR_*, C_PLAYER_ANIMATED_HUMAN_OFFSET) for the offsets.
+     * @brief Collision probe density for this frame, from the follow distance and the arm's angular speed.
+     * @details The fan and the physics coverage samples resolve features well below what a far camera or a fast
+     *          swing can show, so those frames cast fewer rays: Coarse above COLLISION_LOD_COARSE_SPEED, Medium above
+     *          COLLISION_LOD_MEDIUM_SPEED or beyond COLLISION_LOD_MEDIUM_DISTANCE (the live follow distance, zoom
+     *          included), Fine otherwise. The speed is the angle the pivot -> camera direction turned since the last
+     *          frame over the frame delta, low-passed so one jittery frame does not switch levels; each threshold
+     *          has COLLISION_LOD_HYSTERESIS on the way back. Render thread only.
+     * @param ray_dir Unit pivot -> camera direction this frame.
+     * @param follow_distance Desired pivot -> camera distance this frame.
+     * @param delta_time Frame delta, seconds.
+     * @param enabled [Collision] UseCollisionLod; false always returns Fine (the speed is still tracked).
+     */
+    static CollisionLod select_collision_lod(const Vector3 &ray_dir, float follow_distance, float delta_time,
+                                             bool enabled)
+    {
+        constexpr float k_speed_smooth = 0.35f;
+        static Vector3 s_prev_dir{};
+        static bool s_have_prev = false;
+        static float s_speed = 0.0f; // low-passed arm angular speed, rad/s
+        static CollisionLod s_lod = CollisionLod::Fine;
+
+        if (s_have_prev && delta_time > 1e-4f)
+        {
+            const float c = std::clamp(ray_dir.x * s_prev_dir.x + ray_dir.y * s_prev_dir.y + ray_dir.z * s_prev_dir.z,
+                                       -1.0f, 1.0f);
+            s_speed += (std::acos(c) / delta_time - s_speed) * k_speed_smooth;
+        }
+        s_prev_dir = ray_dir;
+        s_have_prev = true;
+        if (!enabled)
+        {
+            s_lod = CollisionLod::Fine;
+            return s_lod;
+        }
+
+        // A threshold the current level already passed is held with hysteresis.
+        const auto over = [](float value, float threshold, bool held)
+        { return value > threshold * (held ? Constants::COLLISION_LOD_HYSTERESIS : 1.0f); };
+        const bool coarse_held = (s_lod == CollisionLod::Coarse);
+        const bool medium_held = (s_lod != CollisionLod::Fine);
+        if (over(s_speed, Constants::COLLISION_LOD_COARSE_SPEED, coarse_held))
+        {
+            s_lod = CollisionLod::Coarse;
+        }
+        else if (over(s_speed, Constants::COLLISION_LOD_MEDIUM_SPEED, medium_held) ||
+                 over(follow_distance, Constants::COLLISION_LOD_MEDIUM_DISTANCE, medium_held))
+        {
+            s_lod = CollisionLod::Medium;
+        }
+        else
+        {
+            s_lod = CollisionLod::Fine;
+        }
+        return s_lod;
+    }
+
+    // This frame's telemetry record ([Advanced] RecordTelemetry, telemetry.hpp): solve_camera_collision fills in what
+    // each probe returned, record_collision_telemetry the arm and the final distance. Render thread only.
+    static Telemetry::FrameRecord s_telemetry{};
+    static_assert(sizeof(Telemetry::FrameRecord::walk_cov) / sizeof(float) == Constants::COVERAGE_SKIP_MAX,
+                  "telemetry walk_cov holds one coverage per coverage-walk step");
+
+    /** @brief Clears s_telemetry for a new collision frame (every probe result reads "no hit"). */
+    static void begin_collision_telemetry()
+    {
+        s_telemetry = Telemetry::FrameRecord{};
+        s_telemetry.fan_distance = -1.0f;
+        s_telemetry.sphere_distance = -1.0f;
+        s_telemetry.render_distance = -1.0f;
+        s_telemetry.blocked_cov = -9.0f;
+    }
+
+    /** @brief Completes s_telemetry with the arm and the placed camera, and hands it to the recorder. */
+    static void record_collision_telemetry(const CameraState &cam, const Vector3 &pivot, const Vector3 &desired_arm,
+                                           float delta_time)
+    {
+        Telemetry::FrameRecord &rec = s_telemetry;
+        rec.ticks = Profiler::now_ticks();
+        rec.frame_index = FrameClock::stamp().frame;
+        rec.delta_time = delta_time;
+        rec.pivot[0] = pivot.x;
+        rec.pivot[1] = pivot.y;
+        rec.pivot[2] = pivot.z;
+        rec.to_camera[0] = desired_arm.x;
+        rec.to_camera[1] = desired_arm.y;
+        rec.to_camera[2] = desired_arm.z;
+        rec.desired_distance = desired_arm.magnitude();
+        rec.collision_distance = cam.collision_valid ? cam.collision_distance : rec.desired_distance;
+        rec.game_state_mask = game_state_mask().load(std::memory_order_relaxed);
+        Telemetry::record(rec);
+    }
+
+    /**
+     * @brief Adds this frame's collision-stage cost to the heatmap ([Advanced] CollisionHeatmap) and, when the cell
+     *        has a new worst frame whose fan collider is not named yet, names it from the render brush at the fan hit.
+     */
+    static void record_collision_heatmap(const Vector3 &pivot, const Vector3 &desired_arm, float cost_us)
+    {
+        const std::uint64_t collider = s_telemetry.fan_distance > 0.0f ? s_telemetry.collider : 0;
+        if (!CollisionHeatmap::record(pivot, desired_arm, cost_us, collider))
+        {
+            return;
+        }
+        const float arm_len = desired_arm.magnitude();
+        if (arm_len <= 1e-4f)
+        {
+            return;
+        }
+        const Vector3 hp = pivot + desired_arm * (s_telemetry.fan_distance / arm_len);
+        void *node = reinterpret_cast<void *>(static_brush_render_node(static_cast<uintptr_t>(collider)));
+        char name[CollisionHeatmap::k_name_len] = {};
+        float ext[3] = {};
+        int kind = 0;
+        if (render_hit_info(hp, node, name, static_cast<int>(sizeof(name)), ext, &kind))
+        {
+            CollisionHeatmap::set_name(pivot, name);
+        }
+    }
+
+    // Hold the collision pull-in across edge hit/miss gaps this long (seconds) after the last blocking hit.
+    constexpr float k_collision_hold_seconds = 0.3f;
+
+    /**
+     * @struct CollisionQuery
+     * @brief One recompute of the camera-collision stage: the arm and settings every stage reads, and what each stage
+     *        hands to the next.
+     * @details solve_camera_collision runs the stages in order over one query: collision_walk (the fan and the
+     *          coverage classification of each collider it meets) settles the nearest covering hit and the colliders it
+     *          saw past; collision_sphere smooths that hit, skipping those same colliders; collision_blocking turns it
+     *          into a blocking distance; collision_render_clamp bounds its render-octree box by that distance; and
+     *          collision_lateral pulls in from converging side walls. The skip list, the arm and the governor tier are
+     *          derived once here instead of per stage. The engine work of each stage is timed under its profiler
+     *          stage (RayFan and Coverage for the walk, then SphereSweep, RenderOcclusion and LateralProbe). Render
+     *          thread only.
+     */
+    struct CollisionQuery
+    {
+        Vector3 pivot{};
+        Vector3 to_camera{};       // pivot -> desired camera
+        Vector3 ray_dir{};         // to_camera, normalized
+        float desired_distance = 0.0f;
+        float radius = 0.0f;       // [Collision] CollisionRadius: the fan tube half-width and the sphere radius
+        float cov_thresh = 0.0f;   // coverage gate threshold; 0 = gate off (collide on the nearest solid)
+        bool use_coverage = false; // UseCoverageCollision: the coverage gate and the lateral probe
+        bool async_collision = false;
+        CollisionLod lod = CollisionLod::Fine;
+        CollisionGovernor::Tier tier = CollisionGovernor::Tier::Full;
+
+        // collision_walk: the fan hit the walk blocked on (std::nullopt = open arm), the measured coverage of that
+        // occluder (-9 = not measured: gate off, terrain, or an unmeasurable solid), and the colliders seen past.
+        // The skip list lives on the query so the sphere stage skips the SAME near geometry and reaches the wall
+        // the fan blocks on; otherwise the sphere stops at a skipped window, disagrees with the fan's farther
+        // block, is rejected, and the camera falls back to the jumpy discrete fan distance.
+        std::optional<RayHit> fan{};
+        float blocked_cov = -9.0f;
+        uintptr_t cov_skip[Constants::COVERAGE_SKIP_MAX] = {};
+        int n_cov_skip = 0;
+
+        // collision_sphere: the hit the camera collides on (the fan's, or the sphere's when they agree).
+        std::optional<RayHit> hit{};
+        bool from_sphere = false;
+
+        // collision_blocking / collision_render_clamp: the skin-adjusted distance the camera must stay within.
+        float blocking_distance = 0.0f;
+        bool blocked = false;
+    };
+
+    /** @brief Records the walk's outcome (q.fan, q.blocked_cov, the skip count) in this frame's telemetry. */
+    static void record_walk_telemetry(const CollisionQuery &q)
+    {
+        s_telemetry.blocked_cov = q.blocked_cov;
+        s_telemetry.n_walk = static_cast<std::uint8_t>(q.n_cov_skip);
+        if (q.fan.has_value())
+        {
+            s_telemetry.fan_distance = q.fan->m_distance;
+            s_telemetry.collider = q.fan->m_collider;
+            if (q.fan->m_terrain != 0)
+            {
+                s_telemetry.flags |= Telemetry::k_flag_terrain;
+            }
+        }
+    }
+
+    /**
+     * @brief Walk stage: the nearest occluder along the arm that actually hides the body.
+     * @details Fills q.fan, q.blocked_cov and the skip list (q.cov_skip / q.n_cov_skip). See the comment in the body.
+     */
+    static void collision_walk(CollisionQuery &q, const RenderSettings &cfg, uintptr_t c_player)
+    {
+        // Find the nearest occluder that actually HIDES the body. With the coverage gate OFF (cov_thresh
+        // <= 0) this is just the nearest solid world surface. With it ON, WALK the arm: step through
+        // readable THIN props -- each measured by ITS OWN visible mesh (via the brush the ray actually
+        // hit, resolved through the collider's foreign data), so a foreground basket / pole the body is
+        // plainly visible past is skipped -- and stop at the first thing that genuinely covers the body: a
+        // solid we cannot rasterize (a building's compound mesh, a pure-physics proxy), terrain, or a
+        // readable mesh hiding >= CoverageThreshold of the body. If only thin props lie between the camera
+        // and the body with open space behind them, nothing covers and the camera stays out (no jolt).
+        // This judges each occluder on its own merit, where the prior single-shot gate saw only the
+        // nearest brush and let the body sit buried behind everything past it.
+        if (q.cov_thresh <= 0.0f)
+        {
+            q.fan = unskipped_fan(q.pivot, q.to_camera, q.radius, q.async_collision, q.lod);
+        }
+        else
+        {
+            const Vector3 desired_cam = q.pivot + q.to_camera;
+            // Arm the live player world AABB the coverage samplers read so coverage is measured against
+            // the REAL posed player (crouch / lying / mount / actual screen position), not a fixed
+            // synthetic box. It is read from the engine on the first measurement of this walk, if any,
+            // and shared by the rest. Invalid -> the samplers fall back to the synthetic box.
+            arm_player_world_bounds(&publish_player_world_bounds, c_player);
+            // Head-priority gate: if >= this fraction of the HEAD is still visible, skip the occluder
+            // (no clamp) regardless of total coverage. 0 = off. Only suppresses a clamp, never forces one.
+            const float head_visible_skip = cfg.head_visible_skip;
+            const int walk_steps = (q.tier >= CollisionGovernor::Tier::ShortWalk)
+                                       ? CollisionGovernor::k_short_walk_steps
+                                       : Constants::COVERAGE_SKIP_MAX;
+            const bool physics_coverage = q.tier >= CollisionGovernor::Tier::PhysicsCoverage;
+            for (int iter = 0; iter < Constants::COVERAGE_SKIP_MAX; ++iter)
+            {
+                // Only the first, unskipped step can come off the collision worker: every later step skips
+                // the colliders this frame's walk just judged, so it cannot be queued a frame ahead.
+                std::optional<RayHit> h;
+                if (q.n_cov_skip == 0)
+                {
+                    h = unskipped_fan(q.pivot, q.to_camera, q.radius, q.async_collision, q.lod);
+                }
+                else
+                {
+                    TPVCAMERA_PROFILE_SCOPE(RayFan);
+                    h = ray_fan_sweep(q.pivot, q.to_camera, q.radius, Constants::RWI_OBJTYPES_CAMERA,
+                                      Constants::RWI_FLAGS_STOP_AT_SOLID, q.cov_skip, q.n_cov_skip, q.lod);
+                }
+                if (!h.has_value() || h->m_distance >= q.desired_distance)
+                {
+                    break; // open past here -> nothing between camera and body hides it
+                }
+                if (h->m_terrain != 0)
+                {
+                    q.fan = h; // terrain always covers (never see under the world)
+                    break;
+                }
+                if (iter >= walk_steps)
+                {
+                    q.fan = h; // governor: no budget left to judge another prop -> collide (the safe verdict)
+                    break;
+                }
+                // How much of the character does this collider hide? Cheap footprint pre-check, then
+                // visible-mesh raster, then a physics-ray fallback -- cached per collider so a solid the
+                // camera slides along is not re-rasterized every frame. See measure_collider_coverage.
+                float head_cov = -1.0f;
+                const float cov = measure_collider_coverage(h->m_collider, h->m_point, q.pivot, desired_cam,
+                                                            q.to_camera, &head_cov, physics_coverage, q.lod);
+                // Head-priority gate: when enough of the head is VISIBLE, suppress the block on this
+                // occluder (look behind it) even if total coverage would clamp. Only a MEASURED head
+                // (head_cov >= 0) gates -- an unmeasurable solid (head_cov < 0) still blocks below.
+                const bool head_visible_enough = head_visible_skip > 0.0f && head_cov >= 0.0f &&
+                                                 (1.0f - head_cov) >= head_visible_skip;
+                const bool cov_blocks = (cov < 0.0f || cov >= q.cov_thresh) && !head_visible_enough;
+                if (cov_blocks)
+                {
+                    // Unmeasurable solid (building / pure-physics) OR a readable mesh that hides enough of
+                    // the body (and the head is not visible enough to override) -> this is the collision.
+                    q.blocked_cov = cov;
+                    q.fan = h;
+                    break;
+                }
+                if (h->m_collider == 0)
+                {
+                    q.fan = h; // cannot skip an unknown collider -> stop here (safe: collide)
+                    break;
+                }
+                s_telemetry.walk_cov[q.n_cov_skip] = cov;
+                q.cov_skip[q.n_cov_skip++] = h->m_collider; // visible past it (thin / head shows) -> look behind
+            }
+        }
+        record_walk_telemetry(q);
+    }
+
+    /** @brief Takes @p sphere (distance from the pivot) as q.hit when it agrees with the fan's world surface. */
+    static void adopt_agreeing_sphere(CollisionQuery &q, const std::optional<RayHit> &sphere)
+    {
+        if (q.fan.has_value() && sphere.has_value() && sphere->m_distance >= q.fan->m_distance - q.radius - 0.10f &&
+            sphere->m_distance <= q.fan->m_distance + 0.05f)
+        {
+            q.hit = sphere; // sphere agrees with the fan's world surface -> use it (continuous, no pump)
+            q.from_sphere = true;
+            s_telemetry.flags |= Telemetry::k_flag_from_sphere;
+        }
+    }
+
+    /**
+     * @brief Sphere stage: smooths the walk's hit with the swept sphere when the two agree (UseSphereCollision).
+     * @details Sets q.hit to the fan's hit, or to the sphere's when it agrees with the fan's world surface.
+     */
+    static void collision_sphere(CollisionQuery &q, const RenderSettings &cfg)
+    {
+        // Prefer the swept SPHERE (PrimitiveWorldIntersection): its contact distance is continuous
+        // as the sweep grazes edges, so the camera does not pump in dense geometry the way a single
+        // thin ray does (the root cause of the orbit position-jump). The sphere radius is the
+        // standoff, so no skin is subtracted on this path. Fall back to the thin ray (with skin)
+        // when the sphere is disabled, unavailable, or faults, so collision always works and never
+        // regresses.
+        // Camera collision = swept SPHERE (smooth) cross-checked against an RWI multi-ray FAN (correct).
+        // The PrimitiveWorldIntersection sphere may not honour our object types: the fork SPWIParams keeps
+        // a FLAGS field at +0x98 and the real entTypes at +0x9C, and +0x9C is a static-RE inference (the
+        // sim-class filter runs in a dispatched processor), so the sphere cannot be trusted to type-filter
+        // on its own. With entTypes effectively ent_all the sweep can hit the player's OWN
+        // CArticulatedEntity (skeleton + worn-gear physics) at point-blank (the "shield on the back" case).
+        // So the sphere is CROSS-CHECKED against the FAN (centre + 4 rays offset by the radius; RWI takes
+        // objtypes as a plain function ARG so it is provably correct), which gives the true nearest WORLD
+        // distance. The sphere is trusted ONLY when its contact is not closer than that world distance
+        // (allowing the sphere-radius inset); otherwise the fan distance is used. So the sphere can only
+        // make the result SMOOTHER, never closer than the world: no regression.
+        q.hit = q.fan;
+        q.from_sphere = false;
+        // UseSphereCollision selects the probe: when set, the swept SPHERE smooths the fan's world hit
+        // (continuous contact distance, no pump in dense geometry); when clear, the multi-ray FAN result
+        // is used alone (with the configured skin) for a cheaper, ray-only probe that skips the per-frame
+        // PWI sweep. The FAN is always the collision AUTHORITY either way; the sphere can only make the
+        // result smoother, never closer.
+        if (cfg.use_sphere_collision)
+        {
+            // The swept sphere can't type-filter in this fork (the SPWIParams entTypes field is dead -- the
+            // sweep effectively queries ent_all), so it slams into the player's BODY and back-worn GEAR
+            // (sword / crossbow / shield) at the pivot end. Spending the 4-entry skip cap on the player
+            // leaves none for the occluders the walk saw past, so in clutter the sphere stops at a prop,
+            // disagrees with the fan's farther wall block, and is rejected -> the jumpy fan. Instead, START
+            // the sweep PAST the body + gear (offset along the arm), so the player is behind the origin and
+            // never hit, freeing the whole skip list for the walk's occluders. The sphere then reaches the
+            // wall the fan blocks on and smooths it even indoors. A collision inside the offset is still
+            // caught by the FAN (the authority), so this never clips -- it only adds smooth frames. (Also
+            // drops the per-frame 10-ray player-skip probe.)
+            const Vector3 sph_dir = q.to_camera / q.desired_distance; // > 1e-3 (checked by the caller)
+            const float sph_clear = std::min(0.55f, q.desired_distance * 0.5f); // start past the body + worn gear
+            const Vector3 sph_origin = q.pivot + sph_dir * sph_clear;
+            uintptr_t skip_ents[4];
+            int n_skip = 0;
+            for (int i = 0; i < q.n_cov_skip && n_skip < 4; ++i) // the occluders the walk saw past
+            {
+                const uintptr_t c = q.cov_skip[i];
+                bool dup = (c == 0);
+                for (int k = 0; k < n_skip && !dup; ++k)
+                {
+                    dup = (skip_ents[k] == c);
+                }
+                if (!dup)
+                {
+                    skip_ents[n_skip++] = c;
+                }
+            }
+            std::optional<RayHit> sphere;
+            {
+                TPVCAMERA_PROFILE_SCOPE(SphereSweep);
+                sphere = paced_sphere_sweep(sph_origin, q.radius, q.to_camera - sph_dir * sph_clear,
+                                            skip_ents, n_skip,
+                                            cfg.non_blocking_sweep);
+            }
+            if (sphere.has_value())
+            {
+                sphere->m_distance += sph_clear; // re-base from the offset origin back to the pivot
+                s_telemetry.sphere_distance = sphere->m_distance;
+            }
+            // The FAN (0x101 = static|terrain) is the AUTHORITY for collision: a plain objtypes arg that
+            // provably excludes ALL actors (player body/gear, NPCs = ent_living/independent/rigid). The PWI
+            // sphere only SMOOTHS the fan's world hit -- it queries ent_all (the struct entTypes is dead in
+            // this fork, so it cannot be type-filtered and returns no collider to test), so it is trusted
+            // ONLY when it AGREES with the fan's world surface (within the radius inset). Crucially, when
+            // the fan finds NO world (open space), there is NO collision -- any actor the sphere saw (an
+            // NPC at the camera, your own shield) is ignored = transparent, like non-physicalized grass.
+            // This drops actor collisions UNIFORMLY with no skip-list / probe and no per-entity guessing.
+            adopt_agreeing_sphere(q, sphere);
+        }
+    }
+
+    /**
+     * @brief Pipelined stage (PipelinedCollision, coverage gate off): takes the walk and sphere results from the
+     *        collision worker's solve of last frame's arm, and queues this frame's arm for the next.
+     * @details Stands in for collision_walk + collision_sphere: with the gate off the walk is the one unskipped
+     *          fan and the sphere sweep skips nothing, so the whole physics solve depends only on the arm and can
+     *          run a frame ahead off the render thread. The result is used when it was solved for an arm within
+     *          k_async_arm_tol of this frame's (a one-frame-old world hit, absorbed by the pull-in ease and the
+     *          collision hold, as with AsyncCollision) and with the same sphere setting; otherwise the caller
+     *          solves synchronously. Blocking, render clamp and the lateral probe still run here: the render
+     *          octree caches are render-thread only.
+     * @return true when q.fan / q.hit were filled from the worker.
+     */
+    static bool collision_pipelined(CollisionQuery &q, const RenderSettings &cfg)
+    {
+        constexpr float k_async_arm_tol2 = 0.06f * 0.06f; // matches unskipped_fan
+        // Same offset origin as collision_sphere: start past the body + worn gear.
+        const float sph_clear = cfg.use_sphere_collision ? std::min(0.55f, q.desired_distance * 0.5f) : -1.0f;
+        bool used = false;
+        if (const std::optional<AsyncArmResult> prev = take_arm_async(); prev.has_value())
+        {
+            used = (prev->m_origin - q.pivot).magnitude_squared() <= k_async_arm_tol2 &&
+                   (prev->m_sweep - q.to_camera).magnitude_squared() <= k_async_arm_tol2 &&
+                   std::fabs(prev->m_radius - q.radius) <= 1e-4f &&
+                   (prev->m_sphere_clear >= 0.0f) == (sph_clear >= 0.0f);
+            if (used)
+            {
+                q.fan = prev->m_fan;
+                record_walk_telemetry(q);
+                q.hit = q.fan;
+                q.from_sphere = false;
+                std::optional<RayHit> sphere = prev->m_sphere;
+                if (sphere.has_value())
+                {
+                    sphere->m_distance += prev->m_sphere_clear; // re-base from the offset origin to the pivot
+                    s_telemetry.sphere_distance = sphere->m_distance;
+                }
+                adopt_agreeing_sphere(q, sphere);
+            }
+        }
+        submit_arm_async(q.pivot, q.to_camera, q.radius, sph_clear, q.lod);
+        return used;
+    }
+
+    /**
+     * @brief Blocking stage: the skin-adjusted distance the camera must stay within for q.hit.
+     */
+    static void collision_blocking(CollisionQuery &q, const RenderSettings &cfg)
+    {
+        // Nearest SOLID-world block, skin-adjusted. Sphere path insets by the radius already, so it
+        // subtracts no extra skin; thin-ray path subtracts the configured skin.
+        q.blocking_distance = q.desired_distance;
+        q.blocked = false;
+        if (q.hit.has_value() && q.hit->m_distance < q.desired_distance)
+        {
+            // The coverage walk above already decided this hit COVERS the body (or the gate is off and the
+            // nearest solid blocks), so pull the camera to it. The sphere path already inset by the radius
+            // (no extra skin); the thin-ray path subtracts the configured skin before the surface.
+            const float skin = q.from_sphere ? 0.0f : cfg.collision_skin;
+            q.blocking_distance = std::max(0.0f, q.hit->m_distance - skin);
+            q.blocked = true;
+        }
+    }
+
+    /**
+     * @brief Trace-only stage: logs the physics collision hit (PhysicsCollisionHit) when it toggles or moves.
+     * @param camera_position The desired (pre-collision) camera, for the record.
+     */
+    static void collision_trace_hit(const CollisionQuery &q, const Vector3 &camera_position)
+    {
+        // Trace the PHYSICS collision hit (the solid-world fan/sphere result) so it can be compared
+        // against RenderOcclusion HIT: physics fires on walls / terrain / solid props (objtypes
+        // ent_static|ent_terrain), render occlusion on non-physical cloth. Where physics is silent but
+        // render fires (or vice versa) is the proof they are complementary, not redundant. Rate-limited
+        // to a meaningful change (block-state toggle or distance move > 0.1m) so it never spams a frame.
+        static bool s_phys_blocked = false;
+        static float s_phys_dist = -1.0f;
+        const float dd = q.blocked ? (q.hit->m_distance - s_phys_dist) : 0.0f;
+        const bool moved = (dd > 0.1f) || (dd < -0.1f);
+        // The trace below identifies the hit object via a render-octree query (render_hit_info); gate it
+        // on trace logging being ENABLED so that diagnostic octree + per-node vertex scan never runs on
+        // a normal-play frame -- it is purely for the PhysicsCollision HIT log. (A foreign-null hit, the
+        // common case once the coverage walk skips thin scenery, takes render_hit_info's expensive
+        // octree path, which was running every frame the camera moved while blocked.)
+        const bool trace_on = TraceRing::enabled();
+        if (trace_on && q.blocked && (q.blocked != s_phys_blocked || moved))
+        {
+            // The FAN is the collision AUTHORITY: it carries the real collider + surface normal. The
+            // sphere only SMOOTHS the distance and reports a synthetic normal / null collider, so identify
+            // the object the camera blocked on from the fan (point + collider), not the sphere's `hit`.
+            // node = the collider's foreign render-node link (0 for a merged / proxy collider, which
+            // render_hit_info then resolves by querying the render octree at the hit point).
+            const RayHit &id_hit = q.fan.has_value() ? *q.fan : *q.hit;
+            const Vector3 &hp = id_hit.m_point;
+            const Vector3 &hn = id_hit.m_normal;
+            const int hit_terrain = id_hit.m_terrain;
+            const uintptr_t collider = id_hit.m_collider;
+            void *node = reinterpret_cast<void *>(static_brush_render_node(collider));
+            // The brush name is written straight into the trace record; the line is formatted off-thread
+            // (trace_ring.hpp).
+            TraceRing::Writer trace(TraceRing::Event::PhysicsCollisionHit);
+            float obj_ext[3] = {};
+            int obj_kind = 0;
+            (void)render_hit_info(hp, node, trace.text_buffer(), TraceRing::k_text_len, obj_ext, &obj_kind);
+            static const char *const k_obj_kinds[] = {"none", "foreign", "prop", "solid", "hlod"};
+            const char *kind_str = (obj_kind >= 0 && obj_kind <= 4) ? k_obj_kinds[obj_kind] : "?";
+            trace.str(q.from_sphere ? "sphere" : "fan")
+                .i64(hit_terrain)
+                .f32(q.hit->m_distance)
+                .f32(q.desired_distance)
+                .f32(q.blocked_cov)
+                .str(kind_str)
+                .vec3(obj_ext[0], obj_ext[1], obj_ext[2])
+                .hex(collider)
+                .hex(reinterpret_cast<uintptr_t>(node))
+                .vec3(hp)
+                .vec3(hn)
+                .vec3(camera_position)
+                .vec3(q.pivot)
+                .commit();
+        }
+        s_phys_blocked = q.blocked;
+        if (q.blocked)
+        {
+            s_phys_dist = q.hit->m_distance;
+        }
+    }
+
+    /**
+     * @brief Render stage: clamps q.blocking_distance below a render-only overhead roof (UseRenderOcclusion).
+     */
+    static void collision_render_clamp(CollisionQuery &q, const RenderSettings &cfg)
+    {
+        // Render-only overhead roofs (tent / awning canopy cloth) carry no ray-collidable physics, so the
+        // fan and sphere glide through them and the cloth buries the camera on a look-down. Query the
+        // render octree along the same arm and clamp below an overhead brush. The radius is the standoff
+        // (already applied by render_occlusion_limit), so no skin is subtracted. Enabling/disabling render
+        // occlusion is still UseRenderOcclusion alone; but when UseCoverageCollision is ON it also passes
+        // the coverage threshold, so render occlusion drops thin props the body is plainly visible past (a
+        // pole / bird feeder) instead of clamping on them -- keyed on the REAL projected player extent, so
+        // a view-burying canopy (high coverage on a look-down) still clamps. With cov_thresh = 0 (coverage
+        // collision off) the prior behavior holds: only the sightline vertex-count test filters brushes.
+        if (cfg.use_render_occlusion)
+        {
+            // Query the render octree only out to where the physics collision already stops the camera: a
+            // roof beyond that point can never be reached, so indoors / near walls (where physics blocks
+            // close) the query box shrinks to the short arm and skips the room's geometry, the bulk of the
+            // render-occlusion cost in dense scenes.
+            const Vector3 occ_arm = q.ray_dir * q.blocking_distance;
+            // Pass the coverage threshold so render occlusion can drop thin props the body is visible
+            // past (UseRenderOcclusion respecting CoverageCollision). cov_thresh is 0 when coverage
+            // collision is off, which leaves render occlusion on its sightline-only test (prior behavior).
+            std::optional<float> roof;
+            {
+                TPVCAMERA_PROFILE_SCOPE(RenderOcclusion);
+                const float requery_scale = (q.tier >= CollisionGovernor::Tier::CoarseOcclusion)
+                                                ? CollisionGovernor::k_coarse_requery_scale
+                                                : 1.0f;
+                roof = render_occlusion_limit(q.pivot, occ_arm, q.radius, q.cov_thresh, requery_scale);
+            }
+            if (roof.has_value())
+            {
+                s_telemetry.render_distance = roof.value();
+            }
+            if (roof.has_value() && roof.value() < q.blocking_distance)
+            {
+                q.blocking_distance = std::max(0.0f, roof.value());
+                q.blocked = true;
+                s_telemetry.flags |= Telemetry::k_flag_render_clamp;
+            }
+        }
+    }
+
+    /**
+     * @brief Lateral stage: pulls @p allowed_distance in until no converging side wall is within CameraProbeSize.
+     * @details Latches the collision hold and sets q.blocked when it pulls in.
+     */
+    static void collision_lateral(CollisionQuery &q, const RenderSettings &cfg, CameraState &cam,
+                                  float &allowed_distance)
+    {
+        TPVCAMERA_PROFILE_SCOPE(LateralProbe);
+        // Lateral / frustum clearance. The pivot->camera probe only sees obstacles ALONG the arm, so a
+        // wall BESIDE the camera (a corner, a doorway jamb, a narrow gap) is invisible to it and intrudes
+        // into the view. Probe the camera's lateral surroundings (the frustum cross-section: +-right /
+        // +-up around the look axis) and pull the camera further in along the arm until any CONVERGING
+        // side wall is at least CameraProbeSize away. This is geometric penetration safety, NOT occlusion,
+        // so it bypasses the coverage gate (a side wall does not hide the character) and queries static /
+        // terrain world only (RWI_OBJTYPES_CAMERA never returns the player or NPCs). A wall the arm runs
+        // PARALLEL to (a corridor) cannot be escaped by pulling in, so it is left alone rather than yanking
+        // the camera to first person. Bounded passes; only does work when something is within reach.
+        const float probe = q.use_coverage ? cfg.camera_probe_size : 0.0f;
+        if (probe > 0.0f && allowed_distance > q.radius)
+        {
+            const Vector3 view = q.ray_dir * -1.0f; // the camera looks back along the arm toward the pivot
+            Vector3 probe_right = view.cross(Vector3{0.0f, 0.0f, 1.0f});
+            const float rl = probe_right.magnitude();
+            if (rl > 1e-4f)
+            {
+                probe_right = probe_right / rl;
+                const Vector3 probe_up = probe_right.cross(view); // orthonormal (right & view perpendicular)
+                const Vector3 lateral[4] = {probe_right, probe_right * -1.0f, probe_up, probe_up * -1.0f};
+                // Floor the pull-in at the closest USEFUL third-person distance (follow_distance_min). A side
+                // wall grazing the frustum is a SOFTER concern than a direct occluder, so never drag the
+                // camera to near first person (losing the whole view + jamming into the character) just to
+                // hold one off -- accept a little intrusion instead. Capped to the incoming allowed_distance
+                // so a tight pull from a real along-arm occluder is never pushed back OUT into it.
+                const float lateral_floor = std::min(allowed_distance, cfg.follow_distance_min);
+                for (int pass = 0; pass < 3 && allowed_distance > lateral_floor; ++pass)
+                {
+                    // The four sides share an origin, so each pass casts them as one batch (one world read,
+                    // one SEH frame) rather than four separately guarded rays.
+                    const Vector3 cam_test = q.pivot + q.ray_dir * allowed_distance;
+                    RaySpec side_rays[4];
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        side_rays[i] = RaySpec{cam_test, lateral[i] * probe, Constants::RWI_OBJTYPES_CAMERA,
+                                               Constants::RWI_FLAGS_STOP_AT_SOLID, nullptr, 0};
+                    }
+                    std::optional<RayHit> side_hits[4];
+                    (void)ray_world_intersection_batch(std::span<const RaySpec>(side_rays, 4),
+                                                       std::span<std::optional<RayHit>>(side_hits, 4));
+                    float capped = allowed_distance;
+                    for (const std::optional<RayHit> &h : side_hits)
+                    {
+                        if (!h.has_value() || h->m_distance >= probe)
+                        {
+                            continue; // this side is clear within the probe
+                        }
+                        // Wall plane: point P, normal N (toward the camera). Lateral clearance along the
+                        // arm is clear(t) = dot(pivot - P, N) + t * dot(ray_dir, N). Pulling IN clears the
+                        // wall only when the arm runs INTO it (dot(ray_dir, N) < 0); a parallel / diverging
+                        // wall is left alone. Solve for the largest t that keeps the camera `probe` off it.
+                        const Vector3 &P = h->m_point;
+                        const Vector3 &N = h->m_normal;
+                        const float a = q.ray_dir.x * N.x + q.ray_dir.y * N.y + q.ray_dir.z * N.z;
+                        if (a >= -0.05f)
+                        {
+                            continue; // parallel / diverging side wall: pulling in cannot clear it
+                        }
+                        const float b = (q.pivot.x - P.x) * N.x + (q.pivot.y - P.y) * N.y + (q.pivot.z - P.z) * N.z;
+                        const float t = (probe - b) / a;
+                        if (t < capped)
+                        {
+                            capped = t;
+                        }
+                    }
+                    if (capped >= allowed_distance - 1e-3f)
+                    {
+                        break; // every side clear -> done
+                    }
+                    allowed_distance = std::max(lateral_floor, capped);
+                    q.blocked = true;
+                    s_telemetry.flags |= Telemetry::k_flag_lateral;
+                    cam.collision_hold_timer = k_collision_hold_seconds; // latch like a normal blocking hit
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief The camera-collision stage of offset_game_view_camera: pulls @p camera_position in along the
+     *        pivot -> camera arm so the view stays out of world geometry.
+     * @details Cast from the pivot (a safe point inside the player) to the computed camera position; on a hit, pull
+     *          the camera in to just short of the surface. RWI_OBJTYPES_CAMERA excludes living entities so the ray
+     *          ignores the player and NPCs and only solid world geometry blocks the view. The camera pulls in
+     *          instantly (so it never ends up behind a wall) and eases back out once the obstruction clears. The
+     *          follow distance is carried in collision_distance. Render thread only.
+     */
+    static void solve_camera_collision(CameraState &cam, const RenderSettings &cfg, uintptr_t c_player,
+                                       const Vector3 &pivot, Vector3 &camera_position, float delta_time)
+    {
+        // Quiescent point for a CoverageCacheSize change: no coverage record is held across frames.
+        CoverageCache::sync_capacity();
+        const Vector3 to_camera = camera_position - pivot;
+        const float desired_distance = to_camera.magnitude();
+        if (desired_distance > 1e-3f)
+        {
+            const Vector3 ray_dir = to_camera / desired_distance;
+            // Probe density for this frame. Tracked every frame (the throttle's reuse frames included) so the arm's
+            // angular speed is measured frame to frame.
+            const CollisionLod lod = select_collision_lod(ray_dir, desired_distance, delta_time,
+                                                          cfg.use_collision_lod);
+
+            // Static-world throttle: camera collision only ever queries STATIC / terrain geometry (movable
+            // rigids, the player and NPCs are all excluded), which cannot move while the camera holds still and
+            // changes only SLOWLY as the camera moves. So the full result (walk, sphere, render occlusion,
+            // lateral probe) is recomputed only once the pivot or the desired camera position has moved more
+            // than k_collision_recompute_dist; in between it is reused and only the easing runs -- which
+            // collapses the cost to ~zero while standing AND skips most frames while walking (the dominant cost
+            // in dense scenes such as a doorway). The threshold is a MOVEMENT distance, so fast motion still
+            // recomputes every frame (responsive) while slow motion reuses for a few frames; the reused target
+            // is at most one threshold of camera travel stale, which the easing and the collision standoff
+            // (CollisionRadius) absorb, so the camera never visibly clips.
+            //
+            // The cache is also keyed on every INPUT of the result besides the arm -- the tube radius, the
+            // coverage threshold, the probe toggles and the collision LOD -- so an overlay / INI / preset edit
+            // recomputes at once instead of waiting for the camera to move, and an orbit that comes to rest
+            // re-runs once at full density. And "static" entities are not frozen: a door or gate is an
+            // ent_static the game re-poses, so on a reused frame a single centre ray (the cheapest probe that
+            // can see it) is cast along the arm and compared with the one taken at recompute time; a change
+            // beyond k_collision_centre_tol (something moved into or out of the tube) forces a recompute. An
+            // idle frame therefore costs one ray instead of the full fan / walk / sphere / occlusion set.
+            constexpr float k_collision_recompute_dist = 0.06f;
+            constexpr float k_collision_centre_tol = 0.05f;
+            const float recompute_d2 = k_collision_recompute_dist * k_collision_recompute_dist;
+            const Vector3 throttle_cam = camera_position; // desired (pre-collision); the block overwrites it
+            const float key_radius = cfg.collision_radius;
+            const float key_cov_thresh = cfg.use_coverage_collision
+                                             ? cfg.collision_coverage_threshold
+                                             : 0.0f;
+            const unsigned key_probes =
+                (cfg.use_sphere_collision ? 1u : 0u) |
+                (cfg.use_render_occlusion ? 2u : 0u) |
+                (cfg.camera_probe_size > 0.0f ? 4u : 0u) |
+                (static_cast<unsigned>(lod) << 3);
+            static bool s_collision_throttle_valid = false;
+            static Vector3 s_throttle_pivot{};
+            static Vector3 s_throttle_cam{};
+            static float s_throttle_radius = 0.0f;
+            static float s_throttle_cov_thresh = 0.0f;
+            static unsigned s_throttle_probes = 0;
+            static float s_throttle_centre = -1.0f; // centre-ray distance at recompute time; -1 = clear arm
+            static float s_cached_allowed = 0.0f;
+            const auto centre_ray_distance = [&]() -> float
+            {
+                const std::optional<RayHit> c = ray_world_intersection(
+                    pivot, to_camera, Constants::RWI_OBJTYPES_CAMERA, Constants::RWI_FLAGS_STOP_AT_SOLID);
+                return c.has_value() ? c->m_distance : -1.0f;
+            };
+            bool recompute = !s_collision_throttle_valid ||
+                             (pivot - s_throttle_pivot).magnitude_squared() > recompute_d2 ||
+                             (throttle_cam - s_throttle_cam).magnitude_squared() > recompute_d2 ||
+                             key_radius != s_throttle_radius || key_cov_thresh != s_throttle_cov_thresh ||
+                             key_probes != s_throttle_probes;
+            if (!recompute && cam.collision_valid)
+            {
+                const float centre = centre_ray_distance();
+                recompute = (centre < 0.0f) != (s_throttle_centre < 0.0f) ||
+                            std::fabs(centre - s_throttle_centre) > k_collision_centre_tol;
+            }
+            if (!recompute && cam.collision_valid)
+            {
+                // Reuse last frame's allowed distance (the shared easing), then skip the whole walk / sphere /
+                // render-occlusion / lateral-probe computation below.
+                ease_collision_toward(cam, s_cached_allowed);
+                camera_position = pivot + ray_dir * cam.collision_distance;
+                s_telemetry.allowed_distance = s_cached_allowed;
+                s_telemetry.lod = static_cast<std::uint8_t>(lod);
+                return;
+            }
+            const auto remember_result = [&](float allowed, float centre)
+            {
+                // Cache the freshly computed target so a held-still camera reuses it next frame (throttle above).
+                s_collision_throttle_valid = true;
+                s_throttle_pivot = pivot;
+                s_throttle_cam = throttle_cam;
+                s_throttle_radius = key_radius;
+                s_throttle_cov_thresh = key_cov_thresh;
+                s_throttle_probes = key_probes;
+                s_throttle_centre = centre;
+                s_cached_allowed = allowed;
+            };
+
+            // Frame-budget governor ([Collision] CollisionBudgetUs, see collision_governor.hpp): times this
+            // recompute and picks how much of it to run. Full unless a budget is set and the stage overran it.
+            const int budget_us = cfg.collision_budget_us;
+            std::int64_t governor_start = 0;
+            const CollisionGovernor::Tier tier = CollisionGovernor::begin(budget_us, governor_start);
+            s_telemetry.flags |= Telemetry::k_flag_recomputed;
+            s_telemetry.tier = static_cast<std::uint8_t>(tier);
+            s_telemetry.lod = static_cast<std::uint8_t>(lod);
+            if (tier == CollisionGovernor::Tier::CentreRay)
+            {
+                // Lowest tier: the centre ray alone (skin-adjusted), no walk / sphere / render occlusion / probe.
+                const float centre = centre_ray_distance();
+                float allowed_distance = desired_distance;
+                if (centre >= 0.0f && centre < desired_distance)
+                {
+                    allowed_distance =
+                        std::max(0.0f, centre - cfg.collision_skin);
+                }
+                ease_collision_toward(cam, allowed_distance);
+                camera_position = pivot + ray_dir * cam.collision_distance;
+                s_telemetry.fan_distance = centre;
+                s_telemetry.allowed_distance = allowed_distance;
+                if (allowed_distance < desired_distance)
+                {
+                    s_telemetry.flags |= Telemetry::k_flag_blocked;
+                }
+                remember_result(allowed_distance, centre);
+                CollisionGovernor::end(budget_us, governor_start);
+                return;
+            }
+
+            CollisionQuery q{};
+            q.pivot = pivot;
+            q.to_camera = to_camera;
+            q.ray_dir = ray_dir;
+            q.desired_distance = desired_distance;
+            q.radius = cfg.collision_radius;
+            // UseCoverageCollision is the master switch for the coverage-based heuristics (the coverage gate
+            // and the lateral probe). When OFF the camera collides plainly on the nearest solid: the coverage
+            // threshold is forced to 0 (no walk) and the lateral probe is skipped. Render occlusion is
+            // INDEPENDENT (its own UseRenderOcclusion toggle).
+            q.use_coverage = cfg.use_coverage_collision;
+            q.cov_thresh = q.use_coverage ? cfg.collision_coverage_threshold : 0.0f;
+            // PipelinedCollision covers the gate-off solve (a miss falls through to the synchronous stages without
+            // queuing a second fan); with the gate on it pipelines the walk's first fan, as AsyncCollision does.
+            const bool pipelined = cfg.pipelined_collision && q.cov_thresh <= 0.0f;
+            q.async_collision = !pipelined && (cfg.async_collision || cfg.pipelined_collision);
+            q.lod = lod;
+            q.tier = tier;
+
+            if (!pipelined || !collision_pipelined(q, cfg))
+            {
+                collision_walk(q, cfg, c_player);
+                collision_sphere(q, cfg);
+            }
+            collision_blocking(q, cfg);
+            collision_trace_hit(q, camera_position);
+            collision_render_clamp(q, cfg);
+
+            float allowed_distance;
+            if (q.blocked && q.blocking_distance < desired_distance)
+            {
+                allowed_distance = q.blocking_distance;
+                cam.collision_hold_timer = k_collision_hold_seconds; // latch on a blocking hit
+            }
+            else if (cam.collision_valid && cam.collision_hold_timer > 0.0f)
+            {
+                // Recently blocked but clear this frame: HOLD the pulled-in distance through the
+                // gap so an edge-grazing hit/miss alternation cannot pump the camera (sawtooth).
+                cam.collision_hold_timer -= delta_time;
+                allowed_distance = cam.collision_distance;
+            }
+            else
+            {
+                allowed_distance = desired_distance; // truly clear: ease back out
+            }
+
+            collision_lateral(q, cfg, cam, allowed_distance);
+
+            // Ease toward the allowed distance (fast pull-IN so a wall is never clipped, slower return-OUT),
+            // via the shared helper the throttle bypass also uses.
+            ease_collision_toward(cam, allowed_distance);
+
+            camera_position = pivot + ray_dir * cam.collision_distance;
+            s_telemetry.allowed_distance = allowed_distance;
+            if (q.blocked)
+            {
+                s_telemetry.flags |= Telemetry::k_flag_blocked;
+            }
+
+            remember_result(allowed_distance, centre_ray_distance());
+            CollisionGovernor::end(budget_us, governor_start);
+        }
+    }
+
+    // CollisionSehRegion: after a fault in the region, the fine-grained guards run alone for this many game-view
+    // frames before the region is tried again, so a scene that keeps faulting keeps its collision.
+    constexpr uint32_t k_seh_region_cooldown_frames = 300;
+
+    /**
+     * @brief Runs solve_camera_collision, in SEH region mode when [Advanced] CollisionSehRegion is set.
+     * @details In region mode the collision helpers that hold no lock and no unwinding object run their body under
+     *          one SEH frame each (seh_region.hpp) instead of guarding every read and engine call; the sweep's
+     *          lock-taking engine call keeps its own guard. A fault in a body returns that helper's failure value
+     *          (no hit, unknown footprint), exactly as its per-call guards would, so the frame completes with its
+     *          destructors and CollisionGovernor bookkeeping intact. Any fault suspends region mode for
+     *          k_seh_region_cooldown_frames so the fine-grained guards take over. With the option off, or while
+     *          suspended, the stage runs with its per-call guards as before.
      */
-    static void apply_orbit_body_turn_impl(float target_yaw)
+    static void solve_camera_collision_region(CameraState &cam, const RenderSettings &cfg, uintptr_t c_player,
+                                              const Vector3 &pivot, Vector3 &camera_position, float delta_time)
     {
-        const ModuleInfo &mod = module_info();
-        const uintptr_t c_player = resolve_c_player();
-        if (mod.base == 0 || c_player == 0)
-        {
-            return;
-        }
-
-        // C_Player -> C_AnimatedHuman (+0x268) -> CAnimatedCharacter (+0x20). Validate the animchar vtable
-        // before touching its override fields; a mismatch means the layout drifted, so skip this frame.
-        const RuntimeOffsets &offsets = runtime_offsets();
-        const auto animated_human = DMK::Memory::seh_read<uintptr_t>(
-            c_player + offsets.c_player_animated_human.load(std::memory_order_relaxed));
-        if (!animated_human || !DMK::Memory::plausible_userspace_ptr(*animated_human))
-        {
-            return;
-        }
-        const auto anim_char = DMK::Memory::seh_read<uintptr_t>(
-            *animated_human + offsets.animated_human_animchar.load(std::memory_order_relaxed));
-        if (!anim_char || !DMK::Memory::plausible_userspace_ptr(*anim_char))
+        static uint32_t s_region_cooldown = 0;
+        static uint32_t s_region_faults = 0;
+        const bool region = cfg.collision_seh_region && s_region_cooldown == 0;
+        s_region_cooldown -= (s_region_cooldown > 0) ? 1u : 0u;
+        uint32_t faults = 0;
         {
-            return;
+            const SehRegion::Mode mode(region);
+            solve_camera_collision(cam, cfg, c_player, pivot, camera_position, delta_time);
+            faults = SehRegion::take_faults();
         }
-        const auto avt = DMK::Memory::seh_read<uintptr_t>(*anim_char);
-        if (!avt || !DMK::Rtti::vtable_is_type(*avt, Constants::ANIMATED_CHARACTER_RTTI_NAME))
+        if (faults == 0)
         {
             return;
         }
 
-        // Yaw-only world quat (XYZW): rotation about +Z by target_yaw == {0, 0, sin(y/2), cos(y/2)}.
-        const float half = target_yaw * 0.5f;
-        const uintptr_t quat_addr = *anim_char + Constants::ANIMCHAR_OVERRIDE_ROT_QUAT_OFFSET;
-        *reinterpret_cast<float *>(quat_addr + Constants::QUAT_X_OFFSET) = 0.0f;
-        *reinterpret_cast<float *>(quat_addr + Constants::QUAT_Y_OFFSET) = 0.0f;
-        *reinterpret_cast<float *>(quat_addr + Constants::QUAT_Z_OFFSET) = std::sin(half);
-        *reinterpret_cast<float *>(quat_addr + Constants::QUAT_W_OFFSET) = std::cos(half);
-        // Set the active byte LAST so the animated-character update (a separate consumer) never reads
-        // active==1 with a half-written quat. The release fence orders the quat stores before the active
-        // store explicitly rather than relying on the target's store-store ordering; on x86 it lowers to a
-        // compiler barrier with no runtime cost.
-        std::atomic_thread_fence(std::memory_order_release);
-        *reinterpret_cast<volatile unsigned char *>(*anim_char + Constants::ANIMCHAR_OVERRIDE_ROT_ACTIVE_OFFSET) = 1;
+        s_telemetry.flags |= Telemetry::k_flag_seh_fault;
+        Health::note(Health::Site::RegionFault);
+        s_region_cooldown = k_seh_region_cooldown_frames;
+        s_region_faults += faults;
+        DMK::Logger::get_instance().debug("CollisionSehRegion: {} fault(s) in the collision stage (#{}); per-call "
+                                          "guards for the next {} frames",
+                                          faults, s_region_faults, k_seh_region_cooldown_frames);
     }
 
     /**
-     * @brief SEH wrapper for the body-turn: a stale animated-character pointer or layout drift must
-     *        never crash the game. On a fault the body is simply left unchanged for the frame.
+     * @brief The orbit rig rotation: yaw about world up, then pitch about the yawed offset's horizontal right axis.
+     * @details Shared by the static follow angle and the free-look orbit, which both swing the camera's offset from
+     *          the pivot and the look direction rigidly around the pivot. The pitch axis (sin az, -cos az, 0), az the
+     *          azimuth of the YAWED offset (atan2 of the offset plus the yaw), is the one about which a positive
+     *          pitch raises the camera. Composed into one quaternion so both vectors rotate in one pass.
+     * @param offset Camera position minus pivot, before the rotation.
+     * @param yaw Yaw in radians (right-handed about +Z).
+     * @param pitch Pitch in radians; |pitch| <= 1e-5 is treated as none.
      */
-    static void apply_orbit_body_turn(float target_yaw)
+    static Simd::Quat orbit_rig_rotation(const Vector3 &offset, float yaw, float pitch)
     {
-        __try
-        {
-            apply_orbit_body_turn_impl(target_yaw);
-        }
-        __except (EXCEPTION_EXECUTE_HANDLER)
+        Simd::Quat q = Simd::Quat::yaw_z(yaw);
+        if (pitch < -1e-5f || pitch > 1e-5f)
         {
+            const float azimuth = std::atan2(offset.y, offset.x) + yaw;
+            q = q.then(Simd::Quat::axis_angle(Vector3{std::sin(azimuth), -std::cos(azimuth), 0.0f}, pitch));
         }
+        return q;
+    }
+
+    // Fills s_alphas for this frame: one exp() per distinct ease rate, in one place, before any ease reads it.
+    static void compute_frame_alphas(const RenderSettings &cfg, float delta_time) noexcept
+    {
+        constexpr float k_collision_pull_in_speed = 25.0f; // near-instant but still smooth
+        constexpr float k_eye_sync_speed = 9.0f;           // eye-height sync, 1/sec
+        constexpr float k_orbit_level_speed = 8.0f;        // orbit level-reference blend, 1/sec
+        const auto alpha = [delta_time](float rate)
+        { return (rate > 0.0f) ? 1.0f - std::exp(-rate * delta_time) : 1.0f; };
+
+        const float basis_smoothing = std::clamp(cfg.aim_basis_smoothing, 0.0f, 1.0f);
+        const float orbit_smoothing = std::clamp(cfg.orbit_smoothing, 0.0f, 1.0f);
+        s_alphas.collision_pull_in = alpha(k_collision_pull_in_speed);
+        s_alphas.collision_return = alpha(cfg.collision_return_speed);
+        s_alphas.basis_smooth =
+            alpha(k_basis_smooth_max_speed - basis_smoothing * (k_basis_smooth_max_speed - k_basis_smooth_min_speed));
+        s_alphas.fov = alpha(cfg.preset_blend_speed * 1.6f);
+        s_alphas.eye_sync = alpha(k_eye_sync_speed);
+        s_alphas.orbit_smooth =
+            alpha(k_orbit_smooth_max_speed - orbit_smoothing * (k_orbit_smooth_max_speed - k_orbit_smooth_min_speed));
+        s_alphas.orbit_return = alpha(cfg.orbit_return_speed);
+        s_alphas.orbit_level = alpha(k_orbit_level_speed);
+        s_alphas.orbit_aim_level = alpha(k_orbit_aim_level_speed);
     }
 
     /**
@@ -818,15 +2136,16 @@ namespace TPVCamera
     static void offset_game_view_camera(uintptr_t camera, uintptr_t cview, uintptr_t c_player, float delta_time,
                                         float view_blend)
     {
-        LiveSettings &cfg = settings();
+        const RenderSettings &cfg = render_settings();
         CameraState &cam = camera_state();
+        compute_frame_alphas(cfg, delta_time);
 
         // Follow distance = configured base (hot-reloadable INI FollowDistance, re-read every
         // frame so an edit applies live) plus the accumulated zoom offset from the hold
         // keys (queried lock-free, render thread safe), clamped to the configured window.
         const DMK::InputManager &input = DMK::InputManager::get_instance();
         float zoom_offset = cam.zoom_offset.load(std::memory_order_relaxed);
-        const float zoom_step = cfg.zoom_step.load(std::memory_order_relaxed);
+        const float zoom_step = cfg.zoom_step;
         if (input.is_binding_active(k_zoom_in_binding))
         {
             zoom_offset -= zoom_step * delta_time; // zoom in pulls the camera closer
@@ -835,10 +2154,9 @@ namespace TPVCamera
         {
             zoom_offset += zoom_step * delta_time;
         }
-        const float base_distance = cfg.follow_distance.load(std::memory_order_relaxed);
+        const float base_distance = cfg.follow_distance;
         const float distance =
-            std::clamp(base_distance + zoom_offset, cfg.follow_distance_min.load(std::memory_order_relaxed),
-                       cfg.follow_distance_max.load(std::memory_order_relaxed));
+            std::clamp(base_distance + zoom_offset, cfg.follow_distance_min, cfg.follow_distance_max);
         cam.zoom_offset.store(distance - base_distance, std::memory_order_relaxed);
 
         // Read the eye anchor and the orientation quat from the untouched CView pose. The basis is
@@ -863,8 +2181,10 @@ namespace TPVCamera
         const Quaternion eye_rotation = *eye_rotation_read;
         // FPV-side basis (the engine eye orientation). Kept as the view-blend SOURCE so view_blend 0 leaves
         // the untouched first-person view; the third-person rig basis below is built from a STABLE source.
-        const Vector3 eye_forward = eye_rotation.rotate(Vector3{0.0f, 1.0f, 0.0f});
-        const Vector3 eye_up = eye_rotation.rotate(Vector3{0.0f, 0.0f, 1.0f});
+        Vector3 eye_right;
+        Vector3 eye_forward;
+        Vector3 eye_up;
+        Simd::Quat::from(eye_rotation).basis(eye_right, eye_forward, eye_up);
 
         // Stable rig basis. The third-person rig (camera = pivot - forward * distance) amplifies any rotation of
         // the basis into a position swing; the EyeHeight body anchor removed the POSITIONAL bob, this removes the
@@ -878,7 +2198,7 @@ namespace TPVCamera
         bool basis_overridden = false;
         Quaternion look_rotation = eye_rotation;
         bool look_valid = false;
-        if (cfg.stable_aim_basis.load(std::memory_order_relaxed) && c_player != 0)
+        if (cfg.stable_aim_basis && c_player != 0)
         {
             // Read the look controller through the self-healed offset (seeded from the constant, recovered if
             // the C_Player layout drifts) so the basis tracks the same controller the orbit aim control writes.
@@ -906,7 +2226,7 @@ namespace TPVCamera
         // the raw eye quat. Snaps on the first engaged frame (basis_quat_valid false) so the camera does not
         // swing in from a stale orientation across a first-person gap. AimBasisSmoothing 0 disables the filter
         // (the target is used directly).
-        const float basis_smoothing = std::clamp(cfg.aim_basis_smoothing.load(std::memory_order_relaxed), 0.0f, 1.0f);
+        const float basis_smoothing = std::clamp(cfg.aim_basis_smoothing, 0.0f, 1.0f);
         if (look_valid || basis_smoothing > 1e-4f)
         {
             basis_overridden = true;
@@ -921,9 +2241,7 @@ namespace TPVCamera
             {
                 const DirectX::XMVECTOR current =
                     DirectX::XMVectorSet(cam.basis_quat_x, cam.basis_quat_y, cam.basis_quat_z, cam.basis_quat_w);
-                const float speed =
-                    k_basis_smooth_max_speed - basis_smoothing * (k_basis_smooth_max_speed - k_basis_smooth_min_speed);
-                const float t = 1.0f - std::exp(-speed * delta_time);
+                const float t = s_alphas.basis_smooth;
                 // XMQuaternionSlerp takes the shortest arc, so a quaternion double-cover sign flip never spins the
                 // basis the long way.
                 result = DirectX::XMQuaternionNormalize(DirectX::XMQuaternionSlerp(current, target, t));
@@ -943,9 +2261,10 @@ namespace TPVCamera
             cam.basis_quat_valid = false; // basis not shaped: the next engage snaps the low-pass
         }
 
-        const Vector3 right = basis_rotation.rotate(Vector3{1.0f, 0.0f, 0.0f});
-        const Vector3 forward = basis_rotation.rotate(Vector3{0.0f, 1.0f, 0.0f});
-        const Vector3 up = basis_rotation.rotate(Vector3{0.0f, 0.0f, 1.0f});
+        Vector3 right;
+        Vector3 forward;
+        Vector3 up;
+        Simd::Quat::from(basis_rotation).basis(right, forward, up);
         GameStructures::Matrix34f *matrix = reinterpret_cast<GameStructures::Matrix34f *>(camera);
         // Per-preset FOV, smoothly crossing the "off" boundary. SetFrustum (sub_1805392FC) writes the render
         // CCamera's FOV scalar at camera+0x30 right before this builder, plus the cull-frustum edge vectors at
@@ -960,10 +2279,9 @@ namespace TPVCamera
             camera + Constants::CCAMERA_PROJECTION_FOV_OFFSET); // radians, freshly set by SetFrustum
         if (view_blend > 0.0f && game_fov > 0.05f && game_fov < 3.0f)
         {
-            const float fov_target_degrees = cfg.fov.load(std::memory_order_relaxed);
+            const float fov_target_degrees = cfg.fov;
             const float desired_fov =
                 (fov_target_degrees > 0.0f) ? DMK::Math::degrees_to_radians(fov_target_degrees) : game_fov;
-            const float speed = cfg.preset_blend_speed.load(std::memory_order_relaxed);
             if (!cam.fov_ease_valid) // first engaged frame after a first-person gap: snap, no ease across the gap
             {
                 cam.fov_ease_stage1 = desired_fov;
@@ -972,7 +2290,7 @@ namespace TPVCamera
             }
             else
             {
-                const float alpha = (speed > 0.0f) ? (1.0f - std::exp(-speed * 1.6f * delta_time)) : 1.0f;
+                const float alpha = s_alphas.fov;
                 cam.fov_ease_stage1 +=
                     (desired_fov - cam.fov_ease_stage1) * alpha; // 2-stage critically-damped, like the preset blend
                 cam.fov_ease_applied += (cam.fov_ease_stage1 - cam.fov_ease_applied) * alpha;
@@ -1005,7 +2323,7 @@ namespace TPVCamera
         // Over-the-shoulder lateral offset along the eye-right axis, applied to the non-orbit follow
         // pose. During free-look it is folded into the orbit start offset (below) so it revolves with
         // the ring, which keeps engaging free-look continuous.
-        const Vector3 lateral_offset = right * cfg.offset_right.load(std::memory_order_relaxed);
+        const Vector3 lateral_offset = right * cfg.offset_right;
 
         // Anchor the rig to a STABLE point. The first-person eye (eye_position, read from CView+0x14)
         // carries head-bob, breathing and weapon-sway, so anchoring the third-person camera to it
@@ -1016,7 +2334,7 @@ namespace TPVCamera
         // a missing player or a layout drift degrades to the previous behaviour rather than misplacing
         // the camera.
         const Vector3 world_up{0.0f, 0.0f, 1.0f};
-        const float eye_height = cfg.eye_height.load(std::memory_order_relaxed);
+        const float eye_height = cfg.eye_height;
         // Read the player body world origin once. It feeds the stable anchor (below) AND the
         // device-agnostic movement speed used by the camera-relative move alignment; body_valid gates both.
         Vector3 body_origin{0.0f, 0.0f, 0.0f};
@@ -1058,7 +2376,7 @@ namespace TPVCamera
         {
             float effective_eye_height = eye_height;
             bool sync_engaged = false; // true while actively re-anchoring (vs. just using the configured height)
-            if (cfg.dynamic_eye_sync.load(std::memory_order_relaxed))
+            if (cfg.dynamic_eye_sync)
             {
                 // Re-anchor the eye HEIGHT to the real FP eye when a low pose (kneel / pray, and other poses
                 // EyeHeight does not model) drops it OUT OF RANGE of the configured height -- where a fixed
@@ -1066,7 +2384,6 @@ namespace TPVCamera
                 // the steady bob-free height; in the re-anchored low poses we accept the bob (they are mostly
                 // stationary). Ease so the swap slides; eye_sync_valid resets on suppression so re-engaging snaps.
                 constexpr float k_oor_threshold = 0.25f; // meters: a genuine pose drop, not head bob
-                constexpr float k_sync_rate = 9.0f;      // ease rate, 1/sec (frame-rate independent below)
                 const float real_eye_height = eye_position.z - body_origin.z;
                 sync_engaged = std::fabs(real_eye_height - eye_height) > k_oor_threshold;
                 const float target_eye_height = sync_engaged ? real_eye_height : eye_height;
@@ -1077,7 +2394,7 @@ namespace TPVCamera
                 }
                 else
                 {
-                    const float k = 1.0f - std::exp(-k_sync_rate * delta_time);
+                    const float k = s_alphas.eye_sync;
                     cam.eye_sync_applied += (target_eye_height - cam.eye_sync_applied) * k;
                 }
                 effective_eye_height = cam.eye_sync_applied;
@@ -1095,12 +2412,26 @@ namespace TPVCamera
         {
             cam.eye_sync_engaged.store(false, std::memory_order_relaxed);
         }
-        const Vector3 pivot = anchor_base + world_up * cfg.offset_up.load(std::memory_order_relaxed);
+        const Vector3 pivot = anchor_base + world_up * cfg.offset_up;
 
         // Free-look orbit angles (degrees), accumulated by the input hook while the key is
         // held. On release they ease back to center. Read here so the render reflects them.
         const bool orbit_held = cam.orbit_active.load(std::memory_order_relaxed);
 
+        // Drain the mouse deltas the input hook posted since the last frame (always, so nothing posted before a
+        // toggle-off or a UI freeze survives into the next engage) and fold them into the orbit angles.
+        const std::int64_t mouse_yaw_fx = cam.orbit_mouse_yaw_fx.exchange(0, std::memory_order_relaxed);
+        const std::int64_t mouse_pitch_fx = cam.orbit_mouse_pitch_fx.exchange(0, std::memory_order_relaxed);
+        if (orbit_held && (mouse_yaw_fx != 0 || mouse_pitch_fx != 0))
+        {
+            cam.orbit_yaw.store(cam.orbit_yaw.load(std::memory_order_relaxed) + orbit_delta_from_fixed(mouse_yaw_fx),
+                                std::memory_order_relaxed);
+            const float pitch =
+                cam.orbit_pitch.load(std::memory_order_relaxed) + orbit_delta_from_fixed(mouse_pitch_fx);
+            cam.orbit_pitch.store(std::clamp(pitch, cfg.orbit_pitch_min, cfg.orbit_pitch_max),
+                                  std::memory_order_relaxed);
+        }
+
         // Gamepad right-stick orbit: integrate the latched stick DEFLECTION by RATE into the SAME orbit
         // accumulator the mouse writes, so the stick orbits the camera (yaw) and raises/lowers it (pitch) like
         // the mouse. Done here (not in the input hook) because the stick reports a HELD position, so it needs
@@ -1113,19 +2444,18 @@ namespace TPVCamera
         // Gated on the cursor-shown freeze (a UI up holds
         // still, mirroring the mouse path); when not orbiting or frozen the latch is cleared so re-engaging with
         // the stick centred does not jump.
-        if (orbit_held && !s_cursor_shown.load(std::memory_order_relaxed))
+        if (orbit_held && !detour_hot_block().cursor_shown.load(std::memory_order_relaxed))
         {
             const float pad_yaw = cam.orbit_pad_yaw.load(std::memory_order_relaxed);
             const float pad_pitch = cam.orbit_pad_pitch.load(std::memory_order_relaxed);
             if (pad_yaw != 0.0f || pad_pitch != 0.0f)
             {
-                const float step_x = cfg.gamepad_orbit_speed_x.load(std::memory_order_relaxed) * delta_time;
-                const float step_y = cfg.gamepad_orbit_speed_y.load(std::memory_order_relaxed) * delta_time;
+                const float step_x = cfg.gamepad_orbit_speed_x * delta_time;
+                const float step_y = cfg.gamepad_orbit_speed_y * delta_time;
                 cam.orbit_yaw.store(cam.orbit_yaw.load(std::memory_order_relaxed) - pad_yaw * step_x,
                                     std::memory_order_relaxed);
                 const float pitch = cam.orbit_pitch.load(std::memory_order_relaxed) - pad_pitch * step_y;
-                cam.orbit_pitch.store(std::clamp(pitch, cfg.orbit_pitch_min.load(std::memory_order_relaxed),
-                                                 cfg.orbit_pitch_max.load(std::memory_order_relaxed)),
+                cam.orbit_pitch.store(std::clamp(pitch, cfg.orbit_pitch_min, cfg.orbit_pitch_max),
                                       std::memory_order_relaxed);
             }
         }
@@ -1139,10 +2469,8 @@ namespace TPVCamera
         // so this is invisible while orbiting, but on release it lets the camera ease back to centre
         // along the SHORTEST path (<= 180 deg) in one smooth pass instead of un-spinning every full
         // revolution the player made. The re-based value is only stored back on release (below), so the wrap
-        // here stays render-thread-local while held. The raw accumulator itself is written by the mouse path
-        // on the input thread and by the gamepad integration above on the render thread; only one input device
-        // drives orbit at a time in practice, so the relaxed load here does not race a meaningful write (and a
-        // dropped sub-degree delta in the unlikely simultaneous case is harmless, never torn).
+        // here stays render-thread-local while held. The raw accumulator is advanced only on this thread (the
+        // mouse drain and the gamepad integration above), so no input-thread delta can be lost between them.
         float orbit_yaw_deg = std::remainder(cam.orbit_yaw.load(std::memory_order_relaxed), 360.0f);
         float orbit_pitch_deg = cam.orbit_pitch.load(std::memory_order_relaxed);
 
@@ -1170,9 +2498,8 @@ namespace TPVCamera
             // the SAME smoothed value is reused for body_target_yaw below so the camera stays behind the body.
             // Hold mode keeps the raw value (its orbit-around rides the snapped rig offset, left instant) --
             // only continuous-align steering is smoothed.
-            const float orbit_smoothing = std::clamp(cfg.orbit_smoothing.load(std::memory_order_relaxed), 0.0f, 1.0f);
-            const bool steer_smooth =
-                cfg.orbit_continuous_align.load(std::memory_order_relaxed) && orbit_smoothing > 1e-4f;
+            const float orbit_smoothing = std::clamp(cfg.orbit_smoothing, 0.0f, 1.0f);
+            const bool steer_smooth = cfg.orbit_continuous_align && orbit_smoothing > 1e-4f;
             if (!steer_smooth || !cam.orbit_steer_valid)
             {
                 cam.orbit_steer_smooth = raw_user_since_deg; // snap: smoothing off / hold mode, or first move frame
@@ -1180,9 +2507,7 @@ namespace TPVCamera
             }
             else
             {
-                const float speed =
-                    k_orbit_smooth_max_speed - orbit_smoothing * (k_orbit_smooth_max_speed - k_orbit_smooth_min_speed);
-                const float ease = 1.0f - std::exp(-speed * delta_time);
+                const float ease = s_alphas.orbit_smooth;
                 cam.orbit_steer_smooth += std::remainder(raw_user_since_deg - cam.orbit_steer_smooth, 360.0f) * ease;
             }
             const float user_orbit_since_deg = steer_smooth ? cam.orbit_steer_smooth : raw_user_since_deg;
@@ -1200,13 +2525,12 @@ namespace TPVCamera
             // (world-stable) angle derived above, not the raw input accumulator, so the ease-back below starts
             // from where the camera actually is rather than jumping by the orbit held at capture. The single
             // store at the end of this block persists the re-based (and, with a return speed, eased) angle.
-            const float return_speed = cfg.orbit_return_speed.load(std::memory_order_relaxed);
-            if (return_speed > 0.0f)
+            if (cfg.orbit_return_speed > 0.0f)
             {
                 // Ease back to the centre: directly behind and level (hardcoded 0, 0).
                 const float init_yaw = 0.0f;
                 const float init_pitch = 0.0f;
-                const float ease = 1.0f - std::exp(-return_speed * delta_time);
+                const float ease = s_alphas.orbit_return;
                 orbit_yaw_deg -= std::remainder(orbit_yaw_deg - init_yaw, 360.0f) * ease; // shortest path to centre
                 orbit_pitch_deg -= (orbit_pitch_deg - init_pitch) * ease;
             }
@@ -1228,7 +2552,7 @@ namespace TPVCamera
         // cancellation and swing the camera on the move-start, when it should be instant. The target writes
         // above always use the unsmoothed value, so the accumulator and the return/move logic are unaffected;
         // only the idle (standing free-look) rendered angle is low-passed.
-        const float orbit_smoothing = std::clamp(cfg.orbit_smoothing.load(std::memory_order_relaxed), 0.0f, 1.0f);
+        const float orbit_smoothing = std::clamp(cfg.orbit_smoothing, 0.0f, 1.0f);
         if (orbit_smoothing <= 1e-4f || !cam.orbit_render_valid || move_orbit)
         {
             cam.orbit_yaw_render = orbit_yaw_deg;
@@ -1237,9 +2561,7 @@ namespace TPVCamera
         }
         else
         {
-            const float smooth_speed =
-                k_orbit_smooth_max_speed - orbit_smoothing * (k_orbit_smooth_max_speed - k_orbit_smooth_min_speed);
-            const float smooth_ease = 1.0f - std::exp(-smooth_speed * delta_time);
+            const float smooth_ease = s_alphas.orbit_smooth;
             // Shortest-path ease on yaw so a wrap (e.g. -179 -> +179) eases the short way, not all the way round.
             cam.orbit_yaw_render += std::remainder(orbit_yaw_deg - cam.orbit_yaw_render, 360.0f) * smooth_ease;
             cam.orbit_pitch_render += (orbit_pitch_deg - cam.orbit_pitch_render) * smooth_ease;
@@ -1263,9 +2585,8 @@ namespace TPVCamera
         // on release instead lets any retained orbit angle ride as a rigid offset on top of the real
         // look (the level_blend 0 path follows pitch), so vertical control is preserved in every preset.
         {
-            constexpr float k_orbit_level_speed = 8.0f;
             const float level_target = orbit_held ? 1.0f : 0.0f;
-            const float level_ease = 1.0f - std::exp(-k_orbit_level_speed * delta_time);
+            const float level_ease = s_alphas.orbit_level;
             cam.orbit_level_blend += (level_target - cam.orbit_level_blend) * level_ease;
         }
 
@@ -1301,12 +2622,12 @@ namespace TPVCamera
         // would otherwise converge so steeply that the crosshair misses everything past the near focus
         // (the ~45 deg case at FollowDistance 0.5, OffsetRight 1.0). Raise focus_distance so the toe-in
         // atan(|offset_right| / (focus_distance + distance)) stays within k_tan_max_convergence.
-        float focus_distance = cfg.aim_focus_distance.load(std::memory_order_relaxed);
+        float focus_distance = cfg.aim_focus_distance;
         if (focus_distance <= 0.0f)
         {
             focus_distance = distance;
         }
-        const float shoulder_abs = std::abs(cfg.offset_right.load(std::memory_order_relaxed));
+        const float shoulder_abs = std::abs(cfg.offset_right);
         if (shoulder_abs > 1e-4f)
         {
             const float min_reach = shoulder_abs / k_tan_max_convergence; // lower bound on focus_distance + distance
@@ -1338,37 +2659,18 @@ namespace TPVCamera
         // free-look orbit below), so the over-the-shoulder framing and crosshair hold while the camera
         // circles you. The free-look orbit then rotates further on top of this resting angle.
         {
-            const float follow_yaw = cfg.follow_yaw.load(std::memory_order_relaxed);
-            const float follow_pitch = cfg.follow_pitch.load(std::memory_order_relaxed);
+            const float follow_yaw = cfg.follow_yaw;
+            const float follow_pitch = cfg.follow_pitch;
             if (follow_yaw < -0.05f || follow_yaw > 0.05f || follow_pitch < -0.05f || follow_pitch > 0.05f)
             {
-                Vector3 off = camera_position - pivot;
-                const float yaw = DMK::Math::degrees_to_radians(follow_yaw);
-                const float cy = std::cos(yaw);
-                const float sy = std::sin(yaw);
-                auto yaw_about_z = [cy, sy](const Vector3 &v)
-                { return Vector3{v.x * cy - v.y * sy, v.x * sy + v.y * cy, v.z}; };
-                off = yaw_about_z(off);
-                look_forward = yaw_about_z(look_forward);
-
-                const float pitch = DMK::Math::degrees_to_radians(follow_pitch);
-                if (pitch < -1e-5f || pitch > 1e-5f)
-                {
-                    const float azimuth = std::atan2(off.y, off.x);
-                    const Vector3 axis{std::sin(azimuth), -std::cos(azimuth), 0.0f};
-                    const float cp = std::cos(pitch);
-                    const float sp = std::sin(pitch);
-                    auto rotate_about_axis = [&axis, cp, sp](const Vector3 &v)
-                    {
-                        const Vector3 cross = axis.cross(v);
-                        const float dot = axis.x * v.x + axis.y * v.y + axis.z * v.z;
-                        return v * cp + cross * sp + axis * (dot * (1.0f - cp));
-                    };
-                    off = rotate_about_axis(off);
-                    look_forward = rotate_about_axis(look_forward);
-                }
+                // rig[0] = offset from the pivot, rig[1] = look direction: rotated together.
+                Vector3 rig[2] = {camera_position - pivot, look_forward};
+                orbit_rig_rotation(rig[0], DMK::Math::degrees_to_radians(follow_yaw),
+                                   DMK::Math::degrees_to_radians(follow_pitch))
+                    .rotate_many(rig, rig);
+                look_forward = rig[1];
 
-                camera_position = pivot + off;
+                camera_position = pivot + rig[0];
                 if (look_forward.magnitude_squared() > 1e-6f)
                 {
                     look_forward = look_forward.normalized();
@@ -1409,8 +2711,7 @@ namespace TPVCamera
                 level_fwd = world_up.cross(right).normalized(); // straight down/up: recover heading from right
             }
             const Vector3 level_right = level_fwd.cross(world_up).normalized();
-            const Vector3 level_offset =
-                level_fwd * (-distance) + level_right * cfg.offset_right.load(std::memory_order_relaxed);
+            const Vector3 level_offset = level_fwd * (-distance) + level_right * cfg.offset_right;
             Vector3 level_look = have_focus ? (pivot + level_fwd * focus_distance) - (pivot + level_offset)
                                             : level_offset * -1.0f; // no focus: look at the pivot
             level_look = (level_look.magnitude_squared() > 1e-6f) ? level_look.normalized() : level_fwd;
@@ -1433,33 +2734,13 @@ namespace TPVCamera
             const float yaw_delta = DMK::Math::degrees_to_radians(render_yaw_deg);
             const float pitch_delta = elevation - base_elevation;
 
-            // Yaw about world up (Z): applied to both the offset and the look so they swing together.
-            const float cy = std::cos(yaw_delta);
-            const float sy = std::sin(yaw_delta);
-            auto yaw_about_z = [cy, sy](const Vector3 &v)
-            { return Vector3{v.x * cy - v.y * sy, v.x * sy + v.y * cy, v.z}; };
-            Vector3 new_offset = yaw_about_z(offset0);
-            Vector3 new_look = yaw_about_z(base_look);
-
-            // Pitch about the horizontal right axis of the yawed heading (Rodrigues). The axis
-            // (sin az, -cos az, 0) is the one about which a positive pitch_delta raises the camera.
-            if (pitch_delta < -1e-5f || pitch_delta > 1e-5f)
-            {
-                const float azimuth = std::atan2(new_offset.y, new_offset.x);
-                const Vector3 pitch_axis{std::sin(azimuth), -std::cos(azimuth), 0.0f};
-                const float cp = std::cos(pitch_delta);
-                const float sp = std::sin(pitch_delta);
-                auto rotate_about_axis = [&pitch_axis, cp, sp](const Vector3 &v)
-                {
-                    const Vector3 cross = pitch_axis.cross(v);
-                    const float dot = pitch_axis.x * v.x + pitch_axis.y * v.y + pitch_axis.z * v.z;
-                    return v * cp + cross * sp + pitch_axis * (dot * (1.0f - cp));
-                };
-                new_offset = rotate_about_axis(new_offset);
-                new_look = rotate_about_axis(new_look);
-            }
+            // Yaw about world up (Z), then pitch about the horizontal right axis of the yawed heading, applied to
+            // both the offset and the look so they swing together.
+            Vector3 rig[2] = {offset0, base_look};
+            orbit_rig_rotation(offset0, yaw_delta, pitch_delta).rotate_many(rig, rig);
+            const Vector3 new_look = rig[1];
 
-            camera_position = pivot + new_offset;
+            camera_position = pivot + rig[0];
             if (new_look.magnitude_squared() > 1e-6f)
             {
                 look_forward = new_look.normalized();
@@ -1468,10 +2749,10 @@ namespace TPVCamera
         }
 
         // Camera-relative movement (toggle orbit): on the idle -> moving edge CAPTURE the camera heading, then
-        // HOLD it while moving. The body turn (apply_orbit_body_turn) pins the body to that heading, which is
+        // HOLD it while moving. The body turn (apply_orbit_body_turn_impl) pins the body to that heading, which is
         // what makes locomotion camera-relative in EVERY direction (KCD2 moves relative to the body rotation):
         // W runs away from the camera, A/D strafe to the sides, S backs toward it. The look-yaw write
-        // (apply_orbit_aim_control) faces the head/aim the same way and feeds the camera-position derivation.
+        // (apply_orbit_aim_control_impl) faces the head/aim the same way and feeds the camera-position derivation.
         // Both are re-applied every frame because the engine reverts/consumes a single write -- like the pitch
         // leveling. Released when movement stops.
         bool do_align = false;
@@ -1509,20 +2790,17 @@ namespace TPVCamera
                     // points at game-driven movement (finishing-move / combat footwork) being mistaken for intent.
                     // state is the debounced GameState mask (see game_state.hpp) so we can tell whether a combat /
                     // aiming / cinematic state was active when the body-turn engaged.
-                    DMK::Logger::get_instance().trace(
-                        "Orbit: move-orbit START (body-turn engaging) -- move_magnitude={:.2f}, continuous_align={}, "
-                        "state_mask=0x{:X}",
-                        move_magnitude, cfg.orbit_continuous_align.load(std::memory_order_relaxed),
-                        game_state_mask().load(std::memory_order_relaxed));
+                    TraceRing::Writer(TraceRing::Event::OrbitMoveStart)
+                        .f32(move_magnitude)
+                        .boolean(cfg.orbit_continuous_align)
+                        .hex(game_state_mask().load(std::memory_order_relaxed))
+                        .commit();
                 }
                 else if (!s_stale_suppress_logged)
                 {
                     // Unarmed (no release seen since orbit engaged) yet reading as movement: a stranded latch.
                     // Suppress the body-turn re-trip and log it once -- the diagnostic for the post-combat case.
-                    DMK::Logger::get_instance().trace(
-                        "Orbit: suppressed a stale move re-trip (magnitude {:.2f}, no release observed since orbit "
-                        "engaged; likely a movement latch stranded by a combat action-map swap)",
-                        move_magnitude);
+                    TraceRing::Writer(TraceRing::Event::OrbitStaleRetrip).f32(move_magnitude).commit();
                     s_stale_suppress_logged = true;
                 }
             }
@@ -1538,8 +2816,7 @@ namespace TPVCamera
                 // Bake the world-stable orbit angle back into the accumulator so free-look resumes from
                 // exactly where the moving camera was, with no jump the instant movement stops.
                 cam.orbit_yaw.store(orbit_yaw_deg, std::memory_order_relaxed);
-                DMK::Logger::get_instance().trace(
-                    "Orbit: move-orbit STOP (body-turn releasing) -- move_magnitude={:.2f}", move_magnitude);
+                TraceRing::Writer(TraceRing::Event::OrbitMoveStop).f32(move_magnitude).commit();
             }
             cam.orbit_moving = moving;
         }
@@ -1572,8 +2849,8 @@ namespace TPVCamera
             cam.orbit_target_valid = false;
         }
 
-        const float pitch_ease = (orbit_held && cfg.orbit_level_aim.load(std::memory_order_relaxed))
-                                     ? (1.0f - std::exp(-k_orbit_aim_level_speed * delta_time))
+        const float pitch_ease = (orbit_held && cfg.orbit_level_aim)
+                                     ? s_alphas.orbit_aim_level
                                      : 0.0f;
         const bool hold_yaw = orbit_held && cam.orbit_moving && cam.orbit_target_valid;
         // Heading fed to the body + movement while moving. CONTINUOUS-ALIGN (GTA style): follow the CURRENT
@@ -1583,7 +2860,7 @@ namespace TPVCamera
         // the same either way -- only this target differs -- so in continuous mode the derived orbit angle
         // cancels to ~0 (camera behind the character) while in hold mode it carries the orbit-around offset.
         float body_target_yaw = cam.orbit_target_yaw;
-        if (hold_yaw && cfg.orbit_continuous_align.load(std::memory_order_relaxed))
+        if (hold_yaw && cfg.orbit_continuous_align)
         {
             // Reuse the smoothed steer angle computed in the move-orbit derivation above (when OrbitSmoothing
             // is on) so the body/look heading and the rig agree -- the camera follows the smoothed steering
@@ -1600,9 +2877,14 @@ namespace TPVCamera
                     : (cam.orbit_yaw.load(std::memory_order_relaxed) - cam.orbit_yaw_at_capture_deg);
             body_target_yaw = cam.orbit_target_yaw + DMK::Math::degrees_to_radians(user_orbit_since_deg);
         }
+        // The look writes and the body turn below are committed together at the end of this block: one C_Player
+        // resolution and one guarded engine touch per frame.
+        OrbitAimWrites aim_writes{};
+        aim_writes.yaw = body_target_yaw;
         if (orbit_held && (pitch_ease > 0.0f || hold_yaw))
         {
-            apply_orbit_aim_control(pitch_ease, hold_yaw, body_target_yaw);
+            aim_writes.pitch_ease = pitch_ease;
+            aim_writes.set_yaw = hold_yaw;
         }
         // Pin the BODY to the camera heading while moving so the character runs camera-relative in EVERY
         // direction. KCD2 moves the player relative to the ENTITY (body) rotation, NOT the look, so this body
@@ -1613,429 +2895,36 @@ namespace TPVCamera
         // key the wrong way (A/D -> backward, S -> forward). Held every frame while moving (the override is
         // consume-once); released when movement stops.
         static bool s_body_turn_engaged = false;
-        const bool body_turn_active = hold_yaw && cfg.orbit_body_turn.load(std::memory_order_relaxed);
+        const bool body_turn_active = hold_yaw && cfg.orbit_body_turn;
         if (body_turn_active != s_body_turn_engaged)
         {
             s_body_turn_engaged = body_turn_active;
-            if (body_turn_active)
+            TraceRing::Writer(TraceRing::Event::OrbitBodyTurn).boolean(body_turn_active).commit();
+        }
+        aim_writes.body_turn = body_turn_active;
+        if (aim_writes.pitch_ease > 0.0f || aim_writes.set_yaw || aim_writes.body_turn)
+        {
+            apply_orbit_aim_writes(aim_writes);
+        }
+
+        // Camera collision: keep the view out of world geometry (see solve_camera_collision).
+        if (cfg.enable_collision)
+        {
+            const Vector3 desired_arm = camera_position - pivot;
+            begin_collision_telemetry();
+            const std::int64_t heatmap_start = cfg.collision_heatmap ? Profiler::now_ticks() : 0;
+            solve_camera_collision_region(cam, cfg, c_player, pivot, camera_position, delta_time);
+            if (cfg.collision_heatmap)
             {
-                DMK::Logger::get_instance().trace("Camera: orbit body-turn ENGAGED (moving; heading locked to camera)");
+                const float cost_us = Profiler::ticks_to_us(Profiler::now_ticks() - heatmap_start);
+                record_collision_heatmap(pivot, desired_arm, cost_us);
             }
-            else
+            record_collision_telemetry(cam, pivot, desired_arm, delta_time);
+            // Warm the render-node region for where the arm is heading (see prefetch_render_region).
+            if (cfg.use_render_occlusion)
             {
-                DMK::Logger::get_instance().trace("Camera: orbit body-turn released");
-            }
-        }
-        if (body_turn_active)
-        {
-            apply_orbit_body_turn(body_target_yaw);
-        }
-
-        // Camera collision: keep the view out of world geometry. Cast from the pivot (a safe
-        // point inside the player) to the computed camera position; on a hit, pull the camera in
-        // to just short of the surface. RWI_OBJTYPES_CAMERA excludes living entities so the ray
-        // ignores the player and NPCs and only solid world geometry blocks the view. The camera
-        // pulls in instantly (so it never ends up behind a wall) and eases back out once the
-        // obstruction clears. The follow distance is carried in collision_distance.
-        if (cfg.enable_collision.load(std::memory_order_relaxed))
-        {
-            const Vector3 to_camera = camera_position - pivot;
-            const float desired_distance = to_camera.magnitude();
-            if (desired_distance > 1e-3f)
-            {
-                const Vector3 ray_dir = to_camera / desired_distance;
-
-                // Static-world throttle: camera collision only ever queries STATIC / terrain geometry (movable
-                // rigids, the player and NPCs are all excluded), which cannot move while the camera holds still and
-                // changes only SLOWLY as the camera moves. So the full result (walk, sphere, render occlusion,
-                // lateral probe) is recomputed only once the pivot or the desired camera position has moved more
-                // than k_collision_recompute_dist; in between it is reused and only the easing runs -- which
-                // collapses the cost to ~zero while standing AND skips most frames while walking (the dominant cost
-                // in dense scenes such as a doorway). The threshold is a MOVEMENT distance, so fast motion still
-                // recomputes every frame (responsive) while slow motion reuses for a few frames; the reused target
-                // is at most one threshold of camera travel stale, which the easing and the collision standoff
-                // (CollisionRadius) absorb, so the camera never visibly clips.
-                constexpr float k_collision_recompute_dist = 0.06f;
-                const float recompute_d2 = k_collision_recompute_dist * k_collision_recompute_dist;
-                const Vector3 throttle_cam = camera_position; // desired (pre-collision); the block overwrites it
-                static bool s_collision_throttle_valid = false;
-                static Vector3 s_throttle_pivot{};
-                static Vector3 s_throttle_cam{};
-                static float s_cached_allowed = 0.0f;
-                const bool recompute = !s_collision_throttle_valid ||
-                                       (pivot - s_throttle_pivot).magnitude_squared() > recompute_d2 ||
-                                       (throttle_cam - s_throttle_cam).magnitude_squared() > recompute_d2;
-                if (!recompute && cam.collision_valid)
-                {
-                    // Reuse last frame's allowed distance (the shared easing), then skip the whole walk / sphere /
-                    // render-occlusion / lateral-probe computation below.
-                    const float return_speed = cfg.collision_return_speed.load(std::memory_order_relaxed);
-                    ease_collision_toward(cam, s_cached_allowed, delta_time, return_speed);
-                    camera_position = pivot + ray_dir * cam.collision_distance;
-                    goto collision_done;
-                }
-
-                // Prefer the swept SPHERE (PrimitiveWorldIntersection): its contact distance is continuous
-                // as the sweep grazes edges, so the camera does not pump in dense geometry the way a single
-                // thin ray does (the root cause of the orbit position-jump). The sphere radius is the
-                // standoff, so no skin is subtracted on this path. Fall back to the thin ray (with skin)
-                // when the sphere is disabled, unavailable, or faults, so collision always works and never
-                // regresses.
-                // Camera collision = swept SPHERE (smooth) cross-checked against an RWI multi-ray FAN (correct).
-                // The PrimitiveWorldIntersection sphere may not honour our object types: the fork SPWIParams keeps
-                // a FLAGS field at +0x98 and the real entTypes at +0x9C, and +0x9C is a static-RE inference (the
-                // sim-class filter runs in a dispatched processor), so the sphere cannot be trusted to type-filter
-                // on its own. With entTypes effectively ent_all the sweep can hit the player's OWN
-                // CArticulatedEntity (skeleton + worn-gear physics) at point-blank (the "shield on the back" case).
-                // So the sphere is CROSS-CHECKED against the FAN (centre + 4 rays offset by the radius; RWI takes
-                // objtypes as a plain function ARG so it is provably correct), which gives the true nearest WORLD
-                // distance. The sphere is trusted ONLY when its contact is not closer than that world distance
-                // (allowing the sphere-radius inset); otherwise the fan distance is used. So the sphere can only
-                // make the result SMOOTHER, never closer than the world: no regression.
-                const float collision_radius = cfg.collision_radius.load(std::memory_order_relaxed);
-                // UseCoverageCollision is the master switch for the coverage-based heuristics (the coverage gate
-                // and the lateral probe). When OFF the camera collides plainly on the nearest solid: the coverage
-                // threshold is forced to 0 (no walk) and the lateral probe is skipped. Render occlusion is
-                // INDEPENDENT (its own UseRenderOcclusion toggle below).
-                const bool use_coverage = cfg.use_coverage_collision.load(std::memory_order_relaxed);
-                const float cov_thresh =
-                    use_coverage ? cfg.collision_coverage_threshold.load(std::memory_order_relaxed) : 0.0f;
-                // Find the nearest occluder that actually HIDES the body. With the coverage gate OFF (cov_thresh
-                // <= 0) this is just the nearest solid world surface. With it ON, WALK the arm: step through
-                // readable THIN props -- each measured by ITS OWN visible mesh (via the brush the ray actually
-                // hit, resolved through the collider's foreign data), so a foreground basket / pole the body is
-                // plainly visible past is skipped -- and stop at the first thing that genuinely covers the body: a
-                // solid we cannot rasterize (a building's compound mesh, a pure-physics proxy), terrain, or a
-                // readable mesh hiding >= CoverageThreshold of the body. If only thin props lie between the camera
-                // and the body with open space behind them, nothing covers and the camera stays out (no jolt).
-                // This judges each occluder on its own merit, where the prior single-shot gate saw only the
-                // nearest brush and let the body sit buried behind everything past it.
-                std::optional<RayHit> fan;
-                // Measured coverage (0..1) of the occluder the walk decides to block on; -9 = not measured (coverage
-                // gate off, terrain, or an unmeasurable solid). Logged so an oscillating thin prop whose coverage
-                // straddles CoverageThreshold frame to frame is visible without live debugging.
-                float blocked_cov = -9.0f;
-                // Occluders the coverage walk decided to see past (thin props / head-visible). Declared in the
-                // outer scope so the swept-sphere sweep below can skip the SAME near geometry and reach the wall
-                // the fan blocks on -- otherwise the sphere stops at a skipped window, disagrees with the fan's
-                // farther block, is rejected, and the camera falls back to the jumpy discrete fan distance.
-                uintptr_t cov_skip[Constants::COVERAGE_SKIP_MAX];
-                int n_cov_skip = 0;
-                if (cov_thresh <= 0.0f)
-                {
-                    fan = ray_fan_sweep(pivot, to_camera, collision_radius, Constants::RWI_OBJTYPES_CAMERA,
-                                        Constants::RWI_FLAGS_STOP_AT_SOLID);
-                }
-                else
-                {
-                    const Vector3 desired_cam = pivot + to_camera;
-                    // Refresh the live player world AABB the coverage samplers read so coverage is measured
-                    // against the REAL posed player (crouch / lying / mount / actual screen position), not a
-                    // fixed synthetic box. Invalid -> the samplers fall back to the synthetic box.
-                    publish_player_world_bounds(c_player);
-                    // Head-priority gate: if >= this fraction of the HEAD is still visible, skip the occluder
-                    // (no clamp) regardless of total coverage. 0 = off. Only suppresses a clamp, never forces one.
-                    const float head_visible_skip = cfg.head_visible_skip.load(std::memory_order_relaxed);
-                    for (int iter = 0; iter < Constants::COVERAGE_SKIP_MAX; ++iter)
-                    {
-                        const std::optional<RayHit> h =
-                            ray_fan_sweep(pivot, to_camera, collision_radius, Constants::RWI_OBJTYPES_CAMERA,
-                                          Constants::RWI_FLAGS_STOP_AT_SOLID, cov_skip, n_cov_skip);
-                        if (!h.has_value() || h->m_distance >= desired_distance)
-                        {
-                            break; // open past here -> nothing between camera and body hides it
-                        }
-                        if (h->m_terrain != 0)
-                        {
-                            fan = h; // terrain always covers (never see under the world)
-                            break;
-                        }
-                        // How much of the character does this collider hide? Cheap footprint pre-check, then
-                        // visible-mesh raster, then a physics-ray fallback -- cached per collider so a solid the
-                        // camera slides along is not re-rasterized every frame. See measure_collider_coverage.
-                        float head_cov = -1.0f;
-                        const float cov = measure_collider_coverage(h->m_collider, h->m_point, pivot, desired_cam,
-                                                                    to_camera, &head_cov);
-                        // Head-priority gate: when enough of the head is VISIBLE, suppress the block on this
-                        // occluder (look behind it) even if total coverage would clamp. Only a MEASURED head
-                        // (head_cov >= 0) gates -- an unmeasurable solid (head_cov < 0) still blocks below.
-                        const bool head_visible_enough = head_visible_skip > 0.0f && head_cov >= 0.0f &&
-                                                         (1.0f - head_cov) >= head_visible_skip;
-                        const bool cov_blocks = (cov < 0.0f || cov >= cov_thresh) && !head_visible_enough;
-                        if (cov_blocks)
-                        {
-                            // Unmeasurable solid (building / pure-physics) OR a readable mesh that hides enough of
-                            // the body (and the head is not visible enough to override) -> this is the collision.
-                            blocked_cov = cov;
-                            fan = h;
-                            break;
-                        }
-                        if (h->m_collider == 0)
-                        {
-                            fan = h; // cannot skip an unknown collider -> stop here (safe: collide)
-                            break;
-                        }
-                        cov_skip[n_cov_skip++] = h->m_collider; // visible past it (thin / head shows) -> look behind
-                    }
-                }
-                std::optional<RayHit> hit = fan;
-                bool from_sphere = false;
-                // UseSphereCollision selects the probe: when set, the swept SPHERE smooths the fan's world hit
-                // (continuous contact distance, no pump in dense geometry); when clear, the multi-ray FAN result
-                // is used alone (with the configured skin) for a cheaper, ray-only probe that skips the per-frame
-                // PWI sweep. The FAN is always the collision AUTHORITY either way; the sphere can only make the
-                // result smoother, never closer.
-                if (cfg.use_sphere_collision.load(std::memory_order_relaxed))
-                {
-                    // The swept sphere can't type-filter in this fork (the SPWIParams entTypes field is dead -- the
-                    // sweep effectively queries ent_all), so it slams into the player's BODY and back-worn GEAR
-                    // (sword / crossbow / shield) at the pivot end. Spending the 4-entry skip cap on the player
-                    // leaves none for the occluders the walk saw past, so in clutter the sphere stops at a prop,
-                    // disagrees with the fan's farther wall block, and is rejected -> the jumpy fan. Instead, START
-                    // the sweep PAST the body + gear (offset along the arm), so the player is behind the origin and
-                    // never hit, freeing the whole skip list for the walk's occluders. The sphere then reaches the
-                    // wall the fan blocks on and smooths it even indoors. A collision inside the offset is still
-                    // caught by the FAN (the authority), so this never clips -- it only adds smooth frames. (Also
-                    // drops the per-frame 10-ray player-skip probe.)
-                    const Vector3 sph_dir = to_camera / desired_distance; // desired_distance > 1e-3 (checked above)
-                    const float sph_clear = std::min(0.55f, desired_distance * 0.5f); // start past the body + worn gear
-                    const Vector3 sph_origin = pivot + sph_dir * sph_clear;
-                    uintptr_t skip_ents[4];
-                    int n_skip = 0;
-                    for (int i = 0; i < n_cov_skip && n_skip < 4; ++i) // the occluders the walk saw past
-                    {
-                        const uintptr_t c = cov_skip[i];
-                        bool dup = (c == 0);
-                        for (int k = 0; k < n_skip && !dup; ++k)
-                        {
-                            dup = (skip_ents[k] == c);
-                        }
-                        if (!dup)
-                        {
-                            skip_ents[n_skip++] = c;
-                        }
-                    }
-                    std::optional<RayHit> sphere =
-                        sphere_world_sweep(sph_origin, collision_radius, to_camera - sph_dir * sph_clear,
-                                           Constants::RWI_OBJTYPES_CAMERA, skip_ents, n_skip);
-                    if (sphere.has_value())
-                    {
-                        sphere->m_distance += sph_clear; // re-base from the offset origin back to the pivot
-                    }
-                    // The FAN (0x101 = static|terrain) is the AUTHORITY for collision: a plain objtypes arg that
-                    // provably excludes ALL actors (player body/gear, NPCs = ent_living/independent/rigid). The PWI
-                    // sphere only SMOOTHS the fan's world hit -- it queries ent_all (the struct entTypes is dead in
-                    // this fork, so it cannot be type-filtered and returns no collider to test), so it is trusted
-                    // ONLY when it AGREES with the fan's world surface (within the radius inset). Crucially, when
-                    // the fan finds NO world (open space), there is NO collision -- any actor the sphere saw (an
-                    // NPC at the camera, your own shield) is ignored = transparent, like non-physicalized grass.
-                    // This drops actor collisions UNIFORMLY with no skip-list / probe and no per-entity guessing.
-                    if (fan.has_value() && sphere.has_value() &&
-                        sphere->m_distance >= fan->m_distance - collision_radius - 0.10f &&
-                        sphere->m_distance <= fan->m_distance + 0.05f)
-                    {
-                        hit = sphere; // sphere agrees with the fan's world surface -> use it (continuous, no pump)
-                        from_sphere = true;
-                    }
-                }
-
-                constexpr float k_collision_hold_seconds = 0.3f; // hold the pull-in across edge hit/miss gaps
-
-                // Nearest SOLID-world block, skin-adjusted. Sphere path insets by the radius already, so it
-                // subtracts no extra skin; thin-ray path subtracts the configured skin.
-                float blocking_distance = desired_distance;
-                bool blocked = false;
-                if (hit.has_value() && hit->m_distance < desired_distance)
-                {
-                    // The coverage walk above already decided this hit COVERS the body (or the gate is off and the
-                    // nearest solid blocks), so pull the camera to it. The sphere path already inset by the radius
-                    // (no extra skin); the thin-ray path subtracts the configured skin before the surface.
-                    const float skin = from_sphere ? 0.0f : cfg.collision_skin.load(std::memory_order_relaxed);
-                    blocking_distance = std::max(0.0f, hit->m_distance - skin);
-                    blocked = true;
-                }
-
-                // Trace the PHYSICS collision hit (the solid-world fan/sphere result) so it can be compared
-                // against RenderOcclusion HIT: physics fires on walls / terrain / solid props (objtypes
-                // ent_static|ent_terrain), render occlusion on non-physical cloth. Where physics is silent but
-                // render fires (or vice versa) is the proof they are complementary, not redundant. Rate-limited
-                // to a meaningful change (block-state toggle or distance move > 0.1m) so it never spams a frame.
-                {
-                    static bool s_phys_blocked = false;
-                    static float s_phys_dist = -1.0f;
-                    const float dd = blocked ? (hit->m_distance - s_phys_dist) : 0.0f;
-                    const bool moved = (dd > 0.1f) || (dd < -0.1f);
-                    // The trace below identifies the hit object via a render-octree query (render_hit_info); gate it
-                    // on trace logging being ENABLED so that diagnostic octree + per-node vertex scan never runs on
-                    // a normal-play frame -- it is purely for the PhysicsCollision HIT log. (A foreign-null hit, the
-                    // common case once the coverage walk skips thin scenery, takes render_hit_info's expensive
-                    // octree path, which was running every frame the camera moved while blocked.)
-                    const bool trace_on = DMK::Logger::get_instance().is_enabled(DMK::LogLevel::Trace);
-                    if (trace_on && blocked && (blocked != s_phys_blocked || moved))
-                    {
-                        // The FAN is the collision AUTHORITY: it carries the real collider + surface normal. The
-                        // sphere only SMOOTHS the distance and reports a synthetic normal / null collider, so identify
-                        // the object the camera blocked on from the fan (point + collider), not the sphere's `hit`.
-                        // node = the collider's foreign render-node link (0 for a merged / proxy collider, which
-                        // render_hit_info then resolves by querying the render octree at the hit point).
-                        const RayHit &id_hit = fan.has_value() ? *fan : *hit;
-                        const Vector3 &hp = id_hit.m_point;
-                        const Vector3 &hn = id_hit.m_normal;
-                        const int hit_terrain = id_hit.m_terrain;
-                        const uintptr_t collider = id_hit.m_collider;
-                        void *node = reinterpret_cast<void *>(static_brush_render_node(collider));
-                        char obj_name[160] = {};
-                        float obj_ext[3] = {};
-                        int obj_kind = 0;
-                        (void)render_hit_info(hp, node, obj_name, static_cast<int>(sizeof(obj_name)), obj_ext,
-                                              &obj_kind);
-                        static const char *const k_obj_kinds[] = {"none", "foreign", "prop", "solid", "hlod"};
-                        const char *kind_str = (obj_kind >= 0 && obj_kind <= 4) ? k_obj_kinds[obj_kind] : "?";
-                        DMK::Logger::get_instance().trace(
-                            "PhysicsCollision HIT: src={} bTerrain={} dist={} of {} cov={} kind={} obj=\"{}\" "
-                            "ext=({}, {}, {}) collider={:#x} node={:#x} point=({}, {}, {}) normal=({}, {}, {}) "
-                            "cam=({}, {}, {}) pivot=({}, {}, {})",
-                            from_sphere ? "sphere" : "fan", hit_terrain, hit->m_distance, desired_distance, blocked_cov,
-                            kind_str, obj_name, obj_ext[0], obj_ext[1], obj_ext[2], collider,
-                            reinterpret_cast<uintptr_t>(node), hp.x, hp.y, hp.z, hn.x, hn.y, hn.z, camera_position.x,
-                            camera_position.y, camera_position.z, pivot.x, pivot.y, pivot.z);
-                    }
-                    s_phys_blocked = blocked;
-                    if (blocked)
-                    {
-                        s_phys_dist = hit->m_distance;
-                    }
-                }
-
-                // Render-only overhead roofs (tent / awning canopy cloth) carry no ray-collidable physics, so the
-                // fan and sphere glide through them and the cloth buries the camera on a look-down. Query the
-                // render octree along the same arm and clamp below an overhead brush. The radius is the standoff
-                // (already applied by render_occlusion_limit), so no skin is subtracted. Enabling/disabling render
-                // occlusion is still UseRenderOcclusion alone; but when UseCoverageCollision is ON it also passes
-                // the coverage threshold, so render occlusion drops thin props the body is plainly visible past (a
-                // pole / bird feeder) instead of clamping on them -- keyed on the REAL projected player extent, so
-                // a view-burying canopy (high coverage on a look-down) still clamps. With cov_thresh = 0 (coverage
-                // collision off) the prior behavior holds: only the sightline vertex-count test filters brushes.
-                if (cfg.use_render_occlusion.load(std::memory_order_relaxed))
-                {
-                    // Query the render octree only out to where the physics collision already stops the camera: a
-                    // roof beyond that point can never be reached, so indoors / near walls (where physics blocks
-                    // close) the query box shrinks to the short arm and skips the room's geometry, the bulk of the
-                    // render-occlusion cost in dense scenes.
-                    const Vector3 occ_arm = ray_dir * blocking_distance;
-                    // Pass the coverage threshold so render occlusion can drop thin props the body is visible
-                    // past (UseRenderOcclusion respecting CoverageCollision). cov_thresh is 0 when coverage
-                    // collision is off, which leaves render occlusion on its sightline-only test (prior behavior).
-                    const std::optional<float> roof =
-                        render_occlusion_limit(pivot, occ_arm, collision_radius, cov_thresh);
-                    if (roof.has_value() && roof.value() < blocking_distance)
-                    {
-                        blocking_distance = std::max(0.0f, roof.value());
-                        blocked = true;
-                    }
-                }
-
-                float allowed_distance;
-                if (blocked && blocking_distance < desired_distance)
-                {
-                    allowed_distance = blocking_distance;
-                    cam.collision_hold_timer = k_collision_hold_seconds; // latch on a blocking hit
-                }
-                else if (cam.collision_valid && cam.collision_hold_timer > 0.0f)
-                {
-                    // Recently blocked but clear this frame: HOLD the pulled-in distance through the
-                    // gap so an edge-grazing hit/miss alternation cannot pump the camera (sawtooth).
-                    cam.collision_hold_timer -= delta_time;
-                    allowed_distance = cam.collision_distance;
-                }
-                else
-                {
-                    allowed_distance = desired_distance; // truly clear: ease back out
-                }
-
-                // Lateral / frustum clearance. The pivot->camera probe only sees obstacles ALONG the arm, so a
-                // wall BESIDE the camera (a corner, a doorway jamb, a narrow gap) is invisible to it and intrudes
-                // into the view. Probe the camera's lateral surroundings (the frustum cross-section: +-right /
-                // +-up around the look axis) and pull the camera further in along the arm until any CONVERGING
-                // side wall is at least CameraProbeSize away. This is geometric penetration safety, NOT occlusion,
-                // so it bypasses the coverage gate (a side wall does not hide the character) and queries static /
-                // terrain world only (RWI_OBJTYPES_CAMERA never returns the player or NPCs). A wall the arm runs
-                // PARALLEL to (a corridor) cannot be escaped by pulling in, so it is left alone rather than yanking
-                // the camera to first person. Bounded passes; only does work when something is within reach.
-                const float probe = use_coverage ? cfg.camera_probe_size.load(std::memory_order_relaxed) : 0.0f;
-                if (probe > 0.0f && allowed_distance > collision_radius)
-                {
-                    const Vector3 view = ray_dir * -1.0f; // the camera looks back along the arm toward the pivot
-                    Vector3 probe_right = view.cross(Vector3{0.0f, 0.0f, 1.0f});
-                    const float rl = probe_right.magnitude();
-                    if (rl > 1e-4f)
-                    {
-                        probe_right = probe_right / rl;
-                        const Vector3 probe_up = probe_right.cross(view); // orthonormal (right & view perpendicular)
-                        const Vector3 lateral[4] = {probe_right, probe_right * -1.0f, probe_up, probe_up * -1.0f};
-                        // Floor the pull-in at the closest USEFUL third-person distance (follow_distance_min). A side
-                        // wall grazing the frustum is a SOFTER concern than a direct occluder, so never drag the
-                        // camera to near first person (losing the whole view + jamming into the character) just to
-                        // hold one off -- accept a little intrusion instead. Capped to the incoming allowed_distance
-                        // so a tight pull from a real along-arm occluder is never pushed back OUT into it.
-                        const float lateral_floor =
-                            std::min(allowed_distance, cfg.follow_distance_min.load(std::memory_order_relaxed));
-                        for (int pass = 0; pass < 3 && allowed_distance > lateral_floor; ++pass)
-                        {
-                            const Vector3 cam_test = pivot + ray_dir * allowed_distance;
-                            float capped = allowed_distance;
-                            for (const Vector3 &side : lateral)
-                            {
-                                const std::optional<RayHit> h =
-                                    ray_world_intersection(cam_test, side * probe, Constants::RWI_OBJTYPES_CAMERA,
-                                                           Constants::RWI_FLAGS_STOP_AT_SOLID);
-                                if (!h.has_value() || h->m_distance >= probe)
-                                {
-                                    continue; // this side is clear within the probe
-                                }
-                                // Wall plane: point P, normal N (toward the camera). Lateral clearance along the
-                                // arm is clear(t) = dot(pivot - P, N) + t * dot(ray_dir, N). Pulling IN clears the
-                                // wall only when the arm runs INTO it (dot(ray_dir, N) < 0); a parallel / diverging
-                                // wall is left alone. Solve for the largest t that keeps the camera `probe` off it.
-                                const Vector3 &P = h->m_point;
-                                const Vector3 &N = h->m_normal;
-                                const float a = ray_dir.x * N.x + ray_dir.y * N.y + ray_dir.z * N.z;
-                                if (a >= -0.05f)
-                                {
-                                    continue; // parallel / diverging side wall: pulling in cannot clear it
-                                }
-                                const float b = (pivot.x - P.x) * N.x + (pivot.y - P.y) * N.y + (pivot.z - P.z) * N.z;
-                                const float t = (probe - b) / a;
-                                if (t < capped)
-                                {
-                                    capped = t;
-                                }
-                            }
-                            if (capped >= allowed_distance - 1e-3f)
-                            {
-                                break; // every side clear -> done
-                            }
-                            allowed_distance = std::max(lateral_floor, capped);
-                            blocked = true;
-                            cam.collision_hold_timer = k_collision_hold_seconds; // latch like a normal blocking hit
-                        }
-                    }
-                }
-
-                // Ease toward the allowed distance (fast pull-IN so a wall is never clipped, slower return-OUT),
-                // via the shared helper the throttle bypass also uses.
-                const float return_speed = cfg.collision_return_speed.load(std::memory_order_relaxed);
-                ease_collision_toward(cam, allowed_distance, delta_time, return_speed);
-
-                camera_position = pivot + ray_dir * cam.collision_distance;
-
-                // Cache the freshly computed target so a held-still camera reuses it next frame (throttle above).
-                s_collision_throttle_valid = true;
-                s_throttle_pivot = pivot;
-                s_throttle_cam = throttle_cam;
-                s_cached_allowed = allowed_distance;
+                prefetch_render_region(pivot, desired_arm, cfg.collision_radius);
             }
-        collision_done:;
         }
 
         // Write the offset position into the camera matrix translation column. The basis columns are
@@ -2116,43 +3005,37 @@ namespace TPVCamera
      */
     static void call_head_visibility(uintptr_t entity, bool hide_head)
     {
-        if (s_set_head_visibility_original)
+        if (const SetHeadVisibilityFunc original = set_head_visibility_original())
         {
-            s_set_head_visibility_original(entity, hide_head,
-                                           static_cast<char>(s_head_flags.load(std::memory_order_relaxed)));
+            const uint8_t flags = detour_hot_block().head_flags.load(std::memory_order_relaxed);
+            original(entity, hide_head, static_cast<char>(flags));
         }
     }
 
     /**
-     * @brief Keeps the player head in sync with the offset state once per frame.
-     * @details While the offset is active the head must stay shown, but the engine only
-     *          sets head visibility on its own transitions, so re-call the setter whenever
-     *          the live hide flag says the head is hidden. When the offset has just turned
-     *          off, restore the game's intended hide value exactly once so the first-person
-     *          rig hides the head again. The hide flag is re-read rather than cached so this
-     *          self-heals regardless of who last changed it, and a call is issued only on a
-     *          mismatch so the engine is not driven every frame.
+     * @brief Drives the player head on offset view edges.
+     * @details The setter detour is the authority for the head: every engine write passes
+     *          through it and is rewritten to the live offset state, so between edges the head
+     *          already matches and the steady state does no guarded read and no engine call.
+     *          On the frame the offset engages, show the head; on the frame it disengages,
+     *          restore the game's intended hide value so the first-person rig hides it again.
+     *          With no entity latched yet there is nothing to drive: the detour's first call
+     *          applies the then-current state itself.
      * @param active Whether the offset is currently being applied to the game view.
      */
     static void reassert_head_visibility(bool active)
     {
-        const uintptr_t entity = s_head_entity.load(std::memory_order_relaxed);
+        DetourHotBlock &hot = detour_hot_block();
+        if (active == hot.head_was_active.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        hot.head_was_active.store(active, std::memory_order_relaxed);
+        const uintptr_t entity = hot.head_entity.load(std::memory_order_relaxed);
         if (entity != 0 && DMK::Memory::plausible_userspace_ptr(entity))
         {
-            if (active)
-            {
-                const auto hide_flag = DMK::Memory::seh_read<uint8_t>(entity + Constants::OFFSET_ENTITY_HIDE_HEAD_FLAG);
-                if (hide_flag && *hide_flag != 0)
-                {
-                    call_head_visibility(entity, false);
-                }
-            }
-            else if (s_head_was_active.load(std::memory_order_relaxed))
-            {
-                call_head_visibility(entity, s_game_intended_hide_head.load(std::memory_order_relaxed));
-            }
+            call_head_visibility(entity, active ? false : hot.game_intended_hide_head.load(std::memory_order_relaxed));
         }
-        s_head_was_active.store(active, std::memory_order_relaxed);
     }
 
     /**
@@ -2282,30 +3165,104 @@ namespace TPVCamera
         s_prev_excluded = excluded;
     }
 
+    /** @brief Vtable of the CView @p camera would be embedded in; 0 when implausible or unreadable. */
+    [[nodiscard]] static uintptr_t embedding_vtable(uintptr_t camera) noexcept
+    {
+        if (!DMK::Memory::plausible_userspace_ptr(camera))
+        {
+            return 0;
+        }
+        const auto vtable = DMK::Memory::seh_read<uintptr_t>(camera - Constants::SVIEWPARAMS_VIEWMATRIX_OFFSET);
+        return (vtable && DMK::Memory::plausible_userspace_ptr(*vtable)) ? *vtable : 0;
+    }
+
+    /**
+     * @brief True when @p camera is the game view's camera; latches it the first time it is identified.
+     * @details The game-view camera is embedded in its CView at SVIEWPARAMS_VIEWMATRIX_OFFSET; the shadow,
+     *          reflection and portal cameras handed to the same builder are not. Until a camera is latched, each
+     *          call is identified by its embedding vtable (RTTI on the very first, then a compare against
+     *          cview_vtable). Once latched, another camera returns after a compare and a clock read, with no guarded
+     *          read; the latched camera itself keeps its vtable check, and the latch is dropped when that fails (the
+     *          CView was freed or reused) or when the latched camera was not seen for a whole frame
+     *          (FrameClock::frame_passed: the engine built the view into a new CView, e.g. across a level load), so
+     *          the next CView is identified again. Render thread only.
+     */
+    [[nodiscard]] static bool is_game_view_camera(DetourHotBlock &hot, uintptr_t camera)
+    {
+        if (hot.game_view_camera != 0)
+        {
+            const std::int64_t now = FrameClock::now();
+            if (camera == hot.game_view_camera)
+            {
+                hot.game_view_seen_ticks = now;
+                if (embedding_vtable(camera) == hot.cview_vtable)
+                {
+                    return true;
+                }
+                hot.game_view_camera = 0;
+                return false;
+            }
+            if (!FrameClock::frame_passed(hot.game_view_seen_ticks, now))
+            {
+                return false;
+            }
+            hot.game_view_camera = 0; // not seen last frame: identify this call like any other
+        }
+
+        const uintptr_t vtable = embedding_vtable(camera);
+        if (vtable == 0)
+        {
+            return false;
+        }
+        // Identify the CView by RTTI on the first hit and cache its vtable address. Using the RTTI type name
+        // rather than a hardcoded vtable address keeps this resilient across game patches.
+        if (hot.cview_vtable == 0)
+        {
+            if (!RttiCache::is_type(vtable, Constants::CVIEW_RTTI_NAME))
+            {
+                return false;
+            }
+            hot.cview_vtable = vtable;
+        }
+        else if (vtable != hot.cview_vtable)
+        {
+            return false;
+        }
+        hot.game_view_camera = camera;
+        hot.game_view_seen_ticks = FrameClock::now();
+        return true;
+    }
+
     /**
      * @brief Gate + matrix-offset body for the frustum-builder detour. Separated from the SEH wrapper
      *        so that frame can hold C++ objects that need unwinding.
-     * @details Cheapest exits first: the runtime toggle, then the CView vtable identity (a single
-     *          guarded read), so the inactive feature and any non-game camera (shadow, reflection,
-     *          portal) pay almost nothing.
+     * @details Cheapest exits first: the game-view latch (one compare for any non-game camera: shadow,
+     *          reflection, portal), then the runtime toggle, so the inactive feature and the other cameras
+     *          pay almost nothing.
      * @param camera The camera handed to the frustum builder (matrix at offset 0).
      */
     static void detour_frustum_build_impl(uintptr_t camera)
     {
+        DetourHotBlock &hot = detour_hot_block();
+        if (!is_game_view_camera(hot, camera))
+        {
+            return;
+        }
+
         CameraState &cam = camera_state();
-        LiveSettings &cfg = settings();
+        const RenderSettings &cfg = render_settings();
 
-        const bool state_policy = cfg.enable_state_behavior.load(std::memory_order_relaxed);
-        const uint32_t forced_fpv = state_policy ? cfg.forced_fpv_mask.load(std::memory_order_relaxed) : 0u;
-        const uint32_t forced_tpv = state_policy ? cfg.forced_tpv_mask.load(std::memory_order_relaxed) : 0u;
+        const bool state_policy = cfg.enable_state_behavior;
+        const uint32_t forced_fpv = state_policy ? cfg.forced_fpv_mask : 0u;
+        const uint32_t forced_tpv = state_policy ? cfg.forced_tpv_mask : 0u;
 
         // Fast path: nothing can drive the offset, so there is nothing to do. When any forced state is
         // configured the policy must run every game-view frame to catch the state-change EDGES that
         // trigger a one-time forced switch, so only skip when the player is in manual first person with
         // no forced states configured and the head has already been restored (the head-restore branch
-        // keeps running for one frame after a toggle-off, while s_head_was_active is still set).
+        // keeps running for one frame after a toggle-off, while head_was_active is still set).
         if (!cam.applying.load(std::memory_order_relaxed) && (forced_fpv | forced_tpv) == 0 &&
-            !s_head_was_active.load(std::memory_order_relaxed) && cam.view_blend <= 1e-3f)
+            !hot.head_was_active.load(std::memory_order_relaxed) && cam.view_blend <= 1e-3f)
         {
             // Even while idle (first person, no forced state), probe for the player until the world is
             // first seen so game_world_ready becomes true in-world REGARDLESS of the third-person view
@@ -2317,52 +3274,44 @@ namespace TPVCamera
             }
             // Offset disengaged: the orbit cannot be capturing, and the cursor flag is only refreshed on
             // the game-view path below, so clear it here to keep it from latching true across the gap.
-            s_cursor_shown.store(false, std::memory_order_relaxed);
+            hot.cursor_shown.store(false, std::memory_order_relaxed);
+            hot.orbit_capture_gate.store(false, std::memory_order_relaxed);
             return;
         }
 
-        // The camera is embedded in its CView at SVIEWPARAMS_VIEWMATRIX_OFFSET, so the CView is that
-        // far below the camera. Confirm it by checking the CView vtable: shadow/reflection/portal
-        // cameras handed to the same builder are not embedded in a CView and fail this guard.
-        if (!DMK::Memory::plausible_userspace_ptr(camera))
-        {
-            return;
-        }
+        // The camera is embedded in its CView at SVIEWPARAMS_VIEWMATRIX_OFFSET, so the CView is that far below it.
         const uintptr_t cview = camera - Constants::SVIEWPARAMS_VIEWMATRIX_OFFSET;
-        const auto vtable = DMK::Memory::seh_read<uintptr_t>(cview);
-        if (!vtable || !DMK::Memory::plausible_userspace_ptr(*vtable))
-        {
-            return;
-        }
-        // Identify the CView by RTTI on the first hit and cache its vtable address, so the
-        // steady-state gate is a single qword compare. Using the RTTI type name rather than a
-        // hardcoded vtable address keeps this resilient across game patches.
-        if (s_cview_vtable_runtime != 0)
-        {
-            if (*vtable != s_cview_vtable_runtime)
-            {
-                return;
-            }
-        }
-        else if (DMK::Rtti::vtable_is_type(*vtable, Constants::CVIEW_RTTI_NAME))
-        {
-            s_cview_vtable_runtime = *vtable;
-        }
-        else
-        {
-            return;
-        }
+
+        // Per-stage timing of this game-view frame (no-op unless [Advanced] EnableProfiler is set). Opened only
+        // past the CView gate so shadow / reflection / portal builder calls are not counted as frames.
+        TPVCAMERA_PROFILE_FRAME();
+        // This frame's scratch (octree node lists): reset on every exit path, so the frame never touches the heap.
+        const FrameArena::FrameScope frame_scratch;
+        // Fault / fallback sample of this frame for the health readout, closed on every exit path like the above.
+        const Health::FrameScope health_frame;
+        // Repeats of a ray within this frame (the collision centre ray) reuse its first result (physics_raycast.hpp).
+        const CameraRayFrame camera_rays;
 
         // Game-view camera: take the single per-frame delta and resolve the player once here, then
-        // reuse both in the matrix offset below so neither is computed twice per frame. The game state
-        // is derived from the discrete engine signals and published for the input-dispatch thread.
-        const float delta_time = frame_delta();
+        // reuse both in the matrix offset below so neither is computed twice per frame. The frame clock
+        // returns a near-zero delta for the second builder call of a frame and a normal frame's delta
+        // across a pause or hitch (frame_clock.hpp). The game state is derived from the discrete engine
+        // signals and published for the input-dispatch thread.
+        const FrameClock::Tick tick = FrameClock::tick();
+        const float delta_time = tick.delta;
         const uintptr_t c_player = resolve_c_player();
         // Presets are always active, so the debounced game state is always needed here (to select the
         // active preset and, when state behaviour is on, to drive the forced-view / orbit-exclude policies).
-        const uint32_t raw_state = poll_game_state(c_player);
-        const uint32_t state =
-            debounce_game_state(raw_state, delta_time, cfg.state_switch_hold_seconds.load(std::memory_order_relaxed));
+        uint32_t raw_state;
+        {
+            TPVCAMERA_PROFILE_SCOPE(PollGameState);
+            raw_state = poll_game_state(c_player);
+        }
+        uint32_t state;
+        {
+            TPVCAMERA_PROFILE_SCOPE(Debounce);
+            state = debounce_game_state(raw_state, delta_time, cfg.state_switch_hold_seconds);
+        }
         if (state_policy)
         {
             // Both policies are edge-triggered (they act on state-change edges, not every frame) so the
@@ -2370,9 +3319,11 @@ namespace TPVCamera
             // on entry and restores it on exit; the orbit-exclude policy suspends free-look on entry and
             // restores it on exit.
             apply_forced_view_policy(cam, state, forced_fpv, forced_tpv);
-            apply_orbit_exclude_policy(cam, state, cfg.orbit_exclude_mask.load(std::memory_order_relaxed));
+            apply_orbit_exclude_policy(cam, state, cfg.orbit_exclude_mask);
         }
-        game_state_mask().store(state, std::memory_order_relaxed);
+        // A state edge can move the overlay's active-preset highlight; wake an open panel to redraw it.
+        if (game_state_mask().exchange(state, std::memory_order_relaxed) != state)
+            Overlay::notify_changed();
 
         // Publish whether the game is showing the OS cursor (a UI is up) so the free-look input gate can
         // freeze the orbit while menus / loot / trade / dialogue are open. The hardware-mouse reference
@@ -2382,30 +3333,30 @@ namespace TPVCamera
         // than a stuck-frozen one. Read here on the render thread; the input thread only reads the
         // published flag (same producer/consumer split as game_state_mask, so no new cross-thread race).
         // Non-game-view frustum frames (shadow/reflection) skip this publish, but cannot strand the orbit
-        // frozen: s_offset_active is co-published on this same game-view path and the input gate tests it
+        // frozen: offset_active is co-published on this same game-view path and the input gate tests it
         // first, so a stale true here is moot whenever the offset is not actively rendering the view.
         bool cursor_shown = false;
-        if (cfg.freeze_orbit_on_cursor.load(std::memory_order_relaxed) && s_genv_runtime != 0)
+        if (cfg.freeze_orbit_on_cursor && hot.genv != 0)
         {
             const auto count_addr = DMK::Memory::seh_resolve_chain(
-                s_genv_runtime, {Constants::GENV_HARDWARE_MOUSE_OFFSET, Constants::HARDWARE_MOUSE_CURSOR_COUNT_OFFSET});
+                hot.genv, {Constants::GENV_HARDWARE_MOUSE_OFFSET, Constants::HARDWARE_MOUSE_CURSOR_COUNT_OFFSET});
             if (count_addr)
             {
                 const auto count = DMK::Memory::seh_read<int32_t>(*count_addr);
                 cursor_shown = count.has_value() && *count > 0;
             }
         }
-        s_cursor_shown.store(cursor_shown, std::memory_order_relaxed);
+        hot.cursor_shown.store(cursor_shown, std::memory_order_relaxed);
 
-        // Drive the player head from the offset state every frame (the engine only sets it on its own
-        // transitions, so toggling the offset would otherwise leave the head stuck), then offset the
-        // matrix while active. The offset follows cam.applying directly -- both the manual toggle and
-        // the edge-triggered policy write it -- and should_apply_view() applies the SuppressTPVState hard
-        // gate.
+        // Drive the player head on offset view edges (the engine only sets it on its own transitions,
+        // which the setter detour rewrites, so toggling the offset would otherwise leave the head
+        // stuck), then offset the matrix while active. The offset follows cam.applying directly -- both
+        // the manual toggle and the edge-triggered policy write it -- and should_apply_view() applies the
+        // SuppressTPVState hard gate.
         // Ease the first-person <-> third-person blend toward the desired view so toggling (and UI
         // suppression) slides instead of snapping. ViewTransitionDuration 0 makes the switch instant.
         const bool want_tpv = cam.applying.load(std::memory_order_relaxed) && should_apply_view();
-        const float view_dur = cfg.view_transition_duration.load(std::memory_order_relaxed);
+        const float view_dur = cfg.view_transition_duration;
         const float view_target = want_tpv ? 1.0f : 0.0f;
         if (view_dur > 1e-4f)
         {
@@ -2420,7 +3371,8 @@ namespace TPVCamera
 
         // The offset is rendered while heading TO or holding third person, so the ease-OUT renders too.
         const bool offset_engaged = want_tpv || cam.view_blend > 1e-3f;
-        s_offset_active.store(offset_engaged, std::memory_order_relaxed);
+        hot.offset_active.store(offset_engaged, std::memory_order_relaxed);
+        hot.orbit_capture_gate.store(offset_engaged && !cursor_shown && should_apply_view(), std::memory_order_relaxed);
         reassert_head_visibility(offset_engaged);
 
         // Edge tracker for the disengage cleanup below: true while the offset is rendering, so the cleanup runs
@@ -2464,11 +3416,23 @@ namespace TPVCamera
 
         // Resolve the active preset (by debounced state, or the overlay's editing pin) and ease the
         // live framing toward it BEFORE the matrix offset reads those settings this frame.
-        Presets::resolve_and_apply(state, delta_time);
+        {
+            TPVCAMERA_PROFILE_SCOPE(ResolvePreset);
+            Presets::resolve_and_apply(state, delta_time);
+        }
+
+        // A running camera benchmark scripts this frame's orbit and zoom before the offset reads them.
+        {
+            const RenderSettings &now = render_settings();
+            Benchmark::on_frame(tick, Benchmark::Limits{now.follow_distance, now.follow_distance_min,
+                                                        now.follow_distance_max, now.orbit_pitch_min,
+                                                        now.orbit_pitch_max});
+        }
 
         // Smoothstep the linear view blend for an ease-in/out feel, then offset with it.
         const float vb = cam.view_blend;
         const float view_s = vb * vb * (3.0f - 2.0f * vb);
+        TPVCAMERA_PROFILE_SCOPE(OffsetCamera);
         offset_game_view_camera(camera, cview, c_player, delta_time, view_s);
     }
 
@@ -2489,7 +3453,8 @@ namespace TPVCamera
         {
             // Swallow: an outdated offset or layout must never crash the game.
         }
-        return s_frustum_build_original ? s_frustum_build_original(camera) : 0;
+        const FrustumBuildFunc original = frustum_build_original();
+        return original ? original(camera) : 0;
     }
 
     /**
@@ -2503,22 +3468,23 @@ namespace TPVCamera
     {
         __try
         {
-            if (s_set_head_visibility_original)
+            if (const SetHeadVisibilityFunc original = set_head_visibility_original())
             {
                 // Latch the player entity, the flags, and the game's intended hide value so
-                // the per-frame re-assert can keep the head shown while the offset is active
-                // and restore the game's value when it turns off. This is the player because
+                // the view-edge re-assert can show the head when the offset engages and
+                // restore the game's value when it turns off. This is the player because
                 // the setter only toggles the FirstPersonView rig.
-                s_head_entity.store(entity, std::memory_order_relaxed);
-                s_head_flags.store(static_cast<uint8_t>(flags), std::memory_order_relaxed);
-                s_game_intended_hide_head.store(hide_head, std::memory_order_relaxed);
+                DetourHotBlock &hot = detour_hot_block();
+                hot.head_entity.store(entity, std::memory_order_relaxed);
+                hot.head_flags.store(static_cast<uint8_t>(flags), std::memory_order_relaxed);
+                hot.game_intended_hide_head.store(hide_head, std::memory_order_relaxed);
 
                 // Mirror the head to the offset's effective active state (published by the frustum
                 // detour) rather than the raw toggle, so a forced-FPV/TPV state shows or hides the head
                 // to match the view the player actually sees.
-                const bool active = s_offset_active.load(std::memory_order_relaxed);
+                const bool active = hot.offset_active.load(std::memory_order_relaxed);
                 const bool final_hide_head = active ? false : hide_head;
-                s_set_head_visibility_original(entity, final_hide_head, flags);
+                original(entity, final_hide_head, flags);
             }
         }
         __except (EXCEPTION_EXECUTE_HANDLER)
@@ -2527,6 +3493,81 @@ namespace TPVCamera
         }
     }
 
+    // What the input hook does with one analog-channel event, by device and key id.
+    enum class OrbitInputAction : uint8_t
+    {
+        Pass,       // not a look axis: dispatch untouched
+        MouseYaw,   // accumulate the delta into orbit_yaw, block
+        MousePitch, // accumulate the delta into orbit_pitch (clamped), block
+        PadYaw,     // latch the right-stick deflection, zero it in place, pass
+        PadPitch,
+    };
+
+    // Decision table indexed by EKeyId block (0x100 mouse, 0x200 XInput pad) and the key id's low byte. Built
+    // once at compile time from the look-axis ids in constants.hpp; a lookup replaces the per-event id compares.
+    constexpr uint32_t k_input_key_blocks = 2;
+    constexpr uint32_t k_input_key_slots = 32;
+    using OrbitInputTable = std::array<std::array<OrbitInputAction, k_input_key_slots>, k_input_key_blocks>;
+
+    [[nodiscard]] constexpr uint32_t input_key_block(int32_t id) noexcept
+    {
+        return (static_cast<uint32_t>(id) >> 8) - 1u; // wraps out of range below 0x100
+    }
+
+    [[nodiscard]] constexpr uint32_t input_key_slot(int32_t id) noexcept
+    {
+        return static_cast<uint32_t>(id) & 0xFFu;
+    }
+
+    [[nodiscard]] constexpr OrbitInputTable build_orbit_input_table() noexcept
+    {
+        OrbitInputTable table{};
+        const auto set = [&table](int32_t id, OrbitInputAction action)
+        { table[input_key_block(id)][input_key_slot(id)] = action; };
+        set(Constants::INPUT_LOOK_YAW_EVENT_ID, OrbitInputAction::MouseYaw);
+        set(Constants::INPUT_LOOK_PITCH_EVENT_ID, OrbitInputAction::MousePitch);
+        set(Constants::INPUT_PAD_LOOK_YAW_EVENT_ID, OrbitInputAction::PadYaw);
+        set(Constants::INPUT_PAD_LOOK_PITCH_EVENT_ID, OrbitInputAction::PadPitch);
+        return table;
+    }
+
+    [[nodiscard]] constexpr bool input_key_in_table(int32_t id) noexcept
+    {
+        return input_key_block(id) < k_input_key_blocks && input_key_slot(id) < k_input_key_slots;
+    }
+    static_assert(input_key_in_table(Constants::INPUT_LOOK_YAW_EVENT_ID) &&
+                      input_key_in_table(Constants::INPUT_LOOK_PITCH_EVENT_ID) &&
+                      input_key_in_table(Constants::INPUT_PAD_LOOK_YAW_EVENT_ID) &&
+                      input_key_in_table(Constants::INPUT_PAD_LOOK_PITCH_EVENT_ID),
+                  "look-axis key ids must fall inside the orbit input table");
+
+    constexpr OrbitInputTable k_orbit_input_table = build_orbit_input_table();
+
+    [[nodiscard]] static OrbitInputAction orbit_input_action(int32_t id) noexcept
+    {
+        return input_key_in_table(id) ? k_orbit_input_table[input_key_block(id)][input_key_slot(id)]
+                                      : OrbitInputAction::Pass;
+    }
+
+    // Preset-owned mouse-orbit values for the input hook, folded into per-event multipliers and re-read only when
+    // the preset resolver published a change (LiveSettings::preset_version): a mouse burst posts hundreds of look
+    // events a second, and this keeps them off the settings cache lines the render thread writes during a blend.
+    // The multipliers are the hot block's input line (orbit_yaw_scale is the per-delta yaw step: the negated X
+    // sensitivity, so mouse-left orbits left). Input thread only.
+    [[nodiscard]] static const DetourHotBlock &orbit_input_settings() noexcept
+    {
+        DetourHotBlock &hot = detour_hot_block();
+        const LiveSettings &cfg = settings();
+        const uint32_t version = cfg.preset_version.load(std::memory_order_acquire);
+        if (version != hot.orbit_input_version)
+        {
+            hot.orbit_input_version = version;
+            hot.orbit_yaw_scale = -cfg.orbit_sensitivity_x.load(std::memory_order_relaxed);
+            hot.orbit_pitch_scale = cfg.orbit_sensitivity_y.load(std::memory_order_relaxed);
+        }
+        return hot;
+    }
+
     /**
      * @brief Free-look capture/block decision for one input event (toggle orbit camera).
      * @details While the offset is active and orbit is TOGGLED on, mouse-look deltas are accumulated
@@ -2534,25 +3575,27 @@ namespace TPVCamera
      *          put while free-looking. Every other input (movement keys, interaction, clicks) passes
      *          through, so the toggle orbit is a usable camera mode the character can move and act in.
      *          Lives apart from the SEH wrapper so that frame stays free of C++ object unwinding; the
-     *          wrapper guards the engine-owned reads.
+     *          wrapper guards the engine-owned reads. The hot path is the capture gate, one table lookup for the
+     *          key id and one fetch_add into the pending mouse delta.
      * @param input_event Engine input event (GameStructures::InputEvent layout).
      * @return true to block (swallow) the event, false to dispatch it normally.
      */
     [[nodiscard]] static bool orbit_capture_and_decide(uintptr_t input_event)
     {
         CameraState &cam = camera_state();
-        // Gate on the offset's effective active state (so free-look also works when a forced-TPV state
-        // turned the offset on without the manual toggle), the orbit toggle, the cursor-shown flag (so a
-        // UI being up holds the orbit instead of letting cursor motion turn it), and the shared UI gate
-        // so the cursor and look work normally while a suppressed UI is up. Returning false here leaves
-        // orbit_yaw/orbit_pitch untouched, so the camera resumes from the same angle when the UI closes.
+        // Gate on orbit_capture_gate -- the offset's effective active state (so free-look also works when a
+        // forced-TPV state turned the offset on without the manual toggle), the cursor-shown flag (so a UI being
+        // up holds the orbit instead of letting cursor motion turn it) and the shared UI gate, folded together by
+        // the frustum detour each frame -- and on the orbit toggle itself, read live so a toggle-off stops capture
+        // on the very next event. Returning false here leaves orbit_yaw/orbit_pitch untouched, so the camera
+        // resumes from the same angle when the UI closes.
         // orbit_active is the single source of truth for whether free-look captures input. The
         // OrbitExcludeState policy turns it off when ENTERING a listed state (edge-triggered, see
         // apply_orbit_exclude_policy), so capture stops there without forbidding a manual re-enable: a
         // player who toggles free-look back on in an excluded state (e.g. for a photo on a mount) still
-        // gets mouse-look here. The cursor-shown gate freezes the orbit while any UI cursor is up.
-        if (!s_offset_active.load(std::memory_order_relaxed) || !cam.orbit_active.load(std::memory_order_relaxed) ||
-            s_cursor_shown.load(std::memory_order_relaxed) || !should_apply_view())
+        // gets mouse-look here.
+        if (!detour_hot_block().orbit_capture_gate.load(std::memory_order_relaxed) ||
+            !cam.orbit_active.load(std::memory_order_relaxed))
         {
             return false;
         }
@@ -2561,64 +3604,60 @@ namespace TPVCamera
             return false;
         }
 
-        const int32_t type = *reinterpret_cast<const int32_t *>(input_event + Constants::INPUT_EVENT_TYPE_OFFSET);
-        const int32_t id = *reinterpret_cast<const int32_t *>(input_event + Constants::INPUT_EVENT_ID_OFFSET);
         // The look channel is the eIS_Changed (analog-axis-moved) state. Mouse AND gamepad both post here; the
         // keyId picks the axis and the device. Everything else (movement axes, buttons, clicks) falls through.
-        if (type == Constants::MOUSE_INPUT_TYPE_ID)
+        const int32_t type = *reinterpret_cast<const int32_t *>(input_event + Constants::INPUT_EVENT_TYPE_OFFSET);
+        if (type != Constants::MOUSE_INPUT_TYPE_ID)
         {
-            const float value = *reinterpret_cast<const float *>(input_event + Constants::INPUT_EVENT_VALUE_OFFSET);
-
-            // Mouse look: relative DELTA accumulated straight into the orbit angle (one event = one nudge).
-            if (id == Constants::INPUT_LOOK_YAW_EVENT_ID || id == Constants::INPUT_LOOK_PITCH_EVENT_ID)
-            {
-                if (id == Constants::INPUT_LOOK_YAW_EVENT_ID)
-                {
-                    // Negated so mouse-left orbits the camera left and mouse-right orbits right; a negative X
-                    // sensitivity inverts that.
-                    const float sensitivity_x = settings().orbit_sensitivity_x.load(std::memory_order_relaxed);
-                    cam.orbit_yaw.store(cam.orbit_yaw.load(std::memory_order_relaxed) - value * sensitivity_x,
-                                        std::memory_order_relaxed);
-                }
-                else
-                {
-                    // Mouse-up raises the camera, mouse-down lowers it; a negative Y sensitivity inverts that.
-                    const float sensitivity_y = settings().orbit_sensitivity_y.load(std::memory_order_relaxed);
-                    const float pitch = cam.orbit_pitch.load(std::memory_order_relaxed) + value * sensitivity_y;
-                    cam.orbit_pitch.store(std::clamp(pitch, settings().orbit_pitch_min.load(std::memory_order_relaxed),
-                                                     settings().orbit_pitch_max.load(std::memory_order_relaxed)),
-                                          std::memory_order_relaxed);
-                }
-                return true; // block ONLY the look so the player look stays put while free-looking
-            }
-
-            // Gamepad RIGHT STICK: latch the held DEFLECTION (-1..1) for the orbit rate integration, then ZERO
-            // the event value IN PLACE and let it PASS (do NOT block). A held analog stick drives an engine
-            // look-RATE that the engine only zeroes on a release event. BLOCKING swallows that release: if orbit
-            // engages while the stick is already deflected (e.g. you hold the right stick then toggle orbit, or an
-            // exclude state suspends/restores orbit mid-deflection), the engine keeps its last rate and SPINS the
-            // player look forever -- surviving a switch to first person and curable only by a hard input flush
-            // (menu / alt-tab). It is the same swallowed-release defect as the move latch, but stranding the
-            // ENGINE's own gamepad look. Zeroing the value instead means the engine continuously sees no
-            // deflection (so it never turns and never strands) while we keep the real value for the orbit camera;
-            // the release reaches the engine too. The mouse path above can still hard-block: a mouse delta is a
-            // one-shot nudge with no held rate, so there is nothing to strand. Left stick (movement) keeps its own
-            // ids and passes untouched.
-            if (id == Constants::INPUT_PAD_LOOK_YAW_EVENT_ID)
-            {
-                cam.orbit_pad_yaw.store(value, std::memory_order_relaxed);
-                *reinterpret_cast<float *>(input_event + Constants::INPUT_EVENT_VALUE_OFFSET) = 0.0f;
-                return false;
-            }
-            if (id == Constants::INPUT_PAD_LOOK_PITCH_EVENT_ID)
-            {
-                cam.orbit_pad_pitch.store(value, std::memory_order_relaxed);
-                *reinterpret_cast<float *>(input_event + Constants::INPUT_EVENT_VALUE_OFFSET) = 0.0f;
-                return false;
-            }
+            return false;
         }
-
-        return false; // pass movement, interaction and everything else through
+        const int32_t id = *reinterpret_cast<const int32_t *>(input_event + Constants::INPUT_EVENT_ID_OFFSET);
+        const OrbitInputAction action = orbit_input_action(id);
+        if (action == OrbitInputAction::Pass)
+        {
+            return false; // pass movement, interaction and everything else through
+        }
+
+        auto *value_ptr = reinterpret_cast<float *>(input_event + Constants::INPUT_EVENT_VALUE_OFFSET);
+        const float value = *value_ptr;
+        switch (action)
+        {
+        case OrbitInputAction::MouseYaw:
+            // Mouse look: relative DELTA posted to the render thread's accumulator (one event = one nudge, one
+            // fetch_add). A negative X sensitivity inverts the direction.
+            cam.orbit_mouse_yaw_fx.fetch_add(orbit_delta_to_fixed(value * orbit_input_settings().orbit_yaw_scale),
+                                             std::memory_order_relaxed);
+            return true; // block ONLY the look so the player look stays put while free-looking
+        case OrbitInputAction::MousePitch:
+            // Mouse-up raises the camera, mouse-down lowers it; a negative Y sensitivity inverts that. The pitch
+            // limits are applied when the render hook drains the sum.
+            cam.orbit_mouse_pitch_fx.fetch_add(orbit_delta_to_fixed(value * orbit_input_settings().orbit_pitch_scale),
+                                               std::memory_order_relaxed);
+            return true;
+        // Gamepad RIGHT STICK: latch the held DEFLECTION (-1..1) for the orbit rate integration, then ZERO
+        // the event value IN PLACE and let it PASS (do NOT block). A held analog stick drives an engine
+        // look-RATE that the engine only zeroes on a release event. BLOCKING swallows that release: if orbit
+        // engages while the stick is already deflected (e.g. you hold the right stick then toggle orbit, or an
+        // exclude state suspends/restores orbit mid-deflection), the engine keeps its last rate and SPINS the
+        // player look forever -- surviving a switch to first person and curable only by a hard input flush
+        // (menu / alt-tab). It is the same swallowed-release defect as the move latch, but stranding the
+        // ENGINE's own gamepad look. Zeroing the value instead means the engine continuously sees no
+        // deflection (so it never turns and never strands) while we keep the real value for the orbit camera;
+        // the release reaches the engine too. The mouse path above can still hard-block: a mouse delta is a
+        // one-shot nudge with no held rate, so there is nothing to strand. Left stick (movement) keeps its own
+        // ids and passes untouched.
+        case OrbitInputAction::PadYaw:
+            cam.orbit_pad_yaw.store(value, std::memory_order_relaxed);
+            *value_ptr = 0.0f;
+            return false;
+        case OrbitInputAction::PadPitch:
+            cam.orbit_pad_pitch.store(value, std::memory_order_relaxed);
+            *value_ptr = 0.0f;
+            return false;
+        case OrbitInputAction::Pass:
+            break;
+        }
+        return false;
     }
 
     /**
@@ -2636,9 +3675,10 @@ namespace TPVCamera
             block = false; // on any fault, fall back to normal dispatch
         }
 
-        if (!block && s_input_dispatch_original)
+        const InputDispatchFunc original = input_dispatch_original();
+        if (!block && original)
         {
-            s_input_dispatch_original(controller, input_event, flag);
+            original(controller, input_event, flag);
         }
     }
 
@@ -2671,7 +3711,7 @@ namespace TPVCamera
         return fallback;
     }
 
-    bool initialize_camera(uintptr_t module_base, size_t module_size)
+    bool initialize_camera(uintptr_t module_base)
     {
         DMK::Logger &logger = DMK::Logger::get_instance();
 
@@ -2682,18 +3722,21 @@ namespace TPVCamera
         cam.applying.store(false);
         cam.zoom_offset.store(0.0f);
 
+        // The hot block was pre-faulted by the caller (it also holds the game image range); construct the
+        // settings copy in it before the frustum hook can read it.
+        DetourHotBlock &hot = detour_hot_block();
+        ::new (static_cast<void *>(hot.render_settings)) RenderSettings{};
+
         // Resolve g_env once (patch-resilient AOB, static RVA fallback). The CView vtable is
         // identified lazily by RTTI on the first game-view camera, so nothing is resolved here.
-        s_genv_runtime = resolve_genv(module_base);
+        hot.genv = resolve_genv(module_base);
 
         // Resolve the engine ray helper for collision + aim convergence. Best-effort: on a miss
         // those features no-op (the camera still renders), so the result is intentionally discarded.
-        (void)initialize_physics_raycast(module_base, module_size, s_genv_runtime);
+        (void)initialize_physics_raycast(hot.genv);
 
-        // Resolve the 3DEngine render-octree query so the camera can also collide with render-only roofs
-        // (tent / awning canopy cloth) that carry no ray-collidable physics. Best-effort: a miss no-ops the
-        // roof render clamp, so the result is intentionally discarded.
-        (void)initialize_render_occlusion(module_base, module_size, s_genv_runtime);
+        // The 3DEngine render-octree query is resolved on the first in-world frame (warm_world_subsystems), not
+        // here: nothing consults it at the main menu, so it stays off the boot path.
 
         try
         {
@@ -2713,7 +3756,7 @@ namespace TPVCamera
             }
             auto frustum_result = hook_manager.create_inline_hook(
                 "CameraFrustumBuild", frustum_addr, reinterpret_cast<void *>(detour_frustum_build),
-                reinterpret_cast<void **>(&s_frustum_build_original), hook_config);
+                &hot.frustum_build_original, hook_config);
 
             if (!frustum_result.has_value())
             {
@@ -2732,7 +3775,7 @@ namespace TPVCamera
             {
                 auto head_result = hook_manager.create_inline_hook(
                     "SetHeadVisibility", head_addr, reinterpret_cast<void *>(detour_set_head_visibility),
-                    reinterpret_cast<void **>(&s_set_head_visibility_original), hook_config);
+                    &hot.set_head_visibility_original, hook_config);
 
                 if (!head_result.has_value())
                 {
@@ -2753,7 +3796,7 @@ namespace TPVCamera
             {
                 auto input_result = hook_manager.create_inline_hook(
                     "CameraInputDispatch", input_addr, reinterpret_cast<void *>(detour_input_dispatch),
-                    reinterpret_cast<void **>(&s_input_dispatch_original), hook_config);
+                    &hot.input_dispatch_original, hook_config);
 
                 if (!input_result.has_value())
                 {
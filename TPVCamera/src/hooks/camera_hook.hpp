@@ -36,12 +36,12 @@ namespace TPVCamera
      *          the first-person rig keeps the player head while the offset is active, and
      *          the input dispatcher for free-look orbit. The detours fast-path out while
      *          the offset is toggled off, so they are harmless when the view is first-person.
-     * @param module_base Base address of the target game module.
-     * @param module_size Size of the target game module in bytes.
+     *          Expects the detour hot block pre-faulted, with the game image range recorded in it.
+     * @param module_base Base address of the target game module (the g_env static fallback).
      * @return true if the camera hook was installed (best-effort head/input hooks may warn);
      *         false on a hard failure that should be surfaced to the caller.
      */
-    [[nodiscard]] bool initialize_camera(uintptr_t module_base, size_t module_size);
+    [[nodiscard]] bool initialize_camera(uintptr_t module_base);
 
 } // namespace TPVCamera
 
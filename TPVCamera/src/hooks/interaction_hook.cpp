@@ -99,9 +99,9 @@ namespace TPVCamera
         bool redirect_interaction_ray(uintptr_t origin, uintptr_t dir) noexcept
         {
             float px, py, pz, dx, dy, dz;
-            if (!interaction_aim_pose().load(px, py, pz, dx, dy, dz))
+            if (!interaction_aim_pose().load(AimPoseReader::LookRay, px, py, pz, dx, dy, dz))
             {
-                // No coherent valid pose (first person, or raced with an invalidate); leave the ray unchanged.
+                // No valid pose (first person, or an invalidate landed after the caller checked); leave the ray.
                 return false;
             }
 
@@ -222,7 +222,7 @@ namespace TPVCamera
                 {
                     s_last_reason = "InteractFromCamera=off";
                 }
-                else if (!interaction_aim_pose().is_valid())
+                else if (!interaction_aim_pose().is_valid(AimPoseReader::LookRay))
                 {
                     s_last_reason = "first-person (offset not engaged)";
                 }
@@ -260,9 +260,11 @@ namespace TPVCamera
         {
             s_onscreen_calls.fetch_add(1, std::memory_order_relaxed);
 
-            float ex, ey, ez, dx, dy, dz;
+            // The ray is cached per published pose (render thread), so a busy area's many candidates each cost
+            // one channel sample and the products below, with behind-camera points rejected first.
+            ReticleRay ray;
             if (a2 == 0 || a3 == nullptr || !settings().interact_from_camera.load(std::memory_order_relaxed) ||
-                !interaction_aim_pose().load(ex, ey, ez, dx, dy, dz))
+                !interaction_aim_pose().load_reticle(ray))
             {
                 return s_onscreen_original(a1, a2, a3, a4);
             }
@@ -271,13 +273,20 @@ namespace TPVCamera
             __try
             {
                 const float *p = reinterpret_cast<const float *>(a2); // candidate world interaction point
-                const float vx = p[0] - ex, vy = p[1] - ey, vz = p[2] - ez;
-                const float t = vx * dx + vy * dy + vz * dz; // projection onto the crosshair ray (unit dir)
-                if (t > 0.1f)                                // candidate must be in front of the camera
+                // Work relative to the camera: world coordinates run to thousands of metres, so a dot of p minus a
+                // dot of the origin (or |v|^2 - t^2) would cancel away the centimetres the gate decides on.
+                const float vx = p[0] - ray.origin[0], vy = p[1] - ray.origin[1], vz = p[2] - ray.origin[2];
+                // Projection onto the crosshair ray (unit dir): the candidate must be in front of the camera.
+                const float t = vx * ray.dir[0] + vy * ray.dir[1] + vz * ray.dir[2];
+                if (t > 0.1f)
                 {
-                    const float perp2 = (vx * vx + vy * vy + vz * vz) - t * t; // squared perpendicular distance
-                    const float thr = Constants::INTERACTION_ONSCREEN_RAY_PERP_MAX;
-                    if (perp2 >= 0.0f && perp2 < thr * thr)
+                    // |v x dir|^2 is the squared perpendicular distance, a sum of squares with no cancellation.
+                    const float cx = vy * ray.dir[2] - vz * ray.dir[1];
+                    const float cy = vz * ray.dir[0] - vx * ray.dir[2];
+                    const float cz = vx * ray.dir[1] - vy * ray.dir[0];
+                    const float perp2 = cx * cx + cy * cy + cz * cz;
+                    constexpr float thr = Constants::INTERACTION_ONSCREEN_RAY_PERP_MAX;
+                    if (perp2 < thr * thr)
                     {
                         a3[0] = Constants::INTERACTION_ONSCREEN_CENTER; // centered -> ranks as top selection priority
                         a3[1] = Constants::INTERACTION_ONSCREEN_CENTER;
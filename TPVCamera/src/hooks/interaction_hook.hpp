@@ -23,7 +23,8 @@ namespace TPVCamera
      *          rest of the mod is unaffected. The detours are also a no-op at runtime unless InteractFromCamera
      *          is enabled AND the third-person offset is engaged, so first person is never touched.
      * @return true if the look-ray builder hook was installed.
-     * @note Call after resolve_all_anchors(); the hook targets are read via anchor_address().
+     * @note Call after resolve_anchor_feature(AnchorFeature::InteractFromCamera); the hook targets are read via
+     *       anchor_address(). Call once.
      */
     [[nodiscard]] bool initialize_interaction_hook();
 
@@ -5,6 +5,7 @@
 
 #include "hooks/player_onaction_hook.hpp"
 #include "aob_resolver.hpp"
+#include "hot_block.hpp"
 
 #include <DetourModKit.hpp>
 
@@ -13,6 +14,7 @@
 #include <array>
 #include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <exception>
 #include <mutex>
 #include <string>
@@ -29,7 +31,12 @@ namespace TPVCamera
     using ActionDispatchFunc = uintptr_t(__fastcall *)(uintptr_t self, const char **action_name,
                                                        unsigned int activation, float value);
 
-    static ActionDispatchFunc s_action_dispatch_original = nullptr;
+    // The trampoline lives in the detour hot block (hot_block.hpp), next to the camera hooks' own.
+    [[nodiscard]] static ActionDispatchFunc action_dispatch_original() noexcept
+    {
+        return reinterpret_cast<ActionDispatchFunc>(detour_hot_block().action_dispatch_original);
+    }
+
     static std::atomic<bool> s_available{false};
 
     // Movement action names whose value magnitude signals locomotion intent, across input devices and ALL
@@ -52,6 +59,42 @@ namespace TPVCamera
     // Value-initialized to 0; relaxed atomics suffice (a one-frame-stale signal is harmless).
     static std::atomic<float> s_move_values[k_move_count]{};
 
+    // Action names arrive as interned engine strings: every dispatch of one action passes the same name pointer.
+    // Each pointer is matched against k_move_actions by string once and its verdict is kept here, so a repeat
+    // (nearly every call) costs one hash and a compare or two, and a non-movement action exits just as fast.
+    // A slot packs one sighting into a single word, so a reader never sees a half-written entry:
+    //   bits  0..47  the name pointer (plausible_userspace_ptr screens it below 2^47)
+    //   bits 48..55  the name's first byte, re-checked on a hit as a cheap guard against a recycled pointer
+    //   bits 56..63  verdict + 1 (0 = empty slot): a k_move_actions index, or k_not_movement
+    static constexpr size_t k_name_slots = 256; // power of two; the game has far fewer distinct actions
+    static constexpr size_t k_name_probe = 8;   // linear-probe limit; a crowded run falls back to the string match
+    static constexpr std::uint8_t k_not_movement = 0xFE;
+    static constexpr std::uint64_t k_name_ptr_mask = (std::uint64_t{1} << 48) - 1;
+    static std::atomic<std::uint64_t> s_name_slots[k_name_slots]{};
+
+    [[nodiscard]] static size_t name_slot_of(const char *name) noexcept
+    {
+        // Fibonacci hash of the pointer; heap strings are 16-byte aligned, so drop those bits first.
+        const auto bits = static_cast<std::uint64_t>(reinterpret_cast<uintptr_t>(name)) >> 4;
+        return static_cast<size_t>((bits * 0x9E3779B97F4A7C15ull) >> 56) & (k_name_slots - 1);
+    }
+
+    /// The string match, run once per distinct name pointer: a k_move_actions index, or k_not_movement.
+    [[nodiscard]] static std::uint8_t classify_action_name(const char *name)
+    {
+        // Building the view (one strlen) runs under the detour's SEH frame, so even a malformed engine string
+        // fails closed rather than faulting.
+        const std::string_view name_view(name);
+        for (size_t i = 0; i < k_move_count; ++i)
+        {
+            if (k_move_actions[i] == name_view)
+            {
+                return static_cast<std::uint8_t>(i);
+            }
+        }
+        return k_not_movement;
+    }
+
     bool player_onaction_available()
     {
         return s_available.load(std::memory_order_relaxed);
@@ -120,7 +163,8 @@ namespace TPVCamera
 
     /**
      * @brief Latches the movement axes from one action event. Separated from the SEH wrapper so this frame
-     *        holds no unwinding objects; the engine-owned string reads are screened before use.
+     *        holds no unwinding objects; the engine-owned string reads are screened before use. The name is
+     *        looked up by pointer in s_name_slots; only a pointer not seen before is string-matched.
      */
     static void capture_movement_input(const char **action_name, float value)
     {
@@ -134,23 +178,53 @@ namespace TPVCamera
             return;
         }
 
-        maybe_log_action_name(name);
-
-        // Latch this action's magnitude (|value|) into its own slot; player_onaction_move_magnitude takes the
-        // largest across slots. Each action owns a slot, so an independent release (value 0) does not clobber
-        // another still-held source (keyboard + stick). Digital keys report ~1 held / 0 released; an analog axis
-        // reports a signed deflection, so its magnitude is taken regardless of direction. The name is screened
-        // above; building the view here (one strlen) runs under the detour's SEH frame, so even a malformed
-        // engine string fails closed rather than faulting.
-        const std::string_view name_view(name);
-        for (size_t i = 0; i < k_move_count; ++i)
+        const auto ptr_bits = static_cast<std::uint64_t>(reinterpret_cast<uintptr_t>(name));
+        const auto first = static_cast<std::uint64_t>(static_cast<unsigned char>(name[0]));
+        const size_t home = name_slot_of(name);
+        std::uint8_t verdict = 0xFF; // not cached yet
+        size_t free_slot = k_name_slots;
+        for (size_t probe = 0; probe < k_name_probe; ++probe)
         {
-            if (k_move_actions[i] == name_view)
+            const size_t slot = (home + probe) & (k_name_slots - 1);
+            const std::uint64_t entry = s_name_slots[slot].load(std::memory_order_relaxed);
+            if (entry == 0)
             {
-                s_move_values[i].store(std::fabs(value), std::memory_order_relaxed);
+                free_slot = slot;
                 break;
             }
+            if ((entry & k_name_ptr_mask) == ptr_bits)
+            {
+                if (((entry >> 48) & 0xFF) == first)
+                {
+                    verdict = static_cast<std::uint8_t>((entry >> 56) - 1);
+                }
+                break; // a recycled pointer (first byte changed) re-runs the string match, uncached
+            }
         }
+
+        if (verdict == 0xFF)
+        {
+            // First sight of this pointer: the trace probe and the string match run here, off the hot path.
+            maybe_log_action_name(name);
+            verdict = classify_action_name(name);
+            if (free_slot != k_name_slots)
+            {
+                // A racing insert of the same pointer on another thread only costs a duplicate slot.
+                std::uint64_t expected = 0;
+                const std::uint64_t entry = ptr_bits | (first << 48) | (static_cast<std::uint64_t>(verdict + 1) << 56);
+                s_name_slots[free_slot].compare_exchange_strong(expected, entry, std::memory_order_relaxed);
+            }
+        }
+        if (verdict == k_not_movement)
+        {
+            return;
+        }
+
+        // Latch this action's magnitude (|value|) into its own slot; player_onaction_move_magnitude takes the
+        // largest across slots. Each action owns a slot, so an independent release (value 0) does not clobber
+        // another still-held source (keyboard + stick). Digital keys report ~1 held / 0 released; an analog axis
+        // reports a signed deflection, so its magnitude is taken regardless of direction.
+        s_move_values[verdict].store(std::fabs(value), std::memory_order_relaxed);
     }
 
     /**
@@ -168,7 +242,8 @@ namespace TPVCamera
         __except (EXCEPTION_EXECUTE_HANDLER)
         {
         }
-        return s_action_dispatch_original ? s_action_dispatch_original(self, action_name, activation, value) : 0;
+        const ActionDispatchFunc original = action_dispatch_original();
+        return original ? original(self, action_name, activation, value) : 0;
     }
 
     bool initialize_player_onaction_hook()
@@ -190,7 +265,7 @@ namespace TPVCamera
             const DMK::HookConfig hook_config{.prologue_policy = DMK::InlineProloguePolicy::Fail};
             auto result = hook_manager.create_inline_hook(
                 "PlayerOnActionDispatch", dispatch_addr, reinterpret_cast<void *>(detour_action_dispatch),
-                reinterpret_cast<void **>(&s_action_dispatch_original), hook_config);
+                &detour_hot_block().action_dispatch_original, hook_config);
 
             if (!result.has_value())
             {
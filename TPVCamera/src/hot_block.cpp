@@ -0,0 +1,46 @@
+/**
+ * @file hot_block.cpp
+ * @brief Storage, layout checks and pre-faulting of the detours' hot block (see hot_block.hpp).
+ */
+
+#include "hot_block.hpp"
+
+#include <cstddef>
+
+namespace TPVCamera
+{
+    DetourHotBlock &detour_hot_block() noexcept
+    {
+        static DetourHotBlock block;
+        return block;
+    }
+
+    void prefault_detour_hot_block() noexcept
+    {
+        // Runs before any detour is installed, so rewriting each line's first byte races nothing. The write (not a
+        // read) is what matters: reading demand-zero memory maps the shared zero page and the first store still
+        // faults.
+        auto *bytes = reinterpret_cast<volatile std::byte *>(&detour_hot_block());
+        for (std::size_t line = 0; line < k_hot_block_lines; ++line)
+        {
+            bytes[line * k_cache_line] = bytes[line * k_cache_line];
+        }
+    }
+
+    // Layout check: each per-writer group starts on a fresh line and the whole block is exactly k_hot_block_lines
+    // lines aligned to its size, so a member added to the wrong group (or a growth past the page-contained size)
+    // fails the build.
+#pragma warning(push)
+#pragma warning(disable : 4324)
+    static_assert(sizeof(DetourHotBlock) == k_hot_block_lines * k_cache_line);
+    static_assert(alignof(DetourHotBlock) == sizeof(DetourHotBlock));
+    static_assert(4096 % sizeof(DetourHotBlock) == 0, "the block must not straddle a page");
+    static_assert(offsetof(DetourHotBlock, frustum_build_original) == 0 * k_cache_line);
+    static_assert(offsetof(DetourHotBlock, ray_world_intersection) == 1 * k_cache_line);
+    static_assert(offsetof(DetourHotBlock, offset_active) == 2 * k_cache_line);
+    static_assert(offsetof(DetourHotBlock, orbit_input_version) == 3 * k_cache_line);
+    static_assert(offsetof(DetourHotBlock, render_settings) == 4 * k_cache_line);
+    static_assert(offsetof(DetourHotBlock, game_view_camera) == 7 * k_cache_line);
+#pragma warning(pop)
+
+} // namespace TPVCamera
@@ -0,0 +1,107 @@
+/**
+ * @file hot_block.hpp
+ * @brief The per-frame state of the render-thread and input detours, co-located in one page-contained block.
+ *
+ * @details detour_frustum_build, detour_set_head_visibility, detour_input_dispatch and detour_action_dispatch (and
+ *          the collision stages the frustum detour calls) used to reach their trampolines, resolved engine entry
+ *          points, module bounds, view gates and settings copy through statics spread over four translation units,
+ *          so an engaged frame touched a line -- and often a page -- per module. They now live here, in one block
+ *          of cache lines aligned to its own size, so it never straddles a page: a frame touches one page
+ *          and the same k_hot_block_lines lines, whatever the link order.
+ *
+ *          Lines are grouped by WRITER, like CameraState: the resolved line is written at init (before the hooks
+ *          are enabled) and on the first in-world frame, the gate line by the render thread once per frame, the
+ *          input line by the input thread when the preset moved, the settings lines by the render thread when a
+ *          version moved, and the game-view latch by the render thread on every frustum-builder call (it is the
+ *          only line no other thread reads). hot_block.cpp static_asserts the boundaries.
+ *
+ *          The block is zero-initialized static storage, so its page is demand-zero until first written;
+ *          prefault_detour_hot_block() writes every line once during init, before the first hook is created, so
+ *          the first game-view frame does not take that page fault (and the copy-on-write fault after it) inside a
+ *          detour.
+ */
+#ifndef TPVCAMERA_HOT_BLOCK_HPP
+#define TPVCAMERA_HOT_BLOCK_HPP
+
+#include "global_state.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace TPVCamera
+{
+    /// Bytes reserved for camera_hook.cpp's RenderSettings copy (it owns the type; it static_asserts the fit).
+    inline constexpr std::size_t k_hot_render_settings_bytes = 3 * k_cache_line;
+    /// Cache lines in the block. It is aligned to its size, so it always sits inside one page.
+    inline constexpr std::size_t k_hot_block_lines = 8;
+
+#pragma warning(push)
+#pragma warning(disable : 4324) // structure padded due to alignment specifier: the per-writer padding is the point
+    /**
+     * @brief Hot state of the detours. Trampolines and entry points are stored untyped; each owning module casts
+     *        back to its own function type.
+     */
+    struct alignas(k_hot_block_lines * k_cache_line) DetourHotBlock
+    {
+        // ---- Resolved: written at init before the hooks are enabled (cview_vtable once, on the first game-view
+        //      frame), read on every detour call ----
+        alignas(k_cache_line) void *frustum_build_original{nullptr};
+        void *set_head_visibility_original{nullptr};
+        void *input_dispatch_original{nullptr};
+        void *action_dispatch_original{nullptr};
+        std::uintptr_t genv{0};      // SSystemGlobalEnvironment base
+        std::uintptr_t module_lo{0}; // game image [module_lo, module_hi)
+        std::uintptr_t module_hi{0};
+        std::uintptr_t cview_vtable{0}; // CView vtable, cached by RTTI on the first game-view camera
+
+        // ---- Collision entry points: written at init (ray) and on the first in-world frame (octree), read by
+        //      the collision stages of every engaged frame (render thread) ----
+        alignas(k_cache_line) void *ray_world_intersection{nullptr};
+        std::uintptr_t physical_world_slot{0}; // g_env + PHYSICAL_WORLD_OFFSET
+        void *get_objects_in_box{nullptr};
+        std::uintptr_t p3d_engine_slot{0}; // g_env + GENV_3DENGINE_OFFSET
+
+        // ---- Render thread -> detours: the per-frame view gates, and the head-setter latch ----
+        alignas(k_cache_line) std::atomic<bool> offset_active{false};
+        std::atomic<bool> cursor_shown{false};
+        std::atomic<bool> orbit_capture_gate{false};
+        std::atomic<bool> head_was_active{false};
+        std::atomic<bool> game_intended_hide_head{false};
+        std::atomic<std::uint8_t> head_flags{0};
+        std::atomic<std::uintptr_t> head_entity{0};
+
+        // ---- Input thread: the mouse-orbit multipliers (see orbit_input_settings in camera_hook.cpp) ----
+        alignas(k_cache_line) std::uint32_t orbit_input_version{~0u};
+        float orbit_yaw_scale{0.0f};
+        float orbit_pitch_scale{0.0f};
+
+        // ---- Render thread: storage of the RenderSettings copy, constructed by initialize_camera ----
+        alignas(k_cache_line) std::byte render_settings[k_hot_render_settings_bytes]{};
+
+        // ---- Render thread only: the game-view camera latch (see is_game_view_camera in camera_hook.cpp). Written
+        //      on every frustum-builder call, so it shares its line with nothing another thread reads ----
+        alignas(k_cache_line) std::uintptr_t game_view_camera{0}; // camera of the latched CView; 0 = none
+        std::int64_t game_view_seen_ticks{0};                     // FrameClock::now() when it was last seen
+    };
+#pragma warning(pop)
+
+    /** @brief Returns the detours' hot block. */
+    [[nodiscard]] DetourHotBlock &detour_hot_block() noexcept;
+
+    /**
+     * @brief Writes every line of the block once so its page is committed before the hooks go live.
+     * @details Call from the init thread before any detour can run (TPVCamera::init does, ahead of the hooks).
+     */
+    void prefault_detour_hot_block() noexcept;
+
+    /** @brief True when @p address lies inside the game image recorded in the hot block. */
+    [[nodiscard]] inline bool in_game_module(std::uintptr_t address) noexcept
+    {
+        const DetourHotBlock &hot = detour_hot_block();
+        return address >= hot.module_lo && address < hot.module_hi;
+    }
+
+} // namespace TPVCamera
+
+#endif // TPVCAMERA_HOT_BLOCK_HPP
@@ -0,0 +1,347 @@
+/**
+ * @file multi_scan.cpp
+ * @brief Pattern compiler and the scalar / AVX2 single-pass scan loops (see multi_scan.hpp).
+ */
+
+#include "multi_scan.hpp"
+#include "vertex_kernels.hpp"
+
+#include <intrin.h>
+#include <immintrin.h>
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <vector>
+
+namespace TPVCamera::MultiScan
+{
+
+    namespace
+    {
+        /**
+         * @brief Rough frequency rank of a byte in x64 MSVC code (higher = more common).
+         * @details Only the ordering matters: it steers each pattern's key away from REX prefixes, the mov / lea /
+         *          call opcodes, ModRM bytes of stack addressing, int3 padding and 00 / FF immediates, toward the
+         *          displacement and immediate bytes that make a pattern distinctive.
+         */
+        [[nodiscard]] int byte_cost(std::uint8_t b) noexcept
+        {
+            switch (b)
+            {
+            case 0x00:
+            case 0xFF:
+            case 0xCC:
+                return 12;
+            case 0x48:
+            case 0x8B:
+            case 0x89:
+                return 10;
+            case 0x24:
+            case 0x4C:
+            case 0xE8:
+            case 0x0F:
+            case 0x44:
+            case 0x8D:
+            case 0x83:
+                return 8;
+            case 0x85:
+            case 0xC0:
+            case 0x74:
+            case 0x75:
+            case 0x01:
+            case 0x10:
+            case 0x20:
+            case 0x28:
+            case 0x30:
+            case 0x40:
+            case 0x41:
+            case 0x49:
+            case 0x4D:
+            case 0x5C:
+            case 0x33:
+            case 0xC3:
+            case 0xEB:
+            case 0x08:
+            case 0x18:
+            case 0x38:
+            case 0x45:
+                return 5;
+            default:
+                return 1;
+            }
+        }
+
+        struct Compiled
+        {
+            std::array<PatternByte, k_max_pattern> bytes{};
+            std::size_t size = 0;
+            std::size_t key_offset = 0; // offset of the key's first byte within the pattern
+        };
+
+        /// A deduplicated key: byte b0 at some position, optionally followed by b1. Shared by every member pattern.
+        struct Key
+        {
+            std::uint8_t b0 = 0;
+            std::uint8_t b1 = 0;
+            bool has_b1 = false;
+            std::vector<std::uint32_t> members; // indices into the compiled list
+        };
+
+        /// Picks the rarest adjacent fixed pair; falls back to the rarest single fixed byte. False if all wildcards.
+        [[nodiscard]] bool choose_key(const Compiled &c, std::uint8_t &b0, std::uint8_t &b1, bool &has_b1,
+                                      std::size_t &offset) noexcept
+        {
+            int best = 1 << 30;
+            for (std::size_t i = 0; i + 1 < c.size; ++i)
+            {
+                if (c.bytes[i].fixed && c.bytes[i + 1].fixed)
+                {
+                    const int cost = byte_cost(c.bytes[i].value) + byte_cost(c.bytes[i + 1].value);
+                    if (cost < best)
+                    {
+                        best = cost;
+                        offset = i;
+                        b0 = c.bytes[i].value;
+                        b1 = c.bytes[i + 1].value;
+                        has_b1 = true;
+                    }
+                }
+            }
+            if (best != (1 << 30))
+            {
+                return true;
+            }
+            for (std::size_t i = 0; i < c.size; ++i)
+            {
+                if (c.bytes[i].fixed && byte_cost(c.bytes[i].value) < best)
+                {
+                    best = byte_cost(c.bytes[i].value);
+                    offset = i;
+                    b0 = c.bytes[i].value;
+                    has_b1 = false;
+                }
+            }
+            return best != (1 << 30);
+        }
+
+        /// Full compare of every member of @p key whose key byte sits at @p at.
+        void verify(const Key &key, std::uintptr_t at, std::uintptr_t lo, std::uintptr_t hi,
+                    const std::vector<Compiled> &compiled, std::span<Hits> hits) noexcept
+        {
+            for (const std::uint32_t m : key.members)
+            {
+                const Compiled &c = compiled[m];
+                if (at - lo < c.key_offset)
+                {
+                    continue; // would start before the range
+                }
+                const std::uintptr_t start = at - c.key_offset;
+                if (c.size > hi - start || !matches_at(c.bytes.data(), c.size, start))
+                {
+                    continue;
+                }
+                Hits &h = hits[m];
+                if (h.count == 0 || start < h.first)
+                {
+                    h.first = start;
+                }
+                if (h.count < 2)
+                {
+                    ++h.count;
+                }
+            }
+        }
+
+        // Key test at one position: b0 at p, and b1 at p + 1 when the key has one.
+        [[nodiscard]] bool key_at(const Key &key, const std::uint8_t *p, const std::uint8_t *end) noexcept
+        {
+            if (p[0] != key.b0)
+            {
+                return false;
+            }
+            return !key.has_b1 || (p + 1 < end && p[1] == key.b1);
+        }
+
+        // Every key whose first byte is *p, tested at p and fully verified on a key hit.
+        void test_position(const std::uint8_t *p, std::uintptr_t lo, std::uintptr_t hi, const std::vector<Key> &keys,
+                           const std::array<std::vector<std::uint32_t>, 256> &by_b0,
+                           const std::vector<Compiled> &compiled, std::span<Hits> hits) noexcept
+        {
+            const auto *end = reinterpret_cast<const std::uint8_t *>(hi);
+            for (const std::uint32_t k : by_b0[*p])
+            {
+                if (key_at(keys[k], p, end))
+                {
+                    verify(keys[k], reinterpret_cast<std::uintptr_t>(p), lo, hi, compiled, hits);
+                }
+            }
+        }
+
+        void scan_scalar(std::uintptr_t lo, std::uintptr_t from, std::uintptr_t hi, const std::vector<Key> &keys,
+                         const std::array<std::vector<std::uint32_t>, 256> &by_b0,
+                         const std::vector<Compiled> &compiled, std::span<Hits> hits) noexcept
+        {
+            const auto *end = reinterpret_cast<const std::uint8_t *>(hi);
+            for (auto *p = reinterpret_cast<const std::uint8_t *>(from); p < end; ++p)
+            {
+                test_position(p, lo, hi, keys, by_b0, compiled, hits);
+            }
+        }
+
+        // Returns the first position NOT covered (the caller finishes the tail scalar). One pass for every key: key k
+        // owns bucket bit (k % 8), set in a low-nibble and a high-nibble table at its b0 (and, in a second pair, at
+        // its b1, or at every nibble when it has none). Per 32-byte block four shuffles look up both bytes of every
+        // position, and a position is a candidate when some bucket matched both; the block costs the same for one
+        // key or fifty. Candidates (true hits plus bucket / nibble collisions) are settled by the scalar key test.
+        // The p+1 load needs one byte past the block, hence the 33-byte bound.
+        std::uintptr_t scan_avx2(std::uintptr_t lo, std::uintptr_t hi, const std::vector<Key> &keys,
+                                 const std::array<std::vector<std::uint32_t>, 256> &by_b0,
+                                 const std::vector<Compiled> &compiled, std::span<Hits> hits) noexcept
+        {
+            alignas(16) std::uint8_t lo0[16] = {}, hi0[16] = {}, lo1[16] = {}, hi1[16] = {};
+            for (std::size_t k = 0; k < keys.size(); ++k)
+            {
+                const auto bit = static_cast<std::uint8_t>(1u << (k % 8));
+                lo0[keys[k].b0 & 0x0F] |= bit;
+                hi0[keys[k].b0 >> 4] |= bit;
+                for (int n = 0; n < 16; ++n)
+                {
+                    const bool any = !keys[k].has_b1;
+                    lo1[n] |= (any || (keys[k].b1 & 0x0F) == n) ? bit : 0;
+                    hi1[n] |= (any || (keys[k].b1 >> 4) == n) ? bit : 0;
+                }
+            }
+            const auto table = [](const std::uint8_t *t)
+            { return _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(t))); };
+            const __m256i t_lo0 = table(lo0), t_hi0 = table(hi0), t_lo1 = table(lo1), t_hi1 = table(hi1);
+            const __m256i nibble = _mm256_set1_epi8(0x0F);
+            const auto buckets = [&](__m256i v, __m256i t_lo, __m256i t_hi)
+            {
+                const __m256i l = _mm256_shuffle_epi8(t_lo, _mm256_and_si256(v, nibble));
+                const __m256i h = _mm256_shuffle_epi8(t_hi, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+                return _mm256_and_si256(l, h);
+            };
+
+            std::uintptr_t pos = lo;
+            for (; hi - pos >= 33; pos += 32)
+            {
+                const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pos));
+                const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pos + 1));
+                const __m256i both = _mm256_and_si256(buckets(v0, t_lo0, t_hi0), buckets(v1, t_lo1, t_hi1));
+                std::uint32_t mask = ~static_cast<std::uint32_t>(
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(both, _mm256_setzero_si256())));
+                while (mask != 0)
+                {
+                    const int bit = std::countr_zero(mask);
+                    mask &= mask - 1;
+                    test_position(reinterpret_cast<const std::uint8_t *>(pos + bit), lo, hi, keys, by_b0, compiled,
+                                  hits);
+                }
+            }
+            _mm256_zeroupper();
+            return pos;
+        }
+
+    } // namespace
+
+    std::size_t parse_pattern(std::string_view text, std::array<PatternByte, k_max_pattern> &out) noexcept
+    {
+        std::size_t n = 0;
+        std::size_t i = 0;
+        while (i < text.size())
+        {
+            if (text[i] == ' ')
+            {
+                ++i;
+                continue;
+            }
+            std::size_t j = i;
+            while (j < text.size() && text[j] != ' ')
+            {
+                ++j;
+            }
+            const std::string_view token = text.substr(i, j - i);
+            i = j;
+            if (n == out.size())
+            {
+                return 0;
+            }
+            if (token == "?" || token == "??")
+            {
+                out[n++] = {0, false};
+                continue;
+            }
+            unsigned value = 0;
+            const auto [end, ec] = std::from_chars(token.data(), token.data() + token.size(), value, 16);
+            if (ec != std::errc{} || end != token.data() + token.size() || value > 0xFF)
+            {
+                return 0;
+            }
+            out[n++] = {static_cast<std::uint8_t>(value), true};
+        }
+        return n;
+    }
+
+    bool matches_at(const PatternByte *pattern, std::size_t n, std::uintptr_t at) noexcept
+    {
+        const auto *bytes = reinterpret_cast<const std::uint8_t *>(at);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (pattern[i].fixed && bytes[i] != pattern[i].value)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void scan(std::span<const std::string_view> patterns,
+              std::span<const std::pair<std::uintptr_t, std::uintptr_t>> ranges, std::span<Hits> hits)
+    {
+        std::vector<Compiled> compiled(patterns.size());
+        std::vector<Key> keys;
+        for (std::size_t i = 0; i < patterns.size(); ++i)
+        {
+            Compiled &c = compiled[i];
+            c.size = parse_pattern(patterns[i], c.bytes);
+            std::uint8_t b0 = 0, b1 = 0;
+            bool has_b1 = false;
+            if (c.size == 0 || !choose_key(c, b0, b1, has_b1, c.key_offset))
+            {
+                continue;
+            }
+            auto it = std::find_if(keys.begin(), keys.end(), [&](const Key &k)
+                                   { return k.b0 == b0 && k.has_b1 == has_b1 && (!has_b1 || k.b1 == b1); });
+            if (it == keys.end())
+            {
+                keys.push_back({b0, b1, has_b1, {}});
+                it = keys.end() - 1;
+            }
+            it->members.push_back(static_cast<std::uint32_t>(i));
+        }
+        if (keys.empty())
+        {
+            return;
+        }
+
+        std::array<std::vector<std::uint32_t>, 256> by_b0{};
+        for (std::size_t k = 0; k < keys.size(); ++k)
+        {
+            by_b0[keys[k].b0].push_back(static_cast<std::uint32_t>(k));
+        }
+
+        // The AVX2 CPU / OS check is shared with the vertex kernels (one CPUID probe per process).
+        const bool avx2 = VertexKernels::avx2_active();
+        for (const auto &[lo, hi] : ranges)
+        {
+            if (hi <= lo)
+            {
+                continue;
+            }
+            const std::uintptr_t tail = avx2 ? scan_avx2(lo, hi, keys, by_b0, compiled, hits) : lo;
+            scan_scalar(lo, tail, hi, keys, by_b0, compiled, hits);
+        }
+    }
+
+} // namespace TPVCamera::MultiScan
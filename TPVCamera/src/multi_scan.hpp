@@ -0,0 +1,70 @@
+/**
+ * @file multi_scan.hpp
+ * @brief One-pass, multi-pattern AOB scanner for the startup anchor cascades.
+ *
+ * @details resolve_all_anchors has a few dozen candidate patterns across its cascades. Handing each anchor to the
+ *          DMK cascade scanner walks the image once per candidate, so cold-start cost grows with every anchor a
+ *          feature adds. This scanner compiles every pattern up front: each one is keyed on its rarest pair of
+ *          adjacent fixed bytes (ranked by a static x86-64 byte-frequency table, so the hot 48 8B / 00 / FF bytes
+ *          are avoided), and the keys are deduplicated. One pass over each code range then tests every key at
+ *          once -- 32 positions per step with an AVX2 nibble-table filter whose cost does not grow with the key
+ *          count, or a first-byte bucket table on the scalar path -- and only a key hit pays a full pattern compare
+ *          against the patterns sharing it.
+ *
+ *          Matching follows the DMK cascade rules the candidate tables were written for: "??" / "?" tokens are
+ *          wildcards, and a pattern's hit count is kept (saturating at 2) so the caller can apply require_unique.
+ *          Reads the ranges directly (they must be committed, readable image code); setup-path only, allocates.
+ */
+#ifndef TPVCAMERA_MULTI_SCAN_HPP
+#define TPVCAMERA_MULTI_SCAN_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace TPVCamera::MultiScan
+{
+
+    /// Longest pattern accepted, in bytes.
+    inline constexpr std::size_t k_max_pattern = 128;
+
+    /// One parsed pattern byte: value plus whether it must match (false for a wildcard).
+    struct PatternByte
+    {
+        std::uint8_t value = 0;
+        bool fixed = false;
+    };
+
+    /**
+     * @brief Parses a space-separated "48 8B ?? 05" pattern.
+     * @return The byte count, or 0 if the text is malformed, empty, or longer than k_max_pattern.
+     */
+    [[nodiscard]] std::size_t parse_pattern(std::string_view text,
+                                            std::array<PatternByte, k_max_pattern> &out) noexcept;
+
+    /// Whether the @p n parsed bytes match the memory at @p at (the caller guarantees the range is readable).
+    [[nodiscard]] bool matches_at(const PatternByte *pattern, std::size_t n, std::uintptr_t at) noexcept;
+
+    /** @brief Per-pattern scan result. count saturates at 2 (enough to tell unique from ambiguous). */
+    struct Hits
+    {
+        std::uint32_t count = 0;
+        std::uintptr_t first = 0; // lowest match address, valid when count > 0
+    };
+
+    /**
+     * @brief Scans every range once for every pattern, accumulating into @p hits (one entry per pattern).
+     * @details A pattern that fails to parse never matches. Matches must lie wholly inside one range.
+     * @param patterns Pattern texts.
+     * @param ranges [lo, hi) address ranges, e.g. the image's executable sections.
+     * @param hits Output, same length as @p patterns; not cleared, so repeated calls accumulate.
+     */
+    void scan(std::span<const std::string_view> patterns,
+              std::span<const std::pair<std::uintptr_t, std::uintptr_t>> ranges, std::span<Hits> hits);
+
+} // namespace TPVCamera::MultiScan
+
+#endif // TPVCAMERA_MULTI_SCAN_HPP
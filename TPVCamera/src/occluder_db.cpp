@@ -0,0 +1,450 @@
+/**
+ * @file occluder_db.cpp
+ * @brief Memory-mapped brush-mesh database persisted next to the INI (see occluder_db.hpp).
+ */
+
+#include "occluder_db.hpp"
+#include "constants.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <windows.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace TPVCamera::OccluderDb
+{
+
+    namespace
+    {
+        constexpr std::uint32_t k_db_magic = 0x4F565054; // "TPVO"
+        constexpr std::uint32_t k_db_version = 1;
+        // Cap on the file (about 3 MB); a save past it keeps the records already on disk and drops new ones.
+        constexpr std::uint32_t k_max_records = 65536;
+        // New records one session can hold for save(); a town and its surroundings is a few hundred meshes.
+        constexpr std::uint32_t k_learn_capacity = 4096;
+
+        /// File header; the records follow, sorted by (path_hash, n_verts, n_indices) for the binary search.
+        struct FileHeader
+        {
+            std::uint32_t magic = k_db_magic;
+            std::uint32_t version = k_db_version;
+            std::uint32_t record_size = 0;
+            std::uint32_t count = 0;
+        };
+
+        /// One root mesh. Plain little-endian POD; a layout change bumps k_db_version.
+        struct FileRecord
+        {
+            std::uint64_t path_hash;
+            std::uint32_t n_verts;
+            std::uint32_t n_indices;
+            float local_min[3];
+            float local_max[3];
+            std::uint32_t flags;
+            std::uint32_t reserved;
+        };
+        static_assert(sizeof(FileRecord) == 48);
+
+        [[nodiscard]] bool key_less(const FileRecord &a, std::uint64_t hash, std::uint32_t verts,
+                                    std::uint32_t indices) noexcept
+        {
+            if (a.path_hash != hash)
+            {
+                return a.path_hash < hash;
+            }
+            if (a.n_verts != verts)
+            {
+                return a.n_verts < verts;
+            }
+            return a.n_indices < indices;
+        }
+
+        [[nodiscard]] bool record_less(const FileRecord &a, const FileRecord &b) noexcept
+        {
+            return key_less(a, b.path_hash, b.n_verts, b.n_indices);
+        }
+
+        [[nodiscard]] bool same_key(const FileRecord &a, const FileRecord &b) noexcept
+        {
+            return a.path_hash == b.path_hash && a.n_verts == b.n_verts && a.n_indices == b.n_indices;
+        }
+
+        // The published mapping. open() fills s_view and then publishes it; save() retracts it and waits for the
+        // render thread's find() to leave before unmapping.
+        struct View
+        {
+            const void *base = nullptr;
+            const FileRecord *records = nullptr;
+            std::uint32_t count = 0;
+        };
+        View s_view;
+        std::atomic<const View *> s_published{nullptr};
+        std::atomic<std::uint32_t> s_readers{0};
+
+        // Render thread appends, publishing each record with a release store of the count; save() reads the prefix.
+        FileRecord s_learned[k_learn_capacity];
+        std::atomic<std::uint32_t> s_learned_count{0};
+
+        // Open-addressed index over s_learned (1 + record index, 0 = empty; at most half full), so find() also
+        // answers for meshes measured earlier this session and a level reload neither re-measures nor re-learns
+        // them. Render thread only.
+        constexpr std::uint32_t k_learn_slots = k_learn_capacity * 2;
+        static_assert((k_learn_slots & (k_learn_slots - 1)) == 0 && k_learn_capacity < 0xFFFF);
+        std::uint16_t s_learned_index[k_learn_slots];
+
+        // Set once open() has seen the file missing or mapped it; save() never rewrites a file it could not read.
+        bool s_opened = false;
+
+        std::atomic<std::uint64_t> s_seeded{0};
+        std::atomic<std::uint64_t> s_scanned{0};
+
+        [[nodiscard]] std::string db_path()
+        {
+            return DMK::Filesystem::get_runtime_directory_utf8() + "\\" + Constants::get_occluder_db_filename();
+        }
+
+        [[nodiscard]] std::wstring widen(const std::string &utf8)
+        {
+            const int n = MultiByteToWideChar(CP_UTF8, 0, utf8.data(), static_cast<int>(utf8.size()), nullptr, 0);
+            std::wstring out(static_cast<std::size_t>(n > 0 ? n : 0), L'\0');
+            if (n > 0)
+            {
+                MultiByteToWideChar(CP_UTF8, 0, utf8.data(), static_cast<int>(utf8.size()), out.data(), n);
+            }
+            return out;
+        }
+
+        /// The records of a mapped file of @p size bytes at @p base, or nullptr when it is foreign, torn or unsorted.
+        [[nodiscard]] const FileRecord *validate(const void *base, std::uint64_t size, std::uint32_t &count)
+        {
+            if (size < sizeof(FileHeader))
+            {
+                return nullptr;
+            }
+            FileHeader header;
+            std::memcpy(&header, base, sizeof(header));
+            if (header.magic != k_db_magic || header.version != k_db_version ||
+                header.record_size != sizeof(FileRecord) || header.count > k_max_records ||
+                size != sizeof(FileHeader) + static_cast<std::uint64_t>(header.count) * sizeof(FileRecord))
+            {
+                return nullptr;
+            }
+            const auto *records = reinterpret_cast<const FileRecord *>(static_cast<const std::byte *>(base) +
+                                                                       sizeof(FileHeader));
+            for (std::uint32_t i = 1; i < header.count; ++i)
+            {
+                if (!record_less(records[i - 1], records[i]))
+                {
+                    return nullptr; // the binary search needs strictly ascending keys
+                }
+            }
+            count = header.count;
+            return records;
+        }
+
+        [[nodiscard]] std::uint32_t learned_slot(std::uint64_t hash, std::uint32_t verts,
+                                                 std::uint32_t indices) noexcept
+        {
+            const std::uint64_t h = (hash ^ (std::uint64_t{verts} << 32 | indices)) * 0x9E3779B97F4A7C15ull;
+            return static_cast<std::uint32_t>(h >> 40) & (k_learn_slots - 1);
+        }
+
+        /// The session's record of the key, or nullptr. Leaves @p slot at the match or at the empty slot ending
+        /// the probe, where learn() inserts.
+        [[nodiscard]] const FileRecord *find_learned(std::uint64_t hash, std::uint32_t verts, std::uint32_t indices,
+                                                     std::uint32_t &slot) noexcept
+        {
+            for (slot = learned_slot(hash, verts, indices);; slot = (slot + 1) & (k_learn_slots - 1))
+            {
+                const std::uint16_t entry = s_learned_index[slot];
+                if (entry == 0)
+                {
+                    return nullptr;
+                }
+                const FileRecord &r = s_learned[entry - 1];
+                if (r.path_hash == hash && r.n_verts == verts && r.n_indices == indices)
+                {
+                    return &r;
+                }
+            }
+        }
+
+        /// Longest unmap() waits for a find() to leave the view: a fault inside one would otherwise hang shutdown.
+        constexpr ULONGLONG k_unmap_wait_ms = 2000;
+
+        /// Retracts the published view and unmaps it once no find() is inside it. Returns false, leaving the view
+        /// mapped, when a reader is still inside it after k_unmap_wait_ms.
+        [[nodiscard]] bool unmap()
+        {
+            const View *view = s_published.exchange(nullptr, std::memory_order_seq_cst);
+            const ULONGLONG deadline = GetTickCount64() + k_unmap_wait_ms;
+            while (s_readers.load(std::memory_order_seq_cst) != 0)
+            {
+                if (GetTickCount64() >= deadline)
+                {
+                    DMK::Logger::get_instance().warning(
+                        "Occluder database: a lookup is still inside the mapping after {} ms; leaving it mapped",
+                        k_unmap_wait_ms);
+                    return false;
+                }
+                YieldProcessor();
+            }
+            if (view != nullptr && view->base != nullptr)
+            {
+                UnmapViewOfFile(view->base);
+            }
+            s_view = View{};
+            return true;
+        }
+    } // namespace
+
+    std::uint64_t path_hash(const char *path) noexcept
+    {
+        if (path == nullptr || path[0] == '\0')
+        {
+            return 0;
+        }
+        std::uint64_t h = 0xCBF29CE484222325ull;
+        for (const char *p = path; *p != '\0'; ++p)
+        {
+            char c = *p;
+            c = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : (c == '\\' ? '/' : c);
+            h = (h ^ static_cast<std::uint8_t>(c)) * 0x100000001B3ull;
+        }
+        return h != 0 ? h : 1;
+    }
+
+    void open()
+    {
+        DMK::Logger &logger = DMK::Logger::get_instance();
+        if (s_published.load(std::memory_order_acquire) != nullptr)
+        {
+            return;
+        }
+        const std::string path = db_path();
+        const HANDLE file = CreateFileW(widen(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            s_opened = GetLastError() == ERROR_FILE_NOT_FOUND;
+            logger.debug("Occluder database: none at {}", path);
+            return;
+        }
+        LARGE_INTEGER size{};
+        const void *base = nullptr;
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+        {
+            // The mapping keeps the file referenced; the handles can close once the view exists.
+            const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+        if (base == nullptr)
+        {
+            logger.debug("Occluder database: cannot map {}", path);
+            return;
+        }
+        // Prefetch the whole mapping now, on the init thread, as one batched request: the validation below touches
+        // every record anyway, and the render thread's first lookups then hit resident pages instead of disk faults.
+        WIN32_MEMORY_RANGE_ENTRY range{const_cast<void *>(base), static_cast<SIZE_T>(size.QuadPart)};
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+        std::uint32_t count = 0;
+        const FileRecord *records = validate(base, static_cast<std::uint64_t>(size.QuadPart), count);
+        s_opened = true;
+        if (records == nullptr)
+        {
+            UnmapViewOfFile(base);
+            logger.info("Occluder database: {} is from another mod version or damaged; it will be rebuilt", path);
+            return;
+        }
+        s_view = View{base, records, count};
+        s_published.store(&s_view, std::memory_order_release);
+        logger.info("Occluder database: {} known brush mesh(es) from {}", count, path);
+    }
+
+    bool find(std::uint64_t hash, int n_verts, int n_indices, Proxy &out) noexcept
+    {
+        if (hash == 0 || n_verts <= 0 || n_indices < 0)
+        {
+            return false;
+        }
+        s_readers.fetch_add(1, std::memory_order_seq_cst);
+        const View *view = s_published.load(std::memory_order_seq_cst);
+        bool found = false;
+        const auto verts = static_cast<std::uint32_t>(n_verts);
+        const auto indices = static_cast<std::uint32_t>(n_indices);
+        if (view != nullptr)
+        {
+            std::uint32_t lo = 0;
+            std::uint32_t hi = view->count;
+            while (lo < hi)
+            {
+                const std::uint32_t mid = lo + (hi - lo) / 2;
+                if (key_less(view->records[mid], hash, verts, indices))
+                {
+                    lo = mid + 1;
+                }
+                else
+                {
+                    hi = mid;
+                }
+            }
+            if (lo < view->count)
+            {
+                const FileRecord &r = view->records[lo];
+                if (r.path_hash == hash && r.n_verts == verts && r.n_indices == indices)
+                {
+                    out.flags = static_cast<std::uint8_t>(r.flags);
+                    for (int a = 0; a < 3; ++a)
+                    {
+                        out.local_min[a] = r.local_min[a];
+                        out.local_max[a] = r.local_max[a];
+                    }
+                    found = true;
+                }
+            }
+        }
+        s_readers.fetch_sub(1, std::memory_order_seq_cst);
+        std::uint32_t slot = 0;
+        if (const FileRecord *r = found ? nullptr : find_learned(hash, verts, indices, slot); r != nullptr)
+        {
+            out.flags = static_cast<std::uint8_t>(r->flags);
+            for (int a = 0; a < 3; ++a)
+            {
+                out.local_min[a] = r->local_min[a];
+                out.local_max[a] = r->local_max[a];
+            }
+            found = true;
+        }
+        (found ? s_seeded : s_scanned).fetch_add(1, std::memory_order_relaxed);
+        return found;
+    }
+
+    void learn(std::uint64_t hash, int n_verts, int n_indices, const Proxy &proxy) noexcept
+    {
+        if (hash == 0 || n_verts <= 0 || n_indices < 0)
+        {
+            return;
+        }
+        const std::uint32_t n = s_learned_count.load(std::memory_order_relaxed);
+        std::uint32_t slot = 0;
+        if (n >= k_learn_capacity ||
+            find_learned(hash, static_cast<std::uint32_t>(n_verts), static_cast<std::uint32_t>(n_indices), slot))
+        {
+            return;
+        }
+        FileRecord &r = s_learned[n];
+        r.path_hash = hash;
+        r.n_verts = static_cast<std::uint32_t>(n_verts);
+        r.n_indices = static_cast<std::uint32_t>(n_indices);
+        for (int a = 0; a < 3; ++a)
+        {
+            r.local_min[a] = proxy.local_min[a];
+            r.local_max[a] = proxy.local_max[a];
+        }
+        r.flags = proxy.flags;
+        r.reserved = 0;
+        s_learned_index[slot] = static_cast<std::uint16_t>(n + 1);
+        s_learned_count.store(n + 1, std::memory_order_release);
+    }
+
+    void save()
+    {
+        DMK::Logger &logger = DMK::Logger::get_instance();
+        const std::uint32_t learned = s_learned_count.load(std::memory_order_acquire);
+        if (learned == 0 || !s_opened)
+        {
+            (void)unmap();
+            return;
+        }
+        try
+        {
+            // Known records first, so a key already on disk keeps that copy; then sort and drop repeats (learn()
+            // keeps the session's records unique, but one may also be in the file).
+            std::vector<FileRecord> merged;
+            if (const View *view = s_published.load(std::memory_order_acquire))
+            {
+                merged.assign(view->records, view->records + view->count);
+            }
+            const std::size_t known = merged.size();
+            merged.insert(merged.end(), s_learned, s_learned + learned);
+            if (!unmap())
+            {
+                return; // the rename below cannot replace a file that is still mapped
+            }
+            std::stable_sort(merged.begin(), merged.end(), record_less);
+            merged.erase(std::unique(merged.begin(), merged.end(), same_key), merged.end());
+            if (merged.size() > k_max_records)
+            {
+                logger.info("Occluder database: full ({} records); new meshes are not recorded", k_max_records);
+                return;
+            }
+            if (merged.size() == known)
+            {
+                return;
+            }
+
+            FileHeader header;
+            header.record_size = sizeof(FileRecord);
+            header.count = static_cast<std::uint32_t>(merged.size());
+            const std::string path = db_path();
+            const std::string temp_path = path + ".tmp";
+            {
+                std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+                if (!out)
+                {
+                    logger.debug("Occluder database: cannot open {}", temp_path);
+                    return;
+                }
+                out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+                out.write(reinterpret_cast<const char *>(merged.data()),
+                          static_cast<std::streamsize>(merged.size() * sizeof(FileRecord)));
+                out.flush();
+                if (!out)
+                {
+                    logger.debug("Occluder database: write error on {}", temp_path);
+                    return;
+                }
+            }
+            std::error_code ec;
+            std::filesystem::rename(temp_path, path, ec);
+            if (ec)
+            {
+                logger.debug("Occluder database: cannot replace {} ({})", path, ec.message());
+                std::filesystem::remove(temp_path, ec);
+                return;
+            }
+            logger.info("Occluder database: saved {} brush mesh(es) ({} new) to {}", merged.size(),
+                        merged.size() - known, path);
+        }
+        catch (const std::exception &e)
+        {
+            // Best effort: a failed save only costs the next session its head start.
+            logger.debug("Occluder database: save failed ({})", e.what());
+        }
+    }
+
+    Stats stats() noexcept
+    {
+        Stats s;
+        const View *view = s_published.load(std::memory_order_acquire);
+        s.known = view != nullptr ? view->count : 0;
+        s.seeded = s_seeded.load(std::memory_order_relaxed);
+        s.scanned = s_scanned.load(std::memory_order_relaxed);
+        s.learned = s_learned_count.load(std::memory_order_relaxed);
+        return s;
+    }
+
+} // namespace TPVCamera::OccluderDb
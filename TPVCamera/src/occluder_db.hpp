@@ -0,0 +1,83 @@
+/**
+ * @file occluder_db.hpp
+ * @brief On-disk knowledge of brush meshes, so a session does not re-derive what an earlier one already measured.
+ *
+ * @details The brush classification cache (render_occlusion.cpp) works out, on the first sight of each statobj in a
+ *          level, its name-derived class and its root mesh's LOCAL bounds -- the bounds by a scan of the whole
+ *          position stream. The same tents, awnings, washing lines and scaffolds come back every session, so this
+ *          keeps the result in <mod>_occluders.db next to the INI: one record per (.cgf path hash, root-mesh vertex
+ *          count, index count) with the class flags and the local bounds, the coarse proxy the octree loops test
+ *          before any geometry work. A record is used only when the live mesh has the recorded counts, so a game
+ *          patch or a mesh mod that changes a mesh re-measures it instead of trusting stale bounds.
+ *
+ *          The key is the statobj's path, not its placement: every placement of a .cgf shares one statobj and one
+ *          root mesh, so a world position would only split identical records. The file holds no pointers or
+ *          build-specific data and can be copied between installs as it is.
+ *
+ *          A mesh measured this session is found again from its learned record, so the brush cache clear of each
+ *          level load neither re-measures it nor records it twice.
+ *
+ *          Threading: open() maps the file read-only during init, before the hooks, prefetches it, and publishes
+ *          the view; find() and learn() run on the render thread (find() is lock-free: a reader count keeps save()
+ *          from unmapping under it, for at most 2 s before save() leaves it mapped); save() runs at shutdown and
+ *          merges the session's new records into the file through a sibling temp file and a rename, like the anchor
+ *          cache. A crash loses only the session's new records.
+ */
+#ifndef TPVCAMERA_OCCLUDER_DB_HPP
+#define TPVCAMERA_OCCLUDER_DB_HPP
+
+#include <cstdint>
+
+namespace TPVCamera::OccluderDb
+{
+
+    /**
+     * @struct Proxy
+     * @brief What a record keeps of one root mesh: render_occlusion's class flags and the mesh's local bounds.
+     */
+    struct Proxy
+    {
+        std::uint8_t flags = 0;
+        float local_min[3] = {};
+        float local_max[3] = {};
+    };
+
+    /** @brief Case- and slash-insensitive FNV-1a hash of a .cgf path; 0 (never a key) for an empty path. */
+    [[nodiscard]] std::uint64_t path_hash(const char *path) noexcept;
+
+    /** @brief Maps the database file and publishes it to find(). A missing or foreign file leaves it empty. */
+    void open();
+
+    /**
+     * @brief Looks up the record of (@p path_hash, @p n_verts, @p n_indices) in the file, then among the meshes
+     *        learned this session. POD body: safe inside the caller's SEH frame. Render thread.
+     * @return true and @p out filled on a hit.
+     */
+    [[nodiscard]] bool find(std::uint64_t path_hash, int n_verts, int n_indices, Proxy &out) noexcept;
+
+    /**
+     * @brief Records a freshly measured mesh for the next save() and later find()s. Ignores a key already learned;
+     *        drops the mesh once the session buffer is full.
+     */
+    void learn(std::uint64_t path_hash, int n_verts, int n_indices, const Proxy &proxy) noexcept;
+
+    /** @brief Merges the session's new records into the file (if any) and unmaps it. Called from shutdown(). */
+    void save();
+
+    /**
+     * @struct Stats
+     * @brief Counters for the overlay's Performance section.
+     */
+    struct Stats
+    {
+        std::uint32_t known = 0;   // records in the mapped file
+        std::uint64_t seeded = 0;  // meshes whose bounds came from the file or an earlier measure this session
+        std::uint64_t scanned = 0; // meshes measured live (not in the file)
+        std::uint32_t learned = 0; // new records waiting for save()
+    };
+
+    [[nodiscard]] Stats stats() noexcept;
+
+} // namespace TPVCamera::OccluderDb
+
+#endif // TPVCAMERA_OCCLUDER_DB_HPP
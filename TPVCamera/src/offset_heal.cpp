@@ -4,8 +4,13 @@
  */
 
 #include "offset_heal.hpp"
+#include "anchor_cache.hpp"
 #include "config.hpp"
 #include "constants.hpp"
+#include "global_state.hpp"
+#include "health.hpp"
+#include "hot_block.hpp"
+#include "rtti_cache.hpp"
 
 #include <DetourModKit.hpp>
 
@@ -13,6 +18,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <string_view>
 
 namespace TPVCamera
@@ -48,13 +54,6 @@ namespace TPVCamera
             return std::min(static_cast<std::size_t>(configured), DMK::Rtti::MAX_HEAL_WINDOW);
         }
 
-        // Frame interval between self-heal retry scans for an offset that has not resolved yet (its target object
-        // is not constructed until a session loads, or the actor is not yet seated). The RTTI prelude is
-        // syscall-heavy, so a not-yet-live offset is retried on this cadence rather than every frame. There is NO
-        // attempt cap: however long the player lingers at the main menu or a load takes, the heal keeps retrying
-        // until the object appears, then latches and stops.
-        constexpr int k_heal_retry_interval_frames = 30; // about 0.5s at 60 FPS
-
         // Self-heal landmarks: "at this nominal offset within the struct there is a slot referring to an object of
         // this mangled type." Each is keyed on a type that is stable across patches (an engine/base type or an
         // already-trusted concrete type), per the rtti_dissect guidance. base is filled at call time. The
@@ -114,6 +113,50 @@ namespace TPVCamera
         // landmarks so entity has a single definition shared with nothing else.
         constexpr std::array<DMK::Rtti::Landmark, 2> k_player_top_bracket{{k_entity_lm, k_hitdeath_lm}};
 
+        // RuntimeOffsets fields in declaration order (HealedOffsets::value[i] is field i) and the group that owns
+        // each, so the snapshot / seed pair below cannot drift from the struct.
+        struct OffsetField
+        {
+            std::atomic<std::ptrdiff_t> RuntimeOffsets::*field;
+            HealGroup group;
+            std::ptrdiff_t nominal;
+        };
+        constexpr OffsetField k_offset_fields[] = {
+            {&RuntimeOffsets::ccryaction_actiongame, HealFramework, Constants::CCRYACTION_ACTIONGAME_OFFSET},
+            {&RuntimeOffsets::cactiongame_local_actor, HealLocalActor, Constants::CACTIONGAME_LOCAL_ACTOR_OFFSET},
+            {&RuntimeOffsets::c_player_entity, HealPlayerDirect, Constants::C_PLAYER_ENTITY_OFFSET},
+            {&RuntimeOffsets::c_player_look_controller, HealPlayerDirect, Constants::C_PLAYER_LOOK_CONTROLLER_OFFSET},
+            {&RuntimeOffsets::c_player_animated_human, HealPlayerDirect, Constants::C_PLAYER_ANIMATED_HUMAN_OFFSET},
+            {&RuntimeOffsets::c_player_actor_model, HealPlayerDirect, Constants::C_PLAYER_ACTOR_MODEL_OFFSET},
+            {&RuntimeOffsets::c_player_missile_controller, HealPlayerDirect,
+             Constants::C_PLAYER_MISSILE_CONTROLLER_OFFSET},
+            {&RuntimeOffsets::animated_human_animchar, HealAnimChar, Constants::ANIMATED_HUMAN_ANIMCHAR_OFFSET},
+            {&RuntimeOffsets::context_manager, HealContextManager, Constants::OFFSET_MANAGER_PTR_STORAGE},
+            {&RuntimeOffsets::context_minigame_subsystem, HealContextMinigame, Constants::OFFSET_MINIGAME_SUBSYSTEM},
+        };
+        static_assert(std::size(k_offset_fields) == k_runtime_offset_count, "update k_runtime_offset_count");
+
+        // Latched HealGroup bits. Set by the heals below on the render thread, or up front by seed_healed_offsets
+        // from the anchor cache; a set bit short-circuits that group's heal.
+        std::atomic<std::uint32_t> s_healed_groups{0};
+
+        [[nodiscard]] bool group_done(HealGroup group) noexcept
+        {
+            return (s_healed_groups.load(std::memory_order_relaxed) & group) != 0;
+        }
+
+        // Latches a group once its heal SUCCEEDED and, the first time it latches this session, records the offsets
+        // in the anchor cache so the next launch of this build can skip the scan. A group is latched at most once,
+        // and a seeded group never latches here. Only the in-memory record is updated (no file IO on the render
+        // thread); the file is written on the shutdown path (save_anchor_cache).
+        void mark_group_done(HealGroup group) noexcept
+        {
+            if ((s_healed_groups.fetch_or(group, std::memory_order_relaxed) & group) == 0)
+            {
+                store_healed_offsets(healed_offsets_snapshot());
+            }
+        }
+
         /**
          * @brief Emits one process-wide Warning the first time any offset is found to have drifted.
          * @details The per-landmark "moved" lines are logged at Info (a recovery is a success, not a fault). This
@@ -173,6 +216,7 @@ namespace TPVCamera
                 }
                 return true;
             }
+            Health::note(Health::Site::HealMiss);
             const std::string_view reason = DMK::Rtti::heal_error_to_string(result.error());
             if (optional)
             {
@@ -187,6 +231,89 @@ namespace TPVCamera
             return false;
         }
 
+        /**
+         * @struct RetryGate
+         * @brief Per-landmark record of the last full heal attempt, for @ref heal_gated.
+         */
+        struct RetryGate
+        {
+            bool attempted = false;
+            std::uint32_t world_generation = 0;
+            std::uint64_t signature = 0;
+        };
+
+        /**
+         * @brief Cheap pre-probe of a landmark's heal window: which slots hold an object of its type right now.
+         * @details Walks the pointer-aligned slots in [nominal - window, nominal + window], reads each one's
+         *          vtable (through the slot for PointerToObject, in place for CompleteObject) and, when that vtable
+         *          lies in the game image, asks the shared RTTI cache whether it is the landmark's type. After the first frame every verdict is a cache hit,
+         *          so a probe is 2 guarded reads per slot and no syscalls; the heal_landmark prelude (region query,
+         *          module ranges, COL walks) only runs when this says there is something new to find.
+         * @return A hash over the matching (offset, object) pairs, or 0 when no slot matches.
+         */
+        [[nodiscard]] std::uint64_t window_signature(const DMK::Rtti::Landmark &tmpl, std::uintptr_t base) noexcept
+        {
+            constexpr std::ptrdiff_t k_slot = static_cast<std::ptrdiff_t>(sizeof(std::uintptr_t));
+            const std::ptrdiff_t window = static_cast<std::ptrdiff_t>(heal_window());
+            const std::ptrdiff_t nominal = static_cast<std::ptrdiff_t>(tmpl.nominal_offset);
+            const std::ptrdiff_t first = std::max<std::ptrdiff_t>(0, nominal - window) & ~(k_slot - 1);
+            const char *rtti_name = std::string_view(tmpl.expected_mangled).data();
+            const bool through_pointer = tmpl.indirection == DMK::Rtti::Indirection::PointerToObject;
+
+            std::uint64_t hash = 0xcbf29ce484222325ull;
+            bool any = false;
+            for (std::ptrdiff_t off = first; off <= nominal + window; off += k_slot)
+            {
+                std::uintptr_t object = base + static_cast<std::uintptr_t>(off);
+                if (through_pointer)
+                {
+                    const auto pointee = DMK::Memory::seh_read<std::uintptr_t>(object);
+                    if (!pointee || !DMK::Memory::plausible_userspace_ptr(*pointee))
+                    {
+                        continue;
+                    }
+                    object = *pointee;
+                }
+                const auto vtable = DMK::Memory::seh_read<std::uintptr_t>(object);
+                // Only an in-image address can be a vtable: a heap pointer, a float pair or a counter read from a
+                // non-object slot is rejected here, before it can take (and evict) a slot in the shared RTTI cache.
+                if (!vtable || !in_game_module(*vtable) || !RttiCache::is_type(*vtable, rtti_name))
+                {
+                    continue;
+                }
+                any = true;
+                hash = (hash ^ static_cast<std::uint64_t>(off)) * 0x100000001b3ull;
+                hash = (hash ^ static_cast<std::uint64_t>(object)) * 0x100000001b3ull;
+            }
+            return any ? (hash | 1) : 0;
+        }
+
+        /**
+         * @brief heal_one behind the incremental retry gate: the full heal runs only when it can find something new.
+         * @details A landmark's full heal runs on its first attempt and once per world-load generation (the safety
+         *          net for a match the pre-probe cannot see, e.g. an object that is not yet live when the probe runs).
+         *          Otherwise it runs only when the window's signature changed to a non-empty one since the last
+         *          attempt: a new object of the landmark's type appeared in the window. While the player sits at the
+         *          main menu the slot stays empty or unchanged, so a retry costs the probe, never the prelude, and a
+         *          heal that keeps failing on the same contents is not re-run every frame. There is still no attempt
+         *          cap; the gate only decides WHEN the next attempt is worth paying for.
+         */
+        [[nodiscard]] bool heal_gated(std::string_view label, const DMK::Rtti::Landmark &tmpl, std::uintptr_t base,
+                                      std::atomic<std::ptrdiff_t> &slot, RetryGate &gate) noexcept
+        {
+            const std::uint32_t generation = world_load_generation().load(std::memory_order_relaxed);
+            const std::uint64_t signature = window_signature(tmpl, base);
+            const bool new_world = !gate.attempted || gate.world_generation != generation;
+            if (!new_world && (signature == 0 || signature == gate.signature))
+            {
+                return false;
+            }
+            gate.attempted = true;
+            gate.world_generation = generation;
+            gate.signature = signature;
+            return heal_one(label, tmpl, base, slot, true);
+        }
+
     } // namespace
 
     RuntimeOffsets &runtime_offsets() noexcept
@@ -201,8 +328,7 @@ namespace TPVCamera
         // CCryAction+CCRYACTION_ACTIONGAME_OFFSET is null until the framework constructs it (cold boot, main
         // menu, a slow load), so the heal must keep retrying for as long as that takes and stop only once it
         // actually resolves.
-        static std::atomic<bool> s_done{false};
-        if (s_done.load(std::memory_order_relaxed))
+        if (group_done(HealFramework))
         {
             return;
         }
@@ -218,20 +344,15 @@ namespace TPVCamera
         {
             return;
         }
-        // The slot is populated. Rate-limit the scan so a layout that genuinely cannot be recovered does not run
-        // the prelude every frame. heal_one logs a recovered drift loudly (warn_layout_drift_once) but treats a
+        // The slot is populated. The retry gate keeps a layout that genuinely cannot be recovered from running the
+        // prelude every frame: the full scan re-runs only once per world load or when a new CActionGame shows up
+        // in the window. heal_one logs a recovered drift loudly (warn_layout_drift_once) but treats a
         // still-unresolvable populated slot as an expected miss (optional == true -> Debug, not a Warning), so a
         // transition frame never emits the misleading "re-author" message.
-        static int s_frames_until_retry = 0;
-        if (s_frames_until_retry > 0)
-        {
-            --s_frames_until_retry;
-            return;
-        }
-        s_frames_until_retry = k_heal_retry_interval_frames;
-        if (heal_one("actionGame", k_actiongame_lm, cry_action, offsets.ccryaction_actiongame, true))
+        static RetryGate s_gate;
+        if (heal_gated("actionGame", k_actiongame_lm, cry_action, offsets.ccryaction_actiongame, s_gate))
         {
-            s_done.store(true, std::memory_order_relaxed);
+            mark_group_done(HealFramework);
         }
     }
 
@@ -242,95 +363,113 @@ namespace TPVCamera
         // but animChar lives one hop out on C_AnimatedHuman, which can be briefly null on the first valid frame.
         // A single entry latch would freeze animChar at nominal forever in that case; latching the two groups
         // independently lets animChar heal on a later frame instead of being abandoned (no attempt cap).
-        static std::atomic<bool> s_direct_done{false};   // animatedHuman + actorModel + missileController + the bracket
-        static std::atomic<bool> s_animchar_done{false}; // one hop out via C_AnimatedHuman
-        if (s_direct_done.load(std::memory_order_relaxed) && s_animchar_done.load(std::memory_order_relaxed))
-        {
-            return;
-        }
-        // Rate-limit the retry: the RTTI prelude is syscall-heavy, so the unresolved group is re-attempted on a
-        // fixed cadence (never every frame) while C_AnimatedHuman comes up.
-        static int s_frames_until_retry = 0;
-        if (s_frames_until_retry > 0)
+        // HealPlayerDirect: animatedHuman + actorModel + missileController + the bracket. HealAnimChar: one hop out
+        // via C_AnimatedHuman.
+        if (group_done(HealPlayerDirect) && group_done(HealAnimChar))
         {
-            --s_frames_until_retry;
             return;
         }
-        s_frames_until_retry = k_heal_retry_interval_frames;
+        // No frame cadence: each member retries behind its own retry gate (a full heal only once per world load or
+        // when a new object of its type appears in its window), so a member that keeps missing costs the cheap
+        // window probe per frame, never the RTTI prelude.
 
         RuntimeOffsets &offsets = runtime_offsets();
         DMK::Logger &logger = DMK::Logger::get_instance();
 
-        if (!s_direct_done.load(std::memory_order_relaxed))
+        if (!group_done(HealPlayerDirect))
         {
             // These members key on types that are UNIQUE within C_Player, so an independent window scan cannot
             // land on a wrong same-typed neighbour; they heal independently, which keeps each one resilient to a
             // shift that is not uniform across the struct. (entity is handled by the corroborated bracket below
             // instead: CEntity is a common type, so an independent scan would be decoy-prone.) The missile
             // controller is embedded in C_Player (constructed in its ctor), so its RTTI is normally resolvable.
-            // The C_Player vtable is already validated by the caller, so this group is deterministic on a valid
-            // frame and latches after one pass; a miss is logged at Debug (optional) since a recovered drift
-            // still warns loudly via heal_one's success path.
-            (void)heal_one("animatedHuman", k_animhuman_lm, c_player, offsets.c_player_animated_human, true);
-            (void)heal_one("actorModel", k_actormodel_lm, c_player, offsets.c_player_actor_model, true);
-            (void)heal_one("missileController", k_missile_lm, c_player, offsets.c_player_missile_controller, true);
+            // Each member remembers its own success, so the group latches once all of them AND the bracket have
+            // resolved; a miss is logged at Debug (optional) since a recovered drift still warns loudly via
+            // heal_one's success path.
+            static RetryGate s_animhuman_gate;
+            static RetryGate s_actormodel_gate;
+            static RetryGate s_missile_gate;
+            static bool s_animhuman_ok = false;
+            static bool s_actormodel_ok = false;
+            static bool s_missile_ok = false;
+            s_animhuman_ok = s_animhuman_ok || heal_gated("animatedHuman", k_animhuman_lm, c_player,
+                                                          offsets.c_player_animated_human, s_animhuman_gate);
+            s_actormodel_ok = s_actormodel_ok || heal_gated("actorModel", k_actormodel_lm, c_player,
+                                                            offsets.c_player_actor_model, s_actormodel_gate);
+            s_missile_ok = s_missile_ok || heal_gated("missileController", k_missile_lm, c_player,
+                                                      offsets.c_player_missile_controller, s_missile_gate);
 
             // Corroborated bracket: recover BOTH the entity pointer (common type, decoy-prone for a blind scan)
             // and the look controller (no RTTI of its own) from the single top-of-struct delta that entity and
             // HitDeathReactions both agree on (see k_player_top_bracket). Each rides the delta on success; a
-            // non-uniform shift fails the solve and both stay nominal (fail-closed).
-            const auto fit = DMK::Rtti::solve_fingerprint(c_player, k_player_top_bracket, heal_window());
-            if (fit)
+            // non-uniform shift fails the solve and both stay nominal (fail-closed). An unresolved bracket is
+            // solved again once per world load.
+            static bool s_bracket_ok = false;
+            static bool s_bracket_attempted = false;
+            static std::uint32_t s_bracket_generation = 0;
+            const std::uint32_t generation = world_load_generation().load(std::memory_order_relaxed);
+            if (!s_bracket_ok && (!s_bracket_attempted || s_bracket_generation != generation))
             {
-                const std::ptrdiff_t entity_healed = Constants::C_PLAYER_ENTITY_OFFSET + fit->delta;
-                const std::ptrdiff_t look_healed = Constants::C_PLAYER_LOOK_CONTROLLER_OFFSET + fit->delta;
-                offsets.c_player_entity.store(entity_healed, std::memory_order_relaxed);
-                offsets.c_player_look_controller.store(look_healed, std::memory_order_relaxed);
-                if (fit->delta != 0)
+                s_bracket_attempted = true;
+                s_bracket_generation = generation;
+                const auto fit = DMK::Rtti::solve_fingerprint(c_player, k_player_top_bracket, heal_window());
+                if (fit)
                 {
-                    warn_layout_drift_once(); // header before the moved lines (see heal_one)
-                    logger.info("Self-heal: entity moved {:+#x} ({:#x} -> {:#x})", fit->delta,
-                                Constants::C_PLAYER_ENTITY_OFFSET, entity_healed);
-                    logger.info("Self-heal: lookController moved {:+#x} ({:#x} -> {:#x})", fit->delta,
-                                Constants::C_PLAYER_LOOK_CONTROLLER_OFFSET, look_healed);
+                    s_bracket_ok = true;
+                    const std::ptrdiff_t entity_healed = Constants::C_PLAYER_ENTITY_OFFSET + fit->delta;
+                    const std::ptrdiff_t look_healed = Constants::C_PLAYER_LOOK_CONTROLLER_OFFSET + fit->delta;
+                    offsets.c_player_entity.store(entity_healed, std::memory_order_relaxed);
+                    offsets.c_player_look_controller.store(look_healed, std::memory_order_relaxed);
+                    if (fit->delta != 0)
+                    {
+                        warn_layout_drift_once(); // header before the moved lines (see heal_one)
+                        logger.info("Self-heal: entity moved {:+#x} ({:#x} -> {:#x})", fit->delta,
+                                    Constants::C_PLAYER_ENTITY_OFFSET, entity_healed);
+                        logger.info("Self-heal: lookController moved {:+#x} ({:#x} -> {:#x})", fit->delta,
+                                    Constants::C_PLAYER_LOOK_CONTROLLER_OFFSET, look_healed);
+                    }
+                    else
+                    {
+                        logger.debug("Self-heal: entity + lookController confirmed at nominal (entity {:#x}, "
+                                     "lookController {:#x})",
+                                     Constants::C_PLAYER_ENTITY_OFFSET, Constants::C_PLAYER_LOOK_CONTROLLER_OFFSET);
+                    }
                 }
                 else
                 {
-                    logger.debug("Self-heal: entity + lookController confirmed at nominal (entity {:#x}, "
-                                 "lookController {:#x})",
-                                 Constants::C_PLAYER_ENTITY_OFFSET, Constants::C_PLAYER_LOOK_CONTROLLER_OFFSET);
+                    // Bracket disagreed (non-uniform shift across the span). lookController has no RTTI of its
+                    // own, so it cannot be recovered independently and stays nominal. entity CAN still be scanned
+                    // for by type as a LAST RESORT: this reintroduces the decoy risk the corroborated solve avoided
+                    // (a wrong same-typed CEntity neighbour could be picked), but a best-effort offset beats a
+                    // guaranteed-stale one when the bracket has already failed, so try it. The fallback does not
+                    // latch the group: the bracket is solved again on the next world load.
+                    logger.debug("Self-heal: bracket unresolved ({}); lookController kept nominal; entity via "
+                                 "uncorroborated scan",
+                                 DMK::Rtti::heal_error_to_string(fit.error()));
+                    (void)heal_one("entity (uncorroborated fallback)", k_entity_lm, c_player,
+                                   offsets.c_player_entity, true);
                 }
             }
-            else
+            if (s_animhuman_ok && s_actormodel_ok && s_missile_ok && s_bracket_ok)
             {
-                // Bracket disagreed (non-uniform shift across the span). lookController has no RTTI of its own,
-                // so it cannot be recovered independently and stays nominal. entity CAN still be scanned for by
-                // type as a LAST RESORT: this reintroduces the decoy risk the corroborated solve avoided (a wrong
-                // same-typed CEntity neighbour could be picked), but a best-effort offset beats a guaranteed-stale
-                // one when the bracket has already failed, so try it. The solve is deterministic on a validated
-                // C_Player, so an undrifted build never reaches here; the diagnostic is logged at Debug.
-                logger.debug("Self-heal: bracket unresolved ({}); lookController kept nominal; entity via "
-                             "uncorroborated scan",
-                             DMK::Rtti::heal_error_to_string(fit.error()));
-                (void)heal_one("entity (uncorroborated fallback)", k_entity_lm, c_player, offsets.c_player_entity,
-                               true);
+                mark_group_done(HealPlayerDirect);
             }
-            s_direct_done.store(true, std::memory_order_relaxed);
         }
 
-        if (!s_animchar_done.load(std::memory_order_relaxed))
+        if (!group_done(HealAnimChar))
         {
             // animChar lives one hop out, on C_AnimatedHuman, so resolve that pointer through the (healed)
             // animated-human offset before healing it. While C_AnimatedHuman is still null (not yet constructed
-            // on this frame) leave animChar at nominal and retry on a later interval -- do NOT latch, so a brief
-            // null does not abandon the heal, and stay silent so the wait does not spam the log. Once
-            // C_AnimatedHuman is live the animChar result is deterministic, so attempt it once and latch.
+            // on this frame) leave animChar at nominal and retry on a later frame, silently so the wait does not
+            // spam the log. Once C_AnimatedHuman is live the heal runs behind its retry gate and latches on
+            // success only.
+            static RetryGate s_animchar_gate;
             const auto anim_human = DMK::Memory::seh_read<std::uintptr_t>(
                 c_player + offsets.c_player_animated_human.load(std::memory_order_relaxed));
-            if (anim_human && DMK::Memory::plausible_userspace_ptr(*anim_human))
+            if (anim_human && DMK::Memory::plausible_userspace_ptr(*anim_human) &&
+                heal_gated("animChar", k_animchar_lm, *anim_human, offsets.animated_human_animchar, s_animchar_gate))
             {
-                (void)heal_one("animChar", k_animchar_lm, *anim_human, offsets.animated_human_animchar, true);
-                s_animchar_done.store(true, std::memory_order_relaxed);
+                mark_group_done(HealAnimChar);
             }
         }
     }
@@ -342,9 +481,15 @@ namespace TPVCamera
         // is the signature of a CActionGame layout drift, but it is ALSO the transient seen while the real player
         // is still seating in during a load, so a miss is not necessarily drift -- it is logged at Debug
         // (optional) rather than crying "re-author". A recovered drift still warns loudly via heal_one's success
-        // path. The caller rate-limits and never caps the retries, so a player that takes a long time to seat is
-        // simply re-scanned until it appears.
-        (void)heal_one("localActor", k_localactor_lm, action_game, offsets.cactiongame_local_actor, true);
+        // path. The retry gate re-runs the full scan only when a C_Player appears in the window (or once per world
+        // load) and never caps the retries, so a player that takes a long time to seat is found the frame it does.
+        static RetryGate s_gate;
+        if (heal_gated("localActor", k_localactor_lm, action_game, offsets.cactiongame_local_actor, s_gate))
+        {
+            // Not a short-circuit (a drift recovery must stay reachable): only records the recovered offset so
+            // the next launch seeds it instead of re-detecting the mismatch.
+            mark_group_done(HealLocalActor);
+        }
         return offsets.cactiongame_local_actor.load(std::memory_order_relaxed);
     }
 
@@ -358,19 +503,65 @@ namespace TPVCamera
         // The caller gates this on the world being ready; a member that is briefly not yet live on that edge is
         // an expected miss (optional == true -> Debug, never the misleading "re-author" Warning), while a
         // recovered drift still warns loudly via heal_one. There is no attempt cap: each member keeps retrying
-        // (per-member latch) until it resolves.
-        static std::atomic<bool> s_manager_done{false};
-        static std::atomic<bool> s_minigame_done{false};
+        // (per-member latch) until it resolves, behind its own retry gate so an unresolved member costs the cheap
+        // window probe per call rather than the full prelude.
         RuntimeOffsets &offsets = runtime_offsets();
-        if (!s_manager_done.load(std::memory_order_relaxed) &&
-            heal_one("cameraManager", k_manager_lm, context, offsets.context_manager, true))
+        static RetryGate s_manager_gate;
+        static RetryGate s_minigame_gate;
+        if (!group_done(HealContextManager) &&
+            heal_gated("cameraManager", k_manager_lm, context, offsets.context_manager, s_manager_gate))
         {
-            s_manager_done.store(true, std::memory_order_relaxed);
+            mark_group_done(HealContextManager);
+        }
+        if (!group_done(HealContextMinigame) &&
+            heal_gated("minigameSubsystem", k_minigame_subsystem_lm, context, offsets.context_minigame_subsystem,
+                       s_minigame_gate))
+        {
+            mark_group_done(HealContextMinigame);
+        }
+    }
+
+    HealedOffsets healed_offsets_snapshot() noexcept
+    {
+        const RuntimeOffsets &offsets = runtime_offsets();
+        HealedOffsets out;
+        out.groups = s_healed_groups.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < k_runtime_offset_count; ++i)
+        {
+            out.value[i] = (offsets.*(k_offset_fields[i].field)).load(std::memory_order_relaxed);
+        }
+        return out;
+    }
+
+    void seed_healed_offsets(const HealedOffsets &cached) noexcept
+    {
+        // A healed offset is never negative and never further from its nominal than the widest heal window, so a
+        // value outside that reach cannot have come from a heal: its whole group stays unseeded and heals as usual.
+        constexpr std::uint32_t k_all_groups = HealFramework | HealLocalActor | HealPlayerDirect | HealAnimChar |
+                                               HealContextManager | HealContextMinigame;
+        std::uint32_t seeded = cached.groups & k_all_groups;
+        for (std::size_t i = 0; i < k_runtime_offset_count; ++i)
+        {
+            const OffsetField &f = k_offset_fields[i];
+            const std::int64_t reach = static_cast<std::int64_t>(DMK::Rtti::MAX_HEAL_WINDOW);
+            if (cached.value[i] < 0 || cached.value[i] < f.nominal - reach || cached.value[i] > f.nominal + reach)
+            {
+                seeded &= ~static_cast<std::uint32_t>(f.group);
+            }
+        }
+        RuntimeOffsets &offsets = runtime_offsets();
+        for (std::size_t i = 0; i < k_runtime_offset_count; ++i)
+        {
+            const OffsetField &f = k_offset_fields[i];
+            if ((seeded & f.group) != 0)
+            {
+                (offsets.*(f.field)).store(static_cast<std::ptrdiff_t>(cached.value[i]), std::memory_order_relaxed);
+            }
         }
-        if (!s_minigame_done.load(std::memory_order_relaxed) &&
-            heal_one("minigameSubsystem", k_minigame_subsystem_lm, context, offsets.context_minigame_subsystem, true))
+        s_healed_groups.fetch_or(seeded, std::memory_order_relaxed);
+        if (seeded != 0)
         {
-            s_minigame_done.store(true, std::memory_order_relaxed);
+            DMK::Logger::get_instance().debug("Self-heal: seeded offset groups {:#x} from the anchor cache", seeded);
         }
     }
 
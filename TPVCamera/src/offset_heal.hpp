@@ -16,6 +16,9 @@
  * nominal offset in place (degrades to current behaviour, never a guessed offset, never a crash), exactly
  * as DetourModKit's heal primitives guarantee. The heals are init-time / first-resolve only (the RTTI
  * prelude is syscall-heavy), never per-frame; the per-frame chains just read one relaxed atomic each.
+ * An offset that is not resolvable yet (main menu, a load in progress) is retried behind a gate that probes
+ * the heal window through the RTTI type cache and re-runs the full scan only when a matching object appears
+ * there or a new world loads (world_load_generation).
  */
 #ifndef TPVCAMERA_OFFSET_HEAL_HPP
 #define TPVCAMERA_OFFSET_HEAL_HPP
@@ -54,6 +57,36 @@ namespace TPVCamera
         std::atomic<std::ptrdiff_t> context_minigame_subsystem{Constants::OFFSET_MINIGAME_SUBSYSTEM};
     };
 
+    /// Number of RuntimeOffsets fields (the length of HealedOffsets::value).
+    inline constexpr std::size_t k_runtime_offset_count = 10;
+
+    /**
+     * @brief Latch bits for the independently-healed offset groups, as recorded in HealedOffsets::groups.
+     * @details A set bit means the group's heal ran to completion (it latched), so its offsets are as good as a
+     *          heal can make them for this game build and a later session may skip the scan.
+     */
+    enum HealGroup : std::uint32_t
+    {
+        HealFramework = 1u << 0,       // ccryaction_actiongame
+        HealLocalActor = 1u << 1,      // cactiongame_local_actor (only set when a drift recovery resolved)
+        HealPlayerDirect = 1u << 2,    // entity, look controller, animated human, actor model, missile controller
+        HealAnimChar = 1u << 3,        // animated_human_animchar
+        HealContextManager = 1u << 4,  // context_manager
+        HealContextMinigame = 1u << 5, // context_minigame_subsystem
+    };
+
+    /**
+     * @struct HealedOffsets
+     * @brief Plain copy of the RuntimeOffsets values plus the groups that latched, for the anchor cache file.
+     * @details value[] follows RuntimeOffsets declaration order. Only the fields of a group whose bit is set in
+     *          @ref groups are meaningful to a reader; the rest hold whatever the cache held (normally the nominal).
+     */
+    struct HealedOffsets
+    {
+        std::uint32_t groups = 0;
+        std::int64_t value[k_runtime_offset_count] = {};
+    };
+
     /**
      * @brief Returns the process-wide runtime offset cache.
      * @details Backed by a single function-local static (no static-init-order dependency, like the other
@@ -79,11 +112,11 @@ namespace TPVCamera
      * @details Independently heals the RTTI-typed members whose type is UNIQUE within C_Player (animated-human,
      *          actor-model, missile controller) and recovers the entity + look-controller offsets (the latter
      *          has no RTTI of its own) from a corroborated top-of-struct bracket; the animated-character pointer
-     *          one hop further out is healed through the (healed) animated-human offset. The C_Player-direct
-     *          group is deterministic once the caller has validated the vtable, so it latches after one pass;
-     *          animChar latches separately once C_AnimatedHuman is live, so a frame where that pointer is briefly
-     *          null retries on a later interval instead of being abandoned (no attempt cap). Caller must pass a
-     *          C_Player whose vtable already matched C_PLAYER_RTTI_NAME. Render-thread only.
+     *          one hop further out is healed through the (healed) animated-human offset. Each group latches only
+     *          once every member in it resolved; until then each member retries behind a retry gate (once per
+     *          world load, or when a new object of its type appears in its window), so a frame where
+     *          C_AnimatedHuman is briefly null retries later instead of being abandoned (no attempt cap). Caller
+     *          must pass a C_Player whose vtable already matched C_PLAYER_RTTI_NAME. Render-thread only.
      * @param c_player Live C_Player base address.
      */
     void heal_player_offsets(std::uintptr_t c_player) noexcept;
@@ -112,6 +145,18 @@ namespace TPVCamera
      */
     void heal_context_offsets(std::uintptr_t context) noexcept;
 
+    /** @brief Snapshot of the current offsets and latched groups (see HealedOffsets). */
+    [[nodiscard]] HealedOffsets healed_offsets_snapshot() noexcept;
+
+    /**
+     * @brief Seeds the offsets of every latched group in @p cached and marks those groups done.
+     * @details Used at init with the anchor cache's record for this exact game build, so the heals of a group
+     *          that already latched in an earlier session are skipped (the layout cannot differ within one
+     *          build). Groups not set in @p cached keep their nominal and heal as usual. Call before the first
+     *          render-thread heal.
+     */
+    void seed_healed_offsets(const HealedOffsets &cached) noexcept;
+
 } // namespace TPVCamera
 
 #endif // TPVCAMERA_OFFSET_HEAL_HPP
@@ -1,24 +1,39 @@
 /**
  * @file dx_overlay.cpp
- * @brief WARP + GDI ImGui host implementation (private overlay backend).
+ * @brief WARP (or opt-in hardware) + GDI ImGui host implementation (private overlay backend).
  *
  * @details Swap-chain-free transparent overlay, ported from
  *          CrimsonDesertLiveTransmog with the ReShade function-table layer
  *          removed. The pipeline is:
- *            1. D3D11 WARP device (CreateDevice only, no swap chain)
+ *            1. D3D11 device (CreateDevice only, no swap chain): WARP, or a private hardware
+ *               device when [Advanced] OverlayHardwareDevice is set (WARP fallback)
  *            2. Offscreen Texture2D render target (BGRA for GDI)
  *            3. ImGui renders to the texture via ImGui_ImplDX11
- *            4. Texture pixels copied to a DIB section (premultiplied alpha)
+ *            4. Texture pixels copied to a DIB section (premultiplied alpha, SIMD: pixel_kernels.hpp);
+ *               on the hardware device through a staging ring mapped only once each copy lands
  *            5. UpdateLayeredWindowIndirect composites the DIB over the game
  *
  *          No DXGI swap chain exists and the game swapchain is never hooked, so
  *          this is compatible with any DX wrapper (ReShade, SpecialK, etc.) and
  *          cannot fault the game render thread.
+ *
+ *          Steps 1-4 and the ImGui context are resident only while the panel is in use: they are built when
+ *          it first opens and released after [Advanced] OverlayIdleReleaseSeconds closed, so a session that
+ *          never opens the panel holds only the (empty) layered window and a sleeping thread.
+ *
+ *          Scheduling: the render thread sets its own priority and core placement when it starts
+ *          ([Advanced] OverlayThreadPriority, OverlayAffinityMask, OverlayEfficiencyCores), and WARP rasterizes
+ *          on it alone unless [Advanced] OverlayWarpSingleThreaded is off, so the panel's CPU cost is one
+ *          thread the scheduler can place away from the game's. Its CPU time per second is published for the
+ *          Performance section (dx_cpu_ms_per_second).
  */
 
 #include "dx_overlay.hpp"
 #include "overlay.hpp"
+#include "pixel_kernels.hpp"
 
+#include "alloc_stats.hpp"
+#include "config.hpp"
 #include "global_state.hpp"
 
 #include <DetourModKit.hpp>
@@ -32,15 +47,19 @@
 #include <d3d11.h>
 
 #include <Windows.h>
-#include <timeapi.h>
 
 #include <algorithm>
 #include <atomic>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <vector>
 
-#pragma comment(lib, "winmm.lib")
+// High-resolution waitable timers (Windows 10 1803+); older SDK headers do not define the flag.
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
 
 // Forward decl of the ImGui Win32 backend message handler (the backend header
 // declares it as extern but does not always pull it in for the subclass site).
@@ -64,14 +83,31 @@ namespace TPVCamera::Overlay::Detail
         HWND s_overlay_hwnd = nullptr;
         HWND s_game_hwnd = nullptr;
 
-        // D3D11 WARP device, no swap chain.
+        // D3D11 device, no swap chain: WARP by default, or a private hardware device when
+        // [Advanced] OverlayHardwareDevice is on and one can be created.
         ID3D11Device *s_device = nullptr;
         ID3D11DeviceContext *s_context = nullptr;
+        bool s_hardware = false;
 
-        // Offscreen render target + CPU-readable staging copy.
+        // Offscreen render target + CPU-readable staging copies. WARP executes the copy on the CPU during
+        // Map, so it uses one staging texture read back synchronously. A hardware device copies
+        // asynchronously, so it cycles a ring of k_readback_ring staging textures and maps a frame only
+        // once the GPU has finished its copy (see submit_readback / drain_readbacks).
+        constexpr int k_readback_ring = 3;
         ID3D11Texture2D *s_rt_tex = nullptr;
         ID3D11RenderTargetView *s_rtv = nullptr;
-        ID3D11Texture2D *s_staging_tex = nullptr;
+        ID3D11Texture2D *s_staging_ring[k_readback_ring] = {};
+        int s_staging_count = 0;
+
+        /// A staged frame awaiting composite: the clamped dirty box its copy covered.
+        struct PendingReadback
+        {
+            RECT box;
+            bool pending;
+        };
+        PendingReadback s_readbacks[k_readback_ring] = {};
+        int s_readback_head = 0; // next slot to copy into
+        int s_readback_tail = 0; // oldest slot awaiting composite
         UINT s_width = 0;
         UINT s_height = 0;
 
@@ -85,6 +121,30 @@ namespace TPVCamera::Overlay::Detail
 
         HANDLE s_render_thread = nullptr;
 
+        // Render-thread CPU time (user + kernel) per second of wall time, over the last ~1 s window; written by the
+        // render loop, read by draw_ui on the same thread and by anyone through dx_cpu_ms_per_second.
+        std::atomic<float> s_cpu_ms_per_s{0.0f};
+
+        // Wakes the render loop (auto-reset): input reaching the overlay window, a visibility change, a state
+        // change announced through Overlay::notify_changed, or shutdown. Created by the first dx_start() and
+        // never closed, so dx_wake() is safe from any thread at any time (a no-op before the first start).
+        std::atomic<HANDLE> s_wake_event{nullptr};
+
+        // Overlay-thread only: the GetTickCount64 deadline draw_ui asked for a refresh by (0 = none) -- see
+        // dx_request_frame_within.
+        uint64_t s_refresh_at = 0;
+
+        // Frame pacing while the panel is visible (ms): the cap while the user interacts with a widget, the cap
+        // otherwise, and how often the cursor / mouse buttons are polled while nothing else wakes the loop (the
+        // game captures the mouse, so pointer motion does not arrive as window messages).
+        constexpr int k_interactive_frame_ms = 16;
+        constexpr int k_idle_frame_ms = 33;
+        constexpr int k_input_poll_ms = 16;
+        constexpr int k_hidden_poll_ms = 50;
+        // Frames to keep running after an input-driven one, so widgets that settle a frame late (a click
+        // released, a popup opening) land without waiting for the next input.
+        constexpr int k_settle_frames = 2;
+
         constexpr wchar_t k_overlay_class[] = L"TPVCameraOverlay";
 
         /**
@@ -102,11 +162,19 @@ namespace TPVCamera::Overlay::Detail
                 s_rt_tex->Release();
                 s_rt_tex = nullptr;
             }
-            if (s_staging_tex)
+            for (ID3D11Texture2D *&staging : s_staging_ring)
             {
-                s_staging_tex->Release();
-                s_staging_tex = nullptr;
+                if (staging)
+                {
+                    staging->Release();
+                    staging = nullptr;
+                }
             }
+            s_staging_count = 0;
+            for (PendingReadback &rb : s_readbacks)
+                rb.pending = false;
+            s_readback_head = 0;
+            s_readback_tail = 0;
             // Deselect the DIB before deleting it: a GDI object still selected into a DC cannot be freed
             // (DeleteObject fails and the DIB plus its pixel buffer leak). Restore the DC's original bitmap
             // while the DC is still alive, then delete the DIB, then the DC.
@@ -162,15 +230,20 @@ namespace TPVCamera::Overlay::Detail
                 return false;
             }
 
-            // Staging texture (CPU-readable copy for the GDI blit).
+            // Staging texture(s) (CPU-readable copies for the GDI blit).
             td.Usage = D3D11_USAGE_STAGING;
             td.BindFlags = 0;
             td.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
-            if (FAILED(s_device->CreateTexture2D(&td, nullptr, &s_staging_tex)))
+            const int staging_count = s_hardware ? k_readback_ring : 1;
+            for (int i = 0; i < staging_count; ++i)
             {
-                release_targets();
-                return false;
+                if (FAILED(s_device->CreateTexture2D(&td, nullptr, &s_staging_ring[i])))
+                {
+                    release_targets();
+                    return false;
+                }
             }
+            s_staging_count = staging_count;
 
             // DIB section for UpdateLayeredWindowIndirect (top-down 32bpp BGRA).
             BITMAPINFO bmi{};
@@ -247,80 +320,134 @@ namespace TPVCamera::Overlay::Detail
             return true;
         }
 
+        /// Mixes @p bytes into @p h a word at a time (xor-multiply per 8 bytes, then the tail), so hashing a
+        /// few hundred KB of vertices costs far less than rendering them through WARP.
+        [[nodiscard]] uint64_t mix_bytes(uint64_t h, const void *bytes, size_t size) noexcept
+        {
+            constexpr uint64_t k_prime = 0x100000001b3ull;
+            const auto *p = static_cast<const uint8_t *>(bytes);
+            for (; size >= 8; size -= 8, p += 8)
+            {
+                uint64_t word;
+                memcpy(&word, p, 8);
+                h = (h ^ word) * k_prime;
+                h ^= h >> 29;
+            }
+            for (; size > 0; --size, ++p)
+                h = (h ^ *p) * k_prime;
+            return h;
+        }
+
         /**
-         * @brief Copies the dirty region of the render target into the DIB and
-         *        composites it onto the screen via UpdateLayeredWindowIndirect.
-         * @param dirty The rect (target-space) to refresh; pixels outside it keep the
-         *        previous frame's layered-surface contents (ULWI prcDirty ignores them).
-         * @details Limiting the staging readback, the per-pixel premultiply and the GDI
-         *          composite to the union of the previous and current drawn rects is the
-         *          bulk of the responsiveness win on high-res displays.
+         * @brief Fingerprint of everything that determines the rendered pixels of a frame.
+         * @details Covers the display rect and, per draw list, the vertex and index buffers plus every command's
+         *          clip rect, texture, offsets and element count. Two frames with the same fingerprint rasterize to
+         *          the same image, so the caller can keep the last composite on screen instead of redrawing it.
          */
-        void blit_to_screen(const RECT &dirty)
+        [[nodiscard]] uint64_t hash_draw_data(const ImDrawData *dd) noexcept
+        {
+            uint64_t h = 0xcbf29ce484222325ull;
+            if (!dd)
+                return h;
+            h = mix_bytes(h, &dd->DisplayPos, sizeof(dd->DisplayPos));
+            h = mix_bytes(h, &dd->DisplaySize, sizeof(dd->DisplaySize));
+            h = mix_bytes(h, &dd->CmdListsCount, sizeof(dd->CmdListsCount));
+            for (int i = 0; i < dd->CmdListsCount; ++i)
+            {
+                const ImDrawList *cl = dd->CmdLists[i];
+                h = mix_bytes(h, cl->VtxBuffer.Data, static_cast<size_t>(cl->VtxBuffer.Size) * sizeof(ImDrawVert));
+                h = mix_bytes(h, cl->IdxBuffer.Data, static_cast<size_t>(cl->IdxBuffer.Size) * sizeof(ImDrawIdx));
+                for (int c = 0; c < cl->CmdBuffer.Size; ++c)
+                {
+                    const ImDrawCmd &cmd = cl->CmdBuffer[c];
+                    const ImTextureID tex = cmd.GetTexID();
+                    h = mix_bytes(h, &cmd.ClipRect, sizeof(cmd.ClipRect));
+                    h = mix_bytes(h, &tex, sizeof(tex));
+                    h = mix_bytes(h, &cmd.VtxOffset, sizeof(cmd.VtxOffset));
+                    h = mix_bytes(h, &cmd.IdxOffset, sizeof(cmd.IdxOffset));
+                    h = mix_bytes(h, &cmd.ElemCount, sizeof(cmd.ElemCount));
+                    // A user callback draws outside the buffers, so any frame carrying one is never "unchanged".
+                    h = mix_bytes(h, &cmd.UserCallback, sizeof(cmd.UserCallback));
+                }
+            }
+            return h;
+        }
+
+        /// Whether the backend still has font-atlas work to do this frame (ImGui 1.92 uploads textures from
+        /// RenderDrawData), in which case the frame must be rendered even if its draw data is unchanged.
+        [[nodiscard]] bool textures_pending(const ImDrawData *dd) noexcept
+        {
+            if (!dd || !dd->Textures)
+                return false;
+            for (const ImTextureData *tex : *dd->Textures)
+            {
+                if (tex->Status != ImTextureStatus_OK)
+                    return true;
+            }
+            return false;
+        }
+
+        /// Clamps @p dirty to the surface; false when nothing of it is on the surface.
+        [[nodiscard]] bool clamp_to_surface(const RECT &dirty, RECT &out) noexcept
         {
             const LONG w = static_cast<LONG>(s_width);
             const LONG h = static_cast<LONG>(s_height);
-            const LONG x0 = std::clamp<LONG>(dirty.left, 0, w);
-            const LONG y0 = std::clamp<LONG>(dirty.top, 0, h);
-            const LONG x1 = std::clamp<LONG>(dirty.right, 0, w);
-            const LONG y1 = std::clamp<LONG>(dirty.bottom, 0, h);
-            if (x1 <= x0 || y1 <= y0)
-                return;
+            out.left = std::clamp<LONG>(dirty.left, 0, w);
+            out.top = std::clamp<LONG>(dirty.top, 0, h);
+            out.right = std::clamp<LONG>(dirty.right, 0, w);
+            out.bottom = std::clamp<LONG>(dirty.bottom, 0, h);
+            return out.right > out.left && out.bottom > out.top;
+        }
 
-            // GPU -> staging: copy only the dirty box.
+        /// GPU -> staging: copies only the dirty box of the render target.
+        void copy_to_staging(ID3D11Texture2D *staging, const RECT &box_rect)
+        {
             D3D11_BOX box{};
-            box.left = static_cast<UINT>(x0);
-            box.top = static_cast<UINT>(y0);
+            box.left = static_cast<UINT>(box_rect.left);
+            box.top = static_cast<UINT>(box_rect.top);
             box.front = 0;
-            box.right = static_cast<UINT>(x1);
-            box.bottom = static_cast<UINT>(y1);
+            box.right = static_cast<UINT>(box_rect.right);
+            box.bottom = static_cast<UINT>(box_rect.bottom);
             box.back = 1;
-            s_context->CopySubresourceRegion(s_staging_tex, 0, static_cast<UINT>(x0), static_cast<UINT>(y0), 0,
-                                             s_rt_tex, 0, &box);
-
-            D3D11_MAPPED_SUBRESOURCE mapped{};
-            if (FAILED(s_context->Map(s_staging_tex, 0, D3D11_MAP_READ, 0, &mapped)))
-                return;
+            s_context->CopySubresourceRegion(staging, 0, box.left, box.top, 0, s_rt_tex, 0, &box);
+        }
 
+        /**
+         * @brief Copies the dirty box of a mapped staging texture into the DIB and composites it onto the screen
+         *        via UpdateLayeredWindowIndirect.
+         * @param mapped The mapped staging texture holding this frame's pixels inside @p box.
+         * @param box The clamped, target-space rect to refresh; pixels outside it keep the previous frame's
+         *        layered-surface contents (ULWI prcDirty ignores them).
+         * @details Limiting the staging readback, the per-pixel premultiply and the GDI
+         *          composite to the union of the previous and current drawn rects is the
+         *          bulk of the responsiveness win on high-res displays.
+         */
+        void composite_box(const D3D11_MAPPED_SUBRESOURCE &mapped, const RECT &box)
+        {
             const UINT row_bytes = s_width * 4;
-            const UINT span_bytes = static_cast<UINT>(x1 - x0) * 4;
+            const int span_pixels = static_cast<int>(box.right - box.left);
             const auto *src_base = static_cast<const uint8_t *>(mapped.pData);
             auto *dst_base = static_cast<uint8_t *>(s_dib_pixels);
-            // memcpy + premultiply each dirty row in one pass.
-            for (LONG y = y0; y < y1; ++y)
+            // Copy + premultiply each dirty row in one pass (SIMD, with opaque / transparent run fast paths).
+            for (LONG y = box.top; y < box.bottom; ++y)
             {
-                const uint8_t *src = src_base + static_cast<size_t>(y) * mapped.RowPitch + static_cast<size_t>(x0) * 4;
-                uint8_t *dst = dst_base + static_cast<size_t>(y) * row_bytes + static_cast<size_t>(x0) * 4;
-                memcpy(dst, src, span_bytes);
-                for (LONG xi = 0; xi < x1 - x0; ++xi)
-                {
-                    uint8_t *px = dst + xi * 4;
-                    const uint8_t a = px[3];
-                    if (a == 0)
-                    {
-                        px[0] = px[1] = px[2] = 0;
-                    }
-                    else if (a < 255)
-                    {
-                        px[0] = static_cast<uint8_t>((px[0] * a + 127) / 255);
-                        px[1] = static_cast<uint8_t>((px[1] * a + 127) / 255);
-                        px[2] = static_cast<uint8_t>((px[2] * a + 127) / 255);
-                    }
-                }
+                const uint8_t *src =
+                    src_base + static_cast<size_t>(y) * mapped.RowPitch + static_cast<size_t>(box.left) * 4;
+                uint8_t *dst = dst_base + static_cast<size_t>(y) * row_bytes + static_cast<size_t>(box.left) * 4;
+                PixelKernels::premultiply_copy(src, dst, span_pixels);
             }
-            s_context->Unmap(s_staging_tex, 0);
 
             // Composite onto the screen with a dirty-rect hint.
             RECT gr{};
             GetWindowRect(s_game_hwnd, &gr);
             POINT pt_pos = {gr.left, gr.top};
-            SIZE sz = {w, h};
+            SIZE sz = {static_cast<LONG>(s_width), static_cast<LONG>(s_height)};
             POINT pt_src = {0, 0};
             BLENDFUNCTION blend{};
             blend.BlendOp = AC_SRC_OVER;
             blend.SourceConstantAlpha = 255;
             blend.AlphaFormat = AC_SRC_ALPHA;
-            RECT dirty_clamped{x0, y0, x1, y1};
+            RECT dirty_clamped = box;
             UPDATELAYEREDWINDOWINFO ulwi{};
             ulwi.cbSize = sizeof(ulwi);
             ulwi.pptDst = &pt_pos;
@@ -333,6 +460,85 @@ namespace TPVCamera::Overlay::Detail
             UpdateLayeredWindowIndirect(s_overlay_hwnd, &ulwi);
         }
 
+        /**
+         * @brief WARP path: copies the dirty region to staging, reads it back and composites it, all this frame.
+         * @return False when the staging readback could not be mapped (nothing was composited).
+         */
+        [[nodiscard]] bool blit_to_screen(const RECT &dirty)
+        {
+            RECT box{};
+            if (!clamp_to_surface(dirty, box))
+                return true;
+            copy_to_staging(s_staging_ring[0], box);
+            D3D11_MAPPED_SUBRESOURCE mapped{};
+            if (FAILED(s_context->Map(s_staging_ring[0], 0, D3D11_MAP_READ, 0, &mapped)))
+                return false;
+            composite_box(mapped, box);
+            s_context->Unmap(s_staging_ring[0], 0);
+            return true;
+        }
+
+        /**
+         * @brief Hardware path: composites every staged frame whose copy has completed, oldest first.
+         * @details Maps with D3D11_MAP_FLAG_DO_NOT_WAIT, so a copy still in flight returns
+         *          DXGI_ERROR_WAS_STILL_DRAWING instead of blocking this thread on the GPU; it is retried on the
+         *          next tick. Frames complete in submission order, so the first busy slot ends the pass.
+         */
+        void drain_readbacks()
+        {
+            while (s_readbacks[s_readback_tail].pending)
+            {
+                PendingReadback &rb = s_readbacks[s_readback_tail];
+                ID3D11Texture2D *staging = s_staging_ring[s_readback_tail];
+                D3D11_MAPPED_SUBRESOURCE mapped{};
+                const HRESULT hr = s_context->Map(staging, 0, D3D11_MAP_READ, D3D11_MAP_FLAG_DO_NOT_WAIT, &mapped);
+                if (hr == DXGI_ERROR_WAS_STILL_DRAWING)
+                    return;
+                if (SUCCEEDED(hr))
+                {
+                    composite_box(mapped, rb.box);
+                    s_context->Unmap(staging, 0);
+                }
+                rb.pending = false;
+                s_readback_tail = (s_readback_tail + 1) % s_staging_count;
+            }
+        }
+
+        /**
+         * @brief Hardware path: queues this frame's dirty region for readback into the next ring slot.
+         * @return False when every slot still holds an uncomposited frame; the caller drops this frame (it
+         *         re-renders on the next tick, since its fingerprint was never marked composited).
+         */
+        [[nodiscard]] bool submit_readback(const RECT &dirty)
+        {
+            RECT box{};
+            if (!clamp_to_surface(dirty, box))
+                return true;
+            PendingReadback &rb = s_readbacks[s_readback_head];
+            if (rb.pending)
+                return false;
+            copy_to_staging(s_staging_ring[s_readback_head], box);
+            s_context->Flush(); // start the copy now so it is likely done by the next drain
+            rb.box = box;
+            rb.pending = true;
+            s_readback_head = (s_readback_head + 1) % s_staging_count;
+            return true;
+        }
+
+        /// Hardware path: forgets every staged frame (the panel was hidden); false if any were dropped.
+        [[nodiscard]] bool discard_readbacks() noexcept
+        {
+            bool any = false;
+            for (PendingReadback &rb : s_readbacks)
+            {
+                any = any || rb.pending;
+                rb.pending = false;
+            }
+            s_readback_head = 0;
+            s_readback_tail = 0;
+            return !any;
+        }
+
         /**
          * @brief Finds this process's top-level game window.
          * @details Skips windows owned by other processes, hidden windows, sub-640x480
@@ -377,6 +583,10 @@ namespace TPVCamera::Overlay::Detail
         {
             if (s_ready.load(std::memory_order_relaxed) && s_overlay_visible.load(std::memory_order_relaxed))
             {
+                // Input for the panel: run a frame for it right after this dispatch pass.
+                if ((msg >= WM_KEYFIRST && msg <= WM_KEYLAST) || (msg >= WM_MOUSEFIRST && msg <= WM_MOUSELAST) ||
+                    msg == WM_SETFOCUS || msg == WM_KILLFOCUS)
+                    dx_wake();
                 if (msg == WM_KEYDOWN && wParam == VK_ESCAPE)
                 {
                     dx_set_visible(false);
@@ -426,11 +636,271 @@ namespace TPVCamera::Overlay::Detail
             }
         }
 
+        /// Creates a manual-reset waitable timer, high-resolution where the OS supports it.
+        [[nodiscard]] HANDLE create_pacing_timer() noexcept
+        {
+            HANDLE timer = CreateWaitableTimerExW(nullptr, nullptr,
+                                                  CREATE_WAITABLE_TIMER_MANUAL_RESET |
+                                                      CREATE_WAITABLE_TIMER_HIGH_RESOLUTION,
+                                                  TIMER_ALL_ACCESS);
+            if (!timer)
+                timer = CreateWaitableTimerW(nullptr, TRUE, nullptr);
+            return timer;
+        }
+
+        /// Arms @p timer to fire @p ms from now.
+        void arm_timer(HANDLE timer, int ms) noexcept
+        {
+            LARGE_INTEGER due{};
+            due.QuadPart = -static_cast<LONGLONG>(ms) * 10000; // relative, 100ns units
+            SetWaitableTimer(timer, &due, 0, nullptr, nullptr, FALSE);
+        }
+
+        /**
+         * @brief Blocks until dx_wake() fires, a message arrives for this thread, or @p ms elapse (timed on
+         *        @p timer).
+         * @return True when woken by the event or a message, false on timeout.
+         * @details Waits with MsgWaitForMultipleObjectsEx so keyboard input queued for the overlay window ends the
+         *          wait at once (its dispatch then signals the event from overlay_wndproc). The timeout comes from
+         *          a high-resolution waitable timer rather than the wait's own millisecond argument, so the loop
+         *          paces to the millisecond without raising the process-wide timer resolution (timeBeginPeriod).
+         */
+        [[nodiscard]] bool wait_for_wake(HANDLE timer, int ms) noexcept
+        {
+            const HANDLE wake = s_wake_event.load(std::memory_order_acquire);
+            DWORD count = 1;
+            DWORD timeout = static_cast<DWORD>(ms);
+            HANDLE handles[2] = {wake, timer};
+            if (timer)
+            {
+                arm_timer(timer, ms);
+                count = 2;
+                timeout = INFINITE;
+            }
+            const DWORD r = MsgWaitForMultipleObjectsEx(count, handles, timeout, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+            return r == WAIT_OBJECT_0 || r == WAIT_OBJECT_0 + count;
+        }
+
+        /**
+         * @brief Creates the D3D11 device, the render targets, the ImGui context and its font for a w x h surface.
+         * @details Called on the render thread when the panel opens while nothing is resident (the first open, or
+         *          the first after an idle release), so a session that never opens the panel never allocates any of
+         *          it. The font is ImGui's built-in one; ImGui 1.92 rasterizes glyphs into the atlas on first use,
+         *          so the atlas only ever holds the characters the panel has drawn, and the software mouse-cursor
+         *          shapes (the game draws the cursor) are left out of it.
+         * @return False if the device or a target could not be created; nothing is left allocated then.
+         */
+        [[nodiscard]] bool create_graphics(DMK::Logger &logger, UINT w, UINT h)
+        {
+            // D3D11 device (NO swap chain). Private to this module: we never touch the game's device or
+            // swapchain. WARP by default; the opt-in hardware device is a second device on the default adapter,
+            // so ImGui rasterizes on the GPU instead of a CPU core, and any failure falls back to WARP. Both are
+            // SINGLETHREADED (only this thread ever touches them, so the runtime's locking is pure overhead).
+            // WARP otherwise rasterizes on its own pool of worker threads sized to the machine, which competes
+            // with the game's for a panel that is a few thousand triangles; PREVENT_INTERNAL_THREADING_OPTIMIZATIONS
+            // keeps all of it on this thread instead (there is no API to cap the pool at some other size).
+            const D3D_FEATURE_LEVEL fl = D3D_FEATURE_LEVEL_11_0;
+            constexpr UINT k_device_flags = D3D11_CREATE_DEVICE_SINGLETHREADED;
+            s_hardware = false;
+            if (settings().overlay_hardware_device.load(std::memory_order_relaxed))
+            {
+                s_hardware = SUCCEEDED(D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_HARDWARE, nullptr, k_device_flags,
+                                                         &fl, 1, D3D11_SDK_VERSION, &s_device, nullptr, &s_context));
+                if (!s_hardware)
+                    logger.warning("[overlay] Hardware device creation failed; falling back to WARP");
+            }
+            const UINT warp_flags =
+                k_device_flags | (settings().overlay_warp_single_threaded.load(std::memory_order_relaxed)
+                                      ? D3D11_CREATE_DEVICE_PREVENT_INTERNAL_THREADING_OPTIMIZATIONS
+                                      : 0u);
+            if (!s_hardware && FAILED(D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_WARP, nullptr, warp_flags, &fl, 1,
+                                                        D3D11_SDK_VERSION, &s_device, nullptr, &s_context)))
+            {
+                logger.error("[overlay] WARP device creation failed");
+                return false;
+            }
+
+            if (!create_targets(w, h))
+            {
+                logger.error("[overlay] Render target creation failed");
+                s_context->Release();
+                s_context = nullptr;
+                s_device->Release();
+                s_device = nullptr;
+                return false;
+            }
+
+            // ImGui (direct, no ReShade function table).
+            IMGUI_CHECKVERSION();
+            ImGui::CreateContext();
+            ImGuiIO &io = ImGui::GetIO();
+            io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
+            io.IniFilename = nullptr;
+            io.DisplaySize = ImVec2(static_cast<float>(w), static_cast<float>(h));
+            io.Fonts->Flags |= ImFontAtlasFlags_NoMouseCursors;
+
+            // DPI-aware scaling: 14px base targets 1080p, scaled linearly for higher
+            // resolutions. Build the font at the target size rather than stretching the
+            // built-in bitmap, then scale style sizes by the same ratio so padding and
+            // frame heights stay proportional to the glyph size.
+            const float dpi_scale = static_cast<float>(h) / 1080.0f;
+            ImGui::StyleColorsDark();
+            ImFontConfig font_cfg;
+            font_cfg.SizePixels = 14.0f * dpi_scale;
+            io.Fonts->AddFontDefault(&font_cfg);
+            // 13px is Dear ImGui's built-in proggy-clean font height, so target/13 scales the style metrics
+            // (padding, frame heights) by the same ratio as the font. FontGlobalScale is left at its 1.0
+            // default here: draw_ui() drives it from the user UI-scale preference every frame.
+            constexpr float k_imgui_default_font_px = 13.0f;
+            ImGui::GetStyle().ScaleAllSizes(font_cfg.SizePixels / k_imgui_default_font_px);
+
+            ImGui_ImplWin32_Init(s_overlay_hwnd);
+            ImGui_ImplDX11_Init(s_device, s_context);
+
+            s_ready.store(true, std::memory_order_release);
+            logger.info("[overlay] Ready at {}x{} ({} + GDI blit, no swap chain)", w, h,
+                        s_hardware ? "hardware device, async readback" : "WARP");
+            return true;
+        }
+
+        /// Sum of the calling thread's user and kernel time, in 100 ns units (0 if the query fails).
+        [[nodiscard]] uint64_t thread_cpu_100ns()
+        {
+            FILETIME created{}, exited{}, kernel{}, user{};
+            if (!GetThreadTimes(GetCurrentThread(), &created, &exited, &kernel, &user))
+                return 0;
+            const auto to_u64 = [](const FILETIME &ft)
+            { return (static_cast<uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime; };
+            return to_u64(kernel) + to_u64(user);
+        }
+
+        /**
+         * @brief Applies [Advanced] OverlayThreadPriority / OverlayAffinityMask / OverlayEfficiencyCores to the
+         *        calling (render) thread. Read once at thread start.
+         * @details The mask is a hard affinity, intersected with the process's so it can never strand the thread;
+         *          the efficiency-core option is a soft preference through CPU sets (the scheduler may still run
+         *          the thread elsewhere under load) and only acts on a hybrid CPU, where the CPU sets report more
+         *          than one efficiency class. The CPU-set API is Windows 10+ and resolved dynamically, like the
+         *          DPI call. An explicit mask wins over the efficiency-core option.
+         */
+        void apply_thread_scheduling(DMK::Logger &logger)
+        {
+            const LiveSettings &cfg = settings();
+            const int priority = std::clamp(cfg.overlay_thread_priority.load(std::memory_order_relaxed),
+                                            THREAD_PRIORITY_LOWEST, THREAD_PRIORITY_NORMAL);
+            if (priority != THREAD_PRIORITY_NORMAL && !SetThreadPriority(GetCurrentThread(), priority))
+                logger.debug("[overlay] SetThreadPriority({}) failed", priority);
+
+            const auto mask = static_cast<DWORD_PTR>(
+                static_cast<uint32_t>(cfg.overlay_affinity_mask.load(std::memory_order_relaxed)));
+            if (mask != 0)
+            {
+                DWORD_PTR process_mask = 0;
+                DWORD_PTR system_mask = 0;
+                const DWORD_PTR usable =
+                    GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask) ? (mask & process_mask)
+                                                                                              : 0;
+                if (usable != 0 && SetThreadAffinityMask(GetCurrentThread(), usable) != 0)
+                    logger.info("[overlay] Thread affinity mask 0x{:X}", static_cast<uint64_t>(usable));
+                else
+                    logger.warning("[overlay] OverlayAffinityMask 0x{:X} selects no usable core; ignored",
+                                   static_cast<uint64_t>(mask));
+                return;
+            }
+            if (!cfg.overlay_efficiency_cores.load(std::memory_order_relaxed))
+                return;
+
+            const HMODULE kernel32 = GetModuleHandleW(L"kernel32.dll");
+            if (!kernel32)
+                return;
+            using GetSystemCpuSetInformationFn = BOOL(WINAPI *)(PSYSTEM_CPU_SET_INFORMATION, ULONG, PULONG, HANDLE,
+                                                                ULONG);
+            using SetThreadSelectedCpuSetsFn = BOOL(WINAPI *)(HANDLE, const ULONG *, ULONG);
+            const auto get_cpu_sets = reinterpret_cast<GetSystemCpuSetInformationFn>(
+                GetProcAddress(kernel32, "GetSystemCpuSetInformation"));
+            const auto set_thread_cpu_sets = reinterpret_cast<SetThreadSelectedCpuSetsFn>(
+                GetProcAddress(kernel32, "SetThreadSelectedCpuSets"));
+            if (!get_cpu_sets || !set_thread_cpu_sets)
+                return;
+            ULONG bytes = 0;
+            (void)get_cpu_sets(nullptr, 0, &bytes, GetCurrentProcess(), 0);
+            if (bytes == 0)
+                return;
+            std::vector<std::byte> buffer(bytes);
+            auto *const first = reinterpret_cast<PSYSTEM_CPU_SET_INFORMATION>(buffer.data());
+            if (!get_cpu_sets(first, bytes, &bytes, GetCurrentProcess(), 0))
+                return;
+
+            // Two passes over the variable-size records: the lowest and highest efficiency class, then the ids
+            // of the lowest-class sets. Class 0 is the least performant core type.
+            BYTE lowest = 0xFF;
+            BYTE highest = 0;
+            std::vector<ULONG> ids;
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                for (ULONG off = 0; off < bytes;)
+                {
+                    const auto *info = reinterpret_cast<const SYSTEM_CPU_SET_INFORMATION *>(buffer.data() + off);
+                    if (info->Size == 0)
+                        break;
+                    if (info->Type == CpuSetInformation)
+                    {
+                        const BYTE cls = info->CpuSet.EfficiencyClass;
+                        if (pass == 0)
+                        {
+                            lowest = (std::min)(lowest, cls);
+                            highest = (std::max)(highest, cls);
+                        }
+                        else if (cls == lowest)
+                        {
+                            ids.push_back(info->CpuSet.Id);
+                        }
+                    }
+                    off += info->Size;
+                }
+                if (pass == 0 && lowest >= highest)
+                {
+                    logger.debug("[overlay] OverlayEfficiencyCores: not a hybrid CPU; ignored");
+                    return;
+                }
+            }
+            if (!ids.empty() && set_thread_cpu_sets(GetCurrentThread(), ids.data(), static_cast<ULONG>(ids.size())))
+                logger.info("[overlay] Thread prefers the {} efficiency core(s)", ids.size());
+        }
+
+        /// Tears down everything create_graphics built (render thread). The layered window stays.
+        void destroy_graphics()
+        {
+            if (!s_ready.load(std::memory_order_relaxed))
+                return;
+            s_ready.store(false, std::memory_order_release);
+            s_want_capture_mouse.store(false, std::memory_order_relaxed);
+            s_want_capture_keyboard.store(false, std::memory_order_relaxed);
+            ImGui_ImplDX11_Shutdown();
+            ImGui_ImplWin32_Shutdown();
+            ImGui::DestroyContext();
+            release_targets();
+            if (s_context)
+            {
+                s_context->Release();
+                s_context = nullptr;
+            }
+            if (s_device)
+            {
+                s_device->Release();
+                s_device = nullptr;
+            }
+        }
+
         /**
-         * @brief Render thread entry: builds resources, runs the per-frame loop, tears down.
+         * @brief Render thread entry: creates the layered window, runs the per-frame loop, tears down.
+         * @details The device, targets and ImGui are resident only while the panel is in use: create_graphics runs
+         *          when the panel opens with nothing resident, and destroy_graphics once it has stayed closed for
+         *          [Advanced] OverlayIdleReleaseSeconds (0 keeps them for the session).
          */
         DWORD WINAPI render_thread(LPVOID)
         {
+            AllocStats::set_thread_tag(AllocStats::AllocTag::Overlay);
             DMK::Logger &logger = DMK::Logger::get_instance();
 
             // Make THIS overlay thread per-monitor (v2) DPI aware before any window creation or size query, so
@@ -450,6 +920,8 @@ namespace TPVCamera::Overlay::Detail
                     (void)set_thread_dpi(reinterpret_cast<HANDLE>(static_cast<INT_PTR>(-4)));
             }
 
+            apply_thread_scheduling(logger);
+
             s_game_hwnd = wait_for_game_window(logger);
             if (!s_game_hwnd)
                 return 0;
@@ -480,73 +952,55 @@ namespace TPVCamera::Overlay::Detail
 
             ShowWindow(s_overlay_hwnd, SW_SHOWNOACTIVATE);
 
-            // D3D11 WARP device (NO swap chain). Private to this module: we never touch
-            // the game's device or swapchain.
-            const D3D_FEATURE_LEVEL fl = D3D_FEATURE_LEVEL_11_0;
-            if (FAILED(D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_WARP, nullptr, 0, &fl, 1, D3D11_SDK_VERSION,
-                                         &s_device, nullptr, &s_context)))
-            {
-                logger.error("[overlay] WARP device creation failed");
-                DestroyWindow(s_overlay_hwnd);
-                s_overlay_hwnd = nullptr;
-                UnregisterClassW(k_overlay_class, wc.hInstance);
-                return 0;
-            }
-
-            if (!create_targets(gw, gh))
-            {
-                logger.error("[overlay] Render target creation failed");
-                s_context->Release();
-                s_context = nullptr;
-                s_device->Release();
-                s_device = nullptr;
-                DestroyWindow(s_overlay_hwnd);
-                s_overlay_hwnd = nullptr;
-                UnregisterClassW(k_overlay_class, wc.hInstance);
-                return 0;
-            }
-
-            // ImGui (direct, no ReShade function table).
-            IMGUI_CHECKVERSION();
-            ImGui::CreateContext();
-            ImGuiIO &io = ImGui::GetIO();
-            io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
-            io.IniFilename = nullptr;
-            io.DisplaySize = ImVec2(static_cast<float>(gw), static_cast<float>(gh));
-
-            // DPI-aware scaling: 14px base targets 1080p, scaled linearly for higher
-            // resolutions. Build the font at the target size rather than stretching the
-            // built-in bitmap, then scale style sizes by the same ratio so padding and
-            // frame heights stay proportional to the glyph size.
-            const float dpi_scale = static_cast<float>(gh) / 1080.0f;
-            ImGui::StyleColorsDark();
-            ImFontConfig font_cfg;
-            font_cfg.SizePixels = 14.0f * dpi_scale;
-            io.Fonts->AddFontDefault(&font_cfg);
-            // 13px is Dear ImGui's built-in proggy-clean font height, so target/13 scales the style metrics
-            // (padding, frame heights) by the same ratio as the font. FontGlobalScale is left at its 1.0
-            // default here: draw_ui() drives it from the user UI-scale preference every frame.
-            constexpr float k_imgui_default_font_px = 13.0f;
-            ImGui::GetStyle().ScaleAllSizes(font_cfg.SizePixels / k_imgui_default_font_px);
-
-            ImGui_ImplWin32_Init(s_overlay_hwnd);
-            ImGui_ImplDX11_Init(s_device, s_context);
-
-            s_ready.store(true, std::memory_order_release);
-            logger.info("[overlay] Ready (WARP + GDI blit, no swap chain)");
-
-            // Raise the system timer resolution to 1ms so the adaptive Sleep() below is
-            // honored rather than rounding up to the ~15.6ms scheduler tick.
-            timeBeginPeriod(1);
+            logger.info("[overlay] Window ready; the device and ImGui are created when the panel first opens");
+
+            // Event-driven loop: a frame runs only when something it shows may have changed -- an input event,
+            // a dx_wake() notification, a refresh draw_ui asked for, or the settle frames after input -- and never
+            // sooner than the frame cap after the previous one. Otherwise the thread blocks: on the wake event
+            // (with a short cursor poll) while visible, on the wake event alone (plus a foreground poll) while
+            // hidden. poll_timer times those waits; frame_timer enforces the cap.
+            HANDLE poll_timer = create_pacing_timer();
+            HANDLE frame_timer = create_pacing_timer();
+            if (frame_timer)
+                arm_timer(frame_timer, 0);
+            bool woke = true;
+            int settle_frames = 0;
+            POINT last_cursor{LONG_MIN, LONG_MIN};
 
             // Previous frame's drawn rect, so we union it with this frame's rect and
             // clear pixels ImGui vacated (closed popup, dismissed tooltip).
             RECT prev_dirty{0, 0, 0, 0};
 
+            // Fingerprint of the frame currently on the layered window (see hash_draw_data); valid only while
+            // have_composite, which is dropped whenever the window is hidden or moved.
+            uint64_t composited_hash = 0;
+            bool have_composite = false;
+
+            // GetTickCount64 when the panel was last closed (0 while it is open), for the idle release.
+            uint64_t hidden_since = 0;
+
+            // Start of the current CPU-time window (wall ms, thread CPU in 100 ns), for s_cpu_ms_per_s.
+            uint64_t cpu_window_ms = GetTickCount64();
+            uint64_t cpu_window_100ns = thread_cpu_100ns();
+
             while (!s_shutdown_requested.load(std::memory_order_relaxed))
             {
+                // Close a ~1 s CPU-time window. A thread blocked for longer than that (panel hidden) wakes into
+                // a window it barely ran in, which reads as the near-zero cost it was.
+                if (const uint64_t now_ms = GetTickCount64(); now_ms - cpu_window_ms >= 1000)
+                {
+                    const uint64_t cpu = thread_cpu_100ns();
+                    const double cpu_ms = static_cast<double>(cpu - cpu_window_100ns) / 10000.0;
+                    const double wall_ms = static_cast<double>(now_ms - cpu_window_ms);
+                    s_cpu_ms_per_s.store(static_cast<float>(cpu_ms * 1000.0 / wall_ms), std::memory_order_relaxed);
+                    cpu_window_ms = now_ms;
+                    cpu_window_100ns = cpu;
+                }
+
+                // Drain the whole thread queue (not just the overlay window's): wait_for_wake returns on any
+                // queued message, so one left behind (an IME helper window's, say) would spin the loop.
                 MSG msg{};
-                while (PeekMessageW(&msg, s_overlay_hwnd, 0, 0, PM_REMOVE))
+                while (PeekMessageW(&msg, nullptr, 0, 0, PM_REMOVE))
                 {
                     TranslateMessage(&msg);
                     DispatchMessageW(&msg);
@@ -565,11 +1019,12 @@ namespace TPVCamera::Overlay::Detail
                 {
                     // Reposition only when the game window actually moved/resized. Only the POSITION/extent of
                     // the overlay window tracks the game here; the render targets, ImGui DisplaySize and font
-                    // scale are sized once at startup (create_targets above). A mid-session RESOLUTION change is
-                    // therefore not re-detected -- the panel keeps the startup size until it is closed and
-                    // reopened. This is intentional: rebuilding the device targets and font atlas on every resize
-                    // is not worth the complexity for a tuning panel that is normally opened briefly, and a stale
-                    // size only misaligns the blit (GDI clips it; there is no out-of-bounds access).
+                    // scale are sized when the graphics are created (create_graphics below). A mid-session
+                    // RESOLUTION change is therefore only picked up after an idle release -- until then the panel
+                    // keeps the size it was created at. This is intentional: rebuilding the device targets and font
+                    // atlas on every resize is not worth the complexity for a tuning panel that is normally opened
+                    // briefly, and a stale size only misaligns the blit (GDI clips it; there is no out-of-bounds
+                    // access).
                     static RECT s_last_gr{};
                     RECT ngr{};
                     GetWindowRect(s_game_hwnd, &ngr);
@@ -579,6 +1034,7 @@ namespace TPVCamera::Overlay::Detail
                         SetWindowPos(s_overlay_hwnd, HWND_TOP, ngr.left, ngr.top, ngr.right - ngr.left,
                                      ngr.bottom - ngr.top, SWP_NOACTIVATE);
                         s_last_gr = ngr;
+                        have_composite = false; // re-composite at the new position
                     }
                     if (!IsWindowVisible(s_overlay_hwnd))
                         ShowWindow(s_overlay_hwnd, SW_SHOWNOACTIVATE);
@@ -611,20 +1067,42 @@ namespace TPVCamera::Overlay::Detail
 
                 if (!want_visible)
                 {
-                    Sleep(50);
+                    have_composite = false;
+                    // A staged frame that never reached the screen leaves the layered surface behind the
+                    // dirty-rect bookkeeping, so repaint the whole surface when the panel comes back.
+                    if (s_hardware && !discard_readbacks())
+                        prev_dirty = RECT{0, 0, static_cast<LONG>(s_width), static_cast<LONG>(s_height)};
+                    // Closed long enough: give the device, targets, DIB and font atlas back until the next open.
+                    const int idle_s = settings().overlay_idle_release_seconds.load(std::memory_order_relaxed);
+                    const uint64_t now_ms = GetTickCount64();
+                    if (hidden_since == 0)
+                        hidden_since = now_ms;
+                    if (idle_s > 0 && s_ready.load(std::memory_order_relaxed) &&
+                        now_ms - hidden_since >= static_cast<uint64_t>(idle_s) * 1000)
+                    {
+                        destroy_graphics();
+                        logger.debug("[overlay] Released the device and ImGui after {} s closed", idle_s);
+                    }
+                    woke = wait_for_wake(poll_timer, k_hidden_poll_ms);
                     continue;
                 }
+                hidden_since = 0;
 
-                // Clear the render target to transparent black.
-                const float clear[4] = {0, 0, 0, 0};
-                s_context->OMSetRenderTargets(1, &s_rtv, nullptr);
-                s_context->ClearRenderTargetView(s_rtv, clear);
+                if (!s_ready.load(std::memory_order_relaxed))
+                {
+                    // First open, or the first since an idle release: size everything to the game window as it is
+                    // now, and repaint the whole layered surface so nothing of a previous session's panel shows.
+                    RECT cr{};
+                    GetClientRect(s_game_hwnd, &cr);
+                    if (!create_graphics(logger, static_cast<UINT>(cr.right), static_cast<UINT>(cr.bottom)))
+                        break;
+                    prev_dirty = RECT{0, 0, static_cast<LONG>(s_width), static_cast<LONG>(s_height)};
+                    have_composite = false;
+                }
+                ImGuiIO &io = ImGui::GetIO();
 
-                D3D11_VIEWPORT vp{};
-                vp.Width = static_cast<float>(s_width);
-                vp.Height = static_cast<float>(s_height);
-                vp.MaxDepth = 1.0f;
-                s_context->RSSetViewports(1, &vp);
+                if (s_hardware)
+                    drain_readbacks();
 
                 // Bridge mouse-button state into ImGui via polling. The game uses
                 // SetCapture / RawInput so WM_*BUTTON* route to the game window even
@@ -633,9 +1111,12 @@ namespace TPVCamera::Overlay::Detail
                 // started over the overlay count, suppressing drag-in / drag-out
                 // phantom clicks.
                 bool over_overlay = false;
+                bool pointer_changed = false;
                 {
                     POINT pt{};
                     GetCursorPos(&pt);
+                    pointer_changed = pt.x != last_cursor.x || pt.y != last_cursor.y;
+                    last_cursor = pt;
                     RECT wr{};
                     GetWindowRect(s_overlay_hwnd, &wr);
                     over_overlay = pt.x >= wr.left && pt.x < wr.right && pt.y >= wr.top && pt.y < wr.bottom;
@@ -646,6 +1127,7 @@ namespace TPVCamera::Overlay::Detail
                     auto poll = [&](int idx, int vk, bool &latch, bool &was) -> void
                     {
                         const bool now = (GetAsyncKeyState(vk) & 0x8000) != 0;
+                        pointer_changed = pointer_changed || now != was;
                         if (!now)
                             latch = false;
                         else if (!was && over_overlay)
@@ -658,6 +1140,33 @@ namespace TPVCamera::Overlay::Detail
                     poll(2, VK_MBUTTON, s_m_latch, s_m_was);
                 }
 
+                // Nothing to show that the layered window does not already hold: block until the next wake, the
+                // next cursor poll or draw_ui's refresh deadline, whichever comes first.
+                woke = woke || WaitForSingleObject(s_wake_event.load(std::memory_order_relaxed), 0) == WAIT_OBJECT_0;
+                const uint64_t now_ms = GetTickCount64();
+                const bool refresh_due = s_refresh_at != 0 && now_ms >= s_refresh_at;
+                if (!woke && !pointer_changed && !refresh_due && settle_frames == 0 && have_composite)
+                {
+                    int wait_ms = k_input_poll_ms;
+                    if (s_refresh_at != 0)
+                        wait_ms = (std::min)(wait_ms, static_cast<int>(s_refresh_at - now_ms));
+                    if (s_hardware && s_readbacks[s_readback_tail].pending)
+                        wait_ms = 1; // a staged frame is still in flight: come back to drain it, without a frame
+                    woke = wait_for_wake(poll_timer, (std::max)(wait_ms, 1));
+                    continue;
+                }
+                if (woke || pointer_changed)
+                    settle_frames = k_settle_frames;
+                else if (settle_frames > 0)
+                    --settle_frames;
+                woke = false;
+                if (refresh_due)
+                    s_refresh_at = 0;
+
+                // Frame cap: no sooner than the interval the previous frame armed.
+                if (frame_timer)
+                    WaitForSingleObject(frame_timer, k_idle_frame_ms);
+
                 ImGui_ImplDX11_NewFrame();
                 ImGui_ImplWin32_NewFrame();
                 ImGui::NewFrame();
@@ -671,13 +1180,46 @@ namespace TPVCamera::Overlay::Detail
                 const bool ui_active = ImGui::IsAnyItemActive() || ImGui::IsAnyItemHovered() || io.WantTextInput;
 
                 ImGui::Render();
-                ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
 
                 // Publish the input-capture intent for the game thread (Overlay::wants_input) without sharing
                 // the ImGui IO across threads. WantCapture* are finalized by NewFrame and stable for the frame.
                 s_want_capture_mouse.store(io.WantCaptureMouse, std::memory_order_relaxed);
                 s_want_capture_keyboard.store(io.WantCaptureKeyboard, std::memory_order_relaxed);
 
+                const bool mouse_moved = io.MouseDelta.x != 0.0f || io.MouseDelta.y != 0.0f;
+                const bool interactive = ui_active || mouse_moved;
+
+                // Cap the NEXT frame. This thread renders with WARP (software) on the CPU by default, so an
+                // uncapped rate steals a core from the game: ~60Hz while actively interacting (an item is
+                // active/hovered, text input is wanted, or the mouse is moving) and ~30Hz otherwise. NOTE:
+                // over_overlay is deliberately NOT a trigger -- the overlay window spans the entire game window,
+                // so the cursor is "over" it almost the whole time the panel is open; including it pinned the
+                // thread at the interactive rate for the whole session, which hit game fps. A hovered or active
+                // widget keeps frames coming (hover highlights, tooltip delays, the text caret) at that cap.
+                if (frame_timer)
+                    arm_timer(frame_timer, interactive ? k_interactive_frame_ms : k_idle_frame_ms);
+                if (ui_active)
+                    settle_frames = (std::max)(settle_frames, 1);
+
+                // A static panel produces the same draw data frame after frame (the common case: the player
+                // leaves it open while tuning). The layered window keeps the last composite, so an unchanged frame
+                // skips the WARP render, the staging readback and the blit; only the ImGui input pass above ran.
+                const uint64_t frame_hash = hash_draw_data(ImGui::GetDrawData());
+                if (have_composite && frame_hash == composited_hash && !textures_pending(ImGui::GetDrawData()))
+                    continue;
+
+                // Clear the render target to transparent black.
+                const float clear[4] = {0, 0, 0, 0};
+                s_context->OMSetRenderTargets(1, &s_rtv, nullptr);
+                s_context->ClearRenderTargetView(s_rtv, clear);
+
+                D3D11_VIEWPORT vp{};
+                vp.Width = static_cast<float>(s_width);
+                vp.Height = static_cast<float>(s_height);
+                vp.MaxDepth = 1.0f;
+                s_context->RSSetViewports(1, &vp);
+                ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+
                 // Tight dirty rect = union of the previous and current drawn rects, with
                 // a small border for anti-aliased edges. Full surface when ImGui drew
                 // nothing (collapsed window).
@@ -697,38 +1239,33 @@ namespace TPVCamera::Overlay::Detail
                 dirty.top = (std::max<LONG>)(0, dirty.top - k_edge_pad);
                 dirty.right = (std::min<LONG>)(static_cast<LONG>(s_width), dirty.right + k_edge_pad);
                 dirty.bottom = (std::min<LONG>)(static_cast<LONG>(s_height), dirty.bottom + k_edge_pad);
-                blit_to_screen(dirty);
-                prev_dirty = cur;
-
-                // Adaptive sleep. This thread renders with WARP (software) on the CPU, so an uncapped rate
-                // here steals a core from the game. Cap it to ~60Hz while actively interacting (an item is
-                // active/hovered, text input is wanted, or the mouse is moving) and ~30Hz when idle. NOTE:
-                // over_overlay is deliberately NOT a trigger -- the overlay window spans the entire game window,
-                // so the cursor is "over" it almost the whole time the panel is open; including it pinned the
-                // thread at the interactive rate for the whole session, which hit game fps.
-                const bool mouse_moved = io.MouseDelta.x != 0.0f || io.MouseDelta.y != 0.0f;
-                const bool interactive = ui_active || mouse_moved;
-                Sleep(interactive ? 16 : 33);
+                if (s_hardware)
+                {
+                    // Staged, not yet on screen: drain_readbacks composites it once the GPU copy lands. A full
+                    // ring drops the frame (prev_dirty and the fingerprint stay put, so it re-renders next tick).
+                    if (submit_readback(dirty))
+                    {
+                        prev_dirty = cur;
+                        composited_hash = frame_hash;
+                        have_composite = true;
+                    }
+                    drain_readbacks();
+                }
+                else
+                {
+                    have_composite = blit_to_screen(dirty);
+                    prev_dirty = cur;
+                    composited_hash = frame_hash;
+                }
             }
 
-            timeEndPeriod(1);
+            if (poll_timer)
+                CloseHandle(poll_timer);
+            if (frame_timer)
+                CloseHandle(frame_timer);
 
             // Teardown on the render thread (every D3D/ImGui object was created here).
-            s_ready.store(false, std::memory_order_release);
-            ImGui_ImplDX11_Shutdown();
-            ImGui_ImplWin32_Shutdown();
-            ImGui::DestroyContext();
-            release_targets();
-            if (s_context)
-            {
-                s_context->Release();
-                s_context = nullptr;
-            }
-            if (s_device)
-            {
-                s_device->Release();
-                s_device = nullptr;
-            }
+            destroy_graphics();
             if (s_overlay_hwnd)
             {
                 DestroyWindow(s_overlay_hwnd);
@@ -744,6 +1281,8 @@ namespace TPVCamera::Overlay::Detail
     {
         if (s_render_thread)
             return true;
+        if (!s_wake_event.load(std::memory_order_relaxed))
+            s_wake_event.store(CreateEventW(nullptr, FALSE, FALSE, nullptr), std::memory_order_release);
         s_shutdown_requested.store(false, std::memory_order_relaxed);
         s_render_thread = CreateThread(nullptr, 0, render_thread, nullptr, 0, nullptr);
         return s_render_thread != nullptr;
@@ -752,6 +1291,7 @@ namespace TPVCamera::Overlay::Detail
     void dx_stop() noexcept
     {
         s_shutdown_requested.store(true, std::memory_order_release);
+        dx_wake();
         if (s_render_thread)
         {
             // Only reclaim the handle if the render thread actually exited. On a timeout the thread is still
@@ -767,9 +1307,28 @@ namespace TPVCamera::Overlay::Detail
         s_overlay_visible.store(false, std::memory_order_relaxed);
     }
 
+    float dx_cpu_ms_per_second() noexcept
+    {
+        return s_cpu_ms_per_s.load(std::memory_order_relaxed);
+    }
+
     void dx_set_visible(bool visible) noexcept
     {
         s_overlay_visible.store(visible, std::memory_order_relaxed);
+        dx_wake();
+    }
+
+    void dx_wake() noexcept
+    {
+        if (HANDLE wake = s_wake_event.load(std::memory_order_acquire))
+            SetEvent(wake);
+    }
+
+    void dx_request_frame_within(int ms) noexcept
+    {
+        const uint64_t at = GetTickCount64() + static_cast<uint64_t>((std::max)(ms, 0));
+        if (s_refresh_at == 0 || at < s_refresh_at)
+            s_refresh_at = at;
     }
 
     bool dx_is_visible() noexcept
@@ -1,6 +1,6 @@
 /**
  * @file dx_overlay.hpp
- * @brief Internal WARP + GDI ImGui host for the TPVCamera overlay module.
+ * @brief Internal WARP (or opt-in hardware D3D11) + GDI ImGui host for the TPVCamera overlay module.
  *
  * @details This is the private rendering backend behind TPVCamera::Overlay
  *          (overlay.hpp / overlay.cpp). It owns a D3D11 WARP device, an
@@ -25,11 +25,13 @@ namespace TPVCamera::Overlay::Detail
 {
 
     /**
-     * @brief Spawns the overlay render thread (creates the WARP device, the
-     *        offscreen target, the ImGui context and the layered window).
+     * @brief Spawns the overlay render thread (creates the layered window, and the
+     *        device, offscreen target and ImGui context while the panel is in use).
      * @details The thread first waits for the game's top-level window to appear,
-     *          then builds all rendering resources and enters the render loop. The
-     *          per-frame work (ImGui frame, draw_ui(), render, composite) lives in
+     *          then creates the layered window and enters the render loop. The
+     *          rendering resources are built when the panel first opens and released
+     *          after it has stayed closed for [Advanced] OverlayIdleReleaseSeconds.
+     *          The per-frame work (ImGui frame, draw_ui(), render, composite) lives in
      *          the loop body. Safe to call once; a second call while running is a
      *          no-op.
      * @return True if the render thread was started; false if thread creation failed.
@@ -72,6 +74,26 @@ namespace TPVCamera::Overlay::Detail
      */
     [[nodiscard]] bool dx_wants_input() noexcept;
 
+    /**
+     * @brief Wakes the render loop so it runs a frame now (at most one frame cap away).
+     * @details Any thread. The loop otherwise blocks while nothing it displays changes: it only draws on input,
+     *          on this wake, on a dx_request_frame_within deadline, or for a short settle after input.
+     */
+    void dx_wake() noexcept;
+
+    /**
+     * @brief Asks the render loop to run another frame within @p ms, for content that changes without input.
+     * @details Overlay thread only (draw_ui). Requests coalesce to the earliest deadline and expire once met, so
+     *          a live readout re-requests every frame it is drawn.
+     */
+    void dx_request_frame_within(int ms) noexcept;
+
+    /**
+     * @brief The render thread's own CPU time (user + kernel) per second of wall time, in ms, over the last ~1 s.
+     * @details Any thread. 0 until the thread has run for a second; stale while it is blocked with the panel hidden.
+     */
+    [[nodiscard]] float dx_cpu_ms_per_second() noexcept;
+
 } // namespace TPVCamera::Overlay::Detail
 
 #endif // TPVCAMERA_OVERLAY_DX_OVERLAY_HPP
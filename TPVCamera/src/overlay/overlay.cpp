@@ -58,4 +58,19 @@ namespace TPVCamera::Overlay
         return Detail::dx_wants_input();
     }
 
+    void notify_changed() noexcept
+    {
+        Detail::dx_wake();
+    }
+
+    void request_frame_within(int ms) noexcept
+    {
+        Detail::dx_request_frame_within(ms);
+    }
+
+    float cpu_ms_per_second() noexcept
+    {
+        return Detail::dx_cpu_ms_per_second();
+    }
+
 } // namespace TPVCamera::Overlay
@@ -7,7 +7,9 @@
  *          own thread (ported from CrimsonDesertLiveTransmog's dx_overlay). It does NOT
  *          hook the game's swapchain, so it is independent of the game's DX11/DX12
  *          pipeline and cannot crash the render thread. Input is captured via a WndProc
- *          subclass + GetAsyncKeyState bridge while visible.
+ *          subclass + GetAsyncKeyState bridge while visible. The render loop is event-driven: it
+ *          draws on input, on notify_changed(), and on request_frame_within() deadlines, and
+ *          blocks otherwise.
  *
  *          Lifecycle: start() once after the game module is resolved; toggle()/set_visible()
  *          from the bound hotkey; stop() on shutdown. The render loop calls draw_ui()
@@ -43,6 +45,23 @@ namespace TPVCamera::Overlay
      */
     [[nodiscard]] bool wants_input() noexcept;
 
+    /**
+     * @brief Tells the overlay that something it displays changed, so an open panel redraws now.
+     * @details Safe from any thread and cheap (one SetEvent); a no-op while the overlay is not started. The
+     *          panel is event-driven and otherwise only redraws on input, so state the UI reads from other
+     *          threads (the debounced game state, the preset table) announces its changes here.
+     */
+    void notify_changed() noexcept;
+
+    /**
+     * @brief Asks for another panel frame within @p ms, for a live readout drawn by draw_ui().
+     * @details Call from draw_ui() only, each frame the readout is shown.
+     */
+    void request_frame_within(int ms) noexcept;
+
+    /** @brief CPU time the overlay thread used per second of wall time (ms), for the Performance section. */
+    [[nodiscard]] float cpu_ms_per_second() noexcept;
+
     /**
      * @brief Renders the preset-manager window contents.
      * @details Implemented in overlay_ui.cpp; called by the overlay render loop inside an
@@ -11,21 +11,34 @@
  *          The panel drives PresetStore CRUD (list selection, rename, new/duplicate/
  *          remove/reset-to-factory, save) and the per-preset field editors generated
  *          from Presets::fields(). Every field mutation this frame calls
- *          PresetStore::mark_dirty(), which republishes the live binding table so the
- *          edit previews on the third-person camera in real time. The overlay never
+ *          PresetStore::mark_dirty(), which previews the edit on the third-person camera
+ *          in real time (PresetStore::commit_frame() republishes at most once per frame). The overlay never
  *          sets any menu/overlay GameState bit, so the camera keeps rendering live
  *          while the panel is open.
  */
 
 #include "overlay.hpp"
 
+#include "alloc_stats.hpp"
+#include "benchmark.hpp"
+#include "collision_governor.hpp"
+#include "collision_heatmap.hpp"
 #include "config.hpp"
+#include "coverage_cache.hpp"
+#include "frame_arena.hpp"
+#include "frame_clock.hpp"
+#include "frame_profiler.hpp"
 #include "game_state.hpp"
 #include "global_state.hpp"
+#include "health.hpp"
+#include "occluder_db.hpp"
+#include "physics_raycast.hpp"
 #include "presets/camera_preset.hpp"
 #include "presets/camera_preset_fields.hpp"
 #include "presets/preset_runtime.hpp"
 #include "presets/preset_store.hpp"
+#include "render_occlusion.hpp"
+#include "rtti_cache.hpp"
 
 #include <DetourModKit.hpp>
 
@@ -67,6 +80,11 @@ namespace TPVCamera::Overlay
         /// Green tint marking the preset currently driving the camera (name text + "[active]" tag).
         constexpr ImVec4 k_active_preset{0.40f, 0.90f, 0.45f, 1.0f};
 
+        /// Refresh interval (ms) for the read-outs of render-thread values (follow distance, eye height).
+        constexpr int k_live_readout_ms = 100;
+        /// Refresh interval (ms) for the Performance section's timing table and cache counters.
+        constexpr int k_performance_refresh_ms = 250;
+
         /**
          * @brief Shows @p text as a hovered tooltip if the previous item is hovered and text is non-empty.
          * @param text Tooltip body; ignored when null or empty.
@@ -673,6 +691,7 @@ namespace TPVCamera::Overlay
             const float hi = live.follow_distance_max.load(std::memory_order_relaxed);
             // Guard the bound order (a user can set Min > Max): std::clamp is UB when hi < lo.
             const float applied = std::clamp(base + zoom, lo, std::max(lo, hi));
+            request_frame_within(k_live_readout_ms); // the zoom keys move it with no panel input
 
             ImGui::TextDisabled("Current follow distance: %.*f m", decimals, applied);
             hover_tooltip("The actual follow distance the camera is using right now: the Follow Distance above\n"
@@ -701,6 +720,7 @@ namespace TPVCamera::Overlay
         {
             CameraState &cam = camera_state();
             const float real_eye_height = cam.real_eye_height.load(std::memory_order_relaxed);
+            request_frame_within(k_live_readout_ms);
             ImGui::TextDisabled("Current eye height (real): %.*f m", decimals, real_eye_height);
             hover_tooltip("Your character's actual first-person eye height above the feet right now -- it drops when\n"
                           "you kneel, pray, sit, etc. With Dynamic Eye Sync on, the camera re-anchors to this when it\n"
@@ -797,7 +817,7 @@ namespace TPVCamera::Overlay
 
         /**
          * @brief Renders the grouped field editors (Framing / Orbit / Collision) for @p edited.
-         * @param store  The process-wide preset store (for mark_dirty on any edit and the precision pref).
+         * @param store  The process-wide preset store (for mark_field_dirty on any edit and the precision pref).
          * @param edited The preset bound to the editor (presets()[editing_index()]).
          */
         void draw_field_editors(PresetStore &store, CameraPreset &edited)
@@ -865,15 +885,15 @@ namespace TPVCamera::Overlay
 
                 if (changed)
                 {
-                    // Republish immediately so the edit previews on the live camera this frame. A shared field
-                    // also pushes its new value into every other preset (broadcast_field marks dirty too).
+                    // Queue the live preview so the edit shows on the camera this frame. A shared field also
+                    // pushes its new value into every other preset (broadcast_field marks dirty too).
                     if (store.is_field_shared(field.key))
                     {
                         store.broadcast_field(field.key);
                     }
                     else
                     {
-                        store.mark_dirty();
+                        store.mark_field_dirty(field);
                     }
                 }
 
@@ -933,6 +953,385 @@ namespace TPVCamera::Overlay
                           "Off: 3 decimals for finer control. Stored in the presets JSON; Save to keep it.");
         }
 
+        /**
+         * @brief Leading indent for a profiler row: the frame total flush left, the detour's direct stages one step
+         *        in, and the collision stages nested in offset_game_view_camera two steps in.
+         */
+        [[nodiscard]] const char *stage_name_indent(Profiler::Stage stage) noexcept
+        {
+            switch (stage)
+            {
+            case Profiler::Stage::FrustumBuild:
+                return "";
+            case Profiler::Stage::PlayerBounds:
+            case Profiler::Stage::RayFan:
+            case Profiler::Stage::Coverage:
+            case Profiler::Stage::SphereSweep:
+            case Profiler::Stage::RenderOcclusion:
+            case Profiler::Stage::LateralProbe:
+                return "    ";
+            default:
+                return "  ";
+            }
+        }
+
+        /**
+         * @brief Renders the Performance section: per-stage frustum-detour timings (p50 / p99 / max).
+         * @details Reads the rolling windows kept by Profiler (frame_profiler.hpp). The Enable checkbox writes the
+         *          same live atomic as [Advanced] EnableProfiler, so it takes effect on the next frame but is not
+         *          written back to the INI (the INI value applies again on the next load / hot-reload). Each row
+         *          is the stage's cost per FRAME it ran in, so the nested collision stages sum toward
+         *          offset_game_view_camera and everything sums toward the total. A stage the static-world
+         *          throttle skipped has no sample that frame, so its percentiles describe the frames that paid it.
+         */
+        /// Fault / fallback counters (Health), inside the Performance section; always live like the caches above.
+        void draw_health()
+        {
+            if (!ImGui::TreeNode("Health"))
+            {
+                return;
+            }
+            const Health::Stats hs = Health::stats();
+            constexpr ImGuiTableFlags k_table_flags =
+                ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit;
+            if (ImGui::BeginTable("##health", 3, k_table_flags))
+            {
+                ImGui::TableSetupColumn("Site");
+                ImGui::TableSetupColumn("total");
+                ImGui::TableSetupColumn("per s");
+                ImGui::TableHeadersRow();
+                for (std::size_t i = 0; i < Health::k_site_count; ++i)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(Health::site_name(static_cast<Health::Site>(i)));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", static_cast<unsigned long long>(hs.total[i]));
+                    ImGui::TableNextColumn();
+                    if (hs.per_second[i] > 0.0f)
+                    {
+                        ImGui::Text("%.1f", hs.per_second[i]);
+                    }
+                    else
+                    {
+                        ImGui::TextDisabled("0");
+                    }
+                }
+                ImGui::EndTable();
+            }
+            ImGui::TextUnformatted("Frames by slow paths taken:");
+            for (std::size_t i = 0; i < Health::k_histogram_buckets; ++i)
+            {
+                ImGui::SameLine();
+                ImGui::Text("%s: %llu", Health::bucket_name(i), static_cast<unsigned long long>(hs.histogram[i]));
+            }
+            hover_tooltip("How often the mod caught a fault in game memory or fell back to a slower or coarser "
+                          "check, since the game started. Bind [Settings] DumpHealthKey to write these to the log.");
+            if (ImGui::SmallButton("Write to log"))
+            {
+                Health::dump_to_log();
+            }
+            ImGui::TreePop();
+        }
+
+        /// Cells drawn each side of the player in the heatmap minimap (a 33 x 33 cell, 66 m square window).
+        constexpr int k_heatmap_radius = 16;
+
+        /**
+         * @brief Collision cost heatmap (CollisionHeatmap), inside the Performance section: a north-up minimap of
+         *        the cells around the player, shaded green to red by mean collision cost relative to the window's
+         *        most expensive cell. Hovering a cell shows its numbers and the collider of its worst frame.
+         */
+        void draw_collision_heatmap()
+        {
+            if (!ImGui::TreeNode("Collision heatmap"))
+            {
+                return;
+            }
+            LiveSettings &live = settings();
+            bool on = live.collision_heatmap.load(std::memory_order_relaxed);
+            if (ImGui::Checkbox("Record", &on))
+            {
+                live.collision_heatmap.store(on, std::memory_order_relaxed);
+            }
+            hover_tooltip("Time the camera collision every frame into 2 m squares around where you walk, like "
+                          "[Advanced] CollisionHeatmap. Not written back to the INI.");
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Export"))
+            {
+                (void)CollisionHeatmap::export_csv();
+            }
+            hover_tooltip("Write every square to TPVCamera_heatmap_<date>_<time>.csv next to the log, worst first, "
+                          "with the camera arm of its worst frame.");
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Reset"))
+            {
+                CollisionHeatmap::reset();
+            }
+            const CollisionHeatmap::Stats hs = CollisionHeatmap::stats();
+            ImGui::SameLine();
+            ImGui::TextDisabled("%zu / %zu cells", hs.cells, CollisionHeatmap::k_capacity);
+            if (hs.dropped > 0)
+            {
+                ImGui::SameLine();
+                ImGui::TextDisabled("(%llu dropped)", static_cast<unsigned long long>(hs.dropped));
+            }
+
+            constexpr int k_side = 2 * k_heatmap_radius + 1;
+            static std::vector<CollisionHeatmap::Cell> s_window(static_cast<std::size_t>(k_side * k_side));
+            if (!CollisionHeatmap::cells_around(k_heatmap_radius, s_window.data()))
+            {
+                ImGui::TextDisabled("Nothing recorded yet.");
+                ImGui::TreePop();
+                return;
+            }
+            float worst_mean = 0.0f;
+            for (const CollisionHeatmap::Cell &c : s_window)
+            {
+                if (c.frames != 0)
+                {
+                    worst_mean = (std::max)(worst_mean, c.total_us / static_cast<float>(c.frames));
+                }
+            }
+
+            const float cell_px = (std::max)(4.0f, std::floor(ImGui::GetFontSize() * 0.5f));
+            const float map_px = cell_px * static_cast<float>(k_side);
+            const ImVec2 origin = ImGui::GetCursorScreenPos();
+            ImGui::InvisibleButton("##heatmap", ImVec2(map_px, map_px));
+            const bool hovered = ImGui::IsItemHovered();
+            ImDrawList *draw = ImGui::GetWindowDrawList();
+            draw->AddRectFilled(origin, ImVec2(origin.x + map_px, origin.y + map_px),
+                                ImGui::GetColorU32(ImGuiCol_FrameBg));
+            for (int row = 0; row < k_side; ++row)
+            {
+                for (int col = 0; col < k_side; ++col)
+                {
+                    const CollisionHeatmap::Cell &c = s_window[static_cast<std::size_t>(row * k_side + col)];
+                    if (c.frames == 0)
+                    {
+                        continue;
+                    }
+                    const float mean = c.total_us / static_cast<float>(c.frames);
+                    const float t = worst_mean > 0.0f ? std::clamp(mean / worst_mean, 0.0f, 1.0f) : 0.0f;
+                    const ImU32 color = IM_COL32(static_cast<int>(255.0f * (std::min)(1.0f, 2.0f * t)),
+                                                 static_cast<int>(255.0f * (std::min)(1.0f, 2.0f - 2.0f * t)), 0,
+                                                 220);
+                    const ImVec2 a(origin.x + static_cast<float>(col) * cell_px,
+                                   origin.y + static_cast<float>(row) * cell_px);
+                    draw->AddRectFilled(a, ImVec2(a.x + cell_px - 1.0f, a.y + cell_px - 1.0f), color);
+                }
+            }
+            // The player's cell is the centre of the window.
+            const ImVec2 centre(origin.x + (static_cast<float>(k_heatmap_radius) + 0.5f) * cell_px,
+                                origin.y + (static_cast<float>(k_heatmap_radius) + 0.5f) * cell_px);
+            draw->AddCircle(centre, cell_px * 0.9f, ImGui::GetColorU32(ImGuiCol_Text), 12, 1.5f);
+
+            if (hovered)
+            {
+                const ImVec2 mouse = ImGui::GetIO().MousePos;
+                const int col = std::clamp(static_cast<int>((mouse.x - origin.x) / cell_px), 0, k_side - 1);
+                const int row = std::clamp(static_cast<int>((mouse.y - origin.y) / cell_px), 0, k_side - 1);
+                const CollisionHeatmap::Cell &c = s_window[static_cast<std::size_t>(row * k_side + col)];
+                ImGui::BeginTooltip();
+                ImGui::Text("Cell %.0f, %.0f", static_cast<float>(c.ix) * CollisionHeatmap::k_cell_metres,
+                            static_cast<float>(c.iy) * CollisionHeatmap::k_cell_metres);
+                if (c.frames == 0)
+                {
+                    ImGui::TextDisabled("not visited");
+                }
+                else
+                {
+                    ImGui::Text("%u frames, mean %.1f us, worst %.1f us", c.frames,
+                                c.total_us / static_cast<float>(c.frames), c.max_us);
+                    ImGui::Text("Worst against: %s", c.name[0] != '\0' ? c.name : (c.collider != 0 ? "?" : "-"));
+                }
+                ImGui::EndTooltip();
+            }
+            ImGui::TreePop();
+        }
+
+        void draw_performance()
+        {
+            if (!ImGui::CollapsingHeader("Performance"))
+            {
+                return;
+            }
+            request_frame_within(k_performance_refresh_ms);
+#if !TPVCAMERA_ENABLE_PROFILER
+            ImGui::TextDisabled("Profiler compiled out (TPVCAMERA_ENABLE_PROFILER=OFF).");
+#else
+            LiveSettings &live = settings();
+            bool on = live.enable_profiler.load(std::memory_order_relaxed);
+            if (ImGui::Checkbox("Enable frame profiler", &on))
+            {
+                live.enable_profiler.store(on, std::memory_order_relaxed);
+            }
+            hover_tooltip("Time each stage of the camera detour on the render thread. Costs a few timer reads per
+"
+                          "frame while on. Session only; set [Advanced] EnableProfiler in the INI to keep it.");
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Reset"))
+            {
+                Profiler::reset();
+            }
+            hover_tooltip("Drop the recorded samples and start a fresh window.");
+
+            constexpr ImGuiTableFlags k_table_flags =
+                ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit;
+            if (ImGui::BeginTable("##profiler", 6, k_table_flags))
+            {
+                ImGui::TableSetupColumn("Stage");
+                ImGui::TableSetupColumn("p50 us");
+                ImGui::TableSetupColumn("p99 us");
+                ImGui::TableSetupColumn("max us");
+                ImGui::TableSetupColumn("calls");
+                ImGui::TableSetupColumn("frames");
+                ImGui::TableHeadersRow();
+                for (std::size_t i = 0; i < Profiler::k_stage_count; ++i)
+                {
+                    const auto stage = static_cast<Profiler::Stage>(i);
+                    const Profiler::StageStats st = Profiler::stats(stage);
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    // Indent the nested stages under the frame total so the hierarchy reads at a glance.
+                    ImGui::TextUnformatted(stage_name_indent(stage));
+                    ImGui::SameLine(0.0f, 0.0f);
+                    ImGui::TextUnformatted(Profiler::stage_name(stage));
+                    if (st.samples == 0)
+                    {
+                        ImGui::TableNextColumn();
+                        ImGui::TextDisabled("-");
+                        ImGui::TableNextColumn();
+                        ImGui::TextDisabled("-");
+                        ImGui::TableNextColumn();
+                        ImGui::TextDisabled("-");
+                        ImGui::TableNextColumn();
+                        ImGui::TextDisabled("-");
+                        ImGui::TableNextColumn();
+                        ImGui::TextDisabled("0");
+                        continue;
+                    }
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f", st.p50_us);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f", st.p99_us);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f", st.max_us);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f", st.calls_per_frame);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%u", st.samples);
+                }
+                ImGui::EndTable();
+            }
+            ImGui::TextDisabled("Per frame, over the last %u sampled frames. 1000 us = 1 ms of frame time.",
+                                static_cast<unsigned>(Profiler::k_window));
+#endif
+
+            // Coverage-cache counters (always live, independent of the profiler) for sizing CoverageCacheSize.
+            const CoverageCache::Stats cc = CoverageCache::stats();
+            const std::uint64_t lookups = cc.hits + cc.misses;
+            ImGui::Text("Coverage cache: %u / %u slots, %.1f%% hits (%llu hits, %llu misses), %llu evictions",
+                        cc.occupied, cc.capacity,
+                        lookups > 0 ? 100.0 * static_cast<double>(cc.hits) / static_cast<double>(lookups) : 0.0,
+                        static_cast<unsigned long long>(cc.hits), static_cast<unsigned long long>(cc.misses),
+                        static_cast<unsigned long long>(cc.evictions));
+            hover_tooltip("Collision coverage measurements reused vs re-measured. Many evictions in busy areas mean "
+                          "[Advanced] CoverageCacheSize is too small.");
+            const CameraRayCacheStats rc = camera_ray_cache_stats();
+            const std::uint64_t rays = rc.reused + rc.cast;
+            ImGui::Text("Camera rays: %.1f%% reused within the frame (%llu reused, %llu cast)",
+                        rays > 0 ? 100.0 * static_cast<double>(rc.reused) / static_cast<double>(rays) : 0.0,
+                        static_cast<unsigned long long>(rc.reused), static_cast<unsigned long long>(rc.cast));
+            hover_tooltip("Unskipped collision rays answered from an identical ray already cast in the same frame "
+                          "instead of a second world query.");
+            const OccluderDb::Stats od = OccluderDb::stats();
+            ImGui::Text("Occluder database: %u known, %llu seeded, %llu scanned, %u new",
+                        od.known, static_cast<unsigned long long>(od.seeded),
+                        static_cast<unsigned long long>(od.scanned), od.learned);
+            hover_tooltip("Brush meshes whose bounds came from KCD2_TPVCamera_occluders.db vs measured live. New "
+                          "ones are added to the file when the game closes.");
+            const FrameArena::Stats fa = FrameArena::stats();
+            ImGui::Text("Frame scratch: peak %.1f / %.0f KB, %u overflow(s)",
+                        static_cast<double>(fa.high_water) / 1024.0, static_cast<double>(fa.capacity) / 1024.0,
+                        fa.overflows);
+#if TPVCAMERA_FRAME_ALLOC_CHECK
+            ImGui::SameLine();
+            ImGui::Text("| render-thread heap allocations: %llu in %u frame(s)",
+                        static_cast<unsigned long long>(fa.heap_allocs), fa.heap_frames);
+#endif
+            hover_tooltip("Per-frame scratch for the octree node lists. An overflow means a collision query ran "
+                          "without candidates that frame.");
+#if TPVCAMERA_ALLOC_STATS
+            const AllocStats::Stats heap = AllocStats::stats();
+            const AllocStats::TagStats &heap_frame =
+                heap.tag[static_cast<std::size_t>(AllocStats::AllocTag::RenderFrame)];
+            ImGui::Text("Heap: %.1f KB live in %lld block(s), render frames %llu alloc(s) %.1f KB",
+                        static_cast<double>(heap.live_bytes) / 1024.0, static_cast<long long>(heap.live_blocks),
+                        static_cast<unsigned long long>(heap_frame.allocs),
+                        static_cast<double>(heap_frame.bytes_allocated) / 1024.0);
+            if (ImGui::IsItemHovered())
+            {
+                ImGui::BeginTooltip();
+                ImGui::TextUnformatted("The module's operator new since launch, by subsystem (allocated / freed):");
+                for (std::size_t i = 0; i < AllocStats::k_tag_count; ++i)
+                {
+                    const AllocStats::TagStats &t = heap.tag[i];
+                    ImGui::Text("%-22s %llu (%.1f KB) / %llu (%.1f KB)",
+                                AllocStats::tag_name(static_cast<AllocStats::AllocTag>(i)),
+                                static_cast<unsigned long long>(t.allocs),
+                                static_cast<double>(t.bytes_allocated) / 1024.0,
+                                static_cast<unsigned long long>(t.frees), static_cast<double>(t.bytes_freed) / 1024.0);
+                }
+                ImGui::EndTooltip();
+            }
+#endif
+            const float overlay_cpu_ms = cpu_ms_per_second();
+            ImGui::Text("Overlay thread: %.1f ms CPU per second (%.1f%% of one core)",
+                        static_cast<double>(overlay_cpu_ms), static_cast<double>(overlay_cpu_ms) / 10.0);
+            hover_tooltip("What drawing this panel costs. Tune with [Advanced] OverlayWarpSingleThreaded, "
+                          "OverlayThreadPriority, OverlayAffinityMask, OverlayEfficiencyCores and "
+                          "OverlayHardwareDevice.");
+            const FrameClock::Stats clock = FrameClock::stats();
+            ImGui::Text("Frame clock: frame %llu at %.1f s, %.2f ms smoothed, %llu hitch(es), %llu outlier(s)",
+                        static_cast<unsigned long long>(clock.now.frame), clock.now.wall_seconds,
+                        static_cast<double>(clock.now.smoothed) * 1000.0,
+                        static_cast<unsigned long long>(clock.hitches),
+                        static_cast<unsigned long long>(clock.outliers));
+            hover_tooltip("Game-view frames the camera has run and its smoothed frame time. A hitch (pause, alt-tab, "
+                          "load) or a stall frame is stepped as a normal frame so the camera does not jump.");
+            const Benchmark::Progress bench = Benchmark::progress();
+            if (bench.running)
+            {
+                ImGui::Text("Benchmark: pass %d / %d, %.0f / %.0f s", bench.pass + 1, Benchmark::k_passes,
+                            static_cast<double>(bench.seconds), static_cast<double>(bench.total_seconds));
+            }
+            else
+            {
+                ImGui::TextDisabled("Benchmark: idle");
+            }
+            hover_tooltip("Scripted camera sweep started (and stopped) with [Settings] BenchmarkKey. Its timings are "
+                          "written next to the log as TPVCamera_benchmark_<date>_<time>.csv and .json.");
+            const int budget_us = settings().collision_budget_us.load(std::memory_order_relaxed);
+            if (budget_us > 0)
+            {
+                ImGui::Text("Collision quality: %s (%.0f us of %d us budget)",
+                            CollisionGovernor::tier_name(CollisionGovernor::tier()), CollisionGovernor::average_us(),
+                            budget_us);
+            }
+            else
+            {
+                ImGui::TextDisabled("Collision quality: Full (no budget)");
+            }
+            hover_tooltip("Level the collision checks currently run at, and their smoothed cost per recompute. Lower "
+                          "levels are cheaper; set [Collision] CollisionBudgetUs to let the mod pick one.");
+            ImGui::Text("RTTI type cache: %u entries", RttiCache::entry_count());
+            hover_tooltip("Remembered (vtable, type) answers. Steady gameplay should stop it growing after a few "
+                          "seconds.");
+            draw_health();
+            draw_collision_heatmap();
+        }
+
     } // namespace
 
     /**
@@ -1004,10 +1403,16 @@ namespace TPVCamera::Overlay
         ImGui::Separator();
         draw_field_editors(store, edited);
 
+        ImGui::Separator();
+        draw_performance();
+
         ImGui::Separator();
         draw_overlay_settings(store);
 
         ImGui::End();
+
+        // Every field edit above queued its preview; the table republish and Save indicator settle once here.
+        store.commit_frame();
     }
 
 } // namespace TPVCamera::Overlay
@@ -0,0 +1,178 @@
+/**
+ * @file pixel_kernels.cpp
+ * @brief Scalar, SSE2 and AVX2 implementations of the overlay premultiply blit (see pixel_kernels.hpp).
+ */
+
+#include "pixel_kernels.hpp"
+#include "vertex_kernels.hpp"
+
+#include <immintrin.h>
+
+#include <cstddef>
+
+namespace TPVCamera::Overlay::PixelKernels
+{
+
+    namespace
+    {
+        constexpr int k_run = 16; // pixels per fast-path run (64 bytes: 4 XMM / 2 YMM)
+
+        // Exact (c * a + 127) / 255 for 8-bit c and a.
+        [[nodiscard]] std::uint8_t premultiply_channel(unsigned c, unsigned a) noexcept
+        {
+            const unsigned t = c * a + 127;
+            return static_cast<std::uint8_t>((t + (t >> 8) + 1) >> 8);
+        }
+
+        void premultiply_scalar(const std::uint8_t *src, std::uint8_t *dst, int pixels) noexcept
+        {
+            for (int i = 0; i < pixels; ++i, src += 4, dst += 4)
+            {
+                const unsigned a = src[3];
+                dst[0] = premultiply_channel(src[0], a);
+                dst[1] = premultiply_channel(src[1], a);
+                dst[2] = premultiply_channel(src[2], a);
+                dst[3] = static_cast<std::uint8_t>(a);
+            }
+        }
+
+        // premultiply_channel on 8 u16 lanes (2 pixels). The alpha lanes multiply by 255, which the identity maps
+        // back to the alpha itself, so the colour and alpha lanes share one instruction sequence.
+        [[nodiscard]] __m128i premultiply_words_sse2(__m128i c) noexcept
+        {
+            const __m128i rgb_mask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+            const __m128i alpha_255 = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+            __m128i a = _mm_shufflelo_epi16(c, _MM_SHUFFLE(3, 3, 3, 3));
+            a = _mm_shufflehi_epi16(a, _MM_SHUFFLE(3, 3, 3, 3));
+            const __m128i m = _mm_or_si128(_mm_and_si128(a, rgb_mask), alpha_255);
+            const __m128i t = _mm_add_epi16(_mm_mullo_epi16(c, m), _mm_set1_epi16(127));
+            const __m128i q = _mm_add_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), _mm_set1_epi16(1));
+            return _mm_srli_epi16(q, 8);
+        }
+
+        [[nodiscard]] __m128i premultiply4_sse2(__m128i px) noexcept
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i lo = premultiply_words_sse2(_mm_unpacklo_epi8(px, zero));
+            const __m128i hi = premultiply_words_sse2(_mm_unpackhi_epi8(px, zero));
+            return _mm_packus_epi16(lo, hi);
+        }
+
+        [[nodiscard]] int premultiply_sse2(const std::uint8_t *src, std::uint8_t *dst, int pixels) noexcept
+        {
+            const __m128i alpha_mask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+            const __m128i zero = _mm_setzero_si128();
+            int i = 0;
+            for (; i + k_run <= pixels; i += k_run)
+            {
+                const auto *s = reinterpret_cast<const __m128i *>(src + static_cast<std::size_t>(i) * 4);
+                auto *d = reinterpret_cast<__m128i *>(dst + static_cast<std::size_t>(i) * 4);
+                const __m128i v0 = _mm_loadu_si128(s + 0);
+                const __m128i v1 = _mm_loadu_si128(s + 1);
+                const __m128i v2 = _mm_loadu_si128(s + 2);
+                const __m128i v3 = _mm_loadu_si128(s + 3);
+                const __m128i all = _mm_and_si128(_mm_and_si128(v0, v1), _mm_and_si128(v2, v3));
+                const __m128i any = _mm_or_si128(_mm_or_si128(v0, v1), _mm_or_si128(v2, v3));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(all, alpha_mask), alpha_mask)) == 0xFFFF)
+                {
+                    _mm_storeu_si128(d + 0, v0);
+                    _mm_storeu_si128(d + 1, v1);
+                    _mm_storeu_si128(d + 2, v2);
+                    _mm_storeu_si128(d + 3, v3);
+                }
+                else if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(any, alpha_mask), zero)) == 0xFFFF)
+                {
+                    _mm_storeu_si128(d + 0, zero);
+                    _mm_storeu_si128(d + 1, zero);
+                    _mm_storeu_si128(d + 2, zero);
+                    _mm_storeu_si128(d + 3, zero);
+                }
+                else
+                {
+                    _mm_storeu_si128(d + 0, premultiply4_sse2(v0));
+                    _mm_storeu_si128(d + 1, premultiply4_sse2(v1));
+                    _mm_storeu_si128(d + 2, premultiply4_sse2(v2));
+                    _mm_storeu_si128(d + 3, premultiply4_sse2(v3));
+                }
+            }
+            for (; i + 4 <= pixels; i += 4)
+            {
+                const auto *s = reinterpret_cast<const __m128i *>(src + static_cast<std::size_t>(i) * 4);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + static_cast<std::size_t>(i) * 4),
+                                 premultiply4_sse2(_mm_loadu_si128(s)));
+            }
+            return i;
+        }
+
+        // The AVX2 unpack / shuffle / pack instructions work within each 128-bit lane, so the 8-pixel form is the
+        // SSE2 sequence run on both halves at once and comes back out in source order.
+        [[nodiscard]] __m256i premultiply_words_avx2(__m256i c) noexcept
+        {
+            const __m256i rgb_mask = _mm256_set_epi16(0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1);
+            const __m256i alpha_255 = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0);
+            __m256i a = _mm256_shufflelo_epi16(c, _MM_SHUFFLE(3, 3, 3, 3));
+            a = _mm256_shufflehi_epi16(a, _MM_SHUFFLE(3, 3, 3, 3));
+            const __m256i m = _mm256_or_si256(_mm256_and_si256(a, rgb_mask), alpha_255);
+            const __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(c, m), _mm256_set1_epi16(127));
+            const __m256i q = _mm256_add_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), _mm256_set1_epi16(1));
+            return _mm256_srli_epi16(q, 8);
+        }
+
+        [[nodiscard]] __m256i premultiply8_avx2(__m256i px) noexcept
+        {
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i lo = premultiply_words_avx2(_mm256_unpacklo_epi8(px, zero));
+            const __m256i hi = premultiply_words_avx2(_mm256_unpackhi_epi8(px, zero));
+            return _mm256_packus_epi16(lo, hi);
+        }
+
+        [[nodiscard]] int premultiply_avx2(const std::uint8_t *src, std::uint8_t *dst, int pixels) noexcept
+        {
+            const __m256i alpha_mask = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+            const __m256i zero = _mm256_setzero_si256();
+            int i = 0;
+            for (; i + k_run <= pixels; i += k_run)
+            {
+                const auto *s = reinterpret_cast<const __m256i *>(src + static_cast<std::size_t>(i) * 4);
+                auto *d = reinterpret_cast<__m256i *>(dst + static_cast<std::size_t>(i) * 4);
+                const __m256i v0 = _mm256_loadu_si256(s + 0);
+                const __m256i v1 = _mm256_loadu_si256(s + 1);
+                const __m256i all = _mm256_and_si256(_mm256_and_si256(v0, v1), alpha_mask);
+                const __m256i any = _mm256_and_si256(_mm256_or_si256(v0, v1), alpha_mask);
+                if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(all, alpha_mask)) == -1)
+                {
+                    _mm256_storeu_si256(d + 0, v0);
+                    _mm256_storeu_si256(d + 1, v1);
+                }
+                else if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(any, zero)) == -1)
+                {
+                    _mm256_storeu_si256(d + 0, zero);
+                    _mm256_storeu_si256(d + 1, zero);
+                }
+                else
+                {
+                    _mm256_storeu_si256(d + 0, premultiply8_avx2(v0));
+                    _mm256_storeu_si256(d + 1, premultiply8_avx2(v1));
+                }
+            }
+            // Leave the VEX state clean before the SSE2 tail and the caller's non-VEX code.
+            _mm256_zeroupper();
+            return i;
+        }
+
+    } // namespace
+
+    void premultiply_copy(const std::uint8_t *src, std::uint8_t *dst, int pixels) noexcept
+    {
+        if (pixels <= 0)
+        {
+            return;
+        }
+        int done = VertexKernels::avx2_active() ? premultiply_avx2(src, dst, pixels) : 0;
+        done += premultiply_sse2(src + static_cast<std::size_t>(done) * 4, dst + static_cast<std::size_t>(done) * 4,
+                                 pixels - done);
+        premultiply_scalar(src + static_cast<std::size_t>(done) * 4, dst + static_cast<std::size_t>(done) * 4,
+                           pixels - done);
+    }
+
+} // namespace TPVCamera::Overlay::PixelKernels
@@ -0,0 +1,32 @@
+/**
+ * @file pixel_kernels.hpp
+ * @brief Fused copy + alpha-premultiply kernel for the overlay's staging -> DIB blit.
+ *
+ * @details UpdateLayeredWindowIndirect with AC_SRC_ALPHA wants premultiplied BGRA, while ImGui renders straight
+ *          alpha. Every composite therefore runs each dirty pixel through c' = (c * a + 127) / 255, and a full
+ *          panel at 4K is millions of them on a thread that already competes with the game. The kernel reads the
+ *          mapped staging row once and writes the DIB row once: 16 pixels per step, with whole-run fast paths for
+ *          fully opaque (plain copy) and fully transparent (zero store) runs, which cover most of an ImGui frame.
+ *          Mixed runs go through SSE2 (always present on x64) or, when VertexKernels::avx2_active(), AVX2.
+ *
+ *          The divide is done with the multiply-shift identity t / 255 == (t + (t >> 8) + 1) >> 8, which is exact
+ *          for every t = c * a + 127 the 8-bit inputs can produce, so the SIMD paths and the scalar tail are
+ *          bit-identical to the per-pixel loop they replace. The alpha byte passes through unchanged.
+ */
+#ifndef TPVCAMERA_OVERLAY_PIXEL_KERNELS_HPP
+#define TPVCAMERA_OVERLAY_PIXEL_KERNELS_HPP
+
+#include <cstdint>
+
+namespace TPVCamera::Overlay::PixelKernels
+{
+
+    /**
+     * @brief Copies @p pixels BGRA pixels from @p src to @p dst, premultiplying colour by alpha.
+     * @details The ranges must not overlap; neither needs any alignment.
+     */
+    void premultiply_copy(const std::uint8_t *src, std::uint8_t *dst, int pixels) noexcept;
+
+} // namespace TPVCamera::Overlay::PixelKernels
+
+#endif // TPVCAMERA_OVERLAY_PIXEL_KERNELS_HPP
@@ -4,18 +4,29 @@
  */
 
 #include "physics_raycast.hpp"
+#include "alloc_stats.hpp"
 #include "aob_resolver.hpp"
 #include "constants.hpp"
 #include "global_state.hpp"
+#include "health.hpp"
+#include "hot_block.hpp"
+#include "seh_region.hpp"
+#include "simd_math.hpp"
+#include "thread_join.hpp"
 
 #include <DetourModKit.hpp>
 
 #include <windows.h>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <cstring>
 #include <intrin.h>
+#include <mutex>
+#include <numeric>
+#include <utility>
 
 namespace TPVCamera
 {
@@ -27,19 +38,18 @@ namespace TPVCamera
                                                      void *skip_ents, int num_skip_ents, void *foreign_data,
                                                      int foreign_index, const char *name_tag);
 
-    static RayWorldIntersectionFn s_ray_world_intersection = nullptr;
-
-    // Address of the IPhysicalWorld* global (read fresh per ray, not cached: it is null until a
-    // level loads and is replaced across level transitions).
-    static uintptr_t s_physical_world_global_addr = 0;
-
-    // Mapped range of the scanned game module (WHGame.dll), captured once at init. The sphere-sweep path
-    // confirms a freshly resolved world vtable / PWI function pointer lives inside the game image with a
-    // branch-only contains() test (no syscall): a stale or reallocated world pointer yields a vtable slot
-    // that does not point into the image, and calling through it must be rejected before the indirect call.
-    static DMK::Memory::ModuleRange s_game_module{};
+    // The helper and the address of the IPhysicalWorld* global live in the detour hot block (hot_block.hpp). The
+    // global is read fresh per ray, not cached: it is null until a level loads and is replaced across level
+    // transitions. The sphere-sweep path confirms a freshly resolved world vtable / PWI function pointer lives
+    // inside the game image with the hot block's branch-only in_game_module() test (no syscall): a stale or
+    // reallocated world pointer yields a vtable slot that does not point into the image, and calling through it
+    // must be rejected before the indirect call.
+    [[nodiscard]] static RayWorldIntersectionFn ray_world_intersection() noexcept
+    {
+        return reinterpret_cast<RayWorldIntersectionFn>(detour_hot_block().ray_world_intersection);
+    }
 
-    bool initialize_physics_raycast(uintptr_t module_base, size_t module_size, uintptr_t g_env)
+    bool initialize_physics_raycast(uintptr_t g_env)
     {
         DMK::Logger &logger = DMK::Logger::get_instance();
 
@@ -53,17 +63,99 @@ namespace TPVCamera
             return false;
         }
 
-        s_ray_world_intersection = reinterpret_cast<RayWorldIntersectionFn>(ray_fn);
+        DetourHotBlock &hot = detour_hot_block();
+        hot.ray_world_intersection = reinterpret_cast<void *>(ray_fn);
         // p_physical_world is a member of the g_env struct (see PHYSICAL_WORLD_OFFSET); deriving its
         // slot from the patch-resiliently resolved g_env base avoids a second hardcoded address.
-        s_physical_world_global_addr = g_env + Constants::PHYSICAL_WORLD_OFFSET;
-        s_game_module = {module_base, module_base + module_size};
+        hot.physical_world_slot = g_env + Constants::PHYSICAL_WORLD_OFFSET;
 
         logger.info("PhysicsRaycast: RayWorldIntersection at {}, p_physical_world slot at {}",
-                    DMK::Format::format_address(ray_fn), DMK::Format::format_address(s_physical_world_global_addr));
+                    DMK::Format::format_address(ray_fn), DMK::Format::format_address(hot.physical_world_slot));
         return true;
     }
 
+    // Per-frame camera ray cache (see open_camera_ray_cache). Its table is render-thread state: only the thread that
+    // opened it (t_ray_cache_open) reads or writes it, so the collision worker's rays never see it. The guarded
+    // engine calls raise t_ray_faulted, and a call that faulted stores nothing, so a fault's "no hit" is never
+    // replayed to a later identical ray of the frame.
+    namespace
+    {
+        struct CachedRay
+        {
+            Vector3 origin{};
+            Vector3 direction{};
+            int objtypes{0};
+            unsigned int flags{0};
+            std::optional<RayHit> hit{};
+        };
+
+        // A recomputing frame casts a handful of distinct unskipped rays (the centre ray, the fan's sides, the
+        // lateral probes, the coverage grid); past this the oldest entry is replaced.
+        constexpr size_t k_ray_cache_slots = 32;
+        // Origin and direction match within 1 mm: the repeats are the same vectors recomputed, not neighbours.
+        constexpr float k_ray_cache_tol2 = 1e-3f * 1e-3f;
+
+        CachedRay s_ray_cache[k_ray_cache_slots];
+        size_t s_ray_cache_count = 0;
+        size_t s_ray_cache_next = 0;
+        thread_local bool t_ray_cache_open = false;
+        thread_local bool t_ray_faulted = false;
+
+        std::atomic<std::uint64_t> s_ray_cache_reused{0};
+        std::atomic<std::uint64_t> s_ray_cache_cast{0};
+
+        /// True when the calling thread has the cache open and the ray is cacheable (no skip list).
+        bool ray_cacheable(const uintptr_t *skip_ents, int n_skip_ents) noexcept
+        {
+            return t_ray_cache_open && (skip_ents == nullptr || n_skip_ents <= 0);
+        }
+
+        const CachedRay *find_cached_ray(const Vector3 &origin, const Vector3 &direction, int objtypes,
+                                         unsigned int flags) noexcept
+        {
+            for (size_t i = 0; i < s_ray_cache_count; ++i)
+            {
+                const CachedRay &c = s_ray_cache[i];
+                if (c.objtypes == objtypes && c.flags == flags &&
+                    (c.origin - origin).magnitude_squared() <= k_ray_cache_tol2 &&
+                    (c.direction - direction).magnitude_squared() <= k_ray_cache_tol2)
+                {
+                    return &c;
+                }
+            }
+            return nullptr;
+        }
+
+        void store_cached_ray(const Vector3 &origin, const Vector3 &direction, int objtypes, unsigned int flags,
+                              const std::optional<RayHit> &hit) noexcept
+        {
+            CachedRay &c = s_ray_cache[s_ray_cache_next];
+            c = CachedRay{origin, direction, objtypes, flags, hit};
+            s_ray_cache_next = (s_ray_cache_next + 1) % k_ray_cache_slots;
+            s_ray_cache_count = std::min(s_ray_cache_count + 1, k_ray_cache_slots);
+        }
+    } // namespace
+
+    void open_camera_ray_cache() noexcept
+    {
+        s_ray_cache_count = 0;
+        s_ray_cache_next = 0;
+        t_ray_cache_open = true;
+    }
+
+    void close_camera_ray_cache() noexcept
+    {
+        t_ray_cache_open = false;
+    }
+
+    CameraRayCacheStats camera_ray_cache_stats() noexcept
+    {
+        CameraRayCacheStats s;
+        s.reused = s_ray_cache_reused.load(std::memory_order_relaxed);
+        s.cast = s_ray_cache_cast.load(std::memory_order_relaxed);
+        return s;
+    }
+
     /**
      * @brief SEH-isolated engine call. Held apart from the C++ caller so the structured
      *        handler shares no frame with object unwinding; a fault becomes "no hit".
@@ -74,41 +166,40 @@ namespace TPVCamera
     {
         __try
         {
-            return s_ray_world_intersection(physical_world, org, dir, objtypes, flags, hits, 1, skip_ents, n_skip_ents,
+            return ray_world_intersection()(physical_world, org, dir, objtypes, flags, hits, 1, skip_ents, n_skip_ents,
                                             nullptr, 0, "TPVCameraRay");
         }
         __except (EXCEPTION_EXECUTE_HANDLER)
         {
+            Health::note(Health::Site::RayFault);
+            t_ray_faulted = true;
             return 0;
         }
     }
 
-    std::optional<RayHit> ray_world_intersection(const Vector3 &origin, const Vector3 &direction, int objtypes,
-                                                 unsigned int flags, const uintptr_t *skip_ents, int n_skip_ents)
+    /**
+     * @brief Reads the live IPhysicalWorld* from its g_env slot.
+     * @return The world pointer, or 0 while it is null / implausible (no level, loading) or raycast is unresolved.
+     */
+    static uintptr_t resolve_physical_world()
     {
-        if (s_ray_world_intersection == nullptr || s_physical_world_global_addr == 0)
+        const DetourHotBlock &hot = detour_hot_block();
+        if (hot.ray_world_intersection == nullptr || hot.physical_world_slot == 0)
         {
-            return std::nullopt;
+            return 0;
         }
-
-        // Resolve the physical world fresh; bail cleanly while it is null (no level / loading).
-        const auto world_value = DMK::Memory::seh_read<uintptr_t>(s_physical_world_global_addr);
+        // Resolve the physical world fresh (per call, not cached); bail cleanly while it is null (no level).
+        const auto world_value = SehRegion::read<uintptr_t>(hot.physical_world_slot);
         if (!world_value || *world_value == 0 || !DMK::Memory::plausible_userspace_ptr(*world_value))
         {
-            return std::nullopt;
-        }
-
-        alignas(16) std::byte hit_buffer[Constants::RAY_HIT_SIZE];
-        std::memset(hit_buffer, 0, sizeof(hit_buffer));
-
-        const int hit_count = ray_world_intersection_guarded(
-            reinterpret_cast<void *>(*world_value), &origin, &direction, objtypes, flags, hit_buffer,
-            const_cast<uintptr_t *>(skip_ents), (skip_ents != nullptr) ? n_skip_ents : 0);
-        if (hit_count < 1)
-        {
-            return std::nullopt;
+            return 0;
         }
+        return *world_value;
+    }
 
+    /// Decodes the engine ray_hit at @p hit_buffer (RAY_HIT_SIZE bytes) into a RayHit.
+    static RayHit decode_ray_hit(const std::byte *hit_buffer)
+    {
         RayHit hit{};
         hit.m_distance = *reinterpret_cast<const float *>(hit_buffer + Constants::RAY_HIT_OFFSET_DISTANCE);
         hit.m_point = *reinterpret_cast<const Vector3 *>(hit_buffer + Constants::RAY_HIT_OFFSET_POINT);
@@ -118,26 +209,189 @@ namespace TPVCamera
         return hit;
     }
 
-    // IPhysicalWorld::PrimitiveWorldIntersection (consolidated SPWIParams form). The float return value
-    // is the distance to first contact for a sweep; resolved from the live world vtable (see constants).
-    using PrimitiveWorldIntersectionFn = float(__fastcall *)(void *physical_world, void *pp, void *p_lock_contacts,
-                                                             const char *name_tag);
+    // ray_world_intersection's body: the world read and the engine call are inline inside a region body
+    // (SehRegion::run) and guarded one by one otherwise. No lock and no object with a destructor, so it may run as
+    // a region body.
+    static std::optional<RayHit> ray_world_intersection_body(const Vector3 &origin, const Vector3 &direction,
+                                                             int objtypes, unsigned int flags,
+                                                             const uintptr_t *skip_ents, int n_skip_ents)
+    {
+        const bool cacheable = ray_cacheable(skip_ents, n_skip_ents);
+        if (cacheable)
+        {
+            if (const CachedRay *c = find_cached_ray(origin, direction, objtypes, flags))
+            {
+                s_ray_cache_reused.fetch_add(1, std::memory_order_relaxed);
+                return c->hit;
+            }
+        }
+        const uintptr_t world = resolve_physical_world();
+        if (world == 0)
+        {
+            return std::nullopt;
+        }
+
+        alignas(16) std::byte hit_buffer[Constants::RAY_HIT_SIZE];
+        std::memset(hit_buffer, 0, sizeof(hit_buffer));
+
+        // Inside a region body (CollisionSehRegion, see seh_region.hpp) the engine call is made inline; its fault
+        // lands in SehRegion::run, which returns "no hit". Otherwise it runs in its own guard.
+        void *const skip = const_cast<uintptr_t *>(skip_ents);
+        const int n_skip = (skip_ents != nullptr) ? n_skip_ents : 0;
+        t_ray_faulted = false;
+        const int hit_count =
+            SehRegion::active()
+                ? ray_world_intersection()(reinterpret_cast<void *>(world), &origin, &direction, objtypes, flags,
+                                           hit_buffer, 1, skip, n_skip, nullptr, 0, "TPVCameraRay")
+                : ray_world_intersection_guarded(reinterpret_cast<void *>(world), &origin, &direction, objtypes,
+                                                 flags, hit_buffer, skip, n_skip);
+        const std::optional<RayHit> hit =
+            hit_count >= 1 ? std::optional<RayHit>(decode_ray_hit(hit_buffer)) : std::nullopt;
+        if (cacheable && !std::exchange(t_ray_faulted, false))
+        {
+            s_ray_cache_cast.fetch_add(1, std::memory_order_relaxed);
+            store_cached_ray(origin, direction, objtypes, flags, hit);
+        }
+        return hit;
+    }
+
+    std::optional<RayHit> ray_world_intersection(const Vector3 &origin, const Vector3 &direction, int objtypes,
+                                                 unsigned int flags, const uintptr_t *skip_ents, int n_skip_ents)
+    {
+        if (SehRegion::available())
+        {
+            auto body = [&]
+            { return ray_world_intersection_body(origin, direction, objtypes, flags, skip_ents, n_skip_ents); };
+            return SehRegion::run(std::optional<RayHit>{}, body);
+        }
+        return ray_world_intersection_body(origin, direction, objtypes, flags, skip_ents, n_skip_ents);
+    }
+
+    // Rays cast per SEH frame by the batch path: covers the coverage sampler (12) and the fan (5) in one chunk,
+    // while keeping the hit buffers a small fixed stack block (16 x RAY_HIT_SIZE = 1.25 KB).
+    static constexpr size_t k_ray_batch_chunk = 16;
 
     /**
-     * @brief SEH-isolated PWI engine call, held apart from the C++ caller so a fault becomes "no hit".
+     * @brief SEH-isolated loop of engine ray calls for one chunk. POD-only body (RaySpec has no destructor) so the
+     *        structured handler shares no frame with object unwinding. @p counts must be zeroed by the caller; a
+     *        fault leaves the faulting ray and every later one at 0 (a miss).
      */
-    static float primitive_world_intersection_guarded(PrimitiveWorldIntersectionFn fn, void *world, void *pp)
+    static void ray_world_intersection_chunk_guarded(void *physical_world, const RaySpec *rays, size_t n,
+                                                     std::byte (*hits)[Constants::RAY_HIT_SIZE], int *counts) noexcept
     {
+        const RayWorldIntersectionFn ray_fn = ray_world_intersection();
         __try
         {
-            return fn(world, pp, nullptr, "TPVCameraSweep");
+            for (size_t i = 0; i < n; ++i)
+            {
+                const RaySpec &r = rays[i];
+                const int n_skip = (r.m_skip_ents != nullptr) ? r.m_n_skip_ents : 0;
+                counts[i] = ray_fn(physical_world, &r.m_origin, &r.m_direction, r.m_objtypes, r.m_flags, hits[i], 1,
+                                   const_cast<uintptr_t *>(r.m_skip_ents), n_skip, nullptr, 0, "TPVCameraRay");
+            }
         }
         __except (EXCEPTION_EXECUTE_HANDLER)
         {
-            return 0.0f;
+            Health::note(Health::Site::RayFault);
+            t_ray_faulted = true;
+        }
+    }
+
+    /// The loop of ray_world_intersection_chunk_guarded without its guard, for use inside an outer SEH region.
+    static void ray_world_intersection_chunk_raw(void *physical_world, const RaySpec *rays, size_t n,
+                                                 std::byte (*hits)[Constants::RAY_HIT_SIZE], int *counts) noexcept
+    {
+        const RayWorldIntersectionFn ray_fn = ray_world_intersection();
+        for (size_t i = 0; i < n; ++i)
+        {
+            const RaySpec &r = rays[i];
+            const int n_skip = (r.m_skip_ents != nullptr) ? r.m_n_skip_ents : 0;
+            counts[i] = ray_fn(physical_world, &r.m_origin, &r.m_direction, r.m_objtypes, r.m_flags, hits[i], 1,
+                               const_cast<uintptr_t *>(r.m_skip_ents), n_skip, nullptr, 0, "TPVCameraRay");
         }
     }
 
+    int ray_world_intersection_batch(std::span<const RaySpec> rays, std::span<std::optional<RayHit>> out)
+    {
+        const size_t n = std::min(rays.size(), out.size());
+        for (size_t i = 0; i < n; ++i)
+        {
+            out[i].reset();
+        }
+        const uintptr_t world = resolve_physical_world();
+        if (world == 0 || n == 0)
+        {
+            return 0;
+        }
+
+        // With the camera ray cache open, a ray already cast this frame is answered from it and only the rest go
+        // to the engine, still as one guarded chunk.
+        int hit_total = 0;
+        alignas(16) std::byte hits[k_ray_batch_chunk][Constants::RAY_HIT_SIZE];
+        int counts[k_ray_batch_chunk];
+        RaySpec pending[k_ray_batch_chunk];
+        size_t pending_index[k_ray_batch_chunk];
+        for (size_t base = 0; base < n; base += k_ray_batch_chunk)
+        {
+            const size_t chunk = std::min(k_ray_batch_chunk, n - base);
+            size_t m = 0;
+            for (size_t i = 0; i < chunk; ++i)
+            {
+                const RaySpec &r = rays[base + i];
+                if (ray_cacheable(r.m_skip_ents, r.m_n_skip_ents))
+                {
+                    if (const CachedRay *c = find_cached_ray(r.m_origin, r.m_direction, r.m_objtypes, r.m_flags))
+                    {
+                        s_ray_cache_reused.fetch_add(1, std::memory_order_relaxed);
+                        out[base + i] = c->hit;
+                        hit_total += c->hit.has_value() ? 1 : 0;
+                        continue;
+                    }
+                }
+                pending[m] = r;
+                pending_index[m] = base + i;
+                ++m;
+            }
+            if (m == 0)
+            {
+                continue;
+            }
+            std::memset(hits, 0, sizeof(hits[0]) * m);
+            std::memset(counts, 0, sizeof(counts[0]) * m);
+            t_ray_faulted = false;
+            if (SehRegion::active())
+            {
+                ray_world_intersection_chunk_raw(reinterpret_cast<void *>(world), pending, m, hits, counts);
+            }
+            else
+            {
+                ray_world_intersection_chunk_guarded(reinterpret_cast<void *>(world), pending, m, hits, counts);
+            }
+            const bool faulted = std::exchange(t_ray_faulted, false);
+            for (size_t i = 0; i < m; ++i)
+            {
+                std::optional<RayHit> &dst = out[pending_index[i]];
+                if (counts[i] >= 1)
+                {
+                    dst = decode_ray_hit(hits[i]);
+                    ++hit_total;
+                }
+                const RaySpec &r = pending[i];
+                if (!faulted && ray_cacheable(r.m_skip_ents, r.m_n_skip_ents))
+                {
+                    s_ray_cache_cast.fetch_add(1, std::memory_order_relaxed);
+                    store_cached_ray(r.m_origin, r.m_direction, r.m_objtypes, r.m_flags, dst);
+                }
+            }
+        }
+        return hit_total;
+    }
+
+    // IPhysicalWorld::PrimitiveWorldIntersection (consolidated SPWIParams form). The float return value
+    // is the distance to first contact for a sweep; resolved from the live world vtable (see constants).
+    using PrimitiveWorldIntersectionFn = float(__fastcall *)(void *physical_world, void *pp, void *p_lock_contacts,
+                                                             const char *name_tag);
+
     /**
      * @brief Releases the SPWIParams WriteLockCond (InterlockedAdd(prw, -iActive)) under an SEH frame.
      * @details The engine repoints prw and sets iActive only when it took the real global world lock;
@@ -146,20 +400,54 @@ namespace TPVCamera
      *          prw (the world counter concurrently invalidated) would fault on the atomic store, so the
      *          store runs under __try. POD-only body so the SEH frame shares no C++ unwinding.
      */
+    static void release_spwi_write_lock(std::byte *params) noexcept
+    {
+        auto *prw = *reinterpret_cast<volatile long **>(params + Constants::SPWI_OFF_LOCK_PRW);
+        const long active = *reinterpret_cast<volatile long *>(params + Constants::SPWI_OFF_LOCK_IACTIVE);
+        if (prw && DMK::Memory::plausible_userspace_ptr(reinterpret_cast<uintptr_t>(prw)) && active != 0)
+        {
+            _InterlockedExchangeAdd(prw, -active);
+        }
+    }
+
     static void release_spwi_write_lock_guarded(std::byte *params) noexcept
     {
         __try
         {
-            auto *prw = *reinterpret_cast<volatile long **>(params + Constants::SPWI_OFF_LOCK_PRW);
-            const long active = *reinterpret_cast<volatile long *>(params + Constants::SPWI_OFF_LOCK_IACTIVE);
-            if (prw && DMK::Memory::plausible_userspace_ptr(reinterpret_cast<uintptr_t>(prw)) && active != 0)
-            {
-                _InterlockedExchangeAdd(prw, -active);
-            }
+            release_spwi_write_lock(params);
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+        }
+    }
+
+    /**
+     * @brief SEH-isolated PWI engine call plus its WriteLockCond release, held apart from the C++ caller so a fault
+     *        becomes "no hit".
+     * @details Always used, region mode or not: the release must run after the call even when the call faults (the
+     *          engine may have taken the real world lock), so the call never runs inline in a region body whose
+     *          fault would skip it. POD-only body.
+     */
+    static float primitive_world_intersection_guarded(PrimitiveWorldIntersectionFn fn, void *world,
+                                                      std::byte *params) noexcept
+    {
+        float distance = 0.0f;
+        __try
+        {
+            distance = fn(world, params, nullptr, "TPVCameraSweep");
         }
         __except (EXCEPTION_EXECUTE_HANDLER)
         {
+            Health::note(Health::Site::SweepFault);
+            distance = 0.0f;
         }
+        // Release the WriteLockCond exactly as the engine's own caller does: InterlockedAdd(prw, -iActive),
+        // reading both back from the struct AFTER the call. If the engine took a real (global) lock it repointed
+        // prw and set iActive, so this frees it (preventing a physics-thread stall); if it stayed in thread-safe
+        // self-pointer mode, iActive is 0 and this is a no-op. Runs after a faulted call too, under its own SEH
+        // frame so a stale prw cannot crash.
+        release_spwi_write_lock_guarded(params);
+        return distance;
     }
 
     std::optional<RayHit> sphere_world_sweep(const Vector3 &origin, float radius, const Vector3 &sweep, int objtypes,
@@ -168,25 +456,27 @@ namespace TPVCamera
         // One-time resolution diagnostics so the verify log can tell "PWI unavailable" (call path broken)
         // apart from "PWI ran but missed". The first failure reason and the first success are each logged
         // once (separate flags, so a transient loading-time failure does not hide the eventual success).
-        static bool s_logged_ok = false;
-        static bool s_logged_fail = false;
+        // Atomic because the non-blocking path also sweeps from the collision worker.
+        static std::atomic<bool> s_logged_ok{false};
+        static std::atomic<bool> s_logged_fail{false};
         auto log_fail_once = [](const char *reason)
         {
-            if (!s_logged_fail)
+            Health::note(Health::Site::SweepUnavailable);
+            if (!s_logged_fail.load(std::memory_order_relaxed) &&
+                !s_logged_fail.exchange(true, std::memory_order_relaxed))
             {
-                s_logged_fail = true;
                 DMK::Logger::get_instance().debug("Sphere sweep unavailable: {}", reason);
             }
         };
 
-        if (s_physical_world_global_addr == 0)
+        if (detour_hot_block().physical_world_slot == 0)
         {
             log_fail_once("physics raycast not initialized");
             return std::nullopt;
         }
 
         // Resolve the physical world fresh; bail cleanly while it is null (no level / loading).
-        const auto world_value = DMK::Memory::seh_read<uintptr_t>(s_physical_world_global_addr);
+        const auto world_value = SehRegion::read<uintptr_t>(detour_hot_block().physical_world_slot);
         if (!world_value || *world_value == 0 || !DMK::Memory::plausible_userspace_ptr(*world_value))
         {
             log_fail_once("physical world null (no level / loading)");
@@ -198,24 +488,24 @@ namespace TPVCamera
         // address: the static pPhysicalWorld global was found to hold non-pointer data in the running
         // process, and the vtable slot is the patch-stable anchor. The slot is a lock wrapper that takes
         // the world mutex and forwards to the real impl, so calling it from the render thread is safe
-        // (it waits for the mutex; it never re-enters our code).
-        const auto vtable = DMK::Memory::seh_read<uintptr_t>(world);
-        if (!vtable || !DMK::Memory::plausible_userspace_ptr(*vtable) || !DMK::Memory::contains(s_game_module, *vtable))
+        // (it waits for the mutex; it never re-enters our code). The wait is what the camera's non-blocking
+        // sweep mode moves onto the collision worker while the mutex is contended (paced_sphere_sweep).
+        const auto vtable = SehRegion::read<uintptr_t>(world);
+        if (!vtable || !DMK::Memory::plausible_userspace_ptr(*vtable) || !in_game_module(*vtable))
         {
             log_fail_once("world vtable unreadable or outside the game image");
             return std::nullopt;
         }
-        const auto fn_slot = DMK::Memory::seh_read<uintptr_t>(*vtable + Constants::PHYS_WORLD_VTABLE_PWI_OFFSET);
+        const auto fn_slot = SehRegion::read<uintptr_t>(*vtable + Constants::PHYS_WORLD_VTABLE_PWI_OFFSET);
         if (!fn_slot || !DMK::Memory::plausible_userspace_ptr(*fn_slot) ||
-            !DMK::Memory::contains(s_game_module, *fn_slot))
+            !in_game_module(*fn_slot))
         {
             log_fail_once("PWI vtable slot unresolved or outside the game image");
             return std::nullopt;
         }
         const auto fn = reinterpret_cast<PrimitiveWorldIntersectionFn>(*fn_slot);
-        if (!s_logged_ok)
+        if (!s_logged_ok.load(std::memory_order_relaxed) && !s_logged_ok.exchange(true, std::memory_order_relaxed))
         {
-            s_logged_ok = true;
             DMK::Logger::get_instance().debug("Sphere sweep: PWI RESOLVED (world={}, fn={})",
                                               DMK::Format::format_address(world),
                                               DMK::Format::format_address(reinterpret_cast<uintptr_t>(fn)));
@@ -267,13 +557,6 @@ namespace TPVCamera
 
         const float distance = primitive_world_intersection_guarded(fn, reinterpret_cast<void *>(world), params);
 
-        // Release the WriteLockCond exactly as the engine's own caller does: InterlockedAdd(prw, -iActive),
-        // reading both back from the struct AFTER the call. If the engine took a real (global) lock it
-        // repointed prw and set iActive, so this frees it (preventing a physics-thread stall); if it stayed
-        // in thread-safe self-pointer mode, iActive is 0 and this is a no-op. Runs even after a faulted PWI
-        // call (so a real lock is never left held), under its own SEH frame so a stale prw cannot crash.
-        release_spwi_write_lock_guarded(params);
-
         if (!std::isfinite(distance) || distance <= 0.0f)
         {
             return std::nullopt;
@@ -291,35 +574,59 @@ namespace TPVCamera
     }
 
     std::optional<RayHit> ray_fan_sweep(const Vector3 &origin, const Vector3 &sweep, float radius, int objtypes,
-                                        unsigned int flags, const uintptr_t *skip_ents, int n_skip_ents)
+                                        unsigned int flags, const uintptr_t *skip_ents, int n_skip_ents,
+                                        CollisionLod lod)
     {
-        const float len = sweep.magnitude();
+        float len = 0.0f;
+        const Vector3 dir = Simd::normalize_fast(sweep, &len);
         if (len < 1e-4f)
         {
             return std::nullopt;
         }
-        const Vector3 dir = sweep / len;
 
         // Two axes perpendicular to the sweep. Pick a seed not parallel to dir, then Gram-Schmidt.
         const Vector3 seed = (std::fabs(dir.z) < 0.9f) ? Vector3{0.0f, 0.0f, 1.0f} : Vector3{1.0f, 0.0f, 0.0f};
-        Vector3 right = dir.cross(seed);
-        const float rlen = right.magnitude();
+        float rlen = 0.0f;
+        const Vector3 right = Simd::normalize_fast(dir.cross(seed), &rlen);
         if (rlen < 1e-4f)
         {
             // Degenerate: fall back to the single centre ray.
             return ray_world_intersection(origin, sweep, objtypes, flags, skip_ents, n_skip_ents);
         }
-        right = right / rlen;
         const Vector3 up = right.cross(dir); // already unit (right and dir are orthonormal)
 
-        // Centre + four parallel rays offset by the radius => a square tube approximating the swept sphere.
-        const Vector3 offsets[5] = {Vector3{0.0f, 0.0f, 0.0f}, right * radius, right * (-radius), up * radius,
-                                    up * (-radius)};
+        // Centre + four parallel rays offset by the radius => a square tube approximating the swept sphere, cast
+        // as one batch (one world read, one SEH frame) since the coverage walk re-runs the fan per skipped prop.
+        // The coarse fan keeps the centre and casts the two opposite tube corners instead of the four sides.
+        // Each ray origin is origin + a * (radius right) + b * (radius up), two multiply-adds in SIMD registers.
+        static constexpr float k_fine_offsets[5][2] = {{0.0f, 0.0f}, {1.0f, 0.0f}, {-1.0f, 0.0f}, {0.0f, 1.0f},
+                                                       {0.0f, -1.0f}};
+        static constexpr float k_coarse_offsets[3][2] = {{0.0f, 0.0f}, {1.0f, 1.0f}, {-1.0f, -1.0f}};
+        const bool coarse = (lod == CollisionLod::Coarse);
+        const float(*const offsets)[2] = coarse ? k_coarse_offsets : k_fine_offsets;
+        const int n_rays = coarse ? 3 : 5;
+        const DirectX::XMVECTOR xo = Simd::load3(origin);
+        const DirectX::XMVECTOR xr = DirectX::XMVectorScale(Simd::load3(right), radius);
+        const DirectX::XMVECTOR xu = DirectX::XMVectorScale(Simd::load3(up), radius);
+        RaySpec rays[5];
+        for (int i = 0; i < n_rays; ++i)
+        {
+            const DirectX::XMVECTOR o = DirectX::XMVectorMultiplyAdd(
+                xu, DirectX::XMVectorReplicate(offsets[i][1]),
+                DirectX::XMVectorMultiplyAdd(xr, DirectX::XMVectorReplicate(offsets[i][0]), xo));
+            rays[i] = RaySpec{Simd::store3(o), sweep, objtypes, flags, skip_ents, n_skip_ents};
+        }
+        std::optional<RayHit> results[5];
+        const auto count = static_cast<size_t>(n_rays);
+        if (ray_world_intersection_batch(std::span<const RaySpec>(rays, count),
+                                         std::span<std::optional<RayHit>>(results, count)) == 0)
+        {
+            return std::nullopt;
+        }
 
         std::optional<RayHit> best;
-        for (const Vector3 &off : offsets)
+        for (const std::optional<RayHit> &h : std::span<const std::optional<RayHit>>(results, count))
         {
-            const auto h = ray_world_intersection(origin + off, sweep, objtypes, flags, skip_ents, n_skip_ents);
             if (h.has_value() && (!best.has_value() || h->m_distance < best->m_distance))
             {
                 best = h;
@@ -328,7 +635,242 @@ namespace TPVCamera
         return best;
     }
 
-    float collider_horizontal_footprint(uintptr_t collider) noexcept
+    namespace
+    {
+        /// One queued fan request (the ray_fan_sweep arguments; the async path never passes skip entities).
+        struct AsyncFanRequest
+        {
+            Vector3 origin{};
+            Vector3 sweep{};
+            float radius = 0.0f;
+            int objtypes = 0;
+            unsigned int flags = 0;
+            CollisionLod lod = CollisionLod::Fine;
+        };
+
+        /// One queued sphere sweep (the sphere_world_sweep arguments, unskipped).
+        struct AsyncSweepRequest
+        {
+            Vector3 origin{};
+            Vector3 sweep{};
+            float radius = 0.0f;
+            int objtypes = 0;
+        };
+
+        /// One queued arm solve (PipelinedCollision): the fan, then the sphere when sphere_clear >= 0.
+        struct AsyncArmRequest
+        {
+            Vector3 origin{};
+            Vector3 sweep{};
+            float radius = 0.0f;
+            float sphere_clear = -1.0f;
+            CollisionLod lod = CollisionLod::Fine;
+        };
+
+        // Single-slot mailboxes: the render thread writes s_async_request and reads s_async_result, the worker the
+        // reverse (likewise the sweep and arm pairs). All six are guarded by s_async_mutex (held only to copy a few
+        // dozen bytes, never across a ray).
+        std::mutex s_async_mutex;
+        std::optional<AsyncFanRequest> s_async_request;
+        std::optional<AsyncFanResult> s_async_result;
+        std::optional<AsyncSweepRequest> s_async_sweep_request;
+        std::optional<AsyncSweepResult> s_async_sweep_result;
+        std::optional<AsyncArmRequest> s_async_arm_request;
+        std::optional<AsyncArmResult> s_async_arm_result;
+
+        HANDLE s_async_thread = nullptr;
+        HANDLE s_async_wake = nullptr; // auto-reset: signalled per submit and on shutdown
+        std::atomic<bool> s_async_shutdown{false};
+
+        DWORD WINAPI async_fan_worker(LPVOID)
+        {
+            AllocStats::set_thread_tag(AllocStats::AllocTag::Workers);
+            while (!s_async_shutdown.load(std::memory_order_acquire))
+            {
+                WaitForSingleObject(s_async_wake, INFINITE);
+                std::optional<AsyncFanRequest> req;
+                std::optional<AsyncSweepRequest> sweep_req;
+                std::optional<AsyncArmRequest> arm_req;
+                {
+                    const std::lock_guard<std::mutex> lock(s_async_mutex);
+                    req.swap(s_async_request);
+                    sweep_req.swap(s_async_sweep_request);
+                    arm_req.swap(s_async_arm_request);
+                }
+                if (s_async_shutdown.load(std::memory_order_acquire))
+                {
+                    continue;
+                }
+                if (req)
+                {
+                    AsyncFanResult result{};
+                    result.m_origin = req->origin;
+                    result.m_sweep = req->sweep;
+                    result.m_radius = req->radius;
+                    result.m_hit = ray_fan_sweep(req->origin, req->sweep, req->radius, req->objtypes, req->flags,
+                                                 nullptr, 0, req->lod);
+                    const std::lock_guard<std::mutex> lock(s_async_mutex);
+                    s_async_result = result;
+                }
+                if (sweep_req)
+                {
+                    // May wait here on the physical world's mutex; that is the point of running it on this thread.
+                    AsyncSweepResult result{};
+                    result.m_origin = sweep_req->origin;
+                    result.m_sweep = sweep_req->sweep;
+                    result.m_radius = sweep_req->radius;
+                    const auto start = std::chrono::steady_clock::now();
+                    result.m_hit = sphere_world_sweep(sweep_req->origin, sweep_req->radius, sweep_req->sweep,
+                                                      sweep_req->objtypes);
+                    result.m_elapsed_ms = std::chrono::duration<float, std::milli>(
+                                              std::chrono::steady_clock::now() - start)
+                                              .count();
+                    const std::lock_guard<std::mutex> lock(s_async_mutex);
+                    s_async_sweep_result = result;
+                }
+                if (arm_req)
+                {
+                    AsyncArmResult result{};
+                    result.m_origin = arm_req->origin;
+                    result.m_sweep = arm_req->sweep;
+                    result.m_radius = arm_req->radius;
+                    result.m_sphere_clear = arm_req->sphere_clear;
+                    result.m_fan = ray_fan_sweep(arm_req->origin, arm_req->sweep, arm_req->radius,
+                                                 Constants::RWI_OBJTYPES_CAMERA, Constants::RWI_FLAGS_STOP_AT_SOLID,
+                                                 nullptr, 0, arm_req->lod);
+                    const float length = arm_req->sweep.magnitude();
+                    if (arm_req->sphere_clear >= 0.0f && length > 1e-3f)
+                    {
+                        const Vector3 dir = arm_req->sweep / length;
+                        result.m_sphere = sphere_world_sweep(arm_req->origin + dir * arm_req->sphere_clear,
+                                                             arm_req->radius,
+                                                             arm_req->sweep - dir * arm_req->sphere_clear,
+                                                             Constants::RWI_OBJTYPES_CAMERA);
+                    }
+                    const std::lock_guard<std::mutex> lock(s_async_mutex);
+                    s_async_arm_result = result;
+                }
+            }
+            return 0;
+        }
+
+        /// Starts the worker on first use. Render thread only (the only submitter), so no start race.
+        bool ensure_async_worker()
+        {
+            if (s_async_thread != nullptr)
+            {
+                return true;
+            }
+            if (s_async_wake == nullptr)
+            {
+                s_async_wake = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+                if (s_async_wake == nullptr)
+                {
+                    return false;
+                }
+            }
+            s_async_shutdown.store(false, std::memory_order_release);
+            s_async_thread = CreateThread(nullptr, 0, async_fan_worker, nullptr, 0, nullptr);
+            if (s_async_thread == nullptr)
+            {
+                DMK::Logger::get_instance().warning(
+                    "PhysicsRaycast: collision worker thread failed to start; AsyncCollision falls back to sync");
+                return false;
+            }
+            DMK::Logger::get_instance().debug("PhysicsRaycast: collision worker thread started");
+            return true;
+        }
+    } // namespace
+
+    void submit_fan_async(const Vector3 &origin, const Vector3 &sweep, float radius, int objtypes, unsigned int flags,
+                          CollisionLod lod)
+    {
+        if (!ensure_async_worker())
+        {
+            return;
+        }
+        {
+            const std::lock_guard<std::mutex> lock(s_async_mutex);
+            s_async_request = AsyncFanRequest{origin, sweep, radius, objtypes, flags, lod}; // latest submit wins
+        }
+        SetEvent(s_async_wake);
+    }
+
+    std::optional<AsyncFanResult> take_fan_async()
+    {
+        const std::lock_guard<std::mutex> lock(s_async_mutex);
+        std::optional<AsyncFanResult> out;
+        out.swap(s_async_result);
+        return out;
+    }
+
+    void submit_sweep_async(const Vector3 &origin, float radius, const Vector3 &sweep, int objtypes)
+    {
+        if (!ensure_async_worker())
+        {
+            return;
+        }
+        {
+            const std::lock_guard<std::mutex> lock(s_async_mutex);
+            s_async_sweep_request = AsyncSweepRequest{origin, sweep, radius, objtypes}; // latest submit wins
+        }
+        SetEvent(s_async_wake);
+    }
+
+    std::optional<AsyncSweepResult> take_sweep_async()
+    {
+        const std::lock_guard<std::mutex> lock(s_async_mutex);
+        std::optional<AsyncSweepResult> out;
+        out.swap(s_async_sweep_result);
+        return out;
+    }
+
+    void submit_arm_async(const Vector3 &origin, const Vector3 &sweep, float radius, float sphere_clear,
+                          CollisionLod lod)
+    {
+        if (!ensure_async_worker())
+        {
+            return;
+        }
+        {
+            const std::lock_guard<std::mutex> lock(s_async_mutex);
+            s_async_arm_request = AsyncArmRequest{origin, sweep, radius, sphere_clear, lod}; // latest submit wins
+        }
+        SetEvent(s_async_wake);
+    }
+
+    std::optional<AsyncArmResult> take_arm_async()
+    {
+        const std::lock_guard<std::mutex> lock(s_async_mutex);
+        std::optional<AsyncArmResult> out;
+        out.swap(s_async_arm_result);
+        return out;
+    }
+
+    void shutdown_async_raycast() noexcept
+    {
+        if (s_async_thread != nullptr)
+        {
+            s_async_shutdown.store(true, std::memory_order_release);
+            SetEvent(s_async_wake);
+            // A fan is a handful of bounded engine calls, so the join is short. On a timeout (a hung engine call)
+            // the thread keeps its handle and the module stays pinned under it.
+            if (join_or_pin(s_async_thread, 2000, "Collision worker"))
+            {
+                s_async_thread = nullptr;
+            }
+        }
+        const std::lock_guard<std::mutex> lock(s_async_mutex);
+        s_async_request.reset();
+        s_async_result.reset();
+        s_async_sweep_request.reset();
+        s_async_sweep_result.reset();
+        s_async_arm_request.reset();
+        s_async_arm_result.reset();
+    }
+
+    // collider_horizontal_footprint's body: raw reads inside a region body (SehRegion::run), seh_read otherwise.
+    static float collider_horizontal_footprint_body(uintptr_t collider) noexcept
     {
         if (collider == 0 || !DMK::Memory::plausible_userspace_ptr(collider))
         {
@@ -339,15 +881,15 @@ namespace TPVCamera
         // entity id with flags, NOT static -- but its bbox 0.30x0.30x3.69 is valid). Do NOT require STATIC, or
         // entity posts are missed. Only fType == 0 (terrain heightmap / unowned geom) reads a 0x0 bbox (live), so
         // exclude it; the degenerate-AABB check below catches it too.
-        const auto ftype = DMK::Memory::seh_read<int>(collider + Constants::PHYS_ENTITY_FOREIGN_TYPE_OFFSET);
+        const auto ftype = SehRegion::read<int>(collider + Constants::PHYS_ENTITY_FOREIGN_TYPE_OFFSET);
         if (!ftype || *ftype == 0)
         {
             return -1.0f;
         }
-        const auto min_x = DMK::Memory::seh_read<float>(collider + Constants::PHYS_ENTITY_BBOX_MIN_OFFSET + 0);
-        const auto min_y = DMK::Memory::seh_read<float>(collider + Constants::PHYS_ENTITY_BBOX_MIN_OFFSET + 4);
-        const auto max_x = DMK::Memory::seh_read<float>(collider + Constants::PHYS_ENTITY_BBOX_MAX_OFFSET + 0);
-        const auto max_y = DMK::Memory::seh_read<float>(collider + Constants::PHYS_ENTITY_BBOX_MAX_OFFSET + 4);
+        const auto min_x = SehRegion::read<float>(collider + Constants::PHYS_ENTITY_BBOX_MIN_OFFSET + 0);
+        const auto min_y = SehRegion::read<float>(collider + Constants::PHYS_ENTITY_BBOX_MIN_OFFSET + 4);
+        const auto max_x = SehRegion::read<float>(collider + Constants::PHYS_ENTITY_BBOX_MAX_OFFSET + 0);
+        const auto max_y = SehRegion::read<float>(collider + Constants::PHYS_ENTITY_BBOX_MAX_OFFSET + 4);
         if (!min_x || !min_y || !max_x || !max_y)
         {
             return -1.0f;
@@ -365,18 +907,29 @@ namespace TPVCamera
         return (sx > sy) ? sx : sy;
     }
 
-    uintptr_t static_brush_render_node(uintptr_t collider) noexcept
+    float collider_horizontal_footprint(uintptr_t collider) noexcept
+    {
+        if (SehRegion::available())
+        {
+            auto body = [collider] { return collider_horizontal_footprint_body(collider); };
+            return SehRegion::run(-1.0f, body);
+        }
+        return collider_horizontal_footprint_body(collider);
+    }
+
+    // static_brush_render_node's body: raw reads inside a region body (SehRegion::run), seh_read otherwise.
+    static uintptr_t static_brush_render_node_body(uintptr_t collider) noexcept
     {
         if (collider == 0 || !DMK::Memory::plausible_userspace_ptr(collider))
         {
             return 0;
         }
-        const auto ftype = DMK::Memory::seh_read<int>(collider + Constants::PHYS_ENTITY_FOREIGN_TYPE_OFFSET);
+        const auto ftype = SehRegion::read<int>(collider + Constants::PHYS_ENTITY_FOREIGN_TYPE_OFFSET);
         if (!ftype || *ftype != Constants::PHYS_FOREIGN_ID_STATIC)
         {
             return 0; // not a static brush owner (entity-attached / pure-physics): no usable render node
         }
-        const auto node = DMK::Memory::seh_read<uintptr_t>(collider + Constants::PHYS_ENTITY_FOREIGN_DATA_OFFSET);
+        const auto node = SehRegion::read<uintptr_t>(collider + Constants::PHYS_ENTITY_FOREIGN_DATA_OFFSET);
         if (!node || !DMK::Memory::plausible_userspace_ptr(*node))
         {
             return 0;
@@ -384,8 +937,18 @@ namespace TPVCamera
         return *node;
     }
 
+    uintptr_t static_brush_render_node(uintptr_t collider) noexcept
+    {
+        if (SehRegion::available())
+        {
+            auto body = [collider] { return static_brush_render_node_body(collider); };
+            return SehRegion::run(uintptr_t{0}, body);
+        }
+        return static_brush_render_node_body(collider);
+    }
+
     float character_occluded_fraction(const Vector3 &camera, const Vector3 &pivot, int objtypes, unsigned int flags,
-                                      float *out_head_fill)
+                                      float *out_head_fill, CollisionLod lod)
     {
         // Screen-horizontal axis at the character (perpendicular to the view, kept world-horizontal).
         const Vector3 view = pivot - camera; // camera -> character
@@ -412,7 +975,7 @@ namespace TPVCamera
         float v_world[4];                                                      // sample heights, world z (head -> feet)
         float center_x, center_y;                                              // horizontal sample center
         float half_width;                                                      // sampled half-width along screen-right
-        const PlayerScreenBounds &pb = player_screen_bounds();
+        const PlayerScreenBounds &pb = player_world_bounds();
         if (pb.valid)
         {
             center_x = 0.5f * (pb.min_x + pb.max_x);
@@ -444,16 +1007,30 @@ namespace TPVCamera
             half_width = 0.25f;
         }
 
+        // Build every sample ray first, then cast them as ONE batch (one world read, one SEH frame for all 12)
+        // instead of twelve separately guarded calls. The thinned grid (lod below Fine) keeps a checkerboard of
+        // the 4 x 3 samples and scales each kept sample so its level still carries its full weight.
+        constexpr int k_samples = 4 * 3;
+        const bool thinned = (lod != CollisionLod::Fine);
+        RaySpec rays[k_samples];
+        float sample_dist[k_samples];
+        float sample_weight[k_samples];
+        int sample_level[k_samples];
+        int n_rays = 0;
         float total = 0.0f;
-        float blocked = 0.0f;
-        int head_n = 0, head_blocked = 0; // unweighted HEAD level (vi==0) tally for the head-visible gate
+        int head_n = 0; // unweighted HEAD level (vi==0) sample count for the head-visible gate
         for (int vi = 0; vi < 4; ++vi)
         {
-            const float w = k_char_level_weight[vi];
             const float vz = v_world[vi];
-            for (const float hf : h_frac)
+            // Even levels keep the two outer columns, odd levels the centre one.
+            const float level_weight = k_char_level_weight[vi] * (thinned ? ((vi % 2 == 0) ? 1.5f : 3.0f) : 1.0f);
+            for (int ci = 0; ci < 3; ++ci)
             {
-                const float h = hf * half_width;
+                if (thinned && (vi + ci) % 2 != 0)
+                {
+                    continue;
+                }
+                const float h = h_frac[ci] * half_width;
                 const Vector3 target{center_x + right.x * h, center_y + right.y * h, vz};
                 const Vector3 to_target = target - camera;
                 const float dist = to_target.magnitude();
@@ -461,19 +1038,33 @@ namespace TPVCamera
                 {
                     continue;
                 }
-                total += w;
+                total += level_weight;
                 if (vi == 0)
                 {
                     ++head_n;
                 }
-                const auto hit = ray_world_intersection(camera, to_target, objtypes, flags, nullptr, 0);
-                if (hit.has_value() && hit->m_distance < dist - 0.10f)
+                rays[n_rays] = RaySpec{camera, to_target, objtypes, flags, nullptr, 0};
+                sample_dist[n_rays] = dist;
+                sample_weight[n_rays] = level_weight;
+                sample_level[n_rays] = vi;
+                ++n_rays;
+            }
+        }
+
+        std::optional<RayHit> results[k_samples];
+        (void)ray_world_intersection_batch(std::span<const RaySpec>(rays, static_cast<size_t>(n_rays)),
+                                           std::span<std::optional<RayHit>>(results, static_cast<size_t>(n_rays)));
+        float blocked = 0.0f;
+        int head_blocked = 0;
+        for (int i = 0; i < n_rays; ++i)
+        {
+            const std::optional<RayHit> &hit = results[i];
+            if (hit.has_value() && hit->m_distance < sample_dist[i] - 0.10f)
+            {
+                blocked += sample_weight[i];
+                if (sample_level[i] == 0)
                 {
-                    blocked += w;
-                    if (vi == 0)
-                    {
-                        ++head_blocked;
-                    }
+                    ++head_blocked;
                 }
             }
         }
@@ -485,4 +1076,166 @@ namespace TPVCamera
         return (total > 0.0f) ? (blocked / total) : 0.0f;
     }
 
+    namespace
+    {
+        // Temporal coverage grid (see character_occluded_fraction_temporal): sample i = level * k_tc_cols + column.
+        constexpr int k_tc_levels = 5;
+        constexpr int k_tc_cols = 6;
+        constexpr int k_tc_samples = k_tc_levels * k_tc_cols;
+        constexpr int k_tc_rays_per_call = 3;     // a quarter of the 12-ray grid
+        constexpr int k_tc_seed_rays = 10;        // first call after a reset: a third of the grid, spread out
+        constexpr int k_tc_lattice_step = 7;      // rank-1 lattice generator (coprime with k_tc_samples)
+        constexpr float k_tc_alpha = 0.5f;        // weight of a fresh sample in its running value
+        constexpr float k_tc_jump2 = 0.5f * 0.5f; // camera / pivot move between calls that restarts the estimate
+        constexpr unsigned long long k_tc_stale_ms = 250;
+        constexpr int k_tc_slots = 8;
+        static_assert(std::gcd(k_tc_lattice_step, k_tc_samples) == 1, "the lattice walk must visit every sample");
+
+        constexpr float k_tc_level_weight[k_tc_levels] = {1.0f, 0.85f, 0.6f, 0.35f, 0.2f}; // head -> shins
+        constexpr float k_tc_level_frac[k_tc_levels] = {0.08f, 0.29f, 0.50f, 0.71f, 0.92f}; // DOWN from the top
+        constexpr float k_tc_col_frac[k_tc_cols] = {-1.0f, -0.6f, -0.2f, 0.2f, 0.6f, 1.0f};
+
+        struct TemporalCoverage
+        {
+            uintptr_t collider = 0;
+            Vector3 camera{};
+            Vector3 pivot{};
+            unsigned long long last_ms = 0;
+            std::uint32_t stamp = 0;
+            int cursor = 0;               // lattice position of the next sample to cast
+            float occ[k_tc_samples] = {}; // running occlusion per sample, -1 = not cast since the reset
+        };
+
+        TemporalCoverage s_tc[k_tc_slots];
+        std::uint32_t s_tc_tick = 0;
+
+        // The slot of @p collider (the least recently used one, cleared, when it has none).
+        TemporalCoverage &temporal_slot(uintptr_t collider, bool &fresh)
+        {
+            ++s_tc_tick;
+            int victim = 0;
+            for (int i = 0; i < k_tc_slots; ++i)
+            {
+                if (s_tc[i].collider == collider)
+                {
+                    s_tc[i].stamp = s_tc_tick;
+                    fresh = false;
+                    return s_tc[i];
+                }
+                if (s_tc[i].stamp < s_tc[victim].stamp)
+                {
+                    victim = i;
+                }
+            }
+            s_tc[victim] = TemporalCoverage{};
+            s_tc[victim].collider = collider;
+            s_tc[victim].stamp = s_tc_tick;
+            fresh = true;
+            return s_tc[victim];
+        }
+    } // namespace
+
+    float character_occluded_fraction_temporal(uintptr_t collider, const Vector3 &camera, const Vector3 &pivot,
+                                               int objtypes, unsigned int flags, float *out_head_fill)
+    {
+        bool fresh = false;
+        TemporalCoverage &tc = temporal_slot(collider, fresh);
+        const unsigned long long now = GetTickCount64();
+        if (fresh || (camera - tc.camera).magnitude_squared() > k_tc_jump2 ||
+            (pivot - tc.pivot).magnitude_squared() > k_tc_jump2 || now - tc.last_ms > k_tc_stale_ms)
+        {
+            std::fill(std::begin(tc.occ), std::end(tc.occ), -1.0f);
+            tc.cursor = 0;
+            fresh = true;
+        }
+        tc.camera = camera;
+        tc.pivot = pivot;
+        tc.last_ms = now;
+
+        // The same body frame as character_occluded_fraction: the live posed AABB as an inset cylinder when it is
+        // available, else the synthetic box around the pivot (z +0.10 head .. -1.55 shins, half-width 0.25).
+        const Vector3 view = pivot - camera;
+        Vector3 right = view.cross(Vector3{0.0f, 0.0f, 1.0f});
+        const float rl = right.magnitude();
+        right = (rl > 1e-4f) ? (right / rl) : Vector3{1.0f, 0.0f, 0.0f};
+        float center_x = pivot.x, center_y = pivot.y, half_width = 0.25f;
+        float level_z[k_tc_levels];
+        const PlayerScreenBounds &pb = player_world_bounds();
+        if (pb.valid)
+        {
+            center_x = 0.5f * (pb.min_x + pb.max_x);
+            center_y = 0.5f * (pb.min_y + pb.max_y);
+            const float r = std::clamp(0.5f * std::min(pb.max_x - pb.min_x, pb.max_y - pb.min_y), 0.20f, 0.50f);
+            half_width = 0.6f * r;
+            for (int l = 0; l < k_tc_levels; ++l)
+            {
+                level_z[l] = pb.max_z - (pb.max_z - pb.min_z) * k_tc_level_frac[l];
+            }
+        }
+        else
+        {
+            for (int l = 0; l < k_tc_levels; ++l)
+            {
+                level_z[l] = pivot.z + 0.10f - 1.65f * static_cast<float>(l) / static_cast<float>(k_tc_levels - 1);
+            }
+        }
+
+        // This call's share of the lattice walk, cast as one batch.
+        const int n_cast = fresh ? k_tc_seed_rays : k_tc_rays_per_call;
+        RaySpec rays[k_tc_seed_rays];
+        float sample_dist[k_tc_seed_rays];
+        int sample_id[k_tc_seed_rays];
+        int n_rays = 0;
+        for (int k = 0; k < n_cast; ++k)
+        {
+            const int id = (tc.cursor * k_tc_lattice_step) % k_tc_samples;
+            tc.cursor = (tc.cursor + 1) % k_tc_samples;
+            const float h = k_tc_col_frac[id % k_tc_cols] * half_width;
+            const Vector3 target{center_x + right.x * h, center_y + right.y * h, level_z[id / k_tc_cols]};
+            const Vector3 to_target = target - camera;
+            const float dist = to_target.magnitude();
+            if (dist < 1e-3f)
+            {
+                continue;
+            }
+            rays[n_rays] = RaySpec{camera, to_target, objtypes, flags, nullptr, 0};
+            sample_dist[n_rays] = dist;
+            sample_id[n_rays] = id;
+            ++n_rays;
+        }
+        std::optional<RayHit> results[k_tc_seed_rays];
+        (void)ray_world_intersection_batch(std::span<const RaySpec>(rays, static_cast<size_t>(n_rays)),
+                                           std::span<std::optional<RayHit>>(results, static_cast<size_t>(n_rays)));
+        for (int i = 0; i < n_rays; ++i)
+        {
+            const float v = (results[i].has_value() && results[i]->m_distance < sample_dist[i] - 0.10f) ? 1.0f : 0.0f;
+            float &occ = tc.occ[sample_id[i]];
+            occ = (occ < 0.0f) ? v : occ + (v - occ) * k_tc_alpha;
+        }
+
+        float blocked = 0.0f, total = 0.0f, head_blocked = 0.0f;
+        int head_n = 0;
+        for (int id = 0; id < k_tc_samples; ++id)
+        {
+            const float occ = tc.occ[id];
+            if (occ < 0.0f)
+            {
+                continue;
+            }
+            const int level = id / k_tc_cols;
+            blocked += k_tc_level_weight[level] * occ;
+            total += k_tc_level_weight[level];
+            if (level == 0)
+            {
+                head_blocked += occ;
+                ++head_n;
+            }
+        }
+        if (out_head_fill != nullptr)
+        {
+            *out_head_fill = (head_n > 0) ? (head_blocked / static_cast<float>(head_n)) : -1.0f;
+        }
+        return (total > 0.0f) ? (blocked / total) : 0.0f;
+    }
+
 } // namespace TPVCamera
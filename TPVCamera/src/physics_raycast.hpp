@@ -7,6 +7,13 @@
  * out of geometry) and aim convergence (land the crosshair on the exact world target).
  * Every call is SEH-guarded and degrades to "no hit" if the engine path faults or the
  * physical world is not ready, so a layout or version drift can never crash the game.
+ *
+ * Every query goes to the engine; there is no mod-owned copy of the static world to answer rays locally. Such a
+ * copy would need the collision geometry itself (the entity part list, phys_geometry and the trimesh / primitive /
+ * heightfield layouts behind it), and constants.hpp resolves none of it: of CPhysicalEntity only m_BBox and the
+ * foreign-data link are verified. The render meshes this mod can read (render_occlusion.cpp) are no substitute.
+ * They include render-only cloth, they miss physics-only hulls and the terrain, and their shapes differ from the
+ * collision proxies, so a local answer could disagree with the engine in both directions.
  */
 #ifndef TPVCAMERA_PHYSICS_RAYCAST_HPP
 #define TPVCAMERA_PHYSICS_RAYCAST_HPP
@@ -16,6 +23,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <span>
 
 namespace TPVCamera
 {
@@ -39,15 +47,49 @@ namespace TPVCamera
         int m_terrain{0};
     };
 
+    /**
+     * @enum CollisionLod
+     * @brief Probe density of the camera-collision queries, picked per frame from the follow distance and the orbit's
+     *        angular speed (select_collision_lod, camera_hook.cpp). A far or swinging camera cannot show the
+     *        precision a still, close one needs, so it casts fewer rays.
+     */
+    enum class CollisionLod : std::uint8_t
+    {
+        Fine,   ///< Five-ray fan; 4 x 3 coverage grid.
+        Medium, ///< Five-ray fan; six-sample checkerboard coverage grid.
+        Coarse, ///< Three-ray fan on the tube diagonal; six-sample coverage grid.
+    };
+
+    /**
+     * @struct RaySpec
+     * @brief One ray of a @ref ray_world_intersection_batch call (the per-ray arguments of ray_world_intersection).
+     */
+    struct RaySpec
+    {
+        /// Ray start in world space.
+        Vector3 m_origin{};
+        /// Ray vector; its length is the maximum ray length (not normalized).
+        Vector3 m_direction{};
+        /// entity_query_flags mask (which entity classes the ray can hit).
+        int m_objtypes{0};
+        /// rwi_flags mask (pierceability and behaviour).
+        unsigned int m_flags{0};
+        /// Optional array of IPhysicalEntity* to ignore (RWI pSkipEnts); nullptr = none.
+        const uintptr_t *m_skip_ents{nullptr};
+        /// Count of m_skip_ents.
+        int m_n_skip_ents{0};
+    };
+
     /**
      * @brief Resolves RayWorldIntersection and the p_physical_world slot.
      * @details Best-effort: on a pattern miss the raycast features simply no-op (the camera
      *          still works), so callers treat a false return as "raycast unavailable".
+     *          Both are stored in the detour hot block, whose game-image range initialize_camera has already set.
      * @param g_env Resolved SSystemGlobalEnvironment base; the p_physical_world slot is taken
      *              from g_env + PHYSICAL_WORLD_OFFSET (no second hardcoded address).
      * @return true if the ray helper was located.
      */
-    [[nodiscard]] bool initialize_physics_raycast(uintptr_t module_base, size_t module_size, uintptr_t g_env);
+    [[nodiscard]] bool initialize_physics_raycast(uintptr_t g_env);
 
     /**
      * @brief Synchronous world raycast.
@@ -64,6 +106,61 @@ namespace TPVCamera
                                                                const uintptr_t *skip_ents = nullptr,
                                                                int n_skip_ents = 0);
 
+    /**
+     * @brief Casts every ray in @p rays against ONE resolution of the physical world, under ONE SEH frame.
+     * @details Equivalent to calling ray_world_intersection per ray, minus the per-ray overhead: the
+     *          p_physical_world slot is read once for the whole batch and the engine calls share a single
+     *          structured-exception frame instead of entering and leaving one per ray. The fan (5 rays) and the
+     *          physics coverage sampler (12 rays) are the multi-ray callers. A fault mid-batch keeps the results of
+     *          the rays already cast and reports the rest as misses, matching what per-ray calls would have
+     *          returned for a world that went bad between two rays.
+     * @param rays The rays to cast.
+     * @param out Receives one result per ray (std::nullopt = miss); must be at least @p rays.size() long.
+     * @return Number of rays that hit, or 0 when physics is not ready (every @p out entry is then std::nullopt).
+     */
+    int ray_world_intersection_batch(std::span<const RaySpec> rays, std::span<std::optional<RayHit>> out);
+
+    /**
+     * @brief Opens the calling thread's per-frame camera ray cache, emptied.
+     * @details While it is open, ray_world_intersection and ray_world_intersection_batch (and so ray_fan_sweep and
+     *          the coverage samplers) answer an unskipped ray whose origin, vector, objtypes and flags match one
+     *          already cast since the open -- within 1 mm -- from the recorded result instead of a second engine
+     *          query. A collision recompute casts the pivot->camera centre ray up to three times (the static-world
+     *          throttle, the fan, the result it remembers); the repeats become lookups. Rays with a skip list are
+     *          never cached (the list's contents are not part of the key), nor is a call that faulted.
+     *          Opened and closed on the render thread by CameraRayFrame around the game-view frame; other threads
+     *          (the collision worker) never see it.
+     */
+    void open_camera_ray_cache() noexcept;
+
+    /** @brief Closes the calling thread's camera ray cache; later rays go to the engine. */
+    void close_camera_ray_cache() noexcept;
+
+    /**
+     * @class CameraRayFrame
+     * @brief open_camera_ray_cache() / close_camera_ray_cache() for the enclosing scope.
+     */
+    class CameraRayFrame
+    {
+    public:
+        CameraRayFrame() noexcept { open_camera_ray_cache(); }
+        ~CameraRayFrame() noexcept { close_camera_ray_cache(); }
+        CameraRayFrame(const CameraRayFrame &) = delete;
+        CameraRayFrame &operator=(const CameraRayFrame &) = delete;
+    };
+
+    /**
+     * @struct CameraRayCacheStats
+     * @brief Session counters of the camera ray cache, for the overlay's Performance section.
+     */
+    struct CameraRayCacheStats
+    {
+        std::uint64_t reused = 0; // rays answered from the cache
+        std::uint64_t cast = 0;   // cacheable rays that went to the engine
+    };
+
+    [[nodiscard]] CameraRayCacheStats camera_ray_cache_stats() noexcept;
+
     /**
      * @brief Swept-sphere world intersection via IPhysicalWorld::PrimitiveWorldIntersection (PWI).
      * @details Sweeps a sphere of the given radius from @p origin along @p sweep and returns the
@@ -92,6 +189,9 @@ namespace TPVCamera
      *          edges -- while keeping the CORRECT object-type filtering: RWI takes @p objtypes as a plain
      *          function argument (honoured), unlike PrimitiveWorldIntersection whose fork SPWIParams entTypes
      *          offset is mis-mapped (it queried ent_all and collided with the player's own articulated gear).
+     *          At CollisionLod::Coarse the four side rays become two at opposite CORNERS of the tube, (right + up)
+     *          and -(right + up) times @p radius: wider rays that still reach every side of the tube, one ray each
+     *          for the right / top and the left / bottom edge, for three rays instead of five.
      * @param origin Sweep start (the camera pivot), world space.
      * @param sweep Sweep vector (pivot -> camera); its length is the max distance (not normalized).
      * @param radius Half-width of the ray tube, world units (the swept-sphere radius / standoff).
@@ -99,11 +199,132 @@ namespace TPVCamera
      * @param flags rwi_flags mask.
      * @param skip_ents Optional array of IPhysicalEntity* to ignore on every ray (nullptr = none).
      * @param n_skip_ents Count of @p skip_ents.
+     * @param lod Probe density (Coarse = the three-ray corner fan).
      * @return The nearest hit across the fan, or std::nullopt if every ray misses.
      */
     [[nodiscard]] std::optional<RayHit> ray_fan_sweep(const Vector3 &origin, const Vector3 &sweep, float radius,
                                                       int objtypes, unsigned int flags,
-                                                      const uintptr_t *skip_ents = nullptr, int n_skip_ents = 0);
+                                                      const uintptr_t *skip_ents = nullptr, int n_skip_ents = 0,
+                                                      CollisionLod lod = CollisionLod::Fine);
+
+    /**
+     * @brief Temporally amortised @ref character_occluded_fraction for one collider ([Collision]
+     *        TemporalRayCoverage).
+     * @details Samples a denser grid (5 levels head->shins x 6 columns) but casts only a few of its rays per call,
+     *          walking the grid on a rank-1 lattice schedule so consecutive calls land on different levels and
+     *          columns. Each sample keeps an exponentially weighted occlusion value per @p collider (a small LRU
+     *          table of recent colliders), and the fraction is the level-weighted mean of the samples seen so
+     *          far. The estimate restarts -- with a larger seed batch -- for a new collider, after a camera or
+     *          pivot jump, or when the collider has not been measured for a moment. Render thread only.
+     * @param out_head_fill As for character_occluded_fraction, from the smoothed HEAD-level samples.
+     * @return Occluded fraction in [0, 1]; 0 if no samples were valid.
+     */
+    [[nodiscard]] float character_occluded_fraction_temporal(uintptr_t collider, const Vector3 &camera,
+                                                             const Vector3 &pivot, int objtypes, unsigned int flags,
+                                                             float *out_head_fill = nullptr);
+
+    /**
+     * @struct AsyncFanResult
+     * @brief A completed off-thread @ref ray_fan_sweep together with the arm it was cast for.
+     */
+    struct AsyncFanResult
+    {
+        /// Fan origin the worker cast from (the pivot of the submitting frame).
+        Vector3 m_origin{};
+        /// Fan sweep the worker cast along (pivot -> desired camera of the submitting frame).
+        Vector3 m_sweep{};
+        /// Tube half-width of the submitting frame.
+        float m_radius{0.0f};
+        /// The fan result (std::nullopt = the whole tube was clear).
+        std::optional<RayHit> m_hit{};
+    };
+
+    /**
+     * @brief Queues an unskipped @ref ray_fan_sweep to run on the collision worker thread (AsyncCollision mode).
+     * @details The engine's own rwi_queue path cannot be used from here: the inline RayWorldIntersection helper
+     *          this mod calls has no slot for the SRWIParams completion callback a queued request needs. Instead
+     *          a single mod-owned worker runs the fan synchronously OFF the render thread (RayWorldIntersection is
+     *          safe to call from any thread; it takes the world's read lock itself). The mailbox holds one request:
+     *          a newer submit replaces one the worker has not picked up yet, so the worker never falls behind.
+     *          The worker is started on the first submit.
+     */
+    void submit_fan_async(const Vector3 &origin, const Vector3 &sweep, float radius, int objtypes, unsigned int flags,
+                          CollisionLod lod = CollisionLod::Fine);
+
+    /**
+     * @brief Takes the most recent completed async fan, if any (consumes it).
+     * @details Called one frame after @ref submit_fan_async; the caller must check the returned arm against its
+     *          current one before trusting the hit.
+     */
+    [[nodiscard]] std::optional<AsyncFanResult> take_fan_async();
+
+    /**
+     * @struct AsyncSweepResult
+     * @brief A completed off-thread @ref sphere_world_sweep together with the arm it was cast for.
+     */
+    struct AsyncSweepResult
+    {
+        /// Sweep origin the worker cast from.
+        Vector3 m_origin{};
+        /// Sweep vector the worker cast along.
+        Vector3 m_sweep{};
+        /// Sphere radius of the submitting frame.
+        float m_radius{0.0f};
+        /// The sweep result (std::nullopt = a miss, a fault or PWI unavailable).
+        std::optional<RayHit> m_hit{};
+        /// Wall time the worker spent in the sweep call, milliseconds (mutex wait included).
+        float m_elapsed_ms{0.0f};
+    };
+
+    /**
+     * @brief Queues an unskipped @ref sphere_world_sweep to run on the collision worker thread.
+     * @details The non-blocking sweep path: PrimitiveWorldIntersection's vtable slot waits on the physical
+     *          world's mutex, so while the physics thread holds it the call is made here instead, and the
+     *          worker waits rather than the render thread. No skip entities are passed, because the render thread
+     *          cannot keep an entity alive until the worker reads it. The mailbox holds one request, as with
+     *          @ref submit_fan_async, and the fan and sweep mailboxes share the worker.
+     */
+    void submit_sweep_async(const Vector3 &origin, float radius, const Vector3 &sweep, int objtypes);
+
+    /** @brief Takes the most recent completed async sweep, if any (consumes it). */
+    [[nodiscard]] std::optional<AsyncSweepResult> take_sweep_async();
+
+    /**
+     * @struct AsyncArmResult
+     * @brief A completed off-thread collision solve of one arm (PipelinedCollision): the fan and, optionally, the
+     *        swept sphere, together with the arm they were cast for.
+     */
+    struct AsyncArmResult
+    {
+        /// Pivot of the submitting frame (the fan origin).
+        Vector3 m_origin{};
+        /// Pivot -> desired camera of the submitting frame (the fan sweep).
+        Vector3 m_sweep{};
+        /// Tube half-width and sphere radius of the submitting frame.
+        float m_radius{0.0f};
+        /// Distance along the arm the sphere started at; < 0 when no sphere was requested.
+        float m_sphere_clear{-1.0f};
+        /// The fan result (std::nullopt = the whole tube was clear).
+        std::optional<RayHit> m_fan{};
+        /// The sphere result, distance still measured from the offset origin (std::nullopt = a miss or no sphere).
+        std::optional<RayHit> m_sphere{};
+    };
+
+    /**
+     * @brief Queues the whole physics solve of one arm to run on the collision worker thread (PipelinedCollision).
+     * @details The worker casts the unskipped @ref ray_fan_sweep along @p sweep from @p origin and, when
+     *          @p sphere_clear >= 0, the unskipped @ref sphere_world_sweep from @p sphere_clear along the arm to its
+     *          end, back to back, so the render thread's next frame gets both from one result. One-request mailbox
+     *          on the same worker as @ref submit_fan_async; the worker starts on the first submit.
+     */
+    void submit_arm_async(const Vector3 &origin, const Vector3 &sweep, float radius, float sphere_clear,
+                          CollisionLod lod = CollisionLod::Fine);
+
+    /** @brief Takes the most recent completed arm solve, if any (consumes it). Check the arm before trusting it. */
+    [[nodiscard]] std::optional<AsyncArmResult> take_arm_async();
+
+    /** @brief Stops and joins the collision worker thread. Safe if it never started. Called from shutdown(). */
+    void shutdown_async_raycast() noexcept;
 
     /**
      * @brief Fraction (0..1) of the character's silhouette occluded by WORLD geometry as seen from @p camera.
@@ -115,12 +336,17 @@ namespace TPVCamera
      *          character returns a low fraction (ignore it, no camera jump); a wall or a near post that hides
      *          most of it returns a high fraction (collide). Distance-aware by construction (a closer obstacle
      *          of the same size hides more), which a fixed width / size threshold cannot capture.
+     *          Below CollisionLod::Fine the grid is thinned to a checkerboard (outer columns on the head and hip
+     *          levels, the centre column on the chest and shin levels: six rays); each level keeps its weight, split
+     *          over the samples it still has.
      * @param out_head_fill Optional; receives the fraction (0..1) of the HEAD level (top samples) occluded, for the
      *        head-visible collision gate, or -1 if no valid head sample. nullptr to skip.
+     * @param lod Sample density (Medium / Coarse = the six-sample checkerboard).
      * @return Occluded fraction in [0, 1]; 0 if no samples were valid.
      */
     [[nodiscard]] float character_occluded_fraction(const Vector3 &camera, const Vector3 &pivot, int objtypes,
-                                                    unsigned int flags, float *out_head_fill = nullptr);
+                                                    unsigned int flags, float *out_head_fill = nullptr,
+                                                    CollisionLod lod = CollisionLod::Fine);
 
     /**
      * @brief The visible render node (IRenderNode) a physics collider belongs to, via its foreign data.
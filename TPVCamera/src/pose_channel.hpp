@@ -0,0 +1,78 @@
+/**
+ * @file pose_channel.hpp
+ * @brief Wait-free latest-value handoff of a small trivially copyable record from one producer to one consumer.
+ *
+ * @details For per-frame camera data one thread publishes and another samples (the interaction aim pose, and
+ *          the screen-forward / final-position / player-bounds records later features read off the render
+ *          thread). A seqlock makes the reader retry while a store is in flight and fail closed after a bounded
+ *          number of attempts; this channel never retries on either side.
+ *
+ *          It is a triple buffer: three slots, the producer's back slot, the consumer's front slot, and a shared
+ *          middle index. The producer fills its back slot and exchanges it with the middle, marked fresh; the
+ *          consumer, when the middle is fresh, exchanges its front slot for it. Each side only ever touches the
+ *          slot it owns, so a read can never tear and neither side waits. (Two slots with an index flip cannot
+ *          give both guarantees: the producer would have to wait for the reader to leave the slot it overwrites,
+ *          or the reader would have to retry.) A consumer that samples twice between publishes reads the same
+ *          record again; a producer that publishes twice between samples drops the older record.
+ *
+ *          Exactly ONE producer thread and ONE consumer thread, each fixed for the channel's lifetime (the same
+ *          contract as Snapshot's single reader).
+ */
+#ifndef TPVCAMERA_POSE_CHANNEL_HPP
+#define TPVCAMERA_POSE_CHANNEL_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace TPVCamera
+{
+
+    /**
+     * @class PoseChannel
+     * @brief Single-producer / single-consumer triple buffer holding the latest published @p T.
+     */
+    template <typename T>
+    class PoseChannel
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "PoseChannel payloads are copied slot to slot");
+
+    public:
+        /** @brief Producer side: publishes @p value as the latest record. Wait-free. */
+        void publish(const T &value) noexcept
+        {
+            m_slots[m_back] = value;
+            // Release: the slot write is visible before the consumer can take the slot. Acquire: the slot handed
+            // back is one the consumer has finished reading.
+            const std::uint8_t previous = m_middle.exchange(m_back | k_fresh, std::memory_order_acq_rel);
+            m_back = previous & k_index_mask;
+        }
+
+        /**
+         * @brief Consumer side: the latest published record (the initial value until the first publish).
+         * @details Wait-free. The returned reference stays valid and unchanged until this consumer's next
+         *          latest() call.
+         */
+        [[nodiscard]] const T &latest() noexcept
+        {
+            if ((m_middle.load(std::memory_order_relaxed) & k_fresh) != 0)
+            {
+                const std::uint8_t previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+                m_front = previous & k_index_mask;
+            }
+            return m_slots[m_front];
+        }
+
+    private:
+        static constexpr std::uint8_t k_index_mask = 0x3;
+        static constexpr std::uint8_t k_fresh = 0x4; // set on the middle index by publish, cleared by latest
+
+        T m_slots[3] = {};
+        std::atomic<std::uint8_t> m_middle{1};
+        std::uint8_t m_back = 2;  // producer-only
+        std::uint8_t m_front = 0; // consumer-only
+    };
+
+} // namespace TPVCamera
+
+#endif // TPVCAMERA_POSE_CHANNEL_HPP
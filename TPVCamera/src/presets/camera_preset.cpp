@@ -6,94 +6,189 @@
 #include "camera_preset.hpp"
 #include "config.hpp"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
 
 namespace TPVCamera::Presets
 {
+    namespace
+    {
+
+        /** @brief How a float field follows its target during a preset blend. */
+        enum class Blend : std::uint8_t
+        {
+            /// Exponential ease: from + (to - from) * alpha.
+            Lerp,
+            /// 0 is a MODE selector, not a continuous value: snap across the 0 boundary, ease within a mode.
+            /// eye_height 0 anchors to the bobbing FP eye (> 0 anchors to the body origin lifted by the height, and
+            /// the body origin sits at the feet, so blending across 0 sweeps the anchor through the ground);
+            /// aim_focus 0 tracks the follow distance (> 0 pins a fixed depth). The exponential ease only
+            /// asymptotes toward 0, so it would never re-select the 0 mode.
+            ModeZero,
+            /// Snapped to the target. FOV: the actual smooth ease lives in the camera hook, which blends the
+            /// rendered FOV toward the target -- or toward the live GAME FOV when the target is 0 (off) -- so
+            /// turning a preset's FOV on/off glides through the game FOV instead of snapping across 0.
+            Snap,
+        };
+
+        struct FloatBinding
+        {
+            float CameraPreset::*preset;
+            std::atomic<float> LiveSettings::*live;
+            Blend blend;
+        };
+
+        struct BoolBinding
+        {
+            bool CameraPreset::*preset;
+            std::atomic<bool> LiveSettings::*live;
+        };
+
+        // The single list of preset-owned payload fields: PresetValues index i is entry i here. Bools always snap
+        // to the target (no meaningful interpolation).
+        constexpr FloatBinding k_float_bindings[] = {
+            {&CameraPreset::follow_distance, &LiveSettings::follow_distance, Blend::Lerp},
+            {&CameraPreset::follow_distance_min, &LiveSettings::follow_distance_min, Blend::Lerp},
+            {&CameraPreset::follow_distance_max, &LiveSettings::follow_distance_max, Blend::Lerp},
+            {&CameraPreset::zoom_step, &LiveSettings::zoom_step, Blend::Lerp},
+            {&CameraPreset::offset_up, &LiveSettings::offset_up, Blend::Lerp},
+            {&CameraPreset::eye_height, &LiveSettings::eye_height, Blend::ModeZero},
+            {&CameraPreset::offset_right, &LiveSettings::offset_right, Blend::Lerp},
+            {&CameraPreset::aim_focus_distance, &LiveSettings::aim_focus_distance, Blend::ModeZero},
+            {&CameraPreset::follow_yaw, &LiveSettings::follow_yaw, Blend::Lerp},
+            {&CameraPreset::follow_pitch, &LiveSettings::follow_pitch, Blend::Lerp},
+            {&CameraPreset::fov, &LiveSettings::fov, Blend::Snap},
+
+            {&CameraPreset::orbit_sensitivity_x, &LiveSettings::orbit_sensitivity_x, Blend::Lerp},
+            {&CameraPreset::orbit_sensitivity_y, &LiveSettings::orbit_sensitivity_y, Blend::Lerp},
+            {&CameraPreset::gamepad_orbit_speed_x, &LiveSettings::gamepad_orbit_speed_x, Blend::Lerp},
+            {&CameraPreset::gamepad_orbit_speed_y, &LiveSettings::gamepad_orbit_speed_y, Blend::Lerp},
+            {&CameraPreset::orbit_pitch_min, &LiveSettings::orbit_pitch_min, Blend::Lerp},
+            {&CameraPreset::orbit_pitch_max, &LiveSettings::orbit_pitch_max, Blend::Lerp},
+            {&CameraPreset::orbit_return_speed, &LiveSettings::orbit_return_speed, Blend::Lerp},
+            {&CameraPreset::orbit_smoothing, &LiveSettings::orbit_smoothing, Blend::Lerp},
+
+            {&CameraPreset::collision_skin, &LiveSettings::collision_skin, Blend::Lerp},
+            {&CameraPreset::collision_return_speed, &LiveSettings::collision_return_speed, Blend::Lerp},
+        };
+
+        constexpr BoolBinding k_bool_bindings[] = {
+            {&CameraPreset::dynamic_eye_sync, &LiveSettings::dynamic_eye_sync},
+            {&CameraPreset::orbit_level_aim, &LiveSettings::orbit_level_aim},
+            {&CameraPreset::orbit_body_turn, &LiveSettings::orbit_body_turn},
+            {&CameraPreset::orbit_continuous_align, &LiveSettings::orbit_continuous_align},
+            {&CameraPreset::enable_collision, &LiveSettings::enable_collision},
+        };
+
+        static_assert(std::size(k_float_bindings) == k_preset_float_count, "update k_preset_float_count");
+        static_assert(std::size(k_bool_bindings) == k_preset_bool_count, "update k_preset_bool_count");
+
+        // Blend rules as a dense array for the ease loop's fix-up pass.
+        constexpr auto k_float_blend = []
+        {
+            std::array<Blend, k_preset_float_count> out{};
+            for (std::size_t i = 0; i < k_preset_float_count; ++i)
+            {
+                out[i] = k_float_bindings[i].blend;
+            }
+            return out;
+        }();
+
+    } // namespace
+
+    PresetValues pack_values(const CameraPreset &preset) noexcept
+    {
+        PresetValues v;
+        for (std::size_t i = 0; i < k_preset_float_count; ++i)
+        {
+            v.f[i] = preset.*(k_float_bindings[i].preset);
+        }
+        for (std::size_t i = 0; i < k_preset_bool_count; ++i)
+        {
+            v.b[i] = preset.*(k_bool_bindings[i].preset);
+        }
+        return v;
+    }
 
     void apply_to_live(const CameraPreset &preset, LiveSettings &s) noexcept
+    {
+        PresetValues published;
+        apply_changed_to_live(pack_values(preset), published, true, s);
+    }
+
+    void apply_changed_to_live(const PresetValues &values, PresetValues &published, bool force,
+                               LiveSettings &s) noexcept
     {
         constexpr auto rel = std::memory_order_relaxed;
 
-        s.follow_distance.store(preset.follow_distance, rel);
-        s.follow_distance_min.store(preset.follow_distance_min, rel);
-        s.follow_distance_max.store(preset.follow_distance_max, rel);
-        s.zoom_step.store(preset.zoom_step, rel);
-        s.offset_up.store(preset.offset_up, rel);
-        s.eye_height.store(preset.eye_height, rel);
-        s.dynamic_eye_sync.store(preset.dynamic_eye_sync, rel);
-        s.offset_right.store(preset.offset_right, rel);
-        s.aim_focus_distance.store(preset.aim_focus_distance, rel);
-        s.follow_yaw.store(preset.follow_yaw, rel);
-        s.follow_pitch.store(preset.follow_pitch, rel);
-        s.fov.store(preset.fov, rel);
-
-        s.orbit_sensitivity_x.store(preset.orbit_sensitivity_x, rel);
-        s.orbit_sensitivity_y.store(preset.orbit_sensitivity_y, rel);
-        s.gamepad_orbit_speed_x.store(preset.gamepad_orbit_speed_x, rel);
-        s.gamepad_orbit_speed_y.store(preset.gamepad_orbit_speed_y, rel);
-        s.orbit_pitch_min.store(preset.orbit_pitch_min, rel);
-        s.orbit_pitch_max.store(preset.orbit_pitch_max, rel);
-        s.orbit_return_speed.store(preset.orbit_return_speed, rel);
-        s.orbit_smoothing.store(preset.orbit_smoothing, rel);
-        s.orbit_level_aim.store(preset.orbit_level_aim, rel);
-        s.orbit_body_turn.store(preset.orbit_body_turn, rel);
-        s.orbit_continuous_align.store(preset.orbit_continuous_align, rel);
-
-        s.enable_collision.store(preset.enable_collision, rel);
-        s.collision_skin.store(preset.collision_skin, rel);
-        s.collision_return_speed.store(preset.collision_return_speed, rel);
+        bool changed = false;
+        for (std::size_t i = 0; i < k_preset_float_count; ++i)
+        {
+            if (force || values.f[i] != published.f[i])
+            {
+                (s.*(k_float_bindings[i].live)).store(values.f[i], rel);
+                changed = true;
+            }
+        }
+        for (std::size_t i = 0; i < k_preset_bool_count; ++i)
+        {
+            if (force || values.b[i] != published.b[i])
+            {
+                (s.*(k_bool_bindings[i].live)).store(values.b[i], rel);
+                changed = true;
+            }
+        }
+        if (changed)
+        {
+            s.preset_version.fetch_add(1, std::memory_order_release);
+        }
+        published = values;
     }
 
-    void ease_toward(CameraPreset &a, const CameraPreset &t, float alpha) noexcept
+    void ease_toward(PresetValues &a, const PresetValues &t, float alpha) noexcept
     {
-        const auto lerp = [alpha](float from, float to) noexcept { return from + (to - from) * alpha; };
-
-        a.follow_distance = lerp(a.follow_distance, t.follow_distance);
-        a.follow_distance_min = lerp(a.follow_distance_min, t.follow_distance_min);
-        a.follow_distance_max = lerp(a.follow_distance_max, t.follow_distance_max);
-        a.zoom_step = lerp(a.zoom_step, t.zoom_step);
-        a.offset_up = lerp(a.offset_up, t.offset_up);
-        // eye_height and aim_focus_distance use 0 as a MODE selector, not a continuous value: eye_height 0
-        // anchors to the bobbing FP eye (> 0 anchors to the body origin lifted by the height, and the body
-        // origin sits at the feet, so blending across 0 sweeps the anchor through the ground); aim_focus 0
-        // tracks the follow distance (> 0 pins a fixed depth). The exponential ease only asymptotes toward
-        // 0, so it would never re-select the 0 mode. Snap across the 0 boundary; blend within a mode.
-        const auto blend_mode_zero = [alpha](float from, float to) noexcept
+        // One straight lerp over every float (vectorizes), then the few non-Lerp fields are fixed up from the
+        // pre-blend value -- the ModeZero decision needs the value the field had BEFORE this step. A field within
+        // k_converge_eps (relative, floor 1 unit) of its target lands ON it: the exponential ease never reaches the
+        // target by itself, so without this a finished blend would keep rewriting every field forever.
+        constexpr float k_converge_eps = 1e-4f;
+        float blended[k_preset_float_count];
+        for (std::size_t i = 0; i < k_preset_float_count; ++i)
         {
-            constexpr float k_mode_eps = 1e-4f;
-            if ((from <= k_mode_eps) != (to <= k_mode_eps))
-                return to; // mode change: snap
-            return from + (to - from) * alpha;
-        };
-        a.eye_height = blend_mode_zero(a.eye_height, t.eye_height);
-        a.offset_right = lerp(a.offset_right, t.offset_right);
-        a.aim_focus_distance = blend_mode_zero(a.aim_focus_distance, t.aim_focus_distance);
-        a.follow_yaw = lerp(a.follow_yaw, t.follow_yaw);
-        a.follow_pitch = lerp(a.follow_pitch, t.follow_pitch);
-        // FOV is SNAPPED to the active target here; the actual smooth ease lives in the camera hook, which blends
-        // the rendered FOV toward the target -- or toward the live GAME FOV when the target is 0 (off) -- so
-        // turning a preset's FOV on/off glides through the game FOV instead of snapping across the 0 boundary.
-        a.fov = t.fov;
-
-        a.orbit_sensitivity_x = lerp(a.orbit_sensitivity_x, t.orbit_sensitivity_x);
-        a.orbit_sensitivity_y = lerp(a.orbit_sensitivity_y, t.orbit_sensitivity_y);
-        a.gamepad_orbit_speed_x = lerp(a.gamepad_orbit_speed_x, t.gamepad_orbit_speed_x);
-        a.gamepad_orbit_speed_y = lerp(a.gamepad_orbit_speed_y, t.gamepad_orbit_speed_y);
-        a.orbit_pitch_min = lerp(a.orbit_pitch_min, t.orbit_pitch_min);
-        a.orbit_pitch_max = lerp(a.orbit_pitch_max, t.orbit_pitch_max);
-        a.orbit_return_speed = lerp(a.orbit_return_speed, t.orbit_return_speed);
-        a.orbit_smoothing = lerp(a.orbit_smoothing, t.orbit_smoothing);
-
-        a.collision_skin = lerp(a.collision_skin, t.collision_skin);
-        a.collision_return_speed = lerp(a.collision_return_speed, t.collision_return_speed);
-
-        // Bools snap to the target (no meaningful interpolation).
-        a.orbit_level_aim = t.orbit_level_aim;
-        a.orbit_body_turn = t.orbit_body_turn;
-        a.orbit_continuous_align = t.orbit_continuous_align;
-        a.enable_collision = t.enable_collision;
-        a.dynamic_eye_sync = t.dynamic_eye_sync;
+            const float next = a.f[i] + (t.f[i] - a.f[i]) * alpha;
+            const float eps = k_converge_eps * std::max(1.0f, std::abs(t.f[i]));
+            blended[i] = (std::abs(t.f[i] - next) <= eps) ? t.f[i] : next;
+        }
+        constexpr float k_mode_eps = 1e-4f;
+        for (std::size_t i = 0; i < k_preset_float_count; ++i)
+        {
+            switch (k_float_blend[i])
+            {
+            case Blend::Lerp:
+                break;
+            case Blend::ModeZero:
+                if ((a.f[i] <= k_mode_eps) != (t.f[i] <= k_mode_eps))
+                {
+                    blended[i] = t.f[i]; // mode change: snap
+                }
+                break;
+            case Blend::Snap:
+                blended[i] = t.f[i];
+                break;
+            }
+        }
+        for (std::size_t i = 0; i < k_preset_float_count; ++i)
+        {
+            a.f[i] = blended[i];
+        }
+        for (std::size_t i = 0; i < k_preset_bool_count; ++i)
+        {
+            a.b[i] = t.b[i];
+        }
     }
 
 } // namespace TPVCamera::Presets
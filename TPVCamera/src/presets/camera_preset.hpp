@@ -10,12 +10,16 @@
  *          preset-owned atomics in config.hpp (LiveSettings); the single source of
  *          truth that pairs each field with its UI label, range and JSON key lives
  *          in camera_preset_fields.hpp so the slider loop and the (de)serializer
- *          never drift apart.
+ *          never drift apart. The render-side pairing (member -> LiveSettings atomic
+ *          -> blend rule) is the constexpr binding table in camera_preset.cpp, which
+ *          also fixes the PresetValues layout the resolver blends.
  */
 #ifndef TPVCAMERA_PRESETS_CAMERA_PRESET_HPP
 #define TPVCAMERA_PRESETS_CAMERA_PRESET_HPP
 
+#include <cstddef>
 #include <string>
+#include <type_traits>
 
 namespace TPVCamera
 {
@@ -87,7 +91,7 @@ namespace TPVCamera::Presets
         float collision_return_speed = 6.0f;
 
         // Content equality over every persisted field, so the store can detect when an edit has been reverted
-        // back to the saved value and clear the unsaved-changes indicator (see PresetStore::recompute_dirty).
+        // back to the saved value and clear the unsaved-changes indicator (see PresetStore::note_field_write).
         bool operator==(const CameraPreset &) const = default;
     };
 
@@ -102,20 +106,56 @@ namespace TPVCamera::Presets
     inline constexpr const char *k_builtin_kneel = "KNEEL";
     inline constexpr const char *k_builtin_cart = "CART";
 
+    /// Number of float / bool payload fields of CameraPreset (the binding table in camera_preset.cpp checks both).
+    inline constexpr std::size_t k_preset_float_count = 21;
+    inline constexpr std::size_t k_preset_bool_count = 5;
+
+    /**
+     * @struct PresetValues
+     * @brief The numeric payload of a CameraPreset as flat, trivially-copyable arrays, for the render thread.
+     * @details Laid out in the order of the constexpr binding table in camera_preset.cpp (the one list pairing each
+     *          CameraPreset member with its LiveSettings atomic and blend rule). The resolver blends and applies
+     *          these instead of CameraPreset, so a snap is a memcpy (no name / bind_state string copies) and the
+     *          blend is one straight-line lerp over @ref f.
+     */
+    struct PresetValues
+    {
+        float f[k_preset_float_count] = {};
+        bool b[k_preset_bool_count] = {};
+
+        bool operator==(const PresetValues &) const = default;
+    };
+    static_assert(std::is_trivially_copyable_v<PresetValues>);
+
+    /** @brief Packs the payload fields of @p preset (UI / init thread, at publish time). */
+    [[nodiscard]] PresetValues pack_values(const CameraPreset &preset) noexcept;
+
     /**
      * @brief Stores every preset-owned field of @p preset into the live atomics (relaxed).
-     * @details Called on the render thread by the runtime resolver each active frame. Only
-     *          the preset-owned atomics are written; state-policy globals are left alone.
+     * @details Used to seed LiveSettings from the factory DEFAULT. Only the preset-owned atomics are written;
+     *          state-policy globals are left alone.
      */
     void apply_to_live(const CameraPreset &preset, LiveSettings &settings) noexcept;
 
+    /**
+     * @brief Stores the fields of @p values that differ from @p published into the live atomics, then updates
+     *        @p published. Pass @p force to store every field (the first apply after a snap / startup).
+     * @details Called on the render thread by the runtime resolver each active frame: a converged or idle preset
+     *          leaves the shared settings lines untouched instead of rewriting ~26 atomics per frame. Bumps
+     *          LiveSettings::preset_version when anything was stored.
+     */
+    void apply_changed_to_live(const PresetValues &values, PresetValues &published, bool force,
+                               LiveSettings &settings) noexcept;
+
     /**
      * @brief Eases the float fields of @p applied toward @p target by @p alpha in [0,1]; bools snap.
-     * @details applied += (target - applied) * alpha, per float field. alpha is a per-frame
-     *          exponential factor (1 - exp(-speed * dt)) so the blend is frame-rate independent.
-     *          name / builtin / bind_state are not touched.
+     * @details applied += (target - applied) * alpha, per float field, except the fields whose blend rule says
+     *          otherwise (mode-zero fields snap across 0, FOV snaps; see camera_preset.cpp). A field that comes
+     *          within a relative 1e-4 of its target lands exactly on it, so a finished blend converges to equality
+     *          and stops producing writes. alpha is a per-frame exponential factor (1 - exp(-speed * dt)) so the
+     *          blend is frame-rate independent.
      */
-    void ease_toward(CameraPreset &applied, const CameraPreset &target, float alpha) noexcept;
+    void ease_toward(PresetValues &applied, const PresetValues &target, float alpha) noexcept;
 
 } // namespace TPVCamera::Presets
 
@@ -0,0 +1,451 @@
+/**
+ * @file preset_binary.cpp
+ * @brief Binary preset codec, memory-mapped loader and background writer (see preset_binary.hpp).
+ */
+
+#include "preset_binary.hpp"
+#include "camera_preset_fields.hpp"
+#include "alloc_stats.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <windows.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace TPVCamera::Presets
+{
+    namespace
+    {
+
+        constexpr std::uint32_t k_binary_magic = 0x50565054; // "TPVP"
+        constexpr std::uint16_t k_binary_version = 1;
+        constexpr std::size_t k_header_size = 16;
+        // A real preset file is a few KB; anything past this is not one of ours and is not mapped.
+        constexpr std::uint64_t k_max_file_size = 16ull * 1024 * 1024;
+
+        constexpr std::uint8_t k_type_float = 0;
+        constexpr std::uint8_t k_type_bool = 1;
+
+        [[nodiscard]] std::uint32_t fnv1a(std::span<const unsigned char> bytes) noexcept
+        {
+            std::uint32_t hash = 0x811c9dc5u;
+            for (const unsigned char b : bytes)
+            {
+                hash = (hash ^ b) * 0x01000193u;
+            }
+            return hash;
+        }
+
+        /// Appends little-endian scalars and length-prefixed strings (x64 is little-endian, so a memcpy suffices).
+        class ByteWriter
+        {
+        public:
+            template <typename T>
+            void put(T value)
+            {
+                const std::size_t at = m_out.size();
+                m_out.resize(at + sizeof(T));
+                std::memcpy(m_out.data() + at, &value, sizeof(T));
+            }
+
+            /// Strings longer than the prefix can express are truncated (no real name or key comes close).
+            template <typename Len>
+            void put_string(std::string_view s)
+            {
+                const std::size_t n = std::min<std::size_t>(s.size(), static_cast<Len>(~Len{0}));
+                put(static_cast<Len>(n));
+                m_out.append(s.data(), n);
+            }
+
+            [[nodiscard]] std::string &bytes() noexcept { return m_out; }
+
+        private:
+            std::string m_out;
+        };
+
+        /// Bounds-checked cursor over a file image; any overrun latches failure and yields zeros.
+        class ByteReader
+        {
+        public:
+            explicit ByteReader(std::span<const unsigned char> bytes) noexcept : m_bytes(bytes) {}
+
+            template <typename T>
+            [[nodiscard]] T get() noexcept
+            {
+                T value{};
+                if (take(sizeof(T)))
+                {
+                    std::memcpy(&value, m_bytes.data() + m_pos - sizeof(T), sizeof(T));
+                }
+                return value;
+            }
+
+            template <typename Len>
+            [[nodiscard]] std::string get_string()
+            {
+                const std::size_t n = get<Len>();
+                if (!take(n))
+                {
+                    return {};
+                }
+                return std::string(reinterpret_cast<const char *>(m_bytes.data() + m_pos - n), n);
+            }
+
+            void skip(std::size_t n) noexcept { (void)take(n); }
+
+            [[nodiscard]] bool ok() const noexcept { return m_ok; }
+            [[nodiscard]] bool at_end() const noexcept { return m_pos == m_bytes.size(); }
+
+        private:
+            [[nodiscard]] bool take(std::size_t n) noexcept
+            {
+                if (!m_ok || n > m_bytes.size() - m_pos)
+                {
+                    m_ok = false;
+                    return false;
+                }
+                m_pos += n;
+                return true;
+            }
+
+            std::span<const unsigned char> m_bytes;
+            std::size_t m_pos = 0;
+            bool m_ok = true;
+        };
+
+        [[nodiscard]] const PresetField *find_field(std::string_view key) noexcept
+        {
+            for (const PresetField &field : fields())
+            {
+                if (key == field.key)
+                    return &field;
+            }
+            return nullptr;
+        }
+
+        [[nodiscard]] std::wstring widen(const std::string &utf8)
+        {
+            const int n = MultiByteToWideChar(CP_UTF8, 0, utf8.data(), static_cast<int>(utf8.size()), nullptr, 0);
+            std::wstring out(static_cast<std::size_t>(n > 0 ? n : 0), L'\0');
+            if (n > 0)
+            {
+                MultiByteToWideChar(CP_UTF8, 0, utf8.data(), static_cast<int>(utf8.size()), out.data(), n);
+            }
+            return out;
+        }
+
+        /// Temp-then-rename write, as PresetStore always did for the JSON: a crash can only truncate the temp.
+        [[nodiscard]] bool write_file_atomic(const std::string &path, std::string_view bytes, std::ios::openmode mode)
+        {
+            DMK::Logger &logger = DMK::Logger::get_instance();
+            const std::string temp_path = path + ".tmp";
+            {
+                std::ofstream out(temp_path, mode | std::ios::trunc);
+                if (!out)
+                {
+                    logger.warning("Preset save failed: cannot open {}", temp_path);
+                    return false;
+                }
+                out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+                out.flush();
+                if (!out)
+                {
+                    logger.warning("Preset save failed: write error on {}", temp_path);
+                    std::error_code remove_ec;
+                    std::filesystem::remove(temp_path, remove_ec);
+                    return false;
+                }
+            } // close the stream so the rename sees a fully flushed file
+            std::error_code rename_ec;
+            std::filesystem::rename(temp_path, path, rename_ec);
+            if (rename_ec)
+            {
+                logger.warning("Preset save failed: cannot replace {} ({})", path, rename_ec.message());
+                std::error_code remove_ec;
+                std::filesystem::remove(temp_path, remove_ec);
+                return false;
+            }
+            return true;
+        }
+
+        struct WriteJob
+        {
+            std::string binary_path;
+            std::string binary;
+            std::string json_path;
+            std::string json_text;
+        };
+
+        void run_job(const WriteJob &job)
+        {
+            // The export goes first so the binary copy is never older than the JSON it was exported with;
+            // PresetStore::load imports the JSON only when it is strictly newer.
+            if (!job.json_path.empty() && !job.json_text.empty() &&
+                write_file_atomic(job.json_path, job.json_text, std::ios::out))
+            {
+                DMK::Logger::get_instance().info("Presets exported to {}", job.json_path);
+            }
+            if (write_file_atomic(job.binary_path, job.binary, std::ios::out | std::ios::binary))
+            {
+                DMK::Logger::get_instance().info("Presets saved to {}", job.binary_path);
+            }
+        }
+
+        std::mutex s_job_mutex;
+        std::optional<WriteJob> s_job; // guarded by s_job_mutex; latest queue wins
+
+        HANDLE s_writer_thread = nullptr;
+        HANDLE s_writer_wake = nullptr; // auto-reset: signalled per queue and on drain
+        std::atomic<bool> s_writer_shutdown{false};
+
+        DWORD WINAPI preset_writer(LPVOID)
+        {
+            AllocStats::set_thread_tag(AllocStats::AllocTag::Presets);
+            for (;;)
+            {
+                WaitForSingleObject(s_writer_wake, INFINITE);
+                for (;;)
+                {
+                    std::optional<WriteJob> job;
+                    {
+                        const std::lock_guard<std::mutex> lock(s_job_mutex);
+                        job.swap(s_job);
+                    }
+                    if (!job)
+                    {
+                        break;
+                    }
+                    run_job(*job);
+                }
+                // Checked after the drain above, so a shutdown never drops a write queued just before it.
+                if (s_writer_shutdown.load(std::memory_order_acquire))
+                {
+                    return 0;
+                }
+            }
+        }
+
+        /// Starts the writer on first use. Store thread only (the only submitter), so no start race.
+        bool ensure_writer()
+        {
+            if (s_writer_thread != nullptr)
+            {
+                return true;
+            }
+            if (s_writer_wake == nullptr)
+            {
+                s_writer_wake = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+                if (s_writer_wake == nullptr)
+                {
+                    return false;
+                }
+            }
+            s_writer_shutdown.store(false, std::memory_order_release);
+            s_writer_thread = CreateThread(nullptr, 0, preset_writer, nullptr, 0, nullptr);
+            if (s_writer_thread == nullptr)
+            {
+                DMK::Logger::get_instance().warning("Presets: writer thread failed to start; saving inline");
+                return false;
+            }
+            return true;
+        }
+
+    } // namespace
+
+    std::string encode_presets(const PresetDocument &doc)
+    {
+        ByteWriter body;
+        body.put<float>(doc.ui_scale);
+        body.put<std::uint8_t>(doc.value_compact ? 1 : 0);
+        body.put_string<std::uint16_t>(doc.editing);
+        body.put<std::uint16_t>(static_cast<std::uint16_t>(doc.shared_fields.size()));
+        for (const std::string &key : doc.shared_fields)
+        {
+            body.put_string<std::uint8_t>(key);
+        }
+
+        const std::span<const PresetField> table = fields();
+        body.put<std::uint32_t>(static_cast<std::uint32_t>(doc.presets.size()));
+        for (const CameraPreset &preset : doc.presets)
+        {
+            body.put_string<std::uint16_t>(preset.name);
+            body.put<std::uint8_t>(preset.builtin ? 1 : 0);
+            body.put_string<std::uint16_t>(preset.bind_state);
+            body.put<std::uint16_t>(static_cast<std::uint16_t>(table.size()));
+            for (const PresetField &field : table)
+            {
+                body.put_string<std::uint8_t>(field.key);
+                if (field.type == FieldType::Float)
+                {
+                    body.put<std::uint8_t>(k_type_float);
+                    body.put<std::uint8_t>(sizeof(float));
+                    body.put<float>(preset.*(field.f));
+                }
+                else
+                {
+                    body.put<std::uint8_t>(k_type_bool);
+                    body.put<std::uint8_t>(1);
+                    body.put<std::uint8_t>(preset.*(field.b) ? 1 : 0);
+                }
+            }
+        }
+
+        const std::string &payload = body.bytes();
+        ByteWriter file;
+        file.put<std::uint32_t>(k_binary_magic);
+        file.put<std::uint16_t>(k_binary_version);
+        file.put<std::uint16_t>(0);
+        file.put<std::uint32_t>(static_cast<std::uint32_t>(payload.size()));
+        file.put<std::uint32_t>(
+            fnv1a({reinterpret_cast<const unsigned char *>(payload.data()), payload.size()}));
+        file.bytes().append(payload);
+        return std::move(file.bytes());
+    }
+
+    std::optional<PresetDocument> decode_presets(std::span<const unsigned char> bytes)
+    {
+        if (bytes.size() < k_header_size)
+        {
+            return std::nullopt;
+        }
+        ByteReader header(bytes.first(k_header_size));
+        const auto magic = header.get<std::uint32_t>();
+        const auto version = header.get<std::uint16_t>();
+        (void)header.get<std::uint16_t>();
+        const auto body_size = header.get<std::uint32_t>();
+        const auto body_hash = header.get<std::uint32_t>();
+        const std::span<const unsigned char> body = bytes.subspan(k_header_size);
+        if (magic != k_binary_magic || version != k_binary_version || body_size != body.size() ||
+            body_hash != fnv1a(body))
+        {
+            return std::nullopt;
+        }
+
+        ByteReader in(body);
+        PresetDocument doc;
+        doc.ui_scale = in.get<float>();
+        doc.value_compact = in.get<std::uint8_t>() != 0;
+        doc.editing = in.get_string<std::uint16_t>();
+        const auto shared_count = in.get<std::uint16_t>();
+        for (std::uint16_t i = 0; i < shared_count && in.ok(); ++i)
+        {
+            doc.shared_fields.push_back(in.get_string<std::uint8_t>());
+        }
+
+        const auto preset_count = in.get<std::uint32_t>();
+        for (std::uint32_t i = 0; i < preset_count && in.ok(); ++i)
+        {
+            CameraPreset preset; // starts at factory defaults, like preset_from_json
+            preset.name = in.get_string<std::uint16_t>();
+            preset.builtin = in.get<std::uint8_t>() != 0;
+            preset.bind_state = in.get_string<std::uint16_t>();
+            const auto field_count = in.get<std::uint16_t>();
+            for (std::uint16_t f = 0; f < field_count && in.ok(); ++f)
+            {
+                const std::string key = in.get_string<std::uint8_t>();
+                const auto type = in.get<std::uint8_t>();
+                const auto size = in.get<std::uint8_t>();
+                const PresetField *field = find_field(key);
+                if (field != nullptr && field->type == FieldType::Float && type == k_type_float &&
+                    size == sizeof(float))
+                {
+                    preset.*(field->f) = in.get<float>();
+                }
+                else if (field != nullptr && field->type == FieldType::Bool && type == k_type_bool && size == 1)
+                {
+                    preset.*(field->b) = in.get<std::uint8_t>() != 0;
+                }
+                else
+                {
+                    in.skip(size); // a field this build does not know (or no longer types this way)
+                }
+            }
+            doc.presets.push_back(std::move(preset));
+        }
+
+        if (!in.ok() || !in.at_end())
+        {
+            return std::nullopt;
+        }
+        return doc;
+    }
+
+    std::optional<PresetDocument> read_presets_mapped(const std::string &path)
+    {
+        const HANDLE file = CreateFileW(widen(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return std::nullopt;
+        }
+        std::optional<PresetDocument> doc;
+        LARGE_INTEGER size{};
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0 &&
+            static_cast<std::uint64_t>(size.QuadPart) <= k_max_file_size)
+        {
+            const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                if (view != nullptr)
+                {
+                    doc = decode_presets(
+                        {static_cast<const unsigned char *>(view), static_cast<std::size_t>(size.QuadPart)});
+                    UnmapViewOfFile(view);
+                }
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+        return doc;
+    }
+
+    void queue_preset_write(std::string binary_path, std::string binary, std::string json_path, std::string json_text)
+    {
+        WriteJob job{std::move(binary_path), std::move(binary), std::move(json_path), std::move(json_text)};
+        if (!ensure_writer())
+        {
+            run_job(job);
+            return;
+        }
+        {
+            const std::lock_guard<std::mutex> lock(s_job_mutex);
+            // A pending export must survive being superseded by a binary-only save queued behind it.
+            if (s_job && job.json_text.empty() && !s_job->json_text.empty())
+            {
+                job.json_path = std::move(s_job->json_path);
+                job.json_text = std::move(s_job->json_text);
+            }
+            s_job = std::move(job);
+        }
+        SetEvent(s_writer_wake);
+    }
+
+    void drain_preset_writer() noexcept
+    {
+        if (s_writer_thread == nullptr)
+        {
+            return;
+        }
+        s_writer_shutdown.store(true, std::memory_order_release);
+        SetEvent(s_writer_wake);
+        // A write is a few KB, so the join is short. On a timeout (a stalled disk) leak the handle rather than
+        // close it under a running thread, as the collision worker does.
+        if (WaitForSingleObject(s_writer_thread, 5000) == WAIT_OBJECT_0)
+        {
+            CloseHandle(s_writer_thread);
+            s_writer_thread = nullptr;
+        }
+    }
+
+} // namespace TPVCamera::Presets
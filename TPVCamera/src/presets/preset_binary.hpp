@@ -0,0 +1,75 @@
+/**
+ * @file preset_binary.hpp
+ * @brief Compact binary preset file: encode / decode, memory-mapped read, and the background writer.
+ *
+ * @details The binary file is the store's working copy (KCD2_TPVCamera_presets.bin). It is loaded through a
+ *          read-only file mapping (no stream buffering, no parse tree) and rewritten by a single background
+ *          thread, so the overlay's Save never waits on the disk. The JSON file stays the hand-editable
+ *          import/export format: PresetStore imports it when it is newer than the binary copy and refreshes it on
+ *          shutdown.
+ *
+ *          Layout (little-endian, version k_binary_version):
+ *            header   magic "TPVP" u32, version u16, reserved u16, body size u32, body FNV-1a u32
+ *            body     ui_scale f32, value_compact u8, editing str16, shared-key count u16 + str8 each,
+ *                     preset count u32, then per preset: name str16, builtin u8, bind_state str16, field count u16,
+ *                     then per field: key str8, type u8 (0 float, 1 bool), payload size u8, payload
+ *          Every field is keyed by its stable PresetField::key and carries its own payload size, so a file written
+ *          by a newer build with fields this build does not know still loads: the unknown ones are skipped and the
+ *          missing ones keep the CameraPreset defaults, exactly like the JSON loader.
+ */
+#ifndef TPVCAMERA_PRESETS_PRESET_BINARY_HPP
+#define TPVCAMERA_PRESETS_PRESET_BINARY_HPP
+
+#include "camera_preset.hpp"
+
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace TPVCamera::Presets
+{
+
+    /**
+     * @struct PresetDocument
+     * @brief Everything one preset file persists (see PresetStore for what each member means).
+     */
+    struct PresetDocument
+    {
+        std::vector<CameraPreset> presets;
+        std::vector<std::string> shared_fields;
+        std::string editing;
+        float ui_scale = 1.0f;
+        bool value_compact = true;
+    };
+
+    /** @brief Serializes @p doc to the binary layout above. */
+    [[nodiscard]] std::string encode_presets(const PresetDocument &doc);
+
+    /**
+     * @brief Parses a binary preset file image.
+     * @return The document, or nullopt if the image is truncated, fails its checksum, or has another version.
+     */
+    [[nodiscard]] std::optional<PresetDocument> decode_presets(std::span<const unsigned char> bytes);
+
+    /**
+     * @brief Maps @p path read-only and decodes it.
+     * @return The document, or nullopt if the file is absent, unmappable or not a valid preset image.
+     */
+    [[nodiscard]] std::optional<PresetDocument> read_presets_mapped(const std::string &path);
+
+    /**
+     * @brief Queues a write on the preset writer thread (started on first use); the latest queued write wins.
+     * @details The writer writes @p json_text to @p json_path first when it is non-empty (an export), then
+     *          @p binary to @p binary_path, each through a sibling temp file and a rename. The binary copy always
+     *          lands last, so an export never looks newer than the copy it mirrors.
+     */
+    void queue_preset_write(std::string binary_path, std::string binary, std::string json_path = {},
+                            std::string json_text = {});
+
+    /** @brief Stops the writer thread after it finishes any queued write (shutdown; call from the store's thread). */
+    void drain_preset_writer() noexcept;
+
+} // namespace TPVCamera::Presets
+
+#endif // TPVCAMERA_PRESETS_PRESET_BINARY_HPP
@@ -6,6 +6,8 @@
 #include "preset_runtime.hpp"
 #include "config.hpp"
 #include "game_state.hpp"
+#include "pose_channel.hpp"
+#include "snapshot.hpp"
 
 #include <atomic>
 #include <bit>
@@ -16,16 +18,41 @@ namespace TPVCamera::Presets
     namespace
     {
 
-        // Published by the UI/init thread, read by the render thread via an atomic shared_ptr load each frame
-        // (a spinlock-guarded refcount bump on MSVC, no heap allocation).
-        std::atomic<std::shared_ptr<const StateBindingTable>> g_table{nullptr};
+        // Published by the UI/init thread, read by the render thread through a Snapshot read guard each frame
+        // (wait-free: no lock, no refcount, no heap allocation; see snapshot.hpp).
+        Snapshot<StateBindingTable> g_table;
+
+        // Slider preview of the pinned preset (UI thread -> render thread), tagged with the table serial it
+        // builds on (see preview_pin).
+        struct PinPreview
+        {
+            std::uint32_t serial = 0;
+            PresetValues values;
+        };
+        PoseChannel<PinPreview> g_pin_preview;
 
         // Render-thread-only transition state (resolve_and_apply / reset_transition run only there).
-        CameraPreset s_applied;
-        CameraPreset s_stage1; // intermediate state of the 2-stage critically-damped preset blend (see below)
+        PresetValues s_applied;
+        PresetValues s_stage1;    // intermediate state of the 2-stage critically-damped preset blend (see below)
+        PresetValues s_published; // what LiveSettings last received (apply_changed_to_live skips equal fields)
         bool s_have_applied = false;
         bool s_snap_next = false;
 
+        // Render-thread memo of resolve_active_binding over the current table. The debounced state only changes
+        // on a stance / combat transition and takes few distinct values, so almost every frame is one probe
+        // instead of a scan of every bound preset. Direct-mapped by state; flushed when a different table is read
+        // (pointer and serial both, so a freed-and-reused allocation cannot alias the old entries).
+        struct BindingMemoEntry
+        {
+            std::uint32_t state = 0;
+            int index = -1;
+            bool valid = false;
+        };
+        constexpr std::size_t k_binding_memo_size = 16; // power of two
+        BindingMemoEntry s_binding_memo[k_binding_memo_size];
+        const StateBindingTable *s_binding_memo_table = nullptr;
+        std::uint32_t s_binding_memo_serial = 0;
+
         /// Trims leading and trailing ASCII whitespace from a view (no allocation).
         [[nodiscard]] std::string_view trim_token(std::string_view text) noexcept
         {
@@ -69,24 +96,51 @@ namespace TPVCamera::Presets
             return weight;
         }
 
+        /** @brief resolve_active_binding(@p state, @p table.masks) through the render-thread memo. */
+        [[nodiscard]] int memoized_binding(const StateBindingTable &table, std::uint32_t state) noexcept
+        {
+            if (s_binding_memo_table != &table || s_binding_memo_serial != table.pin_serial)
+            {
+                for (BindingMemoEntry &entry : s_binding_memo)
+                {
+                    entry.valid = false;
+                }
+                s_binding_memo_table = &table;
+                s_binding_memo_serial = table.pin_serial;
+            }
+            // Fibonacci hash: the state bits are clustered in the low word, the top bits of the product are not.
+            const std::size_t slot = (state * 0x9E3779B1u) >> (32 - std::countr_zero(k_binding_memo_size));
+            BindingMemoEntry &entry = s_binding_memo[slot];
+            if (!entry.valid || entry.state != state)
+            {
+                entry.state = state;
+                entry.index = resolve_active_binding(state, table.masks);
+                entry.valid = true;
+            }
+            return entry.index;
+        }
+
         /**
          * @brief Resolves the active preset target for @p state: the editing pin wins, otherwise the
          *        most-specific bound preset (see resolve_active_binding).
          * @details Falls back to a neutral preset only if the table is empty (pre-publish), which cannot
          *          happen once a table is published since DEFAULT is always bindable.
          */
-        [[nodiscard]] const CameraPreset &select_target(const StateBindingTable &table, std::uint32_t state) noexcept
+        [[nodiscard]] const PresetValues &select_target(const StateBindingTable &table, std::uint32_t state) noexcept
         {
             if (table.has_pin)
             {
-                return table.pinned;
+                // A preview written since this table (or since one still in flight) carries the newer values.
+                const PinPreview &preview = g_pin_preview.latest();
+                return static_cast<std::int32_t>(preview.serial - table.pin_serial) >= 0 ? preview.values
+                                                                                           : table.pinned;
             }
-            const int index = resolve_active_binding(state, table.masks);
-            if (index >= 0 && static_cast<std::size_t>(index) < table.presets.size())
+            const int index = memoized_binding(table, state);
+            if (index >= 0 && static_cast<std::size_t>(index) < table.values.size())
             {
-                return table.presets[static_cast<std::size_t>(index)];
+                return table.values[static_cast<std::size_t>(index)];
             }
-            static const CameraPreset s_fallback{};
+            static const PresetValues s_fallback = pack_values(CameraPreset{});
             return s_fallback;
         }
 
@@ -258,20 +312,29 @@ namespace TPVCamera::Presets
         return best;
     }
 
-    void publish_table(std::shared_ptr<const StateBindingTable> table) noexcept
+    void publish_table(std::unique_ptr<const StateBindingTable> table)
+    {
+        g_table.publish(std::move(table));
+    }
+
+    void preview_pin(std::uint32_t serial, const PresetValues &values) noexcept
     {
-        g_table.store(std::move(table), std::memory_order_release);
+        PinPreview preview;
+        preview.serial = serial;
+        preview.values = values;
+        g_pin_preview.publish(preview);
     }
 
     void resolve_and_apply(uint32_t state, float delta_seconds) noexcept
     {
         LiveSettings &cfg = settings();
 
-        const std::shared_ptr<const StateBindingTable> table = g_table.load(std::memory_order_acquire);
+        // The guard pins the table until the end of this function (select_target returns a reference into it).
+        const auto table = g_table.read();
         if (!table)
             return;
 
-        const CameraPreset &target = select_target(*table, state);
+        const PresetValues &target = select_target(*table, state);
 
         // Frame-rate-independent preset blend. A SINGLE exponential low-pass starts at full speed and decays,
         // so transitions lurch off the mark (no ease-in). Cascading TWO low-passes makes a critically-damped
@@ -279,6 +342,7 @@ namespace TPVCamera::Presets
         // and out. Snap on the first frame and after a suppression gap so the view does not ease across stale
         // state. The 1.6x rate compensates for the 2-stage's slower rise so PresetBlendSpeed keeps its feel.
         const float speed = cfg.preset_blend_speed.load(std::memory_order_relaxed);
+        const bool first_apply = !s_have_applied;
         if (!s_have_applied || s_snap_next || speed <= 0.0f)
         {
             s_applied = target;
@@ -286,15 +350,16 @@ namespace TPVCamera::Presets
             s_have_applied = true;
             s_snap_next = false;
         }
-        else
+        else if (!(s_applied == target && s_stage1 == target))
         {
+            // (Both stages sitting exactly on the target is the steady state: nothing to ease, nothing to write.)
             const float dt = (delta_seconds > 0.0f && delta_seconds < 1.0f) ? delta_seconds : 0.0f;
             const float alpha = 1.0f - std::exp(-speed * 1.6f * dt);
             ease_toward(s_stage1, target, alpha);    // stage 1: low-pass the target
             ease_toward(s_applied, s_stage1, alpha); // stage 2: low-pass stage 1 -> ease-in and out
         }
 
-        apply_to_live(s_applied, cfg);
+        apply_changed_to_live(s_applied, s_published, first_apply, cfg);
     }
 
     void reset_transition() noexcept
@@ -3,9 +3,9 @@
  * @brief Render-thread resolver that selects the active preset by game state (or an
  *        editing pin), eases toward it, and applies it to the live settings.
  *
- * @details The UI/init thread publishes an immutable StateBindingTable snapshot via an
- *          atomic shared_ptr swap; the render thread reads it with one atomic shared_ptr load each
- *          frame inside the frustum-builder detour (a spinlock-guarded refcount bump on MSVC, no heap
+ * @details The UI/init thread publishes an immutable StateBindingTable snapshot through a
+ *          generation-counted Snapshot cell (snapshot.hpp); the render thread pins it with a wait-free,
+ *          refcount-free read guard each frame inside the frustum-builder detour (no lock, no heap
  *          allocation). The render thread NEVER touches the PresetStore.
  *          Each preset binds to a SET of game-state bits (its mask). The resolver picks the bound
  *          preset whose mask is the most specific subset of the active state (most bits wins); equal-
@@ -33,20 +33,24 @@ namespace TPVCamera::Presets
 
     /**
      * @struct StateBindingTable
-     * @brief Parallel preset/mask vectors for every bound preset plus an optional editing-pin override,
+     * @brief Parallel payload/mask vectors for every bound preset plus an optional editing-pin override,
      *        published as an immutable snapshot for the render thread.
+     * @details Carries only the packed numeric payload (PresetValues) of each preset: the render thread never
+     *          needs a name or bind_state, so the table holds no strings.
      */
     struct StateBindingTable
     {
         /// Bindable presets (built-ins plus any state-bound user presets), in publish order (built-ins first).
-        std::vector<CameraPreset> presets;
-        /// Parallel to @ref presets: masks[i] is the GameState bit mask preset[i] auto-applies on (0 = floor).
+        std::vector<PresetValues> values;
+        /// Parallel to @ref values: masks[i] is the GameState bit mask values[i] auto-applies on (0 = floor).
         std::vector<std::uint32_t> masks;
 
         /// When set, @ref pinned overrides state selection (UI preview).
         bool has_pin = false;
         /// The editing preset to preview live while the panel pins it.
-        CameraPreset pinned;
+        PresetValues pinned;
+        /// Publish serial of this table; a preview_pin() record at or past it supersedes @ref pinned.
+        std::uint32_t pin_serial = 0;
     };
 
     /**
@@ -85,12 +89,24 @@ namespace TPVCamera::Presets
     [[nodiscard]] int resolve_active_binding(std::uint32_t active_state, std::span<const std::uint32_t> masks) noexcept;
 
     /**
-     * @brief Publishes a new binding-table snapshot for the render thread (atomic swap).
+     * @brief Publishes a new binding-table snapshot for the render thread (pointer swap).
      * @details Called by the PresetStore on the UI/init thread whenever presets, the
-     *          editing selection, or the pin state change. Passing nullptr disables the
+     *          editing selection, or the pin state change. Takes ownership; the previous table is
+     *          freed once the render thread can no longer be reading it. Passing nullptr disables the
      *          resolver (the camera then keeps the INI-loaded live settings).
      */
-    void publish_table(std::shared_ptr<const StateBindingTable> table) noexcept;
+    void publish_table(std::unique_ptr<const StateBindingTable> table);
+
+    /**
+     * @brief Replaces the pinned payload of the published table without republishing it (slider live preview).
+     * @details Called by the PresetStore on the UI thread when a field of the pinned editing preset changes. The
+     *          record goes through a wait-free PoseChannel (no allocation, no Snapshot swap); the resolver uses it
+     *          instead of StateBindingTable::pinned while @p serial is at or past the table's pin_serial, so a
+     *          later publish (which packs the newest values itself) takes over again.
+     * @param serial The pin_serial of the last table the store published.
+     * @param values The pinned editing preset's current payload.
+     */
+    void preview_pin(std::uint32_t serial, const PresetValues &values) noexcept;
 
     /**
      * @brief Resolves the target preset for @p state, eases toward it, and applies it live.
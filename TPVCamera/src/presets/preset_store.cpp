@@ -1,22 +1,27 @@
 /**
  * @file preset_store.cpp
- * @brief PresetStore: JSON persistence, built-in protection, CRUD, and publishing.
+ * @brief PresetStore: binary persistence with JSON import/export, built-in protection, CRUD, and publishing.
  */
 
 #include "preset_store.hpp"
 #include "camera_preset_fields.hpp"
 #include "default_presets.hpp"
+#include "preset_binary.hpp"
 #include "preset_runtime.hpp"
+#include "overlay/overlay.hpp"
 
 #include <DetourModKit.hpp>
 #include <nlohmann/json.hpp>
 
 #include <algorithm>
+#include <bit>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <system_error>
@@ -30,6 +35,9 @@ namespace TPVCamera::Presets
 
         constexpr int k_schema_version = 1;
 
+        // PresetStore::m_modified_fields keeps one bit per fields() entry (one per payload field).
+        static_assert(k_preset_float_count + k_preset_bool_count <= 32, "widen the modified-field bitset");
+
         /// Canonical built-in order, with the state each binds to.
         struct BuiltinSpec
         {
@@ -85,52 +93,221 @@ namespace TPVCamera::Presets
             return out;
         }
 
-        CameraPreset preset_from_json(const json &in)
+        /**
+         * @brief SAX reader for the preset JSON layout: builds the PresetDocument straight from parser events, with
+         *        no intermediate DOM.
+         * @details Tolerant like the layout always was: a missing key keeps its default, a value of the wrong type
+         *          is ignored, unknown keys and nested values are skipped, and field values go through the
+         *          fields() key table. Only malformed JSON fails the read. The legacy single-axis
+         *          orbit_sensitivity / gamepad_orbit_speed seed both axes when neither axis key is present.
+         */
+        class PresetDocumentReader final : public nlohmann::json_sax<json>
         {
-            CameraPreset preset; // starts at factory defaults
+        public:
+            PresetDocumentReader() { m_doc.editing = k_builtin_default; }
+
+            [[nodiscard]] PresetDocument take() { return std::move(m_doc); }
+            [[nodiscard]] const std::string &error() const noexcept { return m_error; }
+
+            bool null() override { return true; }
+            bool boolean(bool v) override
+            {
+                if (m_skip != 0)
+                    return true;
+                if (m_at == At::Root)
+                {
+                    if (m_key == "value_compact")
+                        m_doc.value_compact = v;
+                }
+                else if (m_at == At::Preset)
+                {
+                    if (m_key == "builtin")
+                        m_preset.builtin = v;
+                }
+                else if (m_at == At::Fields)
+                {
+                    const PresetField *field = find_field(m_key);
+                    if (field != nullptr && field->type == FieldType::Bool)
+                        m_preset.*(field->b) = v;
+                }
+                return true;
+            }
+            bool number_integer(number_integer_t v) override { return number(static_cast<float>(v)); }
+            bool number_unsigned(number_unsigned_t v) override { return number(static_cast<float>(v)); }
+            bool number_float(number_float_t v, const string_t &) override { return number(static_cast<float>(v)); }
+            bool string(string_t &v) override
+            {
+                if (m_skip != 0)
+                    return true;
+                if (m_at == At::Root)
+                {
+                    if (m_key == "editing")
+                        m_doc.editing = std::move(v);
+                }
+                else if (m_at == At::SharedFields)
+                    m_doc.shared_fields.push_back(std::move(v));
+                else if (m_at == At::Preset)
+                {
+                    if (m_key == "name")
+                        m_preset.name = std::move(v);
+                    else if (m_key == "bind_state")
+                        m_preset.bind_state = std::move(v);
+                }
+                return true;
+            }
+            bool binary(binary_t &) override { return true; }
+
+            bool start_object(std::size_t) override
+            {
+                if (m_skip != 0)
+                    ++m_skip;
+                else if (m_at == At::Start)
+                    m_at = At::Root;
+                else if (m_at == At::Presets)
+                {
+                    m_preset = CameraPreset{};
+                    m_legacy = {};
+                    m_at = At::Preset;
+                }
+                else if (m_at == At::Preset && m_key == "fields")
+                    m_at = At::Fields;
+                else
+                    m_skip = 1;
+                return true;
+            }
+            bool end_object() override
+            {
+                if (m_skip != 0)
+                    --m_skip;
+                else if (m_at == At::Fields)
+                {
+                    seed_axes_from_legacy(m_legacy.orbit, &CameraPreset::orbit_sensitivity_x,
+                                          &CameraPreset::orbit_sensitivity_y);
+                    seed_axes_from_legacy(m_legacy.gamepad, &CameraPreset::gamepad_orbit_speed_x,
+                                          &CameraPreset::gamepad_orbit_speed_y);
+                    m_at = At::Preset;
+                }
+                else if (m_at == At::Preset)
+                {
+                    m_doc.presets.push_back(std::move(m_preset));
+                    m_at = At::Presets;
+                }
+                else if (m_at == At::Root)
+                    m_at = At::Done;
+                return true;
+            }
+            bool start_array(std::size_t) override
+            {
+                if (m_skip != 0)
+                    ++m_skip;
+                else if (m_at == At::Root && m_key == "shared_fields")
+                    m_at = At::SharedFields;
+                else if (m_at == At::Root && m_key == "presets")
+                    m_at = At::Presets;
+                else
+                    m_skip = 1;
+                return true;
+            }
+            bool end_array() override
+            {
+                if (m_skip != 0)
+                    --m_skip;
+                else if (m_at == At::SharedFields || m_at == At::Presets)
+                    m_at = At::Root;
+                return true;
+            }
+            bool key(string_t &k) override
+            {
+                if (m_skip != 0)
+                    return true;
+                m_key = std::move(k);
+                if (m_at == At::Fields)
+                {
+                    m_legacy.orbit.axis_seen |= m_key == "orbit_sensitivity_x" || m_key == "orbit_sensitivity_y";
+                    m_legacy.gamepad.axis_seen |= m_key == "gamepad_orbit_speed_x" || m_key == "gamepad_orbit_speed_y";
+                }
+                return true;
+            }
+            bool parse_error(std::size_t, const std::string &, const nlohmann::detail::exception &e) override
+            {
+                m_error = e.what();
+                return false;
+            }
 
-            if (in.contains("name") && in["name"].is_string())
-                preset.name = in["name"].get<std::string>();
-            if (in.contains("builtin") && in["builtin"].is_boolean())
-                preset.builtin = in["builtin"].get<bool>();
-            if (in.contains("bind_state") && in["bind_state"].is_string())
-                preset.bind_state = in["bind_state"].get<std::string>();
+        private:
+            enum class At : std::uint8_t
+            {
+                Start,
+                Root,
+                SharedFields,
+                Presets,
+                Preset,
+                Fields,
+                Done,
+            };
+
+            /// One pre-split single-axis key: its value, and whether either per-axis key was present.
+            struct LegacyAxis
+            {
+                std::optional<float> value;
+                bool axis_seen = false;
+            };
+            struct Legacy
+            {
+                LegacyAxis orbit;
+                LegacyAxis gamepad;
+            };
 
-            if (in.contains("fields") && in["fields"].is_object())
+            bool number(float v)
             {
-                const json &values = in["fields"];
-                for (const PresetField &field : fields())
+                if (m_skip != 0)
+                    return true;
+                if (m_at == At::Root)
                 {
-                    if (!values.contains(field.key))
-                        continue;
-                    const json &v = values[field.key];
-                    if (field.type == FieldType::Float && v.is_number())
-                        preset.*(field.f) = v.get<float>();
-                    else if (field.type == FieldType::Bool && v.is_boolean())
-                        preset.*(field.b) = v.get<bool>();
+                    if (m_key == "ui_scale")
+                        m_doc.ui_scale = v;
                 }
+                else if (m_at == At::Fields)
+                {
+                    const PresetField *field = find_field(m_key);
+                    if (field != nullptr && field->type == FieldType::Float)
+                        m_preset.*(field->f) = v;
+                    else if (m_key == "orbit_sensitivity")
+                        m_legacy.orbit.value = v;
+                    else if (m_key == "gamepad_orbit_speed")
+                        m_legacy.gamepad.value = v;
+                }
+                return true;
+            }
 
-                // Backward compatibility: orbit_sensitivity / gamepad_orbit_speed were each split into per-axis
-                // X/Y fields. A preset written before the split carries only the old single key; seed BOTH new
-                // axes from it (when neither new key is present) so an existing tune is not silently lost.
-                const auto seed_axes_from_legacy = [&values, &preset](const char *legacy_key, const char *x_key,
-                                                                      const char *y_key, float CameraPreset::*x,
-                                                                      float CameraPreset::*y)
+            void seed_axes_from_legacy(const LegacyAxis &legacy, float CameraPreset::*x, float CameraPreset::*y)
+            {
+                if (legacy.value && !legacy.axis_seen)
                 {
-                    if (values.contains(legacy_key) && values[legacy_key].is_number() && !values.contains(x_key) &&
-                        !values.contains(y_key))
-                    {
-                        const float v = values[legacy_key].get<float>();
-                        preset.*x = v;
-                        preset.*y = v;
-                    }
-                };
-                seed_axes_from_legacy("orbit_sensitivity", "orbit_sensitivity_x", "orbit_sensitivity_y",
-                                      &CameraPreset::orbit_sensitivity_x, &CameraPreset::orbit_sensitivity_y);
-                seed_axes_from_legacy("gamepad_orbit_speed", "gamepad_orbit_speed_x", "gamepad_orbit_speed_y",
-                                      &CameraPreset::gamepad_orbit_speed_x, &CameraPreset::gamepad_orbit_speed_y);
+                    m_preset.*x = *legacy.value;
+                    m_preset.*y = *legacy.value;
+                }
             }
-            return preset;
+
+            PresetDocument m_doc;
+            CameraPreset m_preset;
+            Legacy m_legacy;
+            std::string m_key;
+            std::string m_error;
+            At m_at = At::Start;
+            int m_skip = 0; // depth inside a value the layout does not use
+        };
+
+        /// Parses the JSON layout (the import format) without a DOM. nullopt on malformed JSON, with @p error set.
+        [[nodiscard]] std::optional<PresetDocument> document_from_json(std::string_view text, std::string &error)
+        {
+            PresetDocumentReader reader;
+            if (!json::sax_parse(text.data(), text.data() + text.size(), &reader))
+            {
+                error = reader.error();
+                return std::nullopt;
+            }
+            return reader.take();
         }
 
         /// Parses the embedded factory JSON once into the canonical built-in preset list.
@@ -138,26 +315,43 @@ namespace TPVCamera::Presets
         {
             static const std::vector<CameraPreset> presets = []
             {
-                std::vector<CameraPreset> out;
-                try
-                {
-                    const json root = json::parse(k_default_presets_json);
-                    if (root.contains("presets") && root["presets"].is_array())
-                    {
-                        for (const json &entry : root["presets"])
-                            out.push_back(preset_from_json(entry));
-                    }
-                }
-                catch (const json::exception &)
-                {
-                    // The literal is authored in-repo; a throw here is a build-time authoring error. Leaving the
-                    // list empty makes factory_preset() fall back to struct defaults rather than crashing.
-                }
-                return out;
+                // The literal is authored in-repo; a parse failure is a build-time authoring error. Leaving the
+                // list empty makes factory_preset() fall back to struct defaults rather than crashing.
+                std::string error;
+                std::optional<PresetDocument> doc = document_from_json(k_default_presets_json, error);
+                return doc ? std::move(doc->presets) : std::vector<CameraPreset>{};
             }();
             return presets;
         }
 
+        /// Serializes a whole document to the hand-editable JSON layout (the export format).
+        json document_to_json(const PresetDocument &doc)
+        {
+            json root;
+            root["version"] = k_schema_version;
+            root["ui_scale"] = doc.ui_scale;
+            root["value_compact"] = doc.value_compact;
+            root["shared_fields"] = doc.shared_fields;
+            root["editing"] = doc.editing;
+            json arr = json::array();
+            for (const CameraPreset &p : doc.presets)
+                arr.push_back(preset_to_json(p));
+            root["presets"] = std::move(arr);
+            return root;
+        }
+
+        /// Whether the JSON file should be imported over the binary copy: the binary is missing, or the JSON was
+        /// written after it (the player edited the export while the game was closed).
+        [[nodiscard]] bool json_newer_than_binary(const std::string &binary_path, const std::string &json_path)
+        {
+            std::error_code ec;
+            const auto binary_time = std::filesystem::last_write_time(binary_path, ec);
+            if (ec)
+                return true;
+            const auto json_time = std::filesystem::last_write_time(json_path, ec);
+            return !ec && json_time > binary_time;
+        }
+
     } // namespace
 
     CameraPreset factory_preset(const std::string &name)
@@ -265,74 +459,84 @@ namespace TPVCamera::Presets
         return added;
     }
 
-    void PresetStore::load(const std::string &file_path)
+    void PresetStore::load(const std::string &binary_path, const std::string &json_path)
     {
         DMK::Logger &logger = DMK::Logger::get_instance();
-        m_file_path = file_path;
+        m_binary_path = binary_path;
+        m_json_path = json_path;
         m_presets.clear();
         m_dirty = false;
         m_prefs_dirty = false;
+        m_export_pending = false;
         m_ui_scale = 1.0f;
         m_value_compact = true;
         m_shared_fields.clear();
         m_saved_presets.clear();
         m_saved_shared_fields.clear();
-
-        std::string editing_name = k_builtin_default;
-
-        // Presets are user-owned customization, not a shipped asset (see default_presets.hpp). The file is
-        // OPTIONAL: a missing one is created from the embedded factory defaults on first run, and a corrupt
-        // one falls back to those defaults for the session without being overwritten. The mod never fails
-        // to start over presets.
+        m_modified_fields.clear();
+        m_modified_count = 0;
+        m_shared_modified = false;
+        m_layout_modified = false;
+
+        // Presets are user-owned customization, not a shipped asset (see default_presets.hpp). Both files are
+        // OPTIONAL: the binary copy is the working store and is read through a file mapping; the JSON is the
+        // hand-editable import/export and wins only when it is newer than the binary. Missing files are created
+        // from the embedded factory defaults on first run, and a corrupt one falls back to those defaults for the
+        // session without being overwritten. The mod never fails to start over presets.
         bool file_present = false;
         bool file_usable = false;
+        bool imported = false;
+        std::optional<PresetDocument> doc;
 
-        std::ifstream in(file_path);
-        if (in)
+        if (!json_newer_than_binary(binary_path, json_path))
         {
             file_present = true;
-            try
+            doc = read_presets_mapped(binary_path);
+            if (!doc)
+                logger.warning("Preset store '{}' is unreadable; importing {} instead", binary_path, json_path);
+        }
+
+        if (!doc)
+        {
+            std::ifstream in(json_path, std::ios::binary);
+            if (in)
             {
-                const json root = json::parse(in);
-                if (root.contains("editing") && root["editing"].is_string())
-                    editing_name = root["editing"].get<std::string>();
-                if (root.contains("ui_scale") && root["ui_scale"].is_number())
-                    m_ui_scale = std::clamp(root["ui_scale"].get<float>(), 0.5f, 3.0f);
-                if (root.contains("value_compact") && root["value_compact"].is_boolean())
-                    m_value_compact = root["value_compact"].get<bool>();
-                if (root.contains("shared_fields") && root["shared_fields"].is_array())
-                {
-                    for (const json &shared_key : root["shared_fields"])
-                    {
-                        if (!shared_key.is_string())
-                            continue;
-                        // Keep only keys that are real editable fields and not already listed (defensive against a
-                        // hand-edited file).
-                        const std::string key = shared_key.get<std::string>();
-                        if (find_field(key) != nullptr && !is_field_shared(key))
-                            m_shared_fields.push_back(key);
-                    }
-                }
-                if (root.contains("presets") && root["presets"].is_array())
+                file_present = true;
+                // One read of the whole file, then a SAX pass straight into the document (no DOM).
+                const std::string text{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+                std::string error;
+                doc = document_from_json(text, error);
+                if (doc)
+                    imported = true;
+                else
                 {
-                    for (const json &entry : root["presets"])
-                    {
-                        CameraPreset preset = preset_from_json(entry);
-                        if (!preset.name.empty())
-                            m_presets.push_back(std::move(preset));
-                    }
+                    // A corrupt user file is recoverable: use the embedded defaults this session and leave the
+                    // broken file on disk so the player can inspect or fix it (deleting it regenerates a clean one).
+                    logger.warning("Preset file '{}' is corrupt ({}); using built-in defaults this session. "
+                                   "Delete the file to regenerate a clean copy.",
+                                   json_path, error);
                 }
-                file_usable = true;
             }
-            catch (const json::exception &e)
+        }
+
+        std::string editing_name = k_builtin_default;
+        if (doc)
+        {
+            file_usable = true;
+            editing_name = doc->editing;
+            m_ui_scale = std::clamp(doc->ui_scale, 0.5f, 3.0f);
+            m_value_compact = doc->value_compact;
+            for (const std::string &key : doc->shared_fields)
             {
-                // A corrupt user file is recoverable: use the embedded defaults this session and leave the
-                // broken file on disk so the player can inspect or fix it (deleting it regenerates a clean one).
-                logger.warning("Preset file '{}' is corrupt ({}); using built-in defaults this session. "
-                               "Delete the file to regenerate a clean copy.",
-                               file_path, e.what());
-                m_presets.clear();
-                m_shared_fields.clear();
+                // Keep only keys that are real editable fields and not already listed (defensive against a
+                // hand-edited file).
+                if (find_field(key) != nullptr && !is_field_shared(key))
+                    m_shared_fields.push_back(key);
+            }
+            for (CameraPreset &preset : doc->presets)
+            {
+                if (!preset.name.empty())
+                    m_presets.push_back(std::move(preset));
             }
         }
 
@@ -352,11 +556,16 @@ namespace TPVCamera::Presets
         m_editing_index = (editing_idx >= 0) ? editing_idx : 0;
         m_editing_pinned = false;
 
-        // Create-if-missing, and persist a repaired set (a newly-added built-in, or a valid file recovered
-        // from having lost its presets) so the next launch is clean. A corrupt file (file_usable == false)
-        // is deliberately left untouched on disk.
-        if (!file_present || (file_usable && (builtins_added || seeded)))
+        // Create-if-missing, persist a repaired set (a newly-added built-in, or a valid file recovered from having
+        // lost its presets), and re-store an imported JSON as the binary copy, so the next launch is clean and
+        // mapped. A first run also writes the JSON export so there is a hand-editable file from the start. A
+        // corrupt file (file_usable == false) is deliberately left untouched on disk.
+        if (!file_present || (file_usable && (builtins_added || seeded || imported)))
+        {
             save(); // clears m_dirty and snapshots the saved baseline
+            if (!file_present)
+                export_json();
+        }
         else
             m_dirty = false;
 
@@ -364,85 +573,74 @@ namespace TPVCamera::Presets
         // already captured it; this covers the no-save path so a later edit-then-revert can clear the flag.
         capture_saved_baseline();
 
-        logger.info("Presets ready ({} entries) at {}", m_presets.size(), file_path);
+        logger.info("Presets ready ({} entries, {}) at {}", m_presets.size(), imported ? "imported JSON" : "binary",
+                    imported ? json_path : binary_path);
 
         publish();
     }
 
+    PresetDocument PresetStore::document() const
+    {
+        PresetDocument doc;
+        doc.presets = m_presets;
+        doc.shared_fields = m_shared_fields;
+        doc.editing = (m_editing_index >= 0 && m_editing_index < static_cast<int>(m_presets.size()))
+                          ? m_presets[static_cast<std::size_t>(m_editing_index)].name
+                          : std::string{k_builtin_default};
+        doc.ui_scale = m_ui_scale;
+        doc.value_compact = m_value_compact;
+        return doc;
+    }
+
     void PresetStore::save()
     {
-        DMK::Logger &logger = DMK::Logger::get_instance();
-        if (m_file_path.empty())
+        if (m_binary_path.empty())
         {
-            logger.warning("Preset save skipped: no file path set");
+            DMK::Logger::get_instance().warning("Preset save skipped: no file path set");
             return;
         }
 
-        json root;
-        root["version"] = k_schema_version;
-        root["ui_scale"] = m_ui_scale;
-        root["value_compact"] = m_value_compact;
-        root["shared_fields"] = m_shared_fields;
-        root["editing"] = (m_editing_index >= 0 && m_editing_index < static_cast<int>(m_presets.size()))
-                              ? m_presets[static_cast<std::size_t>(m_editing_index)].name
-                              : std::string{k_builtin_default};
-        json arr = json::array();
-        for (const CameraPreset &p : m_presets)
-            arr.push_back(preset_to_json(p));
-        root["presets"] = std::move(arr);
-
-        // Atomic write: serialize to a sibling temp file, flush and close it, then rename it over the
-        // target. A crash mid-write can only ever leave the temp truncated, never the live file, so the
-        // user's preset set survives (load() falls back to factory defaults only on a genuinely corrupt
-        // file, and an in-place truncation would have looked exactly like one). std::filesystem::rename
-        // replaces the destination on Windows (MoveFileEx semantics), so the swap is atomic on one volume.
-        const std::string temp_path = m_file_path + ".tmp";
+        // Encoding is a flat byte append, so the UI thread's share of a Save is microseconds: the file write
+        // (temp + rename, see queue_preset_write) happens on the preset writer thread, and a burst of saves
+        // collapses into the latest one. The store treats the queued state as saved; a failed write is logged
+        // by the writer and the next save retries it.
+        queue_preset_write(m_binary_path, encode_presets(document()));
+
+        m_dirty = false;
+        m_prefs_dirty = false;
+        m_export_pending = true; // the JSON export now trails the binary copy; refreshed on flush()
+        capture_saved_baseline(); // the queued file matches the live data: this is the new revert baseline
+    }
+
+    void PresetStore::export_json()
+    {
+        if (m_binary_path.empty() || m_json_path.empty())
+            return;
+        std::string json_text;
+        const PresetDocument doc = document();
         try
         {
-            std::ofstream out(temp_path, std::ios::trunc);
-            if (!out)
-            {
-                logger.warning("Preset save failed: cannot open {}", temp_path);
-                return;
-            }
-            // dump(2) can throw (e.g. nlohmann type_error.316 on invalid UTF-8 in a preset string); the catch
-            // below treats it like a write failure so the live preset file is never disturbed.
-            out << root.dump(2);
-            out.flush();
-            if (!out)
-            {
-                logger.warning("Preset save failed: write error on {}", temp_path);
-                return;
-            }
-        } // close the stream so the rename sees a fully flushed file
-        catch (const std::exception &e)
-        {
-            logger.warning("Preset save failed: serialization error ({})", e.what());
-            std::error_code remove_ec;
-            std::filesystem::remove(temp_path, remove_ec); // do not leave a partial temp behind
-            return;
+            // dump(2) can throw (e.g. nlohmann type_error.316 on invalid UTF-8 in a preset string); the export
+            // is then skipped so the JSON file is never disturbed, while the binary copy is still written.
+            json_text = document_to_json(doc).dump(2);
         }
-
-        std::error_code rename_ec;
-        std::filesystem::rename(temp_path, m_file_path, rename_ec);
-        if (rename_ec)
+        catch (const std::exception &e)
         {
-            logger.warning("Preset save failed: cannot replace {} ({})", m_file_path, rename_ec.message());
-            std::error_code remove_ec;
-            std::filesystem::remove(temp_path, remove_ec); // best-effort: do not leave the temp behind
-            return;
+            DMK::Logger::get_instance().warning("Preset export failed: serialization error ({})", e.what());
         }
-
-        m_dirty = false;
-        m_prefs_dirty = false;
-        capture_saved_baseline(); // the file now matches the live data: this is the new revert baseline
-        logger.info("Presets saved to {}", m_file_path);
+        // Re-queue the binary with the export so it lands after the JSON (see queue_preset_write).
+        queue_preset_write(m_binary_path, encode_presets(doc), m_json_path, std::move(json_text));
+        m_export_pending = false;
     }
 
     void PresetStore::flush()
     {
+        commit_frame(); // settle an edit made in the overlay's last frame
         if (m_dirty || m_prefs_dirty)
             save();
+        if (m_export_pending)
+            export_json();
+        drain_preset_writer();
     }
 
     void PresetStore::set_editing_index(int index)
@@ -502,6 +700,7 @@ namespace TPVCamera::Presets
         if (shared)
         {
             m_shared_fields.emplace_back(key);
+            note_shared_write();
             // Sync the value across every preset right away so enabling the link matches them immediately.
             broadcast_field(key); // marks the store dirty and republishes
         }
@@ -510,7 +709,7 @@ namespace TPVCamera::Presets
             const std::string key_str(key);
             m_shared_fields.erase(std::remove(m_shared_fields.begin(), m_shared_fields.end(), key_str),
                                   m_shared_fields.end());
-            mark_dirty(); // persist the dropped link
+            note_shared_write(); // persist the dropped link
         }
     }
 
@@ -520,24 +719,39 @@ namespace TPVCamera::Presets
             return;
 
         // Copy ONLY this field's value from the editing preset into every preset, leaving the rest of each
-        // preset untouched, so a shared value stays identical everywhere.
+        // preset untouched, so a shared value stays identical everywhere. Only the presets whose value actually
+        // changes have their modified bit re-diffed.
+        const std::size_t field_index = static_cast<std::size_t>(&field - fields().data());
         const CameraPreset &source = m_presets[static_cast<std::size_t>(m_editing_index)];
-        for (CameraPreset &preset : m_presets)
+        for (std::size_t i = 0; i < m_presets.size(); ++i)
         {
+            CameraPreset &preset = m_presets[i];
             if (field.type == FieldType::Float)
+            {
+                if (preset.*(field.f) == source.*(field.f))
+                    continue;
                 preset.*(field.f) = source.*(field.f);
+            }
             else
+            {
+                if (preset.*(field.b) == source.*(field.b))
+                    continue;
                 preset.*(field.b) = source.*(field.b);
+            }
+            note_field_write(i, field_index);
         }
     }
 
     void PresetStore::broadcast_field(std::string_view key)
     {
         const PresetField *field = find_field(key);
-        if (field == nullptr)
+        if (field == nullptr || m_editing_index < 0 || m_editing_index >= static_cast<int>(m_presets.size()))
             return;
+        // The editor mutated the editing preset's field directly, and copy_field_from_editing skips the source (its
+        // value already matches), so re-diff that write here too or its modified bit and the Save indicator lag.
+        note_field_write(static_cast<std::size_t>(m_editing_index), static_cast<std::size_t>(field - fields().data()));
         copy_field_from_editing(*field);
-        mark_dirty();
+        queue_preview();
     }
 
     int PresetStore::add_new()
@@ -644,14 +858,109 @@ namespace TPVCamera::Presets
 
     void PresetStore::mark_dirty()
     {
-        // Content-aware: an edit that lands back on the saved value (a manual revert, or a per-field reset to a
-        // value that was already saved) leaves nothing to write, so diff against the baseline instead of latching
-        // the flag true.
-        recompute_dirty();
-        publish();
+        // A dragged slider calls this every overlay frame. While the editing preset is pinned the render thread
+        // only reads the pin, so its values go through the preview channel and the table (with its preset
+        // copies and snapshot swap) is left alone; a shared-field broadcast into other presets reaches the table
+        // on the next publish, which unpinning or changing the selection always does.
+        m_dirty_pending = true;
+        queue_preview();
+    }
+
+    void PresetStore::mark_field_dirty(const PresetField &field)
+    {
+        const std::span<const PresetField> all = fields();
+        if (&field < all.data() || &field >= all.data() + all.size() || m_editing_index < 0 ||
+            m_editing_index >= static_cast<int>(m_presets.size()))
+        {
+            mark_dirty(); // not a fields() entry: fall back to the full diff
+            return;
+        }
+        note_field_write(static_cast<std::size_t>(m_editing_index), static_cast<std::size_t>(&field - all.data()));
+        queue_preview();
+    }
+
+    void PresetStore::queue_preview()
+    {
+        if (m_editing_pinned && m_editing_index >= 0 && m_editing_index < static_cast<int>(m_presets.size()))
+        {
+            preview_pin(m_pin_serial, pack_values(m_presets[static_cast<std::size_t>(m_editing_index)]));
+        }
+        else
+        {
+            m_publish_pending = true;
+        }
+    }
+
+    void PresetStore::commit_frame()
+    {
+        if (m_dirty_pending)
+        {
+            // A mark_dirty() without field information this frame: one full diff covers all of them.
+            recompute_dirty();
+            m_dirty_pending = false;
+        }
+        if (m_publish_pending)
+        {
+            publish(); // clears m_publish_pending
+        }
     }
 
     void PresetStore::recompute_dirty() noexcept
+    {
+        // The full diff, for a change that did not go through a single field write. Every structural edit saves
+        // (which resets the baseline), so the lists normally line up index for index; a length mismatch just
+        // counts as a layout change.
+        const std::span<const PresetField> all = fields();
+        m_modified_fields.assign(m_presets.size(), 0);
+        m_modified_count = 0;
+        m_layout_modified = m_presets.size() != m_saved_presets.size();
+        const std::size_t common = std::min(m_presets.size(), m_saved_presets.size());
+        for (std::size_t p = 0; p < common; ++p)
+        {
+            const CameraPreset &live = m_presets[p];
+            const CameraPreset &saved = m_saved_presets[p];
+            if (live.name != saved.name || live.builtin != saved.builtin || live.bind_state != saved.bind_state)
+                m_layout_modified = true;
+            std::uint32_t bits = 0;
+            for (std::size_t i = 0; i < all.size(); ++i)
+            {
+                const PresetField &field = all[i];
+                const bool differs = (field.type == FieldType::Float) ? live.*(field.f) != saved.*(field.f)
+                                                                      : live.*(field.b) != saved.*(field.b);
+                if (differs)
+                    bits |= 1u << i;
+            }
+            m_modified_fields[p] = bits;
+            m_modified_count += static_cast<std::size_t>(std::popcount(bits));
+        }
+        note_shared_write(); // also refreshes m_dirty
+    }
+
+    void PresetStore::note_field_write(std::size_t preset_index, std::size_t field_index) noexcept
+    {
+        // Content-aware: a write that lands back on the saved value (a manual revert, or a per-field reset to a
+        // value that was already saved) clears its bit again.
+        if (preset_index >= m_modified_fields.size() || preset_index >= m_saved_presets.size())
+        {
+            m_dirty_pending = true; // no baseline row for it (a list that outgrew the baseline): full diff
+            return;
+        }
+        const PresetField &field = fields()[field_index];
+        const CameraPreset &live = m_presets[preset_index];
+        const CameraPreset &saved = m_saved_presets[preset_index];
+        const bool differs = (field.type == FieldType::Float) ? live.*(field.f) != saved.*(field.f)
+                                                              : live.*(field.b) != saved.*(field.b);
+        std::uint32_t &bits = m_modified_fields[preset_index];
+        const std::uint32_t bit = 1u << field_index;
+        if (differs != ((bits & bit) != 0))
+        {
+            bits ^= bit;
+            m_modified_count = differs ? m_modified_count + 1 : m_modified_count - 1;
+        }
+        update_dirty();
+    }
+
+    void PresetStore::note_shared_write() noexcept
     {
         // The shared-field collection is an unordered SET: vector order is not meaningful (disabling then
         // re-enabling a key relocates it to the end), so compare it set-wise rather than with the order-sensitive
@@ -667,19 +976,29 @@ namespace TPVCamera::Presets
             shared_changed = std::find(m_saved_shared_fields.begin(), m_saved_shared_fields.end(), key) ==
                              m_saved_shared_fields.end();
         }
-        m_dirty = (m_presets != m_saved_presets) || shared_changed;
+        m_shared_modified = shared_changed;
+        update_dirty();
+    }
+
+    void PresetStore::update_dirty() noexcept
+    {
+        m_dirty = m_modified_count != 0 || m_shared_modified || m_layout_modified;
     }
 
     void PresetStore::capture_saved_baseline()
     {
         m_saved_presets = m_presets;
         m_saved_shared_fields = m_shared_fields;
+        m_modified_fields.assign(m_presets.size(), 0);
+        m_modified_count = 0;
+        m_shared_modified = false;
+        m_layout_modified = false;
     }
 
     void PresetStore::publish()
     {
-        auto table = std::make_shared<StateBindingTable>();
-        table->presets.reserve(m_presets.size());
+        auto table = std::make_unique<StateBindingTable>();
+        table->values.reserve(m_presets.size());
         table->masks.reserve(m_presets.size());
 
         // Publish every state-bound preset (built-ins plus any user presets the player bound to a state),
@@ -690,17 +1009,20 @@ namespace TPVCamera::Presets
             const std::optional<std::uint32_t> mask = parse_bind_mask(preset.bind_state);
             if (!mask)
                 continue;
-            table->presets.push_back(preset);
+            table->values.push_back(pack_values(preset));
             table->masks.push_back(*mask);
         }
 
         if (m_editing_pinned && m_editing_index >= 0 && m_editing_index < static_cast<int>(m_presets.size()))
         {
             table->has_pin = true;
-            table->pinned = m_presets[static_cast<std::size_t>(m_editing_index)];
+            table->pinned = pack_values(m_presets[static_cast<std::size_t>(m_editing_index)]);
         }
+        table->pin_serial = ++m_pin_serial;
+        m_publish_pending = false; // this table carries every edit so far
 
         publish_table(std::move(table));
+        Overlay::notify_changed(); // the panel's preset list and active highlight read this store
     }
 
 } // namespace TPVCamera::Presets
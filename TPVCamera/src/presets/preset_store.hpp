@@ -1,12 +1,12 @@
 /**
  * @file preset_store.hpp
- * @brief Owns the preset list and its JSON persistence; the only writer of presets.
+ * @brief Owns the preset list and its persistence; the only writer of presets.
  *
  * @details Single-threaded: every method is intended to run on ONE thread (the overlay
  *          UI thread at runtime, or the Bootstrap thread during init). The store never
  *          touches the live camera directly; instead it publishes an immutable
  *          StateBindingTable snapshot (see preset_runtime.hpp) that the render thread
- *          consumes via a single atomic shared_ptr load (no allocation). CRUD operations that change
+ *          consumes via a wait-free Snapshot read (no lock, no allocation). CRUD operations that change
  *          applied values call publish().
  *
  *          The built-ins (DEFAULT/COMBAT/AIMING/MOUNT/STEALTH/LYING/SITTING/KNEEL/CART) are defined by
@@ -15,12 +15,18 @@
  *          that introduces a built-in adds it without overwriting the player's customizations).
  *          They are kept at the front in that order and cannot be removed or renamed, but CAN be
  *          edited and reset to factory defaults. User presets follow.
+ *
+ *          Persistence is the binary store (preset_binary.hpp): memory-mapped on load, written through a temp
+ *          file and a rename on a background thread, so Save never blocks the overlay. The JSON file is the
+ *          import/export format: it is imported when newer than the binary copy and re-exported on flush().
  */
 #ifndef TPVCAMERA_PRESETS_PRESET_STORE_HPP
 #define TPVCAMERA_PRESETS_PRESET_STORE_HPP
 
 #include "camera_preset.hpp"
+#include "preset_binary.hpp"
 
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -38,7 +44,7 @@ namespace TPVCamera::Presets
 
     /**
      * @class PresetStore
-     * @brief Process-wide preset collection with JSON load/save and built-in protection.
+     * @brief Process-wide preset collection with binary persistence, JSON import/export and built-in protection.
      */
     class PresetStore
     {
@@ -47,19 +53,28 @@ namespace TPVCamera::Presets
         [[nodiscard]] static PresetStore &instance();
 
         /**
-         * @brief Loads presets from @p file_path (creating it from factory defaults if absent), then publishes.
-         * @details Presets are optional and user-owned. A missing file is created from the embedded factory
-         *          defaults; a corrupt file falls back to those defaults for the session and is left on disk
-         *          untouched. The built-ins (DEFAULT/COMBAT/AIMING/MOUNT/STEALTH/LYING/SITTING/KNEEL/CART) are
-         *          always present and ordered at the front afterward, and the path is cached for save()/flush().
-         * @param file_path Absolute path to the presets JSON file (created next to the INI if it does not exist).
+         * @brief Loads presets (creating the files from factory defaults if absent), then publishes.
+         * @details Presets are optional and user-owned. The binary copy is mapped and decoded unless the JSON is
+         *          newer (a hand edit) or the binary is missing, in which case the JSON is imported and re-stored
+         *          as binary. Missing files are created from the embedded factory defaults; a corrupt file falls
+         *          back to those defaults for the session and is left on disk untouched. The built-ins
+         *          (DEFAULT/COMBAT/AIMING/MOUNT/STEALTH/LYING/SITTING/KNEEL/CART) are always present and ordered at
+         *          the front afterward, and the paths are cached for save()/flush().
+         * @param binary_path Absolute path to the binary preset store (created next to the INI if absent).
+         * @param json_path Absolute path to the presets JSON import/export file.
          */
-        void load(const std::string &file_path);
+        void load(const std::string &binary_path, const std::string &json_path);
 
-        /** @brief Writes the presets to the cached path immediately and clears the dirty flag. */
+        /**
+         * @brief Queues the presets for the background binary write and clears the dirty flag.
+         * @details Returns as soon as the set is encoded; the disk write happens on the preset writer thread.
+         */
         void save();
 
-        /** @brief Writes only if there are unsaved changes (call on shutdown). */
+        /**
+         * @brief Saves if there are unsaved changes, refreshes the JSON export if it trails the binary copy, and
+         *        waits for the writer to finish (call on shutdown).
+         */
         void flush();
 
         /** @brief The preset list (built-ins first). UI thread only. */
@@ -75,24 +90,24 @@ namespace TPVCamera::Presets
         /** @brief Pins/unpins the editing preset for live preview; republishes. */
         void set_editing_pinned(bool pinned);
 
-        /** @brief Overlay UI scale (ImGui font global scale); persisted in the presets JSON root. */
+        /** @brief Overlay UI scale (ImGui font global scale); persisted with the presets. */
         [[nodiscard]] float ui_scale() const noexcept { return m_ui_scale; }
         /** @brief Sets the overlay UI scale (clamped to [0.5, 3.0]) and marks the store dirty. */
         void set_ui_scale(float scale);
 
-        /** @brief Edit/show preset float values at 2 decimals (true) or 3 (false). Persisted in JSON root. */
+        /** @brief Edit/show preset float values at 2 decimals (true) or 3 (false). Persisted with the presets. */
         [[nodiscard]] bool value_compact() const noexcept { return m_value_compact; }
         /** @brief Sets the 2-vs-3 decimal editing precision and marks the store dirty. */
         void set_value_compact(bool compact);
 
-        /** @brief Whether preset field @p key is shared (kept identical) across every preset. Persisted in JSON root.
-         */
+        /** @brief Whether preset field @p key is shared (kept identical) across every preset. Persisted with the
+         *         presets. */
         [[nodiscard]] bool is_field_shared(std::string_view key) const noexcept;
         /**
          * @brief Links/unlinks preset field @p key so its value is shared across every preset.
          * @details Enabling immediately copies the editing preset's value of @p key into every preset (broadcast)
          *          so they all match, then republishes; disabling just drops the link (values stay where they are).
-         *          Unknown keys are ignored. The shared-key set is persisted in the presets JSON root.
+         *          Unknown keys are ignored. The shared-key set is persisted with the presets.
          */
         void set_field_shared(std::string_view key, bool shared);
         /**
@@ -142,18 +157,37 @@ namespace TPVCamera::Presets
         void reset_to_factory(int index);
 
         /**
-         * @brief Marks the store dirty and republishes the binding table (live preview).
-         * @details Call after the editor mutates a field value via a slider/checkbox. Does NOT
-         *          write to disk; the explicit Save action / shutdown flush persists.
+         * @brief Marks the store dirty and queues the live preview of the edit.
+         * @details Call after the editor mutates a field value via a slider/checkbox. While the editing preset is
+         *          pinned the pin's values go straight to the render thread through preview_pin() (no table
+         *          rebuild); otherwise the republish is coalesced into commit_frame(). Does NOT write to disk; the
+         *          explicit Save action / shutdown flush persists.
          */
         void mark_dirty();
 
+        /**
+         * @brief mark_dirty() for a write of one field of the editing preset: updates only that field's modified
+         *        bit instead of re-diffing the store. @p field must be an entry of fields().
+         */
+        void mark_field_dirty(const PresetField &field);
+
+        /**
+         * @brief Applies the edits queued by mark_dirty() this frame: recomputes the Save indicator once and
+         *        republishes the binding table if an unpinned edit needs it. The overlay calls it once per frame.
+         */
+        void commit_frame();
+
         /** @brief Rebuilds and publishes the StateBindingTable snapshot for the render thread. */
         void publish();
 
     private:
         PresetStore() = default;
 
+        /** @brief The persisted view of the store (presets, shared set, editing name, UI prefs). */
+        [[nodiscard]] PresetDocument document() const;
+        /** @brief Queues the JSON export of the current set alongside its binary copy. */
+        void export_json();
+
         /** @brief Re-adds any missing built-in from factory and orders all built-ins first; true if any was added. */
         [[nodiscard]] bool arrange_builtins();
         [[nodiscard]] int find_by_name(const std::string &name) const;
@@ -163,8 +197,16 @@ namespace TPVCamera::Presets
         void copy_field_from_editing(const PresetField &field) noexcept;
         /** @brief Recomputes m_dirty as the difference between the live presets/shared set and the saved baseline. */
         void recompute_dirty() noexcept;
+        /** @brief Re-diffs field @p field_index of preset @p preset_index against the baseline and updates m_dirty. */
+        void note_field_write(std::size_t preset_index, std::size_t field_index) noexcept;
+        /** @brief Re-diffs the shared-field set against the baseline and updates m_dirty. */
+        void note_shared_write() noexcept;
+        /** @brief m_dirty from the modified-bit count and the shared / layout flags. */
+        void update_dirty() noexcept;
         /** @brief Snapshots the live presets/shared set as the saved baseline (after a successful load/save). */
         void capture_saved_baseline();
+        /** @brief Routes an edit to the pin preview or the coalesced republish (see mark_dirty). */
+        void queue_preview();
 
         std::vector<CameraPreset> m_presets;
         int m_editing_index = 0;
@@ -180,7 +222,20 @@ namespace TPVCamera::Presets
         // to the saved value clears it.
         std::vector<CameraPreset> m_saved_presets;
         std::vector<std::string> m_saved_shared_fields;
-        std::string m_file_path;
+        // m_dirty, kept incrementally: bit i of m_modified_fields[p] is set while fields()[i] of preset p differs
+        // from the baseline, and m_modified_count is the total of set bits. Field writes flip single bits;
+        // recompute_dirty() rebuilds everything after a change that is not a field write.
+        std::vector<std::uint32_t> m_modified_fields;
+        std::size_t m_modified_count = 0;
+        bool m_shared_modified = false; // the shared-field set differs from the baseline
+        bool m_layout_modified = false; // a preset's identity (name/builtin/bind) or the list length differs
+        bool m_export_pending = false; // the JSON export is older than the last binary save
+        // mark_dirty() bookkeeping, applied once per overlay frame by commit_frame().
+        bool m_dirty_pending = false;   // m_dirty needs recomputing
+        bool m_publish_pending = false; // an edit the pin preview does not cover needs a republish
+        std::uint32_t m_pin_serial = 0; // serial of the last published table (see preview_pin)
+        std::string m_binary_path;
+        std::string m_json_path;
     };
 
 } // namespace TPVCamera::Presets
@@ -0,0 +1,233 @@
+/**
+ * @file raster_jobs.cpp
+ * @brief Work-stealing helper pool for chunked render-thread jobs (see raster_jobs.hpp).
+ */
+
+#include "raster_jobs.hpp"
+#include "alloc_stats.hpp"
+#include "thread_join.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <windows.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace TPVCamera::RasterJobs
+{
+
+    namespace
+    {
+        // One lane's share of the chunk range: [next, end), claimed by fetch_add so the owner and any thief agree.
+        struct alignas(64) Slice
+        {
+            std::atomic<int> next{0};
+            int end = 0;
+        };
+
+        struct Job
+        {
+            ChunkFn fn = nullptr;
+            void *ctx = nullptr;
+            int lanes = 1;
+            Slice slices[k_max_lanes];
+        };
+
+        Job s_job;
+        std::atomic<std::uint32_t> s_generation{0};
+        // Join handshake (seq_cst on both sides): a helper raises s_busy and then checks s_open; run() lowers
+        // s_open and then waits for s_busy to drain. Either the helper sees the job closed and leaves untouched,
+        // or run() sees it inside and waits for it: a short spin, then std::atomic::wait (WaitOnAddress) on s_busy,
+        // which the helper that drains it wakes.
+        constexpr int k_join_spins = 256;
+        std::atomic<bool> s_open{false};
+        std::atomic<int> s_busy{0};
+        std::atomic<int> s_next_lane{1};
+        std::atomic<bool> s_faulted{false};
+
+        HANDLE s_wake = nullptr; // semaphore: one count per helper wanted by a run()
+        HANDLE s_threads[k_max_workers] = {};
+        std::atomic<int> s_workers{0};
+        std::atomic<bool> s_shutdown{false};
+
+        bool run_chunk_guarded(ChunkFn fn, void *ctx, int chunk, int lane) noexcept
+        {
+            __try
+            {
+                fn(ctx, chunk, lane);
+                return true;
+            }
+            __except (EXCEPTION_EXECUTE_HANDLER)
+            {
+                return false;
+            }
+        }
+
+        // The next unrun chunk for @p lane: its own slice first, then the other lanes' in turn. -1 when none is left.
+        int claim(int lane) noexcept
+        {
+            const int lanes = s_job.lanes;
+            for (int k = 0; k < lanes; ++k)
+            {
+                Slice &s = s_job.slices[(lane + k) % lanes];
+                if (s.next.load(std::memory_order_relaxed) >= s.end)
+                {
+                    continue;
+                }
+                const int chunk = s.next.fetch_add(1, std::memory_order_relaxed);
+                if (chunk < s.end)
+                {
+                    return chunk;
+                }
+            }
+            return -1;
+        }
+
+        void work(int lane) noexcept
+        {
+            for (int chunk = claim(lane); chunk >= 0; chunk = claim(lane))
+            {
+                if (!run_chunk_guarded(s_job.fn, s_job.ctx, chunk, lane))
+                {
+                    s_faulted.store(true, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        DWORD WINAPI worker_thread(LPVOID)
+        {
+            AllocStats::set_thread_tag(AllocStats::AllocTag::Workers);
+            for (;;)
+            {
+                WaitForSingleObject(s_wake, INFINITE);
+                if (s_shutdown.load(std::memory_order_acquire))
+                {
+                    break;
+                }
+                const std::uint32_t generation = s_generation.load(std::memory_order_acquire);
+                s_busy.fetch_add(1, std::memory_order_seq_cst);
+                if (s_open.load(std::memory_order_seq_cst) &&
+                    s_generation.load(std::memory_order_seq_cst) == generation)
+                {
+                    const int lane = s_next_lane.fetch_add(1, std::memory_order_relaxed);
+                    if (lane < s_job.lanes)
+                    {
+                        work(lane);
+                    }
+                }
+                if (s_busy.fetch_sub(1, std::memory_order_release) == 1)
+                {
+                    s_busy.notify_one();
+                }
+            }
+            return 0;
+        }
+    } // namespace
+
+    int start(int workers)
+    {
+        workers = std::clamp(workers, 0, k_max_workers);
+        if (workers == 0 || s_workers.load(std::memory_order_relaxed) != 0)
+        {
+            return s_workers.load(std::memory_order_relaxed);
+        }
+        if (s_wake == nullptr)
+        {
+            s_wake = CreateSemaphoreW(nullptr, 0, 64 * k_max_workers, nullptr);
+        }
+        if (s_wake == nullptr)
+        {
+            return 0;
+        }
+        s_shutdown.store(false, std::memory_order_release);
+        int started = 0;
+        for (; started < workers; ++started)
+        {
+            s_threads[started] = CreateThread(nullptr, 0, worker_thread, nullptr, 0, nullptr);
+            if (s_threads[started] == nullptr)
+            {
+                break;
+            }
+        }
+        s_workers.store(started, std::memory_order_release);
+        if (started < workers)
+        {
+            DMK::Logger::get_instance().warning("RasterJobs: started {} of {} raster worker thread(s)", started,
+                                                workers);
+        }
+        return started;
+    }
+
+    void stop() noexcept
+    {
+        const int workers = s_workers.exchange(0, std::memory_order_acq_rel);
+        if (workers == 0)
+        {
+            return;
+        }
+        s_shutdown.store(true, std::memory_order_release);
+        ReleaseSemaphore(s_wake, workers, nullptr);
+        for (int i = 0; i < workers; ++i)
+        {
+            // A helper only ever sleeps or finishes a chunk, so the join is short. On a timeout the module stays
+            // pinned under the running helper, as for the collision worker.
+            (void)join_or_pin(s_threads[i], 2000, "Raster helper");
+            s_threads[i] = nullptr;
+        }
+        // s_wake stays open: a frustum detour still in flight may release it once more before the hooks go.
+    }
+
+    int worker_count() noexcept
+    {
+        return s_workers.load(std::memory_order_relaxed);
+    }
+
+    bool run(ChunkFn fn, void *ctx, int n_chunks, int lanes) noexcept
+    {
+        if (n_chunks <= 0)
+        {
+            return true;
+        }
+        lanes = std::clamp(lanes, 1, worker_count() + 1);
+        lanes = std::min(lanes, n_chunks);
+
+        // No helper can be inside the previous job (run() drained s_busy), so the plain fields are free to write;
+        // the generation bump and s_open publish them.
+        s_job.fn = fn;
+        s_job.ctx = ctx;
+        s_job.lanes = lanes;
+        for (int l = 0; l < lanes; ++l)
+        {
+            s_job.slices[l].end = n_chunks * (l + 1) / lanes;
+            s_job.slices[l].next.store(n_chunks * l / lanes, std::memory_order_relaxed);
+        }
+        s_faulted.store(false, std::memory_order_relaxed);
+        s_next_lane.store(1, std::memory_order_relaxed);
+        s_generation.fetch_add(1, std::memory_order_release);
+        s_open.store(true, std::memory_order_seq_cst);
+        if (lanes > 1)
+        {
+            ReleaseSemaphore(s_wake, lanes - 1, nullptr);
+        }
+
+        work(0);
+
+        s_open.store(false, std::memory_order_seq_cst);
+        // A helper still inside is finishing at most one chunk, usually within the spin; a longer one (preempted)
+        // parks the render thread until it leaves instead of burning its core.
+        for (int spin = 0; spin < k_join_spins && s_busy.load(std::memory_order_seq_cst) != 0; ++spin)
+        {
+            YieldProcessor();
+        }
+        int busy = s_busy.load(std::memory_order_seq_cst);
+        while (busy != 0)
+        {
+            s_busy.wait(busy, std::memory_order_acquire);
+            busy = s_busy.load(std::memory_order_seq_cst);
+        }
+        return !s_faulted.load(std::memory_order_relaxed);
+    }
+
+} // namespace TPVCamera::RasterJobs
@@ -0,0 +1,53 @@
+/**
+ * @file raster_jobs.hpp
+ * @brief Tiny fixed-size worker pool that splits one chunked job across the render thread and 2-4 helpers.
+ *
+ * @details Built for the coverage raster of large meshes (render_occlusion.cpp), where one compound building or
+ *          canopy near RENDER_OCCLUSION_INDEX_MAX dominates a bad frame. The pool is started once from init() with
+ *          [Advanced] RasterWorkers threads, which sleep on a semaphore between jobs. run() publishes one job of
+ *          n_chunks chunks and the render thread works on it as lane 0 alongside the woken workers:
+ *            - the chunk range is dealt out as one contiguous slice per lane, and a lane that finishes its slice
+ *              steals the remaining chunks of the others (an atomic cursor per slice, so a chunk runs exactly once);
+ *            - every chunk runs under its own SEH frame on every lane, so a fault in engine memory is contained and
+ *              reported through run()'s return value instead of being raised on a worker thread;
+ *            - run() returns once every lane that joined has left the job; a worker that wakes after the chunks are
+ *              gone leaves without touching the job context, so a late wake-up never stalls the render thread.
+ *          Only one job runs at a time (render thread only), and a job's context must stay valid until run() returns.
+ */
+#ifndef TPVCAMERA_RASTER_JOBS_HPP
+#define TPVCAMERA_RASTER_JOBS_HPP
+
+namespace TPVCamera::RasterJobs
+{
+
+    /// Most helper threads the pool starts ([Advanced] RasterWorkers is clamped to 0..k_max_workers).
+    inline constexpr int k_max_workers = 4;
+
+    /// Lanes of a job: the calling thread (lane 0) plus the helpers.
+    inline constexpr int k_max_lanes = k_max_workers + 1;
+
+    /// Runs chunk @p chunk of the job on lane @p lane (0..k_max_lanes-1); engine reads must be SEH-safe POD code.
+    using ChunkFn = void (*)(void *ctx, int chunk, int lane);
+
+    /**
+     * @brief Starts @p workers helper threads (clamped to 0..k_max_workers; 0 leaves the pool off).
+     * @return The number actually started.
+     */
+    int start(int workers);
+
+    /** @brief Wakes and joins the helpers. Safe if the pool never started. Called from shutdown(). */
+    void stop() noexcept;
+
+    /** @brief Helpers running (0 when the pool is off: run() then executes every chunk on the caller). */
+    [[nodiscard]] int worker_count() noexcept;
+
+    /**
+     * @brief Runs chunks [0, @p n_chunks) of @p fn across the caller and the helpers and waits for them.
+     * @param lanes Upper bound on the lanes to use (clamped to 1..worker_count()+1), for jobs with few chunks.
+     * @return False if any chunk faulted (the job's output is then incomplete). Render thread only.
+     */
+    [[nodiscard]] bool run(ChunkFn fn, void *ctx, int n_chunks, int lanes = k_max_lanes) noexcept;
+
+} // namespace TPVCamera::RasterJobs
+
+#endif // TPVCAMERA_RASTER_JOBS_HPP
@@ -6,14 +6,27 @@
 #include "render_occlusion.hpp"
 #include "aob_resolver.hpp"
 #include "constants.hpp"
+#include "frame_arena.hpp"
+#include "frame_clock.hpp"
 #include "global_state.hpp"
+#include "health.hpp"
+#include "hot_block.hpp"
+#include "occluder_db.hpp"
+#include "raster_jobs.hpp"
+#include "seh_region.hpp"
+#include "simd_math.hpp"
+#include "trace_ring.hpp"
+#include "vertex_kernels.hpp"
 
 #include <DetourModKit.hpp>
 
 #include <windows.h>
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cmath>
+#include <cstring>
 
 namespace TPVCamera
 {
@@ -31,19 +44,18 @@ namespace TPVCamera
     // IRenderMesh::GetIndexPtr(uint32 flags, int32 offset) -> vtx_idx* (uint16 triangle index list).
     using GetIndexPtrFn = std::uint16_t *(__fastcall *)(void *render_mesh, unsigned int flags, int offset);
 
-    static GetObjectsInBoxFn s_get_objects_in_box = nullptr;
-    // Game image bounds, for screening a render-mesh GetPosPtr function pointer before the indirect call.
-    static uintptr_t s_mod_lo = 0;
-    static uintptr_t s_mod_hi = 0;
-    // Address of the p3DEngine global (a g_env member). Read fresh per query: it is set once the 3DEngine
-    // is created and is screened before use; deriving it from the patch-resilient g_env base avoids a
-    // second hardcoded address.
-    static uintptr_t s_p3d_engine_slot_addr = 0;
-    // Mapped range of the scanned game module, captured once. A freshly read p3DEngine must carry a vtable
-    // inside this image or it is rejected before the indirect call (branch-only contains() test, no syscall).
-    static DMK::Memory::ModuleRange s_game_module{};
+    // GetObjectsInBox and the address of the p3DEngine global (a g_env member) live in the detour hot block
+    // (hot_block.hpp), next to the game image bounds. The global is read fresh per query: it is set once the
+    // 3DEngine is created and is screened before use; deriving it from the patch-resilient g_env base avoids a
+    // second hardcoded address. A freshly read p3DEngine must carry a vtable inside the image (in_game_module(), a
+    // branch-only test, no syscall) or it is rejected before the indirect call; the same bounds screen a
+    // render-mesh GetPosPtr function pointer.
+    [[nodiscard]] static GetObjectsInBoxFn get_objects_in_box() noexcept
+    {
+        return reinterpret_cast<GetObjectsInBoxFn>(detour_hot_block().get_objects_in_box);
+    }
 
-    bool initialize_render_occlusion(uintptr_t module_base, size_t module_size, uintptr_t g_env)
+    bool initialize_render_occlusion(uintptr_t g_env)
     {
         DMK::Logger &logger = DMK::Logger::get_instance();
 
@@ -55,17 +67,168 @@ namespace TPVCamera
             return false;
         }
 
-        s_get_objects_in_box = reinterpret_cast<GetObjectsInBoxFn>(fn);
-        s_p3d_engine_slot_addr = g_env + Constants::GENV_3DENGINE_OFFSET;
-        s_game_module = {module_base, module_base + module_size};
-        s_mod_lo = module_base;
-        s_mod_hi = module_base + module_size;
+        DetourHotBlock &hot = detour_hot_block();
+        hot.get_objects_in_box = reinterpret_cast<void *>(fn);
+        hot.p3d_engine_slot = g_env + Constants::GENV_3DENGINE_OFFSET;
 
         logger.info("RenderOcclusion: GetObjectsInBox at {}, p3DEngine slot at {}", DMK::Format::format_address(fn),
-                    DMK::Format::format_address(s_p3d_engine_slot_addr));
+                    DMK::Format::format_address(hot.p3d_engine_slot));
+        logger.info("RenderOcclusion: mesh vertex kernels use {}", VertexKernels::avx2_active() ? "AVX2" : "scalar");
         return true;
     }
 
+    // ---- Mesh clusters ------------------------------------------------------------------------------------------
+    // Cached local-space bounds of runs of a large render mesh, so the coverage raster and the cloth tube scan can
+    // reject whole runs before a single vertex of them is projected. A huge terrain-hugging canopy or a compound
+    // building carries tens of thousands of triangles, of which only the few near the camera-to-character
+    // sightline matter. The index list is cut into fixed runs of k_mesh_cluster_tris triangles and the vertex
+    // stream into runs of k_mesh_cluster_verts vertices; each run keeps the AABB of the vertices it touches, in
+    // mesh-local space so a moved brush needs no rebuild. A set is built on the first measurement of a mesh and is
+    // identified by the mesh and the streams it resolved to, as the occluder proxies are. The boxes come from one
+    // static pool: a rebuilt or evicted set's boxes are not reclaimed, and when the pool fills every set is dropped
+    // and rebuilt on demand. POD, render thread only.
+    static constexpr int k_mesh_cluster_tris = 256;
+    static constexpr int k_mesh_cluster_verts = 256;
+    static constexpr int k_mesh_cluster_min_tris = 2048;  // smaller meshes: the raster's early-outs already win
+    static constexpr int k_mesh_cluster_min_verts = 2048; // smaller clouds: the tube scan is one short kernel call
+    static constexpr int k_mesh_cluster_sets = 16;
+    static constexpr int k_mesh_cluster_pool = 16384;
+    static_assert((k_mesh_cluster_tris & (k_mesh_cluster_tris - 1)) == 0, "k_mesh_cluster_tris is a power of two");
+    static_assert(k_mesh_cluster_pool >= (Constants::RENDER_OCCLUSION_INDEX_MAX / 3) / k_mesh_cluster_tris +
+                                             Constants::RENDER_OCCLUSION_VERT_MAX / k_mesh_cluster_verts + 2,
+                  "the pool must hold the largest mesh's set");
+
+    struct ClusterBox
+    {
+        float lo[3];
+        float hi[3]; // lo > hi: the run touches no vertex (never rasterizes anything)
+    };
+
+    struct MeshClusters
+    {
+        const void *rmesh;
+        const std::uint8_t *pos;
+        const std::uint16_t *indices; // nullptr: built for the tube scan only (no triangle runs)
+        int n_verts;
+        int n_indices;
+        std::uint32_t stamp;
+        bool ready;
+        const ClusterBox *tri_boxes; // one per k_mesh_cluster_tris triangles
+        int n_tri_boxes;
+        const ClusterBox *vert_boxes; // one per k_mesh_cluster_verts vertices
+        int n_vert_boxes;
+    };
+
+    static MeshClusters s_mesh_clusters[k_mesh_cluster_sets];
+    static ClusterBox s_mesh_cluster_boxes[k_mesh_cluster_pool];
+    static int s_mesh_cluster_used = 0;
+    static std::uint32_t s_mesh_cluster_tick = 0;
+
+    static void cluster_box_add(ClusterBox &b, const std::uint8_t *pos, int stride, int v)
+    {
+        const float *p = reinterpret_cast<const float *>(pos + static_cast<std::ptrdiff_t>(v) * stride);
+        for (int a = 0; a < 3; ++a)
+        {
+            b.lo[a] = std::min(b.lo[a], p[a]);
+            b.hi[a] = std::max(b.hi[a], p[a]);
+        }
+    }
+
+    // World centre @p c and half-extent @p e of local box @p b under the row-major Matrix34 @p M.
+    static void cluster_box_world(const ClusterBox &b, const float *M, float *c, float *e)
+    {
+        const float lc[3] = {0.5f * (b.lo[0] + b.hi[0]), 0.5f * (b.lo[1] + b.hi[1]), 0.5f * (b.lo[2] + b.hi[2])};
+        const float le[3] = {0.5f * (b.hi[0] - b.lo[0]), 0.5f * (b.hi[1] - b.lo[1]), 0.5f * (b.hi[2] - b.lo[2])};
+        for (int r = 0; r < 3; ++r)
+        {
+            const float *row = M + r * 4;
+            c[r] = row[0] * lc[0] + row[1] * lc[1] + row[2] * lc[2] + row[3];
+            e[r] = std::fabs(row[0]) * le[0] + std::fabs(row[1]) * le[1] + std::fabs(row[2]) * le[2];
+        }
+    }
+
+    // The cluster set of @p rmesh's streams, building it on first use. @p indices may be nullptr (tube scan: vertex
+    // runs only); a set built that way is rebuilt in place once the raster asks for the triangle runs. nullptr on
+    // a fault mid-build (the slot stays non-ready) -- the caller then scans the whole mesh. POD body (runs in the
+    // caller's SEH frame: the streams are engine memory).
+    static const MeshClusters *mesh_clusters(const void *rmesh, const std::uint8_t *pos, int stride, int n_verts,
+                                             const std::uint16_t *indices, int n_indices)
+    {
+        ++s_mesh_cluster_tick;
+        int victim = 0;
+        for (int i = 0; i < k_mesh_cluster_sets; ++i)
+        {
+            MeshClusters &mc = s_mesh_clusters[i];
+            if (mc.rmesh == rmesh)
+            {
+                if (mc.ready && mc.pos == pos && mc.n_verts == n_verts &&
+                    (indices == nullptr || (mc.indices == indices && mc.n_indices == n_indices)))
+                {
+                    mc.stamp = s_mesh_cluster_tick;
+                    return &mc;
+                }
+                victim = i; // new streams, a fault mid-build, or the triangle runs now wanted: rebuild in place
+                break;
+            }
+            if (mc.rmesh == nullptr ||
+                (s_mesh_clusters[victim].rmesh != nullptr && mc.stamp < s_mesh_clusters[victim].stamp))
+            {
+                victim = i;
+            }
+        }
+
+        const int n_tri_boxes =
+            (indices != nullptr) ? (n_indices / 3 + k_mesh_cluster_tris - 1) / k_mesh_cluster_tris : 0;
+        const int n_vert_boxes = (n_verts + k_mesh_cluster_verts - 1) / k_mesh_cluster_verts;
+        if (s_mesh_cluster_used + n_tri_boxes + n_vert_boxes > k_mesh_cluster_pool)
+        {
+            for (MeshClusters &mc : s_mesh_clusters)
+            {
+                mc = MeshClusters{};
+            }
+            s_mesh_cluster_used = 0;
+        }
+        MeshClusters &mc = s_mesh_clusters[victim];
+        mc = MeshClusters{};
+        mc.rmesh = rmesh;
+        mc.pos = pos;
+        mc.indices = indices;
+        mc.n_verts = n_verts;
+        mc.n_indices = n_indices;
+        mc.stamp = s_mesh_cluster_tick;
+        ClusterBox *tri_boxes = s_mesh_cluster_boxes + s_mesh_cluster_used;
+        ClusterBox *vert_boxes = tri_boxes + n_tri_boxes;
+        s_mesh_cluster_used += n_tri_boxes + n_vert_boxes;
+
+        for (int k = 0; k < n_tri_boxes + n_vert_boxes; ++k)
+        {
+            tri_boxes[k] = ClusterBox{{1e30f, 1e30f, 1e30f}, {-1e30f, -1e30f, -1e30f}};
+        }
+        const int n_tris = n_indices / 3;
+        for (int t = 0; t < n_tri_boxes * k_mesh_cluster_tris && t < n_tris; ++t)
+        {
+            ClusterBox &b = tri_boxes[t / k_mesh_cluster_tris];
+            for (int k = 0; k < 3; ++k)
+            {
+                const int v = indices[t * 3 + k];
+                if (v < n_verts)
+                {
+                    cluster_box_add(b, pos, stride, v);
+                }
+            }
+        }
+        for (int v = 0; v < n_verts; ++v)
+        {
+            cluster_box_add(vert_boxes[v / k_mesh_cluster_verts], pos, stride, v);
+        }
+        mc.tri_boxes = tri_boxes;
+        mc.n_tri_boxes = n_tri_boxes;
+        mc.vert_boxes = vert_boxes;
+        mc.n_vert_boxes = n_vert_boxes;
+        mc.ready = true;
+        return &mc;
+    }
+
     // Sentinel returned by the cloth sampler when the brush's mesh is unavailable or has no vertices in the
     // camera column; the caller then falls back to the coarse world-AABB bottom.
     static constexpr float k_cloth_unavailable = 1e9f;
@@ -129,46 +292,49 @@ namespace TPVCamera
         // Brush world matrix (row-major Matrix34: row r = M[4r..4r+3], translation in column 3).
         const float *M = reinterpret_cast<const float *>(bytes + Constants::CBRUSH_MATRIX_OFFSET);
 
-        const float colr = Constants::RENDER_OCCLUSION_COLUMN_RADIUS;
-        const float colr2 = colr * colr;
+        // Bulk ray-march (AVX2 when available, see vertex_kernels.hpp). Each vertex is projected onto the arm:
+        // tpar = signed distance from the pivot along dir, the leftover the perpendicular (off-axis) distance; only
+        // vertices BETWEEN the character and the camera and within colr of the sightline count. A vertex's
+        // distance is where it first enters the colr tube of the growing sightline -- the camera must stop short
+        // of it (at that distance the vertex is exactly colr away = the standoff). A vertex within colr of the
+        // pivot itself (d <= 0) is dropped: the CHARACTER is in / touching the cloth (standing amid hanging
+        // laundry), not occluded by it from a distance, and no pull-in helps (otherwise the camera would collapse
+        // onto the character -- the blockDist=0 bug).
+        VertexKernels::SightlineTube tube{};
+        std::memcpy(tube.m, M, sizeof(tube.m));
+        tube.pivot_x = pivot.x;
+        tube.pivot_y = pivot.y;
+        tube.pivot_z = pivot.z;
+        tube.dir_x = dir.x;
+        tube.dir_y = dir.y;
+        tube.dir_z = dir.z;
+        tube.arm_len = arm_len;
+        tube.radius = Constants::RENDER_OCCLUSION_COLUMN_RADIUS;
         float best = k_cloth_unavailable;
-        int hits = 0;
-        for (int v = 0; v < n_verts; ++v)
+        const MeshClusters *mc =
+            (n_verts >= k_mesh_cluster_min_verts) ? mesh_clusters(rmesh, pos, stride, n_verts, nullptr, 0) : nullptr;
+        if (mc == nullptr)
         {
-            const auto *lp = reinterpret_cast<const float *>(pos + static_cast<size_t>(v) * stride);
-            const float lx = lp[0], ly = lp[1], lz = lp[2];
-            const float wx = M[0] * lx + M[1] * ly + M[2] * lz + M[3];
-            const float wy = M[4] * lx + M[5] * ly + M[6] * lz + M[7];
-            const float wz = M[8] * lx + M[9] * ly + M[10] * lz + M[11];
-            // Project the vertex onto the arm: tpar = signed distance from the pivot along dir; the leftover is
-            // the perpendicular (off-axis) distance. Only vertices BETWEEN the character and the camera matter.
-            const float rx = wx - pivot.x, ry = wy - pivot.y, rz = wz - pivot.z;
-            const float tpar = rx * dir.x + ry * dir.y + rz * dir.z;
-            if (tpar <= 0.0f || tpar > arm_len)
-            {
-                continue;
-            }
-            const float ex = rx - tpar * dir.x, ey = ry - tpar * dir.y, ez = rz - tpar * dir.z;
-            const float perp2 = ex * ex + ey * ey + ez * ez;
-            if (perp2 > colr2)
-            {
-                continue; // cloth is too far off the sightline to occlude it
-            }
-            // Distance along the arm at which this vertex first enters the colr tube of the growing sightline:
-            // the camera must stop short of it. (At this distance the vertex is exactly colr away = the standoff.)
-            const float d = tpar - std::sqrt(colr2 - perp2);
-            if (d <= 0.0f)
+            const int hits = VertexKernels::sightline_tube_scan(pos, stride, n_verts, tube, &best);
+            return (hits >= Constants::RENDER_OCCLUSION_MIN_COLUMN_VERTS) ? best : k_cloth_unavailable;
+        }
+        // Large cloud: scan only the vertex runs whose bounding sphere reaches the tube around the arm segment.
+        int hits = 0;
+        for (int k = 0; k < mc->n_vert_boxes; ++k)
+        {
+            float c[3], e[3];
+            cluster_box_world(mc->vert_boxes[k], M, c, e);
+            const float rx = c[0] - pivot.x, ry = c[1] - pivot.y, rz = c[2] - pivot.z;
+            const float tpar = std::clamp(rx * dir.x + ry * dir.y + rz * dir.z, 0.0f, arm_len);
+            const float ox = rx - tpar * dir.x, oy = ry - tpar * dir.y, oz = rz - tpar * dir.z;
+            const float reach = std::sqrt(e[0] * e[0] + e[1] * e[1] + e[2] * e[2]) + tube.radius;
+            if (ox * ox + oy * oy + oz * oz > reach * reach)
             {
-                // The cloth is within colr of the pivot itself: the CHARACTER is in / touching it (e.g. standing
-                // amid hanging laundry), not occluded by it from a distance. No camera pull-in helps, so it is
-                // NOT an occluder -- otherwise the camera would collapse onto the character (the blockDist=0 bug).
                 continue;
             }
-            ++hits;
-            if (d < best)
-            {
-                best = d;
-            }
+            const int first = k * k_mesh_cluster_verts;
+            hits += VertexKernels::sightline_tube_scan(pos + static_cast<std::ptrdiff_t>(first) * stride, stride,
+                                                       std::min(k_mesh_cluster_verts, n_verts - first), tube, &best);
         }
         return (hits >= Constants::RENDER_OCCLUSION_MIN_COLUMN_VERTS) ? best : k_cloth_unavailable;
     }
@@ -221,6 +387,42 @@ namespace TPVCamera
         }
     }
 
+    // Index-stream validations of the current frame. A canopy or building measured at several hits in one frame
+    // re-fetches the same index stream each time, and the probe above walks every 4 KB page of it. A (mesh, pointer,
+    // count) checked this frame is trusted for the rest of it, readable or not; the next frame probes again, since
+    // a stream can be freed under a live pointer between frames (the bird_feeder flicker). Replaced round-robin.
+    // Render thread only.
+    static constexpr int k_index_check_slots = 8;
+
+    struct IndexCheck
+    {
+        const void *rmesh;
+        const std::uint16_t *indices;
+        int n_indices;
+        bool readable;
+        std::uint64_t frame;
+    };
+
+    static IndexCheck s_index_checks[k_index_check_slots];
+    static int s_index_check_next = 0;
+
+    // indices_readable, answered from this frame's checks when @p rmesh's stream was already probed.
+    static bool indices_readable_this_frame(const void *rmesh, const std::uint16_t *indices, int n_indices)
+    {
+        const std::uint64_t frame = FrameClock::stamp().frame;
+        for (const IndexCheck &c : s_index_checks)
+        {
+            if (c.frame == frame && c.rmesh == rmesh && c.indices == indices && c.n_indices == n_indices)
+            {
+                return c.readable;
+            }
+        }
+        const bool readable = indices_readable(indices, n_indices);
+        s_index_checks[s_index_check_next] = IndexCheck{rmesh, indices, n_indices, readable, frame};
+        s_index_check_next = (s_index_check_next + 1) % k_index_check_slots;
+        return readable;
+    }
+
     // Compose two row-major Matrix34 affine transforms (each 12 floats, [R|t] with the translation in column 3):
     // out applies b then a, so out * v == a * (b * v). Folds a compound statobj's sub-object local transform
     // into the parent brush world transform before a sub-mesh's vertices are projected.
@@ -256,31 +458,21 @@ namespace TPVCamera
     {
         CoverageProjection P{};
         P.camera = camera;
-        float vdx = pivot.x - camera.x, vdy = pivot.y - camera.y, vdz = pivot.z - camera.z;
-        const float dchar = std::sqrt(vdx * vdx + vdy * vdy + vdz * vdz);
+        float dchar = 0.0f;
+        const Vector3 vd = Simd::normalize_fast(pivot - camera, &dchar);
         if (dchar < 1e-3f)
         {
             return P; // camera sits on the character: cannot project, defer to physics
         }
-        vdx /= dchar;
-        vdy /= dchar;
-        vdz /= dchar;
+        const float vdx = vd.x, vdy = vd.y, vdz = vd.z;
         P.vdx = vdx;
         P.vdy = vdy;
         P.vdz = vdz;
         P.dchar = dchar;
-        float rx = vdy, ry = -vdx; // view x world-up, projected to XY (horizontal)
-        const float rl = std::sqrt(rx * rx + ry * ry);
-        if (rl > 1e-4f)
-        {
-            rx /= rl;
-            ry /= rl;
-        }
-        else
-        {
-            rx = 1.0f;
-            ry = 0.0f;
-        }
+        float rl = 0.0f;
+        const Vector3 r = Simd::normalize_fast(Vector3(vdy, -vdx, 0.0f), &rl); // view x world-up, horizontal
+        const float rx = (rl > 1e-4f) ? r.x : 1.0f;
+        const float ry = (rl > 1e-4f) ? r.y : 0.0f;
         P.rx = rx;
         P.ry = ry;
         // up = right x view (rz == 0)
@@ -294,22 +486,12 @@ namespace TPVCamera
         // unavailable: the historical fixed synthetic box around the pivot (lateral +/-0.25 along right,
         // world-z +0.10 head .. -1.55 shins), which this reproduces EXACTLY so behaviour is unchanged when the
         // AABB cannot be resolved.
-        float chmin = 1e9f, chmax = -1e9f, cvmin = 1e9f, cvmax = -1e9f;
-        const auto add_corner = [&](float wx, float wy, float wz) {
-            const float ex = wx - camera.x, ey = wy - camera.y, ez = wz - camera.z;
-            const float d = std::sqrt(ex * ex + ey * ey + ez * ez);
-            if (d < 1e-3f)
-            {
-                return;
-            }
-            const float h = (ex * rx + ey * ry) / d; // rz == 0
-            const float vv = (ex * P.ux + ey * P.uy + ez * P.uz) / d;
-            chmin = std::min(chmin, h);
-            chmax = std::max(chmax, h);
-            cvmin = std::min(cvmin, vv);
-            cvmax = std::max(cvmax, vv);
-        };
-        const PlayerScreenBounds &pb = player_screen_bounds();
+        // The four box corners are gathered, then taken into the camera frame in one batched transform. The frame
+        // (right, up, view) is orthonormal, so a corner's camera-space length is its distance from the camera.
+        Vector3 corners[4];
+        int n_corners = 0;
+        const auto add_corner = [&](float wx, float wy, float wz) { corners[n_corners++] = Vector3(wx, wy, wz); };
+        const PlayerScreenBounds &pb = player_world_bounds();
         if (pb.valid)
         {
             // Model the body as a vertical CYLINDER: lateral half-width = half the NARROWER horizontal AABB
@@ -340,6 +522,28 @@ namespace TPVCamera
                 }
             }
         }
+        // Rows: right, up, view, each with the translation that puts the camera at the origin.
+        const float to_camera[12] = {rx,   ry,   0.0f, -(rx * camera.x + ry * camera.y),
+                                     P.ux, P.uy, P.uz, -(P.ux * camera.x + P.uy * camera.y + P.uz * camera.z),
+                                     vdx,  vdy,  vdz,  -(vdx * camera.x + vdy * camera.y + vdz * camera.z)};
+        Vector3 eye[4];
+        Simd::transform_points(to_camera,
+                               Simd::strided_span<const Vector3>(corners, static_cast<std::size_t>(n_corners)), eye);
+        float chmin = 1e9f, chmax = -1e9f, cvmin = 1e9f, cvmax = -1e9f;
+        for (int i = 0; i < n_corners; ++i)
+        {
+            const float d = eye[i].magnitude();
+            if (d < 1e-3f)
+            {
+                continue;
+            }
+            const float h = eye[i].x / d;
+            const float vv = eye[i].y / d;
+            chmin = std::min(chmin, h);
+            chmax = std::max(chmax, h);
+            cvmin = std::min(cvmin, vv);
+            cvmax = std::max(cvmax, vv);
+        }
         const float chw = chmax - chmin, cvh = cvmax - cvmin;
         if (chw < 1e-6f || cvh < 1e-6f)
         {
@@ -355,14 +559,40 @@ namespace TPVCamera
         return P;
     }
 
-    // Rasterizes ONE render mesh (its local verts transformed to world by the row-major Matrix34 @p M) into the
-    // shared coverage @p cell grid using the precomputed projection @p P. Triangle raster via the index buffer is
-    // the default; if the index stream is unreadable (freed after GPU upload) a vertex-occupancy fallback marks
-    // the verts instead. Cells already set by a previous mesh stay set, so a compound statobj's sub-meshes
-    // accumulate into one silhouette. Returns true if a readable mesh was rasterized, so the caller can tell
-    // "measured, covers nothing" from "no measurable mesh". POD body (runs in the caller's SEH frame).
-    static bool rasterize_mesh(void *rmesh, const float *M, const CoverageProjection &P,
-                               bool cell[4][Constants::RENDER_COVERAGE_COLUMNS], uintptr_t mod_lo, uintptr_t mod_hi)
+    // Projected-vertex scratch for rasterize_mesh: screen (h, v) and view depth per vertex, filled lazily in blocks
+    // of k_proj_block by the bulk kernel the first time a triangle touches a vertex of the block. Lazy so the raster
+    // keeps its early-out (a solid wall fills the grid in a few triangles and never projects the rest), blocked so
+    // the projection runs at SIMD width over the contiguous stream instead of once per triangle corner (a shared
+    // vertex was re-projected by every triangle using it). Static storage, written by the render thread and, during
+    // a parallel raster (see ParallelRaster), its lanes: a block goes empty -> busy -> ready, claimed by CAS, and a
+    // lane that meets a block another lane is still projecting projects its one vertex locally instead of waiting.
+    // POD, so the arrays are safe inside the caller's SEH frame.
+    static constexpr int k_proj_block = 64;
+    static constexpr int k_proj_blocks = (Constants::RENDER_OCCLUSION_VERT_MAX + k_proj_block - 1) / k_proj_block;
+    static constexpr std::uint8_t k_proj_empty = 0;
+    static constexpr std::uint8_t k_proj_busy = 1;
+    static constexpr std::uint8_t k_proj_ready = 2;
+    static float s_proj_h[k_proj_blocks * k_proj_block];
+    static float s_proj_v[k_proj_blocks * k_proj_block];
+    static float s_proj_depth[k_proj_blocks * k_proj_block];
+    static std::uint8_t s_proj_state[k_proj_blocks];
+
+    // The CPU-side streams of one render mesh: the decoded float3 positions and, when readable, the uint16 triangle
+    // index list (indices == nullptr when it is absent, over the caps, or freed after GPU upload).
+    struct MeshStreams
+    {
+        const void *rmesh = nullptr; // the engine mesh the streams came from; nullptr for an occluder proxy
+        const std::uint8_t *pos = nullptr;
+        int stride = 0;
+        int n_verts = 0;
+        const std::uint16_t *indices = nullptr;
+        int n_indices = 0;
+    };
+
+    // Fetches @p rmesh's position stream (GetPosPtr / FSL_READ) and, if readable, its index stream, screening both
+    // vtable slots against the game image first. False when the mesh has no usable position stream. POD body (runs
+    // in the caller's SEH frame).
+    static bool fetch_mesh_streams(void *rmesh, uintptr_t mod_lo, uintptr_t mod_hi, MeshStreams &out)
     {
         if (rmesh == nullptr)
         {
@@ -407,67 +637,274 @@ namespace TPVCamera
             else
             {
                 indices = get_idx(rmesh, Constants::IRENDERMESH_FSL_READ, 0);
-                if (indices == nullptr || !indices_readable(indices, n_indices))
+                if (indices == nullptr || !indices_readable_this_frame(rmesh, indices, n_indices))
                 {
                     have_tris = false;
                 }
             }
         }
+        out.rmesh = rmesh;
+        out.pos = pos;
+        out.stride = stride;
+        out.n_verts = n_verts;
+        out.indices = have_tris ? indices : nullptr;
+        out.n_indices = have_tris ? n_indices : 0;
+        return true;
+    }
+
+    // ---- Coverage mask ------------------------------------------------------------------------------------------
+    // The character box as 4 bands (head -> shins) x RENDER_COVERAGE_COLUMNS columns, bit-packed: one 64-bit row per
+    // band (bit c = column c's centre is covered), plus a coarse level of k_tile_cols-column tiles per band whose
+    // bit is set once every column of the tile is. A triangle is tested against whole tiles first -- a full tile is
+    // skipped, a tile whose end centres both fall inside the (convex) triangle is accepted in one OR, and one whose
+    // end centres both lie outside the same edge is rejected -- and only the remaining mixed tiles fall back to the
+    // per-centre edge test. The raster also stops as soon as the head-weighted coverage reaches stop_at (the
+    // caller's cov_thresh when it only needs the verdict), not just when the grid is full. POD, so it lives in the
+    // caller's SEH frame like the old bool grid.
+    static constexpr int k_cov_bands = 4;
+    static constexpr int k_cov_cols = Constants::RENDER_COVERAGE_COLUMNS;
+    static constexpr int k_tile_cols = 4;
+    static constexpr int k_cov_tiles = (k_cov_cols + k_tile_cols - 1) / k_tile_cols;
+    static_assert(k_cov_cols >= 1 && k_cov_cols <= 64, "coverage rows are one 64-bit word per band");
+    static constexpr std::uint64_t k_row_full = (k_cov_cols == 64) ? ~0ull : ((1ull << k_cov_cols) - 1);
+    static constexpr std::uint64_t k_tiles_full = (1ull << k_cov_tiles) - 1;
+    // Head-weighted coverage: each band's filled-column fraction, weighted head->feet (a real TPV camera protects
+    // the head / look-at socket, not the legs).
+    static constexpr float k_char_level_weight[k_cov_bands] = {1.0f, 0.8f, 0.45f, 0.2f}; // head, chest, hips, shins
+    static constexpr float k_cov_no_early_out = 2.0f; // stop_at above any coverage: raster until the grid is full
+
+    struct CoverageMask
+    {
+        std::uint64_t row[k_cov_bands];  // fine level: bit c = column c covered
+        std::uint64_t tile[k_cov_bands]; // coarse level: bit t = columns [t * k_tile_cols, ...) all covered
+        float stop_at;                   // stop once the weighted coverage reaches this
+        bool done;                       // full, or coverage >= stop_at: further triangles cannot matter
+    };
 
-        // Project a world point to screen angular (h, v) = lateral / vertical offset per unit depth.
-        const auto project = [&](float wx, float wy, float wz, float &h, float &vv) -> float
+    static CoverageMask make_coverage_mask(float stop_at)
+    {
+        CoverageMask m{};
+        m.stop_at = stop_at;
+        return m;
+    }
+
+    static constexpr std::uint64_t tile_bits(int t)
+    {
+        return (((1ull << k_tile_cols) - 1) << (t * k_tile_cols)) & k_row_full;
+    }
+
+    static float band_fill(const CoverageMask &m, int b)
+    {
+        return static_cast<float>(std::popcount(m.row[b])) / static_cast<float>(k_cov_cols);
+    }
+
+    static float mask_coverage(const CoverageMask &m)
+    {
+        float wsum = 0.0f, wov = 0.0f;
+        for (int b = 0; b < k_cov_bands; ++b)
         {
-            const float ex = wx - P.camera.x, ey = wy - P.camera.y, ez = wz - P.camera.z;
-            const float d = std::sqrt(ex * ex + ey * ey + ez * ez);
-            if (d < 1e-3f)
+            wov += k_char_level_weight[b] * band_fill(m, b);
+            wsum += k_char_level_weight[b];
+        }
+        return (wsum > 0.0f) ? std::min(1.0f, wov / wsum) : 0.0f;
+    }
+
+    // ORs @p bits into band @p b, refreshing its tile bits and the done flag when anything new was set.
+    static void mask_set(CoverageMask &m, int b, std::uint64_t bits)
+    {
+        if ((bits & ~m.row[b]) == 0)
+        {
+            return;
+        }
+        m.row[b] |= bits;
+        for (int t = 0; t < k_cov_tiles; ++t)
+        {
+            if ((m.row[b] & tile_bits(t)) == tile_bits(t))
             {
-                h = 0.0f;
-                vv = 0.0f;
-                return 0.0f;
+                m.tile[b] |= 1ull << t;
             }
-            h = (ex * P.rx + ey * P.ry) / d; // rz == 0
-            vv = (ex * P.ux + ey * P.uy + ez * P.uz) / d;
-            return ex * P.vdx + ey * P.vdy + ez * P.vdz; // depth along the view
-        };
-        const auto vtx_screen = [&](int idx, float &h, float &vv) -> float
-        {
-            const auto *lp = reinterpret_cast<const float *>(pos + static_cast<size_t>(idx) * stride);
-            const float lx = lp[0], ly = lp[1], lz = lp[2];
-            const float wx = M[0] * lx + M[1] * ly + M[2] * lz + M[3];
-            const float wy = M[4] * lx + M[5] * ly + M[6] * lz + M[7];
-            const float wz = M[8] * lx + M[9] * ly + M[10] * lz + M[11];
-            return project(wx, wy, wz, h, vv);
-        };
+        }
+        bool full = true;
+        for (int k = 0; k < k_cov_bands; ++k)
+        {
+            full = full && m.tile[k] == k_tiles_full;
+        }
+        m.done = full || (m.stop_at <= 1.0f && mask_coverage(m) >= m.stop_at);
+    }
+
+    // One stream as the triangle raster reads it: the mesh streams plus the brush-to-screen projection built from
+    // the brush matrix and the CoverageProjection.
+    struct StreamRaster
+    {
+        MeshStreams ms;
+        VertexKernels::ScreenProjection sp;
+        const std::uint8_t *keep; // per k_mesh_cluster_tris run: 0 = culled (see cull_mesh_clusters); nullptr = all
+    };
 
-        constexpr int k_cols = Constants::RENDER_COVERAGE_COLUMNS;
-        constexpr int k_total_cells = 4 * k_cols;
-        // Running count of filled cells, seeded from cells a previous sub-mesh already set, so the raster can stop
-        // the moment the character silhouette is fully covered: a solid occluder (a wall, a closed door / gate)
-        // fills the 4x8 grid in a handful of triangles instead of rasterizing the whole mesh. This is the main
-        // saving in dense / indoor scenes, where a compound wall carries thousands of triangles across sub-meshes.
-        int filled = 0;
-        for (int b = 0; b < 4; ++b)
+    // Screen angular (h, v) = lateral / vertical offset per unit depth, plus the depth along the view, of vertex
+    // @p idx transformed to world. Served from the block scratch above (see k_proj_block); Shared claims the block
+    // atomically for the parallel raster's lanes. POD body.
+    template <bool Shared>
+    static float vertex_screen(const StreamRaster &sr, int idx, float &h, float &v)
+    {
+        const int blk = idx / k_proj_block;
+        const int first = blk * k_proj_block;
+        if constexpr (Shared)
         {
-            for (int c = 0; c < k_cols; ++c)
+            std::atomic_ref<std::uint8_t> state(s_proj_state[blk]);
+            if (state.load(std::memory_order_acquire) != k_proj_ready)
             {
-                if (cell[b][c])
+                std::uint8_t expected = k_proj_empty;
+                if (state.compare_exchange_strong(expected, k_proj_busy, std::memory_order_acquire))
                 {
-                    ++filled;
+                    VertexKernels::project_vertices(sr.ms.pos, sr.ms.stride, first,
+                                                    std::min(k_proj_block, sr.ms.n_verts - first), sr.sp, s_proj_h,
+                                                    s_proj_v, s_proj_depth);
+                    state.store(k_proj_ready, std::memory_order_release);
                 }
+                else if (expected != k_proj_ready)
+                {
+                    float depth = 0.0f;
+                    VertexKernels::project_vertices(sr.ms.pos + static_cast<std::ptrdiff_t>(idx) * sr.ms.stride,
+                                                    sr.ms.stride, 0, 1, sr.sp, &h, &v, &depth);
+                    return depth;
+                }
+            }
+        }
+        else if (s_proj_state[blk] != k_proj_ready)
+        {
+            VertexKernels::project_vertices(sr.ms.pos, sr.ms.stride, first,
+                                            std::min(k_proj_block, sr.ms.n_verts - first), sr.sp, s_proj_h, s_proj_v,
+                                            s_proj_depth);
+            s_proj_state[blk] = k_proj_ready;
+        }
+        h = s_proj_h[idx];
+        v = s_proj_v[idx];
+        return s_proj_depth[idx];
+    }
+
+    // Culls the triangle runs of @p mc against the camera-to-character volume of @p P, writing s_mesh_cluster_keep
+    // (1 = may land in the character box). A run is rejected when the bounding sphere of its world box lies wholly
+    // beyond the character or behind the near limit along the view, or wholly outside the character box's angular
+    // span on screen -- the same tests the raster applies per triangle, made conservative for every point of the
+    // sphere, so a rejected run could not have set a cell. Returns the triangles left in kept runs.
+    static std::uint8_t s_mesh_cluster_keep[k_mesh_cluster_pool];
+
+    static int cull_mesh_clusters(const MeshClusters &mc, int n_tris, const float *M, const CoverageProjection &P)
+    {
+        // Range [lo, hi] of a screen coordinate (the cosine to its axis) over a sphere of angular radius a whose
+        // centre sits at cosine cos_c.
+        const auto span = [](float cos_c, float sin_a, float cos_a, float &lo, float &hi)
+        {
+            const float sin_c = std::sqrt(std::max(0.0f, 1.0f - cos_c * cos_c));
+            hi = (cos_c >= cos_a) ? 1.0f : cos_c * cos_a + sin_c * sin_a;
+            lo = (-cos_c >= cos_a) ? -1.0f : cos_c * cos_a - sin_c * sin_a;
+        };
+        int kept = 0;
+        for (int k = 0; k < mc.n_tri_boxes; ++k)
+        {
+            const ClusterBox &b = mc.tri_boxes[k];
+            s_mesh_cluster_keep[k] = 0;
+            if (b.lo[0] > b.hi[0])
+            {
+                continue; // no readable triangle in the run
+            }
+            float c[3], e[3];
+            cluster_box_world(b, M, c, e);
+            const float ex = c[0] - P.camera.x, ey = c[1] - P.camera.y, ez = c[2] - P.camera.z;
+            const float dc = std::sqrt(ex * ex + ey * ey + ez * ez);
+            const float radius = std::sqrt(e[0] * e[0] + e[1] * e[1] + e[2] * e[2]);
+            bool keep = true;
+            if (dc > radius + 1e-3f)
+            {
+                const float depth = ex * P.vdx + ey * P.vdy + ez * P.vdz;
+                const float depth_ext = e[0] * std::fabs(P.vdx) + e[1] * std::fabs(P.vdy) + e[2] * std::fabs(P.vdz);
+                const float sin_a = radius / dc;
+                const float cos_a = std::sqrt(std::max(0.0f, 1.0f - sin_a * sin_a));
+                float hlo, hhi, vlo, vhi;
+                span((ex * P.rx + ey * P.ry) / dc, sin_a, cos_a, hlo, hhi);
+                span((ex * P.ux + ey * P.uy + ez * P.uz) / dc, sin_a, cos_a, vlo, vhi);
+                keep = depth - depth_ext <= P.dchar + 0.2f && depth + depth_ext > 0.1f && hhi >= P.chmin &&
+                       hlo <= P.chmax && vhi >= P.cvmin && vlo <= P.cvmax;
+            }
+            if (keep)
+            {
+                s_mesh_cluster_keep[k] = 1;
+                kept += std::min(k_mesh_cluster_tris, n_tris - k * k_mesh_cluster_tris);
             }
         }
-        const int n_tris = have_tris ? (n_indices / 3) : 0; // 0 when indices unreadable -> vertex fallback below
-        for (int t = 0; t < n_tris && filled < k_total_cells; ++t)
+        return kept;
+    }
+
+    // ---- Parallel raster ----------------------------------------------------------------------------------------
+    // A mesh of k_par_min_tris triangles or more (a compound building, a large canopy) is split into chunks of
+    // k_par_chunk_tris and run across the render thread and the RasterJobs helpers. Each lane rasterizes into its
+    // own copy of the caller's mask; every k_par_sync_tris triangles a lane ORs its rows into the shared rows and
+    // takes the union back, so a lane skips tiles another lane already covered and every lane stops once the union
+    // is done (full, or past the caller's stop_at). The lane masks are OR-merged into the caller's when the job
+    // ends. Smaller meshes -- and every occluder proxy, which is capped well below the threshold -- stay inline:
+    // waking the helpers costs more than they would save.
+    static constexpr int k_par_min_tris = 16384;
+    static constexpr int k_par_chunk_tris = 4096;
+    static constexpr int k_par_sync_tris = 256;
+    static_assert((k_par_sync_tris & (k_par_sync_tris - 1)) == 0, "k_par_sync_tris is a power of two");
+
+    struct ParallelRaster
+    {
+        StreamRaster sr;
+        const CoverageProjection *P;
+        int n_tris;
+        std::atomic<bool> cancel;
+        std::atomic<std::uint64_t> rows[k_cov_bands];
+        CoverageMask lane[RasterJobs::k_max_lanes];
+    };
+    static ParallelRaster s_par; // render thread publishes, the lanes read; one job at a time
+
+    // Publishes @p mask's rows to the shared union and folds the union back in. True once the lane can stop.
+    static bool par_sync(ParallelRaster &par, CoverageMask &mask)
+    {
+        for (int b = 0; b < k_cov_bands; ++b)
+        {
+            mask_set(mask, b, par.rows[b].fetch_or(mask.row[b], std::memory_order_relaxed) | mask.row[b]);
+        }
+        if (mask.done)
         {
+            par.cancel.store(true, std::memory_order_relaxed);
+            return true;
+        }
+        return par.cancel.load(std::memory_order_relaxed);
+    }
+
+    // Triangles [@p t_begin, @p t_end) of @p sr into @p mask; @p par is the parallel job when Shared. POD body.
+    template <bool Shared>
+    static void raster_triangles(const StreamRaster &sr, const CoverageProjection &P, CoverageMask &mask,
+                                 int t_begin, int t_end, ParallelRaster *par)
+    {
+        const std::uint16_t *indices = sr.ms.indices;
+        const int n_verts = sr.ms.n_verts;
+        for (int t = t_begin; t < t_end && !mask.done; ++t)
+        {
+            if constexpr (Shared)
+            {
+                if ((t & (k_par_sync_tris - 1)) == 0 && t != t_begin && par_sync(*par, mask))
+                {
+                    break;
+                }
+            }
+            if (sr.keep != nullptr && sr.keep[t / k_mesh_cluster_tris] == 0)
+            {
+                t |= k_mesh_cluster_tris - 1; // skip to the last triangle of the culled run
+                continue;
+            }
             const int i0 = indices[t * 3 + 0], i1 = indices[t * 3 + 1], i2 = indices[t * 3 + 2];
             if (i0 >= n_verts || i1 >= n_verts || i2 >= n_verts)
             {
                 continue;
             }
             float h0, v0, h1, v1, h2, v2;
-            const float t0 = vtx_screen(i0, h0, v0);
-            const float t1 = vtx_screen(i1, h1, v1);
-            const float t2 = vtx_screen(i2, h2, v2);
+            const float t0 = vertex_screen<Shared>(sr, i0, h0, v0);
+            const float t1 = vertex_screen<Shared>(sr, i1, h1, v1);
+            const float t2 = vertex_screen<Shared>(sr, i2, h2, v2);
             const float tmin = std::min(t0, std::min(t1, t2));
             if (tmin <= 0.1f || tmin > P.dchar + 0.2f)
             {
@@ -489,43 +926,192 @@ namespace TPVCamera
             rb0 = (rb0 < 0) ? 0 : rb0;
             rb1 = (rb1 > 3) ? 3 : rb1;
             cc0 = (cc0 < 0) ? 0 : cc0;
-            cc1 = (cc1 > k_cols - 1) ? k_cols - 1 : cc1;
+            cc1 = (cc1 > k_cov_cols - 1) ? k_cov_cols - 1 : cc1;
             // Mark only cells whose CENTRE is inside the triangle, not its whole bbox. A thin DIAGONAL stick
             // (tripod / lean-to pole) has a large axis-aligned bbox but the triangle is a sliver, so bbox-marking
             // would falsely fill the character's columns. Edge-function sign test (a point on an edge counts in).
+            // For a non-degenerate triangle the three edge functions sum to its (signed, doubled) area, so a centre
+            // is inside iff no edge disagrees with that sign.
+            const float area = (h2 - h0) * (v1 - v0) - (v2 - v0) * (h1 - h0);
+            const auto edges = [&](float pch, float pcv, float *e)
+            {
+                e[0] = (pch - h0) * (v1 - v0) - (pcv - v0) * (h1 - h0);
+                e[1] = (pch - h1) * (v2 - v1) - (pcv - v1) * (h2 - h1);
+                e[2] = (pch - h2) * (v0 - v2) - (pcv - v2) * (h0 - h2);
+            };
+            const auto inside = [](const float *e)
+            {
+                const bool has_neg = (e[0] < 0.0f) || (e[1] < 0.0f) || (e[2] < 0.0f);
+                const bool has_pos = (e[0] > 0.0f) || (e[1] > 0.0f) || (e[2] > 0.0f);
+                return !(has_neg && has_pos);
+            };
+            const auto col_centre = [&](int c) { return P.chmin + (static_cast<float>(c) + 0.5f) * P.col_w; };
             for (int b = rb0; b <= rb1; ++b)
             {
                 const float pcv = P.cvmax - (static_cast<float>(b) + 0.5f) * P.band_h;
-                for (int c = cc0; c <= cc1; ++c)
+                for (int tile = cc0 / k_tile_cols; tile <= cc1 / k_tile_cols; ++tile)
                 {
-                    if (cell[b][c])
+                    if ((mask.tile[b] >> tile) & 1ull)
+                    {
+                        continue; // tile already fully covered
+                    }
+                    const int c0 = std::max(cc0, tile * k_tile_cols);
+                    const int c1 = std::min(cc1, tile * k_tile_cols + k_tile_cols - 1);
+                    const std::uint64_t span = (~0ull >> (63 - (c1 - c0))) << c0; // columns c0..c1
+                    if ((mask.row[b] & span) == span)
                     {
                         continue;
                     }
-                    const float pch = P.chmin + (static_cast<float>(c) + 0.5f) * P.col_w;
-                    const float e0 = (pch - h0) * (v1 - v0) - (pcv - v0) * (h1 - h0);
-                    const float e1 = (pch - h1) * (v2 - v1) - (pcv - v1) * (h2 - h1);
-                    const float e2 = (pch - h2) * (v0 - v2) - (pcv - v2) * (h0 - h2);
-                    const bool has_neg = (e0 < 0.0f) || (e1 < 0.0f) || (e2 < 0.0f);
-                    const bool has_pos = (e0 > 0.0f) || (e1 > 0.0f) || (e2 > 0.0f);
-                    if (!(has_neg && has_pos))
+                    // The span's centres are collinear, so the convex triangle holds them all when it holds both
+                    // ends, and none when both ends lie outside one edge.
+                    float ea[3], eb[3];
+                    edges(col_centre(c0), pcv, ea);
+                    edges(col_centre(c1), pcv, eb);
+                    if (area != 0.0f)
                     {
-                        cell[b][c] = true;
-                        ++filled;
+                        if (inside(ea) && inside(eb))
+                        {
+                            mask_set(mask, b, span);
+                            continue;
+                        }
+                        const bool rejected = (area > 0.0f) ? ((ea[0] < 0.0f && eb[0] < 0.0f) ||
+                                                               (ea[1] < 0.0f && eb[1] < 0.0f) ||
+                                                               (ea[2] < 0.0f && eb[2] < 0.0f))
+                                                            : ((ea[0] > 0.0f && eb[0] > 0.0f) ||
+                                                               (ea[1] > 0.0f && eb[1] > 0.0f) ||
+                                                               (ea[2] > 0.0f && eb[2] > 0.0f));
+                        if (rejected)
+                        {
+                            continue;
+                        }
+                    }
+                    for (int c = c0; c <= c1; ++c)
+                    {
+                        if ((mask.row[b] >> c) & 1ull)
+                        {
+                            continue;
+                        }
+                        float e[3];
+                        edges(col_centre(c), pcv, e);
+                        if (inside(e))
+                        {
+                            mask_set(mask, b, 1ull << c);
+                        }
                     }
                 }
             }
         }
+    }
+
+    // RasterJobs chunk: k_par_chunk_tris triangles into the lane's mask (skipped once the union is done).
+    static void raster_chunk(void *ctx, int chunk, int lane)
+    {
+        ParallelRaster &par = *static_cast<ParallelRaster *>(ctx);
+        if (par.cancel.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        const int t_begin = chunk * k_par_chunk_tris;
+        const int t_end = std::min(par.n_tris, t_begin + k_par_chunk_tris);
+        raster_triangles<true>(par.sr, *par.P, par.lane[lane], t_begin, t_end, &par);
+        par_sync(par, par.lane[lane]);
+    }
 
+    // Runs @p n_tris triangles of @p sr across the job pool and merges the lanes into @p mask. A chunk that faulted
+    // is re-raised here as an access violation so the caller's SEH frame sees the same fault as the inline raster.
+    static void raster_triangles_parallel(const StreamRaster &sr, const CoverageProjection &P, CoverageMask &mask,
+                                          int n_tris)
+    {
+        s_par.sr = sr;
+        s_par.P = &P;
+        s_par.n_tris = n_tris;
+        s_par.cancel.store(false, std::memory_order_relaxed);
+        for (int b = 0; b < k_cov_bands; ++b)
+        {
+            s_par.rows[b].store(mask.row[b], std::memory_order_relaxed);
+        }
+        for (CoverageMask &lane : s_par.lane)
+        {
+            lane = mask;
+        }
+        const bool ok = RasterJobs::run(raster_chunk, &s_par, (n_tris + k_par_chunk_tris - 1) / k_par_chunk_tris);
+        for (const CoverageMask &lane : s_par.lane)
+        {
+            for (int b = 0; b < k_cov_bands; ++b)
+            {
+                mask_set(mask, b, lane.row[b]);
+            }
+        }
+        if (!ok)
+        {
+            Health::note(Health::Site::RasterJobFault);
+            RaiseException(EXCEPTION_ACCESS_VIOLATION, EXCEPTION_NONCONTINUABLE, 0, nullptr);
+        }
+    }
+
+    // Rasterizes one vertex / index stream (local verts transformed to world by the row-major Matrix34 @p M) into
+    // the shared coverage mask @p mask using the precomputed projection @p P. Triangle raster via the index list is
+    // the default (across the job pool for a large mesh, see ParallelRaster); without one (freed after GPU upload) a
+    // vertex-occupancy fallback marks the verts instead. Cells already set by a previous mesh stay set, so a
+    // compound statobj's sub-meshes accumulate into one silhouette. Serves both engine meshes and the cached
+    // occluder proxies below. POD body (runs in the caller's SEH frame).
+    static void rasterize_stream(const MeshStreams &ms, const float *M, const CoverageProjection &P,
+                                 CoverageMask &mask)
+    {
+        const int n_verts = ms.n_verts;
+        const bool have_tris = (ms.indices != nullptr);
+
+        StreamRaster sr{};
+        sr.ms = ms;
+        std::memcpy(sr.sp.m, M, sizeof(sr.sp.m));
+        sr.sp.cam_x = P.camera.x;
+        sr.sp.cam_y = P.camera.y;
+        sr.sp.cam_z = P.camera.z;
+        sr.sp.right_x = P.rx;
+        sr.sp.right_y = P.ry;
+        sr.sp.up_x = P.ux;
+        sr.sp.up_y = P.uy;
+        sr.sp.up_z = P.uz;
+        sr.sp.view_x = P.vdx;
+        sr.sp.view_y = P.vdy;
+        sr.sp.view_z = P.vdz;
+        std::memset(s_proj_state, k_proj_empty, static_cast<size_t>((n_verts + k_proj_block - 1) / k_proj_block));
+        sr.keep = nullptr;
+
+        // The mask's done flag carries over from a previous sub-mesh, so the raster stops the moment the character
+        // silhouette is covered enough: a solid occluder (a wall, a closed door / gate) fills the grid in a handful of
+        // triangles instead of rasterizing the whole mesh. This is the main saving in dense / indoor scenes, where a
+        // compound wall carries thousands of triangles across sub-meshes.
+        const int n_tris = have_tris ? (ms.n_indices / 3) : 0; // 0 when indices unreadable -> vertex fallback below
+        // A large engine mesh first drops the triangle runs that cannot reach the character box (see MeshClusters),
+        // so their vertices are never projected.
+        int live_tris = n_tris;
+        if (ms.rmesh != nullptr && n_tris >= k_mesh_cluster_min_tris && !mask.done)
+        {
+            if (const MeshClusters *mc = mesh_clusters(ms.rmesh, ms.pos, ms.stride, n_verts, ms.indices, ms.n_indices);
+                mc != nullptr)
+            {
+                live_tris = cull_mesh_clusters(*mc, n_tris, M, P);
+                sr.keep = s_mesh_cluster_keep;
+            }
+        }
+        if (live_tris >= k_par_min_tris && !mask.done && RasterJobs::worker_count() > 0)
+        {
+            raster_triangles_parallel(sr, P, mask, n_tris);
+        }
+        else if (live_tris > 0)
+        {
+            raster_triangles<false>(sr, P, mask, 0, n_tris, nullptr);
+        }
         // Vertex-occupancy fallback, only when the index list was unreadable (see have_tris): mark the band/column
         // cell each in-front vertex projects into. Less precise than the triangle raster (vertex-density dependent)
         // but it NEVER runs for a mesh whose triangles are readable, so canopies / walls are unaffected.
         if (!have_tris)
         {
-            for (int v = 0; v < n_verts && filled < k_total_cells; ++v)
+            for (int v = 0; v < n_verts && !mask.done; ++v)
             {
                 float vh = 0.0f, vv = 0.0f;
-                const float vd = vtx_screen(v, vh, vv);
+                const float vd = vertex_screen<false>(sr, v, vh, vv);
                 if (vd <= 0.1f || vd > P.dchar + 0.2f)
                 {
                     continue; // vertex not between the camera and the character
@@ -537,149 +1123,721 @@ namespace TPVCamera
                 int b = static_cast<int>((P.cvmax - vv) / P.band_h);
                 int c = static_cast<int>((vh - P.chmin) / P.col_w);
                 b = (b < 0) ? 0 : (b > 3 ? 3 : b);
-                c = (c < 0) ? 0 : (c > k_cols - 1 ? k_cols - 1 : c);
-                if (!cell[b][c])
-                {
-                    cell[b][c] = true;
-                    ++filled;
-                }
+                c = (c < 0) ? 0 : (c > k_cov_cols - 1 ? k_cov_cols - 1 : c);
+                mask_set(mask, b, 1ull << c);
             }
         }
+    }
+
+    // Rasterizes ONE render mesh into @p mask (see rasterize_stream). Returns true if a readable mesh was
+    // rasterized, so the caller can tell "measured, covers nothing" from "no measurable mesh". POD body.
+    static bool rasterize_mesh(void *rmesh, const float *M, const CoverageProjection &P,
+                               CoverageMask &mask, uintptr_t mod_lo, uintptr_t mod_hi)
+    {
+        MeshStreams ms{};
+        if (!fetch_mesh_streams(rmesh, mod_lo, mod_hi, ms))
+        {
+            return false;
+        }
+        rasterize_stream(ms, M, P, mask);
         return true;
     }
 
-    // Walks a compound statobj's sub-object vector and rasterizes each child sub-mesh into @p cell (transformed by
+    // Walks a compound statobj's sub-object vector and rasterizes each child sub-mesh into @p mask (transformed by
     // the parent brush matrix folded with each sub-object's local transform). Returns true if at least one
     // sub-mesh was measured. A compound .cgf (fence / gate / drying rack) has a null ROOT render mesh and its
     // geometry split across child IStatObjs, so without this the raster would see nothing and the caller would
     // fall back to the coarser physics-ray occlusion. Child sub-objects share the parent CStatObj vtable, checked
-    // before any read so a non-compound statobj with unrelated data at the vector offset is rejected. POD body.
-    // True once every coverage cell is set: a fully-covered silhouette cannot read higher, so the compound walk
-    // stops issuing further sub-mesh reads (each is an engine GetPosPtr call) the moment the grid is full.
-    static bool grid_full(const bool cell[4][Constants::RENDER_COVERAGE_COLUMNS])
+    // before any read so a non-compound statobj with unrelated data at the vector offset is rejected. The walk
+    // stops issuing further sub-mesh reads (each is an engine GetPosPtr call) once the mask is done. POD body.
+    static bool rasterize_compound(void *statobj, const float *brush_m, const CoverageProjection &P,
+                                   CoverageMask &mask, uintptr_t mod_lo, uintptr_t mod_hi)
+    {
+        auto *sb = reinterpret_cast<std::byte *>(statobj);
+        const uintptr_t self_vt = *reinterpret_cast<uintptr_t *>(sb);
+        const uintptr_t begin = *reinterpret_cast<uintptr_t *>(sb + Constants::STATOBJ_SUBOBJ_BEGIN_OFFSET);
+        const uintptr_t end = *reinterpret_cast<uintptr_t *>(sb + Constants::STATOBJ_SUBOBJ_END_OFFSET);
+        if (begin == 0 || end <= begin || !DMK::Memory::plausible_userspace_ptr(begin) ||
+            (end - begin) % Constants::SUBOBJ_STRIDE != 0)
+        {
+            return false; // not a populated sub-object vector (drift / simple statobj streamed out)
+        }
+        int count = static_cast<int>((end - begin) / Constants::SUBOBJ_STRIDE);
+        if (count > Constants::SUBOBJ_MAX)
+        {
+            count = Constants::SUBOBJ_MAX;
+        }
+        bool measured = false;
+        for (int i = 0; i < count; ++i)
+        {
+            if (mask.done)
+            {
+                break; // silhouette covered (or past stop_at) -> remaining sub-meshes cannot change the verdict
+            }
+            auto *so = reinterpret_cast<std::byte *>(begin + static_cast<uintptr_t>(i) * Constants::SUBOBJ_STRIDE);
+            void *child = *reinterpret_cast<void **>(so + Constants::SUBOBJ_PSTATOBJ_OFFSET);
+            if (child == nullptr || !DMK::Memory::plausible_userspace_ptr(reinterpret_cast<uintptr_t>(child)) ||
+                *reinterpret_cast<uintptr_t *>(child) != self_vt)
+            {
+                continue; // not a sibling CStatObj -> skip (also rejects garbage at a non-compound vector offset)
+            }
+            void *child_rmesh = *reinterpret_cast<void **>(reinterpret_cast<std::byte *>(child) +
+                                                           Constants::STATOBJ_RENDERMESH_OFFSET);
+            if (child_rmesh == nullptr)
+            {
+                continue; // a nested-compound child is not recursed (one level covers these props)
+            }
+            float world_m[12];
+            mat34_compose(brush_m, reinterpret_cast<const float *>(so + Constants::SUBOBJ_TM_OFFSET), world_m);
+            measured = rasterize_mesh(child_rmesh, world_m, P, mask, mod_lo, mod_hi) || measured;
+        }
+        return measured;
+    }
+
+    // ---- Occluder proxies ---------------------------------------------------------------------------------------
+    // Cached, simplified copies of a statobj's visible surface for the coverage raster. Every coverage measurement
+    // of a brush used to re-fetch the render mesh through the vtable, re-probe its index buffer (indices_readable)
+    // and walk every raw triangle -- each frame, for the same static tents and awnings the camera orbits past. A
+    // proxy holds the statobj's triangles in its OWN LOCAL space (a compound's sub-meshes folded in through their
+    // sub-object transforms), so every placed instance of the same .cgf shares it and the raster applies the
+    // brush's world matrix as usual: a moved brush needs no invalidation, only a changed statobj does. A mesh that
+    // fits the caps is copied losslessly; a denser one is simplified by vertex clustering (vertices snapped to a
+    // grid cell merge into their mean, triangles that collapse are dropped), doubling the cell until it fits. The
+    // raster of a proxy touches only mod-owned memory. POD static pool, render thread only.
+    static constexpr int k_proxy_slots = 16;
+    static constexpr int k_proxy_vert_cap = 4096;
+    static constexpr int k_proxy_tri_cap = 8192;
+    static constexpr float k_proxy_first_cell = 0.02f; // first clustering cell (m); well under a thin slat
+    static constexpr int k_proxy_attempts = 4;         // 0.02 / 0.04 / 0.08 / 0.16 m, then give up
+    static constexpr int k_cluster_table = 4 * k_proxy_vert_cap;
+
+    enum class ProxyState : std::uint8_t
+    {
+        Empty,
+        Ready,
+        Uncacheable // too dense even at the coarsest cell: rasterize the engine mesh directly, do not retry
+    };
+
+    struct OccluderProxy
     {
-        for (int b = 0; b < 4; ++b)
+        // Identity: the statobj and the streams it resolved to when built. A streamed-out / swapped LOD changes the
+        // root mesh or the sub-object vector, which invalidates the proxy.
+        void *statobj;
+        void *rmesh;
+        uintptr_t sub_begin;
+        uintptr_t sub_end;
+        ProxyState state;
+        std::uint32_t stamp;
+        int n_verts;
+        int n_tris;
+        float verts[k_proxy_vert_cap * 3];
+        std::uint16_t tris[k_proxy_tri_cap * 3];
+    };
+
+    static OccluderProxy s_proxies[k_proxy_slots];
+    static std::uint32_t s_proxy_tick = 0;
+    // Build scratch: source vertex -> proxy vertex of the mesh being folded, and the clustering hash (cell key ->
+    // proxy vertex, with the running position sum / count for the mean).
+    static int s_proxy_vmap[Constants::RENDER_OCCLUSION_VERT_MAX];
+    static std::uint64_t s_cluster_key[k_cluster_table];
+    static int s_cluster_vert[k_cluster_table];
+    static float s_cluster_sum[k_proxy_vert_cap * 3];
+    static int s_cluster_count[k_proxy_vert_cap];
+
+    // Grid index of @p f on one clustering axis: 21 bits (+/- ~20 km at 0.02 m), offset to unsigned.
+    static std::uint64_t cluster_axis(float f, float inv_cell)
+    {
+        return static_cast<std::uint64_t>(static_cast<std::int64_t>(std::floor(f * inv_cell)) + (1 << 20)) & 0x1FFFFFu;
+    }
+
+    // Folds one mesh stream (local -> statobj space by @p tm, nullptr = identity) into the proxy under build. With
+    // @p cell > 0 vertices are clustered on that grid, else copied 1:1. False on overflow of either cap (the caller
+    // retries with a coarser cell) or a mesh without a readable index list (no proxy: the direct raster keeps its
+    // vertex-occupancy fallback for it). POD body (runs in the caller's SEH frame).
+    static bool proxy_fold_mesh(OccluderProxy &px, const MeshStreams &ms, const float *tm, float cell)
+    {
+        if (ms.indices == nullptr)
+        {
+            return false;
+        }
+        const float inv_cell = (cell > 0.0f) ? 1.0f / cell : 0.0f;
+        for (int v = 0; v < ms.n_verts; ++v)
         {
-            for (int c = 0; c < Constants::RENDER_COVERAGE_COLUMNS; ++c)
+            const auto *lp = reinterpret_cast<const float *>(ms.pos + static_cast<size_t>(v) * ms.stride);
+            float x = lp[0], y = lp[1], z = lp[2];
+            if (tm != nullptr)
+            {
+                const float lx = x, ly = y, lz = z;
+                x = tm[0] * lx + tm[1] * ly + tm[2] * lz + tm[3];
+                y = tm[4] * lx + tm[5] * ly + tm[6] * lz + tm[7];
+                z = tm[8] * lx + tm[9] * ly + tm[10] * lz + tm[11];
+            }
+            if (cell <= 0.0f)
             {
-                if (!cell[b][c])
+                if (px.n_verts >= k_proxy_vert_cap)
                 {
                     return false;
                 }
+                s_proxy_vmap[v] = px.n_verts;
+                px.verts[px.n_verts * 3 + 0] = x;
+                px.verts[px.n_verts * 3 + 1] = y;
+                px.verts[px.n_verts * 3 + 2] = z;
+                ++px.n_verts;
+                continue;
+            }
+            // key 0 marks an empty table slot, hence the +1.
+            const std::uint64_t key = ((cluster_axis(x, inv_cell) << 42) | (cluster_axis(y, inv_cell) << 21) |
+                                       cluster_axis(z, inv_cell)) +
+                                      1;
+            std::uint32_t h = static_cast<std::uint32_t>((key * 0x9E3779B97F4A7C15ull) >> 40) & (k_cluster_table - 1);
+            while (s_cluster_key[h] != 0 && s_cluster_key[h] != key)
+            {
+                h = (h + 1) & (k_cluster_table - 1);
             }
+            if (s_cluster_key[h] == 0)
+            {
+                if (px.n_verts >= k_proxy_vert_cap)
+                {
+                    return false; // table load stays <= 1/4, so the probe above always finds a slot
+                }
+                s_cluster_key[h] = key;
+                s_cluster_vert[h] = px.n_verts;
+                s_cluster_sum[px.n_verts * 3 + 0] = 0.0f;
+                s_cluster_sum[px.n_verts * 3 + 1] = 0.0f;
+                s_cluster_sum[px.n_verts * 3 + 2] = 0.0f;
+                s_cluster_count[px.n_verts] = 0;
+                ++px.n_verts;
+            }
+            const int pv = s_cluster_vert[h];
+            s_cluster_sum[pv * 3 + 0] += x;
+            s_cluster_sum[pv * 3 + 1] += y;
+            s_cluster_sum[pv * 3 + 2] += z;
+            ++s_cluster_count[pv];
+            s_proxy_vmap[v] = pv;
+        }
+        const int n_src_tris = ms.n_indices / 3;
+        for (int t = 0; t < n_src_tris; ++t)
+        {
+            const int i0 = ms.indices[t * 3 + 0], i1 = ms.indices[t * 3 + 1], i2 = ms.indices[t * 3 + 2];
+            if (i0 >= ms.n_verts || i1 >= ms.n_verts || i2 >= ms.n_verts)
+            {
+                continue;
+            }
+            const int a = s_proxy_vmap[i0], b = s_proxy_vmap[i1], c = s_proxy_vmap[i2];
+            if (a == b || b == c || a == c)
+            {
+                continue; // collapsed into a cluster edge / point: covers nothing
+            }
+            if (px.n_tris >= k_proxy_tri_cap)
+            {
+                return false;
+            }
+            px.tris[px.n_tris * 3 + 0] = static_cast<std::uint16_t>(a);
+            px.tris[px.n_tris * 3 + 1] = static_cast<std::uint16_t>(b);
+            px.tris[px.n_tris * 3 + 2] = static_cast<std::uint16_t>(c);
+            ++px.n_tris;
         }
         return true;
     }
 
-    static bool rasterize_compound(void *statobj, const float *brush_m, const CoverageProjection &P,
-                                   bool cell[4][Constants::RENDER_COVERAGE_COLUMNS], uintptr_t mod_lo,
+    // One build attempt of @p statobj's proxy at clustering @p cell (0 = lossless). -1 = no proxy possible (an
+    // unreadable mesh), 0 = overflow (retry coarser), 1 = built. POD body (runs in the caller's SEH frame).
+    static int proxy_build_attempt(OccluderProxy &px, void *statobj, void *rmesh, float cell, uintptr_t mod_lo,
                                    uintptr_t mod_hi)
     {
+        px.n_verts = 0;
+        px.n_tris = 0;
+        if (cell > 0.0f)
+        {
+            std::memset(s_cluster_key, 0, sizeof(s_cluster_key));
+        }
+        if (rmesh != nullptr)
+        {
+            MeshStreams ms{};
+            if (!fetch_mesh_streams(rmesh, mod_lo, mod_hi, ms) || ms.indices == nullptr)
+            {
+                return -1;
+            }
+            return proxy_fold_mesh(px, ms, nullptr, cell) ? 1 : 0;
+        }
+        // Compound: fold each sibling-CStatObj child sub-mesh through its sub-object transform (the same walk and
+        // screening as rasterize_compound, one level deep).
         auto *sb = reinterpret_cast<std::byte *>(statobj);
         const uintptr_t self_vt = *reinterpret_cast<uintptr_t *>(sb);
-        const uintptr_t begin = *reinterpret_cast<uintptr_t *>(sb + Constants::STATOBJ_SUBOBJ_BEGIN_OFFSET);
-        const uintptr_t end = *reinterpret_cast<uintptr_t *>(sb + Constants::STATOBJ_SUBOBJ_END_OFFSET);
-        if (begin == 0 || end <= begin || !DMK::Memory::plausible_userspace_ptr(begin) ||
-            (end - begin) % Constants::SUBOBJ_STRIDE != 0)
+        if (px.sub_begin == 0 || px.sub_end <= px.sub_begin || !DMK::Memory::plausible_userspace_ptr(px.sub_begin) ||
+            (px.sub_end - px.sub_begin) % Constants::SUBOBJ_STRIDE != 0)
         {
-            return false; // not a populated sub-object vector (drift / simple statobj streamed out)
+            return -1;
         }
-        int count = static_cast<int>((end - begin) / Constants::SUBOBJ_STRIDE);
-        if (count > Constants::SUBOBJ_MAX)
+        int count = static_cast<int>((px.sub_end - px.sub_begin) / Constants::SUBOBJ_STRIDE);
+        count = std::min(count, Constants::SUBOBJ_MAX);
+        bool any = false;
+        for (int i = 0; i < count; ++i)
         {
-            count = Constants::SUBOBJ_MAX;
+            auto *so =
+                reinterpret_cast<std::byte *>(px.sub_begin + static_cast<uintptr_t>(i) * Constants::SUBOBJ_STRIDE);
+            void *child = *reinterpret_cast<void **>(so + Constants::SUBOBJ_PSTATOBJ_OFFSET);
+            if (child == nullptr || !DMK::Memory::plausible_userspace_ptr(reinterpret_cast<uintptr_t>(child)) ||
+                *reinterpret_cast<uintptr_t *>(child) != self_vt)
+            {
+                continue;
+            }
+            void *child_rmesh = *reinterpret_cast<void **>(reinterpret_cast<std::byte *>(child) +
+                                                           Constants::STATOBJ_RENDERMESH_OFFSET);
+            if (child_rmesh == nullptr)
+            {
+                continue;
+            }
+            MeshStreams ms{};
+            if (!fetch_mesh_streams(child_rmesh, mod_lo, mod_hi, ms) || ms.indices == nullptr)
+            {
+                return -1; // one unreadable child: keep the direct raster (its vertex fallback) for the whole object
+            }
+            if (!proxy_fold_mesh(px, ms, reinterpret_cast<const float *>(so + Constants::SUBOBJ_TM_OFFSET), cell))
+            {
+                return 0;
+            }
+            any = true;
+        }
+        return any ? 1 : -1;
+    }
+
+    // The Ready proxy of @p statobj, building it on first use; nullptr when the object has no proxy (unreadable,
+    // too dense, or a fault mid-build -- the slot stays non-Ready) and the caller rasterizes the engine mesh.
+    // POD body (runs in the caller's SEH frame).
+    static const OccluderProxy *occluder_proxy(void *statobj, uintptr_t mod_lo, uintptr_t mod_hi)
+    {
+        auto *sb = reinterpret_cast<std::byte *>(statobj);
+        void *rmesh = *reinterpret_cast<void **>(sb + Constants::STATOBJ_RENDERMESH_OFFSET);
+        const uintptr_t sub_begin =
+            (rmesh == nullptr) ? *reinterpret_cast<uintptr_t *>(sb + Constants::STATOBJ_SUBOBJ_BEGIN_OFFSET) : 0;
+        const uintptr_t sub_end =
+            (rmesh == nullptr) ? *reinterpret_cast<uintptr_t *>(sb + Constants::STATOBJ_SUBOBJ_END_OFFSET) : 0;
+        ++s_proxy_tick;
+
+        int victim = 0;
+        for (int i = 0; i < k_proxy_slots; ++i)
+        {
+            OccluderProxy &px = s_proxies[i];
+            if (px.state != ProxyState::Empty && px.statobj == statobj)
+            {
+                if (px.rmesh == rmesh && px.sub_begin == sub_begin && px.sub_end == sub_end)
+                {
+                    px.stamp = s_proxy_tick;
+                    return (px.state == ProxyState::Ready) ? &px : nullptr;
+                }
+                victim = i; // same statobj, new streams (LOD swap / re-stream): rebuild in place
+                break;
+            }
+            if (px.state == ProxyState::Empty ||
+                (s_proxies[victim].state != ProxyState::Empty && px.stamp < s_proxies[victim].stamp))
+            {
+                victim = i;
+            }
+        }
+
+        OccluderProxy &px = s_proxies[victim];
+        px.state = ProxyState::Empty; // not Ready until the build completes (a fault mid-build leaves it Empty)
+        px.statobj = statobj;
+        px.rmesh = rmesh;
+        px.sub_begin = sub_begin;
+        px.sub_end = sub_end;
+        px.stamp = s_proxy_tick;
+        float cell = 0.0f;
+        for (int attempt = 0; attempt <= k_proxy_attempts; ++attempt)
+        {
+            const int r = proxy_build_attempt(px, statobj, rmesh, cell, mod_lo, mod_hi);
+            if (r < 0)
+            {
+                return nullptr; // left Empty: re-tried next time (an index stream that flickers unreadable)
+            }
+            if (r > 0)
+            {
+                if (cell > 0.0f)
+                {
+                    for (int v = 0; v < px.n_verts; ++v)
+                    {
+                        const float inv = 1.0f / static_cast<float>(s_cluster_count[v]);
+                        px.verts[v * 3 + 0] = s_cluster_sum[v * 3 + 0] * inv;
+                        px.verts[v * 3 + 1] = s_cluster_sum[v * 3 + 1] * inv;
+                        px.verts[v * 3 + 2] = s_cluster_sum[v * 3 + 2] * inv;
+                    }
+                }
+                px.state = ProxyState::Ready;
+                return &px;
+            }
+            cell = (cell > 0.0f) ? cell * 2.0f : k_proxy_first_cell;
+        }
+        px.state = ProxyState::Uncacheable;
+        return nullptr;
+    }
+
+    static float brush_char_coverage(void *node, Vector3 pivot, Vector3 camera, uintptr_t mod_lo, uintptr_t mod_hi,
+                                     float *out_head_fill = nullptr, float stop_at = k_cov_no_early_out)
+    {
+        if (out_head_fill != nullptr)
+        {
+            *out_head_fill = -1.0f; // unmeasurable until a readable mesh is rasterized
+        }
+        auto *bytes = reinterpret_cast<std::byte *>(node);
+        void *statobj = *reinterpret_cast<void **>(bytes + Constants::CBRUSH_STATOBJ_OFFSET);
+        if (statobj == nullptr)
+        {
+            return k_coverage_unavailable;
+        }
+        const CoverageProjection P = make_coverage_projection(pivot, camera);
+        if (!P.valid)
+        {
+            return k_coverage_unavailable; // camera on the character / degenerate box: defer to physics
         }
+        const float *brush_m = reinterpret_cast<const float *>(bytes + Constants::CBRUSH_MATRIX_OFFSET);
+        CoverageMask mask = make_coverage_mask(stop_at);
+
+        void *rmesh =
+            *reinterpret_cast<void **>(reinterpret_cast<std::byte *>(statobj) + Constants::STATOBJ_RENDERMESH_OFFSET);
         bool measured = false;
-        for (int i = 0; i < count; ++i)
+        if (const OccluderProxy *px = occluder_proxy(statobj, mod_lo, mod_hi); px != nullptr)
+        {
+            // Cached statobj-local proxy (see OccluderProxy): same raster, no engine mesh reads.
+            MeshStreams ms{};
+            ms.pos = reinterpret_cast<const std::uint8_t *>(px->verts);
+            ms.stride = 3 * sizeof(float);
+            ms.n_verts = px->n_verts;
+            ms.indices = px->tris;
+            ms.n_indices = px->n_tris * 3;
+            rasterize_stream(ms, brush_m, P, mask);
+            measured = true;
+        }
+        else if (rmesh != nullptr)
+        {
+            measured = rasterize_mesh(rmesh, brush_m, P, mask, mod_lo, mod_hi);
+        }
+        else
+        {
+            // Compound statobj (root mesh null): a fence / gate / drying-rack .cgf whose rails live in child
+            // sub-meshes. Rasterize them so the open GAPS between rails register, instead of bailing to the
+            // physics-ray fallback that reads a see-through structure's collision proxy as near-solid.
+            measured = rasterize_compound(statobj, brush_m, P, mask, mod_lo, mod_hi);
+        }
+        if (!measured)
+        {
+            return k_coverage_unavailable; // no readable mesh (terrain / pure-physics / freed): defer to physics
+        }
+
+        // Head-weighted coverage (k_char_level_weight): a wide obstruction over the upper body collides; a thin
+        // pole, a scattered prop, or an open-rail fence the body shows through does not. With an early stop_at the
+        // value is a lower bound that already reaches stop_at, which is all a threshold caller compares.
+        if (out_head_fill != nullptr)
+        {
+            *out_head_fill = band_fill(mask, 0); // top band = head silhouette fill, for the head-visible gate
+        }
+        return mask_coverage(mask);
+    }
+
+    // ---- Render-node region cache ------------------------------------------------------------------------------
+    // GetObjectsInBox is the dominant per-frame collision cost (~110 us, ~75x a single ray), and both the roof
+    // clamp and the hit-point coverage query re-run it for boxes that barely move while the camera arm stays in
+    // one place. So one query is issued for the requested box padded by RENDER_REGION_PAD, every returned node's
+    // AABB is captured, and a BVH over them answers each later box query that lies inside the region: the nodes
+    // whose AABB overlaps the box -- the same set GetObjectsInBox would return for it, since the octree query is
+    // an AABB-overlap query too. The octree is re-queried only when a box leaves the region or it ages out
+    // (RENDER_REGION_MAX_AGE_MS, for streaming). Node pointers are held across frames exactly as the coverage
+    // cache holds its render node: each one handed out is re-screened (vtable in the game image) and the callers
+    // re-read flags / bbox under their own SEH frames. POD static storage, render thread only.
+    static constexpr int k_region_cap = Constants::RENDER_OCCLUSION_MAX_NODES;
+    static constexpr int k_bvh_leaf = 4;
+
+    struct RegionBvhNode
+    {
+        float lo[3];
+        float hi[3];
+        int first; // leaf: first index into s_region_order; inner: left child (right child = first + 1)
+        int count; // leaf: node count; inner: 0
+    };
+
+    static bool s_region_valid = false;
+    static float s_region_box[6] = {};
+    static unsigned long long s_region_built_ms = 0;
+    static unsigned long long s_region_used_ms = 0; // last region_query call; only it stamps (prefetch keys on it)
+    static bool s_octree_busy_frame = false;        // an octree query ran this frame (prefetch defers a frame)
+    static bool s_octree_overflowed = false;        // the last octree query returned more than the node cap
+    static unsigned long long s_region_dense_until_ms = 0; // padded query overflowed: query exact boxes until then
+    static void *s_region_p3d = nullptr;
+    static int s_region_count = 0;
+    static void *s_region_nodes[k_region_cap];
+    static float s_region_aabb[k_region_cap][6];
+    static int s_region_order[k_region_cap];
+    static RegionBvhNode s_region_bvh[2 * k_region_cap];
+    static int s_region_bvh_size = 0;
+
+    // Single-frame octree query of @p bbox into @p out (capacity RENDER_OCCLUSION_MAX_NODES). Returns the count, or
+    // 0 on none / overflow. Unguarded: see octree_query.
+    static std::uint32_t octree_query_raw(void *p3d, GetObjectsInBoxFn query, const float *bbox, void **out) noexcept
+    {
+        const std::uint32_t count = query(p3d, bbox, nullptr);
+        s_octree_overflowed = count > static_cast<std::uint32_t>(Constants::RENDER_OCCLUSION_MAX_NODES);
+        if (count == 0 || s_octree_overflowed)
         {
-            if (grid_full(cell))
+            return 0;
+        }
+        query(p3d, bbox, out);
+        return count;
+    }
+
+    // octree_query_raw under its own SEH frame; a fault returns 0. POD body.
+    static std::uint32_t octree_query_guarded(void *p3d, GetObjectsInBoxFn query, const float *bbox,
+                                              void **out) noexcept
+    {
+        __try
+        {
+            return octree_query_raw(p3d, query, bbox, out);
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return 0;
+        }
+    }
+
+    // The octree query, inline inside a region body (seh_region.hpp) and self-guarded otherwise. The per-node
+    // guards below stay self-guarded in both modes: a streamed-out node faulting is an ordinary outcome there.
+    static std::uint32_t octree_query(void *p3d, GetObjectsInBoxFn query, const float *bbox, void **out) noexcept
+    {
+        return SehRegion::active() ? octree_query_raw(p3d, query, bbox, out)
+                                   : octree_query_guarded(p3d, query, bbox, out);
+    }
+
+    // World AABB of render node @p node via its GetBBox slot; false on a null / out-of-image vtable or a fault.
+    static bool node_bbox_guarded(void *node, uintptr_t mod_lo, uintptr_t mod_hi, float *out) noexcept
+    {
+        __try
+        {
+            void **vt = *reinterpret_cast<void ***>(node);
+            const auto vtaddr = reinterpret_cast<uintptr_t>(vt);
+            if (vtaddr < mod_lo || vtaddr >= mod_hi)
+            {
+                return false;
+            }
+            const auto get_bbox = reinterpret_cast<GetBBoxFn>(vt[Constants::RENDERNODE_VTABLE_GETBBOX_OFFSET / 8]);
+            float aabb[6] = {};
+            const float *b = reinterpret_cast<const float *>(get_bbox(node, aabb));
+            if (b == nullptr)
+            {
+                return false;
+            }
+            for (int k = 0; k < 6; ++k)
+            {
+                out[k] = b[k];
+            }
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    // Whether @p node still reads as a render node of the game image (a cached node freed by streaming faults here
+    // or holds a foreign / garbage first qword).
+    static bool node_in_image_guarded(void *node, uintptr_t mod_lo, uintptr_t mod_hi) noexcept
+    {
+        __try
+        {
+            const auto vtaddr = *reinterpret_cast<const uintptr_t *>(node);
+            return vtaddr >= mod_lo && vtaddr < mod_hi;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    // Top-down median-split build over s_region_order[first, first + count) (longest centroid axis). Iterative:
+    // the recursion depth is log2(k_region_cap / k_bvh_leaf), but a worklist keeps the stack flat anyway.
+    static void build_region_bvh()
+    {
+        s_region_bvh_size = 0;
+        if (s_region_count == 0)
+        {
+            return;
+        }
+        struct Pending
+        {
+            int node;
+            int first;
+            int count;
+        };
+        Pending work[64];
+        int n_work = 0;
+        s_region_bvh_size = 1;
+        work[n_work++] = {0, 0, s_region_count};
+        while (n_work > 0)
+        {
+            const Pending w = work[--n_work];
+            RegionBvhNode &bn = s_region_bvh[w.node];
+            float clo[3] = {1e30f, 1e30f, 1e30f}, chi[3] = {-1e30f, -1e30f, -1e30f};
+            for (int k = 0; k < 3; ++k)
+            {
+                bn.lo[k] = 1e30f;
+                bn.hi[k] = -1e30f;
+            }
+            for (int i = w.first; i < w.first + w.count; ++i)
             {
-                break; // silhouette already fully covered -> remaining sub-meshes cannot change the result
+                const float *a = s_region_aabb[s_region_order[i]];
+                for (int k = 0; k < 3; ++k)
+                {
+                    bn.lo[k] = std::min(bn.lo[k], a[k]);
+                    bn.hi[k] = std::max(bn.hi[k], a[k + 3]);
+                    const float c = 0.5f * (a[k] + a[k + 3]);
+                    clo[k] = std::min(clo[k], c);
+                    chi[k] = std::max(chi[k], c);
+                }
             }
-            auto *so = reinterpret_cast<std::byte *>(begin + static_cast<uintptr_t>(i) * Constants::SUBOBJ_STRIDE);
-            void *child = *reinterpret_cast<void **>(so + Constants::SUBOBJ_PSTATOBJ_OFFSET);
-            if (child == nullptr || !DMK::Memory::plausible_userspace_ptr(reinterpret_cast<uintptr_t>(child)) ||
-                *reinterpret_cast<uintptr_t *>(child) != self_vt)
+            if (w.count <= k_bvh_leaf || n_work + 2 > static_cast<int>(std::size(work)))
             {
-                continue; // not a sibling CStatObj -> skip (also rejects garbage at a non-compound vector offset)
+                bn.first = w.first;
+                bn.count = w.count;
+                continue;
             }
-            void *child_rmesh = *reinterpret_cast<void **>(reinterpret_cast<std::byte *>(child) +
-                                                           Constants::STATOBJ_RENDERMESH_OFFSET);
-            if (child_rmesh == nullptr)
+            int axis = 0;
+            for (int k = 1; k < 3; ++k)
             {
-                continue; // a nested-compound child is not recursed (one level covers these props)
+                if (chi[k] - clo[k] > chi[axis] - clo[axis])
+                {
+                    axis = k;
+                }
             }
-            float world_m[12];
-            mat34_compose(brush_m, reinterpret_cast<const float *>(so + Constants::SUBOBJ_TM_OFFSET), world_m);
-            measured = rasterize_mesh(child_rmesh, world_m, P, cell, mod_lo, mod_hi) || measured;
+            const int half = w.count / 2;
+            std::nth_element(s_region_order + w.first, s_region_order + w.first + half,
+                             s_region_order + w.first + w.count, [axis](int a, int b)
+                             { return s_region_aabb[a][axis] + s_region_aabb[a][axis + 3] <
+                                      s_region_aabb[b][axis] + s_region_aabb[b][axis + 3]; });
+            const int left = s_region_bvh_size;
+            s_region_bvh_size += 2;
+            bn.first = left;
+            bn.count = 0;
+            work[n_work++] = {left, w.first, half};
+            work[n_work++] = {left + 1, w.first + half, w.count - half};
         }
-        return measured;
     }
 
-    static float brush_char_coverage(void *node, Vector3 pivot, Vector3 camera, uintptr_t mod_lo, uintptr_t mod_hi,
-                                     float *out_head_fill = nullptr)
+    static bool box_inside(const float *inner, const float *outer)
     {
-        if (out_head_fill != nullptr)
+        return inner[0] >= outer[0] && inner[1] >= outer[1] && inner[2] >= outer[2] && inner[3] <= outer[3] &&
+               inner[4] <= outer[4] && inner[5] <= outer[5];
+    }
+
+    // Re-queries the octree for @p bbox padded by RENDER_REGION_PAD and rebuilds the region BVH over the result.
+    // The query lands in frame scratch first, so on an empty, overflowing or faulting padded query (false) the
+    // current region is left exactly as it was; the caller decides whether that one may still serve.
+    static bool rebuild_region(void *p3d, GetObjectsInBoxFn query, const float *bbox, uintptr_t mod_lo,
+                               uintptr_t mod_hi, unsigned long long now)
+    {
+        s_octree_busy_frame = true;
+        float padded[6];
+        for (int k = 0; k < 3; ++k)
         {
-            *out_head_fill = -1.0f; // unmeasurable until a readable mesh is rasterized
+            padded[k] = bbox[k] - Constants::RENDER_REGION_PAD;
+            padded[k + 3] = bbox[k + 3] + Constants::RENDER_REGION_PAD;
         }
-        auto *bytes = reinterpret_cast<std::byte *>(node);
-        void *statobj = *reinterpret_cast<void **>(bytes + Constants::CBRUSH_STATOBJ_OFFSET);
-        if (statobj == nullptr)
+        const FrameArena::Rewind scratch;
+        const std::span<void *> nodes = FrameArena::take<void *>(k_region_cap);
+        const std::uint32_t n = nodes.empty() ? 0 : octree_query(p3d, query, padded, nodes.data());
+        if (n == 0)
         {
-            return k_coverage_unavailable;
+            return false;
         }
-        const CoverageProjection P = make_coverage_projection(pivot, camera);
-        if (!P.valid)
+        s_region_count = 0;
+        for (std::uint32_t i = 0; i < n; ++i)
         {
-            return k_coverage_unavailable; // camera on the character / degenerate box: defer to physics
+            void *node = nodes[i];
+            if (node != nullptr && node_bbox_guarded(node, mod_lo, mod_hi, s_region_aabb[s_region_count]))
+            {
+                s_region_nodes[s_region_count] = node;
+                s_region_order[s_region_count] = s_region_count;
+                ++s_region_count;
+            }
         }
-        const float *brush_m = reinterpret_cast<const float *>(bytes + Constants::CBRUSH_MATRIX_OFFSET);
-        bool cell[4][Constants::RENDER_COVERAGE_COLUMNS] = {};
+        build_region_bvh();
+        std::memcpy(s_region_box, padded, sizeof(s_region_box));
+        s_region_p3d = p3d;
+        s_region_built_ms = now;
+        s_region_valid = true;
+        return true;
+    }
 
-        void *rmesh =
-            *reinterpret_cast<void **>(reinterpret_cast<std::byte *>(statobj) + Constants::STATOBJ_RENDERMESH_OFFSET);
-        bool measured = false;
-        if (rmesh != nullptr)
-        {
-            measured = rasterize_mesh(rmesh, brush_m, P, cell, mod_lo, mod_hi);
-        }
-        else
+    // GetObjectsInBox for @p bbox, answered from the region BVH when @p bbox lies inside a fresh region of the same
+    // 3DEngine, else by re-querying the octree for the padded box (falling back to the exact box when the padded
+    // one fails). A padded box that overflows RENDER_OCCLUSION_MAX_NODES marks the area too dense for a region for
+    // RENDER_REGION_MAX_AGE_MS: until then each box goes straight to the exact query, so the octree is walked for
+    // the padded box once per window rather than on every call. Fills @p out (capacity RENDER_OCCLUSION_MAX_NODES)
+    // and returns the count; 0 = none / fault.
+    static std::uint32_t region_query(void *p3d, GetObjectsInBoxFn query, const float *bbox, uintptr_t mod_lo,
+                                      uintptr_t mod_hi, void **out)
+    {
+        const unsigned long long now = GetTickCount64();
+        s_region_used_ms = now;
+        if (!s_region_valid || s_region_p3d != p3d || now - s_region_built_ms > Constants::RENDER_REGION_MAX_AGE_MS ||
+            !box_inside(bbox, s_region_box))
         {
-            // Compound statobj (root mesh null): a fence / gate / drying-rack .cgf whose rails live in child
-            // sub-meshes. Rasterize them so the open GAPS between rails register, instead of bailing to the
-            // physics-ray fallback that reads a see-through structure's collision proxy as near-solid.
-            measured = rasterize_compound(statobj, brush_m, P, cell, mod_lo, mod_hi);
+            s_region_valid = false; // stale for this box whatever the rebuild finds
+            if (now < s_region_dense_until_ms)
+            {
+                return octree_query(p3d, query, bbox, out); // too dense for a region: the exact box only
+            }
+            s_octree_overflowed = false;
+            if (!rebuild_region(p3d, query, bbox, mod_lo, mod_hi, now))
+            {
+                // Empty, overflowing or faulting padded query: answer this one box directly. An empty or faulting
+                // one retries the region on the next call; an overflowing one not before the dense window ends.
+                if (s_octree_overflowed)
+                {
+                    s_region_dense_until_ms = now + Constants::RENDER_REGION_MAX_AGE_MS;
+                }
+                return octree_query(p3d, query, bbox, out);
+            }
         }
-        if (!measured)
+
+        std::uint32_t count = 0;
+        if (s_region_bvh_size == 0)
         {
-            return k_coverage_unavailable; // no readable mesh (terrain / pure-physics / freed): defer to physics
+            return 0;
         }
-
-        // Head-weighted coverage: each band's filled-column fraction, weighted head->feet (a real TPV camera
-        // protects the head / look-at socket, not the legs). A wide obstruction over the upper body collides; a
-        // thin pole, a scattered prop, or an open-rail fence the body shows through does not.
-        static const float k_char_level_weight[4] = {1.0f, 0.8f, 0.45f, 0.2f}; // head, chest, hips, shins
-        float wsum = 0.0f, wov = 0.0f;
-        for (int b = 0; b < 4; ++b)
+        int stack[64];
+        int sp = 0;
+        stack[sp++] = 0;
+        while (sp > 0)
         {
-            int filled = 0;
-            for (int c = 0; c < Constants::RENDER_COVERAGE_COLUMNS; ++c)
+            const RegionBvhNode &bn = s_region_bvh[stack[--sp]];
+            if (bn.hi[0] < bbox[0] || bn.lo[0] > bbox[3] || bn.hi[1] < bbox[1] || bn.lo[1] > bbox[4] ||
+                bn.hi[2] < bbox[2] || bn.lo[2] > bbox[5])
             {
-                if (cell[b][c])
+                continue;
+            }
+            if (bn.count == 0)
+            {
+                if (sp + 2 <= static_cast<int>(std::size(stack)))
                 {
-                    ++filled;
+                    stack[sp++] = bn.first;
+                    stack[sp++] = bn.first + 1;
                 }
+                continue;
             }
-            const float band_fill = static_cast<float>(filled) / static_cast<float>(Constants::RENDER_COVERAGE_COLUMNS);
-            if (b == 0 && out_head_fill != nullptr)
+            for (int i = bn.first; i < bn.first + bn.count; ++i)
             {
-                *out_head_fill = band_fill; // top band = head silhouette fill, for the head-visible gate
+                const int idx = s_region_order[i];
+                const float *a = s_region_aabb[idx];
+                if (a[3] < bbox[0] || a[0] > bbox[3] || a[4] < bbox[1] || a[1] > bbox[4] || a[5] < bbox[2] ||
+                    a[2] > bbox[5])
+                {
+                    continue;
+                }
+                if (node_in_image_guarded(s_region_nodes[idx], mod_lo, mod_hi))
+                {
+                    out[count++] = s_region_nodes[idx];
+                }
             }
-            wov += k_char_level_weight[b] * band_fill;
-            wsum += k_char_level_weight[b];
         }
-        return (wsum > 0.0f) ? std::min(1.0f, wov / wsum) : 0.0f;
+        return count;
     }
 
     // Identity of the overhead roof the clamp selected, captured for trace logging so false positives (a
@@ -700,10 +1858,11 @@ namespace TPVCamera
      *        the structured handler shares no frame with C++ unwinding; any fault becomes "no occluder". Returns
      *        the SMALLEST clear distance along the pivot->camera arm over every brush whose cloth lies on the
      *        sightline (k_cloth_unavailable when none do). Fills @p out_hit with the binding brush's identity.
+     *        @p nodes is the caller's frame-arena node list (capacity RENDER_OCCLUSION_MAX_NODES).
      */
     static float nearest_sightline_block_guarded(void *p3d, GetObjectsInBoxFn query, const float *bbox, Vector3 pivot,
                                                  Vector3 camera, uintptr_t mod_lo, uintptr_t mod_hi, float cov_thresh,
-                                                 RoofHitInfo *out_hit) noexcept
+                                                 void **nodes, RoofHitInfo *out_hit) noexcept
     {
         float best_dist = k_cloth_unavailable;
         __try
@@ -718,15 +1877,13 @@ namespace TPVCamera
             dir.y /= arm_len;
             dir.z /= arm_len;
 
-            const std::uint32_t count = query(p3d, bbox, nullptr);
-            if (count == 0 || count > static_cast<std::uint32_t>(Constants::RENDER_OCCLUSION_MAX_NODES))
+            // Candidate nodes from the region BVH (re-querying the octree only when the arm left the region).
+            const std::uint32_t count = region_query(p3d, query, bbox, mod_lo, mod_hi, nodes);
+            if (count == 0)
             {
                 return k_cloth_unavailable;
             }
 
-            void *nodes[Constants::RENDER_OCCLUSION_MAX_NODES];
-            query(p3d, bbox, nodes);
-
             for (std::uint32_t i = 0; i < count; ++i)
             {
                 void *node = nodes[i];
@@ -810,9 +1967,9 @@ namespace TPVCamera
                     // thin prop does not. Only a MEASURED low coverage skips -- an unreadable mesh (cloth often
                     // is) returns < 0 and keeps the clamp, so canopies are never dropped by a failed measurement.
                     float cov = -1.0f;
-                    if (cov_thresh > 0.0f && player_screen_bounds().valid)
+                    if (cov_thresh > 0.0f && player_world_bounds().valid)
                     {
-                        cov = brush_char_coverage(node, pivot, camera, mod_lo, mod_hi);
+                        cov = brush_char_coverage(node, pivot, camera, mod_lo, mod_hi, nullptr, cov_thresh);
                         if (cov >= 0.0f && cov < cov_thresh)
                         {
                             continue; // thin prop -> body visible past it -> no render-occlusion clamp
@@ -934,12 +2091,379 @@ namespace TPVCamera
         return false;
     }
 
+    // ---- Brush classification cache ------------------------------------------------------------------------------
+    // What the octree loops need to know about a brush's statobj before any geometry work, computed on first sight
+    // instead of per node per query: the name-derived class (copy_brush_name plus the HLOD / wall-opening scans),
+    // whether the root render mesh is null (a compound), and the root mesh's vertex / index counts and LOCAL bounds.
+    // The path of a live statobj never changes; the mesh fields are tied to the root mesh pointer they were read
+    // from, so a streamed / swapped LOD re-reads them on its next probe. Index readability is deliberately NOT
+    // cached -- a freed index stream keeps its pointer (see indices_readable), so the raster still probes it.
+    // Flat open-addressed table keyed by the statobj pointer (linear probe, never deletes), cleared wholesale on a
+    // world load (world_load_generation) or once it is three-quarters full. POD static pool, render thread only.
+    static constexpr int k_brush_class_slots = 1024; // power of two
+    static constexpr int k_brush_class_max_fill = k_brush_class_slots * 3 / 4;
+    static constexpr std::uint8_t k_brush_hlod = 0x01;          // "hlod" in the path: building-scale merged proxy
+    static constexpr std::uint8_t k_brush_wall_opening = 0x02;  // window / hole frame embedded in a wall
+    static constexpr std::uint8_t k_brush_compound = 0x04;      // null root mesh: the geometry is in the sub-objects
+    static constexpr std::uint8_t k_brush_mesh_readable = 0x08; // root position stream readable; counts/bounds valid
+
+    struct BrushClass
+    {
+        void *statobj;           // key; nullptr = empty slot
+        void *rmesh;             // root mesh the mesh fields were read from
+        std::uint64_t path_hash; // OccluderDb key of the .cgf path; 0 = nameless
+        std::uint8_t flags;
+        int n_verts;
+        int n_indices;
+        float local_min[3];
+        float local_max[3];
+    };
+
+    static BrushClass s_brush_class[k_brush_class_slots];
+    static int s_brush_class_fill = 0;
+    static std::uint32_t s_brush_class_generation = 0;
+
+    // (Re)reads the mesh fields of @p bc from root mesh @p rmesh: the counts and the local bounds of the position
+    // stream (one scan, on first sight or after a LOD swap). A mesh the occluder database already knows by path and
+    // counts takes its bounds from the record and skips the scan; a scanned one is handed to the database for the
+    // next session. An unreadable position stream is remembered as such for this rmesh -- the index stream is the
+    // one that flickers, not the positions. POD body (runs in the caller's SEH frame); bc.rmesh is written last, so
+    // a fault mid-read re-reads on the next probe.
+    static void brush_class_read_mesh(BrushClass &bc, void *rmesh, uintptr_t mod_lo, uintptr_t mod_hi)
+    {
+        bc.flags = static_cast<std::uint8_t>(bc.flags & ~(k_brush_compound | k_brush_mesh_readable));
+        bc.n_verts = 0;
+        bc.n_indices = 0;
+        MeshStreams ms;
+        if (rmesh == nullptr)
+        {
+            bc.flags |= k_brush_compound;
+        }
+        else if (fetch_mesh_streams(rmesh, mod_lo, mod_hi, ms))
+        {
+            const int n_indices =
+                *reinterpret_cast<int *>(reinterpret_cast<std::byte *>(rmesh) + Constants::RENDERMESH_NINDICES_OFFSET);
+            OccluderDb::Proxy known;
+            if (OccluderDb::find(bc.path_hash, ms.n_verts, n_indices, known))
+            {
+                for (int a = 0; a < 3; ++a)
+                {
+                    bc.local_min[a] = known.local_min[a];
+                    bc.local_max[a] = known.local_max[a];
+                }
+                bc.n_verts = ms.n_verts;
+                bc.n_indices = n_indices;
+                bc.flags |= k_brush_mesh_readable;
+                bc.rmesh = rmesh;
+                return;
+            }
+            float lo[3] = {1e30f, 1e30f, 1e30f};
+            float hi[3] = {-1e30f, -1e30f, -1e30f};
+            for (int v = 0; v < ms.n_verts; ++v)
+            {
+                const auto *lp = reinterpret_cast<const float *>(ms.pos + static_cast<size_t>(v) * ms.stride);
+                for (int a = 0; a < 3; ++a)
+                {
+                    lo[a] = (lp[a] < lo[a]) ? lp[a] : lo[a];
+                    hi[a] = (lp[a] > hi[a]) ? lp[a] : hi[a];
+                }
+            }
+            for (int a = 0; a < 3; ++a)
+            {
+                bc.local_min[a] = lo[a];
+                bc.local_max[a] = hi[a];
+            }
+            bc.n_verts = ms.n_verts;
+            bc.n_indices = n_indices;
+            bc.flags |= k_brush_mesh_readable;
+            OccluderDb::Proxy measured;
+            measured.flags = bc.flags;
+            for (int a = 0; a < 3; ++a)
+            {
+                measured.local_min[a] = lo[a];
+                measured.local_max[a] = hi[a];
+            }
+            OccluderDb::learn(bc.path_hash, ms.n_verts, n_indices, measured);
+        }
+        bc.rmesh = rmesh;
+    }
+
+    // The cached class of @p statobj, filling its slot on first sight; nullptr for a null statobj. One pointer read
+    // (the root mesh, to catch a LOD swap) plus the probe on a hit. POD body (runs in the caller's SEH frame); the
+    // key is written last, so a statobj that faults mid-fill leaves its slot empty.
+    static const BrushClass *brush_class(void *statobj, uintptr_t mod_lo, uintptr_t mod_hi)
+    {
+        if (statobj == nullptr)
+        {
+            return nullptr;
+        }
+        const std::uint32_t generation = world_load_generation().load(std::memory_order_relaxed);
+        if (generation != s_brush_class_generation || s_brush_class_fill >= k_brush_class_max_fill)
+        {
+            std::memset(s_brush_class, 0, sizeof(s_brush_class)); // new level (or full): statobjs may be freed
+            s_brush_class_fill = 0;
+            s_brush_class_generation = generation;
+        }
+        void *rmesh =
+            *reinterpret_cast<void **>(reinterpret_cast<std::byte *>(statobj) + Constants::STATOBJ_RENDERMESH_OFFSET);
+        const auto key = static_cast<std::uint64_t>(reinterpret_cast<uintptr_t>(statobj));
+        std::uint32_t h = static_cast<std::uint32_t>((key * 0x9E3779B97F4A7C15ull) >> 40) & (k_brush_class_slots - 1);
+        while (s_brush_class[h].statobj != nullptr)
+        {
+            BrushClass &bc = s_brush_class[h];
+            if (bc.statobj == statobj)
+            {
+                if (bc.rmesh != rmesh)
+                {
+                    brush_class_read_mesh(bc, rmesh, mod_lo, mod_hi);
+                }
+                return &bc;
+            }
+            h = (h + 1) & (k_brush_class_slots - 1);
+        }
+
+        BrushClass &bc = s_brush_class[h];
+        char name[160];
+        copy_brush_name(statobj, name, static_cast<int>(sizeof(name)));
+        bc.path_hash = OccluderDb::path_hash(name);
+        bc.flags = 0;
+        if (name_is_hlod_proxy(name))
+        {
+            bc.flags |= k_brush_hlod;
+        }
+        if (name_is_wall_opening(name))
+        {
+            bc.flags |= k_brush_wall_opening;
+        }
+        brush_class_read_mesh(bc, rmesh, mod_lo, mod_hi);
+        bc.statobj = statobj;
+        ++s_brush_class_fill;
+        return &bc;
+    }
+
+    // False if world-space @p hit is farther than @p eps outside the brush's local bounds placed by world matrix
+    // @p M (the bounds' world box: centre through M, half-extents through |R|). A conservative reject ahead of the
+    // full vertex scan, for a neighbour whose node bbox contains the hit but whose mesh cannot be near it.
+    static bool local_bounds_near(const BrushClass &bc, const float *M, Vector3 hit, float eps)
+    {
+        const float c[3] = {(bc.local_min[0] + bc.local_max[0]) * 0.5f, (bc.local_min[1] + bc.local_max[1]) * 0.5f,
+                            (bc.local_min[2] + bc.local_max[2]) * 0.5f};
+        const float e[3] = {(bc.local_max[0] - bc.local_min[0]) * 0.5f, (bc.local_max[1] - bc.local_min[1]) * 0.5f,
+                            (bc.local_max[2] - bc.local_min[2]) * 0.5f};
+        const float h[3] = {hit.x, hit.y, hit.z};
+        for (int r = 0; r < 3; ++r)
+        {
+            const float wc = M[r * 4 + 0] * c[0] + M[r * 4 + 1] * c[1] + M[r * 4 + 2] * c[2] + M[r * 4 + 3];
+            const float we = std::fabs(M[r * 4 + 0]) * e[0] + std::fabs(M[r * 4 + 1]) * e[1] +
+                             std::fabs(M[r * 4 + 2]) * e[2];
+            if (std::fabs(h[r] - wc) > we + eps)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // ---- Vertex grids -------------------------------------------------------------------------------------------
+    // mesh_has_vertex_near answers "is any vertex of this mesh within eps of the hit" for the candidate brushes of
+    // every coverage query and of render_hit_info; a direct scan of a dense prop is tens of thousands of
+    // transforms, for the same meshes frame after frame. A vertex grid is a copy of a mesh's positions bucketed by
+    // a uniform LOCAL cell (CSR: each bucket's vertices are contiguous), built on the mesh's first query. A query
+    // moves the hit into the mesh's local space and tests only the vertices of the few cells its eps box spans,
+    // with the same exact world-space distance test as the scan. Cells hash into k_vgrid_buckets; a colliding cell
+    // only adds candidates to the exact test. Keyed by the render mesh and its vertex count (a LOD swap is a new
+    // mesh); least-recently-used, emptied on a world load. Meshes over the cap keep the direct scan. POD static
+    // pool, render thread only.
+    static constexpr int k_vgrid_slots = 8;
+    static constexpr int k_vgrid_vert_cap = 16384;
+    static constexpr int k_vgrid_buckets = 4096;                       // power of two
+    static constexpr float k_vgrid_cell = Constants::COVERAGE_HIT_EPS; // local m: a unit-scale query spans 2-3 cells
+    static constexpr int k_vgrid_max_cells = 64; // a query spanning more (a tiny-scaled brush) scans the whole copy
+
+    struct VertexGrid
+    {
+        void *rmesh; // nullptr = empty slot
+        int n_verts;
+        std::uint32_t stamp;
+        int bucket_start[k_vgrid_buckets + 1];
+        float verts[k_vgrid_vert_cap * 3]; // local positions, in bucket order
+    };
+
+    static VertexGrid s_vgrids[k_vgrid_slots];
+    static std::uint32_t s_vgrid_tick = 0;
+    static std::uint32_t s_vgrid_generation = 0;
+    static int s_vgrid_bucket_of[k_vgrid_vert_cap]; // build scratch: source vertex -> bucket
+
+    // Grid cell of local coordinate @p f (clamped so a garbage position cannot overflow the int).
+    static int vgrid_cell(float f)
+    {
+        return static_cast<int>(std::floor(std::clamp(f * (1.0f / k_vgrid_cell), -1.0e6f, 1.0e6f)));
+    }
+
+    static int vgrid_bucket(int ix, int iy, int iz)
+    {
+        const std::uint32_t h = (static_cast<std::uint32_t>(ix) * 73856093u) ^
+                                (static_cast<std::uint32_t>(iy) * 19349663u) ^
+                                (static_cast<std::uint32_t>(iz) * 83492791u);
+        return static_cast<int>(h & (k_vgrid_buckets - 1));
+    }
+
+    // The grid of (@p rmesh, @p n_verts) if one is cached, else nullptr. Empties the pool on a new world load.
+    static VertexGrid *vertex_grid_find(void *rmesh, int n_verts)
+    {
+        const std::uint32_t generation = world_load_generation().load(std::memory_order_relaxed);
+        if (generation != s_vgrid_generation)
+        {
+            for (VertexGrid &g : s_vgrids)
+            {
+                g.rmesh = nullptr;
+            }
+            s_vgrid_generation = generation;
+        }
+        ++s_vgrid_tick;
+        for (VertexGrid &g : s_vgrids)
+        {
+            if (g.rmesh == rmesh && g.n_verts == n_verts)
+            {
+                g.stamp = s_vgrid_tick;
+                return &g;
+            }
+        }
+        return nullptr;
+    }
+
+    // Builds the grid of @p rmesh from its position stream into the least recently used slot (counting sort by
+    // bucket). POD body (runs in the caller's SEH frame); the key is written last, so a fault mid-build leaves the
+    // slot empty.
+    static const VertexGrid *vertex_grid_build(void *rmesh, const std::uint8_t *pos, int stride, int n_verts)
+    {
+        VertexGrid *victim = &s_vgrids[0];
+        for (VertexGrid &g : s_vgrids)
+        {
+            if (g.rmesh == nullptr)
+            {
+                victim = &g;
+                break;
+            }
+            if (g.stamp < victim->stamp)
+            {
+                victim = &g;
+            }
+        }
+        VertexGrid &g = *victim;
+        g.rmesh = nullptr;
+        std::memset(g.bucket_start, 0, sizeof(g.bucket_start));
+        for (int v = 0; v < n_verts; ++v)
+        {
+            const auto *lp = reinterpret_cast<const float *>(pos + static_cast<size_t>(v) * stride);
+            const int b = vgrid_bucket(vgrid_cell(lp[0]), vgrid_cell(lp[1]), vgrid_cell(lp[2]));
+            s_vgrid_bucket_of[v] = b;
+            ++g.bucket_start[b + 1];
+        }
+        for (int b = 0; b < k_vgrid_buckets; ++b)
+        {
+            g.bucket_start[b + 1] += g.bucket_start[b];
+        }
+        // Scatter with bucket_start[b] as the running cursor, then shift back: afterwards bucket b spans
+        // [bucket_start[b], bucket_start[b + 1]).
+        for (int v = 0; v < n_verts; ++v)
+        {
+            const auto *lp = reinterpret_cast<const float *>(pos + static_cast<size_t>(v) * stride);
+            const int at = g.bucket_start[s_vgrid_bucket_of[v]]++;
+            g.verts[at * 3 + 0] = lp[0];
+            g.verts[at * 3 + 1] = lp[1];
+            g.verts[at * 3 + 2] = lp[2];
+        }
+        for (int b = k_vgrid_buckets; b > 0; --b)
+        {
+            g.bucket_start[b] = g.bucket_start[b - 1];
+        }
+        g.bucket_start[0] = 0;
+        g.n_verts = n_verts;
+        g.stamp = s_vgrid_tick;
+        g.rmesh = rmesh;
+        return &g;
+    }
+
+    // True if local vertex @p lp, placed by world matrix @p M, lies within sqrt(@p eps2) of @p hit.
+    static bool vertex_near(const float *lp, const float *M, Vector3 hit, float eps2)
+    {
+        const float wx = M[0] * lp[0] + M[1] * lp[1] + M[2] * lp[2] + M[3];
+        const float wy = M[4] * lp[0] + M[5] * lp[1] + M[6] * lp[2] + M[7];
+        const float wz = M[8] * lp[0] + M[9] * lp[1] + M[10] * lp[2] + M[11];
+        const float dx = wx - hit.x, dy = wy - hit.y, dz = wz - hit.z;
+        return dx * dx + dy * dy + dz * dz < eps2;
+    }
+
+    // The vertex-near test through grid @p g: the hit moves into local space (inverse of M's 3x3, which is
+    // rotation x per-axis scale for a brush, so local axis a's eps is eps / |column a|), and only the cells of that
+    // local box are tested exactly. A degenerate matrix or an oversized box tests every vertex of the copy.
+    static bool vertex_grid_near(const VertexGrid &g, const float *M, Vector3 hit, float eps)
+    {
+        const float eps2 = eps * eps;
+        const float a = M[0], b = M[1], c = M[2], d = M[4], e = M[5], f = M[6], p = M[8], q = M[9], r = M[10];
+        const float c00 = e * r - f * q, c01 = f * p - d * r, c02 = d * q - e * p;
+        const float det = a * c00 + b * c01 + c * c02;
+        int lo[3] = {}, hi[3] = {};
+        bool boxed = std::fabs(det) > 1e-12f;
+        if (boxed)
+        {
+            const float inv = 1.0f / det;
+            const float tx = hit.x - M[3], ty = hit.y - M[7], tz = hit.z - M[11];
+            const float local[3] = {
+                (c00 * tx + (c * q - b * r) * ty + (b * f - c * e) * tz) * inv,
+                (c01 * tx + (a * r - c * p) * ty + (c * d - a * f) * tz) * inv,
+                (c02 * tx + (b * p - a * q) * ty + (a * e - b * d) * tz) * inv,
+            };
+            long long cells = 1;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const float col = std::sqrt(M[axis] * M[axis] + M[4 + axis] * M[4 + axis] + M[8 + axis] * M[8 + axis]);
+                const float reach = eps / ((col > 1e-6f) ? col : 1e-6f);
+                lo[axis] = vgrid_cell(local[axis] - reach);
+                hi[axis] = vgrid_cell(local[axis] + reach);
+                cells *= static_cast<long long>(hi[axis] - lo[axis]) + 1;
+            }
+            boxed = cells <= k_vgrid_max_cells;
+        }
+        if (!boxed)
+        {
+            for (int v = 0; v < g.n_verts; ++v)
+            {
+                if (vertex_near(&g.verts[v * 3], M, hit, eps2))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+        for (int ix = lo[0]; ix <= hi[0]; ++ix)
+        {
+            for (int iy = lo[1]; iy <= hi[1]; ++iy)
+            {
+                for (int iz = lo[2]; iz <= hi[2]; ++iz)
+                {
+                    const int bkt = vgrid_bucket(ix, iy, iz);
+                    for (int v = g.bucket_start[bkt]; v < g.bucket_start[bkt + 1]; ++v)
+                    {
+                        if (vertex_near(&g.verts[v * 3], M, hit, eps2))
+                        {
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
     // True if brush @p node's render mesh has a vertex within @p eps of the world-space @p hit. Confirms a
     // candidate brush is the one a physics ray ACTUALLY hit (its mesh is there), not merely a neighbour whose
     // bbox contains the point. Reads the same pos buffer brush_char_coverage uses (GetPosPtr slot, FSL_READ),
-    // transforms by the CBrush world matrix, scans EVERY vertex with an early-out (sampling missed a thin pole's
-    // nearest vertex when it fell between sampled indices; the reads are raw, so a full scan is cheap).
-    static bool mesh_has_vertex_near(void *rmesh, const float *M, Vector3 hit, float eps2, uintptr_t mod_lo,
+    // transforms by the CBrush world matrix and tests every vertex near the hit: through the mesh's vertex grid
+    // (built on its first query) when it fits the cap, else by a full scan with an early-out (sampling missed a
+    // thin pole's nearest vertex when it fell between sampled indices; the reads are raw, so a full scan is cheap).
+    static bool mesh_has_vertex_near(void *rmesh, const float *M, Vector3 hit, float eps, uintptr_t mod_lo,
                                      uintptr_t mod_hi)
     {
         if (rmesh == nullptr)
@@ -952,6 +2476,14 @@ namespace TPVCamera
         {
             return false;
         }
+        const bool gridded = n_verts <= k_vgrid_vert_cap;
+        if (gridded)
+        {
+            if (const VertexGrid *g = vertex_grid_find(rmesh, n_verts))
+            {
+                return vertex_grid_near(*g, M, hit, eps);
+            }
+        }
         void **rm_vt = *reinterpret_cast<void ***>(rmesh);
         const auto get_pos = reinterpret_cast<GetPosPtrFn>(rm_vt[Constants::RENDERMESH_VTABLE_GETPOSPTR_OFFSET / 8]);
         const auto get_pos_addr = reinterpret_cast<uintptr_t>(get_pos);
@@ -969,15 +2501,14 @@ namespace TPVCamera
         {
             stride = 12;
         }
+        if (gridded)
+        {
+            return vertex_grid_near(*vertex_grid_build(rmesh, pos, stride, n_verts), M, hit, eps);
+        }
+        const float eps2 = eps * eps;
         for (int v = 0; v < n_verts; ++v)
         {
-            const auto *lp = reinterpret_cast<const float *>(pos + static_cast<size_t>(v) * stride);
-            const float lx = lp[0], ly = lp[1], lz = lp[2];
-            const float wx = M[0] * lx + M[1] * ly + M[2] * lz + M[3];
-            const float wy = M[4] * lx + M[5] * ly + M[6] * lz + M[7];
-            const float wz = M[8] * lx + M[9] * ly + M[10] * lz + M[11];
-            const float dx = wx - hit.x, dy = wy - hit.y, dz = wz - hit.z;
-            if (dx * dx + dy * dy + dz * dz < eps2)
+            if (vertex_near(reinterpret_cast<const float *>(pos + static_cast<size_t>(v) * stride), M, hit, eps2))
             {
                 return true;
             }
@@ -997,13 +2528,17 @@ namespace TPVCamera
         {
             return false;
         }
-        const float eps2 = eps * eps;
         const float *brush_m = reinterpret_cast<const float *>(bytes + Constants::CBRUSH_MATRIX_OFFSET);
-        void *rmesh =
-            *reinterpret_cast<void **>(reinterpret_cast<std::byte *>(statobj) + Constants::STATOBJ_RENDERMESH_OFFSET);
-        if (rmesh != nullptr)
+        const BrushClass *bc = brush_class(statobj, mod_lo, mod_hi);
+        if ((bc->flags & k_brush_compound) == 0)
         {
-            return mesh_has_vertex_near(rmesh, brush_m, hit, eps2, mod_lo, mod_hi);
+            // Simple brush: an unreadable root mesh has no vertex to find, and a hit outside the placed local
+            // bounds cannot have one either -- both settled without touching the position stream.
+            if ((bc->flags & k_brush_mesh_readable) == 0 || !local_bounds_near(*bc, brush_m, hit, eps))
+            {
+                return false;
+            }
+            return mesh_has_vertex_near(bc->rmesh, brush_m, hit, eps, mod_lo, mod_hi);
         }
         // Compound statobj: scan the child sub-meshes (same vector layout the coverage raster walks).
         auto *sb = reinterpret_cast<std::byte *>(statobj);
@@ -1033,7 +2568,7 @@ namespace TPVCamera
                                                            Constants::STATOBJ_RENDERMESH_OFFSET);
             float world_m[12];
             mat34_compose(brush_m, reinterpret_cast<const float *>(so + Constants::SUBOBJ_TM_OFFSET), world_m);
-            if (mesh_has_vertex_near(child_rmesh, world_m, hit, eps2, mod_lo, mod_hi))
+            if (mesh_has_vertex_near(child_rmesh, world_m, hit, eps, mod_lo, mod_hi))
             {
                 return true;
             }
@@ -1091,13 +2626,16 @@ namespace TPVCamera
             }
             void *brush_statobj = *reinterpret_cast<void **>(reinterpret_cast<std::byte *>(node) +
                                                              Constants::CBRUSH_STATOBJ_OFFSET);
-            char brush_name[160];
-            copy_brush_name(brush_statobj, brush_name, static_cast<int>(sizeof(brush_name)));
-            if (name_is_hlod_proxy(brush_name))
+            const BrushClass *bc = brush_class(brush_statobj, mod_lo, mod_hi);
+            if (bc == nullptr)
+            {
+                return k_coverage_unavailable; // no statobj: nothing to measure
+            }
+            if (bc->flags & k_brush_hlod)
             {
                 return k_coverage_unavailable; // coarse building-scale LOD proxy: leave it to the physics fan
             }
-            if (name_is_wall_opening(brush_name))
+            if (bc->flags & k_brush_wall_opening)
             {
                 return k_coverage_unavailable; // window / hole frame on a wall: the solid wall behind is the occluder
             }
@@ -1113,6 +2651,7 @@ namespace TPVCamera
         }
         __except (EXCEPTION_EXECUTE_HANDLER)
         {
+            Health::note(Health::Site::CoverageFault);
             return k_coverage_unavailable; // this node faulted -> skip it; other candidates are unaffected
         }
     }
@@ -1139,21 +2678,17 @@ namespace TPVCamera
         {
             *out_head = -1.0f;
         }
-        // The OCTREE query is guarded on its own; each candidate node is then measured under measure_node_at_hit's
-        // own SEH frame, so a single unreadable neighbour can no longer discard the whole result. `nodes` lives
-        // outside the query __try so the post-query loop (which has no SEH of its own) can read it.
-        std::uint32_t count = 0;
-        void *nodes[Constants::RENDER_OCCLUSION_MAX_NODES];
-        __try
+        // The node query (region BVH, or the OCTREE when the hit left the cached region) is guarded on its own;
+        // each candidate node is then measured under measure_node_at_hit's own SEH frame, so a single unreadable
+        // neighbour can no longer discard the whole result.
+        const FrameArena::Rewind scratch;
+        const std::span<void *> nodes = FrameArena::take<void *>(Constants::RENDER_OCCLUSION_MAX_NODES);
+        if (nodes.empty())
         {
-            count = query(p3d, bbox, nullptr);
-            if (count == 0 || count > static_cast<std::uint32_t>(Constants::RENDER_OCCLUSION_MAX_NODES))
-            {
-                return -1.0f;
-            }
-            query(p3d, bbox, nodes);
+            return -1.0f;
         }
-        __except (EXCEPTION_EXECUTE_HANDLER)
+        const std::uint32_t count = region_query(p3d, query, bbox, mod_lo, mod_hi, nodes.data());
+        if (count == 0)
         {
             return -1.0f;
         }
@@ -1186,9 +2721,10 @@ namespace TPVCamera
     }
 
     std::optional<float> render_occlusion_limit(const Vector3 &pivot, const Vector3 &to_camera, float radius,
-                                                float cov_thresh)
+                                                float cov_thresh, float requery_scale)
     {
-        if (s_get_objects_in_box == nullptr || s_p3d_engine_slot_addr == 0)
+        const DetourHotBlock &hot = detour_hot_block();
+        if (get_objects_in_box() == nullptr || hot.p3d_engine_slot == 0)
         {
             return std::nullopt;
         }
@@ -1210,27 +2746,30 @@ namespace TPVCamera
         }
 
         // Throttle: the cloth is a STATIC brush, so the octree query + sightline ray-march is re-run only when
-        // the camera has moved more than RENDER_OCCLUSION_REQUERY_DIST from the last query; otherwise the cached
-        // clear distance is reused (the collision easing still runs smoothly). This collapses the per-frame
-        // cost to ~nothing while standing still. Single render-thread caller, so plain statics are race-free.
+        // the camera has moved more than RENDER_OCCLUSION_REQUERY_DIST (x requery_scale) from the last query;
+        // otherwise the cached clear distance is reused (the collision easing still runs smoothly). This collapses
+        // the per-frame cost to ~nothing while standing still. Single render-thread caller, so plain statics are
+        // race-free.
         static bool s_cache_valid = false;
         static Vector3 s_cache_cam{};
         static float s_cache_block = k_cloth_unavailable;
         static float s_cache_cov = -1.0f; // cov_thresh the cache was computed with (toggling it forces a requery)
 
-        const float requery_d2 = Constants::RENDER_OCCLUSION_REQUERY_DIST * Constants::RENDER_OCCLUSION_REQUERY_DIST;
+        const float requery_dist = Constants::RENDER_OCCLUSION_REQUERY_DIST * requery_scale;
+        const float requery_d2 = requery_dist * requery_dist;
         if (!s_cache_valid || s_cache_cov != cov_thresh || (camera - s_cache_cam).magnitude_squared() > requery_d2)
         {
             float block = k_cloth_unavailable;
             RoofHitInfo hit{};
+            s_octree_busy_frame = true;
 
             // Resolve p3DEngine fresh and screen it (set once the 3DEngine exists; must carry an in-image vtable).
-            const auto p3d = DMK::Memory::seh_read<uintptr_t>(s_p3d_engine_slot_addr);
+            const auto p3d = SehRegion::read<uintptr_t>(hot.p3d_engine_slot);
             if (p3d && *p3d != 0 && DMK::Memory::plausible_userspace_ptr(*p3d))
             {
-                const auto vtable = DMK::Memory::seh_read<uintptr_t>(*p3d);
+                const auto vtable = SehRegion::read<uintptr_t>(*p3d);
                 if (vtable && DMK::Memory::plausible_userspace_ptr(*vtable) &&
-                    DMK::Memory::contains(s_game_module, *vtable))
+                    in_game_module(*vtable))
                 {
                     // Query box bounding the pivot->camera arm, expanded by the standoff.
                     const float margin = radius + 0.05f;
@@ -1241,8 +2780,14 @@ namespace TPVCamera
                     bbox[3] = std::max(pivot.x, camera.x) + margin;
                     bbox[4] = std::max(pivot.y, camera.y) + margin;
                     bbox[5] = std::max(pivot.z, camera.z) + margin;
-                    block = nearest_sightline_block_guarded(reinterpret_cast<void *>(*p3d), s_get_objects_in_box,
-                                                            bbox, pivot, camera, s_mod_lo, s_mod_hi, cov_thresh, &hit);
+                    const FrameArena::Rewind scratch;
+                    const std::span<void *> nodes = FrameArena::take<void *>(Constants::RENDER_OCCLUSION_MAX_NODES);
+                    if (!nodes.empty())
+                    {
+                        block = nearest_sightline_block_guarded(reinterpret_cast<void *>(*p3d), get_objects_in_box(),
+                                                                bbox, pivot, camera, hot.module_lo, hot.module_hi,
+                                                                cov_thresh, nodes.data(), &hit);
+                    }
                 }
             }
 
@@ -1254,18 +2799,22 @@ namespace TPVCamera
             // Trace WHAT the clamp latched onto, so a false positive (a prop / wall chunk on the sightline
             // instead of a real canopy) is identifiable by name + size + position. Logged only on a re-query
             // that produced a REAL clamp (block < desired), so it neither spams every frame nor logs misses.
-            if (block < desired)
+            if (block < desired && TraceRing::enabled())
             {
-                char name[256];
-                copy_brush_name(hit.statobj, name, static_cast<int>(sizeof(name)));
-                DMK::Logger::get_instance().trace(
-                    "RenderOcclusion HIT: node={} statobj={} name=\"{}\" blockDist={} of {} cov={} covThresh={} "
-                    "blockZ={} sizeXYZ=({}, {}, {}) bboxMin=({}, {}, {}) cam=({}, {}, {}) pivot=({}, {}, {})",
-                    DMK::Format::format_address(reinterpret_cast<uintptr_t>(hit.node)),
-                    DMK::Format::format_address(reinterpret_cast<uintptr_t>(hit.statobj)), name, block, desired,
-                    hit.coverage, cov_thresh, hit.roof_z, hit.max_x - hit.min_x, hit.max_y - hit.min_y,
-                    hit.max_z - hit.min_z, hit.min_x, hit.min_y, hit.min_z, camera.x, camera.y, camera.z, pivot.x,
-                    pivot.y, pivot.z);
+                TraceRing::Writer trace(TraceRing::Event::RenderOcclusionHit);
+                copy_brush_name(hit.statobj, trace.text_buffer(), TraceRing::k_text_len);
+                trace.hex(reinterpret_cast<uintptr_t>(hit.node))
+                    .hex(reinterpret_cast<uintptr_t>(hit.statobj))
+                    .f32(block)
+                    .f32(desired)
+                    .f32(hit.coverage)
+                    .f32(cov_thresh)
+                    .f32(hit.roof_z)
+                    .vec3(hit.max_x - hit.min_x, hit.max_y - hit.min_y, hit.max_z - hit.min_z)
+                    .vec3(hit.min_x, hit.min_y, hit.min_z)
+                    .vec3(camera)
+                    .vec3(pivot)
+                    .commit();
             }
         }
 
@@ -1277,9 +2826,94 @@ namespace TPVCamera
         return s_cache_block;
     }
 
+    // screened_p3d's body: raw reads inside a region body (SehRegion::run), seh_read otherwise.
+    static void *screened_p3d_body() noexcept
+    {
+        const DetourHotBlock &hot = detour_hot_block();
+        const auto p3d = SehRegion::read<uintptr_t>(hot.p3d_engine_slot);
+        if (!p3d || *p3d == 0 || !DMK::Memory::plausible_userspace_ptr(*p3d))
+        {
+            return nullptr;
+        }
+        const auto vtable = SehRegion::read<uintptr_t>(*p3d);
+        if (!vtable || !DMK::Memory::plausible_userspace_ptr(*vtable) ||
+            !in_game_module(*vtable))
+        {
+            return nullptr;
+        }
+        return reinterpret_cast<void *>(*p3d);
+    }
+
+    // The live p3DEngine, screened like the queries do (non-null, plausible, in-image vtable); nullptr otherwise.
+    static void *screened_p3d()
+    {
+        if (SehRegion::available())
+        {
+            auto body = [] { return screened_p3d_body(); };
+            return SehRegion::run(static_cast<void *>(nullptr), body);
+        }
+        return screened_p3d_body();
+    }
+
+    void prefetch_render_region(const Vector3 &pivot, const Vector3 &to_camera, float radius)
+    {
+        const DetourHotBlock &hot = detour_hot_block();
+        static bool s_have_prev = false;
+        static Vector3 s_prev_pivot{};
+        static Vector3 s_prev_camera{};
+
+        const Vector3 camera = pivot + to_camera;
+        const Vector3 pred_pivot = pivot + (pivot - s_prev_pivot) * Constants::RENDER_PREFETCH_FRAMES;
+        const Vector3 pred_camera = camera + (camera - s_prev_camera) * Constants::RENDER_PREFETCH_FRAMES;
+        const bool have_prev = s_have_prev;
+        s_have_prev = true;
+        s_prev_pivot = pivot;
+        s_prev_camera = camera;
+
+        // This frame already paid for an octree query: leave the prefetch to the next one.
+        const bool busy = s_octree_busy_frame;
+        s_octree_busy_frame = false;
+        if (busy || !have_prev || get_objects_in_box() == nullptr || hot.p3d_engine_slot == 0)
+        {
+            return;
+        }
+        // Only a region the queries are using is worth keeping warm: a level / upward look never queries the
+        // octree, and must not start paying for it every RENDER_REGION_MAX_AGE_MS here.
+        const unsigned long long now = GetTickCount64();
+        if (!s_region_valid || now - s_region_used_ms > Constants::RENDER_PREFETCH_IN_USE_MS)
+        {
+            return;
+        }
+
+        // Box over the current AND the predicted arm, so the rebuilt region serves both.
+        const float margin = radius + 0.05f;
+        float bbox[6];
+        bbox[0] = std::min({pivot.x, camera.x, pred_pivot.x, pred_camera.x}) - margin;
+        bbox[1] = std::min({pivot.y, camera.y, pred_pivot.y, pred_camera.y}) - margin;
+        bbox[2] = std::min({pivot.z, camera.z, pred_pivot.z, pred_camera.z}) - margin;
+        bbox[3] = std::max({pivot.x, camera.x, pred_pivot.x, pred_camera.x}) + margin;
+        bbox[4] = std::max({pivot.y, camera.y, pred_pivot.y, pred_camera.y}) + margin;
+        bbox[5] = std::max({pivot.z, camera.z, pred_pivot.z, pred_camera.z}) + margin;
+        const bool ageing =
+            now - s_region_built_ms + Constants::RENDER_PREFETCH_AGE_LEAD_MS > Constants::RENDER_REGION_MAX_AGE_MS;
+        if (!ageing && box_inside(bbox, s_region_box))
+        {
+            return; // the next frames' queries land in the warm region
+        }
+        void *p3d = screened_p3d();
+        if (p3d == nullptr || p3d != s_region_p3d)
+        {
+            return; // a new 3DEngine: the next query rebuilds the region itself
+        }
+        // A failed rebuild (empty, too dense for the padded box, a fault) keeps the region the queries are using.
+        // s_region_used_ms is left to region_query, so a prefetch never keeps itself alive.
+        (void)rebuild_region(p3d, get_objects_in_box(), bbox, hot.module_lo, hot.module_hi, now);
+    }
+
     float render_coverage_at(const Vector3 &hit_point, const Vector3 &pivot, const Vector3 &to_camera, void **out_node,
                              float *out_head)
     {
+        const DetourHotBlock &hot = detour_hot_block();
         if (out_node != nullptr)
         {
             *out_node = nullptr;
@@ -1288,18 +2922,12 @@ namespace TPVCamera
         {
             *out_head = -1.0f;
         }
-        if (s_get_objects_in_box == nullptr || s_p3d_engine_slot_addr == 0)
-        {
-            return -1.0f;
-        }
-        const auto p3d = DMK::Memory::seh_read<uintptr_t>(s_p3d_engine_slot_addr);
-        if (!p3d || *p3d == 0 || !DMK::Memory::plausible_userspace_ptr(*p3d))
+        if (get_objects_in_box() == nullptr || hot.p3d_engine_slot == 0)
         {
             return -1.0f;
         }
-        const auto vtable = DMK::Memory::seh_read<uintptr_t>(*p3d);
-        if (!vtable || !DMK::Memory::plausible_userspace_ptr(*vtable) ||
-            !DMK::Memory::contains(s_game_module, *vtable))
+        void *p3d = screened_p3d();
+        if (p3d == nullptr)
         {
             return -1.0f;
         }
@@ -1313,12 +2941,13 @@ namespace TPVCamera
         bbox[3] = hit_point.x + m;
         bbox[4] = hit_point.y + m;
         bbox[5] = hit_point.z + m;
-        return coverage_at_point_guarded(reinterpret_cast<void *>(*p3d), s_get_objects_in_box, bbox, hit_point, pivot,
-                                         camera, s_mod_lo, s_mod_hi, out_node, out_head);
+        return coverage_at_point_guarded(p3d, get_objects_in_box(), bbox, hit_point, pivot, camera, hot.module_lo,
+                                         hot.module_hi, out_node, out_head);
     }
 
     float render_coverage_of_brush(void *node, const Vector3 &pivot, const Vector3 &camera, float *out_head) noexcept
     {
+        const DetourHotBlock &hot = detour_hot_block();
         if (out_head != nullptr)
         {
             *out_head = -1.0f;
@@ -1331,7 +2960,7 @@ namespace TPVCamera
         {
             void **vt = *reinterpret_cast<void ***>(node);
             const auto vtaddr = reinterpret_cast<uintptr_t>(vt);
-            if (vtaddr < s_mod_lo || vtaddr >= s_mod_hi)
+            if (!in_game_module(vtaddr))
             {
                 return -1.0f; // vtable not in the game image -> not a render node we can trust
             }
@@ -1343,16 +2972,16 @@ namespace TPVCamera
             }
             void *statobj =
                 *reinterpret_cast<void **>(reinterpret_cast<std::byte *>(node) + Constants::CBRUSH_STATOBJ_OFFSET);
-            char nm[160];
-            copy_brush_name(statobj, nm, static_cast<int>(sizeof(nm)));
-            if (name_is_hlod_proxy(nm))
+            const BrushClass *bc = brush_class(statobj, hot.module_lo, hot.module_hi);
+            if (bc != nullptr && (bc->flags & k_brush_hlod))
             {
                 return -1.0f; // building-scale HLOD proxy -> not a thin prop, leave it to the caller's solid path
             }
-            return brush_char_coverage(node, pivot, camera, s_mod_lo, s_mod_hi, out_head);
+            return brush_char_coverage(node, pivot, camera, hot.module_lo, hot.module_hi, out_head);
         }
         __except (EXCEPTION_EXECUTE_HANDLER)
         {
+            Health::note(Health::Site::CoverageFault);
             return -1.0f;
         }
     }
@@ -1376,6 +3005,7 @@ namespace TPVCamera
     bool render_hit_info(const Vector3 &hit_point, void *node, char *out_name, int out_sz, float ext[3],
                          int *out_kind) noexcept
     {
+        const DetourHotBlock &hot = detour_hot_block();
         if (out_name != nullptr && out_sz > 0)
         {
             out_name[0] = '\0';
@@ -1388,14 +3018,17 @@ namespace TPVCamera
         // Resolve the render-engine pointer up front (seh_read is itself guarded); keeping its std::optional local
         // out of the structured-exception frame below avoids object-unwinding (MSVC C2712) in the __try.
         void *p3d_ptr = nullptr;
-        if (s_get_objects_in_box != nullptr && s_p3d_engine_slot_addr != 0)
+        if (get_objects_in_box() != nullptr && hot.p3d_engine_slot != 0)
         {
-            const auto p3d = DMK::Memory::seh_read<uintptr_t>(s_p3d_engine_slot_addr);
+            const auto p3d = DMK::Memory::seh_read<uintptr_t>(hot.p3d_engine_slot);
             if (p3d && *p3d != 0 && DMK::Memory::plausible_userspace_ptr(*p3d))
             {
                 p3d_ptr = reinterpret_cast<void *>(*p3d);
             }
         }
+        // Case 2's node list, from the frame arena. No Rewind here (a __try frame cannot hold one): it is a trace-only
+        // call after the walk, and the scratch is returned when the frame ends.
+        const std::span<void *> nodes = FrameArena::take<void *>(Constants::RENDER_OCCLUSION_MAX_NODES);
         __try
         {
             // Case 1: the collider carried a foreign render-node link (resolved by the caller). Read it directly.
@@ -1403,7 +3036,7 @@ namespace TPVCamera
             {
                 void **vt = *reinterpret_cast<void ***>(node);
                 const auto vtaddr = reinterpret_cast<uintptr_t>(vt);
-                if (vtaddr >= s_mod_lo && vtaddr < s_mod_hi)
+                if (in_game_module(vtaddr))
                 {
                     const auto get_type =
                         reinterpret_cast<GetRenderNodeTypeFn>(vt[Constants::RENDERNODE_VTABLE_GETTYPE_OFFSET / 8]);
@@ -1433,20 +3066,19 @@ namespace TPVCamera
             // Case 2: foreign-null collider (merged / proxy, e.g. the bird_feeder / a monument). Identify the compact
             // brush at the hit point -- the same selection the coverage gate measures: prefer the brush whose mesh is
             // AT the hit, else the first brush that contains it (a compound building, reported so it is identifiable).
-            if (p3d_ptr == nullptr)
+            if (p3d_ptr == nullptr || nodes.empty())
             {
                 return false;
             }
             constexpr float m = 0.25f;
             float bbox[6] = {hit_point.x - m, hit_point.y - m, hit_point.z - m,
                              hit_point.x + m, hit_point.y + m, hit_point.z + m};
-            const std::uint32_t count = s_get_objects_in_box(p3d_ptr, bbox, nullptr);
+            const std::uint32_t count = get_objects_in_box()(p3d_ptr, bbox, nullptr);
             if (count == 0 || count > static_cast<std::uint32_t>(Constants::RENDER_OCCLUSION_MAX_NODES))
             {
                 return false;
             }
-            void *nodes[Constants::RENDER_OCCLUSION_MAX_NODES];
-            s_get_objects_in_box(p3d_ptr, bbox, nodes);
+            get_objects_in_box()(p3d_ptr, bbox, nodes.data());
             // Three tiers, most specific wins: prop (a brush whose MESH is at the hit = the real thin occluder) >
             // solid (a non-HLOD brush that merely contains the hit = a compound building wall, still named) > hlod
             // (a coarse level / building proxy, reported only if nothing better contains the hit so the log never
@@ -1499,7 +3131,8 @@ namespace TPVCamera
                                                       Constants::CBRUSH_STATOBJ_OFFSET);
                 char nm[160];
                 copy_brush_name(so, nm, static_cast<int>(sizeof(nm)));
-                if (name_is_hlod_proxy(nm))
+                const BrushClass *bc = brush_class(so, hot.module_lo, hot.module_hi);
+                if (bc != nullptr && (bc->flags & k_brush_hlod))
                 {
                     if (!have_hlod)
                     {
@@ -1511,7 +3144,7 @@ namespace TPVCamera
                     }
                     continue;
                 }
-                if (mesh_near_point(n, hit_point, Constants::COVERAGE_HIT_EPS, s_mod_lo, s_mod_hi))
+                if (mesh_near_point(n, hit_point, Constants::COVERAGE_HIT_EPS, hot.module_lo, hot.module_hi))
                 {
                     copy_cstr(prop_name, static_cast<int>(sizeof(prop_name)), nm); // mesh at the hit: real occluder
                     prop_ext[0] = ex;
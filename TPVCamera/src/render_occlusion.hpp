@@ -8,6 +8,11 @@
  * module queries the render octree along the pivot->camera arm and reports the maximum camera
  * distance before an OVERHEAD brush, so the camera stays just below the roof. Every engine call is
  * SEH-guarded and degrades to "no clamp" so a layout or version drift can never crash the game.
+ *
+ * Coverage is measured by a CPU raster of the engine's own meshes, not by reading back the GPU depth
+ * buffer: the mod never touches the game's D3D device or swap chain (see dx_overlay.cpp), and no anchor
+ * resolves the renderer's device or depth target. A depth-readback backend would first need both
+ * resolved and verified live, like every other engine offset in constants.hpp.
  */
 #ifndef TPVCAMERA_RENDER_OCCLUSION_HPP
 #define TPVCAMERA_RENDER_OCCLUSION_HPP
@@ -25,12 +30,11 @@ namespace TPVCamera
      * @brief Resolves I3DEngine::GetObjectsInBox and the p3DEngine slot.
      * @details Best-effort: on a miss the render clamp simply no-ops (the camera still works), so callers
      *          treat a false return as "render occlusion unavailable".
-     * @param module_base Base address of the scanned game module (WHGame.dll); the AOB cascade search range.
-     * @param module_size Size of the scanned module image, in bytes.
+     *          Both are stored in the detour hot block, whose game-image range initialize_camera has already set.
      * @param g_env Resolved SSystemGlobalEnvironment base; p3DEngine = g_env + GENV_3DENGINE_OFFSET.
      * @return true if the query function was located.
      */
-    [[nodiscard]] bool initialize_render_occlusion(uintptr_t module_base, size_t module_size, uintptr_t g_env);
+    [[nodiscard]] bool initialize_render_occlusion(uintptr_t g_env);
 
     /**
      * @brief Maximum camera distance along @p to_camera before a render-only obstruction occludes the character.
@@ -53,9 +57,28 @@ namespace TPVCamera
      * @param to_camera Pivot->camera vector; its length is the desired follow distance (not normalized).
      * @param radius Standoff kept below the roof underside (the collision radius), meters.
      * @param cov_thresh Coverage gate threshold (0..1); 0 disables the gate (sightline test only, prior behavior).
+     * @param requery_scale Multiplier on RENDER_OCCLUSION_REQUERY_DIST, the camera travel over which the cached
+     *        result is reused before the octree is queried again (the collision governor widens it under load).
      */
     [[nodiscard]] std::optional<float> render_occlusion_limit(const Vector3 &pivot, const Vector3 &to_camera,
-                                                              float radius, float cov_thresh);
+                                                              float radius, float cov_thresh,
+                                                              float requery_scale = 1.0f);
+
+    /**
+     * @brief Warms the render-node region cache for where the camera arm is heading.
+     * @details Called once per frame after the collision stage with the desired (pre-collision) arm. The
+     *          pivot and camera are extrapolated RENDER_PREFETCH_FRAMES ahead from their last-frame motion; when the
+     *          region the occlusion / coverage queries are answered from would not contain the predicted arm, or
+     *          is about to age out, it is rebuilt NOW for the current + predicted arm. The GetObjectsInBox that
+     *          otherwise lands on the frame the camera crosses RENDER_OCCLUSION_REQUERY_DIST (on top of that
+     *          frame's sightline march) then runs ahead of it, on a frame that did no octree work of its own. A
+     *          frame that already queried the octree defers the prefetch; a region no query has used recently
+     *          (level / upward looks) is left to expire. Render thread only.
+     * @param pivot Camera arm start, world space.
+     * @param to_camera Pivot -> desired camera vector.
+     * @param radius Collision standoff the queries pad their boxes by.
+     */
+    void prefetch_render_region(const Vector3 &pivot, const Vector3 &to_camera, float radius);
 
     /**
      * @brief Fraction (0..1) of the character occluded by the VISIBLE render brush at a physics hit point.
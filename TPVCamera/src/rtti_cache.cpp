@@ -0,0 +1,103 @@
+/**
+ * @file rtti_cache.cpp
+ * @brief Flat open-addressing table behind RttiCache::is_type (see rtti_cache.hpp).
+ */
+
+#include "rtti_cache.hpp"
+#include "shared_resolve.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <array>
+#include <atomic>
+
+namespace TPVCamera::RttiCache
+{
+
+    namespace
+    {
+        // A few dozen distinct (vtable, type) pairs are ever asked about, so 256 slots keep the load factor low
+        // enough that a lookup almost always lands on its home slot.
+        constexpr std::uint32_t k_slot_count = 256;
+        constexpr std::uint32_t k_max_probe = 16;
+
+        enum SlotState : std::uint8_t
+        {
+            Empty = 0,
+            Filling, // claimed, key / verdict not yet published
+            IsNot,
+            Is,
+        };
+
+        struct Slot
+        {
+            std::atomic<std::uintptr_t> vtable{0};
+            std::atomic<const char *> name{nullptr};
+            std::atomic<std::uint8_t> state{Empty};
+        };
+
+        std::array<Slot, k_slot_count> s_slots{};
+        std::atomic<std::uint32_t> s_entries{0};
+
+        [[nodiscard]] std::uint32_t home_slot(std::uintptr_t vtable, const char *rtti_name) noexcept
+        {
+            // Fibonacci mix of both key words; vtables are 8-aligned, so the low bits carry nothing.
+            const std::uint64_t key = (static_cast<std::uint64_t>(vtable) >> 3) ^
+                                      (reinterpret_cast<std::uint64_t>(rtti_name) * 0x9E3779B97F4A7C15ull);
+            return static_cast<std::uint32_t>((key * 0x9E3779B97F4A7C15ull) >> 56) & (k_slot_count - 1);
+        }
+
+    } // namespace
+
+    bool is_type(std::uintptr_t vtable, const char *rtti_name) noexcept
+    {
+        const std::uint32_t home = home_slot(vtable, rtti_name);
+        Slot *free_slot = nullptr;
+        for (std::uint32_t i = 0; i < k_max_probe; ++i)
+        {
+            Slot &slot = s_slots[(home + i) & (k_slot_count - 1)];
+            const std::uint8_t state = slot.state.load(std::memory_order_acquire);
+            if (state == Empty)
+            {
+                free_slot = &slot;
+                break; // the pair was never inserted past here
+            }
+            if (state != Filling && slot.vtable.load(std::memory_order_relaxed) == vtable &&
+                slot.name.load(std::memory_order_relaxed) == rtti_name)
+            {
+                return state == Is;
+            }
+        }
+
+        // A verdict the other TPV mod (or an earlier load of this one) already reached skips the descriptor walk.
+        // Only positive verdicts are shared, and each new one is published for them in turn.
+        bool verdict = SharedResolve::rtti_is_type(vtable, rtti_name);
+        if (!verdict)
+        {
+            verdict = DMK::Rtti::vtable_is_type(vtable, rtti_name);
+            if (verdict)
+            {
+                SharedResolve::publish_rtti(vtable, rtti_name);
+            }
+        }
+        if (free_slot != nullptr)
+        {
+            std::uint8_t expected = Empty;
+            if (free_slot->state.compare_exchange_strong(expected, Filling, std::memory_order_relaxed))
+            {
+                free_slot->vtable.store(vtable, std::memory_order_relaxed);
+                free_slot->name.store(rtti_name, std::memory_order_relaxed);
+                free_slot->state.store(verdict ? Is : IsNot, std::memory_order_release);
+                s_entries.fetch_add(1, std::memory_order_relaxed);
+            }
+            // Lost the race for the slot: answer uncached; the next call re-probes and inserts further along.
+        }
+        return verdict;
+    }
+
+    std::uint32_t entry_count() noexcept
+    {
+        return s_entries.load(std::memory_order_relaxed);
+    }
+
+} // namespace TPVCamera::RttiCache
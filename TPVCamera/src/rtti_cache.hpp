@@ -0,0 +1,40 @@
+/**
+ * @file rtti_cache.hpp
+ * @brief Process-wide memo of RTTI type tests, so a repeated vtable check is a hash probe, not a descriptor walk.
+ *
+ * @details DMK::Rtti::vtable_is_type walks the vtable's complete-object locator to its type descriptor and
+ *          string-compares the decorated name. The camera detour, the game-state poll and the level-pitch writer
+ *          ask the same few questions about the same few vtables every frame (is this a CView / C_Player /
+ *          C_ActorModel / one of the minigames), so every verdict is remembered in a flat open-addressing table
+ *          keyed on the (vtable, type-name pointer) pair. A vtable lives in a loaded image for the life of the
+ *          process, so a verdict never goes stale and nothing is evicted.
+ *
+ *          Lock-free and safe from any thread: a slot is claimed by one CAS, filled, then published by a release
+ *          store that readers acquire. Two threads missing on the same pair at once may both walk and insert it;
+ *          the duplicate is harmless. When the probe window is full the test is answered uncached, so the cache
+ *          can never give a wrong answer, only a slower one. The type name is keyed by POINTER: pass the
+ *          Constants::*_RTTI_NAME constants (the same literal may be two pointers in two translation units, which
+ *          only costs a second entry).
+ */
+#ifndef TPVCAMERA_RTTI_CACHE_HPP
+#define TPVCAMERA_RTTI_CACHE_HPP
+
+#include <cstdint>
+
+namespace TPVCamera::RttiCache
+{
+
+    /**
+     * @brief Cached DMK::Rtti::vtable_is_type.
+     * @param vtable Runtime vtable pointer of the object under test (already screened by the caller).
+     * @param rtti_name Decorated type-descriptor name, e.g. Constants::CVIEW_RTTI_NAME.
+     * @return true if the vtable's most-derived type is @p rtti_name.
+     */
+    [[nodiscard]] bool is_type(std::uintptr_t vtable, const char *rtti_name) noexcept;
+
+    /** @brief Occupied slot count (for the overlay's Performance section). */
+    [[nodiscard]] std::uint32_t entry_count() noexcept;
+
+} // namespace TPVCamera::RttiCache
+
+#endif // TPVCAMERA_RTTI_CACHE_HPP
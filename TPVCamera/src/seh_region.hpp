@@ -0,0 +1,121 @@
+/**
+ * @file seh_region.hpp
+ * @brief One SEH frame per engine helper instead of one per engine read / call (CollisionSehRegion).
+ *
+ * @details The collision helpers normally isolate each engine call in its own small __try function
+ *          (ray_world_intersection_guarded, the octree query, ...) and read engine memory through
+ *          DMK::Memory::seh_read. Entering a guard is cheap on x64 (table-based SEH), but a guarded helper
+ *          cannot be inlined into its caller and forces its arguments and results through memory.
+ *
+ *          With [Advanced] CollisionSehRegion on, the camera detour enables region mode on the render thread
+ *          for the collision stage (solve_camera_collision_region, camera_hook.cpp). A helper whose body holds no
+ *          lock and no object with a non-trivial destructor then runs that body through run(): ONE __try around
+ *          the whole body, inside which the body's reads and engine calls are made directly, inline. A fault
+ *          lands in run(), which returns the helper's failure value (the same outcome its per-call guards give)
+ *          and counts the fault for the detour. The region never spans a caller's frame, so no destructor, no
+ *          profiler scope and no frame-arena rewind is ever skipped by an unwind. Outside region mode (the option
+ *          off, the collision worker thread, or any other caller) nothing changes: the fine-grained guards run.
+ *
+ *          Engine calls that take a lock the caller must release (the PWI sweep's world write lock) never run
+ *          inline: they keep their own guard, so the release always runs.
+ */
+#ifndef TPVCAMERA_SEH_REGION_HPP
+#define TPVCAMERA_SEH_REGION_HPP
+
+#include <DetourModKit.hpp>
+
+#include <excpt.h>
+
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace TPVCamera::SehRegion
+{
+
+    namespace detail
+    {
+        // Per thread, so the collision worker never sees the render thread's region mode.
+        inline thread_local bool t_enabled = false;
+        inline thread_local int t_depth = 0;
+        inline thread_local std::uint32_t t_faults = 0;
+    } // namespace detail
+
+    /** @brief Whether the calling thread is inside a run() body (reads and calls may be made inline). */
+    [[nodiscard]] inline bool active() noexcept
+    {
+        return detail::t_depth > 0;
+    }
+
+    /** @brief Whether region mode is on for the calling thread and it is not already inside a run() body. */
+    [[nodiscard]] inline bool available() noexcept
+    {
+        return detail::t_enabled && detail::t_depth == 0;
+    }
+
+    /**
+     * @class Mode
+     * @brief Enables region mode on the calling thread for the enclosing scope (the camera detour's collision stage).
+     */
+    class Mode
+    {
+    public:
+        explicit Mode(bool on) noexcept : m_previous(detail::t_enabled) { detail::t_enabled = on; }
+        ~Mode() noexcept { detail::t_enabled = m_previous; }
+        Mode(const Mode &) = delete;
+        Mode &operator=(const Mode &) = delete;
+
+    private:
+        bool m_previous;
+    };
+
+    /** @brief Faults caught by run() on this thread since the last call; resets the count. */
+    [[nodiscard]] inline std::uint32_t take_faults() noexcept
+    {
+        const std::uint32_t n = detail::t_faults;
+        detail::t_faults = 0;
+        return n;
+    }
+
+    /**
+     * @brief Runs @p body under one __try with the thread marked active(); @p on_fault if it faults.
+     * @details @p body must hold no lock and no object with a non-trivial destructor across any read or engine call
+     *          (a fault unwinds its frame without running destructors), and @p T must be trivially destructible for
+     *          the same reason; so must the lambda's captures.
+     */
+    template <typename T, typename Body>
+    [[nodiscard]] T run(T on_fault, Body &body) noexcept
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "a region result must not need unwinding");
+        T result = on_fault;
+        ++detail::t_depth;
+        __try
+        {
+            result = body();
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            result = on_fault;
+            ++detail::t_faults;
+        }
+        --detail::t_depth;
+        return result;
+    }
+
+    /**
+     * @brief Reads a @p T at @p address: a raw load inside a run() body, DMK::Memory::seh_read outside one.
+     * @details Inside a body run()'s __try catches a fault, so the read compiles to a plain load.
+     */
+    template <typename T>
+    [[nodiscard]] inline std::optional<T> read(std::uintptr_t address) noexcept
+    {
+        if (active())
+        {
+            return *reinterpret_cast<const T *>(address);
+        }
+        return DMK::Memory::seh_read<T>(address);
+    }
+
+} // namespace TPVCamera::SehRegion
+
+#endif // TPVCAMERA_SEH_REGION_HPP
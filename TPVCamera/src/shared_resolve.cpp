@@ -0,0 +1,281 @@
+/**
+ * @file shared_resolve.cpp
+ * @brief Named file mapping behind SharedResolve (see shared_resolve.hpp).
+ */
+
+#include "shared_resolve.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <windows.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cwchar>
+#include <iterator>
+
+namespace TPVCamera::SharedResolve
+{
+
+    namespace
+    {
+        // ---- Wire format v1 (mirrored in TPVToggle/src/shared_resolve.cpp) ----------------------------------------
+        constexpr std::uint32_t k_magic = 0x53565054; // "TPVS"
+        constexpr std::uint32_t k_version = 1;
+        constexpr std::uint32_t k_capacity = 256;
+
+        constexpr std::uint64_t k_kind_pattern = 0x5000000000000000ull; // top nibble of a key: 'P'attern
+        constexpr std::uint64_t k_kind_rtti = 0x7000000000000000ull;    // 'R'TTI
+        constexpr std::uint64_t k_kind_mask = 0xF000000000000000ull;
+
+        constexpr std::uint32_t k_flag_unique = 1u << 0;
+
+        struct Entry
+        {
+            std::uint64_t key;
+            std::uint64_t value; // absolute address in this process
+            std::uint32_t flags;
+            std::uint32_t reserved;
+        };
+
+        struct Table
+        {
+            volatile LONG lock; // 0 free, 1 held (InterlockedCompareExchange)
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint32_t count;
+            std::uint64_t module_base;
+            std::uint32_t time_date_stamp;
+            std::uint32_t size_of_image;
+            Entry entries[k_capacity];
+        };
+        // The wire layout is fixed; these asserts match TPVToggle's field for field, so a change on either side
+        // breaks both.
+        static_assert(sizeof(Entry) == 24, "TPVS v1: entry size");
+        static_assert(offsetof(Entry, key) == 0 && offsetof(Entry, value) == 8, "TPVS v1: entry key/value");
+        static_assert(offsetof(Entry, flags) == 16 && offsetof(Entry, reserved) == 20, "TPVS v1: entry flags");
+        static_assert(offsetof(Table, lock) == 0 && offsetof(Table, magic) == 4, "TPVS v1: lock/magic");
+        static_assert(offsetof(Table, version) == 8 && offsetof(Table, count) == 12, "TPVS v1: version/count");
+        static_assert(offsetof(Table, module_base) == 16, "TPVS v1: module_base");
+        static_assert(offsetof(Table, time_date_stamp) == 24 && offsetof(Table, size_of_image) == 28,
+                      "TPVS v1: module identity");
+        static_assert(offsetof(Table, entries) == 32, "TPVS v1: entries");
+        static_assert(sizeof(Table) == 32 + 24 * 256 && k_capacity == 256, "TPVS v1: table size");
+        static_assert(k_magic == 0x53565054 && k_version == 1, "TPVS v1: magic/version");
+        static_assert(k_kind_pattern == 0x5000000000000000ull && k_kind_mask == 0xF000000000000000ull,
+                      "TPVS v1: key kinds");
+        // ------------------------------------------------------------------------------------------------------------
+
+        // Mapped for the life of the process, never unmapped: the hooks outlive shutdown() until DMK_Shutdown, so
+        // a detour still running during teardown may probe the table.
+        std::atomic<Table *> s_table{nullptr};
+
+        /// FNV-1a over the pattern's tokens, upper-cased, with every wildcard spelled "?" and one space between.
+        [[nodiscard]] std::uint64_t pattern_key(std::string_view pattern) noexcept
+        {
+            std::uint64_t h = 0xCBF29CE484222325ull;
+            const auto mix = [&h](char c)
+            {
+                h = (h ^ static_cast<std::uint8_t>(c)) * 0x100000001B3ull;
+            };
+            bool first = true;
+            std::size_t i = 0;
+            while (i < pattern.size())
+            {
+                while (i < pattern.size() && (pattern[i] == ' ' || pattern[i] == '\t'))
+                {
+                    ++i;
+                }
+                const std::size_t start = i;
+                while (i < pattern.size() && pattern[i] != ' ' && pattern[i] != '\t')
+                {
+                    ++i;
+                }
+                if (i == start)
+                {
+                    break;
+                }
+                if (!first)
+                {
+                    mix(' ');
+                }
+                first = false;
+                if (pattern[start] == '?')
+                {
+                    mix('?');
+                    continue;
+                }
+                for (std::size_t k = start; k < i; ++k)
+                {
+                    const char c = pattern[k];
+                    mix((c >= 'a' && c <= 'f') ? static_cast<char>(c - 'a' + 'A') : c);
+                }
+            }
+            return (h & ~k_kind_mask) | k_kind_pattern;
+        }
+
+        [[nodiscard]] std::uint64_t rtti_key(const char *rtti_name) noexcept
+        {
+            std::uint64_t h = 0xCBF29CE484222325ull;
+            for (const char *p = rtti_name; *p != '\0'; ++p)
+            {
+                h = (h ^ static_cast<std::uint8_t>(*p)) * 0x100000001B3ull;
+            }
+            return (h & ~k_kind_mask) | k_kind_rtti;
+        }
+
+        /// Holds the table's spin lock for the enclosing scope.
+        class TableLock
+        {
+        public:
+            explicit TableLock(Table &table) noexcept : m_table(table)
+            {
+                while (InterlockedCompareExchange(&m_table.lock, 1, 0) != 0)
+                {
+                    YieldProcessor();
+                }
+            }
+            ~TableLock() noexcept { InterlockedExchange(&m_table.lock, 0); }
+            TableLock(const TableLock &) = delete;
+            TableLock &operator=(const TableLock &) = delete;
+
+        private:
+            Table &m_table;
+        };
+
+        [[nodiscard]] const Entry *find_locked(const Table &table, std::uint64_t key, std::uint64_t value) noexcept
+        {
+            const std::uint32_t n = table.count < k_capacity ? table.count : k_capacity;
+            for (std::uint32_t i = 0; i < n; ++i)
+            {
+                const Entry &e = table.entries[i];
+                if (e.key == key && (value == 0 || e.value == value))
+                {
+                    return &e;
+                }
+            }
+            return nullptr;
+        }
+
+        void publish(std::uint64_t key, std::uint64_t value, std::uint32_t flags) noexcept
+        {
+            Table *table = s_table.load(std::memory_order_acquire);
+            if (table == nullptr || value == 0)
+            {
+                return;
+            }
+            const TableLock lock(*table);
+            if (find_locked(*table, key, value) != nullptr || table->count >= k_capacity)
+            {
+                return; // already there (possibly from the other mod), or full: the table is only an accelerator
+            }
+            table->entries[table->count] = Entry{key, value, flags, 0};
+            ++table->count;
+        }
+    } // namespace
+
+    void open(std::uintptr_t module_base) noexcept
+    {
+        if (s_table.load(std::memory_order_relaxed) != nullptr || module_base == 0)
+        {
+            return;
+        }
+        const auto *dos = reinterpret_cast<const IMAGE_DOS_HEADER *>(module_base);
+        if (dos->e_magic != IMAGE_DOS_SIGNATURE)
+        {
+            return;
+        }
+        const auto *nt = reinterpret_cast<const IMAGE_NT_HEADERS64 *>(module_base + dos->e_lfanew);
+        if (nt->Signature != IMAGE_NT_SIGNATURE)
+        {
+            return;
+        }
+        const std::uint32_t stamp = nt->FileHeader.TimeDateStamp;
+        const std::uint32_t size_of_image = nt->OptionalHeader.SizeOfImage;
+
+        wchar_t name[96];
+        std::swprintf(name, std::size(name), L"Local\\KCD2TPV.SharedResolve.v%u.%lu.%llx.%08x", k_version,
+                      GetCurrentProcessId(), static_cast<unsigned long long>(module_base), stamp);
+        HANDLE mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, sizeof(Table), name);
+        if (mapping == nullptr)
+        {
+            DMK::Logger::get_instance().debug("SharedResolve: mapping unavailable ({}); resolving alone",
+                                              GetLastError());
+            return;
+        }
+        const bool existed = GetLastError() == ERROR_ALREADY_EXISTS;
+        auto *table = static_cast<Table *>(MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(Table)));
+        CloseHandle(mapping); // the view keeps the section alive for as long as either mod maps it
+        if (table == nullptr)
+        {
+            return;
+        }
+
+        bool usable = false;
+        std::uint32_t entries = 0;
+        {
+            const TableLock lock(*table);
+            if (table->magic == 0)
+            {
+                // A fresh mapping is zero-filled; the first mod in fills the header under the lock.
+                table->magic = k_magic;
+                table->version = k_version;
+                table->module_base = module_base;
+                table->time_date_stamp = stamp;
+                table->size_of_image = size_of_image;
+            }
+            usable = table->magic == k_magic && table->version == k_version && table->module_base == module_base &&
+                     table->time_date_stamp == stamp && table->size_of_image == size_of_image;
+            entries = table->count;
+        }
+        if (!usable)
+        {
+            UnmapViewOfFile(table);
+            DMK::Logger::get_instance().debug("SharedResolve: foreign table layout; resolving alone");
+            return;
+        }
+        s_table.store(table, std::memory_order_release);
+        DMK::Logger::get_instance().debug("SharedResolve: {} table ({} entries)", existed ? "joined" : "created",
+                                          entries);
+    }
+
+    std::optional<std::uintptr_t> find_pattern(std::string_view pattern, bool require_unique) noexcept
+    {
+        Table *table = s_table.load(std::memory_order_acquire);
+        if (table == nullptr)
+        {
+            return std::nullopt;
+        }
+        const std::uint64_t key = pattern_key(pattern);
+        const TableLock lock(*table);
+        const Entry *e = find_locked(*table, key, 0);
+        if (e == nullptr || (require_unique && (e->flags & k_flag_unique) == 0))
+        {
+            return std::nullopt;
+        }
+        return static_cast<std::uintptr_t>(e->value);
+    }
+
+    void publish_pattern(std::string_view pattern, std::uintptr_t match, bool unique) noexcept
+    {
+        publish(pattern_key(pattern), match, unique ? k_flag_unique : 0);
+    }
+
+    bool rtti_is_type(std::uintptr_t vtable, const char *rtti_name) noexcept
+    {
+        Table *table = s_table.load(std::memory_order_acquire);
+        if (table == nullptr || vtable == 0)
+        {
+            return false;
+        }
+        const std::uint64_t key = rtti_key(rtti_name);
+        const TableLock lock(*table);
+        return find_locked(*table, key, vtable) != nullptr;
+    }
+
+    void publish_rtti(std::uintptr_t vtable, const char *rtti_name) noexcept
+    {
+        publish(rtti_key(rtti_name), vtable, 0);
+    }
+
+} // namespace TPVCamera::SharedResolve
@@ -0,0 +1,51 @@
+/**
+ * @file shared_resolve.hpp
+ * @brief In-process table of resolved AOB matches and RTTI verdicts shared with TPVToggle when both are loaded.
+ *
+ * @details Both ASIs scan the same WHGame.dll image at startup, so each publishes what it resolved into one small
+ *          named file mapping. The name carries the process id, the module base and the PE TimeDateStamp, so a
+ *          table only ever describes the image it was built against. Whichever mod starts second finds the entries
+ *          the first one left there and re-checks each one before using it:
+ *            - pattern entries: key = hash of the normalized AOB text, value = the match address. The consumer
+ *              byte-compares the pattern at that address. An entry flagged unique was the only match in the code
+ *              sections. This mod only takes unique entries, because its cascade requires a single match.
+ *            - RTTI entries: key = hash of the decorated type name, value = a vtable whose most-derived type it
+ *              is. Only positive verdicts are shared, so a hit answers RttiCache without the descriptor walk.
+ *          The table is a fixed block guarded by one interlocked spin lock in its header. Each access holds the
+ *          lock for a few dozen loads. When the mapping cannot be created, or its header belongs to another layout
+ *          version, every call is a no-op, and the mod resolves exactly as it does on its own.
+ *
+ *          The wire format is mirrored in TPVToggle/src/shared_resolve.cpp; change both together and bump
+ *          k_version.
+ */
+#ifndef TPVCAMERA_SHARED_RESOLVE_HPP
+#define TPVCAMERA_SHARED_RESOLVE_HPP
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace TPVCamera::SharedResolve
+{
+
+    /** @brief Opens (or creates) the table for the image at @p module_base. Init thread, before any lookup. */
+    void open(std::uintptr_t module_base) noexcept;
+
+    /**
+     * @brief The published match of @p pattern, if any (not yet re-checked: the caller byte-compares it).
+     * @param require_unique Skip an entry whose publisher did not establish that the match is the only one.
+     */
+    [[nodiscard]] std::optional<std::uintptr_t> find_pattern(std::string_view pattern, bool require_unique) noexcept;
+
+    /** @brief Publishes the match of @p pattern; @p unique when it was the only match in the code sections. */
+    void publish_pattern(std::string_view pattern, std::uintptr_t match, bool unique) noexcept;
+
+    /** @brief True when a published verdict says @p vtable's most-derived type is @p rtti_name. Any thread. */
+    [[nodiscard]] bool rtti_is_type(std::uintptr_t vtable, const char *rtti_name) noexcept;
+
+    /** @brief Publishes a positive verdict: @p vtable's most-derived type is @p rtti_name. Any thread. */
+    void publish_rtti(std::uintptr_t vtable, const char *rtti_name) noexcept;
+
+} // namespace TPVCamera::SharedResolve
+
+#endif // TPVCAMERA_SHARED_RESOLVE_HPP
@@ -0,0 +1,26 @@
+/**
+ * @file simd_math.cpp
+ * @brief Batched point transform for the SIMD math layer (see simd_math.hpp).
+ */
+
+#include "simd_math.hpp"
+
+namespace TPVCamera::Simd
+{
+
+    void transform_points(const float *M, strided_span<const Vector3> in, std::span<Vector3> out) noexcept
+    {
+        using namespace DirectX;
+        // Transposing [R|t] gives the row-vector form XMVector3Transform expects: x * c0 + y * c1 + z * c2 + t.
+        const XMMATRIX m = XMMatrixTranspose(XMMATRIX(XMLoadFloat4(reinterpret_cast<const XMFLOAT4 *>(M + 0)),
+                                                      XMLoadFloat4(reinterpret_cast<const XMFLOAT4 *>(M + 4)),
+                                                      XMLoadFloat4(reinterpret_cast<const XMFLOAT4 *>(M + 8)),
+                                                      g_XMIdentityR3));
+        const std::size_t n = (in.size() < out.size()) ? in.size() : out.size();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            out[i] = store3(XMVector3Transform(load3(in[i]), m));
+        }
+    }
+
+} // namespace TPVCamera::Simd
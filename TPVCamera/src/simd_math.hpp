@@ -0,0 +1,227 @@
+/**
+ * @file simd_math.hpp
+ * @brief SSE-backed vector / quaternion helpers for the camera hot math (coverage projection, ray fan, orbit rig).
+ *
+ * @details math_utils.hpp's Vector3 / Quaternion stay the value types the code passes around: they mirror the
+ *          engine's packed float layout, so a position or rotation can be reinterpreted in place from game memory.
+ *          This layer is what the hot paths compute with. Values are loaded into XMVECTORs (SSE registers under
+ *          _XM_SSE_INTRINSICS_), worked on four lanes at a time, and stored back as Vector3:
+ *            - Vec4 / Quat are the 16-byte aligned register images, for state kept across calls;
+ *            - normalize_fast is a reciprocal-sqrt estimate refined by one Newton-Raphson step (~23 bits, well
+ *              below any threshold the camera compares against) instead of a sqrt and three divides;
+ *            - Quat::basis builds the rotated X / Y / Z axes from one rotation matrix instead of three
+ *              XMVector3Rotate calls, and Quat::rotate_many rotates several vectors by one loaded rotation;
+ *            - transform_points applies a row-major Matrix34 to a strided point stream.
+ *
+ *          Rotation conventions match the scalar code they replace: axis_angle is right-handed (the Rodrigues
+ *          form v cos + (a x v) sin + a (a . v)(1 - cos)), so yaw about +Z maps (x, y) to
+ *          (x cos - y sin, x sin + y cos). Results agree with the scalar forms to float rounding.
+ *
+ *          TPVToggle keeps its own math_utils (it already calls DirectXMath directly); the two mods do not share a
+ *          source tree.
+ */
+#ifndef TPVCAMERA_SIMD_MATH_HPP
+#define TPVCAMERA_SIMD_MATH_HPP
+
+#include "math_utils.hpp"
+
+#include <DirectXMath.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace TPVCamera::Simd
+{
+
+    /// Loads a packed Vector3 (w = 0).
+    [[nodiscard]] inline DirectX::XMVECTOR load3(const Vector3 &v) noexcept
+    {
+        return DirectX::XMLoadFloat3(reinterpret_cast<const DirectX::XMFLOAT3 *>(&v));
+    }
+
+    /// Stores the x, y, z lanes into a Vector3.
+    [[nodiscard]] inline Vector3 store3(DirectX::FXMVECTOR v) noexcept
+    {
+        Vector3 out;
+        DirectX::XMStoreFloat3(reinterpret_cast<DirectX::XMFLOAT3 *>(&out), v);
+        return out;
+    }
+
+    /**
+     * @brief 1 / sqrt(x) per lane: the hardware estimate plus one Newton-Raphson step.
+     * @details The bare estimate is only ~12 bits; the refinement y * (1.5 - 0.5 x y^2) brings it to ~23. Lanes
+     *          with x == 0 come back non-finite, so callers test the length first.
+     */
+    [[nodiscard]] inline DirectX::XMVECTOR rsqrt_nr(DirectX::FXMVECTOR x) noexcept
+    {
+        using namespace DirectX;
+        const XMVECTOR y = XMVectorReciprocalSqrtEst(x);
+        const XMVECTOR half_x = XMVectorMultiply(x, g_XMOneHalf);
+        const XMVECTOR three_halves = XMVectorReplicate(1.5f);
+        return XMVectorMultiply(y, XMVectorSubtract(three_halves, XMVectorMultiply(half_x, XMVectorMultiply(y, y))));
+    }
+
+    /**
+     * @brief Unit vector of @p v through rsqrt_nr; the zero vector when |v|^2 <= @p min_len_sq.
+     * @param out_len Optional: receives |v| (0 for a rejected vector), which several callers need anyway.
+     */
+    [[nodiscard]] inline Vector3 normalize_fast(const Vector3 &v, float *out_len = nullptr,
+                                                float min_len_sq = 1e-12f) noexcept
+    {
+        using namespace DirectX;
+        const XMVECTOR xv = load3(v);
+        const XMVECTOR len_sq = XMVector3Dot(xv, xv);
+        if (XMVectorGetX(len_sq) <= min_len_sq)
+        {
+            if (out_len != nullptr)
+            {
+                *out_len = 0.0f;
+            }
+            return Vector3();
+        }
+        const XMVECTOR inv = rsqrt_nr(len_sq);
+        if (out_len != nullptr)
+        {
+            *out_len = XMVectorGetX(XMVectorMultiply(len_sq, inv)); // |v|^2 / |v|
+        }
+        return store3(XMVectorMultiply(xv, inv));
+    }
+
+    /**
+     * @struct Vec4
+     * @brief 16-byte aligned four-float value, the register image of an XMVECTOR.
+     */
+    struct alignas(16) Vec4
+    {
+        float x = 0.0f, y = 0.0f, z = 0.0f, w = 0.0f;
+
+        [[nodiscard]] static Vec4 from(const Vector3 &v, float w = 0.0f) noexcept { return Vec4{v.x, v.y, v.z, w}; }
+
+        [[nodiscard]] DirectX::XMVECTOR load() const noexcept
+        {
+            return DirectX::XMLoadFloat4A(reinterpret_cast<const DirectX::XMFLOAT4A *>(this));
+        }
+        void store(DirectX::FXMVECTOR v) noexcept
+        {
+            DirectX::XMStoreFloat4A(reinterpret_cast<DirectX::XMFLOAT4A *>(this), v);
+        }
+        [[nodiscard]] Vector3 xyz() const noexcept { return Vector3(x, y, z); }
+    };
+    static_assert(sizeof(Vec4) == 16 && alignof(Vec4) == 16);
+
+    /**
+     * @struct Quat
+     * @brief 16-byte aligned rotation quaternion (x, y, z, w), the SIMD counterpart of Quaternion.
+     */
+    struct alignas(16) Quat
+    {
+        float x = 0.0f, y = 0.0f, z = 0.0f, w = 1.0f;
+
+        [[nodiscard]] static Quat from(const Quaternion &q) noexcept { return Quat{q.x, q.y, q.z, q.w}; }
+
+        [[nodiscard]] static Quat from_xm(DirectX::FXMVECTOR v) noexcept
+        {
+            Quat q;
+            DirectX::XMStoreFloat4A(reinterpret_cast<DirectX::XMFLOAT4A *>(&q), v);
+            return q;
+        }
+
+        /// Right-handed rotation by @p angle radians about the UNIT axis @p axis.
+        [[nodiscard]] static Quat axis_angle(const Vector3 &axis, float angle) noexcept
+        {
+            return from_xm(DirectX::XMQuaternionRotationNormal(load3(axis), angle));
+        }
+
+        /// Right-handed rotation by @p angle radians about world up (+Z).
+        [[nodiscard]] static Quat yaw_z(float angle) noexcept
+        {
+            float s = 0.0f;
+            float c = 1.0f;
+            DirectX::XMScalarSinCos(&s, &c, 0.5f * angle);
+            return Quat{0.0f, 0.0f, s, c};
+        }
+
+        [[nodiscard]] DirectX::XMVECTOR load() const noexcept
+        {
+            return DirectX::XMLoadFloat4A(reinterpret_cast<const DirectX::XMFLOAT4A *>(this));
+        }
+
+        /// Rotation applied after this one (this first, then @p next).
+        [[nodiscard]] Quat then(const Quat &next) const noexcept
+        {
+            return from_xm(DirectX::XMQuaternionMultiply(load(), next.load()));
+        }
+
+        [[nodiscard]] Vector3 rotate(const Vector3 &v) const noexcept
+        {
+            return store3(DirectX::XMVector3Rotate(load3(v), load()));
+        }
+
+        /// Rotates in[i] into out[i] for the common prefix of both spans; in and out may alias.
+        void rotate_many(std::span<const Vector3> in, std::span<Vector3> out) const noexcept
+        {
+            const DirectX::XMVECTOR q = load();
+            const std::size_t n = (in.size() < out.size()) ? in.size() : out.size();
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                out[i] = store3(DirectX::XMVector3Rotate(load3(in[i]), q));
+            }
+        }
+
+        /**
+         * @brief The rotated +X / +Y / +Z axes (the engine's right / forward / up) in one matrix build.
+         * @details Equal to rotate() of each unit axis; the rotation matrix rows are exactly those images.
+         */
+        void basis(Vector3 &right, Vector3 &forward, Vector3 &up) const noexcept
+        {
+            const DirectX::XMMATRIX m = DirectX::XMMatrixRotationQuaternion(load());
+            right = store3(m.r[0]);
+            forward = store3(m.r[1]);
+            up = store3(m.r[2]);
+        }
+    };
+    static_assert(sizeof(Quat) == 16 && alignof(Quat) == 16);
+
+    /**
+     * @brief A span whose elements sit @c stride bytes apart (an interleaved vertex stream, a struct-of-arrays
+     *        column, or plainly packed values when stride == sizeof(T)).
+     */
+    template <typename T>
+    class strided_span
+    {
+    public:
+        using byte_type = std::conditional_t<std::is_const_v<T>, const std::uint8_t, std::uint8_t>;
+
+        constexpr strided_span() noexcept = default;
+        constexpr strided_span(T *first, std::size_t count, std::size_t stride = sizeof(T)) noexcept
+            : m_base(reinterpret_cast<byte_type *>(first)), m_size(count), m_stride(stride)
+        {
+        }
+        constexpr strided_span(std::span<T> packed) noexcept : strided_span(packed.data(), packed.size()) {}
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept { return m_size; }
+        [[nodiscard]] constexpr std::size_t stride() const noexcept { return m_stride; }
+        [[nodiscard]] T &operator[](std::size_t i) const noexcept
+        {
+            return *reinterpret_cast<T *>(m_base + i * m_stride);
+        }
+
+    private:
+        byte_type *m_base = nullptr;
+        std::size_t m_size = 0;
+        std::size_t m_stride = sizeof(T);
+    };
+
+    /**
+     * @brief out[i] = M * in[i] for a row-major Matrix34 @p M (12 floats, [R|t], translation in column 3).
+     * @details Processes the common prefix of @p in and @p out. Each point is three multiply-adds on the
+     *          transposed matrix columns (separate multiply and add, no FMA contraction). @p in may be engine
+     *          memory: the caller owns the SEH frame, and this carries no unwinding objects.
+     */
+    void transform_points(const float *M, strided_span<const Vector3> in, std::span<Vector3> out) noexcept;
+
+} // namespace TPVCamera::Simd
+
+#endif // TPVCAMERA_SIMD_MATH_HPP
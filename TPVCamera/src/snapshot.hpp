@@ -0,0 +1,139 @@
+/**
+ * @file snapshot.hpp
+ * @brief Generation-counted, wait-free-read publication of an immutable snapshot to one reader thread.
+ *
+ * @details Replaces std::atomic<std::shared_ptr<const T>> for the render-thread tables. On MSVC that type is not
+ *          lock-free: every load takes its internal spinlock and bumps the refcount, so the render thread contends
+ *          with the UI thread whenever the editor republishes (a dragged slider publishes every frame).
+ *
+ *          A Snapshot<T> owns the published objects. The reader brackets each use in a ReadGuard, which announces
+ *          the generation it started at in a single slot, loads the current pointer, and clears the slot when it
+ *          goes out of scope: two stores and two loads, no lock, no refcount, no retry loop. The writer swaps the
+ *          pointer, bumps the generation and retires the old object tagged with the new generation; a retired
+ *          object is freed once the reader is idle or has announced a generation at or past its tag, i.e. once it
+ *          can no longer hold it. The announce / pointer / generation accesses are sequentially consistent, which
+ *          is what makes that check sound against a reader that loads the pointer just before the swap.
+ *
+ *          Exactly ONE reader thread (the render thread) may hold a ReadGuard, and never two at once. Writers are
+ *          serialized by an internal mutex the reader never takes. Retired objects pile up only while a guard is
+ *          held across publishes, which for the per-frame resolver means at most a frame's worth.
+ */
+#ifndef TPVCAMERA_SNAPSHOT_HPP
+#define TPVCAMERA_SNAPSHOT_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace TPVCamera
+{
+
+    /**
+     * @class Snapshot
+     * @brief Single-reader RCU cell holding the current immutable @p T (or nothing).
+     */
+    template <typename T>
+    class Snapshot
+    {
+    public:
+        /**
+         * @class ReadGuard
+         * @brief The reader's pin on the snapshot current when it was created. Valid for the guard's lifetime.
+         */
+        class ReadGuard
+        {
+        public:
+            ReadGuard(const ReadGuard &) = delete;
+            ReadGuard &operator=(const ReadGuard &) = delete;
+
+            ~ReadGuard()
+            {
+                m_owner.m_reader_gen.store(k_idle, std::memory_order_release);
+            }
+
+            [[nodiscard]] const T *get() const noexcept { return m_ptr; }
+            [[nodiscard]] explicit operator bool() const noexcept { return m_ptr != nullptr; }
+            const T &operator*() const noexcept { return *m_ptr; }
+            const T *operator->() const noexcept { return m_ptr; }
+
+        private:
+            friend class Snapshot;
+
+            explicit ReadGuard(const Snapshot &owner) noexcept : m_owner(owner)
+            {
+                const std::uint64_t gen = owner.m_generation.load(std::memory_order_seq_cst);
+                owner.m_reader_gen.store(gen, std::memory_order_seq_cst);
+                m_ptr = owner.m_current.load(std::memory_order_seq_cst);
+            }
+
+            const Snapshot &m_owner;
+            const T *m_ptr = nullptr;
+        };
+
+        Snapshot() = default;
+        Snapshot(const Snapshot &) = delete;
+        Snapshot &operator=(const Snapshot &) = delete;
+
+        ~Snapshot()
+        {
+            delete m_current.load(std::memory_order_relaxed);
+            for (const Retired &r : m_retired)
+            {
+                delete r.ptr;
+            }
+        }
+
+        /** @brief Reader side: pins the current snapshot (nullptr until the first publish). Wait-free. */
+        [[nodiscard]] ReadGuard read() const noexcept
+        {
+            return ReadGuard(*this);
+        }
+
+        /**
+         * @brief Writer side: makes @p next the current snapshot (nullptr clears it) and frees every retired
+         *        snapshot the reader can no longer hold.
+         */
+        void publish(std::unique_ptr<const T> next)
+        {
+            std::lock_guard lock(m_write_mutex);
+            const T *old = m_current.exchange(next.release(), std::memory_order_seq_cst);
+            const std::uint64_t tag = m_generation.fetch_add(1, std::memory_order_seq_cst) + 1;
+            if (old != nullptr)
+            {
+                m_retired.push_back({tag, old});
+            }
+            const std::uint64_t reader = m_reader_gen.load(std::memory_order_seq_cst);
+            std::erase_if(m_retired,
+                          [reader](const Retired &r)
+                          {
+                              if (reader != k_idle && reader < r.tag)
+                              {
+                                  return false; // the reader's pin may predate this retirement
+                              }
+                              delete r.ptr;
+                              return true;
+                          });
+        }
+
+    private:
+        static constexpr std::uint64_t k_idle = ~0ull;
+
+        struct Retired
+        {
+            std::uint64_t tag; // generation whose publish replaced ptr
+            const T *ptr;
+        };
+
+        std::atomic<const T *> m_current{nullptr};
+        std::atomic<std::uint64_t> m_generation{0};
+        mutable std::atomic<std::uint64_t> m_reader_gen{k_idle};
+        std::mutex m_write_mutex;
+        std::vector<Retired> m_retired; // writer-only (under m_write_mutex)
+    };
+
+} // namespace TPVCamera
+
+#endif // TPVCAMERA_SNAPSHOT_HPP
@@ -0,0 +1,335 @@
+/**
+ * @file telemetry.cpp
+ * @brief Memory-mapped ring file recorder and reader for the per-frame collision telemetry (see telemetry.hpp).
+ */
+
+#include "telemetry.hpp"
+#include "config.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <windows.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace TPVCamera::Telemetry
+{
+
+    namespace
+    {
+        constexpr char k_magic[4] = {'T', 'P', 'V', 'T'};
+        // [Advanced] TelemetryFrames clamp: ten seconds at 60 fps up to 128 MiB of records.
+        constexpr int k_min_capacity = 600;
+        constexpr int k_max_capacity = 1 << 20;
+
+        // Render-thread recorder state.
+        HANDLE s_file = INVALID_HANDLE_VALUE;
+        HANDLE s_mapping = nullptr;
+        void *s_view = nullptr;
+        TelemetryHeader *s_header = nullptr;
+        FrameRecord *s_records = nullptr;
+        std::uint32_t s_capacity = 0;
+        std::uint64_t s_written = 0;
+        bool s_open_failed = false; // do not retry every frame; cleared when the setting turns off
+        std::string s_path;
+
+        // s_recording is published for the overlay and the record() fast path. shutdown() raises s_stopping and
+        // waits for an in-flight record() (s_in_record) before it unmaps the view under the render thread.
+        std::atomic<bool> s_recording{false};
+        std::atomic<bool> s_stopping{false};
+        std::atomic<bool> s_in_record{false};
+
+        [[nodiscard]] std::wstring widen(const std::string &utf8)
+        {
+            const int n = MultiByteToWideChar(CP_UTF8, 0, utf8.data(), static_cast<int>(utf8.size()), nullptr, 0);
+            std::wstring out(static_cast<std::size_t>(n > 0 ? n : 0), L'\0');
+            if (n > 0)
+            {
+                MultiByteToWideChar(CP_UTF8, 0, utf8.data(), static_cast<int>(utf8.size()), out.data(), n);
+            }
+            return out;
+        }
+
+        void close_recording() noexcept
+        {
+            if (s_view != nullptr)
+            {
+                UnmapViewOfFile(s_view);
+            }
+            if (s_mapping != nullptr)
+            {
+                CloseHandle(s_mapping);
+            }
+            if (s_file != INVALID_HANDLE_VALUE)
+            {
+                // A recording that never wrapped drops its unused slots so a short session is a small file.
+                if (s_written < s_capacity)
+                {
+                    LARGE_INTEGER end{};
+                    end.QuadPart = static_cast<LONGLONG>(sizeof(TelemetryHeader) + s_written * sizeof(FrameRecord));
+                    if (SetFilePointerEx(s_file, end, nullptr, FILE_BEGIN))
+                    {
+                        SetEndOfFile(s_file);
+                    }
+                }
+                CloseHandle(s_file);
+                if (s_header != nullptr)
+                {
+                    DMK::Logger::get_instance().info("Telemetry: recorded {} frames to {}", s_written, s_path);
+                }
+            }
+            s_file = INVALID_HANDLE_VALUE;
+            s_mapping = nullptr;
+            s_view = nullptr;
+            s_header = nullptr;
+            s_records = nullptr;
+            s_written = 0;
+            s_recording.store(false, std::memory_order_relaxed);
+        }
+
+        bool open_recording()
+        {
+            DMK::Logger &logger = DMK::Logger::get_instance();
+            const int configured = settings().telemetry_frames.load(std::memory_order_relaxed);
+            s_capacity = static_cast<std::uint32_t>(std::clamp(configured, k_min_capacity, k_max_capacity));
+
+            SYSTEMTIME now{};
+            GetLocalTime(&now);
+            char stamp[32];
+            std::snprintf(stamp, sizeof(stamp), "%04u%02u%02u_%02u%02u%02u", now.wYear, now.wMonth, now.wDay,
+                          now.wHour, now.wMinute, now.wSecond);
+            s_path = DMK::Filesystem::get_runtime_directory_utf8() + "\\TPVCamera_telemetry_" + stamp + ".bin";
+
+            // Shared for reading so a recording can be inspected while the game still writes it.
+            s_file = CreateFileW(widen(s_path).c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                                 CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (s_file == INVALID_HANDLE_VALUE)
+            {
+                logger.warning("Telemetry: could not create {} (error {})", s_path, GetLastError());
+                return false;
+            }
+            const std::uint64_t bytes = sizeof(TelemetryHeader) + std::uint64_t{s_capacity} * sizeof(FrameRecord);
+            s_mapping = CreateFileMappingW(s_file, nullptr, PAGE_READWRITE, static_cast<DWORD>(bytes >> 32),
+                                           static_cast<DWORD>(bytes & 0xFFFFFFFFu), nullptr);
+            s_view = (s_mapping != nullptr) ? MapViewOfFile(s_mapping, FILE_MAP_WRITE, 0, 0, 0) : nullptr;
+            if (s_view == nullptr)
+            {
+                logger.warning("Telemetry: could not map {} ({} bytes, error {})", s_path, bytes, GetLastError());
+                close_recording();
+                return false;
+            }
+
+            s_header = static_cast<TelemetryHeader *>(s_view);
+            s_records =
+                reinterpret_cast<FrameRecord *>(static_cast<unsigned char *>(s_view) + sizeof(TelemetryHeader));
+            LARGE_INTEGER freq{};
+            LARGE_INTEGER start{};
+            QueryPerformanceFrequency(&freq);
+            QueryPerformanceCounter(&start);
+            std::memcpy(s_header->magic, k_magic, sizeof(k_magic));
+            s_header->version = k_telemetry_version;
+            s_header->header_size = sizeof(TelemetryHeader);
+            s_header->record_size = sizeof(FrameRecord);
+            s_header->capacity = s_capacity;
+            s_header->reserved = 0;
+            s_header->qpc_frequency = freq.QuadPart;
+            s_header->start_ticks = start.QuadPart;
+            s_header->frames_written = 0;
+            s_written = 0;
+            s_recording.store(true, std::memory_order_relaxed);
+            logger.info("Telemetry: recording to {} ({} frame ring)", s_path, s_capacity);
+            return true;
+        }
+
+        void record_impl(const FrameRecord &frame, bool want) noexcept
+        {
+            if (!want)
+            {
+                close_recording();
+                s_open_failed = false;
+                return;
+            }
+            if (s_view == nullptr)
+            {
+                if (s_open_failed)
+                {
+                    return;
+                }
+                try
+                {
+                    s_open_failed = !open_recording();
+                }
+                catch (const std::exception &e)
+                {
+                    DMK::Logger::get_instance().warning("Telemetry: could not start recording: {}", e.what());
+                    s_open_failed = true;
+                }
+                if (s_open_failed)
+                {
+                    return;
+                }
+            }
+            std::memcpy(&s_records[s_written % s_capacity], &frame, sizeof(FrameRecord));
+            ++s_written;
+            // The count lands after the record, so a reader of the live file never sees a half-written frame
+            // counted (the slot being overwritten after a wrap is the one a live reader may see torn).
+            std::atomic_ref<std::uint64_t>(s_header->frames_written).store(s_written, std::memory_order_release);
+        }
+    } // namespace
+
+    void record(const FrameRecord &frame) noexcept
+    {
+        const bool want = settings().record_telemetry.load(std::memory_order_relaxed);
+        if (!want && !s_recording.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        s_in_record.store(true, std::memory_order_seq_cst);
+        if (!s_stopping.load(std::memory_order_seq_cst))
+        {
+            record_impl(frame, want);
+        }
+        s_in_record.store(false, std::memory_order_release);
+    }
+
+    bool recording() noexcept
+    {
+        return s_recording.load(std::memory_order_relaxed);
+    }
+
+    void shutdown() noexcept
+    {
+        s_stopping.store(true, std::memory_order_seq_cst);
+        // A record() in flight is one memcpy (or the one-off open): bounded, so spin it out.
+        while (s_in_record.load(std::memory_order_acquire))
+        {
+            SwitchToThread();
+        }
+        if (s_view != nullptr || s_file != INVALID_HANDLE_VALUE)
+        {
+            close_recording();
+        }
+    }
+
+    std::optional<Reader> Reader::open(const std::string &path)
+    {
+        const HANDLE file =
+            CreateFileW(widen(path).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return std::nullopt;
+        }
+        LARGE_INTEGER size{};
+        const void *view = nullptr;
+        if (GetFileSizeEx(file, &size) && static_cast<std::uint64_t>(size.QuadPart) >= sizeof(TelemetryHeader))
+        {
+            const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                // The view keeps the file mapped after both handles close.
+                view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+        if (view == nullptr)
+        {
+            return std::nullopt;
+        }
+
+        Reader reader;
+        reader.m_view = view;
+        reader.m_header = static_cast<const TelemetryHeader *>(view);
+        const TelemetryHeader &h = *reader.m_header;
+        const auto bytes = static_cast<std::uint64_t>(size.QuadPart);
+        if (std::memcmp(h.magic, k_magic, sizeof(k_magic)) != 0 || h.version != k_telemetry_version ||
+            h.header_size != sizeof(TelemetryHeader) || h.record_size != sizeof(FrameRecord) || h.capacity == 0)
+        {
+            return std::nullopt;
+        }
+        // A file truncated on close holds only the frames written; a live or wrapped one holds the whole ring.
+        const std::uint64_t held = std::min<std::uint64_t>(h.frames_written, h.capacity);
+        if (bytes < sizeof(TelemetryHeader) + held * sizeof(FrameRecord))
+        {
+            return std::nullopt;
+        }
+        reader.m_records =
+            reinterpret_cast<const FrameRecord *>(static_cast<const unsigned char *>(view) + sizeof(TelemetryHeader));
+        reader.m_first = h.frames_written - held;
+        reader.m_size = static_cast<std::size_t>(held);
+        return reader;
+    }
+
+    Reader::Reader(Reader &&other) noexcept
+        : m_view(other.m_view), m_header(other.m_header), m_records(other.m_records), m_first(other.m_first),
+          m_size(other.m_size)
+    {
+        other.m_view = nullptr;
+        other.m_header = nullptr;
+        other.m_records = nullptr;
+        other.m_size = 0;
+    }
+
+    Reader &Reader::operator=(Reader &&other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            m_view = other.m_view;
+            m_header = other.m_header;
+            m_records = other.m_records;
+            m_first = other.m_first;
+            m_size = other.m_size;
+            other.m_view = nullptr;
+            other.m_header = nullptr;
+            other.m_records = nullptr;
+            other.m_size = 0;
+        }
+        return *this;
+    }
+
+    Reader::~Reader()
+    {
+        release();
+    }
+
+    void Reader::release() noexcept
+    {
+        if (m_view != nullptr)
+        {
+            UnmapViewOfFile(m_view);
+            m_view = nullptr;
+        }
+    }
+
+    const TelemetryHeader &Reader::header() const noexcept
+    {
+        return *m_header;
+    }
+
+    std::size_t Reader::size() const noexcept
+    {
+        return m_size;
+    }
+
+    const FrameRecord &Reader::operator[](std::size_t i) const noexcept
+    {
+        return m_records[(m_first + i) % m_header->capacity];
+    }
+
+    double Reader::seconds_at(std::size_t i) const noexcept
+    {
+        const TelemetryHeader &h = *m_header;
+        if (h.qpc_frequency <= 0)
+        {
+            return 0.0;
+        }
+        return static_cast<double>((*this)[i].ticks - h.start_ticks) / static_cast<double>(h.qpc_frequency);
+    }
+
+} // namespace TPVCamera::Telemetry
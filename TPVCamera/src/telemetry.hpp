@@ -0,0 +1,163 @@
+/**
+ * @file telemetry.hpp
+ * @brief Per-frame camera-collision telemetry: a memory-mapped ring file recorder and its offline reader.
+ *
+ * @details With [Advanced] RecordTelemetry on, every game-view frame that runs the collision stage appends one
+ *          fixed-size FrameRecord -- the arm, the desired / allowed / eased distances, what the fan, sphere and
+ *          render occlusion each returned, the coverage the walk measured, the collider it blocked on and the
+ *          game-state mask -- to TPVCamera_telemetry_<date>_<time>.bin next to the log. A "camera pumps against
+ *          this fence" session can then be replayed and diffed offline instead of re-enacted in game.
+ *
+ *          The file is a ring: a TelemetryHeader followed by capacity ([Advanced] TelemetryFrames) record slots,
+ *          pre-sized and mapped once when recording starts. A frame is one memcpy into the view and one release
+ *          store of the header's frame count; nothing is allocated, formatted or written through the file API on
+ *          the render thread, and the OS pages the view out on its own. Once the ring wraps the oldest frames are
+ *          overwritten, so the file always holds the last capacity frames. Opening (file creation + mapping) runs
+ *          on the first recorded frame after the setting turns on, in the render thread -- a one-off hitch on a
+ *          diagnostic toggle -- and turning it off (or shutdown) unmaps and closes the file; the next start
+ *          begins a new file.
+ *
+ *          Layout (little-endian PODs, version k_telemetry_version; bump it on any layout change):
+ *            TelemetryHeader                 magic "TPVT", sizes, capacity, QPC frequency, frames written
+ *            FrameRecord[capacity]           slot (n % capacity) holds frame n
+ *          The oldest surviving frame is slot (frames_written - min(frames_written, capacity)) % capacity; a file
+ *          closed before the ring wrapped is truncated to the frames written. Reader opens a file read-only,
+ *          validates the header against these structs and yields the surviving frames oldest first, up to the
+ *          write cursor it saw at open.
+ *
+ *          Threading: record() runs on the render thread only. Reader is independent of the recorder and of the
+ *          game: it touches no DMK or engine state, so an offline tool can use it on any recorded file.
+ */
+#ifndef TPVCAMERA_TELEMETRY_HPP
+#define TPVCAMERA_TELEMETRY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace TPVCamera::Telemetry
+{
+
+    inline constexpr std::uint32_t k_telemetry_version = 2;
+
+    /// FrameRecord::flags bits.
+    enum FrameFlags : std::uint16_t
+    {
+        k_flag_recomputed = 1u << 0,   // the stage recomputed (clear: the static-world throttle reused the target)
+        k_flag_blocked = 1u << 1,      // something pulled the camera in this frame
+        k_flag_from_sphere = 1u << 2,  // the swept sphere's distance was used (agreed with the fan)
+        k_flag_terrain = 1u << 3,      // the fan hit terrain
+        k_flag_render_clamp = 1u << 4, // render occlusion clamped below the physics result
+        k_flag_lateral = 1u << 5,      // the lateral probe pulled the camera in
+        k_flag_seh_fault = 1u << 6,    // the outer SEH region faulted; the frame held the last distance
+    };
+
+    /**
+     * @struct FrameRecord
+     * @brief One frame of the collision stage. Distances are metres from the pivot along the arm; -1 = no hit.
+     */
+    struct FrameRecord
+    {
+        std::int64_t ticks;        // QPC at the end of the stage
+        std::uint64_t collider;    // physics collider the fan blocked on (0 = none / terrain / unknown)
+        float delta_time;          // seconds since the previous game-view frame
+        float pivot[3];            // arm start, world
+        float to_camera[3];        // pivot -> desired camera, world (before collision)
+        float desired_distance;    // |to_camera|
+        float allowed_distance;    // target the easing ran toward
+        float collision_distance;  // eased distance the camera was placed at
+        float fan_distance;        // fan / coverage-walk result
+        float sphere_distance;     // swept sphere contact (-1 also when the sphere is off)
+        float render_distance;     // render-occlusion roof limit (-1 also when render occlusion is off)
+        float blocked_cov;         // coverage of the occluder the walk blocked on (-9 = not measured)
+        float walk_cov[8];         // coverage of each prop the walk saw past, in walk order (n_walk valid)
+        std::uint32_t game_state_mask;
+        std::uint16_t flags;       // FrameFlags
+        std::uint8_t n_walk;       // props the coverage walk saw past
+        std::uint8_t tier;         // CollisionGovernor::Tier
+        std::uint8_t lod;          // CollisionLod
+        std::uint8_t reserved[7];
+        std::uint64_t frame_index; // FrameClock game-view frame index, to line records up with the overlay / log
+    };
+    static_assert(sizeof(FrameRecord) == 128, "FrameRecord layout is part of the file format");
+    static_assert(offsetof(FrameRecord, delta_time) == 16 && offsetof(FrameRecord, walk_cov) == 72 &&
+                      offsetof(FrameRecord, game_state_mask) == 104 && offsetof(FrameRecord, frame_index) == 120,
+                  "FrameRecord layout is part of the file format");
+
+    /**
+     * @struct TelemetryHeader
+     * @brief File header. frames_written counts every frame ever recorded into the file.
+     */
+    struct TelemetryHeader
+    {
+        char magic[4];                 // "TPVT"
+        std::uint32_t version;         // k_telemetry_version
+        std::uint32_t header_size;     // sizeof(TelemetryHeader); records start here
+        std::uint32_t record_size;     // sizeof(FrameRecord)
+        std::uint32_t capacity;        // record slots
+        std::uint32_t reserved;
+        std::int64_t qpc_frequency;    // ticks per second of FrameRecord::ticks
+        std::int64_t start_ticks;      // QPC when recording started
+        std::uint64_t frames_written;  // written last per frame (release); slot = n % capacity
+    };
+    static_assert(sizeof(TelemetryHeader) == 48, "TelemetryHeader layout is part of the file format");
+    static_assert(offsetof(TelemetryHeader, qpc_frequency) == 24 && offsetof(TelemetryHeader, frames_written) == 40,
+                  "TelemetryHeader layout is part of the file format");
+
+    /**
+     * @brief Appends @p frame to the recording, starting or stopping it to follow [Advanced] RecordTelemetry.
+     * @details Render thread only. While the setting is off and no file is open this is two relaxed loads.
+     */
+    void record(const FrameRecord &frame) noexcept;
+
+    /** @brief Whether a recording file is open (for the overlay). Safe from any thread. */
+    [[nodiscard]] bool recording() noexcept;
+
+    /** @brief Closes the recording, if any (shutdown; after the render hook can no longer record). */
+    void shutdown() noexcept;
+
+    /**
+     * @class Reader
+     * @brief Read-only view of a telemetry file, frames oldest first.
+     */
+    class Reader
+    {
+    public:
+        /**
+         * @brief Maps @p path read-only and validates its header.
+         * @return The reader, or nullopt if the file is absent, truncated, or has another magic / version / layout.
+         */
+        [[nodiscard]] static std::optional<Reader> open(const std::string &path);
+
+        Reader(Reader &&other) noexcept;
+        Reader &operator=(Reader &&other) noexcept;
+        Reader(const Reader &) = delete;
+        Reader &operator=(const Reader &) = delete;
+        ~Reader();
+
+        [[nodiscard]] const TelemetryHeader &header() const noexcept;
+
+        /** @brief Frames the file still holds (min(frames_written, capacity)). */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /** @brief Frame @p i, 0 = oldest surviving. @p i must be < size(). */
+        [[nodiscard]] const FrameRecord &operator[](std::size_t i) const noexcept;
+
+        /** @brief Seconds between the recording start and frame @p i. */
+        [[nodiscard]] double seconds_at(std::size_t i) const noexcept;
+
+    private:
+        Reader() = default;
+        void release() noexcept;
+
+        const void *m_view = nullptr;
+        const TelemetryHeader *m_header = nullptr;
+        const FrameRecord *m_records = nullptr;
+        std::uint64_t m_first = 0; // frame number of the oldest surviving record
+        std::size_t m_size = 0;
+    };
+
+} // namespace TPVCamera::Telemetry
+
+#endif // TPVCAMERA_TELEMETRY_HPP
@@ -0,0 +1,42 @@
+/**
+ * @file thread_join.cpp
+ * @brief Bounded worker-thread join with a module pin on timeout (see thread_join.hpp).
+ */
+
+#include "thread_join.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <windows.h>
+
+namespace TPVCamera
+{
+
+    bool join_or_pin(void *thread, unsigned long timeout_ms, const char *name) noexcept
+    {
+        if (WaitForSingleObject(thread, timeout_ms) == WAIT_OBJECT_0)
+        {
+            CloseHandle(thread);
+            return true;
+        }
+        // Any address inside the image names the module; pinning twice is harmless.
+        HMODULE self = nullptr;
+        const BOOL pinned =
+            GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_PIN,
+                               reinterpret_cast<LPCWSTR>(&join_or_pin), &self);
+        const DWORD error = pinned ? 0 : GetLastError();
+        auto &logger = DMK::Logger::get_instance();
+        if (pinned)
+        {
+            logger.warning("{} thread did not stop within {} ms; pinned the module so it can keep running", name,
+                           timeout_ms);
+        }
+        else
+        {
+            logger.error("{} thread did not stop within {} ms and the module could not be pinned (error {})", name,
+                         timeout_ms, error);
+        }
+        return false;
+    }
+
+} // namespace TPVCamera
@@ -0,0 +1,26 @@
+/**
+ * @file thread_join.hpp
+ * @brief Bounded join for the module's worker threads that keeps a stuck thread's code mapped.
+ *
+ * @details Shutdown joins each worker with a timeout so a hung engine or driver call cannot hang the game's exit.
+ *          A thread that misses the timeout is still running module code, so closing its handle is not enough:
+ *          once the loader unmaps the module the thread faults in freed pages. join_or_pin() pins the module for
+ *          the rest of the process instead (GET_MODULE_HANDLE_EX_FLAG_PIN), logs which thread it was left running
+ *          for, and leaks the handle. Call it off the loader lock (teardown runs on a worker thread).
+ */
+#ifndef TPVCAMERA_THREAD_JOIN_HPP
+#define TPVCAMERA_THREAD_JOIN_HPP
+
+namespace TPVCamera
+{
+
+    /**
+     * @brief Waits up to @p timeout_ms for @p thread (a thread HANDLE) to exit.
+     * @return true when it exited and its handle was closed; false on a timeout, after pinning the module and
+     *         logging a warning naming @p name. The handle is left open then.
+     */
+    [[nodiscard]] bool join_or_pin(void *thread, unsigned long timeout_ms, const char *name) noexcept;
+
+} // namespace TPVCamera
+
+#endif // TPVCAMERA_THREAD_JOIN_HPP
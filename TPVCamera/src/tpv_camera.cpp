@@ -7,11 +7,24 @@
  */
 
 #include "tpv_camera.hpp"
+#include "alloc_stats.hpp"
+#include "anchor_cache.hpp"
 #include "aob_resolver.hpp"
+#include "benchmark.hpp"
 #include "config.hpp"
+#include "config_watcher.hpp"
 #include "constants.hpp"
 #include "global_state.hpp"
+#include "health.hpp"
+#include "hot_block.hpp"
 #include "game_interface.hpp"
+#include "occluder_db.hpp"
+#include "offset_heal.hpp"
+#include "physics_raycast.hpp"
+#include "raster_jobs.hpp"
+#include "telemetry.hpp"
+#include "thread_join.hpp"
+#include "trace_ring.hpp"
 #include "version.hpp"
 #include "hooks/camera_hook.hpp"
 #include "hooks/ui_overlay_hooks.hpp"
@@ -20,6 +33,9 @@
 #include "hooks/player_onaction_hook.hpp"
 #include "presets/preset_store.hpp"
 #include "overlay/overlay.hpp"
+#ifdef TPVCAMERA_DEV_BUILD
+#include "dev/state_handoff.hpp"
+#endif
 
 #include <DetourModKit.hpp>
 
@@ -28,10 +44,16 @@
 #include <windows.h>
 #include <psapi.h>
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstdio>
 #include <functional>
+#include <mutex>
 #include <optional>
 #include <string_view>
+#include <system_error>
+#include <thread>
 #include <vector>
 
 namespace TPVCamera
@@ -43,6 +65,198 @@ namespace TPVCamera
     // so a torn-down orbit hold cannot strand free-look on.
     static std::vector<DMK::Config::InputBindingGuard> s_binding_guards;
 
+    /**
+     * @class StartupReport
+     * @brief Wall-clock cost of each init() phase, logged as one line when init() returns.
+     * @details phase() closes the phase in progress under @p name and opens the next, so init() marks each step
+     *          once it finishes. Bootstrap's worker thread only.
+     */
+    class StartupReport
+    {
+    public:
+        void begin() noexcept
+        {
+            m_count = 0;
+            m_start = m_mark = std::chrono::steady_clock::now();
+        }
+
+        void phase(const char *name) noexcept
+        {
+            const auto now = std::chrono::steady_clock::now();
+            if (m_count < m_phases.size())
+            {
+                m_phases[m_count++] = {name, std::chrono::duration<double, std::milli>(now - m_mark).count()};
+            }
+            m_mark = now;
+        }
+
+        void log() const
+        {
+            char line[512] = {};
+            std::size_t len = 0;
+            for (std::size_t i = 0; i < m_count && len < sizeof(line); ++i)
+            {
+                const int n = std::snprintf(line + len, sizeof(line) - len, "%s%s %.1f", i > 0 ? ", " : "",
+                                            m_phases[i].name, m_phases[i].ms);
+                len += (n > 0) ? static_cast<std::size_t>(n) : 0;
+            }
+            const auto total = std::chrono::duration<double, std::milli>(m_mark - m_start).count();
+            DMK::Logger::get_instance().info("Startup: {:.1f} ms in init ({} ms)", total, line);
+        }
+
+    private:
+        struct Phase
+        {
+            const char *name = "";
+            double ms = 0.0;
+        };
+        std::array<Phase, 16> m_phases{};
+        std::size_t m_count = 0;
+        std::chrono::steady_clock::time_point m_start{};
+        std::chrono::steady_clock::time_point m_mark{};
+    };
+
+    static StartupReport s_startup;
+
+    // Preset load thread: maps the binary store (or imports the JSON) and publishes the binding table while init()
+    // validates the module and installs the hooks. Until it publishes, the render thread runs on the INI values.
+    // PresetStore is single-threaded, so nothing else touches the store until join_preset_loader() returns.
+    static std::thread s_preset_loader;
+
+    /** @brief Starts PresetStore::load() on s_preset_loader (inline if the thread cannot be started). */
+    static void start_preset_loader()
+    {
+        const std::string runtime_dir = DMK::Filesystem::get_runtime_directory_utf8();
+        auto load = [binary = runtime_dir + "\\" + Constants::get_presets_binary_filename(),
+                     json = runtime_dir + "\\" + Constants::get_presets_filename()]
+        {
+            const AllocStats::Scope alloc_tag(AllocStats::AllocTag::Presets);
+            Presets::PresetStore::instance().load(binary, json);
+        };
+        try
+        {
+            s_preset_loader = std::thread(load);
+        }
+        catch (const std::system_error &e)
+        {
+            DMK::Logger::get_instance().warning("Preset loader thread not started ({}); loading inline", e.what());
+            load();
+        }
+    }
+
+    /** @brief Waits for the preset load; the store belongs to the caller's thread afterwards. */
+    static void join_preset_loader()
+    {
+        if (s_preset_loader.joinable())
+            s_preset_loader.join();
+    }
+
+    // World-load warm-up thread: installs, once the world is first up, the hooks the main menu never needs.
+    static HANDLE s_warmup_thread = nullptr;
+    static std::atomic<bool> s_warmup_stop{false};
+
+    // The interaction hooks go in once, from the warm-up or from the INI reload that enables InteractFromCamera.
+    static std::mutex s_interaction_mutex;
+    static bool s_interaction_attempted = false; // guarded by s_interaction_mutex
+
+    /** @brief anchor_feature_bit() of every optional anchor feature the live settings enable. */
+    static std::uint32_t enabled_anchor_features() noexcept
+    {
+        const LiveSettings &cfg = settings();
+        std::uint32_t mask = 0;
+        // The render octree serves both the roof clamp and coverage collision's visible-brush raster.
+        if (cfg.use_render_occlusion.load(std::memory_order_relaxed) ||
+            cfg.use_coverage_collision.load(std::memory_order_relaxed))
+            mask |= anchor_feature_bit(AnchorFeature::RenderOctree);
+        if (cfg.interact_from_camera.load(std::memory_order_relaxed))
+            mask |= anchor_feature_bit(AnchorFeature::InteractFromCamera);
+        return mask;
+    }
+
+    /**
+     * @brief Resolves the interaction anchors (if startup skipped them) and installs the interaction hooks.
+     * @details The first caller installs; later calls return at once. A failed install is not retried, as before.
+     */
+    static void install_interaction_hooks()
+    {
+        const std::lock_guard lock(s_interaction_mutex);
+        if (s_interaction_attempted)
+            return;
+        s_interaction_attempted = true;
+
+        DMK::Logger &logger = DMK::Logger::get_instance();
+        const auto start = std::chrono::steady_clock::now();
+        (void)resolve_anchor_feature(AnchorFeature::InteractFromCamera);
+        const bool interaction = initialize_interaction_hook();
+        const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+        if (interaction)
+            logger.info("Interaction hooks installed in {:.2f} ms", elapsed.count());
+        else
+            logger.warning("Interaction hook initialization failed - camera-space interaction disabled");
+    }
+
+    /**
+     * @brief Waits for game_world_ready, then installs the interaction hooks if InteractFromCamera is on.
+     * @details The interaction hooks only act on an in-world look ray, so nothing is lost by installing them on
+     *          the first in-world frame instead of before the menu. Polls like the overlay's window wait and
+     *          leaves early on shutdown. With InteractFromCamera off the hooks (and their anchors) wait for the
+     *          INI reload that enables it (on_settings_reloaded).
+     */
+    static DWORD WINAPI world_warmup_thread(LPVOID)
+    {
+        AllocStats::set_thread_tag(AllocStats::AllocTag::Init);
+        while (!game_world_ready().load(std::memory_order_relaxed))
+        {
+            if (s_warmup_stop.load(std::memory_order_relaxed))
+                return 0;
+            Sleep(100);
+        }
+        if (settings().interact_from_camera.load(std::memory_order_relaxed))
+            install_interaction_hooks();
+        else
+            DMK::Logger::get_instance().info(
+                "Startup (world load): interaction hooks deferred (InteractFromCamera off)");
+        return 0;
+    }
+
+    /** @brief Starts world_warmup_thread; on failure installs its hooks inline, as before the deferral. */
+    static void start_world_warmup()
+    {
+        s_warmup_stop.store(false, std::memory_order_relaxed);
+        s_warmup_thread = CreateThread(nullptr, 0, world_warmup_thread, nullptr, 0, nullptr);
+        if (s_warmup_thread == nullptr && settings().interact_from_camera.load(std::memory_order_relaxed))
+            install_interaction_hooks();
+    }
+
+    /**
+     * @brief Brings up what an INI reload just switched on: the anchors of an optional feature that startup
+     *        skipped and, once in-world, the interaction hooks.
+     * @details Runs on the reload thread (the change watcher's, or DMK's polling reload) after the new values are
+     *          applied and before settings_version moves, so the scan is paid here and never on the render thread,
+     *          whose settings refresh then finds the render-octree anchor resolved. A feature that stays off keeps
+     *          its anchors unscanned; one already resolved costs a mutex and a flag.
+     */
+    static void on_settings_reloaded()
+    {
+        const std::uint32_t features = enabled_anchor_features();
+        if ((features & anchor_feature_bit(AnchorFeature::RenderOctree)) != 0)
+            (void)resolve_anchor_feature(AnchorFeature::RenderOctree);
+        if ((features & anchor_feature_bit(AnchorFeature::InteractFromCamera)) != 0 &&
+            game_world_ready().load(std::memory_order_relaxed))
+            install_interaction_hooks();
+    }
+
+    /** @brief Stops and joins the warm-up thread (it only sleeps or installs two hooks, so the join is short). */
+    static void stop_world_warmup() noexcept
+    {
+        if (s_warmup_thread == nullptr)
+            return;
+        s_warmup_stop.store(true, std::memory_order_relaxed);
+        // On a timeout the module stays pinned under the running thread and its handle stays open.
+        (void)join_or_pin(s_warmup_thread, 2000, "World warm-up");
+        s_warmup_thread = nullptr;
+    }
+
     /**
      * @brief Returns true when a menu or overlay is up; the hotkeys ignore presses then.
      */
@@ -138,11 +352,53 @@ namespace TPVCamera
         DMK::Logger &logger = DMK::Logger::get_instance();
         const ModuleInfo &mod = module_info();
 
-        // Resolve every game-image anchor in one parallel pass, confined to the WHGame.dll image range,
-        // before any module init reads its target. resolve_all_anchors() logs a per-anchor status and a
-        // quality summary; each init below reads its address via anchor_address(), and a mandatory anchor
-        // that did not resolve fails the init that needs it.
-        resolve_all_anchors(mod.base, mod.size);
+        // Resolve the core anchors and those of every feature the INI enables in one parallel pass, confined to
+        // the WHGame.dll image range, before any module init reads its target. resolve_all_anchors() logs a
+        // per-anchor status and a quality summary; each init below reads its address via anchor_address(), and a
+        // mandatory anchor that did not resolve fails the init that needs it. A disabled feature's anchors wait for
+        // the reload that enables it (on_settings_reloaded).
+        bool handed_off = false;
+#ifdef TPVCAMERA_DEV_BUILD
+        // Dev hot reload: the outgoing logic DLL handed over the addresses it resolved against this same image
+        // with this same candidate table, so the resolve (cache open + per-site byte-compare) is skipped.
+        handed_off = Handoff::adopt_anchors(mod.base, mod.size);
+#endif
+        if (!handed_off)
+        {
+            resolve_all_anchors(mod.base, mod.size, enabled_anchor_features());
+        }
+        else
+        {
+            // The outgoing DLL may have run with a feature off that this INI enables.
+            on_settings_reloaded();
+        }
+        s_startup.phase("anchors");
+        // The same cache file carries the offsets healed by an earlier session of this build; seeding them here,
+        // before the render thread's first heal, lets every group that latched then skip its RTTI scan. A dev
+        // handoff carries this session's heals, including any the file does not have yet.
+        handed_off = false;
+#ifdef TPVCAMERA_DEV_BUILD
+        handed_off = Handoff::adopt_offsets(mod.base);
+#endif
+        if (!handed_off)
+        {
+            if (const auto healed = cached_healed_offsets())
+            {
+                seed_healed_offsets(*healed);
+            }
+        }
+        s_startup.phase("healed offsets");
+
+        // Map the brush mesh database before the render-octree detours can classify their first brush. The mapping is
+        // prefetched here, so the render thread's first lookups do not fault its pages in from disk.
+        OccluderDb::open();
+        s_startup.phase("occluder database");
+
+        // Commit the detours' hot block and record the game image in it before the first hook is created: every
+        // detour reads it from its first call.
+        prefault_detour_hot_block();
+        detour_hot_block().module_lo = mod.base;
+        detour_hot_block().module_hi = mod.base + mod.size;
 
         // Built-in view flag, read by the camera gate to avoid stacking on the engine's own TPV.
         if (!initialize_game_interface())
@@ -159,11 +415,10 @@ namespace TPVCamera
         {
             logger.warning("UI Overlay hooks initialization failed - overlay suppression disabled");
         }
+        s_startup.phase("game interface + UI hooks");
 
-        if (!initialize_interaction_hook())
-        {
-            logger.warning("Interaction hook initialization failed - camera-space interaction disabled");
-        }
+        // The interaction hooks wait for the world (world_warmup_thread): the main menu has no look ray.
+        start_world_warmup();
 
         // Device-agnostic movement intent for the orbit move-detection. Best-effort: a miss falls back to
         // body-position speed, so the camera still works without it.
@@ -171,13 +426,15 @@ namespace TPVCamera
         {
             logger.warning("Player OnAction hook initialization failed - orbit move-detection uses body speed");
         }
+        s_startup.phase("OnAction hook");
 
         // The third-person camera itself. A hard failure here means the mod cannot function.
-        if (!initialize_camera(mod.base, mod.size))
+        if (!initialize_camera(mod.base))
         {
             logger.error("Critical: third-person camera hook installation failed - mod cannot function");
             return false;
         }
+        s_startup.phase("camera hooks");
 
         return true;
     }
@@ -263,6 +520,15 @@ namespace TPVCamera
         // opened over a game menu; the camera keeps rendering live so preset edits are visible.
         add_press(
             "Settings", "ToggleOverlayKey", "Toggle Overlay Key", "toggle_overlay", [] { Overlay::toggle(); }, "Home");
+
+        // Write the fault / fallback counters to the log, for attaching to a report. Unbound by default.
+        add_press(
+            "Settings", "DumpHealthKey", "Dump Health Key", "dump_health", [] { Health::dump_to_log(); }, "");
+
+        // Start (or stop) the scripted camera benchmark; the detour runs it on third-person frames. Unbound by
+        // default.
+        add_press(
+            "Settings", "BenchmarkKey", "Benchmark Key", "benchmark", [] { Benchmark::toggle(); }, "");
     }
 
     /**
@@ -338,20 +604,37 @@ namespace TPVCamera
 
     /**
      * @brief Starts the INI hot-reload watcher.
-     * @details The register_atomic setters re-apply the live settings on each reload,
-     *          so the callback only reports the outcome.
+     * @details Prefers the change-notification watcher (config_watcher.hpp), which sleeps until the INI is
+     *          written and reloads only when a setting's value changed. If the directory cannot be watched, falls
+     *          back to DMK's polling auto-reload; its register_atomic setters re-apply the live settings on each
+     *          reload, so the callback only reports the outcome.
      */
     static void enable_hot_reload()
     {
         DMK::Logger &logger = DMK::Logger::get_instance();
 
+        const std::string ini_path =
+            DMK::Filesystem::get_runtime_directory_utf8() + "\\" + Constants::get_config_filename();
+        if (ConfigWatcher::start(ini_path, on_settings_reloaded))
+        {
+            logger.info("INI hot-reload watcher started (change notifications, {} ms coalesce)",
+                        ConfigWatcher::k_coalesce_ms);
+            return;
+        }
+        logger.warning("INI change notifications unavailable; falling back to the polling reload");
+
         const DMK::Config::AutoReloadStatus status =
             DMK::Config::enable_auto_reload(std::chrono::milliseconds{250},
                                             [](bool content_changed)
                                             {
                                                 DMK::Logger &reload_logger = DMK::Logger::get_instance();
                                                 if (content_changed)
+                                                {
+                                                    on_settings_reloaded();
+                                                    settings().settings_version.fetch_add(
+                                                        1, std::memory_order_release);
                                                     reload_logger.info("INI auto-reload: live settings applied");
+                                                }
                                                 else
                                                     reload_logger.info("INI auto-reload: no content change");
                                             });
@@ -364,9 +647,11 @@ namespace TPVCamera
 
     bool init()
     {
+        const AllocStats::Scope alloc_tag(AllocStats::AllocTag::Init);
         DMK::Logger &logger = DMK::Logger::get_instance();
         logger.info("----------------------------------------");
         Version::log_version_info();
+        s_startup.begin();
 
         // Register every config item, then the press and hold bindings, then load and log once. The
         // bindings are all registered before load() so the INI key combos (and the optional consume flags
@@ -377,15 +662,16 @@ namespace TPVCamera
         register_hold_bindings();
         DMK::Config::load(Constants::get_config_filename());
         DMK::Config::log_all();
+        s_startup.phase("config");
 
         // Camera presets are user-owned and created automatically: the file is seeded from the embedded
         // factory defaults on first run, any missing built-in is re-added, and a corrupt file falls back to
         // those defaults, so loading never fails and never blocks the mod. The built-in state presets
         // (DEFAULT/COMBAT/AIMING/MOUNT/STEALTH) and any user presets feed the render-thread resolver via the
-        // published binding table.
-        const std::string presets_path =
-            DMK::Filesystem::get_runtime_directory_utf8() + "\\" + Constants::get_presets_filename();
-        Presets::PresetStore::instance().load(presets_path);
+        // published binding table. The load runs alongside the module checks and hook installs below (a large
+        // imported preset pack no longer delays them) and is joined before anything else uses the store.
+        start_preset_loader();
+        s_startup.phase("presets started");
 
         // Memory cache is a hot-path accelerator; a failure is non-fatal because the
         // readability checks fall back to direct VirtualQuery calls.
@@ -396,6 +682,14 @@ namespace TPVCamera
 
         if (!validate_game_module())
             return false;
+        s_startup.phase("module");
+
+        // Start the coverage-raster helpers before the frustum hook can hand them a mesh. None started is
+        // non-fatal: every mesh is then rasterized on the render thread.
+        const int raster_workers = RasterJobs::start(settings().raster_workers.load(std::memory_order_relaxed));
+        if (raster_workers > 0)
+            logger.info("Coverage raster: {} helper thread(s) started", raster_workers);
+        s_startup.phase("raster workers");
 
         if (!initialize_hooks())
             return false;
@@ -404,11 +698,24 @@ namespace TPVCamera
         logger.info("InputManager started");
 
         enable_hot_reload();
+        s_startup.phase("input + hot reload");
+
+        join_preset_loader();
+#ifdef TPVCAMERA_DEV_BUILD
+        (void)Handoff::adopt_preset_editor();
+#endif
+        s_startup.phase("presets joined");
 
         // Apply the start-of-session auto-enable flags (read once here; disabled by default). The view
         // gate (should_apply_view) still suppresses the offset under menus/loading, so an auto-enabled
         // view simply eases in once gameplay is reached. Orbit engages with the camera (it is gated on
         // the offset being active), starting from the centred 0,0 angle.
+        bool camera_handed_off = false;
+#ifdef TPVCAMERA_DEV_BUILD
+        // A dev hot reload resumes the view / orbit / zoom the outgoing logic DLL had instead.
+        camera_handed_off = Handoff::adopt_camera();
+#endif
+        if (!camera_handed_off)
         {
             const LiveSettings &startup = settings();
             CameraState &cam = camera_state();
@@ -425,12 +732,15 @@ namespace TPVCamera
         }
 
         // Start the preset-manager overlay (self-hosted ImGui). A failure is non-fatal: the camera and
-        // its hotkeys still work, only the in-game preset editor is unavailable.
+        // its hotkeys still work, only the in-game preset editor is unavailable. Only its thread starts here:
+        // the D3D device and the ImGui context are created once the world is up (dx_overlay's window wait).
         if (Overlay::start())
             logger.info("Preset overlay started (toggle with ToggleOverlayKey)");
         else
             logger.warning("Preset overlay failed to start; presets still apply from JSON/INI");
+        s_startup.phase("overlay");
 
+        s_startup.log();
         logger.info("Initialization completed successfully");
         return true;
     }
@@ -447,12 +757,40 @@ namespace TPVCamera
                     diag.hooks_active, diag.hooks_disabled, diag.total_intentional_leaks);
 
         // Stop the INI watcher first so no reload setter runs during teardown.
+        ConfigWatcher::stop();
         DMK::Config::disable_auto_reload();
 
         // Stop the overlay UI thread before touching the preset store so no UI mutation races teardown.
         Overlay::stop();
 
-        // Persist any unsaved preset edits.
+        // A warm-up still waiting for the world must not install hooks during teardown.
+        stop_world_warmup();
+
+        // Join the collision worker before the game interface it casts through is cleared.
+        shutdown_async_raycast();
+
+        // Join the coverage-raster helpers; a frustum detour still running after this rasterizes inline.
+        RasterJobs::stop();
+
+        // Merge this session's newly measured brush meshes into the database file. A frustum detour still running
+        // only misses the retracted view and measures live.
+        OccluderDb::save();
+
+        // Write the anchor cache if a heal group latched this session (the render thread only records it).
+        save_anchor_cache();
+
+        // Flush the hot-path trace ring while the logger is still up; a record committed after this is dropped.
+        TraceRing::shutdown();
+
+        // Close the telemetry recording, if one is open (waits out a frame the camera hook is recording).
+        Telemetry::shutdown();
+
+        // Let a benchmark report still being written finish.
+        Benchmark::shutdown();
+
+        // Persist any unsaved preset edits, refresh the JSON export, and wait for the preset writer. An init()
+        // that failed before joining the preset loader is joined here first.
+        join_preset_loader();
         Presets::PresetStore::instance().flush();
 
         // Disable the press callbacks so they cannot run during teardown.
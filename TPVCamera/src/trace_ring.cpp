@@ -0,0 +1,412 @@
+/**
+ * @file trace_ring.cpp
+ * @brief Bounded lock-free event ring and its drain thread (see trace_ring.hpp).
+ */
+
+#include "trace_ring.hpp"
+#include "alloc_stats.hpp"
+#include "frame_profiler.hpp"
+#include "thread_join.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <windows.h>
+
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <mutex>
+#include <string>
+
+namespace TPVCamera::TraceRing
+{
+
+    namespace
+    {
+        enum class Kind : std::uint8_t
+        {
+            F32,
+            I64,
+            Hex,
+            Bool,
+            Str,
+            Text, // the record's text field; takes no slot
+            Vec3, // three F32 slots
+        };
+
+        struct Field
+        {
+            const char *name;
+            Kind kind;
+        };
+
+        struct EventDesc
+        {
+            const char *prefix;
+            const Field *fields;
+            int n_fields;
+        };
+
+        constexpr Field k_physics_hit[] = {
+            {"src", Kind::Str},
+            {"bTerrain", Kind::I64},
+            {"dist", Kind::F32},
+            {"of", Kind::F32},
+            {"cov", Kind::F32},
+            {"kind", Kind::Str},
+            {"obj", Kind::Text},
+            {"ext", Kind::Vec3},
+            {"collider", Kind::Hex},
+            {"node", Kind::Hex},
+            {"point", Kind::Vec3},
+            {"normal", Kind::Vec3},
+            {"cam", Kind::Vec3},
+            {"pivot", Kind::Vec3},
+        };
+        constexpr Field k_render_hit[] = {
+            {"node", Kind::Hex},
+            {"statobj", Kind::Hex},
+            {"name", Kind::Text},
+            {"blockDist", Kind::F32},
+            {"of", Kind::F32},
+            {"cov", Kind::F32},
+            {"covThresh", Kind::F32},
+            {"blockZ", Kind::F32},
+            {"sizeXYZ", Kind::Vec3},
+            {"bboxMin", Kind::Vec3},
+            {"cam", Kind::Vec3},
+            {"pivot", Kind::Vec3},
+        };
+        constexpr Field k_orbit_move_start[] = {
+            {"move_magnitude", Kind::F32},
+            {"continuous_align", Kind::Bool},
+            {"state_mask", Kind::Hex},
+        };
+        constexpr Field k_orbit_magnitude[] = {
+            {"move_magnitude", Kind::F32},
+        };
+        constexpr Field k_orbit_body_turn[] = {
+            {"engaged", Kind::Bool},
+        };
+
+        template <std::size_t N>
+        constexpr EventDesc desc(const char *prefix, const Field (&fields)[N])
+        {
+            return EventDesc{prefix, fields, static_cast<int>(N)};
+        }
+
+        constexpr EventDesc k_events[] = {
+            desc("PhysicsCollision HIT:", k_physics_hit),
+            desc("RenderOcclusion HIT:", k_render_hit),
+            desc("Orbit: move-orbit START (body-turn engaging) --", k_orbit_move_start),
+            desc("Orbit: move-orbit STOP (body-turn releasing) --", k_orbit_magnitude),
+            desc("Orbit: suppressed a stale move re-trip (no release observed since orbit engaged; likely a movement "
+                 "latch stranded by a combat action-map swap) --",
+                 k_orbit_magnitude),
+            desc("Camera: orbit body-turn (heading locked to camera while moving) --", k_orbit_body_turn),
+        };
+        static_assert(std::size(k_events) == static_cast<std::size_t>(Event::Count));
+
+        // Bounded multi-producer ring (Vyukov). Each slot's sequence is stored relative to its index so the
+        // zero-initialized array starts out "free for position index": seq(pos) == stored + index.
+        constexpr std::uint64_t k_capacity = 256;
+        constexpr std::uint64_t k_mask = k_capacity - 1;
+        static_assert(std::has_single_bit(k_capacity));
+
+        struct Slot
+        {
+            std::atomic<std::uint64_t> seq{0};
+            Record rec;
+        };
+
+        Slot s_slots[k_capacity];
+        alignas(64) std::atomic<std::uint64_t> s_tail{0};
+        alignas(64) std::uint64_t s_head = 0; // drain thread only
+        std::atomic<std::uint64_t> s_dropped{0};
+
+        std::once_flag s_start_once;
+        HANDLE s_thread = nullptr;
+        HANDLE s_wake = nullptr; // auto-reset: signalled when a record lands on an idle drain thread, and on shutdown
+        std::atomic<bool> s_idle{false};
+        std::atomic<bool> s_shutdown{false};
+
+        bool try_push(const Record &rec) noexcept
+        {
+            std::uint64_t pos = s_tail.load(std::memory_order_relaxed);
+            Slot *slot = nullptr;
+            for (;;)
+            {
+                slot = &s_slots[pos & k_mask];
+                const std::uint64_t seq = slot->seq.load(std::memory_order_acquire) + (pos & k_mask);
+                const auto diff = static_cast<std::int64_t>(seq - pos);
+                if (diff == 0)
+                {
+                    if (s_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false; // full: the drain thread is a whole ring behind
+                }
+                else
+                {
+                    pos = s_tail.load(std::memory_order_relaxed);
+                }
+            }
+            slot->rec = rec;
+            slot->seq.store(pos + 1 - (pos & k_mask), std::memory_order_release);
+            return true;
+        }
+
+        bool try_pop(Record &out) noexcept
+        {
+            Slot &slot = s_slots[s_head & k_mask];
+            const std::uint64_t seq = slot.seq.load(std::memory_order_acquire) + (s_head & k_mask);
+            if (seq != s_head + 1)
+            {
+                return false;
+            }
+            out = slot.rec;
+            slot.seq.store(s_head + k_capacity - (s_head & k_mask), std::memory_order_release);
+            ++s_head;
+            return true;
+        }
+
+        float slot_f32(std::uint64_t bits) noexcept
+        {
+            return std::bit_cast<float>(static_cast<std::uint32_t>(bits));
+        }
+
+        std::string format_record(const Record &rec)
+        {
+            const auto e = static_cast<std::size_t>(rec.event);
+            if (e >= std::size(k_events))
+            {
+                return "TraceRing: unknown event";
+            }
+            const EventDesc &d = k_events[e];
+            std::string line = d.prefix;
+            int s = 0;
+            const auto next = [&]() -> std::uint64_t { return (s < rec.n_slots) ? rec.slots[s++] : 0; };
+            for (int i = 0; i < d.n_fields; ++i)
+            {
+                const Field &f = d.fields[i];
+                line += ' ';
+                line += f.name;
+                line += '=';
+                switch (f.kind)
+                {
+                case Kind::F32:
+                    std::format_to(std::back_inserter(line), "{}", slot_f32(next()));
+                    break;
+                case Kind::I64:
+                    std::format_to(std::back_inserter(line), "{}", static_cast<std::int64_t>(next()));
+                    break;
+                case Kind::Hex:
+                    std::format_to(std::back_inserter(line), "{:#x}", next());
+                    break;
+                case Kind::Bool:
+                    line += (next() != 0) ? "true" : "false";
+                    break;
+                case Kind::Str:
+                {
+                    const auto *str = reinterpret_cast<const char *>(static_cast<std::uintptr_t>(next()));
+                    line += (str != nullptr) ? str : "";
+                    break;
+                }
+                case Kind::Text:
+                    line += '"';
+                    line.append(rec.text, strnlen(rec.text, k_text_len));
+                    line += '"';
+                    break;
+                case Kind::Vec3:
+                {
+                    const float x = slot_f32(next());
+                    const float y = slot_f32(next());
+                    const float z = slot_f32(next());
+                    std::format_to(std::back_inserter(line), "({}, {}, {})", x, y, z);
+                    break;
+                }
+                }
+            }
+            // Delay between the event and this line: how far the drain ran behind the frame that wrote it.
+            std::format_to(std::back_inserter(line), " [+{:.0f} us]",
+                           Profiler::ticks_to_us(Profiler::now_ticks() - rec.ticks));
+            return line;
+        }
+
+        void drain_all()
+        {
+            DMK::Logger &logger = DMK::Logger::get_instance();
+            Record rec;
+            while (try_pop(rec))
+            {
+                logger.trace("{}", format_record(rec));
+            }
+            if (const std::uint64_t dropped = s_dropped.exchange(0, std::memory_order_relaxed); dropped > 0)
+            {
+                logger.trace("TraceRing: dropped {} trace records (ring full)", dropped);
+            }
+        }
+
+        bool ring_empty() noexcept
+        {
+            const Slot &slot = s_slots[s_head & k_mask];
+            return slot.seq.load(std::memory_order_acquire) + (s_head & k_mask) != s_head + 1;
+        }
+
+        DWORD WINAPI drain_thread(LPVOID)
+        {
+            AllocStats::set_thread_tag(AllocStats::AllocTag::Logging);
+            while (!s_shutdown.load(std::memory_order_acquire))
+            {
+                drain_all();
+                // Publish idle, then re-check: a record pushed before the flag was visible is not lost, one pushed
+                // after it sees the flag and signals the event.
+                s_idle.store(true, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (!ring_empty())
+                {
+                    s_idle.store(false, std::memory_order_relaxed);
+                    continue;
+                }
+                WaitForSingleObject(s_wake, INFINITE);
+            }
+            drain_all();
+            return 0;
+        }
+
+        void start_drain() noexcept
+        {
+            s_wake = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+            if (s_wake == nullptr)
+            {
+                return;
+            }
+            s_thread = CreateThread(nullptr, 0, drain_thread, nullptr, 0, nullptr);
+            if (s_thread == nullptr)
+            {
+                DMK::Logger::get_instance().warning("TraceRing: drain thread failed to start; hot-path traces off");
+            }
+        }
+    } // namespace
+
+    bool enabled() noexcept
+    {
+        return DMK::Logger::get_instance().is_enabled(DMK::LogLevel::Trace);
+    }
+
+    Writer::Writer(Event event) noexcept
+    {
+        m_record.event = event;
+        m_record.ticks = Profiler::now_ticks();
+    }
+
+    void Writer::push_slot(std::uint64_t bits) noexcept
+    {
+        if (m_record.n_slots < k_max_slots)
+        {
+            m_record.slots[m_record.n_slots++] = bits;
+        }
+    }
+
+    Writer &Writer::f32(float value) noexcept
+    {
+        push_slot(std::bit_cast<std::uint32_t>(value));
+        return *this;
+    }
+
+    Writer &Writer::i64(std::int64_t value) noexcept
+    {
+        push_slot(static_cast<std::uint64_t>(value));
+        return *this;
+    }
+
+    Writer &Writer::hex(std::uint64_t value) noexcept
+    {
+        push_slot(value);
+        return *this;
+    }
+
+    Writer &Writer::boolean(bool value) noexcept
+    {
+        push_slot(value ? 1u : 0u);
+        return *this;
+    }
+
+    Writer &Writer::str(const char *value) noexcept
+    {
+        push_slot(reinterpret_cast<std::uintptr_t>(value));
+        return *this;
+    }
+
+    Writer &Writer::vec3(float x, float y, float z) noexcept
+    {
+        return f32(x).f32(y).f32(z);
+    }
+
+    Writer &Writer::vec3(const Vector3 &value) noexcept
+    {
+        return vec3(value.x, value.y, value.z);
+    }
+
+    Writer &Writer::text(const char *value) noexcept
+    {
+        if (value != nullptr)
+        {
+            const std::size_t n = strnlen(value, k_text_len - 1);
+            std::memcpy(m_record.text, value, n);
+            m_record.text[n] = '\0';
+        }
+        return *this;
+    }
+
+    char *Writer::text_buffer() noexcept
+    {
+        return m_record.text;
+    }
+
+    void Writer::commit() noexcept
+    {
+        if (!enabled())
+        {
+            return;
+        }
+        std::call_once(s_start_once, start_drain);
+        if (s_thread == nullptr)
+        {
+            return;
+        }
+        if (!try_push(m_record))
+        {
+            s_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (s_idle.load(std::memory_order_relaxed) && s_idle.exchange(false, std::memory_order_relaxed))
+        {
+            SetEvent(s_wake);
+        }
+    }
+
+    void shutdown() noexcept
+    {
+        if (s_thread == nullptr)
+        {
+            return;
+        }
+        s_shutdown.store(true, std::memory_order_release);
+        SetEvent(s_wake);
+        // The drain is bounded by the ring size; on a timeout the module stays pinned under the running drain,
+        // as for the collision worker.
+        if (join_or_pin(s_thread, 2000, "Trace ring"))
+        {
+            s_thread = nullptr;
+        }
+    }
+
+} // namespace TPVCamera::TraceRing
@@ -0,0 +1,107 @@
+/**
+ * @file trace_ring.hpp
+ * @brief Allocation-free binary trace events for the render-thread hot path, formatted off-thread.
+ *
+ * @details A trace line from the collision stage (PhysicsCollision HIT, RenderOcclusion HIT: twenty-odd arguments)
+ *          costs a std::format pass and the logger's lock inside the frame, and trace is only ever on while chasing
+ *          a stutter. Hot-path traces instead fill a fixed-size Record -- event id, QPC timestamp, raw argument
+ *          slots, one inline text field -- and push it into a bounded lock-free ring. A background thread drains
+ *          the ring, formats each record from its event's field table and hands the line to DMK::Logger.
+ *
+ *          The writer side is a handful of stores plus one CAS; nothing is allocated, formatted or locked. A full
+ *          ring drops the record (counted and reported by the drain thread) rather than block the frame. The drain
+ *          thread starts on the first committed record and sleeps on an event the writer only signals when the
+ *          thread has gone idle, so a burst costs one SetEvent. Events commit only while the logger's trace level
+ *          is enabled.
+ *
+ *          Threading: Writer is safe from any thread (multi-producer ring); the drain thread is the only consumer.
+ */
+#ifndef TPVCAMERA_TRACE_RING_HPP
+#define TPVCAMERA_TRACE_RING_HPP
+
+#include "math_utils.hpp"
+
+#include <cstdint>
+
+namespace TPVCamera::TraceRing
+{
+
+    /**
+     * @enum Event
+     * @brief The ring's event types. Each has a field table in trace_ring.cpp that the writer fills in order.
+     */
+    enum class Event : std::uint16_t
+    {
+        PhysicsCollisionHit,
+        RenderOcclusionHit,
+        OrbitMoveStart,
+        OrbitMoveStop,
+        OrbitStaleRetrip,
+        OrbitBodyTurn,
+        Count
+    };
+
+    /// Raw argument slots per record (a Vector3 takes three).
+    inline constexpr int k_max_slots = 24;
+
+    /// Inline text field length, terminator included (longer text is truncated).
+    inline constexpr int k_text_len = 128;
+
+    /**
+     * @struct Record
+     * @brief One ring entry: the event, its timestamp and its raw arguments, in the field-table order.
+     */
+    struct Record
+    {
+        Event event = Event::Count;
+        std::uint8_t n_slots = 0;
+        std::int64_t ticks = 0;
+        std::uint64_t slots[k_max_slots] = {};
+        char text[k_text_len] = {};
+    };
+
+    /** @brief Whether trace events commit (the logger's trace level is enabled). */
+    [[nodiscard]] bool enabled() noexcept;
+
+    /**
+     * @class Writer
+     * @brief Builds one Record on the stack and pushes it on commit().
+     * @details Append the arguments in the order of the event's field table; a string argument passed to str()
+     *          must outlive the drain (a literal or a static table entry), text() copies.
+     */
+    class Writer
+    {
+    public:
+        explicit Writer(Event event) noexcept;
+
+        Writer &f32(float value) noexcept;
+        Writer &i64(std::int64_t value) noexcept;
+        Writer &hex(std::uint64_t value) noexcept;
+        Writer &boolean(bool value) noexcept;
+        /** @brief A string with static storage duration. */
+        Writer &str(const char *value) noexcept;
+        Writer &vec3(float x, float y, float z) noexcept;
+        Writer &vec3(const Vector3 &value) noexcept;
+        /** @brief Copies @p value (truncated to k_text_len - 1) into the record's text field. */
+        Writer &text(const char *value) noexcept;
+        /** @brief The record's text field, for a caller that fills it in place (k_text_len bytes). */
+        [[nodiscard]] char *text_buffer() noexcept;
+
+        /** @brief Pushes the record if trace is enabled. A full ring drops it. */
+        void commit() noexcept;
+
+    private:
+        void push_slot(std::uint64_t bits) noexcept;
+
+        Record m_record;
+    };
+
+    /**
+     * @brief Drains what is left in the ring and joins the drain thread. Safe if it never started.
+     * @details Called from shutdown() while the logger is still up.
+     */
+    void shutdown() noexcept;
+
+} // namespace TPVCamera::TraceRing
+
+#endif // TPVCAMERA_TRACE_RING_HPP
@@ -0,0 +1,265 @@
+/**
+ * @file vertex_kernels.cpp
+ * @brief Scalar and AVX2 implementations of the render-mesh vertex kernels (see vertex_kernels.hpp).
+ */
+
+#include "vertex_kernels.hpp"
+
+#include <intrin.h>
+#include <immintrin.h>
+
+#include <cmath>
+#include <cstddef>
+
+namespace TPVCamera::VertexKernels
+{
+
+    namespace
+    {
+        // AVX2 needs the CPU feature (CPUID.7:EBX bit 5) AND the OS saving YMM state (OSXSAVE + XCR0 bits 1..2);
+        // a CPU with AVX2 under an OS that does not enable it would fault on the first YMM instruction.
+        bool detect_avx2() noexcept
+        {
+            int regs[4] = {};
+            __cpuid(regs, 0);
+            if (regs[0] < 7)
+            {
+                return false;
+            }
+            __cpuid(regs, 1);
+            const bool osxsave = (regs[2] & (1 << 27)) != 0;
+            const bool avx = (regs[2] & (1 << 28)) != 0;
+            if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+            {
+                return false;
+            }
+            __cpuidex(regs, 7, 0);
+            return (regs[1] & (1 << 5)) != 0;
+        }
+
+        const bool s_avx2 = detect_avx2();
+
+        // The AVX2 gathers index the stream in float units, so the stride must be a whole number of floats (the
+        // decoded FSL_READ cache is 12; anything else is a layout we have not seen and takes the scalar path).
+        bool gatherable(int stride) noexcept
+        {
+            return s_avx2 && stride > 0 && (stride % 4) == 0;
+        }
+
+        const float *vertex_at(const std::uint8_t *pos, int stride, int v) noexcept
+        {
+            return reinterpret_cast<const float *>(pos + static_cast<std::size_t>(v) * stride);
+        }
+
+        void project_scalar(const std::uint8_t *pos, int stride, int first, int last, const ScreenProjection &p,
+                            float *out_h, float *out_v, float *out_depth) noexcept
+        {
+            const float *M = p.m;
+            for (int v = first; v < last; ++v)
+            {
+                const float *lp = vertex_at(pos, stride, v);
+                const float lx = lp[0], ly = lp[1], lz = lp[2];
+                const float wx = M[0] * lx + M[1] * ly + M[2] * lz + M[3];
+                const float wy = M[4] * lx + M[5] * ly + M[6] * lz + M[7];
+                const float wz = M[8] * lx + M[9] * ly + M[10] * lz + M[11];
+                const float ex = wx - p.cam_x, ey = wy - p.cam_y, ez = wz - p.cam_z;
+                const float d = std::sqrt(ex * ex + ey * ey + ez * ez);
+                if (d < 1e-3f)
+                {
+                    out_h[v] = 0.0f;
+                    out_v[v] = 0.0f;
+                    out_depth[v] = 0.0f;
+                    continue;
+                }
+                out_h[v] = (ex * p.right_x + ey * p.right_y) / d; // right z == 0
+                out_v[v] = (ex * p.up_x + ey * p.up_y + ez * p.up_z) / d;
+                out_depth[v] = ex * p.view_x + ey * p.view_y + ez * p.view_z;
+            }
+        }
+
+        // Loads the x / y / z lanes of vertices v..v+7 from the strided stream. off_step is stride / 4.
+        void gather_xyz(const float *base, int v, int off_step, __m256 &x, __m256 &y, __m256 &z) noexcept
+        {
+            const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            const __m256i off = _mm256_mullo_epi32(_mm256_add_epi32(_mm256_set1_epi32(v), lane),
+                                                   _mm256_set1_epi32(off_step));
+            x = _mm256_i32gather_ps(base, off, 4);
+            y = _mm256_i32gather_ps(base + 1, off, 4);
+            z = _mm256_i32gather_ps(base + 2, off, 4);
+        }
+
+        // Row r of the Matrix34 applied to (x, y, z, 1), in the scalar evaluation order.
+        __m256 transform_row(const float *row, __m256 x, __m256 y, __m256 z) noexcept
+        {
+            __m256 acc =
+                _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(row[0]), x), _mm256_mul_ps(_mm256_set1_ps(row[1]), y));
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_set1_ps(row[2]), z));
+            return _mm256_add_ps(acc, _mm256_set1_ps(row[3]));
+        }
+
+        // a.x*b.x + a.y*b.y + a.z*b.z in the scalar evaluation order.
+        __m256 dot3(__m256 ax, __m256 ay, __m256 az, __m256 bx, __m256 by, __m256 bz) noexcept
+        {
+            return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)), _mm256_mul_ps(az, bz));
+        }
+
+        // Returns the first vertex NOT processed (the caller finishes the tail scalar).
+        int project_avx2(const std::uint8_t *pos, int stride, int first, int last, const ScreenProjection &p,
+                         float *out_h, float *out_v, float *out_depth) noexcept
+        {
+            const float *base = reinterpret_cast<const float *>(pos);
+            const int off_step = stride / 4;
+            const __m256 cam_x = _mm256_set1_ps(p.cam_x), cam_y = _mm256_set1_ps(p.cam_y),
+                         cam_z = _mm256_set1_ps(p.cam_z);
+            const __m256 right_x = _mm256_set1_ps(p.right_x), right_y = _mm256_set1_ps(p.right_y);
+            const __m256 up_x = _mm256_set1_ps(p.up_x), up_y = _mm256_set1_ps(p.up_y), up_z = _mm256_set1_ps(p.up_z);
+            const __m256 view_x = _mm256_set1_ps(p.view_x), view_y = _mm256_set1_ps(p.view_y),
+                         view_z = _mm256_set1_ps(p.view_z);
+            const __m256 near_eps = _mm256_set1_ps(1e-3f);
+            const __m256 zero = _mm256_setzero_ps();
+            int v = first;
+            for (; v + 8 <= last; v += 8)
+            {
+                __m256 lx, ly, lz;
+                gather_xyz(base, v, off_step, lx, ly, lz);
+                const __m256 ex = _mm256_sub_ps(transform_row(p.m + 0, lx, ly, lz), cam_x);
+                const __m256 ey = _mm256_sub_ps(transform_row(p.m + 4, lx, ly, lz), cam_y);
+                const __m256 ez = _mm256_sub_ps(transform_row(p.m + 8, lx, ly, lz), cam_z);
+                const __m256 d = _mm256_sqrt_ps(dot3(ex, ey, ez, ex, ey, ez));
+                const __m256 near_mask = _mm256_cmp_ps(d, near_eps, _CMP_LT_OQ);
+                const __m256 h =
+                    _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(ex, right_x), _mm256_mul_ps(ey, right_y)), d);
+                const __m256 vv = _mm256_div_ps(dot3(ex, ey, ez, up_x, up_y, up_z), d);
+                const __m256 depth = dot3(ex, ey, ez, view_x, view_y, view_z);
+                _mm256_storeu_ps(out_h + v, _mm256_blendv_ps(h, zero, near_mask));
+                _mm256_storeu_ps(out_v + v, _mm256_blendv_ps(vv, zero, near_mask));
+                _mm256_storeu_ps(out_depth + v, _mm256_blendv_ps(depth, zero, near_mask));
+            }
+            _mm256_zeroupper();
+            return v;
+        }
+
+        int tube_scalar(const std::uint8_t *pos, int stride, int first, int last, const SightlineTube &t,
+                        float &best) noexcept
+        {
+            const float *M = t.m;
+            const float colr2 = t.radius * t.radius;
+            int hits = 0;
+            for (int v = first; v < last; ++v)
+            {
+                const float *lp = vertex_at(pos, stride, v);
+                const float lx = lp[0], ly = lp[1], lz = lp[2];
+                const float wx = M[0] * lx + M[1] * ly + M[2] * lz + M[3];
+                const float wy = M[4] * lx + M[5] * ly + M[6] * lz + M[7];
+                const float wz = M[8] * lx + M[9] * ly + M[10] * lz + M[11];
+                const float rx = wx - t.pivot_x, ry = wy - t.pivot_y, rz = wz - t.pivot_z;
+                const float tpar = rx * t.dir_x + ry * t.dir_y + rz * t.dir_z;
+                if (tpar <= 0.0f || tpar > t.arm_len)
+                {
+                    continue;
+                }
+                const float ex = rx - tpar * t.dir_x, ey = ry - tpar * t.dir_y, ez = rz - tpar * t.dir_z;
+                const float perp2 = ex * ex + ey * ey + ez * ez;
+                if (perp2 > colr2)
+                {
+                    continue;
+                }
+                const float d = tpar - std::sqrt(colr2 - perp2);
+                if (d <= 0.0f)
+                {
+                    continue;
+                }
+                ++hits;
+                if (d < best)
+                {
+                    best = d;
+                }
+            }
+            return hits;
+        }
+
+        // Processes whole 8-vertex groups from @p first; returns the hit count and advances @p next to the tail.
+        int tube_avx2(const std::uint8_t *pos, int stride, int first, int last, const SightlineTube &t, float &best,
+                      int &next) noexcept
+        {
+            const float *base = reinterpret_cast<const float *>(pos);
+            const int off_step = stride / 4;
+            const __m256 pivot_x = _mm256_set1_ps(t.pivot_x), pivot_y = _mm256_set1_ps(t.pivot_y),
+                         pivot_z = _mm256_set1_ps(t.pivot_z);
+            const __m256 dir_x = _mm256_set1_ps(t.dir_x), dir_y = _mm256_set1_ps(t.dir_y),
+                         dir_z = _mm256_set1_ps(t.dir_z);
+            const __m256 arm_len = _mm256_set1_ps(t.arm_len);
+            const __m256 colr2 = _mm256_set1_ps(t.radius * t.radius);
+            const __m256 zero = _mm256_setzero_ps();
+            __m256 best_v = _mm256_set1_ps(best);
+            int hits = 0;
+            int v = first;
+            for (; v + 8 <= last; v += 8)
+            {
+                __m256 lx, ly, lz;
+                gather_xyz(base, v, off_step, lx, ly, lz);
+                const __m256 rx = _mm256_sub_ps(transform_row(t.m + 0, lx, ly, lz), pivot_x);
+                const __m256 ry = _mm256_sub_ps(transform_row(t.m + 4, lx, ly, lz), pivot_y);
+                const __m256 rz = _mm256_sub_ps(transform_row(t.m + 8, lx, ly, lz), pivot_z);
+                const __m256 tpar = dot3(rx, ry, rz, dir_x, dir_y, dir_z);
+                const __m256 ex = _mm256_sub_ps(rx, _mm256_mul_ps(tpar, dir_x));
+                const __m256 ey = _mm256_sub_ps(ry, _mm256_mul_ps(tpar, dir_y));
+                const __m256 ez = _mm256_sub_ps(rz, _mm256_mul_ps(tpar, dir_z));
+                const __m256 perp2 = dot3(ex, ey, ez, ex, ey, ez);
+                // Lanes failing a test get a NaN d from the sqrt of a negative; the mask below drops them.
+                const __m256 d = _mm256_sub_ps(tpar, _mm256_sqrt_ps(_mm256_sub_ps(colr2, perp2)));
+                __m256 ok =
+                    _mm256_and_ps(_mm256_cmp_ps(tpar, zero, _CMP_GT_OQ), _mm256_cmp_ps(tpar, arm_len, _CMP_LE_OQ));
+                ok = _mm256_and_ps(ok, _mm256_cmp_ps(perp2, colr2, _CMP_LE_OQ));
+                ok = _mm256_and_ps(ok, _mm256_cmp_ps(d, zero, _CMP_GT_OQ));
+                const int lanes = _mm256_movemask_ps(ok);
+                if (lanes != 0)
+                {
+                    hits += static_cast<int>(__popcnt(static_cast<unsigned int>(lanes)));
+                    best_v = _mm256_min_ps(best_v, _mm256_blendv_ps(best_v, d, ok));
+                }
+            }
+            // Horizontal min of the 8 lanes.
+            __m128 m4 = _mm_min_ps(_mm256_castps256_ps128(best_v), _mm256_extractf128_ps(best_v, 1));
+            m4 = _mm_min_ps(m4, _mm_movehl_ps(m4, m4));
+            m4 = _mm_min_ss(m4, _mm_shuffle_ps(m4, m4, 0x1));
+            best = _mm_cvtss_f32(m4);
+            _mm256_zeroupper();
+            next = v;
+            return hits;
+        }
+    } // namespace
+
+    void project_vertices(const std::uint8_t *pos, int stride, int first, int count, const ScreenProjection &p,
+                          float *out_h, float *out_v, float *out_depth) noexcept
+    {
+        const int last = first + count;
+        int v = first;
+        if (gatherable(stride))
+        {
+            v = project_avx2(pos, stride, first, last, p, out_h, out_v, out_depth);
+        }
+        project_scalar(pos, stride, v, last, p, out_h, out_v, out_depth);
+    }
+
+    int sightline_tube_scan(const std::uint8_t *pos, int stride, int n_verts, const SightlineTube &tube,
+                            float *out_best) noexcept
+    {
+        float best = *out_best;
+        int hits = 0;
+        int v = 0;
+        if (gatherable(stride))
+        {
+            hits += tube_avx2(pos, stride, 0, n_verts, tube, best, v);
+        }
+        hits += tube_scalar(pos, stride, v, n_verts, tube, best);
+        *out_best = best;
+        return hits;
+    }
+
+    bool avx2_active() noexcept
+    {
+        return s_avx2;
+    }
+
+} // namespace TPVCamera::VertexKernels
@@ -0,0 +1,80 @@
+/**
+ * @file vertex_kernels.hpp
+ * @brief Bulk render-mesh vertex transform / projection kernels for the render-occlusion rasterizer.
+ *
+ * @details render_occlusion.cpp walks the engine-decoded float3 position stream of a brush's render mesh (up to
+ *          RENDER_OCCLUSION_VERT_MAX vertices) in two hot loops: the coverage raster projects every vertex a
+ *          triangle touches to screen-angular (h, v, depth), and the cloth clamp ray-marches every vertex against
+ *          the pivot->camera sightline tube. Both are the same few dozen flops per vertex over a strided stream,
+ *          so each has an AVX2 kernel that handles 8 vertices per iteration (the x / y / z lanes are gathered from
+ *          the stride) and a scalar fallback. The variant is picked once from CPUID (AVX2 plus OS YMM state
+ *          support); MSVC emits the intrinsics without /arch:AVX2, so one binary serves both.
+ *
+ *          The AVX2 paths use separate multiplies and adds in the scalar evaluation order (no FMA contraction),
+ *          so they produce the same IEEE results as the scalar loops they replace: a coverage or cloth verdict
+ *          never depends on the CPU it ran on. Callers run these inside their own SEH frame (the position stream
+ *          is engine memory); the kernels carry no unwinding objects.
+ */
+#ifndef TPVCAMERA_VERTEX_KERNELS_HPP
+#define TPVCAMERA_VERTEX_KERNELS_HPP
+
+#include <cstdint>
+
+namespace TPVCamera::VertexKernels
+{
+
+    /**
+     * @struct ScreenProjection
+     * @brief World transform plus camera frame for @ref project_vertices.
+     * @details m is the brush's row-major Matrix34 (row r = m[4r..4r+3], translation in column 3). The camera right
+     *          axis is world-horizontal (its z is 0), matching CoverageProjection in render_occlusion.cpp.
+     */
+    struct ScreenProjection
+    {
+        float m[12];
+        float cam_x, cam_y, cam_z;
+        float right_x, right_y;
+        float up_x, up_y, up_z;
+        float view_x, view_y, view_z;
+    };
+
+    /**
+     * @brief Transforms vertices [@p first, @p first + @p count) of a strided float3 stream to world and projects
+     *        them to screen-angular coordinates.
+     * @details Writes out_h / out_v (lateral / vertical offset per unit distance from the camera) and out_depth
+     *          (distance along the view direction) at the same indices as the vertices. A vertex within 1e-3 of the
+     *          camera projects to (0, 0, 0).
+     */
+    void project_vertices(const std::uint8_t *pos, int stride, int first, int count, const ScreenProjection &p,
+                          float *out_h, float *out_v, float *out_depth) noexcept;
+
+    /**
+     * @struct SightlineTube
+     * @brief The pivot->camera sightline for @ref sightline_tube_scan.
+     */
+    struct SightlineTube
+    {
+        float m[12]; // brush world Matrix34, as in ScreenProjection
+        float pivot_x, pivot_y, pivot_z;
+        float dir_x, dir_y, dir_z; // unit pivot -> camera
+        float arm_len;
+        float radius;
+    };
+
+    /**
+     * @brief Ray-marches @p n_verts vertices of a strided float3 stream against the sightline tube.
+     * @details For every vertex between the pivot and the camera (0 < t <= arm_len along dir) and within
+     *          tube.radius of the sightline, the distance d = t - sqrt(radius^2 - perp^2) at which the growing
+     *          sightline first reaches it; vertices with d <= 0 (the pivot is inside the tube around them) are
+     *          ignored. Returns the number of such vertices and writes the smallest d to @p out_best (left
+     *          unchanged when none qualifies, so the caller seeds it with its "unavailable" sentinel).
+     */
+    int sightline_tube_scan(const std::uint8_t *pos, int stride, int n_verts, const SightlineTube &tube,
+                            float *out_best) noexcept;
+
+    /** @brief Whether the AVX2 kernels are in use on this CPU (logged once at init). */
+    [[nodiscard]] bool avx2_active() noexcept;
+
+} // namespace TPVCamera::VertexKernels
+
+#endif // TPVCAMERA_VERTEX_KERNELS_HPP
@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <mutex>
 
 #include "math_utils.hpp"
 
@@ -21,17 +22,17 @@
  *
  *          A seqlock resolves both: the reader takes a wait-free, tear-free
  *          snapshot (it retries while a write is in flight rather than locking),
- *          and writers serialize among themselves. The per-component stores are
+ *          and writers serialize among themselves on a small writer mutex owned
+ *          by this holder. The per-component stores are
  *          relaxed atomics so the concurrent reader is never a data race, and the
  *          odd/even sequence counter lets the reader detect and discard a torn
  *          read. This mirrors the sequence-counter publish that DetourModKit's
  *          Profiler uses to expose sample slots without a reader lock.
  *
- * @warning Writers must be mutually exclusive. An overlap would break the
- *          odd/even sequence invariant (the reader could spin or observe a torn
- *          value). In this mod every writer runs under
- *          CameraProfileManager::m_profileMutex; the one-time startup seed in
- *          DllMain happens before that system's writer threads exist.
+ *          The writer mutex is this holder's own rather than
+ *          CameraProfileManager::m_profileMutex, so the held-key adjustment loop
+ *          (up to 60 writes a second) never queues behind the profile CRUD, and
+ *          a profile switch never waits on it for longer than one store.
  */
 class CameraOffsetState
 {
@@ -64,13 +65,33 @@ public:
     }
 
     /**
-     * @brief Publishes a new offset. The caller must hold the writer mutex.
+     * @brief Publishes a new offset.
      * @details Bumps the sequence to odd (write in progress), stores the
      *          components, then bumps it to even (published). A reader that
      *          observes the odd or changed sequence retries.
      * @param offset The new offset to publish.
      */
     void store(const Vector3 &offset) noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        publish(offset);
+    }
+
+    /**
+     * @brief Adds a delta to the current offset. The load and the publish run
+     *        under one writer-mutex hold, so a concurrent writer cannot slip
+     *        between them.
+     * @param delta The per-axis delta to add.
+     */
+    void add(const Vector3 &delta) noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        publish(load() + delta);
+    }
+
+private:
+    /// The seqlock publish itself; the caller holds m_writeMutex.
+    void publish(const Vector3 &offset) noexcept
     {
         m_seq.fetch_add(1, std::memory_order_relaxed); // enter write (odd)
         // The release fence keeps the component stores below from being reordered
@@ -83,18 +104,7 @@ public:
         m_seq.fetch_add(1, std::memory_order_release); // leave write (even), publish
     }
 
-    /**
-     * @brief Adds a delta to the current offset. The caller must hold the writer
-     *        mutex so the load and the publish are not interleaved with another
-     *        writer.
-     * @param delta The per-axis delta to add.
-     */
-    void add(const Vector3 &delta) noexcept
-    {
-        store(load() + delta);
-    }
-
-private:
+    std::mutex m_writeMutex; // serializes writers only; load() never takes it
     std::atomic<uint32_t> m_seq{0};
     std::atomic<float> m_x{0.0f};
     std::atomic<float> m_y{0.0f};
@@ -11,6 +11,7 @@
 #include <ctime>
 #include <iomanip>
 #include <filesystem>
+#include <system_error>
 
 
 using json = nlohmann::json;
@@ -18,6 +19,196 @@ using json = nlohmann::json;
 namespace TPVToggle
 {
 
+namespace
+{
+/**
+ * @brief SAX reader for the profiles file: builds CameraProfile entries straight
+ *        from parser events instead of materialising the whole document first.
+ * @details Keeps the DOM loader's rules: the root must be an array; a non-object
+ *          entry, or an entry whose name / category / timestamp is not a string or
+ *          whose offset x / y / z is not a number, is dropped and counted; missing
+ *          keys keep their defaults; a non-object offset and unknown keys are
+ *          ignored. Entries without a timestamp get one from the caller.
+ */
+class ProfileListReader final : public nlohmann::json_sax<json>
+{
+public:
+    struct Entry
+    {
+        CameraProfile profile{"Unnamed Profile", Vector3(0.0f, 0.0f, 0.0f), "General", ""};
+        bool hasTimestamp = false;
+    };
+
+    std::vector<Entry> entries;
+    int errorCount = 0;
+    bool rootIsArray = false;
+    std::string error;
+
+    bool null() override { return mismatch(); }
+    bool boolean(bool) override { return mismatch(); }
+    bool number_integer(number_integer_t v) override { return number(static_cast<float>(v)); }
+    bool number_unsigned(number_unsigned_t v) override { return number(static_cast<float>(v)); }
+    bool number_float(number_float_t v, const string_t &) override { return number(static_cast<float>(v)); }
+    bool binary(binary_t &) override { return mismatch(); }
+
+    bool string(string_t &v) override
+    {
+        if (m_skip != 0 || m_at != At::Entry)
+            return mismatch();
+        if (m_key == "name")
+            m_entry.profile.name = std::move(v);
+        else if (m_key == "category")
+            m_entry.profile.category = std::move(v);
+        else if (m_key == "timestamp")
+        {
+            m_entry.profile.timestamp = std::move(v);
+            m_entry.hasTimestamp = true;
+        }
+        return true;
+    }
+
+    bool start_object(std::size_t) override
+    {
+        if (m_skip != 0)
+            ++m_skip;
+        else if (m_at == At::Root)
+        {
+            m_at = At::Entry;
+            m_entry = Entry{};
+            m_valid = true;
+        }
+        else if (m_at == At::Entry && m_key == "offset")
+            m_at = At::Offset;
+        else
+            return beginSkip();
+        return true;
+    }
+
+    bool end_object() override
+    {
+        if (m_skip != 0)
+            --m_skip;
+        else if (m_at == At::Offset)
+            m_at = At::Entry;
+        else if (m_at == At::Entry)
+        {
+            m_at = At::Root;
+            if (m_valid)
+                entries.push_back(std::move(m_entry));
+            else
+                errorCount++;
+        }
+        return true;
+    }
+
+    bool start_array(std::size_t) override
+    {
+        if (m_skip != 0)
+        {
+            ++m_skip;
+            return true;
+        }
+        if (m_at == At::Start)
+        {
+            rootIsArray = true;
+            m_at = At::Root;
+            return true;
+        }
+        return beginSkip();
+    }
+
+    bool end_array() override
+    {
+        if (m_skip != 0)
+            --m_skip;
+        else if (m_at == At::Root)
+            m_at = At::Done;
+        return true;
+    }
+
+    bool key(string_t &k) override
+    {
+        if (m_skip == 0)
+            m_key = std::move(k);
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string &, const nlohmann::detail::exception &e) override
+    {
+        error = e.what();
+        return false;
+    }
+
+private:
+    enum class At
+    {
+        Start,  // before the root value
+        Root,   // inside the top-level array
+        Entry,  // inside a profile object
+        Offset, // inside its "offset" object
+        Done,
+    };
+
+    /// True when the current value sits under a key the loader reads with a fixed type.
+    [[nodiscard]] bool typedKey() const
+    {
+        if (m_at == At::Entry)
+            return m_key == "name" || m_key == "category" || m_key == "timestamp";
+        if (m_at == At::Offset)
+            return m_key == "x" || m_key == "y" || m_key == "z";
+        return false;
+    }
+
+    /// A scalar of the wrong type: a bad array entry, or a typed key that invalidates its entry.
+    bool mismatch()
+    {
+        if (m_skip != 0)
+            return true;
+        if (m_at == At::Start)
+            return false; // root is not an array
+        if (m_at == At::Root)
+            errorCount++;
+        else if (typedKey())
+            m_valid = false;
+        return true;
+    }
+
+    /// Enters a nested value the loader does not read (a non-object offset is ignored, like unknown keys).
+    bool beginSkip()
+    {
+        if (m_at == At::Start)
+            return false;
+        if (m_at == At::Root)
+            errorCount++;
+        else if (typedKey())
+            m_valid = false;
+        m_skip = 1;
+        return true;
+    }
+
+    bool number(float v)
+    {
+        if (m_skip == 0 && m_at == At::Offset)
+        {
+            if (m_key == "x")
+                m_entry.profile.offset.x = v;
+            else if (m_key == "y")
+                m_entry.profile.offset.y = v;
+            else if (m_key == "z")
+                m_entry.profile.offset.z = v;
+            return true;
+        }
+        return mismatch();
+    }
+
+    At m_at = At::Start;
+    int m_skip = 0; // nesting depth inside a value the loader skips
+    std::string m_key;
+    Entry m_entry;
+    bool m_valid = true;
+};
+} // namespace
+
 CameraProfileManager &CameraProfileManager::getInstance()
 {
     static CameraProfileManager instance;
@@ -27,18 +218,23 @@ CameraProfileManager &CameraProfileManager::getInstance()
 CameraProfileManager::CameraProfileManager()
     : m_currentProfileIndex(0), // Default to 0, validated after loading
       m_isInitialized(false),
-      m_profilesModified(false),
-      m_lastSaveTime(0)
+      m_snapshotSequence(0),
+      m_savePending(false),
+      m_pendingSequence(0),
+      m_writtenSequence(0)
 {
 }
 
 CameraProfileManager::~CameraProfileManager()
 {
-    // Attempt immediate save if modifications are pending on exit
-    if (m_profilesModified)
+    // Runs during static destruction, under the loader lock, where a join can
+    // deadlock (a thread cannot finish exiting while the lock is held). The
+    // writer is joined and flushed by shutdown() via shutdownPersistence(); a
+    // writer still attached here means that path was skipped, so it is detached
+    // instead of letting the jthread destructor join it.
+    if (m_saveThread.joinable())
     {
-        DMK::Logger::get_instance().info("CameraProfileManager: Saving modified profiles on exit...");
-        saveProfilesToJson();
+        m_saveThread.detach();
     }
 }
 
@@ -57,57 +253,57 @@ bool CameraProfileManager::loadProfiles(const std::string &directory)
     logger.info("CameraProfileManager: Loading profiles from: {}", m_jsonProfilesPath);
 
     bool jsonLoadedSuccessfully = loadProfilesFromJson();
+    rebuildProfileIndex();
 
-    // Ensure "Default" profile exists at index 0
-    auto it_default = std::find_if(m_profiles.begin(), m_profiles.end(),
-                                   [](const CameraProfile &p)
-                                   { return p.name == "Default"; });
+    // Ensure "Default" profile exists at index 0 (one index lookup instead of a name scan;
+    // the position is kept as an index because the insert / rotate below move the elements)
+    const auto it_name = m_nameIndex.find("Default");
+    const bool defaultCreated = it_name == m_nameIndex.end();
+    const size_t foundDefaultIndex = defaultCreated ? 0 : it_name->second;
+    const bool defaultMoved = !defaultCreated && foundDefaultIndex != 0;
 
-    if (it_default == m_profiles.end())
+    if (defaultCreated)
     {
         logger.info("CameraProfileManager: 'Default' profile not found. Creating new default profile.");
         m_profiles.insert(m_profiles.begin(), CameraProfile("Default", Vector3(0.0f, 0.0f, 0.0f), "Default", generateTimestamp()));
         // Don't call debounce save yet, wait until end of load
     }
+    else if (defaultMoved)
+    {
+        logger.debug("CameraProfileManager: Moving 'Default' profile from index {} to 0.", foundDefaultIndex);
+        const auto it_default = m_profiles.begin() + static_cast<std::ptrdiff_t>(foundDefaultIndex);
+        std::rotate(m_profiles.begin(), it_default, it_default + 1);
+    }
     else
     {
-        size_t found_default_idx = std::distance(m_profiles.begin(), it_default);
-        if (found_default_idx != 0)
-        {
-            logger.debug("CameraProfileManager: Moving 'Default' profile from index {} to 0.", found_default_idx);
-            std::rotate(m_profiles.begin(), it_default, it_default + 1);
-        }
-        else
-        {
-            logger.debug("CameraProfileManager: 'Default' profile found at index 0.");
-        }
+        logger.debug("CameraProfileManager: 'Default' profile found at index 0.");
+    }
+    if (defaultCreated || defaultMoved)
+    {
+        rebuildProfileIndex(); // Every index shifted
     }
 
     m_isInitialized = true;
     logger.debug("CameraProfileManager: Manager initialized flag set.");
+    startPersistence();
 
     // Now that initialized flag is true, setActiveProfile can run correctly.
     // Activate the "Default" profile (index 0) initially, loading its saved state.
     setActiveProfile(0, false); // false = no transition on initial load is appropriate.
 
     // Consolidate modification check and debounce trigger here if Default was created/moved
-    if (it_default == m_profiles.end() || (it_default != m_profiles.end() && std::distance(m_profiles.begin(), it_default) != 0))
+    if (defaultCreated && !jsonLoadedSuccessfully && m_profiles.size() == 1)
     {
-        // If default was missing OR if it was found but had to be moved
-        if (!jsonLoadedSuccessfully && m_profiles.size() == 1)
-        {
-            // Only mark modified if we just created the default and nothing was loaded from JSON.
-            // If JSON was loaded and we just moved default, assume user wants loaded state preserved initially.
-            // Maybe even only save if *only* Default exists and it was created now.
-            logger.debug("CameraProfileManager: Marking profiles as modified (Default created/moved).");
-            markProfilesModifiedAndDebounceSave();
-        }
-        else if (it_default != m_profiles.end() && std::distance(m_profiles.begin(), it_default) != 0)
-        {
-            // Also mark modified if we had to rotate the existing Default profile from JSON
-            logger.debug("CameraProfileManager: Marking profiles as modified (Default rotated).");
-            markProfilesModifiedAndDebounceSave();
-        }
+        // Only mark modified if we just created the default and nothing was loaded from JSON.
+        // If JSON was loaded and we just moved default, assume user wants loaded state preserved initially.
+        logger.debug("CameraProfileManager: Marking profiles as modified (Default created/moved).");
+        markProfilesModifiedAndDebounceSave();
+    }
+    else if (defaultMoved)
+    {
+        // Also mark modified if we had to rotate the existing Default profile from JSON
+        logger.debug("CameraProfileManager: Marking profiles as modified (Default rotated).");
+        markProfilesModifiedAndDebounceSave();
     }
 
     // Log final state *after* potentially setting active profile correctly.
@@ -141,52 +337,50 @@ bool CameraProfileManager::loadProfilesFromJson()
         return false; // Indicate file not found
     }
 
-    std::vector<CameraProfile> loaded_profiles_temp; // Load into temporary vector
-
     try
     {
-        std::ifstream file(m_jsonProfilesPath);
+        std::ifstream file(m_jsonProfilesPath, std::ios::binary);
         if (!file.is_open())
         {
             logger.error("CameraProfileManager: Failed to open JSON profiles file for reading: {}", m_jsonProfilesPath);
             return false; // Indicate file error
         }
 
-        json profilesJson;
-        file >> profilesJson;
+        // Profiles are built from parser events as the buffer is read; no DOM is kept.
+        ProfileListReader reader;
+        const bool parsed = json::sax_parse(file, &reader);
         file.close();
 
-        if (!profilesJson.is_array())
+        if (!parsed && !reader.error.empty())
         {
+            logger.error("CameraProfileManager: JSON parsing error: {} in file: {}", reader.error, m_jsonProfilesPath);
+            m_profiles.clear(); // Ensure profiles list is empty on error
+            return false;       // Indicate parse error
+        }
+        if (!reader.rootIsArray)
+        {
+            // The reader stops at the first value when the root is not an array.
             logger.error("CameraProfileManager: Invalid JSON format in profiles file (expected an array): {}", m_jsonProfilesPath);
             return false; // Indicate format error
         }
 
-        if (profilesJson.empty())
+        if (reader.entries.empty() && reader.errorCount == 0)
         {
             logger.info("CameraProfileManager: Profiles file is empty: {}", m_jsonProfilesPath);
             return true; // Successfully loaded an empty list
         }
 
-        int errorCount = 0;
-        for (const auto &profileJson : profilesJson)
+        std::vector<CameraProfile> loaded_profiles_temp; // Load into temporary vector
+        loaded_profiles_temp.reserve(reader.entries.size());
+        for (auto &entry : reader.entries)
         {
-            if (!profileJson.is_object())
+            if (!entry.hasTimestamp)
             {
-                logger.warning("CameraProfileManager: Skipping non-object entry in profiles JSON array.");
-                errorCount++;
-                continue;
-            }
-            CameraProfile profile = profileFromJson(profileJson); // Handles errors per object
-            if (profile.name.rfind("ErrorProfile", 0) != 0)       // Check it wasn't an error profile
-            {
-                loaded_profiles_temp.push_back(profile);
-            }
-            else
-            {
-                errorCount++;
+                entry.profile.timestamp = generateTimestamp();
             }
+            loaded_profiles_temp.push_back(std::move(entry.profile));
         }
+        const int errorCount = reader.errorCount;
 
         if (errorCount > 0)
         {
@@ -203,18 +397,8 @@ bool CameraProfileManager::loadProfilesFromJson()
             logger.warning("CameraProfileManager: No valid profiles found in JSON file: {}", m_jsonProfilesPath);
         }
 
-        // Mark as unmodified since state now matches the file (or empty if file was bad/empty)
-        m_profilesModified = false;
-        m_lastSaveTime = std::time(nullptr);
-
         return true; // Indicate successful processing of the file
     }
-    catch (const json::parse_error &e)
-    {
-        logger.error("CameraProfileManager: JSON parsing error: {} in file: {}", e.what(), m_jsonProfilesPath);
-        m_profiles.clear(); // Ensure profiles list is empty on error
-        return false;       // Indicate parse error
-    }
     catch (const std::exception &e)
     {
         logger.error("CameraProfileManager: Error reading or processing profiles file: {}. File: {}", e.what(), m_jsonProfilesPath);
@@ -225,22 +409,61 @@ bool CameraProfileManager::loadProfilesFromJson()
 
 bool CameraProfileManager::saveProfilesToJson()
 {
-    std::lock_guard<std::recursive_mutex> lock(m_profileMutex);
-    DMK::Logger &logger = DMK::Logger::get_instance();
+    std::vector<CameraProfile> snapshot;
+    std::string path;
+    uint64_t sequence = 0;
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_profileMutex);
+        if (!m_isInitialized)
+        {
+            DMK::Logger::get_instance().warning("CameraProfileManager: Attempted to save profiles before initialization.");
+            return false;
+        }
 
-    if (!m_isInitialized)
+        // Intentionally allow saving an empty list (e.g., after deleting all user profiles)
+        // The load logic handles creating 'Default' if the file is empty or missing.
+        snapshot = m_profiles;
+        path = m_jsonProfilesPath;
+        sequence = ++m_snapshotSequence;
+    }
+    const bool saved = writeSnapshot(snapshot, path, sequence);
+
+    // Only a snapshot that reached the disk supersedes whatever the writer has queued. On failure the queue keeps
+    // its retry, now carrying this newer snapshot.
+    std::lock_guard<std::mutex> saveLock(m_saveMutex);
+    if (m_savePending && m_pendingSequence <= sequence)
     {
-        logger.warning("CameraProfileManager: Attempted to save profiles before initialization.");
-        return false;
+        if (saved)
+        {
+            m_savePending = false;
+            m_pendingProfiles.clear();
+        }
+        else
+        {
+            m_pendingProfiles = std::move(snapshot);
+            m_pendingPath = std::move(path);
+            m_pendingSequence = sequence;
+        }
     }
+    return saved;
+}
 
-    // Intentionally allow saving an empty list (e.g., after deleting all user profiles)
-    // The load logic handles creating 'Default' if the file is empty or missing.
+bool CameraProfileManager::writeSnapshot(const std::vector<CameraProfile> &profiles, const std::string &path,
+                                         uint64_t sequence)
+{
+    DMK::Logger &logger = DMK::Logger::get_instance();
+    std::lock_guard<std::mutex> lock(m_writeMutex);
+
+    // An explicit save and the writer can race; never let an older list overwrite a newer one.
+    if (sequence <= m_writtenSequence)
+    {
+        return true;
+    }
 
     json profilesArray = json::array();
     try
     {
-        for (const auto &profile : m_profiles)
+        for (const auto &profile : profiles)
         {
             json profileJson;
             profileToJson(profile, profileJson);
@@ -253,13 +476,15 @@ bool CameraProfileManager::saveProfilesToJson()
         return false; // Don't proceed if serialization fails
     }
 
+    // Write a sibling temp file and rename it over the real one, so a crash or
+    // a full disk mid-write never leaves a truncated profiles file behind.
+    const std::string tempPath = path + ".tmp";
     try
     {
-        std::ofstream outFile(m_jsonProfilesPath);
+        std::ofstream outFile(tempPath, std::ios::trunc);
         if (!outFile.is_open())
         {
-            logger.error("CameraProfileManager: Failed to open JSON file for writing: {}", m_jsonProfilesPath);
-            // Keep m_profilesModified = true if open fails
+            logger.error("CameraProfileManager: Failed to open JSON file for writing: {}", tempPath);
             return false;
         }
 
@@ -267,25 +492,32 @@ bool CameraProfileManager::saveProfilesToJson()
         outFile.flush();
         if (!outFile.good())
         {
-            logger.error("CameraProfileManager: Failed to write all profile data to JSON file: {}", m_jsonProfilesPath);
+            logger.error("CameraProfileManager: Failed to write all profile data to JSON file: {}", tempPath);
             outFile.close();
-            // Keep m_profilesModified = true if write fails
+            std::error_code ec;
+            std::filesystem::remove(tempPath, ec);
             return false;
         }
-
         outFile.close();
 
-        // Save successful: reset flag and update timestamp
-        m_profilesModified = false;
-        m_lastSaveTime = std::time(nullptr);
+        // std::filesystem::rename replaces an existing target (MoveFileExW with
+        // MOVEFILE_REPLACE_EXISTING on Windows).
+        std::error_code ec;
+        std::filesystem::rename(tempPath, path, ec);
+        if (ec)
+        {
+            logger.error("CameraProfileManager: Failed to replace profiles file {}: {}", path, ec.message());
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
 
-        logger.info("CameraProfileManager: Successfully saved {} profiles to {}", m_profiles.size(), m_jsonProfilesPath);
+        m_writtenSequence = sequence;
+        logger.info("CameraProfileManager: Successfully saved {} profiles to {}", profiles.size(), path);
         return true;
     }
     catch (const std::exception &e) // Catch potential filesystem errors during write/close
     {
         logger.error("CameraProfileManager: Filesystem error saving profiles to JSON: {}", e.what());
-        // Keep m_profilesModified = true on other errors
         return false;
     }
 }
@@ -293,19 +525,119 @@ bool CameraProfileManager::saveProfilesToJson()
 // Internal function to trigger save after modifications to m_profiles
 void CameraProfileManager::markProfilesModifiedAndDebounceSave()
 {
-    // Assumes lock is already held by caller
+    // Assumes lock is already held by caller, so the copy is consistent and
+    // snapshot numbers follow edit order.
     if (!m_isInitialized)
         return; // Don't try to save if not ready
 
-    m_profilesModified = true;
-    time_t now_time = std::time(nullptr);
-    if (now_time - m_lastSaveTime >= SAVE_DEBOUNCE_SECONDS)
+    if (!m_saveThread.joinable())
     {
-        saveProfilesToJson(); // This resets m_profilesModified if successful
+        // No writer (it failed to start, or shutdown() already stopped it):
+        // fall back to saving here.
+        saveProfilesToJson();
+        return;
     }
-    else
+
+    std::vector<CameraProfile> snapshot = m_profiles;
+    const uint64_t sequence = ++m_snapshotSequence;
     {
-        DMK::Logger::get_instance().debug("CameraProfileManager: Profile save debounced (change marked).");
+        std::lock_guard<std::mutex> saveLock(m_saveMutex);
+        const auto now = std::chrono::steady_clock::now();
+        if (!m_savePending)
+        {
+            m_burstStart = now;
+        }
+        m_lastChange = now;
+        m_pendingProfiles = std::move(snapshot);
+        m_pendingPath = m_jsonProfilesPath;
+        m_pendingSequence = sequence;
+        m_savePending = true;
+    }
+    m_saveCv.notify_one();
+    DMK::Logger::get_instance().debug("CameraProfileManager: Profile snapshot {} queued for saving.", sequence);
+}
+
+void CameraProfileManager::startPersistence()
+{
+    if (m_saveThread.joinable())
+    {
+        return;
+    }
+    try
+    {
+        m_saveThread = std::jthread([this](std::stop_token stop)
+                                    { persistenceThread(stop); });
+    }
+    catch (const std::system_error &e)
+    {
+        DMK::Logger::get_instance().warning("CameraProfileManager: Could not start the profile writer ({}); saving synchronously.",
+                                            e.what());
+    }
+}
+
+void CameraProfileManager::shutdownPersistence()
+{
+    if (!m_saveThread.joinable())
+    {
+        return;
+    }
+    // request_stop() wakes the condition variable; the writer flushes what is queued before leaving.
+    m_saveThread.request_stop();
+    m_saveThread.join();
+}
+
+void CameraProfileManager::persistenceThread(std::stop_token stop)
+{
+    std::unique_lock<std::mutex> lock(m_saveMutex);
+    for (;;)
+    {
+        // Returns false only when stop was requested with nothing queued.
+        if (!m_saveCv.wait(lock, stop, [this]
+                           { return m_savePending; }))
+        {
+            break;
+        }
+
+        // Coalesce a burst: write once it has been quiet for SAVE_QUIET_PERIOD, but
+        // never later than SAVE_DEBOUNCE_SECONDS after its first change. A stop
+        // request skips the wait so the last changes reach the disk.
+        while (m_savePending && !stop.stop_requested())
+        {
+            const auto deadline = std::min(m_lastChange + SAVE_QUIET_PERIOD,
+                                           m_burstStart + std::chrono::seconds(SAVE_DEBOUNCE_SECONDS));
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                break;
+            }
+            m_saveCv.wait_until(lock, stop, deadline, []
+                                { return false; });
+        }
+        if (!m_savePending)
+        {
+            continue; // An explicit save took the snapshot meanwhile
+        }
+
+        std::vector<CameraProfile> profiles = std::move(m_pendingProfiles);
+        std::string path = std::move(m_pendingPath);
+        const uint64_t sequence = m_pendingSequence;
+        m_pendingProfiles.clear();
+        m_savePending = false;
+
+        lock.unlock();
+        const bool saved = writeSnapshot(profiles, path, sequence);
+        lock.lock();
+
+        // On failure keep the snapshot for a later retry unless a newer one replaced it.
+        if (!saved && !m_savePending && !stop.stop_requested())
+        {
+            const auto retryAt = std::chrono::steady_clock::now() + std::chrono::seconds(SAVE_RETRY_SECONDS);
+            m_pendingProfiles = std::move(profiles);
+            m_pendingPath = std::move(path);
+            m_pendingSequence = sequence;
+            m_burstStart = retryAt;
+            m_lastChange = retryAt;
+            m_savePending = true;
+        }
     }
 }
 
@@ -356,6 +688,7 @@ bool CameraProfileManager::createNewProfileFromLiveState(const std::string &cate
 
     m_profiles.push_back(new_profile);
     m_currentProfileIndex = m_profiles.size() - 1;
+    indexProfile(m_currentProfileIndex);
 
     logger.info("CameraProfileManager: Created new profile '{}' from live offset ({}, {}, {}). Switched active profile.",
                 new_profile.name, live_offset.x, live_offset.y, live_offset.z);
@@ -422,6 +755,7 @@ bool CameraProfileManager::deleteProfile(size_t index)
 
     std::string deletedName = m_profiles[index].name;
     m_profiles.erase(m_profiles.begin() + index);
+    rebuildProfileIndex(); // Every later index shifted down by one
     logger.info("CameraProfileManager: Deleted profile '{}' (index {}).", deletedName, index);
 
     // Adjust current index if needed and activate a safe profile
@@ -432,6 +766,7 @@ bool CameraProfileManager::deleteProfile(size_t index)
     { // Should not happen if Default deletion blocked
         logger.error("DeleteProfile: Profile list became empty after deletion. Recreating Default.");
         m_profiles.insert(m_profiles.begin(), CameraProfile("Default", Vector3(0.0f, 0.0f, 0.0f), "Default", generateTimestamp()));
+        rebuildProfileIndex();
         m_currentProfileIndex = 0;
         active_profile_affected = true;
     }
@@ -639,17 +974,19 @@ bool CameraProfileManager::renameProfile(size_t index, const std::string &newNam
     }
 
     // Prevent duplicate names (optional but good practice)
-    auto it_dup = std::find_if(m_profiles.begin(), m_profiles.end(),
-                               [&](const CameraProfile &p)
-                               { return p.name == newName; });
-    if (it_dup != m_profiles.end())
+    if (m_nameIndex.contains(newName))
     {
         logger.warning("RenameProfile: Profile name '{}' already exists.", newName);
         return false;
     }
 
     std::string oldName = m_profiles[index].name;
+    if (const auto it_old = m_nameIndex.find(oldName); it_old != m_nameIndex.end() && it_old->second == index)
+    {
+        m_nameIndex.erase(it_old);
+    }
     m_profiles[index].name = newName;
+    m_nameIndex.emplace(newName, index);
     m_profiles[index].timestamp = generateTimestamp(); // Update timestamp on metadata change
 
     logger.info("CameraProfileManager: Renamed profile (idx {}) from '{}' to '{}'.", index, oldName, newName);
@@ -683,6 +1020,12 @@ bool CameraProfileManager::setProfileCategory(size_t index, const std::string &n
     }
 
     std::string oldCategory = m_profiles[index].category;
+    if (oldCategory != categoryToSet)
+    {
+        unindexCategory(oldCategory, index);
+        std::vector<size_t> &members = m_categoryIndex[categoryToSet];
+        members.insert(std::lower_bound(members.begin(), members.end(), index), index);
+    }
     m_profiles[index].category = categoryToSet;
     m_profiles[index].timestamp = generateTimestamp();
 
@@ -741,34 +1084,24 @@ std::vector<CameraProfile> CameraProfileManager::getAllProfiles() const
 std::vector<size_t> CameraProfileManager::getProfileIndicesByCategory(const std::string &category) const
 {
     std::lock_guard<std::recursive_mutex> lock(m_profileMutex);
-    std::vector<size_t> indices;
     if (!m_isInitialized)
-        return indices;
-
-    for (size_t i = 0; i < m_profiles.size(); ++i)
-    {
-        if (m_profiles[i].category == category)
-        {
-            indices.push_back(i);
-        }
-    }
-    return indices;
+        return {};
+    const auto it = m_categoryIndex.find(category);
+    return it != m_categoryIndex.end() ? it->second : std::vector<size_t>{};
 }
 
 // --- Live Adjustments ---
 // These publish TPVToggle::camera_state().offset, which the render hook reads every frame.
-// Hold m_profileMutex so the seqlock writes serialize with each other (and with
-// setActiveProfile); the render-thread reader stays lock-free via
-// TPVToggle::camera_state().offset.load().
+// The offset holder serializes its own writers (CameraOffsetState), so the held-key
+// adjustment loop does not take m_profileMutex and never waits behind profile CRUD;
+// the render-thread reader stays lock-free via TPVToggle::camera_state().offset.load().
 void CameraProfileManager::adjustOffset(float x, float y, float z)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_profileMutex);
     TPVToggle::camera_state().offset.add(Vector3(x, y, z));
 }
 
 void CameraProfileManager::setOffset(float x, float y, float z)
 {
-    std::lock_guard<std::recursive_mutex> lock(m_profileMutex);
     TPVToggle::camera_state().offset.store(Vector3(x, y, z));
 }
 
@@ -779,7 +1112,7 @@ void CameraProfileManager::setTransitionSettings(
     float springStrength,
     float springDamping)
 {
-    // Assuming TransitionManager methods are safe to call without lock here
+    // TransitionManager setters are lock-free atomics; the values apply from the next transition
     TransitionManager &transition = TransitionManager::getInstance();
     transition.setTransitionDuration(duration);
     transition.setUseSpringPhysics(useSpringPhysics);
@@ -791,6 +1124,44 @@ void CameraProfileManager::setTransitionSettings(
                                      (useSpringPhysics ? ", Strength: " + std::to_string(springStrength) + ", Damping: " + std::to_string(springDamping) : ""));
 }
 
+void CameraProfileManager::rebuildProfileIndex()
+{
+    m_nameIndex.clear();
+    m_categoryIndex.clear();
+    m_nameIndex.reserve(m_profiles.size());
+    for (size_t i = 0; i < m_profiles.size(); ++i)
+    {
+        indexProfile(i);
+    }
+}
+
+void CameraProfileManager::indexProfile(size_t index)
+{
+    const CameraProfile &profile = m_profiles[index];
+    m_nameIndex.emplace(profile.name, index); // Keeps the first of duplicate names from a hand-edited file
+    std::vector<size_t> &members = m_categoryIndex[profile.category];
+    members.insert(std::lower_bound(members.begin(), members.end(), index), index);
+}
+
+void CameraProfileManager::unindexCategory(const std::string &category, size_t index)
+{
+    const auto it = m_categoryIndex.find(category);
+    if (it == m_categoryIndex.end())
+    {
+        return;
+    }
+    std::vector<size_t> &members = it->second;
+    const auto pos = std::lower_bound(members.begin(), members.end(), index);
+    if (pos != members.end() && *pos == index)
+    {
+        members.erase(pos);
+    }
+    if (members.empty())
+    {
+        m_categoryIndex.erase(it);
+    }
+}
+
 std::string CameraProfileManager::generateTimestamp() const
 {
     auto chrono_now = std::chrono::system_clock::now();
@@ -832,29 +1203,4 @@ void CameraProfileManager::profileToJson(const CameraProfile &profile, json &jso
         {"z", profile.offset.z}};
 }
 
-CameraProfile CameraProfileManager::profileFromJson(const json &jsonObj) const
-{
-    try
-    {
-        std::string name = jsonObj.value("name", "Unnamed Profile");
-        std::string category = jsonObj.value("category", "General");
-        std::string timestamp = jsonObj.value("timestamp", generateTimestamp());
-        float x = 0.0f, y = 0.0f, z = 0.0f;
-
-        if (jsonObj.contains("offset") && jsonObj["offset"].is_object())
-        {
-            const json &offsetObj = jsonObj["offset"];
-            x = offsetObj.value("x", 0.0f);
-            y = offsetObj.value("y", 0.0f);
-            z = offsetObj.value("z", 0.0f);
-        }
-        return CameraProfile(name, Vector3(x, y, z), category, timestamp);
-    }
-    catch (const std::exception &e)
-    {
-        DMK::Logger::get_instance().warning("CameraProfileManager: Error parsing profile JSON: {}. Returning error profile.", e.what());
-        return CameraProfile("ErrorProfile", Vector3(0, 0, 0), "Error", generateTimestamp());
-    }
-}
-
 } // namespace TPVToggle
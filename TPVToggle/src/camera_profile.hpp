@@ -2,9 +2,14 @@
 #ifndef CAMERA_PROFILE_HPP
 #define CAMERA_PROFILE_HPP
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <mutex>
+#include <thread>
 #include "math_utils.hpp"
 #include "transition_manager.hpp"
 
@@ -43,10 +48,17 @@ public:
      */
     [[nodiscard]] bool loadProfiles(const std::string &directory);
     /**
-     * @brief Explicitly saves all profiles to the JSON file immediately.
+     * @brief Explicitly saves all profiles to the JSON file immediately, on the calling thread.
+     *        The profile lock is only held while the list is copied, not while the file is written.
      * @return true if save was successful.
      */
     bool saveProfilesToJson(); // Public for explicit save if needed outside debouncing
+    /**
+     * @brief Stops the background profile writer, writing any queued snapshot first.
+     *        Called from shutdown(); later changes are then saved synchronously. This is
+     *        the only place the writer is joined (the destructor runs under the loader lock).
+     */
+    void shutdownPersistence();
 
     // --- Profile Lifecycle Actions ---
     /**
@@ -146,7 +158,7 @@ public:
      */
     [[nodiscard]] std::vector<size_t> getProfileIndicesByCategory(const std::string &category) const;
 
-    // --- Live Adjustments (modify ONLY TPVToggle::camera_state().offset) ---
+    // --- Live Adjustments (modify ONLY TPVToggle::camera_state().offset; no profile lock) ---
     /**
      * @brief Adds delta values to the live camera offset (TPVToggle::camera_state().offset).
      * @param x Delta X.
@@ -182,30 +194,55 @@ private:
     CameraProfileManager &operator=(const CameraProfileManager &) = delete;
 
     // Internal JSON I/O
-    bool loadProfilesFromJson();                                                     // Loads file into m_profiles
+    bool loadProfilesFromJson();                                                     // Streams file into m_profiles (SAX)
     void profileToJson(const CameraProfile &profile, nlohmann::json &jsonObj) const; // Profile -> JSON object
-    CameraProfile profileFromJson(const nlohmann::json &jsonObj) const;              // JSON object -> Profile
 
     // Internal helper
     std::string generateTimestamp() const;
 
+    // Lookup indexes over m_profiles (caller holds m_profileMutex)
+    void rebuildProfileIndex();                                     // Full rebuild after a load / delete shifts indices
+    void indexProfile(size_t index);                                // Adds m_profiles[index] (appended or re-keyed)
+    void unindexCategory(const std::string &category, size_t index); // Drops index from one category list
+
     // Internal persistence trigger
-    void markProfilesModifiedAndDebounceSave(); // Sets flag and triggers save if needed
+    void markProfilesModifiedAndDebounceSave(); // Queues a snapshot of m_profiles for the writer thread
+
+    // Background persistence (the writer thread never takes m_profileMutex)
+    void startPersistence();                                       // Starts the writer thread (loadProfiles)
+    void persistenceThread(std::stop_token stop);                  // Debounces, then writes the latest snapshot
+    bool writeSnapshot(const std::vector<CameraProfile> &profiles, // Temp file + rename; skips stale snapshots
+                       const std::string &path, uint64_t sequence);
 
     // Member variables
     std::vector<CameraProfile> m_profiles;       // Stores the SAVED states
+    std::unordered_map<std::string, size_t> m_nameIndex;                   // Profile name -> index (first wins)
+    std::unordered_map<std::string, std::vector<size_t>> m_categoryIndex; // Category -> ascending indices
     size_t m_currentProfileIndex;                // Index of the active profile in m_profiles
     std::string m_profileDirectory;              // Directory containing JSON file
     std::string m_jsonProfilesPath;              // Full path to JSON file
     bool m_isInitialized;                        // Initialization flag
-    mutable std::recursive_mutex m_profileMutex; // Protects m_profiles, m_currentProfileIndex, m_profilesModified, m_lastSaveTime
-
-    // Save debouncing state
-    bool m_profilesModified; // Tracks if m_profiles content requires saving
-    time_t m_lastSaveTime;   // Timestamp of last successful save
+    mutable std::recursive_mutex m_profileMutex; // Protects m_profiles, the indexes, m_currentProfileIndex,
+                                                 // m_snapshotSequence (never taken for the live offset)
+
+    // Save queue, shared with the writer thread. m_saveMutex is never held across disk I/O.
+    uint64_t m_snapshotSequence;                         // Last snapshot number handed out (edit order)
+    std::mutex m_saveMutex;                              // Protects the pending-snapshot fields below
+    std::condition_variable_any m_saveCv;                // Wakes the writer on a new snapshot or stop
+    bool m_savePending;                                  // A snapshot is waiting to be written
+    std::vector<CameraProfile> m_pendingProfiles;        // Latest unsaved snapshot (replaced by newer ones)
+    std::string m_pendingPath;                           // Its file path
+    uint64_t m_pendingSequence;                          // Its snapshot number
+    std::chrono::steady_clock::time_point m_burstStart;  // First change of the pending burst
+    std::chrono::steady_clock::time_point m_lastChange;  // Latest change of the pending burst
+    std::mutex m_writeMutex;                             // Serialises file writes (writer vs explicit saves)
+    uint64_t m_writtenSequence;                          // Newest snapshot on disk (under m_writeMutex)
+    std::jthread m_saveThread;                           // Background writer
 
     // Constants
-    static constexpr int SAVE_DEBOUNCE_SECONDS = 2; // Debounce window
+    static constexpr int SAVE_DEBOUNCE_SECONDS = 2;                     // Longest a burst delays its write
+    static constexpr std::chrono::milliseconds SAVE_QUIET_PERIOD{500};  // Idle time that ends a burst early
+    static constexpr int SAVE_RETRY_SECONDS = 10;                       // Back-off after a failed write
 };
 
 } // namespace TPVToggle
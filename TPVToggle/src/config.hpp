@@ -85,7 +85,7 @@ namespace TPVToggle
         // Continuous offset-adjustment step, read by the profile poll thread.
         std::atomic<float> offsetAdjustmentStep{0.01f};
 
-        // Delay before restoring TPV after an overlay closes, read by the monitor thread.
+        // Delay before restoring TPV after an overlay closes, read by the background worker.
         std::atomic<int> overlayRestoreDelayMs{200};
     };
 
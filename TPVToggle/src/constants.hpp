@@ -82,7 +82,7 @@ namespace Constants
     // WHGame.DLL+619316 - F3 0F11 42 1C         - movss [rdx+1C],xmm0
     // WHGame.DLL+61931B - E8 30F0FFFF           - call WHGame.DLL+618350
     /**
-     * @brief AOB pattern for the accumulator write instruction to be NOPed.
+     * @brief AOB pattern for the accumulator write instruction the hold-to-scroll mid hook skips.
      *        Used for scroll wheel input filtering when overlays are active.
      */
     constexpr const char *ACCUMULATOR_WRITE_AOB_PATTERN =
@@ -235,7 +235,9 @@ namespace Constants
     constexpr int MOUSE_WHEEL_EVENT_ID = 0x10C;
 
     // --- Timing ---
-    constexpr unsigned long MAIN_MONITOR_SLEEP_MS = 33;
+    constexpr unsigned long WORKER_OFFSET_REPEAT_MS = 16;   // Offset-key repeat while held (~60 Hz)
+    constexpr unsigned long WORKER_INTERFACE_POLL_MS = 250; // Game-interface readiness poll before it resolves
+    constexpr unsigned long WORKER_ERROR_BACKOFF_MS = 1000; // Retry delay after an exception in the worker
 
     /** @brief Name of the target game module. */
     constexpr const char *MODULE_NAME = "WHGame.dll";
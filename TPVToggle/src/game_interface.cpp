@@ -10,6 +10,7 @@
 #include "game_structures.hpp"
 #include "utils.hpp"
 #include "global_state.hpp"
+#include "shared_resolve.hpp"
 
 #include <DetourModKit.hpp>
 
@@ -48,7 +49,7 @@ namespace
         return false; // Cannot proceed without pattern
     }
 
-    const std::byte *scroll_aob_result = DMK::Scanner::find_pattern(reinterpret_cast<const std::byte *>(module_base), module_size, *scroll_pat);
+    const std::byte *scroll_aob_result = findPatternShared(module_base, module_size, Constants::SCROLL_STATE_BASE_AOB_PATTERN, *scroll_pat);
 
     if (!scroll_aob_result)
     {
@@ -172,7 +173,7 @@ bool initializeGameInterface(uintptr_t module_base, size_t module_size)
             throw std::runtime_error("Failed to parse context pointer AOB pattern");
         }
 
-        const std::byte *ctx_aob = DMK::Scanner::find_pattern(reinterpret_cast<const std::byte *>(module_base), module_size, *ctx_pat);
+        const std::byte *ctx_aob = findPatternShared(module_base, module_size, Constants::CONTEXT_PTR_LOAD_AOB_PATTERN, *ctx_pat);
         if (!ctx_aob)
         {
             throw std::runtime_error("Context pointer AOB pattern not found");
@@ -328,13 +329,15 @@ bool GetPlayerWorldTransform(::Vector3 &outPosition, ::Quaternion &outOrientatio
 {
     DMK::Logger &logger = DMK::Logger::get_instance();
 
-    if (!TPVToggle::player_transform().entity)
+    // One wait-free load of the latch; every use below refers to this same entity even if it is re-latched meanwhile.
+    const uintptr_t entity = reinterpret_cast<uintptr_t>(TPVToggle::player_transform().entity.get());
+    if (!entity)
     {
         logger.debug("GetPlayerWorldTransform: Called but the player entity is currently NULL.");
         return false;
     }
 
-    uintptr_t matrix_address = reinterpret_cast<uintptr_t>(TPVToggle::player_transform().entity) + Constants::OFFSET_ENTITY_WORLD_MATRIX_MEMBER;
+    uintptr_t matrix_address = entity + Constants::OFFSET_ENTITY_WORLD_MATRIX_MEMBER;
 
     // The player entity is engine-owned and may have been freed since it was
     // captured, so read the whole 3x4 matrix under one SEH frame rather than
@@ -344,7 +347,7 @@ bool GetPlayerWorldTransform(::Vector3 &outPosition, ::Quaternion &outOrientatio
     if (!playerMatrixOpt)
     {
         logger.warning("GetPlayerWorldTransform: Cannot read CEntity's m_worldTransform at {} for entity {}",
-                       format_address(matrix_address), format_address(reinterpret_cast<uintptr_t>(TPVToggle::player_transform().entity)));
+                       format_address(matrix_address), format_address(entity));
         return false;
     }
 
@@ -373,7 +376,7 @@ bool GetPlayerWorldTransform(::Vector3 &outPosition, ::Quaternion &outOrientatio
     {
         std::ostringstream matrix_dump;
         matrix_dump << std::fixed << std::setprecision(4);
-        matrix_dump << "\n  Matrix Read from Entity " << format_address(reinterpret_cast<uintptr_t>(TPVToggle::player_transform().entity)) << " @ offset " << DMK::Format::format_hex(Constants::OFFSET_ENTITY_WORLD_MATRIX_MEMBER) << " (Addr: " << format_address(matrix_address) << "):";
+        matrix_dump << "\n  Matrix Read from Entity " << format_address(entity) << " @ offset " << DMK::Format::format_hex(Constants::OFFSET_ENTITY_WORLD_MATRIX_MEMBER) << " (Addr: " << format_address(matrix_address) << "):";
         matrix_dump << "\n    R0: [" << playerMatrix.m[0][0] << ", " << playerMatrix.m[0][1] << ", " << playerMatrix.m[0][2] << "] T.x: " << playerMatrix.m[0][3];
         matrix_dump << "\n    R1: [" << playerMatrix.m[1][0] << ", " << playerMatrix.m[1][1] << ", " << playerMatrix.m[1][2] << "] T.y: " << playerMatrix.m[1][3];
         matrix_dump << "\n    R2: [" << playerMatrix.m[2][0] << ", " << playerMatrix.m[2][1] << ", " << playerMatrix.m[2][2] << "] T.z: " << playerMatrix.m[2][3];
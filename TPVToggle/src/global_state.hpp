@@ -50,11 +50,12 @@ namespace TPVToggle
     /** @brief State owned by the scroll-accumulator event hook. */
     struct ScrollHookState
     {
-        std::byte *writeAddress{nullptr};
-        std::byte originalWriteBytes[Constants::ACCUMULATOR_WRITE_INSTR_LENGTH]{};
+        // Read by the mid hook on the input thread while cleanup may clear it, hence atomic.
+        std::atomic<std::byte *> writeAddress{nullptr};
         volatile float *accumulatorAddress{nullptr};
         volatile std::uintptr_t *ptrStorageAddress{nullptr};
-        std::atomic<bool> nopped{false};
+        // Read by the accumulator-write mid hook on every scroll event: while set, the hook skips the store.
+        std::atomic<bool> suppressWrite{false};
     };
 
     /** @brief Live third-person camera state shared by hooks and the profile system. */
@@ -68,12 +69,105 @@ namespace TPVToggle
     /** @brief Signature of the engine's CEntity::SetWorldTM (this, 3x4 matrix, flags). */
     using CEntitySetWorldTMFn = void (*)(GameStructures::CEntity *this_ptr, float *tm_3x4, int flags);
 
+    /**
+     * @brief The latched player entity: one atomic word holding the pointer and a generation counter.
+     * @details The pointer takes the low 48 bits (x64 user-mode addresses fit) and the generation the high 16; every
+     *          change bumps the generation, so a reader gets a pointer and the latch instance it came from in one
+     *          load. Reads are a single acquire load, wait-free on every thread. The constructor detour latches
+     *          with a CAS and a destruction check clears with a CAS expecting the entity it checked, so a clear
+     *          can never drop a player latched after the check.
+     */
+    class PlayerEntityLatch
+    {
+    public:
+        struct Snapshot
+        {
+            GameStructures::CEntity *entity{nullptr};
+            std::uint16_t generation{0};
+        };
+
+        [[nodiscard]] Snapshot load() const noexcept
+        {
+            return unpack(m_word.load(std::memory_order_acquire));
+        }
+
+        [[nodiscard]] GameStructures::CEntity *get() const noexcept
+        {
+            return load().entity;
+        }
+
+        /** @brief Latches @p entity unless it already is; returns the entity it replaced (== @p entity: none). */
+        GameStructures::CEntity *latch(GameStructures::CEntity *entity) noexcept
+        {
+            std::uint64_t word = m_word.load(std::memory_order_acquire);
+            for (;;)
+            {
+                const Snapshot current = unpack(word);
+                if (current.entity == entity ||
+                    m_word.compare_exchange_weak(word, pack(entity, current.generation + 1u),
+                                                 std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    return current.entity;
+                }
+            }
+        }
+
+        /** @brief Clears the latch if it still holds @p entity (nullptr: already clear); true if it did. */
+        bool clear_if(GameStructures::CEntity *entity) noexcept
+        {
+            std::uint64_t word = m_word.load(std::memory_order_acquire);
+            for (;;)
+            {
+                const Snapshot current = unpack(word);
+                if (current.entity != entity)
+                {
+                    return false;
+                }
+                if (entity == nullptr ||
+                    m_word.compare_exchange_weak(word, pack(nullptr, current.generation + 1u),
+                                                 std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    return true;
+                }
+            }
+        }
+
+        /** @brief Clears the latch whatever it holds (hook cleanup). */
+        void clear() noexcept
+        {
+            std::uint64_t word = m_word.load(std::memory_order_acquire);
+            while (!m_word.compare_exchange_weak(word, pack(nullptr, unpack(word).generation + 1u),
+                                                 std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+            }
+        }
+
+    private:
+        static constexpr unsigned POINTER_BITS = 48;
+        static constexpr std::uint64_t POINTER_MASK = (std::uint64_t{1} << POINTER_BITS) - 1;
+        static_assert(sizeof(void *) == sizeof(std::uint64_t), "the latch packs a 64-bit pointer");
+
+        static std::uint64_t pack(GameStructures::CEntity *entity, unsigned generation) noexcept
+        {
+            return (static_cast<std::uint64_t>(generation & 0xFFFFu) << POINTER_BITS) |
+                   (reinterpret_cast<std::uintptr_t>(entity) & POINTER_MASK);
+        }
+
+        static Snapshot unpack(std::uint64_t word) noexcept
+        {
+            return Snapshot{reinterpret_cast<GameStructures::CEntity *>(word & POINTER_MASK),
+                            static_cast<std::uint16_t>(word >> POINTER_BITS)};
+        }
+
+        std::atomic<std::uint64_t> m_word{0};
+    };
+
     /** @brief Player world transform mirrored from the entity hooks. */
     struct PlayerTransform
     {
         Vector3 worldPosition{0.0f, 0.0f, 0.0f};
         Quaternion worldOrientation{Quaternion::Identity()};
-        GameStructures::CEntity *entity{nullptr};
+        PlayerEntityLatch entity;
         CEntitySetWorldTMFn setWorldTM{nullptr};
     };
 
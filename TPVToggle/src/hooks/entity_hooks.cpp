@@ -11,11 +11,15 @@
 #include "game_structures.hpp"
 #include "utils.hpp"
 #include "global_state.hpp"
+#include "shared_resolve.hpp"
 
 #include <DetourModKit.hpp>
 
+#include <atomic>
+#include <cstdint>
+#include <span>
 #include <string>
-#include <mutex>
+#include <string_view>
 
 using DMK::Format::format_address;
 
@@ -41,96 +45,146 @@ using CEntity_SetWorldTM_t = void (*)(GameStructures::CEntity *this_ptr, float *
 
 static CEntity_Constructor_t fpCEntityConstructorOriginal = nullptr;
 static std::string g_CEntityConstructorHookId;
-static std::mutex g_entityMutex; // Protect player entity pointer access
+
+// Player detection runs only while armed: the detour disarms itself once the player is latched and is re-armed by
+// ResetPlayerEntityIfDestroyed or armPlayerDetection (game menu opened). While disarmed it costs one relaxed load
+// per construction, plus a liveness check of the latched player every LIVENESS_CHECK_INTERVAL constructions that
+// re-arms it once the player has gone (the latched pointer may already be freed, so every read of it is SEH-guarded).
+static std::atomic<bool> g_detectionArmed{true};
+static std::atomic<std::uint32_t> g_disarmedConstructions{0};
+constexpr std::uint32_t LIVENESS_CHECK_INTERVAL = 16;
+
+/**
+ * @brief SEH wrapper for the virtual GetName() call.
+ * @details The liveness check calls it on the latched player, which may have been freed since it was latched: its
+ *          vtable can still read as in-module while the slot or the object behind it is gone. POD-only frame,
+ *          because __try cannot share a frame with C++ destructor unwinding.
+ * @return The engine-owned name, or nullptr if the call faulted.
+ */
+static const char *getNameGuarded(GameStructures::CEntity *entity) noexcept
+{
+    __try
+    {
+        return entity->GetName();
+    }
+    __except (EXCEPTION_EXECUTE_HANDLER)
+    {
+        return nullptr;
+    }
+}
+
+/**
+ * @brief Copy an entity's name into a fixed buffer without allocating.
+ * @details The vtable is checked against the game module range with a branch-only test before the virtual
+ *          GetName() call (host_module_range() is the bootstrap EXE, which holds no game RTTI, so it must not be
+ *          used here), and the call itself runs under its own SEH frame (getNameGuarded). GetName() returns an
+ *          engine-owned C string of unknown length, so it is copied into the bounded buffer under one SEH frame: a
+ *          name ending near an unmapped page cannot fault the scan.
+ * @return The name, or an empty view if the entity or its name is unreadable.
+ */
+static std::string_view readEntityName(GameStructures::CEntity *entity, std::span<char> buffer)
+{
+    const DMK::Memory::ModuleRange game_range{TPVToggle::module_info().base, TPVToggle::module_info().base + TPVToggle::module_info().size};
+    const uintptr_t addr = reinterpret_cast<uintptr_t>(entity);
+    if (!DMK::Memory::plausible_userspace_ptr(addr))
+    {
+        return {};
+    }
+    const auto vtable = DMK::Memory::seh_read<uintptr_t>(addr);
+    if (!vtable || !DMK::Memory::contains(game_range, *vtable))
+    {
+        return {};
+    }
+    const char *rawName = getNameGuarded(entity);
+    if (!rawName || !DMK::Memory::seh_read_bytes(reinterpret_cast<uintptr_t>(rawName), buffer.data(), buffer.size() - 1))
+    {
+        return {};
+    }
+    buffer[buffer.size() - 1] = '\0';
+    return std::string_view(buffer.data());
+}
+
+/// The player entity's name contains both "Dude" and "Player".
+static bool isPlayerName(std::string_view name)
+{
+    return name.find("Dude") != std::string_view::npos && name.find("Player") != std::string_view::npos;
+}
 
 /**
  * @brief Detour function for CEntity constructor
  * @details Intercepts entity creation to detect and track the player entity.
  *          Identifies player by checking if entity name contains both "Dude" and "Player".
+ *          The match is allocation-free (fixed buffer, string_view search), and only runs while
+ *          detection is armed (see g_detectionArmed).
  * @param this_ptr Pointer to the entity being constructed
  * @param unknown_param Parameter passed to constructor (purpose unknown)
  * @return Result from original constructor
  */
 static void *Detour_CEntity_Constructor(GameStructures::CEntity *this_ptr, uintptr_t unknown_param)
 {
-    DMK::Logger &logger = DMK::Logger::get_instance();
-
     if (!fpCEntityConstructorOriginal)
     {
-        logger.error("EntityHooks: fpCEntityConstructorOriginal is NULL");
+        DMK::Logger::get_instance().error("EntityHooks: fpCEntityConstructorOriginal is NULL");
         return nullptr;
     }
 
     void *result = fpCEntityConstructorOriginal(this_ptr, unknown_param);
 
-    // Memory faults below are handled by the seh_* primitives; this guard only
-    // stops a C++ exception (e.g. std::string allocation) from unwinding into the
-    // engine, which would terminate the process. It does not catch access
-    // violations (catch(...) cannot, under MSVC /EHsc).
-    try
+    char name_buf[128] = {};
+    if (!g_detectionArmed.load(std::memory_order_relaxed))
     {
-        std::string entityName = "Unknown";
-
-        // A live CEntity's vtable points into the game module (WHGame.dll), whose
-        // mapped range is captured in the resolved module info during startup.
-        // Validate the vtable against that range with a branch-only test before the
-        // virtual GetName() call, instead of taking a region-cache lock on every
-        // construction. Note: host_module_range() is the bootstrap EXE, which holds
-        // no game RTTI, so it must not be used here.
-        const DMK::Memory::ModuleRange game_range{TPVToggle::module_info().base, TPVToggle::module_info().base + TPVToggle::module_info().size};
-        const uintptr_t this_addr = reinterpret_cast<uintptr_t>(this_ptr);
-        if (DMK::Memory::plausible_userspace_ptr(this_addr))
+        if (g_disarmedConstructions.fetch_add(1, std::memory_order_relaxed) % LIVENESS_CHECK_INTERVAL != 0)
         {
-            const auto vtable = DMK::Memory::seh_read<uintptr_t>(this_addr);
-            if (vtable && DMK::Memory::contains(game_range, *vtable))
-            {
-                const char *rawName = this_ptr->GetName();
-                if (rawName)
-                {
-                    // GetName() returns an engine-owned C string of unknown length.
-                    // Copy it into a bounded buffer under one SEH frame so a name
-                    // ending near an unmapped page cannot fault an std::string scan.
-                    char name_buf[128] = {};
-                    if (DMK::Memory::seh_read_bytes(reinterpret_cast<uintptr_t>(rawName), name_buf, sizeof(name_buf) - 1))
-                    {
-                        entityName = name_buf;
-                    }
-                }
-            }
+            return result;
         }
-
-        // Identify the player entity by name and latch its pointer.
-        if (entityName.find("Dude") != std::string::npos &&
-            entityName.find("Player") != std::string::npos)
+        GameStructures::CEntity *latched = GetPlayerEntity();
+        if (latched != nullptr && isPlayerName(readEntityName(latched, name_buf)))
         {
-            std::lock_guard<std::mutex> lock(g_entityMutex);
+            return result;
+        }
+        ResetPlayerEntityIfDestroyed(latched);
+    }
 
-            if (TPVToggle::player_transform().entity != this_ptr)
-            {
-                if (TPVToggle::player_transform().entity == nullptr)
-                {
-                    logger.info("EntityHooks: Player entity detected and assigned - Name: '{}' Addr: {}",
-                                entityName, format_address(reinterpret_cast<uintptr_t>(this_ptr)));
-                }
-                else
-                {
-                    logger.info("EntityHooks: Player entity updated - Old: {} New: {} Name: '{}'",
-                                format_address(reinterpret_cast<uintptr_t>(TPVToggle::player_transform().entity)),
-                                format_address(reinterpret_cast<uintptr_t>(this_ptr)),
-                                entityName);
-                }
+    const std::string_view entityName = readEntityName(this_ptr, name_buf);
+    if (!isPlayerName(entityName))
+    {
+        return result;
+    }
 
-                TPVToggle::player_transform().entity = this_ptr;
+    // Identify the player entity by name and latch its pointer (a CAS on the lock-free latch, so a reader on
+    // another thread never waits on this detour). The guard only stops a C++ exception (the log line's
+    // formatting) from unwinding into the engine, which would terminate the process; memory faults are handled
+    // by the seh_* primitives above.
+    try
+    {
+        g_disarmedConstructions.store(1, std::memory_order_relaxed);
+        g_detectionArmed.store(false, std::memory_order_relaxed);
+
+        GameStructures::CEntity *previous = TPVToggle::player_transform().entity.latch(this_ptr);
+        if (previous != this_ptr)
+        {
+            DMK::Logger &logger = DMK::Logger::get_instance();
+            if (previous == nullptr)
+            {
+                logger.info("EntityHooks: Player entity detected and assigned - Name: '{}' Addr: {}",
+                            entityName, format_address(reinterpret_cast<uintptr_t>(this_ptr)));
+            }
+            else
+            {
+                logger.info("EntityHooks: Player entity updated - Old: {} New: {} Name: '{}'",
+                            format_address(reinterpret_cast<uintptr_t>(previous)),
+                            format_address(reinterpret_cast<uintptr_t>(this_ptr)),
+                            entityName);
             }
         }
     }
     catch (const std::exception &e)
     {
-        logger.warning("EntityHooks: Exception in constructor detour: {}", e.what());
+        DMK::Logger::get_instance().warning("EntityHooks: Exception in constructor detour: {}", e.what());
     }
     catch (...)
     {
-        logger.warning("EntityHooks: Unknown exception in constructor detour");
+        DMK::Logger::get_instance().warning("EntityHooks: Unknown exception in constructor detour");
     }
 
     return result;
@@ -138,20 +192,28 @@ static void *Detour_CEntity_Constructor(GameStructures::CEntity *this_ptr, uintp
 
 /**
  * @brief Reset player entity pointer on destruction
- * @details Called to ensure we don't hold stale pointers when player entity is destroyed
+ * @details Called to ensure we don't hold stale pointers when player entity is destroyed. Re-arms player
+ *          detection in the constructor detour so the next player entity is latched.
  * @param entity Entity being checked for destruction
  */
 void ResetPlayerEntityIfDestroyed(GameStructures::CEntity *entity)
 {
-    std::lock_guard<std::mutex> lock(g_entityMutex);
-
-    if (TPVToggle::player_transform().entity == entity)
+    // Clears only if the latch still holds this entity: a player latched since the caller read it is kept.
+    if (TPVToggle::player_transform().entity.clear_if(entity))
     {
-        DMK::Logger::get_instance().info("EntityHooks: Player entity being destroyed - Resetting pointer");
-        TPVToggle::player_transform().entity = nullptr;
+        if (entity != nullptr)
+        {
+            DMK::Logger::get_instance().info("EntityHooks: Player entity being destroyed - Resetting pointer");
+        }
+        g_detectionArmed.store(true, std::memory_order_relaxed);
     }
 }
 
+void armPlayerDetection() noexcept
+{
+    g_detectionArmed.store(true, std::memory_order_relaxed);
+}
+
 bool initializeEntityHooks(uintptr_t moduleBase, size_t moduleSize)
 {
     DMK::Logger &logger = DMK::Logger::get_instance();
@@ -165,7 +227,7 @@ bool initializeEntityHooks(uintptr_t moduleBase, size_t moduleSize)
             throw std::runtime_error("Failed to parse CEntity constructor caller AOB");
         }
 
-        const std::byte *ctorMatch = DMK::Scanner::find_pattern(reinterpret_cast<const std::byte *>(moduleBase), moduleSize, *ctorPattern);
+        const std::byte *ctorMatch = findPatternShared(moduleBase, moduleSize, CENTITY_CONSTRUCTOR_CALLER_AOB, *ctorPattern);
         if (!ctorMatch)
         {
             throw std::runtime_error("CEntity constructor caller pattern not found");
@@ -201,7 +263,7 @@ bool initializeEntityHooks(uintptr_t moduleBase, size_t moduleSize)
         auto setWorldPattern = DMK::Scanner::parse_aob(CENTITY_SETWORLDTM_CALLER_AOB);
         if (setWorldPattern.has_value())
         {
-            const std::byte *setWorldMatch = DMK::Scanner::find_pattern(reinterpret_cast<const std::byte *>(moduleBase), moduleSize, *setWorldPattern);
+            const std::byte *setWorldMatch = findPatternShared(moduleBase, moduleSize, CENTITY_SETWORLDTM_CALLER_AOB, *setWorldPattern);
             if (setWorldMatch)
             {
                 // Resolve call rel32 target: E8 xx xx xx xx (5 bytes, disp32 at offset 1)
@@ -242,20 +304,17 @@ void cleanupEntityHooks()
         logger.info("EntityHooks: Constructor hook removed");
     }
 
-    {
-        std::lock_guard<std::mutex> lock(g_entityMutex);
-        TPVToggle::player_transform().setWorldTM = nullptr;
-        TPVToggle::player_transform().entity = nullptr;
-    }
+    TPVToggle::player_transform().setWorldTM = nullptr;
+    TPVToggle::player_transform().entity.clear();
+    g_detectionArmed.store(true, std::memory_order_relaxed);
 
     logger.info("EntityHooks: Cleanup complete");
 }
 
-// Safe accessor function for other modules
+// Safe accessor function for other modules: one acquire load of the latch, wait-free.
 GameStructures::CEntity *GetPlayerEntity()
 {
-    std::lock_guard<std::mutex> lock(g_entityMutex);
-    return TPVToggle::player_transform().entity;
+    return TPVToggle::player_transform().entity.get();
 }
 
 } // namespace TPVToggle
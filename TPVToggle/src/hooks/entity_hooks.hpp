@@ -41,6 +41,14 @@ void cleanupEntityHooks();
  */
 void ResetPlayerEntityIfDestroyed(GameStructures::CEntity *entity);
 
+/**
+ * @brief Re-arm player detection in the CEntity constructor detour
+ * @details The detour disarms itself once the player is latched. Called when the game menu opens, since a save
+ *          load (which constructs a new player entity) always goes through it; the latched pointer is kept until
+ *          the next player entity replaces it.
+ */
+void armPlayerDetection() noexcept;
+
 /**
  * @brief Get the current player entity pointer safely
  * @return Pointer to player entity or nullptr if not found
@@ -6,10 +6,12 @@
 #include "event_hooks.hpp"
 #include "constants.hpp"
 #include "global_state.hpp"
+#include "shared_resolve.hpp"
 #include "config.hpp"
 
 #include <DetourModKit.hpp>
 
+#include <cstring>
 #include <stdexcept>
 
 using DMK::Format::format_address;
@@ -20,10 +22,44 @@ extern Config g_config;
 namespace TPVToggle
 {
 
-// NOP pattern for disabling the scroll-accumulator write instruction. Typed as
-// std::byte so it passes straight to DMK::Memory::write_bytes without a cast.
-static constexpr std::byte NOP_PATTERN[Constants::ACCUMULATOR_WRITE_INSTR_LENGTH] = {
-    std::byte{0x90}, std::byte{0x90}, std::byte{0x90}, std::byte{0x90}, std::byte{0x90}};
+/**
+ * @brief Mid hook on the scroll-accumulator write (movss [rdx+1C], xmm0).
+ * @details Installed once and left in place. While scroll_hook_state().suppressWrite is set it resumes execution
+ *          at the call after the store in the game's own code (the hook only overwrote the 5-byte movss), so the
+ *          accumulator keeps its value exactly as a NOPed instruction would; otherwise the relocated store runs as
+ *          the game wrote it. Toggling hold-to-scroll is therefore one relaxed store, with
+ *          no page-protection change or instruction-cache flush on a page the input thread is executing.
+ *          The address is loaded once and checked, so a cleanup that clears it while the hook is still installed
+ *          lets the store run instead of resuming at a null-based address. It is only published once install has
+ *          checked the resume point (see resumePointIntact), so an unexpected patch leaves every store running.
+ */
+static void AccumulatorWriteMidHook(safetyhook::Context &ctx)
+{
+    if (TPVToggle::scroll_hook_state().suppressWrite.load(std::memory_order_relaxed))
+    {
+        std::byte *const writeAddress = TPVToggle::scroll_hook_state().writeAddress.load(std::memory_order_acquire);
+        if (writeAddress != nullptr)
+        {
+            ctx.rip = reinterpret_cast<uintptr_t>(writeAddress) + Constants::ACCUMULATOR_WRITE_INSTR_LENGTH;
+        }
+    }
+}
+
+/// movss [rdx+1C], xmm0: the one instruction the hook may skip.
+static constexpr std::uint8_t ACCUMULATOR_WRITE_INSTR[] = {0xF3, 0x0F, 0x11, 0x42, 0x1C};
+static_assert(sizeof(ACCUMULATOR_WRITE_INSTR) == Constants::ACCUMULATOR_WRITE_INSTR_LENGTH);
+
+/**
+ * @brief True when the installed mid hook replaced exactly the movss with a 5-byte rel32 jmp and left the call after
+ *        it untouched, which is what resuming at writeAddress + ACCUMULATOR_WRITE_INSTR_LENGTH relies on.
+ * @details safetyhook falls back to a 14-byte absolute jmp when no trampoline fits within rel32 range; that patch
+ *          also covers the call, and resuming past the movss would land inside it.
+ */
+static bool resumePointIntact(const std::byte *writeAddress) noexcept
+{
+    return writeAddress[0] == std::byte{0xE9} &&
+           writeAddress[Constants::ACCUMULATOR_WRITE_INSTR_LENGTH] == std::byte{0xE8};
+}
 
 bool initializeEventHooks(uintptr_t module_base, size_t module_size)
 {
@@ -34,41 +70,48 @@ bool initializeEventHooks(uintptr_t module_base, size_t module_size)
         auto accumulator_pat = DMK::Scanner::parse_aob(Constants::ACCUMULATOR_WRITE_AOB_PATTERN);
         if (accumulator_pat.has_value())
         {
-            const std::byte *accumulator_aob = DMK::Scanner::find_pattern(reinterpret_cast<const std::byte *>(module_base), module_size, *accumulator_pat);
+            const std::byte *accumulator_aob = findPatternShared(module_base, module_size, Constants::ACCUMULATOR_WRITE_AOB_PATTERN, *accumulator_pat);
             if (accumulator_aob)
             {
-                TPVToggle::scroll_hook_state().writeAddress = const_cast<std::byte *>(accumulator_aob) + Constants::ACCUMULATOR_WRITE_HOOK_OFFSET;
-                logger.info("EventHooks: Found accumulator write at {}", format_address(reinterpret_cast<uintptr_t>(TPVToggle::scroll_hook_state().writeAddress)));
-
-                // Snapshot the original instruction bytes under one SEH frame so the
-                // read cannot fault, and so there is no time-of-check window between a
-                // readability probe and the copy.
-                if (DMK::Memory::seh_read_bytes(reinterpret_cast<uintptr_t>(TPVToggle::scroll_hook_state().writeAddress),
-                                                TPVToggle::scroll_hook_state().originalWriteBytes,
-                                                Constants::ACCUMULATOR_WRITE_INSTR_LENGTH))
+                std::byte *writeAddress = const_cast<std::byte *>(accumulator_aob) + Constants::ACCUMULATOR_WRITE_HOOK_OFFSET;
+                logger.info("EventHooks: Found accumulator write at {}", format_address(reinterpret_cast<uintptr_t>(writeAddress)));
+
+                // Decode check: the pattern may be edited, the resume arithmetic must still skip one whole movss.
+                if (std::memcmp(writeAddress, ACCUMULATOR_WRITE_INSTR, sizeof(ACCUMULATOR_WRITE_INSTR)) != 0)
                 {
-                    // For hold-to-scroll feature - NOP it by default if enabled
-                    if (!g_config.hold_scroll_keys.empty())
-                    {
-                        logger.info("EventHooks: Hold-to-scroll feature enabled, applying NOP by default");
-                        if (DMK::Memory::write_bytes(TPVToggle::scroll_hook_state().writeAddress,
-                                                   NOP_PATTERN,
-                                                   Constants::ACCUMULATOR_WRITE_INSTR_LENGTH)
-                                .has_value())
-                        {
-                            TPVToggle::scroll_hook_state().nopped.store(true);
-                        }
-                    }
+                    logger.warning("EventHooks: Accumulator write is not the expected 5-byte movss - hold-to-scroll disabled");
+                    return true;
+                }
+
+                auto hookResult = DMK::HookManager::get_instance().create_mid_hook(
+                    "ScrollAccumulatorWrite",
+                    reinterpret_cast<uintptr_t>(writeAddress),
+                    &AccumulatorWriteMidHook);
+                if (!hookResult.has_value())
+                {
+                    logger.warning("EventHooks: Failed to hook accumulator write ({}) - hold-to-scroll disabled",
+                                   DMK::Hook::error_to_string(hookResult.error()));
+                }
+                else if (!resumePointIntact(writeAddress))
+                {
+                    // The hook stays in place with writeAddress unpublished, so it lets every store through.
+                    logger.warning("EventHooks: Accumulator write hook patched past the movss - hold-to-scroll disabled");
                 }
                 else
                 {
-                    logger.warning("EventHooks: Cannot read original accumulator write bytes - NOP feature disabled");
-                    TPVToggle::scroll_hook_state().writeAddress = nullptr;
+                    // Suppressed by default while the hold-to-scroll feature is enabled. The flag is set first: the
+                    // hook only redirects once the address is published.
+                    TPVToggle::scroll_hook_state().suppressWrite.store(!g_config.hold_scroll_keys.empty(), std::memory_order_relaxed);
+                    TPVToggle::scroll_hook_state().writeAddress.store(writeAddress, std::memory_order_release);
+                    if (!g_config.hold_scroll_keys.empty())
+                    {
+                        logger.info("EventHooks: Hold-to-scroll feature enabled, accumulator write suppressed by default");
+                    }
                 }
             }
             else
             {
-                logger.warning("EventHooks: Accumulator write pattern not found - NOP feature disabled");
+                logger.warning("EventHooks: Accumulator write pattern not found - hold-to-scroll disabled");
             }
         }
 
@@ -86,21 +129,9 @@ void cleanupEventHooks() noexcept
 {
     DMK::Logger &logger = DMK::Logger::get_instance();
 
-    // Restore accumulator write if it was NOPed
-    if (TPVToggle::scroll_hook_state().writeAddress != nullptr && TPVToggle::scroll_hook_state().nopped.load())
-    {
-        logger.info("EventHooks: Restoring original accumulator write bytes...");
-        if (!DMK::Memory::write_bytes(TPVToggle::scroll_hook_state().writeAddress,
-                                    TPVToggle::scroll_hook_state().originalWriteBytes,
-                                    Constants::ACCUMULATOR_WRITE_INSTR_LENGTH)
-                 .has_value())
-        {
-            logger.error("EventHooks: FAILED TO RESTORE ACCUMULATOR WRITE BYTES!");
-        }
-        TPVToggle::scroll_hook_state().nopped.store(false);
-    }
-
-    TPVToggle::scroll_hook_state().writeAddress = nullptr;
+    // The mid hook itself is removed by DMK_Shutdown with the others; until then it lets every store through.
+    TPVToggle::scroll_hook_state().suppressWrite.store(false, std::memory_order_relaxed);
+    TPVToggle::scroll_hook_state().writeAddress.store(nullptr, std::memory_order_release);
     logger.debug("EventHooks: Cleanup complete");
 }
 
@@ -11,6 +11,7 @@
 #include "game_structures.hpp"
 #include "utils.hpp"
 #include "global_state.hpp"
+#include "shared_resolve.hpp"
 #include "game_interface.hpp"
 #include "math_utils.hpp"
 #include "config.hpp"
@@ -21,7 +22,10 @@
 #include <DirectXMath.h>
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
 #include <chrono>
+#include <cstdint>
 #include <numbers>
 #include <stdexcept>
 
@@ -38,43 +42,85 @@ using TpvCameraUpdateFunc = void(__fastcall *)(uintptr_t thisPtr, uintptr_t outp
 // Original function pointer (trampoline from SafetyHook)
 static TpvCameraUpdateFunc fpTpvCameraUpdateOriginal = nullptr;
 
+/**
+ * @brief The settings the camera update detour reads, on one cache line.
+ * @details Refreshed by refreshTpvCameraSettings() on the reload thread and read
+ *          with relaxed loads per frame, like the input hook's snapshot. The
+ *          FOV is stored already converted to radians. A reload may let a single
+ *          frame mix one old and one new word, which is harmless here.
+ */
+struct alignas(64) CameraSettingsSnapshot
+{
+    // Defaults match the LiveSettings defaults until the first refresh.
+    std::atomic<std::uint64_t> offsetXY{packFloats(0.0f, 0.0f)};      // static offset X (low), Y (high) float bits
+    std::atomic<std::uint64_t> offsetZFov{packFloats(0.0f, -1.0f)};   // static offset Z (low), FOV radians (high)
+    std::atomic<std::uint32_t> flags{0};                              // k_flag_* below
+};
+
+constexpr std::uint32_t k_flag_profiles = 1u << 0;
+constexpr std::uint32_t k_flag_trace = 1u << 1;
+
+static CameraSettingsSnapshot s_cameraSettings;
+
 /**
  * @brief Gets the currently active camera offset
  * @details Determines which offset source to use based on configuration
- * @return Vector3 The local space offset to apply
+ * @param flags The k_flag_* word of this frame's settings snapshot
+ * @param xy The packed static offset X / Y of this frame's snapshot
+ * @param z The static offset Z of this frame's snapshot
+ * @return The local space offset to apply (w = 0)
  */
-static Vector3 GetActiveOffset()
+static DirectX::XMVECTOR GetActiveOffset(std::uint32_t flags, std::uint64_t xy, float z)
 {
     // Priority 1: Active transition
-    if (settings().enableCameraProfiles.load())
+    if ((flags & k_flag_profiles) != 0)
     {
-        Vector3 transitionPosition;
-        Quaternion transitionRotation;
+        // Snapshot the profile offset BEFORE polling the transition: a profile
+        // switch publishes its transition plan before it stores the new offset,
+        // so reading in the opposite order means this frame either sees the plan
+        // or still sees the old offset, and never snaps one frame to the target.
+        // load() takes a lock-free, tear-free snapshot, and updateTransition()
+        // takes no lock either, so this per-frame path never blocks on the
+        // profile writers.
+        const Vector3 profileOffset = camera_state().offset.load();
+        const DirectX::XMVECTOR profileVec = DirectX::XMVectorSet(profileOffset.x, profileOffset.y, profileOffset.z, 0.0f);
 
         // Advance the transition by the measured frame delta so it runs at
         // wall-clock speed at any frame rate (a fixed 0.016f would tie the
-        // transition duration to ~62.5 fps). GetActiveOffset() is called once per
-        // detour invocation, so one static timestamp per call is correct.
-        static std::chrono::steady_clock::time_point s_lastTime = std::chrono::steady_clock::now();
+        // transition duration to ~62.5 fps). The clock is only read while a
+        // transition is pending or running; the idle frames in between drop the
+        // timestamp, so the first frame of the next transition starts it from
+        // the clamp floor instead of from a stale time.
+        static bool s_haveLastTime = false;
+        static std::chrono::steady_clock::time_point s_lastTime;
+        TransitionManager &transitions = TransitionManager::getInstance();
+        if (transitions.isIdle())
+        {
+            s_haveLastTime = false;
+            return profileVec;
+        }
         const auto now = std::chrono::steady_clock::now();
-        float deltaTime = std::chrono::duration<float>(now - s_lastTime).count();
+        float deltaTime = s_haveLastTime ? std::chrono::duration<float>(now - s_lastTime).count() : 0.0f;
         s_lastTime = now;
+        s_haveLastTime = true;
         // Clamp so the first frame and any frame hitch cannot jump (or, at zero,
         // stall) the transition integrator.
         deltaTime = std::clamp(deltaTime, 0.0001f, 0.1f);
 
-        if (TransitionManager::getInstance().updateTransition(deltaTime, transitionPosition, transitionRotation))
+        Vector3 transitionPosition;
+        Quaternion transitionRotation;
+        if (transitions.updateTransition(deltaTime, transitionPosition, transitionRotation))
         {
-            return transitionPosition;
+            return DirectX::XMVectorSet(transitionPosition.x, transitionPosition.y, transitionPosition.z, 0.0f);
         }
 
-        // Priority 2: Camera profile system. load() takes a lock-free, tear-free
-        // snapshot so this per-frame read never blocks on the profile writers.
-        return camera_state().offset.load();
+        // Priority 2: Camera profile system.
+        return profileVec;
     }
 
     // Priority 3: Static configuration offsets
-    return Vector3(settings().tpvOffsetX.load(), settings().tpvOffsetY.load(), settings().tpvOffsetZ.load());
+    return DirectX::XMVectorSet(std::bit_cast<float>(static_cast<std::uint32_t>(xy)),
+                                std::bit_cast<float>(static_cast<std::uint32_t>(xy >> 32)), z, 0.0f);
 }
 
 /**
@@ -83,16 +129,20 @@ static Vector3 GetActiveOffset()
  *          based on configuration, camera profiles, or transitions. Lives in a
  *          dedicated function so the SEH wrapper below stays free of C++ object
  *          unwinding (MSVC forbids __try in a frame that requires it).
+ *
+ *          The pose math stays in XMVECTOR registers end to end: the position
+ *          and quaternion are loaded straight from the output pose, the offset
+ *          is rotated with XMVector3Rotate and the sum stored back, with no
+ *          Vector3 / Quaternion round trip. Settings come from the snapshot
+ *          above (three relaxed loads) instead of the LiveSettings atomics.
  * @param thisPtr Pointer to the camera object
  * @param outputPosePtr Pointer to output structure containing position/rotation
  */
 static void Detour_TpvCameraUpdate_Impl(uintptr_t thisPtr, uintptr_t outputPosePtr)
 {
-    DMK::Logger &logger = DMK::Logger::get_instance();
-
     if (!fpTpvCameraUpdateOriginal)
     {
-        logger.error("TpvCameraHook: Original function pointer is NULL");
+        DMK::Logger::get_instance().error("TpvCameraHook: Original function pointer is NULL");
         return;
     }
 
@@ -111,41 +161,43 @@ static void Detour_TpvCameraUpdate_Impl(uintptr_t thisPtr, uintptr_t outputPoseP
     if (!DMK::Memory::plausible_userspace_ptr(outputPosePtr))
         return;
 
+    const std::uint64_t xy = s_cameraSettings.offsetXY.load(std::memory_order_relaxed);
+    const std::uint64_t zFov = s_cameraSettings.offsetZFov.load(std::memory_order_relaxed);
+    const std::uint32_t flags = s_cameraSettings.flags.load(std::memory_order_relaxed);
+
     // Apply the custom TPV FOV in radians at Constants::OFFSET_TpvFovWrite of
     // the output pose. The engine reinitializes the pose on every FPV<->TPV
     // mode switch, so writing here every frame is what survives the toggle
-    // without a separate hook. Reading the configured degrees through the
-    // hot-reload atomic also picks up INI edits on the very next frame.
-    if (const float fovDegrees = settings().tpvFovDegrees.load(std::memory_order_relaxed); fovDegrees > 0.0f)
+    // without a separate hook. The snapshot is refreshed on every INI reload,
+    // so edits are still picked up on the next frame.
+    if (const float fovRadians = std::bit_cast<float>(static_cast<std::uint32_t>(zFov >> 32)); fovRadians > 0.0f)
     {
-        *reinterpret_cast<float *>(outputPosePtr + Constants::OFFSET_TpvFovWrite) =
-            fovDegrees * (std::numbers::pi_v<float> / 180.0f);
+        *reinterpret_cast<float *>(outputPosePtr + Constants::OFFSET_TpvFovWrite) = fovRadians;
     }
 
-    Vector3 *positionPtr = reinterpret_cast<Vector3 *>(
-        outputPosePtr + Constants::TPV_OUTPUT_POSE_POSITION_OFFSET);
-    Quaternion *rotationPtr = reinterpret_cast<Quaternion *>(
-        outputPosePtr + Constants::TPV_OUTPUT_POSE_ROTATION_OFFSET);
-
-    const Vector3 currentPosition = *positionPtr;
-    const Quaternion currentRotation = *rotationPtr;
-
     // Priority order: active transition > camera profile > static config.
-    const Vector3 localOffset = GetActiveOffset();
-    if (localOffset.x == 0.0f && localOffset.y == 0.0f && localOffset.z == 0.0f)
+    const DirectX::XMVECTOR localOffset =
+        GetActiveOffset(flags, xy, std::bit_cast<float>(static_cast<std::uint32_t>(zFov)));
+    if (DirectX::XMVector3Equal(localOffset, DirectX::XMVectorZero()))
         return;
 
+    auto *position = reinterpret_cast<DirectX::XMFLOAT3 *>(outputPosePtr + Constants::TPV_OUTPUT_POSE_POSITION_OFFSET);
+    const auto *rotation =
+        reinterpret_cast<const DirectX::XMFLOAT4 *>(outputPosePtr + Constants::TPV_OUTPUT_POSE_ROTATION_OFFSET);
+
     // Rotate the local-space offset into world space and apply it on top of the
     // engine-computed position.
-    const Vector3 worldOffset = currentRotation.Rotate(localOffset);
-    *positionPtr = currentPosition + worldOffset;
+    const DirectX::XMVECTOR worldOffset = DirectX::XMVector3Rotate(localOffset, DirectX::XMLoadFloat4(rotation));
+    DirectX::XMStoreFloat3(position, DirectX::XMVectorAdd(DirectX::XMLoadFloat3(position), worldOffset));
 
-    // Build the offset strings only when trace logging is active; Vector3ToString
-    // allocates, and the arguments are evaluated before log() is entered.
-    if (logger.is_enabled(LogLevel::Trace))
+    // Build the offset strings only when trace logging is active (latched in the
+    // snapshot); Vector3ToString allocates, and the arguments are evaluated
+    // before log() is entered.
+    if ((flags & k_flag_trace) != 0)
     {
-        logger.log(LogLevel::Trace, "TpvCameraHook: Applied offset - Local: {} World: {}",
-                   Vector3ToString(localOffset), Vector3ToString(worldOffset));
+        DMK::Logger::get_instance().log(LogLevel::Trace, "TpvCameraHook: Applied offset - Local: {} World: {}",
+                                        Vector3ToString(Vector3::FromXMVector(localOffset)),
+                                        Vector3ToString(Vector3::FromXMVector(worldOffset)));
     }
 }
 
@@ -191,12 +243,14 @@ bool initializeTpvCameraHook(uintptr_t moduleBase, size_t moduleSize)
     {
         DMK::HookManager &hook_manager = DMK::HookManager::get_instance();
 
-        auto result = hook_manager.create_inline_hook_aob(
+        const std::uintptr_t address = findPatternShared(moduleBase, moduleSize, Constants::TPV_CAMERA_UPDATE_AOB_PATTERN);
+        if (!address)
+        {
+            throw std::runtime_error("TPV camera update AOB pattern not found");
+        }
+        auto result = hook_manager.create_inline_hook(
             "TpvCameraUpdate",
-            moduleBase,
-            moduleSize,
-            Constants::TPV_CAMERA_UPDATE_AOB_PATTERN,
-            0, // No offset from pattern
+            address,
             reinterpret_cast<void *>(Detour_TpvCameraUpdate),
             reinterpret_cast<void **>(&fpTpvCameraUpdateOriginal));
 
@@ -214,4 +268,24 @@ bool initializeTpvCameraHook(uintptr_t moduleBase, size_t moduleSize)
     }
 }
 
+void refreshTpvCameraSettings() noexcept
+{
+    const LiveSettings &s = settings();
+    const float fovDegrees = s.tpvFovDegrees.load(std::memory_order_relaxed);
+    const float fovRadians = fovDegrees > 0.0f ? fovDegrees * (std::numbers::pi_v<float> / 180.0f) : -1.0f;
+
+    std::uint32_t flags = 0;
+    if (s.enableCameraProfiles.load(std::memory_order_relaxed))
+        flags |= k_flag_profiles;
+    if (DMK::Logger::get_instance().is_enabled(LogLevel::Trace))
+        flags |= k_flag_trace;
+
+    s_cameraSettings.offsetXY.store(packFloats(s.tpvOffsetX.load(std::memory_order_relaxed),
+                                               s.tpvOffsetY.load(std::memory_order_relaxed)),
+                                    std::memory_order_relaxed);
+    s_cameraSettings.offsetZFov.store(packFloats(s.tpvOffsetZ.load(std::memory_order_relaxed), fovRadians),
+                                      std::memory_order_relaxed);
+    s_cameraSettings.flags.store(flags, std::memory_order_relaxed);
+}
+
 } // namespace TPVToggle
@@ -17,9 +17,9 @@ namespace TPVToggle
  * @brief Initialize the TPV camera update hook.
  * @details The same detour also writes the custom FOV (in radians) to the
  *          output pose at Constants::OFFSET_TpvFovWrite on every frame the
- *          third-person view is active. The FOV is read from the hot-reload
- *          atomic settings().tpvFovDegrees, so INI edits take effect on the
- *          next frame and the per-frame write survives FPV<->TPV mode toggles
+ *          third-person view is active. The FOV is read from the settings
+ *          snapshot that refreshTpvCameraSettings() rebuilds on each INI
+ *          reload, so INI edits take effect on the next frame and the per-frame write survives FPV<->TPV mode toggles
  *          (the engine reinitializes the pose on a toggle and this re-applies
  *          on the next frame).
  * @param moduleBase Base address of the target game module.
@@ -28,6 +28,15 @@ namespace TPVToggle
  */
 [[nodiscard]] bool initializeTpvCameraHook(uintptr_t moduleBase, size_t moduleSize);
 
+/**
+ * @brief Re-snapshots the settings the camera update detour reads.
+ * @details The detour reads one cache-line snapshot per frame (static offset,
+ *          FOV in radians, profile and Trace-level flags) instead of the
+ *          LiveSettings atomics. Call after every DMK::Config::load() (init and
+ *          each INI hot-reload) so the snapshot follows the INI.
+ */
+void refreshTpvCameraSettings() noexcept;
+
 } // namespace TPVToggle
 
 #endif // TPV_CAMERA_HOOK_HPP
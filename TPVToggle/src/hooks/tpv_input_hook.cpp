@@ -10,6 +10,7 @@
 #include "game_structures.hpp"
 #include "utils.hpp"
 #include "global_state.hpp"
+#include "shared_resolve.hpp"
 #include "config.hpp"
 #include "ui_menu_hooks.hpp"
 
@@ -17,7 +18,10 @@
 
 #include <algorithm>
 #include <atomic>
+#include <bit>
 #include <cmath>
+#include <cstdint>
+#include <utility>
 
 using DetourModKit::LogLevel;
 using DMK::Format::format_hex;
@@ -36,6 +40,76 @@ static TpvCameraInputFunc s_fpTpvCameraInputOriginal = nullptr;
 static std::atomic<float> s_currentPitch{0.0f};
 static std::atomic<bool> s_limitsInitialized{false};
 
+// Per-event trace lines are compiled out unless the build sets TPVTOGGLE_INPUT_TRACE
+// (CMake option of the same name). When compiled in they are still gated on the
+// Trace level latched into the input snapshot, so a Release-with-trace build at
+// Info level does no logger call per event either. Arguments are only evaluated
+// when the line is emitted, so format_hex allocates nothing on the quiet path.
+#ifndef TPVTOGGLE_INPUT_TRACE
+#define TPVTOGGLE_INPUT_TRACE 0
+#endif
+
+#if TPVTOGGLE_INPUT_TRACE
+#define TPV_INPUT_TRACE(snap, ...)                                               \
+    do                                                                           \
+    {                                                                            \
+        if ((snap).trace)                                                        \
+            DMK::Logger::get_instance().log(LogLevel::Trace, __VA_ARGS__);       \
+    } while (0)
+#else
+#define TPV_INPUT_TRACE(snap, ...) \
+    do                             \
+    {                              \
+    } while (0)
+#endif
+
+/**
+ * @brief The input settings the mouse detour reads, on one cache line.
+ * @details Refreshed by refreshTpvInputSettings() on the reload thread and read
+ *          with relaxed loads per event. Each pair that must stay consistent is
+ *          one 64-bit word (notably pitchMin/pitchMax, so std::clamp never sees a
+ *          half-updated min > max); the snapshot as a whole may mix one old and
+ *          one new word for a single event during a reload, which is harmless.
+ */
+struct alignas(64) InputSettingsSnapshot
+{
+    // Defaults match the LiveSettings defaults until the first refresh.
+    std::atomic<std::uint64_t> sensitivity{packFloats(1.0f, 1.0f)};     // yaw (low), pitch (high) float bits
+    std::atomic<std::uint64_t> pitchRange{packFloats(-180.0f, 180.0f)}; // min (low), max (high) float bits
+    std::atomic<std::uint32_t> flags{0};                                // k_flag_* below
+};
+
+constexpr std::uint32_t k_flag_pitch_limits = 1u << 0;
+constexpr std::uint32_t k_flag_trace = 1u << 1;
+
+/// Plain copy of the snapshot taken once at the top of an event.
+struct InputSettingsView
+{
+    float yawSensitivity;
+    float pitchSensitivity;
+    float pitchMin;
+    float pitchMax;
+    bool pitchLimitsEnabled;
+    bool trace;
+};
+
+static InputSettingsSnapshot s_inputSettings;
+
+[[nodiscard]] static InputSettingsView loadInputSettings() noexcept
+{
+    const std::uint64_t sens = s_inputSettings.sensitivity.load(std::memory_order_relaxed);
+    const std::uint64_t range = s_inputSettings.pitchRange.load(std::memory_order_relaxed);
+    const std::uint32_t flags = s_inputSettings.flags.load(std::memory_order_relaxed);
+    return InputSettingsView{
+        std::bit_cast<float>(static_cast<std::uint32_t>(sens)),
+        std::bit_cast<float>(static_cast<std::uint32_t>(sens >> 32)),
+        std::bit_cast<float>(static_cast<std::uint32_t>(range)),
+        std::bit_cast<float>(static_cast<std::uint32_t>(range >> 32)),
+        (flags & k_flag_pitch_limits) != 0,
+        (flags & k_flag_trace) != 0,
+    };
+}
+
 // Mouse event IDs for TPV camera control
 constexpr int MOUSE_EVENT_ID_TPV_YAW = 0x10A;   // Horizontal rotation
 constexpr int MOUSE_EVENT_ID_TPV_PITCH = 0x10B; // Vertical rotation
@@ -51,8 +125,6 @@ constexpr int MOUSE_EVENT_ID_TPV_ZOOM = 0x10C;  // Camera zoom
  */
 static void Detour_TpvCameraInput_Impl(uintptr_t thisPtr, char *inputEventPtr)
 {
-    DMK::Logger &logger = DMK::Logger::get_instance();
-
     // inputEventPtr is engine-handed and forwarded straight to the original, so
     // it is live by definition; screen it with a cheap arithmetic check (no
     // syscall, no region-cache lock) instead of an is_readable probe on this
@@ -78,14 +150,12 @@ static void Detour_TpvCameraInput_Impl(uintptr_t thisPtr, char *inputEventPtr)
     // the only class that carries TPV camera yaw/pitch/zoom deltas.
     if (event->eventByte0 == 0x01 && event->eventType == 0x08)
     {
-        bool modifiedInput = false;
+        const InputSettingsView cfg = loadInputSettings();
+        [[maybe_unused]] bool modifiedInput = false;
 
-        // Gate on the level before building the message: format_hex allocates a
-        // std::string and is evaluated as a call argument before log() is entered.
-        if (std::abs(event->deltaValue) > 1e-5f && logger.is_enabled(LogLevel::Trace))
+        if (std::abs(event->deltaValue) > 1e-5f)
         {
-            logger.log(LogLevel::Trace, "TPVInput RAW: EventID={} Delta={}",
-                       format_hex(event->eventId), event->deltaValue);
+            TPV_INPUT_TRACE(cfg, "TPVInput RAW: EventID={} Delta={}", format_hex(event->eventId), event->deltaValue);
         }
 
         switch (event->eventId)
@@ -93,61 +163,56 @@ static void Detour_TpvCameraInput_Impl(uintptr_t thisPtr, char *inputEventPtr)
         case MOUSE_EVENT_ID_TPV_YAW:
         {
             // Apply horizontal sensitivity if configured
-            float sensitivity = settings().yawSensitivity.load();
-            if (sensitivity != 1.0f && std::abs(event->deltaValue) > 1e-5f)
+            if (cfg.yawSensitivity != 1.0f && std::abs(event->deltaValue) > 1e-5f)
             {
-                event->deltaValue *= sensitivity;
+                event->deltaValue *= cfg.yawSensitivity;
                 modifiedInput = true;
 
-                logger.log(LogLevel::Trace, "TPVInput: Yaw adjusted with sensitivity {}", sensitivity);
+                TPV_INPUT_TRACE(cfg, "TPVInput: Yaw adjusted with sensitivity {}", cfg.yawSensitivity);
             }
             break;
         }
 
         case MOUSE_EVENT_ID_TPV_PITCH:
         {
-            float sensitivity = settings().pitchSensitivity.load();
-            float pitchMin = settings().pitchMin.load();
-            float pitchMax = settings().pitchMax.load();
-
             if (std::abs(event->deltaValue) > 1e-5f)
             {
-                float originalDelta = event->deltaValue;
+                [[maybe_unused]] const float originalDelta = event->deltaValue;
 
-                float adjustedDelta = event->deltaValue * sensitivity;
+                float adjustedDelta = event->deltaValue * cfg.pitchSensitivity;
 
-                if (settings().pitchLimitsEnabled.load())
+                if (cfg.pitchLimitsEnabled)
                 {
-                    if (!s_limitsInitialized.load())
+                    if (!s_limitsInitialized.load(std::memory_order_relaxed))
                     {
-                        s_currentPitch.store(0.0f);
-                        s_limitsInitialized.store(true);
-                        logger.info("TPVInput: Initialized pitch tracking at 0 deg");
+                        s_currentPitch.store(0.0f, std::memory_order_relaxed);
+                        s_limitsInitialized.store(true, std::memory_order_relaxed);
+                        DMK::Logger::get_instance().info("TPVInput: Initialized pitch tracking at 0 deg");
                     }
 
                     // Track accumulated pitch in degrees so the proposed angle can
                     // be clamped against the configured limits.
-                    float currentPitch = s_currentPitch.load();
-                    float proposedPitch = currentPitch + adjustedDelta;
+                    const float currentPitch = s_currentPitch.load(std::memory_order_relaxed);
+                    const float proposedPitch = currentPitch + adjustedDelta;
 
-                    float clampedPitch = std::clamp(proposedPitch, pitchMin, pitchMax);
+                    const float clampedPitch = std::clamp(proposedPitch, cfg.pitchMin, cfg.pitchMax);
 
                     // Feed the engine only the portion of the delta that survives
                     // clamping, so it never rotates past the limit.
                     adjustedDelta = clampedPitch - currentPitch;
 
-                    s_currentPitch.store(clampedPitch);
+                    s_currentPitch.store(clampedPitch, std::memory_order_relaxed);
 
-                    logger.log(LogLevel::Trace,
-                               "TPVInput PITCH: Original={} Sens={} AdjustedDelta={} Current={} deg "
-                               "Proposed={} deg Clamped={} deg Limits=[{} deg, {} deg]",
-                               originalDelta, sensitivity, adjustedDelta, currentPitch,
-                               proposedPitch, clampedPitch, pitchMin, pitchMax);
+                    TPV_INPUT_TRACE(cfg,
+                                    "TPVInput PITCH: Original={} Sens={} AdjustedDelta={} Current={} deg "
+                                    "Proposed={} deg Clamped={} deg Limits=[{} deg, {} deg]",
+                                    originalDelta, cfg.pitchSensitivity, adjustedDelta, currentPitch,
+                                    proposedPitch, clampedPitch, cfg.pitchMin, cfg.pitchMax);
                 }
                 else
                 {
-                    logger.log(LogLevel::Trace, "TPVInput PITCH: Original={} Sens={} Adjusted={} (No limits)",
-                               originalDelta, sensitivity, adjustedDelta);
+                    TPV_INPUT_TRACE(cfg, "TPVInput PITCH: Original={} Sens={} Adjusted={} (No limits)",
+                                    originalDelta, cfg.pitchSensitivity, adjustedDelta);
                 }
 
                 event->deltaValue = adjustedDelta;
@@ -165,12 +230,10 @@ static void Detour_TpvCameraInput_Impl(uintptr_t thisPtr, char *inputEventPtr)
             break;
         }
 
-        // Gate on the level before building the message: format_hex allocates a
-        // std::string and is evaluated as a call argument before log() is entered.
-        if (modifiedInput && logger.is_enabled(LogLevel::Trace))
+        if (modifiedInput)
         {
-            logger.log(LogLevel::Trace, "TPVInput MODIFIED: EventID={} FinalDelta={}",
-                       format_hex(event->eventId), event->deltaValue);
+            TPV_INPUT_TRACE(cfg, "TPVInput MODIFIED: EventID={} FinalDelta={}", format_hex(event->eventId),
+                            event->deltaValue);
         }
     }
 
@@ -206,12 +269,14 @@ bool initializeTpvInputHook(uintptr_t moduleBase, size_t moduleSize)
     {
         DMK::HookManager &hook_manager = DMK::HookManager::get_instance();
 
-        auto result = hook_manager.create_inline_hook_aob(
+        const std::uintptr_t address = findPatternShared(moduleBase, moduleSize, Constants::TPV_INPUT_PROCESS_AOB_PATTERN);
+        if (!address)
+        {
+            throw std::runtime_error("TPV input process AOB pattern not found");
+        }
+        auto result = hook_manager.create_inline_hook(
             "TpvCameraInput",
-            moduleBase,
-            moduleSize,
-            Constants::TPV_INPUT_PROCESS_AOB_PATTERN,
-            0, // No offset from pattern
+            address,
             reinterpret_cast<void *>(Detour_TpvCameraInput),
             reinterpret_cast<void **>(&s_fpTpvCameraInputOriginal));
 
@@ -229,10 +294,31 @@ bool initializeTpvInputHook(uintptr_t moduleBase, size_t moduleSize)
     }
 }
 
+void refreshTpvInputSettings() noexcept
+{
+    const LiveSettings &s = settings();
+    float pitchMin = s.pitchMin.load(std::memory_order_relaxed);
+    float pitchMax = s.pitchMax.load(std::memory_order_relaxed);
+    if (pitchMin > pitchMax)
+        std::swap(pitchMin, pitchMax); // std::clamp requires lo <= hi
+
+    std::uint32_t flags = 0;
+    if (s.pitchLimitsEnabled.load(std::memory_order_relaxed))
+        flags |= k_flag_pitch_limits;
+    if (TPVTOGGLE_INPUT_TRACE && DMK::Logger::get_instance().is_enabled(LogLevel::Trace))
+        flags |= k_flag_trace;
+
+    s_inputSettings.sensitivity.store(packFloats(s.yawSensitivity.load(std::memory_order_relaxed),
+                                                 s.pitchSensitivity.load(std::memory_order_relaxed)),
+                                      std::memory_order_relaxed);
+    s_inputSettings.pitchRange.store(packFloats(pitchMin, pitchMax), std::memory_order_relaxed);
+    s_inputSettings.flags.store(flags, std::memory_order_relaxed);
+}
+
 void resetCameraAngles()
 {
-    s_currentPitch.store(0.0f);
-    s_limitsInitialized.store(false);
+    s_currentPitch.store(0.0f, std::memory_order_relaxed);
+    s_limitsInitialized.store(false, std::memory_order_relaxed);
 }
 
 } // namespace TPVToggle
@@ -21,6 +21,15 @@ namespace TPVToggle
  */
 [[nodiscard]] bool initializeTpvInputHook(uintptr_t moduleBase, size_t moduleSize);
 
+/**
+ * @brief Re-snapshots the input settings the mouse-event detour reads.
+ * @details The detour reads one cache-line snapshot per event instead of the
+ *          LiveSettings atomics. Call after every DMK::Config::load() (init and
+ *          each INI hot-reload) so the snapshot follows the INI, including the
+ *          latched Trace-level gate for the per-event trace lines.
+ */
+void refreshTpvInputSettings() noexcept;
+
 /**
  * @brief Reset camera angles to default values
  * @details Used when switching views or resetting camera state
@@ -11,7 +11,9 @@
 #include "utils.hpp"
 #include "game_interface.hpp"
 #include "global_state.hpp"
+#include "shared_resolve.hpp"
 #include "tpv_input_hook.hpp"
+#include "entity_hooks.hpp"
 
 #include <DetourModKit.hpp>
 
@@ -51,6 +53,7 @@ static void __fastcall MenuOpenDetour(void *thisPtr, char paramByte)
 
         resetScrollAccumulator();
         g_isMenuOpen.store(true);
+        armPlayerDetection();
     }
     catch (const std::exception &e)
     {
@@ -127,13 +130,13 @@ bool initializeUiMenuHooks(uintptr_t module_base, size_t module_size)
             throw std::runtime_error("Failed to parse menu close AOB pattern");
         }
 
-        const std::byte *menuOpenHookAddress = DMK::Scanner::find_pattern(reinterpret_cast<const std::byte *>(module_base), module_size, *openPattern);
+        const std::byte *menuOpenHookAddress = findPatternShared(module_base, module_size, Constants::UI_MENU_OPEN_AOB_PATTERN, *openPattern);
         if (!menuOpenHookAddress)
         {
             throw std::runtime_error("Menu open function pattern not found");
         }
 
-        const std::byte *menuCloseHookAddress = DMK::Scanner::find_pattern(reinterpret_cast<const std::byte *>(module_base), module_size, *closePattern);
+        const std::byte *menuCloseHookAddress = findPatternShared(module_base, module_size, Constants::UI_MENU_CLOSE_AOB_PATTERN, *closePattern);
         if (!menuCloseHookAddress)
         {
             throw std::runtime_error("Menu close function pattern not found");
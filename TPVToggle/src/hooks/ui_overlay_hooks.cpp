@@ -14,7 +14,9 @@
 #include "utils.hpp"
 #include "game_interface.hpp"
 #include "global_state.hpp"
+#include "shared_resolve.hpp"
 #include "config.hpp"
+#include "toggle_thread.hpp"
 
 #include <DetourModKit.hpp>
 
@@ -35,16 +37,11 @@ using ShowOverlaysFunc = void(__fastcall *)(void *thisPtr, uint8_t paramByte, ch
 static HideOverlaysFunc fpHideOverlaysOriginal = nullptr;
 static ShowOverlaysFunc fpShowOverlaysOriginal = nullptr;
 
-// NOP pattern for the accumulator write. Typed as std::byte so it passes straight
-// to DMK::Memory::write_bytes without a cast.
-static constexpr std::byte nopSequence[Constants::ACCUMULATOR_WRITE_INSTR_LENGTH] = {
-    std::byte{0x90}, std::byte{0x90}, std::byte{0x90}, std::byte{0x90}, std::byte{0x90}};
-
 /**
  * @brief Detour function for the HideOverlays function
  * @details Intercepts when UI overlay is about to be hidden and requests a
  *          switch to first-person view before any UI elements appear.
- *          Also handles scroll state and NOP'ing scroll accumulator.
+ *          Also resets the scroll accumulator.
  * @param thisPtr Pointer to the UI overlay object
  * @param paramByte First parameter to the original function (byte)
  * @param paramChar Second parameter to the original function (char)
@@ -85,8 +82,9 @@ static void __fastcall HideOverlaysDetour(void *thisPtr, uint8_t paramByte, char
                 TPVToggle::overlay_state().wasTpvBeforeOverlay.store(false);
             }
 
-            // Request the switch to FPV; the monitor thread processes it.
+            // Request the switch to FPV; the background worker processes it.
             TPVToggle::overlay_state().fpvRequest.store(true);
+            TPVToggle::wake_tpv_worker();
 
             resetScrollAccumulator(true);
             TPVToggle::overlay_state().active.store(true);
@@ -94,6 +92,7 @@ static void __fastcall HideOverlaysDetour(void *thisPtr, uint8_t paramByte, char
         else
         {
             TPVToggle::overlay_state().fpvRequest.store(true);
+            TPVToggle::wake_tpv_worker();
         }
     }
     catch (const std::exception &e)
@@ -110,7 +109,7 @@ static void __fastcall HideOverlaysDetour(void *thisPtr, uint8_t paramByte, char
  * @brief Detour function for the ShowOverlays function
  * @details Intercepts when UI overlay is about to be shown again and requests
  *          a switch back to third-person view if that was the previous state.
- *          Also handles restoring scroll accumulator functionality.
+ *          Also resets the scroll accumulator.
  * @param thisPtr Pointer to the UI overlay object
  * @param paramByte First parameter to the original function (byte)
  * @param paramChar Second parameter to the original function (char)
@@ -144,6 +143,7 @@ static void __fastcall ShowOverlaysDetour(void *thisPtr, uint8_t paramByte, char
         {
             logger.debug("UIOverlayHook: Requesting TPV restoration");
             TPVToggle::overlay_state().tpvRestoreRequest.store(true);
+            TPVToggle::wake_tpv_worker();
         }
         else
         {
@@ -164,7 +164,9 @@ static void __fastcall ShowOverlaysDetour(void *thisPtr, uint8_t paramByte, char
 
 /**
  * @brief Handler for hold-to-scroll key state changes
- * @details Called by the main monitor thread when hold-to-scroll key state changes
+ * @details Called from the hold_scroll DMK::InputManager callback when the key state changes. Selects the
+ *          behaviour of the accumulator-write mid hook (event_hooks.cpp) with one flag store; the game code is
+ *          never re-patched.
  * @param holdKeyPressed Whether a hold key is currently pressed
  * @return true if the state was successfully handled, false otherwise
  */
@@ -172,41 +174,28 @@ bool handleHoldToScrollKeyState(bool holdKeyPressed)
 {
     DMK::Logger &logger = DMK::Logger::get_instance();
 
-    // Skip if no accumulator address found or if overlay is active
-    if (!TPVToggle::scroll_hook_state().writeAddress || TPVToggle::overlay_state().active.load())
+    // Skip if the accumulator write is not hooked or if overlay is active
+    if (!TPVToggle::scroll_hook_state().writeAddress.load(std::memory_order_relaxed) || TPVToggle::overlay_state().active.load())
     {
         return false;
     }
 
-    // If hold key is pressed but accumulator is currently NOPped, restore original bytes
-    if (holdKeyPressed && TPVToggle::scroll_hook_state().nopped.load())
+    // Key down lets the scroll through; key up suppresses it again. exchange() reports whether this was an edge.
+    const bool suppress = !holdKeyPressed;
+    if (TPVToggle::scroll_hook_state().suppressWrite.exchange(suppress, std::memory_order_relaxed) == suppress)
     {
-        if (DMK::Memory::write_bytes(TPVToggle::scroll_hook_state().writeAddress,
-                                   TPVToggle::scroll_hook_state().originalWriteBytes,
-                                   Constants::ACCUMULATOR_WRITE_INSTR_LENGTH)
-                .has_value())
-        {
-            TPVToggle::scroll_hook_state().nopped.store(false);
-            logger.debug("UIOverlayHook: Restored accumulator write due to hold key press");
-            return true;
-        }
+        return false;
     }
-    // If hold key is released but accumulator is not NOPped, NOP it
-    else if (!holdKeyPressed && !TPVToggle::scroll_hook_state().nopped.load())
+    if (suppress)
     {
-        if (DMK::Memory::write_bytes(TPVToggle::scroll_hook_state().writeAddress,
-                                   nopSequence,
-                                   Constants::ACCUMULATOR_WRITE_INSTR_LENGTH)
-                .has_value())
-        {
-            TPVToggle::scroll_hook_state().nopped.store(true);
-            logger.debug("UIOverlayHook: NOPped accumulator write due to hold key release");
-            resetScrollAccumulator(true);
-            return true;
-        }
+        logger.debug("UIOverlayHook: Suppressed accumulator write due to hold key release");
+        resetScrollAccumulator(true);
     }
-
-    return false;
+    else
+    {
+        logger.debug("UIOverlayHook: Restored accumulator write due to hold key press");
+    }
+    return true;
 }
 
 bool initializeUiOverlayHooks(uintptr_t module_base, size_t module_size)
@@ -217,12 +206,14 @@ bool initializeUiOverlayHooks(uintptr_t module_base, size_t module_size)
     {
         DMK::HookManager &hook_manager = DMK::HookManager::get_instance();
 
-        auto hideResult = hook_manager.create_inline_hook_aob(
+        const std::uintptr_t hideAddress = findPatternShared(module_base, module_size, Constants::UI_OVERLAY_HIDE_AOB_PATTERN);
+        if (!hideAddress)
+        {
+            throw std::runtime_error("HideOverlays AOB pattern not found");
+        }
+        auto hideResult = hook_manager.create_inline_hook(
             "HideOverlays",
-            module_base,
-            module_size,
-            Constants::UI_OVERLAY_HIDE_AOB_PATTERN,
-            0,
+            hideAddress,
             reinterpret_cast<void *>(HideOverlaysDetour),
             reinterpret_cast<void **>(&fpHideOverlaysOriginal));
 
@@ -231,12 +222,14 @@ bool initializeUiOverlayHooks(uintptr_t module_base, size_t module_size)
             throw std::runtime_error("Failed to create HideOverlays hook: " + std::string(DMK::Hook::error_to_string(hideResult.error())));
         }
 
-        auto showResult = hook_manager.create_inline_hook_aob(
+        const std::uintptr_t showAddress = findPatternShared(module_base, module_size, Constants::UI_OVERLAY_SHOW_AOB_PATTERN);
+        if (!showAddress)
+        {
+            throw std::runtime_error("ShowOverlays AOB pattern not found");
+        }
+        auto showResult = hook_manager.create_inline_hook(
             "ShowOverlays",
-            module_base,
-            module_size,
-            Constants::UI_OVERLAY_SHOW_AOB_PATTERN,
-            0,
+            showAddress,
             reinterpret_cast<void *>(ShowOverlaysDetour),
             reinterpret_cast<void **>(&fpShowOverlaysOriginal));
 
@@ -245,19 +238,6 @@ bool initializeUiOverlayHooks(uintptr_t module_base, size_t module_size)
             throw std::runtime_error("Failed to create ShowOverlays hook: " + std::string(DMK::Hook::error_to_string(showResult.error())));
         }
 
-        // Set initial hold-to-scroll state if feature is enabled
-        if (!g_config.hold_scroll_keys.empty() && TPVToggle::scroll_hook_state().writeAddress)
-        {
-            logger.info("UIOverlayHook: Hold-to-scroll feature enabled, applying NOP by default");
-            if (DMK::Memory::write_bytes(TPVToggle::scroll_hook_state().writeAddress,
-                                      nopSequence,
-                                      Constants::ACCUMULATOR_WRITE_INSTR_LENGTH)
-                    .has_value())
-            {
-                TPVToggle::scroll_hook_state().nopped.store(true);
-            }
-        }
-
         return true;
     }
     catch (const std::exception &e)
@@ -25,7 +25,7 @@ namespace TPVToggle
 
 /**
  * @brief Handler for hold-to-scroll key state changes
- * @details Called by the main monitor thread when hold-to-scroll key state changes
+ * @details Called from the hold_scroll DMK::InputManager callback when the key state changes
  * @param holdKeyPressed Whether a hold key is currently pressed
  * @return true if the state was successfully handled, false otherwise
  */
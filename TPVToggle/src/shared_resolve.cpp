@@ -0,0 +1,237 @@
+/**
+ * @file shared_resolve.cpp
+ * @brief Named file mapping behind the shared AOB match table (see shared_resolve.hpp).
+ */
+
+#include "shared_resolve.hpp"
+
+#include <DetourModKit.hpp>
+
+#include <windows.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cwchar>
+#include <iterator>
+
+namespace TPVToggle
+{
+
+namespace
+{
+// ---- Wire format v1 (mirrored in TPVCamera/src/shared_resolve.cpp) ------------------------------------------------
+constexpr std::uint32_t SHARED_MAGIC = 0x53565054; // "TPVS"
+constexpr std::uint32_t SHARED_VERSION = 1;
+constexpr std::uint32_t SHARED_CAPACITY = 256;
+
+constexpr std::uint64_t KIND_PATTERN = 0x5000000000000000ull; // top nibble of a key ('P'attern; 'R'TTI is 0x7)
+constexpr std::uint64_t KIND_MASK = 0xF000000000000000ull;
+
+struct SharedEntry
+{
+    std::uint64_t key;
+    std::uint64_t value; // absolute address in this process
+    std::uint32_t flags; // bit 0: the only match in the code sections (set by TPVCamera)
+    std::uint32_t reserved;
+};
+
+struct SharedTable
+{
+    volatile LONG lock; // 0 free, 1 held (InterlockedCompareExchange)
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t count;
+    std::uint64_t module_base;
+    std::uint32_t time_date_stamp;
+    std::uint32_t size_of_image;
+    SharedEntry entries[SHARED_CAPACITY];
+};
+// The wire layout is fixed; these asserts match TPVCamera's field for field, so a change on either side breaks both.
+static_assert(sizeof(SharedEntry) == 24, "TPVS v1: entry size");
+static_assert(offsetof(SharedEntry, key) == 0 && offsetof(SharedEntry, value) == 8, "TPVS v1: entry key/value");
+static_assert(offsetof(SharedEntry, flags) == 16 && offsetof(SharedEntry, reserved) == 20, "TPVS v1: entry flags");
+static_assert(offsetof(SharedTable, lock) == 0 && offsetof(SharedTable, magic) == 4, "TPVS v1: lock/magic");
+static_assert(offsetof(SharedTable, version) == 8 && offsetof(SharedTable, count) == 12, "TPVS v1: version/count");
+static_assert(offsetof(SharedTable, module_base) == 16, "TPVS v1: module_base");
+static_assert(offsetof(SharedTable, time_date_stamp) == 24 && offsetof(SharedTable, size_of_image) == 28,
+              "TPVS v1: module identity");
+static_assert(offsetof(SharedTable, entries) == 32, "TPVS v1: entries");
+static_assert(sizeof(SharedTable) == 32 + 24 * 256 && SHARED_CAPACITY == 256, "TPVS v1: table size");
+static_assert(SHARED_MAGIC == 0x53565054 && SHARED_VERSION == 1, "TPVS v1: magic/version");
+static_assert(KIND_PATTERN == 0x5000000000000000ull && KIND_MASK == 0xF000000000000000ull, "TPVS v1: key kinds");
+// ---------------------------------------------------------------------------------------------------------------
+
+// Mapped for the life of the process, never unmapped: the table is only read and written during init.
+std::atomic<SharedTable *> s_sharedTable{nullptr};
+
+/// FNV-1a over the pattern's tokens, upper-cased, with every wildcard spelled "?" and one space between.
+std::uint64_t patternKey(std::string_view aob_text) noexcept
+{
+    std::uint64_t h = 0xCBF29CE484222325ull;
+    const auto mix = [&h](char c)
+    {
+        h = (h ^ static_cast<std::uint8_t>(c)) * 0x100000001B3ull;
+    };
+    bool first = true;
+    std::size_t i = 0;
+    while (i < aob_text.size())
+    {
+        while (i < aob_text.size() && (aob_text[i] == ' ' || aob_text[i] == '\t'))
+            ++i;
+        const std::size_t start = i;
+        while (i < aob_text.size() && aob_text[i] != ' ' && aob_text[i] != '\t')
+            ++i;
+        if (i == start)
+            break;
+        if (!first)
+            mix(' ');
+        first = false;
+        if (aob_text[start] == '?')
+        {
+            mix('?');
+            continue;
+        }
+        for (std::size_t k = start; k < i; ++k)
+        {
+            const char c = aob_text[k];
+            mix((c >= 'a' && c <= 'f') ? static_cast<char>(c - 'a' + 'A') : c);
+        }
+    }
+    return (h & ~KIND_MASK) | KIND_PATTERN;
+}
+
+/// Holds the table's spin lock for the enclosing scope.
+class SharedTableLock
+{
+public:
+    explicit SharedTableLock(SharedTable &table) noexcept : m_table(table)
+    {
+        while (InterlockedCompareExchange(&m_table.lock, 1, 0) != 0)
+            YieldProcessor();
+    }
+    ~SharedTableLock() noexcept { InterlockedExchange(&m_table.lock, 0); }
+    SharedTableLock(const SharedTableLock &) = delete;
+    SharedTableLock &operator=(const SharedTableLock &) = delete;
+
+private:
+    SharedTable &m_table;
+};
+
+const SharedEntry *findEntryLocked(const SharedTable &table, std::uint64_t key) noexcept
+{
+    const std::uint32_t n = table.count < SHARED_CAPACITY ? table.count : SHARED_CAPACITY;
+    for (std::uint32_t i = 0; i < n; ++i)
+    {
+        if (table.entries[i].key == key)
+            return &table.entries[i];
+    }
+    return nullptr;
+}
+} // namespace
+
+void openSharedResolve(std::uintptr_t module_base) noexcept
+{
+    DMK::Logger &logger = DMK::Logger::get_instance();
+    if (s_sharedTable.load(std::memory_order_relaxed) != nullptr || module_base == 0)
+        return;
+
+    const auto *dos = reinterpret_cast<const IMAGE_DOS_HEADER *>(module_base);
+    if (dos->e_magic != IMAGE_DOS_SIGNATURE)
+        return;
+    const auto *nt = reinterpret_cast<const IMAGE_NT_HEADERS64 *>(module_base + dos->e_lfanew);
+    if (nt->Signature != IMAGE_NT_SIGNATURE)
+        return;
+    const std::uint32_t stamp = nt->FileHeader.TimeDateStamp;
+    const std::uint32_t size_of_image = nt->OptionalHeader.SizeOfImage;
+
+    wchar_t name[96];
+    std::swprintf(name, std::size(name), L"Local\\KCD2TPV.SharedResolve.v%u.%lu.%llx.%08x", SHARED_VERSION,
+                  GetCurrentProcessId(), static_cast<unsigned long long>(module_base), stamp);
+    HANDLE mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, sizeof(SharedTable), name);
+    if (!mapping)
+    {
+        logger.debug("SharedResolve: mapping unavailable ({}); scanning alone", GetLastError());
+        return;
+    }
+    const bool existed = GetLastError() == ERROR_ALREADY_EXISTS;
+    auto *table = static_cast<SharedTable *>(MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(SharedTable)));
+    CloseHandle(mapping); // the view keeps the section alive for as long as either mod maps it
+    if (!table)
+        return;
+
+    bool usable = false;
+    std::uint32_t entries = 0;
+    {
+        const SharedTableLock lock(*table);
+        if (table->magic == 0)
+        {
+            // A fresh mapping is zero-filled; the first mod in fills the header under the lock.
+            table->magic = SHARED_MAGIC;
+            table->version = SHARED_VERSION;
+            table->module_base = module_base;
+            table->time_date_stamp = stamp;
+            table->size_of_image = size_of_image;
+        }
+        usable = table->magic == SHARED_MAGIC && table->version == SHARED_VERSION &&
+                 table->module_base == module_base && table->time_date_stamp == stamp &&
+                 table->size_of_image == size_of_image;
+        entries = table->count;
+    }
+    if (!usable)
+    {
+        UnmapViewOfFile(table);
+        logger.debug("SharedResolve: foreign table layout; scanning alone");
+        return;
+    }
+    s_sharedTable.store(table, std::memory_order_release);
+    logger.debug("SharedResolve: {} table ({} entries)", existed ? "joined" : "created", entries);
+}
+
+std::uintptr_t lookupSharedPattern(std::string_view aob_text, std::uintptr_t module_base,
+                                   std::size_t module_size) noexcept
+{
+    SharedTable *table = s_sharedTable.load(std::memory_order_acquire);
+    if (!table)
+        return 0;
+    const std::uint64_t key = patternKey(aob_text);
+    std::uint64_t value = 0;
+    {
+        const SharedTableLock lock(*table);
+        if (const SharedEntry *e = findEntryLocked(*table, key))
+            value = e->value;
+    }
+    const std::size_t length = aobPatternLength(aob_text);
+    if (value < module_base || length > module_size || value - module_base > module_size - length)
+        return 0;
+    return static_cast<std::uintptr_t>(value);
+}
+
+void publishSharedPattern(std::string_view aob_text, std::uintptr_t match) noexcept
+{
+    SharedTable *table = s_sharedTable.load(std::memory_order_acquire);
+    if (!table || match == 0)
+        return;
+    const std::uint64_t key = patternKey(aob_text);
+    const SharedTableLock lock(*table);
+    // Already there (from TPVCamera, with its uniqueness flag), or full: the table is only an accelerator.
+    if (findEntryLocked(*table, key) || table->count >= SHARED_CAPACITY)
+        return;
+    table->entries[table->count] = SharedEntry{key, match, 0, 0};
+    ++table->count;
+}
+
+std::size_t aobPatternLength(std::string_view aob_text) noexcept
+{
+    std::size_t tokens = 0;
+    bool in_token = false;
+    for (const char c : aob_text)
+    {
+        const bool space = (c == ' ' || c == '\t');
+        if (!space && !in_token)
+            ++tokens;
+        in_token = !space;
+    }
+    return tokens;
+}
+
+} // namespace TPVToggle
@@ -0,0 +1,85 @@
+/**
+ * @file shared_resolve.hpp
+ * @brief In-process table of resolved AOB matches shared with TPVCamera when both mods are loaded.
+ *
+ * @details Both ASIs scan the same WHGame.dll image at startup. Each one publishes the matches it found into one
+ *          small named file mapping. The mapping name carries the process id, the module base and the PE
+ *          TimeDateStamp. Whichever mod starts second re-checks a published match with a byte-compare against
+ *          its own pattern before using it, and scans as before when there is none. When the mapping cannot be
+ *          created, or it belongs to another layout version, lookups miss and publishes are dropped, so the mod
+ *          behaves exactly as it does on its own.
+ *
+ *          The wire format is mirrored in TPVCamera/src/shared_resolve.cpp, which also stores RTTI verdicts in
+ *          it. This mod walks no RTTI, so it only reads and writes pattern entries.
+ */
+#ifndef SHARED_RESOLVE_HPP
+#define SHARED_RESOLVE_HPP
+
+#include <DetourModKit.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace TPVToggle
+{
+
+/**
+ * @brief Opens (or creates) the shared table for the image at @p module_base.
+ * @details Call once from initialize_hooks(), before the first findPatternShared().
+ */
+void openSharedResolve(std::uintptr_t module_base) noexcept;
+
+/**
+ * @brief A published match of @p aob_text that lies inside the module, or 0.
+ * @details The match has not been re-checked yet; findPatternShared() byte-compares it.
+ */
+[[nodiscard]] std::uintptr_t lookupSharedPattern(std::string_view aob_text, std::uintptr_t module_base,
+                                                 std::size_t module_size) noexcept;
+
+/** @brief Publishes the match of @p aob_text for the other mod. */
+void publishSharedPattern(std::string_view aob_text, std::uintptr_t match) noexcept;
+
+/** @brief Byte length of an AOB pattern string (one byte per token, wildcards included). */
+[[nodiscard]] std::size_t aobPatternLength(std::string_view aob_text) noexcept;
+
+/**
+ * @brief DMK::Scanner::find_pattern over the module, preceded by a check of the shared table.
+ * @details A published match is taken only when @p pattern still matches there. Otherwise the module is scanned,
+ *          and the result is published.
+ * @param aob_text The pattern text that @p pattern was parsed from. This text is the table key.
+ * @param pattern The parsed pattern, as returned by DMK::Scanner::parse_aob(@p aob_text).
+ */
+template <typename Pattern>
+[[nodiscard]] const std::byte *findPatternShared(std::uintptr_t module_base, std::size_t module_size,
+                                                 std::string_view aob_text, const Pattern &pattern)
+{
+    if (const std::uintptr_t shared = lookupSharedPattern(aob_text, module_base, module_size))
+    {
+        const auto *at = reinterpret_cast<const std::byte *>(shared);
+        if (DMK::Scanner::find_pattern(at, aobPatternLength(aob_text), pattern) == at)
+            return at;
+    }
+    const std::byte *match =
+        DMK::Scanner::find_pattern(reinterpret_cast<const std::byte *>(module_base), module_size, pattern);
+    if (match)
+        publishSharedPattern(aob_text, reinterpret_cast<std::uintptr_t>(match));
+    return match;
+}
+
+/**
+ * @brief Parses @p aob_text and resolves it through findPatternShared().
+ * @return The match address, or 0 when the pattern does not parse or does not match.
+ */
+[[nodiscard]] inline std::uintptr_t findPatternShared(std::uintptr_t module_base, std::size_t module_size,
+                                                      std::string_view aob_text)
+{
+    const auto pattern = DMK::Scanner::parse_aob(aob_text);
+    if (!pattern.has_value())
+        return 0;
+    return reinterpret_cast<std::uintptr_t>(findPatternShared(module_base, module_size, aob_text, *pattern));
+}
+
+} // namespace TPVToggle
+
+#endif // SHARED_RESOLVE_HPP
@@ -1,85 +1,188 @@
 /**
  * @file toggle_thread.cpp
- * @brief Implements the overlay-driven view state change worker.
+ * @brief Implements the event-driven background worker.
  *
- * Processes overlay FPV/TPV restore requests set by UI overlay hooks.
- * Key input monitoring is handled by DMK::InputManager callbacks registered
- * during input setup, so this worker only handles hook-driven state changes.
+ * One worker services both hook-driven view-state changes (overlay FPV / TPV
+ * restore requests) and continuous camera offset adjustment. It sleeps on an
+ * auto-reset event signalled by the UI overlay hooks, the DMK::InputManager
+ * hold callbacks and the stop token, and only arms a timeout while it has
+ * timed work: an offset key held in adjustment mode, a pending TPV restore
+ * delay, or the game interface not yet resolved. Edge-triggered key actions
+ * are handled by DMK::InputManager press callbacks registered during input
+ * setup.
  */
 
 #include "toggle_thread.hpp"
+#include "camera_profile.hpp"
 #include "config.hpp"
 #include "constants.hpp"
 #include "game_interface.hpp"
 #include "global_state.hpp"
-#include "utils.hpp"
 
 #include <DetourModKit.hpp>
 
 #include <windows.h>
 
+#include <algorithm>
+#include <atomic>
+
 namespace TPVToggle
 {
 
-void overlay_monitor_body(std::stop_token st)
+namespace
+{
+// Bit per OffsetKey, written by the InputManager hold callbacks.
+std::atomic<std::uint8_t> s_heldOffsetKeys{0};
+
+// Auto-reset wake event. Created on first use (by whichever of the worker, a
+// hook or an input callback gets there first) and kept for the process
+// lifetime, so a late SetEvent from a hook never touches a closed handle.
+HANDLE wake_event() noexcept
+{
+    static const HANDLE s_event = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+    return s_event;
+}
+
+constexpr std::uint8_t offset_bit(OffsetKey key) noexcept
+{
+    return static_cast<std::uint8_t>(1u << static_cast<unsigned>(key));
+}
+
+/**
+ * @brief Applies one step for every held offset direction.
+ * @return true if an offset key is held in adjustment mode, i.e. the repeat
+ *         timer must stay armed.
+ */
+bool apply_held_offsets()
+{
+    const std::uint8_t held = s_heldOffsetKeys.load(std::memory_order_relaxed);
+    if (held == 0 || !camera_state().adjustmentMode.load())
+        return false;
+
+    const auto axis = [held](OffsetKey inc, OffsetKey dec) {
+        return ((held & offset_bit(inc)) ? 1.0f : 0.0f) - ((held & offset_bit(dec)) ? 1.0f : 0.0f);
+    };
+    const float step = settings().offsetAdjustmentStep.load();
+    const float x = axis(OffsetKey::XInc, OffsetKey::XDec);
+    const float y = axis(OffsetKey::YInc, OffsetKey::YDec);
+    const float z = axis(OffsetKey::ZInc, OffsetKey::ZDec);
+    if (x != 0.0f || y != 0.0f || z != 0.0f)
+        CameraProfileManager::getInstance().adjustOffset(x * step, y * step, z * step);
+    return true;
+}
+
+/** @brief Milliseconds from now until the tick @p due (0 if already due). */
+DWORD ms_until(ULONGLONG now, ULONGLONG due) noexcept
+{
+    return due > now ? static_cast<DWORD>(due - now) : 0;
+}
+} // namespace
+
+void wake_tpv_worker() noexcept
+{
+    if (const HANDLE event = wake_event())
+        SetEvent(event);
+}
+
+void set_offset_key_held(OffsetKey key, bool held) noexcept
+{
+    if (held)
+        s_heldOffsetKeys.fetch_or(offset_bit(key), std::memory_order_relaxed);
+    else
+        s_heldOffsetKeys.fetch_and(static_cast<std::uint8_t>(~offset_bit(key)), std::memory_order_relaxed);
+    wake_tpv_worker();
+}
+
+void tpv_worker_body(std::stop_token st)
 {
     DMK::Logger &logger = DMK::Logger::get_instance();
-    logger.info("OverlayMonitor: Started");
+    logger.info("TPVWorker: Started (event-driven)");
 
-    logger.info("OverlayMonitor: Waiting for game interface...");
-    while (!getResolvedTpvFlagAddress())
+    const HANDLE wake = wake_event();
+    if (!wake)
     {
-        if (!sleep_until_stop(st, 250))
-        {
-            logger.info("OverlayMonitor: Stopped before game interface was ready");
-            return;
-        }
+        logger.error("TPVWorker: CreateEvent failed ({}); worker not running", GetLastError());
+        return;
     }
-    logger.info("OverlayMonitor: Game interface ready");
+    // Wake the wait on shutdown so the join does not sit out a timeout.
+    std::stop_callback on_stop(st, [wake] { SetEvent(wake); });
+
+    bool interfaceReady = false;
+    bool restorePending = false;
+    ULONGLONG restoreDue = 0;
 
-    // Main loop: process overlay requests only.
-    while (sleep_until_stop(st, Constants::MAIN_MONITOR_SLEEP_MS))
+    while (!st.stop_requested())
     {
+        DWORD timeout = INFINITE;
         try
         {
-            if (overlay_state().fpvRequest.load(std::memory_order_relaxed))
+            const ULONGLONG now = GetTickCount64();
+
+            if (!interfaceReady && getResolvedTpvFlagAddress())
             {
-                logger.debug("OverlayMonitor: Processing FPV request");
-                (void)setViewState(0);
-                overlay_state().fpvRequest.store(false, std::memory_order_relaxed);
+                interfaceReady = true;
+                logger.info("TPVWorker: Game interface ready");
             }
 
-            if (overlay_state().tpvRestoreRequest.load(std::memory_order_relaxed))
+            // Requests are serviced in the order the hooks post them: an FPV
+            // request that arrives during a TPV restore delay waits for the
+            // restore, as it did when the delay was a blocking sleep.
+            if (interfaceReady)
             {
-                logger.debug("OverlayMonitor: Processing TPV restore request");
-                // Allow the UI to settle before restoring TPV. Wait on the stop
-                // token so a shutdown during the (configurable, possibly large)
-                // delay tears down promptly instead of blocking the join.
-                const int restore_delay = settings().overlayRestoreDelayMs.load();
-                if (restore_delay > 0 && !sleep_until_stop(st, static_cast<unsigned long>(restore_delay)))
+                if (!restorePending && overlay_state().fpvRequest.load(std::memory_order_relaxed))
                 {
-                    logger.info("OverlayMonitor: Stopped during TPV restore delay");
-                    return;
+                    logger.debug("TPVWorker: Processing FPV request");
+                    (void)setViewState(0);
+                    overlay_state().fpvRequest.store(false, std::memory_order_relaxed);
                 }
-                (void)setViewState(1);
-                overlay_state().tpvRestoreRequest.store(false, std::memory_order_relaxed);
+
+                if (!restorePending && overlay_state().tpvRestoreRequest.load(std::memory_order_relaxed))
+                {
+                    logger.debug("TPVWorker: Processing TPV restore request");
+                    // Allow the UI to settle before restoring TPV. The delay is a
+                    // wait deadline, so offset keys and shutdown are still serviced
+                    // while it runs.
+                    restorePending = true;
+                    restoreDue = now + static_cast<ULONGLONG>(std::max(settings().overlayRestoreDelayMs.load(), 0));
+                }
+
+                if (restorePending && now >= restoreDue)
+                {
+                    (void)setViewState(1);
+                    overlay_state().tpvRestoreRequest.store(false, std::memory_order_relaxed);
+                    restorePending = false;
+                    // An FPV request held back by the delay is serviced right away.
+                    if (overlay_state().fpvRequest.load(std::memory_order_relaxed))
+                        timeout = 0;
+                }
+
+                if (restorePending)
+                    timeout = std::min(timeout, ms_until(now, restoreDue));
             }
+            else
+            {
+                timeout = Constants::WORKER_INTERFACE_POLL_MS;
+            }
+
+            // Keyed repeat timer: armed only while an offset key is held.
+            if (apply_held_offsets())
+                timeout = std::min(timeout, Constants::WORKER_OFFSET_REPEAT_MS);
         }
         catch (const std::exception &e)
         {
-            logger.error("OverlayMonitor: Error: {}", e.what());
-            if (!sleep_until_stop(st, 1000))
-                return;
+            logger.error("TPVWorker: Error: {}", e.what());
+            timeout = Constants::WORKER_ERROR_BACKOFF_MS;
         }
         catch (...)
         {
-            logger.error("OverlayMonitor: Unknown error");
-            if (!sleep_until_stop(st, 1000))
-                return;
+            logger.error("TPVWorker: Unknown error");
+            timeout = Constants::WORKER_ERROR_BACKOFF_MS;
         }
+
+        WaitForSingleObject(wake, timeout);
     }
 
-    logger.info("OverlayMonitor: Exiting");
+    logger.info("TPVWorker: Exiting");
 }
 
 } // namespace TPVToggle
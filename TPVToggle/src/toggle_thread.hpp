@@ -1,24 +1,56 @@
 /**
  * @file toggle_thread.hpp
- * @brief Worker body for overlay-driven view state changes.
+ * @brief Event-driven worker for overlay view-state changes and held offset keys.
  */
 #ifndef TOGGLE_THREAD_HPP
 #define TOGGLE_THREAD_HPP
 
+#include <cstdint>
 #include <stop_token>
 
 namespace TPVToggle
 {
 
+/** @brief The six camera-offset hold bindings, one bit each in the held-key mask. */
+enum class OffsetKey : std::uint8_t
+{
+    XInc,
+    XDec,
+    YInc,
+    YDec,
+    ZInc,
+    ZDec
+};
+
+/**
+ * @brief Wakes the worker so it re-examines its inputs now.
+ * @details Called by the UI overlay hooks after posting an FPV / TPV-restore
+ *          request and by input callbacks whose effect the worker applies.
+ *          Safe from any thread; coalesces with pending wakes.
+ */
+void wake_tpv_worker() noexcept;
+
+/**
+ * @brief Records the held state of an offset-direction binding and wakes the worker.
+ * @details Called from the DMK::InputManager hold callbacks.
+ * @param key The offset binding whose state changed.
+ * @param held true on press, false on release.
+ */
+void set_offset_key_held(OffsetKey key, bool held) noexcept;
+
 /**
- * @brief StoppableWorker body that processes overlay-driven view-state changes.
- * @details Waits for the game interface to be ready, then applies the overlay
- *          FPV / TPV-restore requests posted by the UI overlay hooks. Returns
- *          promptly once the stop token is signalled. Key input is handled by
- *          DMK::InputManager callbacks, not here.
+ * @brief StoppableWorker body for the mod's background work.
+ * @details Blocks on a wake event instead of polling. It applies the overlay
+ *          FPV / TPV-restore requests posted by the UI overlay hooks once the
+ *          game interface is ready, and, while camera adjustment mode is on and
+ *          an offset key is held, applies the configured step on a fixed repeat
+ *          timer. With no request pending and no offset key held it does not
+ *          wake at all. Edge-triggered actions are handled by DMK::InputManager
+ *          press callbacks, not here. Returns promptly once the stop token is
+ *          signalled.
  * @param st The worker's stop token.
  */
-void overlay_monitor_body(std::stop_token st);
+void tpv_worker_body(std::stop_token st);
 
 } // namespace TPVToggle
 
@@ -1,6 +1,6 @@
 /**
  * @file tpv_toggle.cpp
- * @brief Mod lifecycle: configuration, hooks, input bindings, and poll workers.
+ * @brief Mod lifecycle: configuration, hooks, input bindings, and the background worker.
  *
  * init() and shutdown() are invoked by DMK::Bootstrap from a dedicated worker
  * thread, so the heavy setup and teardown run off the Windows loader lock.
@@ -11,10 +11,10 @@
 #include "constants.hpp"
 #include "global_state.hpp"
 #include "game_interface.hpp"
+#include "shared_resolve.hpp"
 #include "version.hpp"
 #include "camera_profile.hpp"
 #include "toggle_thread.hpp"
-#include "camera_profile_thread.hpp"
 #include "hooks/event_hooks.hpp"
 #include "hooks/tpv_camera_hook.hpp"
 #include "hooks/tpv_input_hook.hpp"
@@ -36,10 +36,9 @@
 namespace TPVToggle
 {
 
-// Poll workers and the RAII guards for the press bindings registered via
+// Background worker and the RAII guards for the press bindings registered via
 // DMK::Config::register_press_combo (cleared during shutdown).
-static std::unique_ptr<DMK::StoppableWorker> s_overlayWorker;
-static std::unique_ptr<DMK::StoppableWorker> s_cameraProfileWorker;
+static std::unique_ptr<DMK::StoppableWorker> s_worker;
 static std::vector<DMK::Config::InputBindingGuard> s_bindingGuards;
 
 /**
@@ -96,6 +95,9 @@ static bool initialize_hooks()
     DMK::Logger &logger = DMK::Logger::get_instance();
     const ModuleInfo &mod = module_info();
 
+    // Matches TPVCamera already resolved in this process are reused (after a byte check) by every scan below.
+    openSharedResolve(mod.base);
+
     if (!initializeGameInterface(mod.base, mod.size))
     {
         logger.error("Critical: Game interface initialization failed - mod cannot function");
@@ -121,8 +123,8 @@ static bool initialize_hooks()
     }
 
     // The TPV FOV override piggy-backs on the TPV camera detour below; the
-    // detour reads settings().tpvFovDegrees from the hot-reload atomic, so no
-    // separate FOV hook is installed here.
+    // detour reads the FOV from its settings snapshot (refreshed on each INI
+    // reload), so no separate FOV hook is installed here.
     if (!initializeTpvCameraHook(mod.base, mod.size))
     {
         logger.warning("TPV Camera Offset Hook initialization failed - Offset feature disabled");
@@ -171,6 +173,7 @@ static void register_press_bindings()
                       return;
                   const bool new_mode = !camera_state().adjustmentMode.load();
                   camera_state().adjustmentMode.store(new_mode);
+                  wake_tpv_worker(); // start the offset repeat if a key is already held
                   DMK::Logger::get_instance().info("Camera adjustment mode {}", new_mode ? "ENABLED" : "DISABLED");
               }, "0x7A"); // F11
     add_press("CameraProfiles", "ProfileSaveKey", "Profile Save Key", "profile_save",
@@ -201,18 +204,18 @@ static void register_hold_bindings()
         handleHoldToScrollKeyState(held);
     });
 
-    input_mgr.register_hold("offset_x_inc", g_config.offset_x_inc_keys, [](bool) {});
-    input_mgr.register_hold("offset_x_dec", g_config.offset_x_dec_keys, [](bool) {});
-    input_mgr.register_hold("offset_y_inc", g_config.offset_y_inc_keys, [](bool) {});
-    input_mgr.register_hold("offset_y_dec", g_config.offset_y_dec_keys, [](bool) {});
-    input_mgr.register_hold("offset_z_inc", g_config.offset_z_inc_keys, [](bool) {});
-    input_mgr.register_hold("offset_z_dec", g_config.offset_z_dec_keys, [](bool) {});
+    input_mgr.register_hold("offset_x_inc", g_config.offset_x_inc_keys, [](bool held) { set_offset_key_held(OffsetKey::XInc, held); });
+    input_mgr.register_hold("offset_x_dec", g_config.offset_x_dec_keys, [](bool held) { set_offset_key_held(OffsetKey::XDec, held); });
+    input_mgr.register_hold("offset_y_inc", g_config.offset_y_inc_keys, [](bool held) { set_offset_key_held(OffsetKey::YInc, held); });
+    input_mgr.register_hold("offset_y_dec", g_config.offset_y_dec_keys, [](bool held) { set_offset_key_held(OffsetKey::YDec, held); });
+    input_mgr.register_hold("offset_z_inc", g_config.offset_z_inc_keys, [](bool held) { set_offset_key_held(OffsetKey::ZInc, held); });
+    input_mgr.register_hold("offset_z_dec", g_config.offset_z_dec_keys, [](bool held) { set_offset_key_held(OffsetKey::ZDec, held); });
 }
 
 /**
  * @brief Starts the INI hot-reload watcher.
- * @details The register_atomic setters re-apply the live settings on each reload,
- *          so the callback only reports the outcome.
+ * @details The register_atomic setters re-apply the live settings on each reload;
+ *          the callback re-snapshots the input-hook settings and reports the outcome.
  */
 static void enable_hot_reload()
 {
@@ -221,6 +224,8 @@ static void enable_hot_reload()
     const DMK::Config::AutoReloadStatus status = DMK::Config::enable_auto_reload(
         std::chrono::milliseconds{250}, [](bool content_changed) {
             DMK::Logger &reload_logger = DMK::Logger::get_instance();
+            refreshTpvInputSettings();
+            refreshTpvCameraSettings();
             if (content_changed)
                 reload_logger.info("INI auto-reload: live settings applied");
             else
@@ -244,6 +249,8 @@ bool init()
     register_press_bindings();
     DMK::Config::load(Constants::getConfigFilename());
     DMK::Config::log_all();
+    refreshTpvInputSettings();
+    refreshTpvCameraSettings();
 
     // Fall back to the module directory when no profile directory was configured.
     if (g_config.profile_directory.empty())
@@ -288,11 +295,9 @@ bool init()
         CameraProfileManager::getInstance().setTransitionSettings(
             g_config.transition_duration, g_config.use_spring_physics,
             g_config.spring_strength, g_config.spring_damping);
-
-        s_cameraProfileWorker = std::make_unique<DMK::StoppableWorker>("KCD2_TPV_CameraProfile", &camera_profile_body);
     }
 
-    s_overlayWorker = std::make_unique<DMK::StoppableWorker>("KCD2_TPV_OverlayMonitor", &overlay_monitor_body);
+    s_worker = std::make_unique<DMK::StoppableWorker>("KCD2_TPV_Worker", &tpv_worker_body);
 
     enable_hot_reload();
 
@@ -308,36 +313,28 @@ void shutdown()
     // Stop the INI watcher first so no reload setter runs during teardown.
     DMK::Config::disable_auto_reload();
 
-    // Two-phase worker stop: request stop on both so they unwind in parallel,
-    // then join in reverse-dependency order (camera writer before the monitor).
-    if (s_cameraProfileWorker)
-        s_cameraProfileWorker->request_stop();
-    if (s_overlayWorker)
-        s_overlayWorker->request_stop();
-
-    if (s_cameraProfileWorker)
+    // The worker is the only writer that runs outside the input callbacks; stop
+    // it before the bindings that feed it are torn down.
+    if (s_worker)
     {
-        logger.info("Shutdown: joining camera-profile worker");
-        s_cameraProfileWorker->shutdown();
-        s_cameraProfileWorker.reset();
-    }
-    if (s_overlayWorker)
-    {
-        logger.info("Shutdown: joining overlay-monitor worker");
-        s_overlayWorker->shutdown();
-        s_overlayWorker.reset();
+        logger.info("Shutdown: joining background worker");
+        s_worker->shutdown();
+        s_worker.reset();
     }
 
+    // Flush queued profile edits and join the profile writer while the module
+    // is still fully loaded; the singleton's destructor runs too late for a join.
+    CameraProfileManager::getInstance().shutdownPersistence();
+
     // Disable the press callbacks so they cannot run during teardown.
     s_bindingGuards.clear();
 
     // DMK_Shutdown() removes every HookManager hook on its own (production:
     // Bootstrap calls it after this returns; dev: the logic DLL's Shutdown()
     // calls it), so the inline/mid hooks are not removed here. Only the teardown
-    // it cannot do runs now: the event hook restores the scroll-accumulator
-    // instruction it patched into the game image, so the NOP is never latched as
-    // the "original" across a hot-reload, and the game interface clears its
-    // resolved context pointer.
+    // it cannot do runs now: the event hook stops suppressing the scroll-accumulator
+    // write, so scrolling works for as long as its mid hook outlives this call, and
+    // the game interface clears its resolved context pointer.
     cleanupEventHooks();
     cleanupGameInterface();
 
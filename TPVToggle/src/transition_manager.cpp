@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <type_traits>
 
 namespace TPVToggle
 {
@@ -16,22 +18,30 @@ namespace
     constexpr float k_minTransitionDuration = 1e-4f;
 } // namespace
 
+static_assert(std::is_trivially_copyable_v<Vector3> && std::is_trivially_copyable_v<Quaternion>,
+              "TransitionPlan is published as raw words");
+
 TransitionManager &TransitionManager::getInstance()
 {
     static TransitionManager instance;
     return instance;
 }
 
-TransitionManager::TransitionManager()
-    : m_isTransitioning(false),
-      m_transitionProgress(0.0f),
-      m_transitionDuration(0.5f),
-      m_defaultDuration(0.5f),
-      m_useSpringPhysics(false),
-      m_springStrength(10.0f),
-      m_springDamping(0.8f),
-      m_springVelocity(0.0f, 0.0f, 0.0f)
+void TransitionManager::publishPlan(const TransitionPlan &plan)
 {
+    uint32_t words[k_planWords] = {};
+    std::memcpy(words, &plan, sizeof(plan));
+
+    std::lock_guard<std::mutex> lock(m_publishMutex);
+    const uint32_t seq = m_planSeq.load(std::memory_order_relaxed);
+    m_planSeq.store(seq + 1, std::memory_order_relaxed); // odd: publish in progress
+    // Keep the word stores below from being reordered ahead of the odd sequence.
+    std::atomic_thread_fence(std::memory_order_release);
+    for (std::size_t i = 0; i < k_planWords; ++i)
+    {
+        m_planWords[i].store(words[i], std::memory_order_relaxed);
+    }
+    m_planSeq.store(seq + 2, std::memory_order_release); // even: published
 }
 
 void TransitionManager::startTransition(
@@ -39,114 +49,132 @@ void TransitionManager::startTransition(
     const Quaternion &targetRotation,
     float durationSeconds)
 {
-    float started_duration = 0.0f;
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
+    TransitionPlan plan{};
+    plan.start = true;
+    plan.useSpringPhysics = m_useSpringPhysicsDefault.load(std::memory_order_relaxed);
+    plan.duration = std::max((durationSeconds > 0.0f) ? durationSeconds : m_defaultDuration.load(std::memory_order_relaxed),
+                             k_minTransitionDuration);
+    plan.springStrength = m_springStrengthDefault.load(std::memory_order_relaxed);
+    plan.springDamping = m_springDampingDefault.load(std::memory_order_relaxed);
+    // Snapshot the live offset as the source. The camera-hook thread uses it for a fresh
+    // transition and keeps blending from its current pose for a re-target mid-flight.
+    plan.source = TPVToggle::camera_state().offset.load();
+    plan.target = targetPosition;
+    plan.targetRotation = targetRotation;
+    publishPlan(plan);
 
-        // Snapshot the live offset as the source only on a fresh transition, so a
-        // re-target mid-flight blends from the current pose rather than snapping back.
-        if (!m_isTransitioning.load(std::memory_order_relaxed))
-        {
-            m_sourceState = CameraState(TPVToggle::camera_state().offset.load(), Quaternion::Identity());
-        }
+    DMK::Logger::get_instance().debug("TransitionManager: Started transition to: ({}, {}, {}) over {} seconds",
+                                      targetPosition.x, targetPosition.y, targetPosition.z, plan.duration);
+}
 
-        m_targetState = CameraState(targetPosition, targetRotation);
+void TransitionManager::adoptPublishedPlan()
+{
+    const uint32_t seq = m_planSeq.load(std::memory_order_acquire);
+    if (seq == m_adoptedSeq || (seq & 1u) != 0u)
+    {
+        return; // nothing new, or a publish is in flight (picked up next frame)
+    }
 
-        m_transitionProgress = 0.0f;
-        m_transitionDuration = std::max((durationSeconds > 0.0f) ? durationSeconds : m_defaultDuration, k_minTransitionDuration);
-        m_springVelocity = Vector3(0.0f, 0.0f, 0.0f);
-        started_duration = m_transitionDuration;
+    uint32_t words[k_planWords];
+    for (std::size_t i = 0; i < k_planWords; ++i)
+    {
+        words[i] = m_planWords[i].load(std::memory_order_relaxed);
+    }
+    // Pairs with the publisher's fence so the word loads are ordered before the re-read.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (m_planSeq.load(std::memory_order_relaxed) != seq)
+    {
+        return; // torn by a newer publish; adopt that one next frame
+    }
+    m_adoptedSeq = seq;
 
-        // Publish the populated state before the per-frame reader's fast path can
-        // observe the transition as active.
-        m_isTransitioning.store(true, std::memory_order_release);
+    TransitionPlan plan;
+    std::memcpy(&plan, words, sizeof(plan));
+    if (!plan.start)
+    {
+        m_running = false;
+        m_isTransitioning.store(false, std::memory_order_relaxed);
+        return;
     }
 
-    DMK::Logger::get_instance().debug("TransitionManager: Started transition to: ({}, {}, {}) over {} seconds",
-                                      targetPosition.x, targetPosition.y, targetPosition.z, started_duration);
+    m_sourceState = m_running ? m_lastOutput : CameraState(plan.source, Quaternion::Identity());
+    m_targetState = CameraState(plan.target, plan.targetRotation);
+    m_transitionProgress = 0.0f;
+    m_transitionDuration = plan.duration;
+    m_useSpringPhysics = plan.useSpringPhysics;
+    m_springStrength = plan.springStrength;
+    m_springDamping = plan.springDamping;
+    m_springVelocity = Vector3(0.0f, 0.0f, 0.0f);
+    m_lastOutput = m_sourceState;
+    m_running = true;
+    m_isTransitioning.store(true, std::memory_order_relaxed);
 }
 
 bool TransitionManager::updateTransition(float deltaTime, Vector3 &outPosition, Quaternion &outRotation)
 {
-    // Lock-free fast path: skip the mutex entirely while no transition is running
-    // (the common per-frame case on the camera-hook thread).
-    if (!m_isTransitioning.load(std::memory_order_acquire))
+    adoptPublishedPlan();
+
+    // Fast path: nothing running (the common per-frame case on the camera-hook thread).
+    if (!m_running)
     {
         return false;
     }
 
-    bool completed = false;
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        // Re-check under the lock: a concurrent completion or cancel may have
-        // cleared the flag between the fast-path load and acquiring the mutex.
-        if (!m_isTransitioning.load(std::memory_order_relaxed))
-        {
-            return false;
-        }
-
-        m_transitionProgress += deltaTime / m_transitionDuration;
-
-        if (m_transitionProgress >= 1.0f)
-        {
-            m_isTransitioning.store(false, std::memory_order_release);
-            m_transitionProgress = 1.0f;
-
-            // Snap exactly to the target on completion to avoid float drift left
-            // by the interpolation.
-            outPosition = m_targetState.position;
-            outRotation = m_targetState.rotation;
-            completed = true;
-        }
-        else
-        {
-            const float t = smoothstep(m_transitionProgress);
-
-            Vector3 interpolatedPosition = Vector3(
-                m_sourceState.position.x + (m_targetState.position.x - m_sourceState.position.x) * t,
-                m_sourceState.position.y + (m_targetState.position.y - m_sourceState.position.y) * t,
-                m_sourceState.position.z + (m_targetState.position.z - m_sourceState.position.z) * t);
-
-            if (m_useSpringPhysics)
-            {
-                interpolatedPosition = applySpringPhysics(interpolatedPosition, m_targetState.position, deltaTime);
-            }
-
-            // Spherical linear interpolation keeps angular velocity constant across
-            // the transition and avoids the gimbal artifacts a component-wise lerp
-            // would introduce on rotations.
-            outPosition = interpolatedPosition;
-            outRotation = Quaternion::Slerp(m_sourceState.rotation, m_targetState.rotation, t);
-        }
-    }
+    m_transitionProgress += deltaTime / m_transitionDuration;
 
-    // Log outside the lock so the Logger's own locks never nest under m_mutex.
-    if (completed)
+    if (m_transitionProgress >= 1.0f)
     {
+        m_running = false;
+        m_isTransitioning.store(false, std::memory_order_relaxed);
+        m_transitionProgress = 1.0f;
+
+        // Snap exactly to the target on completion to avoid float drift left
+        // by the interpolation.
+        outPosition = m_targetState.position;
+        outRotation = m_targetState.rotation;
         DMK::Logger::get_instance().debug("TransitionManager: Transition completed");
         return false; // Transition is complete
     }
 
+    const float t = smoothstep(m_transitionProgress);
+
+    Vector3 interpolatedPosition = Vector3(
+        m_sourceState.position.x + (m_targetState.position.x - m_sourceState.position.x) * t,
+        m_sourceState.position.y + (m_targetState.position.y - m_sourceState.position.y) * t,
+        m_sourceState.position.z + (m_targetState.position.z - m_sourceState.position.z) * t);
+
+    if (m_useSpringPhysics)
+    {
+        interpolatedPosition = applySpringPhysics(interpolatedPosition, m_targetState.position, deltaTime);
+    }
+
+    // Spherical linear interpolation keeps angular velocity constant across
+    // the transition and avoids the gimbal artifacts a component-wise lerp
+    // would introduce on rotations.
+    outPosition = interpolatedPosition;
+    outRotation = Quaternion::Slerp(m_sourceState.rotation, m_targetState.rotation, t);
+    m_lastOutput = CameraState(outPosition, outRotation);
+
     return true; // Transition is still in progress
 }
 
+bool TransitionManager::isIdle() const noexcept
+{
+    return !m_running && m_planSeq.load(std::memory_order_acquire) == m_adoptedSeq;
+}
+
 bool TransitionManager::isTransitioning() const noexcept
 {
-    return m_isTransitioning.load(std::memory_order_acquire);
+    return m_isTransitioning.load(std::memory_order_relaxed);
 }
 
 void TransitionManager::cancelTransition()
 {
-    bool was_active = false;
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_isTransitioning.load(std::memory_order_relaxed))
-        {
-            m_isTransitioning.store(false, std::memory_order_release);
-            was_active = true;
-        }
-    }
+    const bool was_active = isTransitioning();
+
+    TransitionPlan plan{};
+    plan.start = false;
+    publishPlan(plan);
 
     if (was_active)
     {
@@ -4,6 +4,8 @@
 #include "math_utils.hpp"
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
 
 namespace TPVToggle
@@ -25,6 +27,12 @@ struct CameraState
  *
  * This singleton class handles the interpolation between different camera positions and
  * rotations when switching profiles, providing smooth animations rather than abrupt changes.
+ *
+ * Threading: startTransition()/cancelTransition() run on the profile writers (input callbacks,
+ * under the profile mutex) and only publish an immutable TransitionPlan (source, target,
+ * duration, spring constants) through a sequence-locked mailbox. updateTransition() runs every frame on the camera-hook thread, adopts
+ * a newly published plan, and owns the integrator state outright, so the per-frame path never
+ * takes a lock and never waits on a profile switch.
  */
 class TransitionManager
 {
@@ -37,6 +45,9 @@ public:
 
     /**
      * @brief Start a transition to a new profile
+     * @details Publishes the plan for the camera-hook thread; it is picked up on the next frame.
+     *          Call before publishing the new offset to camera_state().offset, so a frame that
+     *          reads the new offset also sees the plan.
      * @param targetPosition The target position to transition to
      * @param targetRotation The target rotation to transition to
      * @param durationSeconds Duration of the transition in seconds, or -1 to use default
@@ -44,7 +55,7 @@ public:
     void startTransition(const Vector3 &targetPosition, const Quaternion &targetRotation, float durationSeconds);
 
     /**
-     * @brief Update the transition (call every frame)
+     * @brief Update the transition (call every frame, camera-hook thread only)
      * @param deltaTime Time elapsed since last frame in seconds
      * @param outPosition Output parameter for the interpolated position
      * @param outRotation Output parameter for the interpolated rotation
@@ -52,9 +63,16 @@ public:
      */
     [[nodiscard]] bool updateTransition(float deltaTime, Vector3 &outPosition, Quaternion &outRotation);
 
+    /**
+     * @brief Whether updateTransition() would do nothing this frame (camera-hook thread only)
+     * @details No transition is running and no plan has been published since the last adoption. One
+     *          acquire load, so the caller can skip the frame clock read on the common idle frame.
+     */
+    [[nodiscard]] bool isIdle() const noexcept;
+
     /**
      * @brief Check if a transition is in progress
-     * @return true if a transition is currently active
+     * @return true if a transition is currently active (as of the camera-hook thread's last update)
      */
     [[nodiscard]] bool isTransitioning() const noexcept;
 
@@ -63,58 +81,69 @@ public:
      */
     void cancelTransition();
 
-    // Configuration methods
-    void setTransitionDuration(float seconds)
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_defaultDuration = seconds;
-    }
-    void setUseSpringPhysics(bool enable)
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_useSpringPhysics = enable;
-    }
-    void setSpringStrength(float value)
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_springStrength = value;
-    }
-    void setSpringDamping(float value)
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_springDamping = value;
-    }
+    // Configuration methods. Read when a transition starts and baked into its plan.
+    void setTransitionDuration(float seconds) { m_defaultDuration.store(seconds, std::memory_order_relaxed); }
+    void setUseSpringPhysics(bool enable) { m_useSpringPhysicsDefault.store(enable, std::memory_order_relaxed); }
+    void setSpringStrength(float value) { m_springStrengthDefault.store(value, std::memory_order_relaxed); }
+    void setSpringDamping(float value) { m_springDampingDefault.store(value, std::memory_order_relaxed); }
 
 private:
-    TransitionManager();
+    TransitionManager() = default;
     ~TransitionManager() = default;
 
     // Prevent copying
     TransitionManager(const TransitionManager &) = delete;
     TransitionManager &operator=(const TransitionManager &) = delete;
 
-    // The transition state below is mutated by updateTransition() on the per-frame
-    // camera-hook thread and by startTransition()/cancelTransition() on the camera
-    // profile thread, so it is guarded by m_mutex. m_isTransitioning is also atomic
-    // so the per-frame fast path can skip the lock entirely while idle (no
-    // transition running), which is the common case.
-    std::atomic<bool> m_isTransitioning;
-    mutable std::mutex m_mutex;
-
-    // Transition state (guarded by m_mutex)
-    float m_transitionProgress;
-    float m_transitionDuration;
-    float m_defaultDuration;
-
-    // Spring physics (guarded by m_mutex)
-    bool m_useSpringPhysics;
-    float m_springStrength;
-    float m_springDamping;
-    Vector3 m_springVelocity;
-
-    // Current source and target states (guarded by m_mutex)
+    // One published command: start a transition with these parameters, or cancel.
+    struct TransitionPlan
+    {
+        bool start;
+        bool useSpringPhysics;
+        float duration;
+        float springStrength;
+        float springDamping;
+        Vector3 source; // live offset when the transition was requested
+        Vector3 target;
+        Quaternion targetRotation;
+    };
+
+    /// Publishes @p plan to the mailbox (profile-thread side, under m_publishMutex).
+    void publishPlan(const TransitionPlan &plan);
+
+    /// Adopts a plan published since the last frame, if one can be read tear-free (camera-hook thread).
+    void adoptPublishedPlan();
+
+    // Configuration defaults (written by the setters, read by startTransition).
+    std::atomic<float> m_defaultDuration{0.5f};
+    std::atomic<bool> m_useSpringPhysicsDefault{false};
+    std::atomic<float> m_springStrengthDefault{10.0f};
+    std::atomic<float> m_springDampingDefault{0.8f};
+
+    // Plan mailbox. The plan is copied word by word into relaxed atomics between an odd and an even
+    // sequence store (the same seqlock publish as CameraOffsetState). Publishers are serialized by
+    // m_publishMutex, which the camera-hook thread never takes; the reader does not retry either: a
+    // read torn by a concurrent publish is dropped and the newer plan is adopted on the next frame.
+    static constexpr std::size_t k_planWords = (sizeof(TransitionPlan) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+    std::mutex m_publishMutex;
+    std::atomic<uint32_t> m_planSeq{0};
+    std::atomic<uint32_t> m_planWords[k_planWords] = {};
+
+    // Mirror of m_running for isTransitioning() callers on other threads.
+    std::atomic<bool> m_isTransitioning{false};
+
+    // Integrator state: owned by the camera-hook thread (updateTransition) alone, so plain members.
+    uint32_t m_adoptedSeq = 0;
+    bool m_running = false;
+    float m_transitionProgress = 0.0f;
+    float m_transitionDuration = 0.5f;
+    bool m_useSpringPhysics = false;
+    float m_springStrength = 10.0f;
+    float m_springDamping = 0.8f;
+    Vector3 m_springVelocity{0.0f, 0.0f, 0.0f};
     CameraState m_sourceState;
     CameraState m_targetState;
+    CameraState m_lastOutput; // last interpolated pose: the source of a re-target mid-flight
 
     /**
      * @brief Smoothstep function for natural easing
@@ -12,6 +12,8 @@
 #define UTILS_HPP
 
 #include <DetourModKit.hpp>
+#include <bit>
+#include <cstdint>
 #include <string>
 #include <sstream>
 #include <iomanip>
@@ -57,6 +59,17 @@ inline std::string Vector3ToString(const Vector3 &v)
     return oss.str();
 }
 
+/**
+ * @brief Packs two floats into one 64-bit word (lo in the low half).
+ * @details Lets a detour settings snapshot publish a pair that must stay
+ *          consistent (a min/max, two offset axes) with one relaxed store.
+ */
+[[nodiscard]] constexpr std::uint64_t packFloats(float lo, float hi) noexcept
+{
+    return static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(lo)) |
+           (static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(hi)) << 32);
+}
+
 /**
  * @brief Sleeps up to total_ms in short slices, returning early when stop is requested.
  * @details A StoppableWorker body uses this so it observes a shutdown within one